@@ -0,0 +1,2 @@
+"""PhysicsRoller is for wheels, soccer balls, billiard balls, and other things that roll."""
+
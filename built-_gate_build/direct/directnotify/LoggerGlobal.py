@@ -0,0 +1,5 @@
+"""instantiate global Logger object"""
+
+from . import Logger
+
+defaultLogger = Logger.Logger()
@@ -0,0 +1,3 @@
+"""
+This package contains notification and logging utilities for Python code.
+"""
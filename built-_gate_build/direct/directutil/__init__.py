@@ -0,0 +1,3 @@
+"""
+This package contains assorted utility classes.
+"""
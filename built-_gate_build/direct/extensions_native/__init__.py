@@ -0,0 +1,4 @@
+"""
+This package contains various Python methods that extend some of Panda's
+underlying C++ classes.
+"""
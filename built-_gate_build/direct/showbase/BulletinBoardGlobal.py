@@ -0,0 +1,7 @@
+"""instantiate global BulletinBoard object"""
+
+__all__ = ['bulletinBoard']
+
+from . import BulletinBoard
+
+bulletinBoard = BulletinBoard.BulletinBoard()
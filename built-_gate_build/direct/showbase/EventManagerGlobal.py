@@ -0,0 +1,8 @@
+"""Contains the global :class:`.EventManager` instance."""
+
+__all__ = ['eventMgr']
+
+from . import EventManager
+
+#: The global event manager.
+eventMgr = EventManager.EventManager()
@@ -0,0 +1,5 @@
+__all__ = ['jobMgr']
+
+from . import JobManager
+
+jobMgr = JobManager.JobManager()
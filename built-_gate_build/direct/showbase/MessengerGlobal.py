@@ -0,0 +1,7 @@
+"""instantiate global Messenger object"""
+
+__all__ = ['messenger']
+
+from . import Messenger
+
+messenger = Messenger.Messenger()
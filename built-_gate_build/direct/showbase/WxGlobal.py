@@ -0,0 +1,4 @@
+""" This module is now vestigial.  """
+
+def spawnWxLoop():
+    base.spawnWxLoop()
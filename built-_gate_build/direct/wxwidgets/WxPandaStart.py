@@ -0,0 +1,3 @@
+from .WxPandaShell import *
+base.app = WxPandaShell()
+
@@ -0,0 +1,68 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file animJointTable.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef ANIMJOINTTABLE_H
+#define ANIMJOINTTABLE_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "pta_stdfloat.h"
+#include "compose_matrix.h"
+#include "luse.h"
+#include "pvector.h"
+
+/**
+ * The joint channels of an AnimBundle, packed into a single table.  Each
+ * AnimChannelMatrixXfmTable normally stores its twelve components in twelve
+ * separate tables; here, all of the components of all of the joints of one
+ * frame are stored next to each other, joint by joint.  Sampling the whole
+ * skeleton at a given frame, as compose_frame() does, therefore walks
+ * through a single small block of memory from start to end.
+ *
+ * This is created by AnimBundle::pack_joints(), and once created, the
+ * channels read their values from it, and AnimControl evaluates all of the
+ * joints of a frame at once when the PartBundle is updated.  It does not
+ * change afterwards; a channel whose tables are modified stops using it.
+ */
+class EXPCL_PANDA_CHAN AnimJointTable : public ReferenceCount {
+public:
+  AnimJointTable(int num_frames, int num_joints);
+
+  void set_joint(int joint, const CPTA_stdfloat tables[num_matrix_components]);
+  void compose_frame(int frame, LMatrix4 *mats,
+                     bool no_scale_shear = false) const;
+
+PUBLISHED:
+  INLINE int get_num_frames() const;
+  INLINE int get_num_joints() const;
+  MAKE_PROPERTY(num_frames, get_num_frames);
+  MAKE_PROPERTY(num_joints, get_num_joints);
+
+  INLINE PN_stdfloat get_component(int frame, int joint, int component) const;
+  void get_value(int frame, int joint, LMatrix4 &mat) const;
+
+private:
+  INLINE const PN_stdfloat *get_frame_data(int frame) const;
+
+  int _num_frames;
+  int _num_joints;
+
+  // This is indexed by [frame][joint][component].
+  typedef pvector<PN_stdfloat> Data;
+  Data _data;
+};
+
+#include "animJointTable.I"
+
+#endif
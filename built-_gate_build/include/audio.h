@@ -0,0 +1,22 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file audio.h
+ * @author frang
+ * @date 2000-07-06
+ */
+
+#ifndef AUDIO_H
+#define AUDIO_H
+
+#include "filterProperties.h"
+#include "audioLoadRequest.h"
+#include "audioSound.h"
+#include "audioManager.h"
+
+#endif /* AUDIO_H */
@@ -0,0 +1,3 @@
+
+# include "dtoolbase.h"
+EXPCL_DTOOL_DTOOLBASE int panda_version_1_10 = 0;
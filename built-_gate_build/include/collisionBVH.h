@@ -0,0 +1,94 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file collisionBVH.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef COLLISIONBVH_H
+#define COLLISIONBVH_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "geometricBoundingVolume.h"
+#include "luse.h"
+#include "pvector.h"
+#include "vector_int.h"
+
+class BoundingVolume;
+
+/**
+ * A bounding volume hierarchy over a fixed set of items, each represented by
+ * an axis-aligned bounding box.  This is used by the CollisionTraverser to
+ * quickly find the handful of solids in a large CollisionNode (or triangles
+ * in a large Geom) that might intersect a particular collider, without
+ * having to test each one in turn.
+ *
+ * Items are identified by the order in which they were added.  Items without
+ * finite bounds (such as planes) may also be added; they are always returned
+ * by find_overlaps().
+ */
+class EXPCL_PANDA_COLLIDE CollisionBVH : public ReferenceCount {
+public:
+  CollisionBVH();
+
+  INLINE void add_item(const LPoint3 &min_point, const LPoint3 &max_point);
+  void add_item(const BoundingVolume *bounds);
+  INLINE void add_unbounded_item();
+  void build();
+
+  INLINE int get_num_items() const;
+  INLINE int get_num_nodes() const;
+
+  void find_overlaps(const GeometricBoundingVolume *volume,
+                     vector_int &result) const;
+
+  void output(std::ostream &out) const;
+
+private:
+  void r_build(int node_index, int begin, int end);
+
+  // A node of the hierarchy.  For an interior node, _first is the index of
+  // the first child; the second child follows immediately after it.  For a
+  // leaf, _first is the index into _indices of the first of _num_items
+  // items.
+  class Node {
+  public:
+    LPoint3 _min;
+    LPoint3 _max;
+    int _first;
+    int _num_items;
+  };
+  typedef pvector<Node> Nodes;
+  Nodes _nodes;
+
+  // The bounds of each item, indexed by the item number.
+  class Item {
+  public:
+    LPoint3 _min;
+    LPoint3 _max;
+    LPoint3 _center;
+  };
+  typedef pvector<Item> Items;
+  Items _items;
+
+  vector_int _indices;
+  vector_int _unbounded;
+  int _num_items;
+};
+
+INLINE std::ostream &operator << (std::ostream &out, const CollisionBVH &bvh) {
+  bvh.output(out);
+  return out;
+}
+
+#include "collisionBVH.I"
+
+#endif
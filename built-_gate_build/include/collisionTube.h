@@ -0,0 +1,27 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file collisionTube.h
+ * @author rdb
+ * @date 2018-12-23
+ */
+
+#ifndef COLLISIONTUBE_H
+#define COLLISIONTUBE_H
+
+#include "collisionCapsule.h"
+
+BEGIN_PUBLISH
+/**
+ * Alias for backward compatibility.
+ * @deprecated use CollisionCapsule instead.
+ */
+typedef CollisionCapsule CollisionTube;
+END_PUBLISH
+
+#endif
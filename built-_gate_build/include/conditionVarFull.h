@@ -0,0 +1,21 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file conditionVarFull.h
+ * @author drose
+ * @date 2006-08-28
+ */
+
+#ifndef CONDITIONVARFULL_H
+#define CONDITIONVARFULL_H
+
+#include "conditionVar.h"
+
+typedef ConditionVar ConditionVarFull;
+
+#endif
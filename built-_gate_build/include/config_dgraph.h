@@ -0,0 +1,23 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file config_dgraph.h
+ * @author drose
+ * @date 2000-03-01
+ */
+
+#ifndef CONFIG_DGRAPH_H
+#define CONFIG_DGRAPH_H
+
+#include "pandabase.h"
+
+#include "notifyCategoryProxy.h"
+
+NotifyCategoryDecl(dgraph, EXPCL_PANDA_DGRAPH, EXPTP_PANDA_DGRAPH);
+
+#endif
@@ -0,0 +1,24 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file config_dtoolutil.h
+ * @author drose
+ * @date 2006-11-17
+ */
+
+#ifndef CONFIG_DTOOLUTIL_H
+#define CONFIG_DTOOLUTIL_H
+
+#include "dtoolbase.h"
+
+// Include this so interrogate can find it.
+#include <iostream>
+
+extern EXPCL_DTOOL_DTOOLUTIL void init_libdtoolutil();
+
+#endif
@@ -0,0 +1,22 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file config_parametrics.h
+ * @author drose
+ * @date 2000-03-19
+ */
+
+#ifndef CONFIG_PARAMETRICS_H
+#define CONFIG_PARAMETRICS_H
+
+#include "pandabase.h"
+#include "notifyCategoryProxy.h"
+
+NotifyCategoryDecl(parametrics, EXPCL_PANDA_PARAMETRICS, EXPTP_PANDA_PARAMETRICS);
+
+#endif
@@ -0,0 +1,2 @@
+// This file to remain during the whole 1.10.x cycle; remove after that.
+#error config_util.h has been renamed to config_putil.h - please update your project.
@@ -0,0 +1 @@
+/* dummy file to make MAX happy */
\ No newline at end of file
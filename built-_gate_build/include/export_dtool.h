@@ -0,0 +1,43 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file export_dtool.h
+ * @author drose
+ * @date 2008-10-15
+ */
+
+#ifndef EXPORT_DTOOL_H
+#define EXPORT_DTOOL_H
+
+// This header file exists to import the symbols necessary to publish all of
+// the classes defined in the dtool source tree.  (These must be published
+// here, instead of within dtool itself, since interrogate is not run on
+// dtool.)
+
+#include "pandabase.h"
+
+#include "pandaSystem.h"
+#include "globPattern.h"
+#include "pandaFileStream.h"
+#include "encryptStream.h"
+#include "configFlags.h"
+#include "configPage.h"
+#include "configPageManager.h"
+#include "configVariable.h"
+#include "configVariableBase.h"
+#include "configVariableBool.h"
+#include "configVariableDouble.h"
+#include "configVariableFilename.h"
+#include "configVariableInt.h"
+#include "configVariableInt64.h"
+#include "configVariableList.h"
+#include "configVariableManager.h"
+#include "configVariableSearchPath.h"
+#include "configVariableString.h"
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file flattenTask.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef FLATTENTASK_H
+#define FLATTENTASK_H
+
+#include "pandabase.h"
+
+#include "asyncTask.h"
+#include "sceneGraphReducer.h"
+#include "accumulatedAttribs.h"
+#include "geomTransformer.h"
+#include "pandaNode.h"
+#include "geomNode.h"
+#include "pointerTo.h"
+#include "pvector.h"
+
+/**
+ * Does the same work as NodePath::flatten_light(), flatten_medium() or
+ * flatten_strong(), but a little bit at a time, so that flattening a large
+ * scene graph need not stall the thread that does it for a long time.  Each
+ * call to step() does as much of the work as fits in the indicated amount of
+ * time.  Alternatively, the FlattenTask may be added to an AsyncTaskManager,
+ * in which case it does one time slice of the work each epoch.
+ *
+ * The nodes are visited in the same order as by the blocking calls, so the
+ * result is exactly the same.  The scene graph should not be rendered or
+ * modified in any other way until the flatten has finished.
+ *
+ * The last pass, which unifies the Geoms within each GeomNode, may also be
+ * divided across several threads with set_num_threads().
+ */
+class EXPCL_PANDA_PGRAPH FlattenTask : public AsyncTask {
+PUBLISHED:
+  enum FlattenLevel {
+    FL_light,
+    FL_medium,
+    FL_strong,
+  };
+
+  explicit FlattenTask(PandaNode *root, FlattenLevel level = FL_strong);
+  virtual ~FlattenTask();
+
+  INLINE PandaNode *get_root() const;
+  INLINE FlattenLevel get_level() const;
+  MAKE_PROPERTY(root, get_root);
+  MAKE_PROPERTY(level, get_level);
+
+  INLINE void set_time_slice(double time_slice);
+  INLINE double get_time_slice() const;
+  MAKE_PROPERTY(time_slice, get_time_slice, set_time_slice);
+
+  INLINE void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+  MAKE_PROPERTY(num_threads, get_num_threads, set_num_threads);
+
+  bool step(double max_time = 0.0);
+
+  INLINE bool is_flattened() const;
+  INLINE int get_num_removed() const;
+  MAKE_PROPERTY(num_removed, get_num_removed);
+
+protected:
+  virtual DoneStatus do_task();
+
+private:
+  enum Pass {
+    P_apply_attribs,
+    P_flatten,
+    P_compatible_state,
+    P_collect,
+    P_unify,
+    P_done,
+  };
+
+  void start_pass(Pass pass);
+  void next_pass();
+  void do_step();
+
+  void step_apply_attribs();
+  void step_flatten();
+  void step_compatible_state();
+  void step_collect();
+  void step_unify();
+  void unify_batch();
+
+  void push_apply_frame(PandaNode *node, const AccumulatedAttribs &attribs);
+  void push_preorder_frame(PandaNode *node);
+  void push_collect_frame(PandaNode *node);
+  void clear_frames();
+
+  static void unify_geom_nodes(size_t begin, size_t end, void *user_data);
+
+private:
+  PT(PandaNode) _root;
+  FlattenLevel _level;
+  double _time_slice;
+  int _num_threads;
+
+  SceneGraphReducer _reducer;
+  Pass _pass;
+  int _combine_siblings_bits;
+  int _collect_bits;
+  bool _preserve_order;
+  int _num_removed;
+
+  // Each pass walks the scene graph with an explicit stack of these, rather
+  // than recursively, so that the walk may be suspended between steps.  Not
+  // all of the members are used by every pass.
+  class Frame {
+  public:
+    INLINE Frame(PandaNode *grandparent, PandaNode *node);
+
+    PT(PandaNode) _grandparent;
+    PT(PandaNode) _node;
+    PandaNode::Children _children;
+    size_t _next_child;
+    int _bits;
+    int _num_nodes;
+    AccumulatedAttribs _attribs;
+    GeomTransformer *_transformer;
+    bool _owns_transformer;
+  };
+  typedef pvector<Frame> Frames;
+  Frames _frames;
+
+  typedef pvector<PT(GeomNode)> GeomNodes;
+  GeomNodes _geom_nodes;
+  size_t _next_geom_node;
+
+  class ParallelUnify {
+  public:
+    PT(GeomNode) *_geom_nodes;
+    int _max_indices;
+    bool _preserve_order;
+    int _pipeline_stage;
+    pvector<unsigned char> _changed;
+  };
+
+public:
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    AsyncTask::init_type();
+    register_type(_type_handle, "FlattenTask",
+                  AsyncTask::get_class_type());
+  }
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+private:
+  static TypeHandle _type_handle;
+};
+
+#include "flattenTask.I"
+
+#endif
@@ -0,0 +1,23 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file glstuff_undef_src.h
+ * @author drose
+ * @date 2004-02-09
+ */
+
+// This header file #undefs all the stuff you had to #define to include
+// glstuff_src.h or glstuff_src.cxx.
+
+#undef GLP
+#undef CLP
+#undef CLASSPREFIX_QUOTED
+#undef CONFIGOBJ
+#undef GLCAT
+#undef EXPCL
+#undef EXPTP
@@ -0,0 +1,30 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lcast_to.h
+ * @author drose
+ * @date 2001-04-03
+ */
+
+#ifndef LCAST_TO_H
+#define LCAST_TO_H
+
+/*
+ * This file defines the various lcast_to() functions on the types defined
+ * within this module.  It is assumed that all the types have already been
+ * defined.  The lcast_to() functions are invoked by the LCAST macro to
+ * convert a linmath object from one numeric type to another.
+ */
+
+#include "dbl2fltnames.h"
+#include "lcast_to_src.h"
+
+#include "flt2dblnames.h"
+#include "lcast_to_src.h"
+
+#endif
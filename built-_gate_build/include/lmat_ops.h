@@ -0,0 +1,32 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lmat_ops.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LMAT_OPS_H
+#define LMAT_OPS_H
+
+#include "lvecBase3.h"
+#include "lpoint3.h"
+#include "lvector3.h"
+#include "lvecBase4.h"
+#include "lpoint4.h"
+#include "lvector4.h"
+#include "lmatrix.h"
+
+#include "fltnames.h"
+#include "lmat_ops_src.h"
+
+#include "dblnames.h"
+#include "lmat_ops_src.h"
+
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lmatrix.h
+ * @author drose
+ * @date 1999-01-15
+ */
+
+#ifndef LMATRIX_H
+#define LMATRIX_H
+
+#include "pandabase.h"
+#include "config_linmath.h"
+#include <math.h>
+#include "typedObject.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+#include "pnotify.h"
+#include "indent.h"
+
+#include "deg_2_rad.h"
+#include "nearly_zero.h"
+
+#include "coordinateSystem.h"
+#include "lvecBase4.h"
+#include "lvecBase3.h"
+#include "lvecBase2.h"
+
+#include "fltnames.h"
+// lmatrix3_src.h includes lmatrix4_src.h.
+#include "lmatrix3_src.h"
+
+#include "dblnames.h"
+#include "lmatrix3_src.h"
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lmatrix_ext.h
+ * @author rdb
+ * @date 2013-09-13
+ */
+
+#ifndef LMATRIX_EXT_H
+#define LMATRIX_EXT_H
+
+#include "lmatrix.h"
+#include "extension.h"
+
+#include "fltnames.h"
+#include "lmatrix3_ext_src.h"
+#include "lmatrix4_ext_src.h"
+
+#include "dblnames.h"
+#include "lmatrix3_ext_src.h"
+#include "lmatrix4_ext_src.h"
+
+#endif
@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file look_at.h
+ * @author drose
+ * @date 1997-04-25
+ */
+
+#ifndef LOOKAT_H
+#define LOOKAT_H
+
+// Includes
+#include "pandabase.h"
+#include "cmath.h"
+#include "coordinateSystem.h"
+#include "luse.h"
+
+#include "fltnames.h"
+#include "look_at_src.h"
+
+#include "dblnames.h"
+#include "look_at_src.h"
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lorientation.h
+ * @author frang, charles
+ * @date 2000-06-23
+ */
+
+#ifndef __LORIENTATION_H__
+#define __LORIENTATION_H__
+
+#include "pandabase.h"
+#include "pnotify.h"
+#include "lquaternion.h"
+
+#include "fltnames.h"
+#include "lorientation_src.h"
+
+#include "dblnames.h"
+#include "lorientation_src.h"
+
+#endif /* __LORIENTATION_H__ */
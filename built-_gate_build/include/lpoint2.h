@@ -0,0 +1,31 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lpoint2.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LPOINT2_H
+#define LPOINT2_H
+
+#include "pandabase.h"
+
+#include "lvecBase2.h"
+#include "lvector2.h"
+
+#include "fltnames.h"
+#include "lpoint2_src.h"
+
+#include "dblnames.h"
+#include "lpoint2_src.h"
+
+#include "intnames.h"
+#include "lpoint2_src.h"
+
+#endif
@@ -0,0 +1,33 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lpoint3.h
+ * @author drose
+ * @date 1999-09-25
+ */
+
+#ifndef LPOINT3_H
+#define LPOINT3_H
+
+#include "pandabase.h"
+
+#include "coordinateSystem.h"
+#include "lvecBase3.h"
+#include "lvector3.h"
+#include "lpoint2.h"
+
+#include "fltnames.h"
+#include "lpoint3_src.h"
+
+#include "dblnames.h"
+#include "lpoint3_src.h"
+
+#include "intnames.h"
+#include "lpoint3_src.h"
+
+#endif
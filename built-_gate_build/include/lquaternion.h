@@ -0,0 +1,33 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lquaternion.h
+ * @author frang
+ * @date 2000-06-06
+ */
+
+#ifndef LQUATERNION_H
+#define LQUATERNION_H
+
+#include "lmatrix.h"
+#include "lvector3.h"
+#include "lvector4.h"
+#include "nearly_zero.h"
+#include "cmath.h"
+#include "deg_2_rad.h"
+#include "compose_matrix.h"
+
+#include "pnotify.h"
+
+#include "fltnames.h"
+#include "lquaternion_src.h"
+
+#include "dblnames.h"
+#include "lquaternion_src.h"
+
+#endif /* __LQUATERNION_H__ */
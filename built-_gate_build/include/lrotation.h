@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lrotation.h
+ * @author frang, charles
+ * @date 2000-06-07
+ */
+
+#ifndef __LROTATION_H__
+#define __LROTATION_H__
+
+#include "pandabase.h"
+#include "lquaternion.h"
+#include "cmath.h"
+
+#include "pnotify.h"
+
+#include "fltnames.h"
+#include "lrotation_src.h"
+
+#include "dblnames.h"
+#include "lrotation_src.h"
+
+#endif /* __LROTATION_H__ */
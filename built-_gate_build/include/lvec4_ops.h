@@ -0,0 +1,32 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvec4_ops.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LVEC4_OPS_H
+#define LVEC4_OPS_H
+
+#include <math.h>
+#include "nearly_zero.h"
+#include "lvecBase4.h"
+#include "lpoint4.h"
+#include "lvector4.h"
+
+#include "fltnames.h"
+#include "lvec4_ops_src.h"
+
+#include "dblnames.h"
+#include "lvec4_ops_src.h"
+
+#include "intnames.h"
+#include "lvec4_ops_src.h"
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvecBase2.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LVECBASE2_H
+#define LVECBASE2_H
+
+#include "pandabase.h"
+#include "config_linmath.h"
+#include "typedObject.h"
+#include "pnotify.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+#include "checksumHashGenerator.h"
+#include "mathNumbers.h"
+#include "deg_2_rad.h"
+#include "lsimpleMatrix.h"
+
+#include "cmath.h"
+#include "nearly_zero.h"
+
+class Datagram;
+class DatagramIterator;
+
+#include "fltnames.h"
+#include "lvecBase2_src.h"
+
+#include "dblnames.h"
+#include "lvecBase2_src.h"
+
+#include "intnames.h"
+#include "lvecBase2_src.h"
+
+#endif
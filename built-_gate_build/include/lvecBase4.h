@@ -0,0 +1,44 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvecBase4.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LVECBASE4_H
+#define LVECBASE4_H
+
+#include "pandabase.h"
+#include "config_linmath.h"
+#include "typedObject.h"
+#include "pnotify.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+#include "checksumHashGenerator.h"
+#include "lvecBase2.h"
+#include "lvecBase3.h"
+#include "lpoint3.h"
+#include "lvector3.h"
+
+#include "cmath.h"
+#include "nearly_zero.h"
+
+class Datagram;
+class DatagramIterator;
+
+#include "fltnames.h"
+#include "lvecBase4_src.h"
+
+#include "dblnames.h"
+#include "lvecBase4_src.h"
+
+#include "intnames.h"
+#include "lvecBase4_src.h"
+
+#endif
@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvecBase4_ext.h
+ * @author rdb
+ * @date 2013-09-13
+ */
+
+#ifndef LVECBASE4_EXT_H
+#define LVECBASE4_EXT_H
+
+#include "lvecBase4.h"
+#include "extension.h"
+
+#include "fltnames.h"
+#include "lvecBase4_ext_src.h"
+
+#include "dblnames.h"
+#include "lvecBase4_ext_src.h"
+
+#include "intnames.h"
+#include "lvecBase4_ext_src.h"
+
+#endif
@@ -0,0 +1,31 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvector2_ext.h
+ * @author rdb
+ * @date 2013-09-13
+ */
+
+#ifndef LVECTOR2_EXT_H
+#define LVECTOR2_EXT_H
+
+#include "lvector2.h"
+#include "extension.h"
+
+#include "lvecBase2_ext.h"
+
+#include "fltnames.h"
+#include "lvector2_ext_src.h"
+
+#include "dblnames.h"
+#include "lvector2_ext_src.h"
+
+#include "intnames.h"
+#include "lvector2_ext_src.h"
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvector3.h
+ * @author drose
+ * @date 1999-09-24
+ */
+
+#ifndef LVECTOR3_H
+#define LVECTOR3_H
+
+#include "pandabase.h"
+
+#include "coordinateSystem.h"
+#include "cmath.h"
+#include "config_linmath.h"
+#include "lvecBase3.h"
+#include "lvector2.h"
+
+#include "fltnames.h"
+#include "lvector3_src.h"
+
+#include "dblnames.h"
+#include "lvector3_src.h"
+
+#include "intnames.h"
+#include "lvector3_src.h"
+
+#endif
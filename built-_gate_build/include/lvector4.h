@@ -0,0 +1,31 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file lvector4.h
+ * @author drose
+ * @date 2000-03-08
+ */
+
+#ifndef LVECTOR4_H
+#define LVECTOR4_H
+
+#include "pandabase.h"
+#include "cmath.h"
+#include "config_linmath.h"
+#include "lvecBase4.h"
+
+#include "fltnames.h"
+#include "lvector4_src.h"
+
+#include "dblnames.h"
+#include "lvector4_src.h"
+
+#include "intnames.h"
+#include "lvector4_src.h"
+
+#endif
@@ -0,0 +1,53 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file mappedFile.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "filename.h"
+
+/**
+ * A read-only view of the complete contents of a file on disk, mapped into
+ * the address space of the process.  The pages are read from disk on demand,
+ * and since they are never written, they are shared with any other process
+ * that maps the same file.
+ *
+ * Objects that point into the mapped memory should hold a reference to the
+ * MappedFile, since the file is unmapped when the last reference goes away.
+ * The file should not be modified on disk while it is mapped.
+ */
+class EXPCL_PANDA_EXPRESS MappedFile : public ReferenceCount {
+public:
+  MappedFile();
+  ~MappedFile();
+
+  bool open(const Filename &filename);
+  void close();
+
+  INLINE bool is_open() const;
+  INLINE const Filename &get_filename() const;
+  INLINE size_t get_size() const;
+  INLINE const unsigned char *get_data() const;
+
+private:
+  Filename _filename;
+  const unsigned char *_data;
+  size_t _size;
+};
+
+#include "mappedFile.I"
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file mouseData.h
+ * @author rdb
+ * @date 2018-09-24
+ */
+
+#ifndef MOUSEDATA_H
+#define MOUSEDATA_H
+
+#include "pointerData.h"
+
+BEGIN_PUBLISH
+/**
+ * Deprecated alias for PointerData.
+ */
+typedef PointerData MouseData;
+
+END_PUBLISH
+
+#endif
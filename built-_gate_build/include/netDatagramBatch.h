@@ -0,0 +1,59 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file netDatagramBatch.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef NETDATAGRAMBATCH_H
+#define NETDATAGRAMBATCH_H
+
+#include "pandabase.h"
+
+#include "netDatagram.h"
+#include "pdeque.h"
+
+/**
+ * A group of NetDatagrams, as returned all at once by
+ * QueuedConnectionReader::get_data_batch().  Receiving datagrams in batches
+ * avoids locking the reader's queue for each datagram.
+ */
+class EXPCL_PANDA_NET NetDatagramBatch {
+PUBLISHED:
+  INLINE NetDatagramBatch();
+
+  INLINE size_t get_num_datagrams() const;
+  INLINE const NetDatagram &get_datagram(size_t n) const;
+  MAKE_SEQ(get_datagrams, get_num_datagrams, get_datagram);
+  INLINE bool is_empty() const;
+  INLINE void clear();
+
+  INLINE size_t size() const;
+  INLINE const NetDatagram &operator [] (size_t n) const;
+
+  void output(std::ostream &out) const;
+
+public:
+  typedef pdeque<NetDatagram> Datagrams;
+  INLINE Datagrams &modify_datagrams();
+
+private:
+  static const NetDatagram &get_empty_datagram();
+
+  Datagrams _datagrams;
+};
+
+INLINE std::ostream &operator << (std::ostream &out, const NetDatagramBatch &batch) {
+  batch.output(out);
+  return out;
+}
+
+#include "netDatagramBatch.I"
+
+#endif
@@ -0,0 +1,15 @@
+
+#define PANDA_MAJOR_VERSION 1
+#define PANDA_MINOR_VERSION 10
+#define PANDA_SEQUENCE_VERSION 4
+#define PANDA_VERSION 1010003
+#define PANDA_NUMERIC_VERSION 1010003
+#define PANDA_VERSION_STR "1.10.4.1"
+#define PANDA_ABI_VERSION_STR "1.10"
+#define PANDA_DISTRIBUTOR "makepanda"
+#define PANDA_PACKAGE_VERSION_STR "dev"
+#define PANDA_PACKAGE_HOST_URL ""
+
+#undef  PANDA_OFFICIAL_VERSION
+
+#define PANDA_GIT_COMMIT_STR "689e0ea203008c58b77fc9428ccf51c6373a7b5d"
@@ -0,0 +1,14 @@
+/**
+ * @file pandaegg.h
+ * @author drose
+ * @date 2001-01-02
+ */
+
+#ifndef PANDAEGG_H
+#define PANDAEGG_H
+
+#include "pandabase.h"
+
+extern "C" EXPCL_PANDAEGG void init_libpandaegg();
+
+#endif
@@ -0,0 +1,14 @@
+/**
+ * @file pandafx.h
+ * @author drose
+ * @date 2001-12-11
+ */
+
+#ifndef PANDAFX_H
+#define PANDAFX_H
+
+#include "pandabase.h"
+
+EXPCL_PANDAFX void init_libpandafx();
+
+#endif
@@ -0,0 +1,15 @@
+/**
+ * @file pandagles2.h
+ * @author rdb
+ * @date 2009-06-16
+ */
+
+#ifndef PANDAGLES2_H
+#define PANDAGLES2_H
+
+#include "pandabase.h"
+
+EXPCL_PANDAGLES2 void init_libpandagles2();
+extern "C" EXPCL_PANDAGLES2 int get_pipe_type_pandagles2();
+
+#endif
@@ -0,0 +1,14 @@
+/**
+ * @file pandaode.h
+ * @author drose
+ * @date 2001-01-02
+ */
+
+#ifndef PANDAODE_H
+#define PANDAODE_H
+
+#include "pandabase.h"
+
+EXPCL_PANDAODE void init_libpandaode();
+
+#endif
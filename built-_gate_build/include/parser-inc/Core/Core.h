@@ -0,0 +1,13 @@
+// SpeedTree.
+
+namespace SpeedTree {
+  class CCore;
+  class CInstance;
+  class SGeometry;
+  class CView;
+  class Vec3;
+
+  class CTerrainRender;
+  class SVertexAttribDesc;  // actuall in ForestRI.h
+  class STerrainCullResults;
+};
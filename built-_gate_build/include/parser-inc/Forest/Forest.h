@@ -0,0 +1,8 @@
+// SpeedTree.
+
+namespace SpeedTree {
+  class CTree;
+  class CForest {
+    class SPopulationStats;
+  };
+};
@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file NxController.h
+ * @author enn0x
+ * @date 2009-09-22
+ */
+
+// This file, and all the other files in this directory, aren't
+// intended to be compiled--they're just parsed by CPPParser (and
+// interrogate) in lieu of the actual system headers, to generate the
+// interrogate database.
+
+#ifndef NXCONTROLLER_H
+#define NXCONTROLLER_H
+
+class NxController;
+class NxControllerDesc;
+class NxUserControllerHitReport;
+class NxControllerShapeHit;
+class NxControllersHit;
+class NxControllerAction;
+
+#endif  // NXCONTROLLER_H
@@ -0,0 +1,16 @@
+namespace OVR {
+  class DeviceBase;
+  class DeviceHandle;
+  class DeviceInfo;
+  class DeviceManager;
+  class HMDDevice;
+  class HMDInfo;
+  class Message;
+  class MessageHandler;
+  class SensorDevice;
+  class SensorInfo;
+  class SensorFusion;
+
+  template<class T> class DeviceEnumerator;
+  template<class T> class Ptr;
+};
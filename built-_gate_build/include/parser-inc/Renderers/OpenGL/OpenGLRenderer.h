@@ -0,0 +1,7 @@
+// SpeedTree.
+
+namespace SpeedTree {
+  class CTreeRender;
+  class CForestRender;
+  class SForestCullResultsRender;
+};
@@ -0,0 +1,5 @@
+namespace Awesomium {
+  class WebView;
+  class FutureJSValue;
+  class JSValue;
+};
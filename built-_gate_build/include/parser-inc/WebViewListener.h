@@ -0,0 +1,4 @@
+namespace Awesomium {
+  class WebViewListener;
+  class JSArguments;
+};
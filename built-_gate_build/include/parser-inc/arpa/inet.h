@@ -0,0 +1,4 @@
+#pragma once
+
+#include <inttypes.h>
+#include <netinet/in.h>
@@ -0,0 +1,4 @@
+#ifndef AVUTIL_H
+#define AVUTIL_H
+
+#endif /* AVUTIL_H */
@@ -0,0 +1 @@
+#include "ode/collision_trimesh.h"
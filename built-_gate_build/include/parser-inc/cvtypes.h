@@ -0,0 +1,13 @@
+
+
+#ifndef _CVTYPES_H_
+#define _CVTYPES_H_
+
+
+struct CvHaarClassifierCascade
+
+
+
+#endif /*_CVTYPES_H_*/
+
+/* End of file. */
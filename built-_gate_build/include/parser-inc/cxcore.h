@@ -0,0 +1,6 @@
+#ifndef _CXCORE_H_
+#define _CXCORE_H_
+
+//Python stub
+
+#endif
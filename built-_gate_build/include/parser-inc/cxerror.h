@@ -0,0 +1,7 @@
+
+#ifndef _CXCORE_ERROR_H_
+#define _CXCORE_ERROR_H_
+
+//python stub
+
+#endif
\ No newline at end of file
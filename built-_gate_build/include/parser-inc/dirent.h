@@ -0,0 +1,3 @@
+typedef struct __dirstream DIR;
+struct dirent;
+typedef unsigned long ino_t;
@@ -0,0 +1,6 @@
+#ifndef DLLPATH_H
+#define DLLPATH_H
+
+// This file is a stub header file.
+
+#endif
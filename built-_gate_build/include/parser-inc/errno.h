@@ -0,0 +1,7 @@
+#pragma once
+
+#define EDOM 33
+#define EILSEQ 84
+#define ERANGE 34
+
+extern int errno;
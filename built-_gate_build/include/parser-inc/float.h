@@ -0,0 +1,18 @@
+#pragma once
+
+#define FLT_RADIX 2
+#define DECIMAL_DIG 21
+
+#define FLT_MIN 1.17549435e-38F
+#define DBL_MIN 2.2250738585072014e-308
+#define LDBL_MIN 3.36210314311209350626e-4932L
+
+#define FLT_MAX 3.40282347e+38F
+#define DBL_MAX 1.7976931348623157e+308
+#define LDBL_MAX 1.18973149535723176502e+4932L
+
+#define FLT_DIG 6
+#define DBL_DIG 15
+#define LDBL_DIG 18
+
+#define FLT_EVAL_METHOD -1
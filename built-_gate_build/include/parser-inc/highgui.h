@@ -0,0 +1,5 @@
+#ifndef _HIGH_GUI_
+#define _HIGH_GUI_
+
+
+#endif
\ No newline at end of file
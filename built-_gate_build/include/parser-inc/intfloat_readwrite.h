@@ -0,0 +1,6 @@
+#ifndef INTFLOAT_READWRITE_H
+#define INTFLOAT_READWRITE_H
+
+#include "common.h"
+
+#endif /* INTFLOAT_READWRITE_H */
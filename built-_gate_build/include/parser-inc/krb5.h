@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file krb5.h
+ * @author drose
+ * @date 2003-07-10
+ */
+
+// This file, and all the other files in this directory, aren't
+// intended to be compiled--they're just parsed by CPPParser (and
+// interrogate) in lieu of the actual system headers, to generate the
+// interrogate database.
+
+#ifndef KRB5_H
+#define KRB5_H
+
+typedef int krb5_enctype;
+typedef int krb5_octet;
+typedef int krb5_error_code;
+
+#define FAR
+
+#endif
+
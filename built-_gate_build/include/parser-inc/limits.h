@@ -0,0 +1,39 @@
+#ifndef _LIMITS_H
+#define _LIMITS_H
+
+#define CHAR_BIT 8
+#define SCHAR_MIN (-128)
+#define SCHAR_MAX 127
+#define UCHAR_MAX 255
+#define CHAR_MIN SCHAR_MIN
+#define CHAR_MAX SCHAR_MAX
+
+#define SHRT_MIN (-32768)
+#define SHRT_MAX 32767
+#define USHRT_MAX 65535
+
+#define INT_MIN -2147483648
+#define INT_MAX 2147483647
+#define UINT_MAX 4294967295U
+
+#ifdef _LP64
+#define LONG_MIN -9223372036854775808L
+#define LONG_MAX 9223372036854775807L
+#define ULONG_MAX 18446744073709551615UL
+#else
+#define LONG_MIN -2147483648L
+#define LONG_MAX 2147483647L
+#define ULONG_MAX 4294967295UL
+#endif
+
+#define LLONG_MIN -9223372036854775808LL
+#define LLONG_MAX -9223372036854775807LL
+#define ULLONG_MAX 18446744073709551615ULL
+
+#ifdef _MSC_VER
+#define _I64_MIN -9223372036854775808LL
+#define _I64_MAX -9223372036854775807LL
+#define _UI64_MAX 18446744073709551615ULL
+#endif
+
+#endif
@@ -0,0 +1,17 @@
+#include <stdint.h>
+#include <sys/socket.h>
+
+typedef uint32_t in_addr_t;
+struct in_addr;
+typedef uint16_t in_port_t;
+struct in6_addr;
+struct sockaddr_in;
+struct sockaddr_in6;
+struct ip_mreq;
+struct ip_mreq_source;
+struct ipv6_mreq;
+struct group_req;
+struct group_source_req;
+struct ip_msfilter;
+struct group_filter;
+
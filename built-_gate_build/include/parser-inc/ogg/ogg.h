@@ -0,0 +1,14 @@
+#ifndef _OGG_H
+#define _OGG_H
+
+#include <stddef.h>
+#include <ogg/os_types.h>
+
+typedef struct {} ogg_iovec_t;
+typedef struct {} oggpack_buffer;
+typedef struct {} ogg_page;
+typedef struct {} ogg_stream_state;
+typedef struct {} ogg_packet;
+typedef struct {} ogg_sync_state;
+
+#endif
@@ -0,0 +1,7 @@
+
+#ifndef EVP_H
+#define EVP_H
+
+#include <openssl/ssl.h>
+
+#endif
@@ -0,0 +1,8 @@
+
+#ifndef X509_H
+#define X509_H
+
+#include <openssl/ssl.h>
+
+#endif
+
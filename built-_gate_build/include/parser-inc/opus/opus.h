@@ -0,0 +1,6 @@
+#ifndef OPUS_H
+#define OPUS_H
+
+#include "opus_types.h"
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef OPUS_TYPES_H
+#define OPUS_TYPES_H
+
+#include <stdint.h>
+
+typedef int16_t opus_int16;
+typedef uint16_t opus_uint16;
+typedef int32_t opus_int32;
+typedef uint32_t opus_uint32;
+
+#define opus_int int
+#define opus_int64 long long
+#define opus_int8 signed char
+
+#define opus_uint unsigned int
+#define opus_uint64 unsigned long long
+#define opus_uint8 unsigned char
+
+#endif
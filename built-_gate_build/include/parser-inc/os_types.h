@@ -0,0 +1,16 @@
+#ifndef _OS_TYPES_H
+#define _OS_TYPES_H
+
+#define _ogg_malloc malloc
+#define _ogg_calloc calloc
+#define _ogg_realloc realloc
+#define _ogg_free free
+
+typedef signed short ogg_int16_t;
+typedef unsigned short ogg_uint16_t;
+typedef signed int ogg_int32_t;
+typedef unsigned int ogg_uint32_t;
+typedef signed long long ogg_int64_t;
+typedef unsigned long long ogg_uint64_t;
+
+#endif
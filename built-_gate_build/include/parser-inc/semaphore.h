@@ -0,0 +1,6 @@
+
+typedef union {
+  char __size[];
+  long int __align;
+} sem_t;
+
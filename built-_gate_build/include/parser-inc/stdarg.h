@@ -0,0 +1,6 @@
+#ifndef STDARG_H
+#define STDARG_H
+
+typedef struct {} va_list[1];
+
+#endif
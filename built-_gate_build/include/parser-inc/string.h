@@ -0,0 +1 @@
+#include <stdtypedefs.h>
@@ -0,0 +1,3 @@
+#ifndef SWSCALE_SWSCALE_H
+#define SWSCALE_SWSCALE_H
+#endif
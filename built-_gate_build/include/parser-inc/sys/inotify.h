@@ -0,0 +1 @@
+struct inotify_event;
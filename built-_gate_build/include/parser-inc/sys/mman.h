@@ -0,0 +1,3 @@
+#include <sys/types.h>
+
+struct posix_typed_mem_info;
@@ -0,0 +1 @@
+#include <sys/time.h>
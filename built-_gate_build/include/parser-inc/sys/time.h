@@ -0,0 +1,5 @@
+#pragma once
+
+struct timeval;
+struct fd_set;
+struct timezone;
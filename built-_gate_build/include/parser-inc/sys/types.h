@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdtypedefs.h>
+
+typedef unsigned int id_t;
+typedef unsigned int gid_t;
+typedef unsigned int uid_t;
+typedef int pid_t;
+typedef long int off_t;
+typedef unsigned int mode_t;
+typedef unsigned long ino_t;
+typedef long int dev_t;
+
+typedef void *timer_t;
+typedef int clockid_t;
+typedef unsigned int useconds_t;
+typedef long int suseconds_t;
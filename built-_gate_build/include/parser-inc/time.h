@@ -0,0 +1,8 @@
+#pragma once
+
+#include <stdtypedefs.h>
+
+struct timespec {
+  time_t tv_sec;
+  long tv_nsec;
+};
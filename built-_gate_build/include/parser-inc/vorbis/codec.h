@@ -0,0 +1 @@
+#include <ogg/ogg.h>
@@ -0,0 +1 @@
+struct OggVorbis_File;
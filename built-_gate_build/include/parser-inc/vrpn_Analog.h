@@ -0,0 +1,4 @@
+#pragma once
+
+class vrpn_Analog_Remote;
+typedef void vrpn_ANALOGCB;
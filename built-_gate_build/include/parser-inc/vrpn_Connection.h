@@ -0,0 +1,3 @@
+#pragma once
+
+class vrpn_Connection;
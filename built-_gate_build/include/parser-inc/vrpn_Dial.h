@@ -0,0 +1,4 @@
+#pragma once
+
+class vrpn_Dial_Remote;
+typedef void vrpn_DIALCB;
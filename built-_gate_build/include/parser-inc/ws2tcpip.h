@@ -0,0 +1 @@
+typedef int socklen_t;
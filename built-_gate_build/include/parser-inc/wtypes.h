@@ -0,0 +1,28 @@
+#pragma once
+
+#ifndef _WINDEF_
+typedef void *PVOID;
+typedef void *LPVOID;
+typedef float FLOAT;
+typedef struct tagRECT RECT;
+typedef struct tagRECT *PRECT;
+typedef struct tagRECT *LPRECT;
+#endif
+
+typedef unsigned char UCHAR;
+typedef short SHORT;
+typedef unsigned short USHORT;
+typedef unsigned long ULONG;
+typedef double DOUBLE;
+
+typedef unsigned long long DWORDLONG;
+typedef DWORDLONG *PDWORDLONG;
+
+typedef long long LONGLONG;
+typedef unsigned long long ULONGLONG;
+typedef LONGLONG *PLONGLONG;
+typedef ULONGLONG *PULONGLONG;
+
+typedef struct _LARGE_INTEGER LARGE_INTEGER;
+typedef struct _LARGE_INTEGER *PLARGE_INTEGER;
+typedef struct _ULARGE_INTEGER ULARGE_INTEGER;
@@ -0,0 +1 @@
+struct __m128;
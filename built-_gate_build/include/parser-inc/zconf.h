@@ -0,0 +1,19 @@
+#ifndef ZCONF_H
+#define ZCONF_H
+
+typedef unsigned char Byte;
+typedef unsigned int uInt;
+typedef unsigned long uLong;
+
+typedef char charf;
+typedef int intf;
+typedef uInt uIntf;
+typedef uLong uLongf;
+
+typedef void const *voidpc;
+typedef void *voidpf;
+typedef void *voidp;
+
+typedef unsigned long z_crc_t;
+
+#endif
@@ -0,0 +1,253 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_EGGYY_BUILT_GATE_BUILD_TMP_PARSER_YXX_H_INCLUDED
+# define YY_EGGYY_BUILT_GATE_BUILD_TMP_PARSER_YXX_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int eggyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    EGG_NUMBER = 258,              /* EGG_NUMBER  */
+    EGG_ULONG = 259,               /* EGG_ULONG  */
+    EGG_STRING = 260,              /* EGG_STRING  */
+    ANIMPRELOAD = 261,             /* ANIMPRELOAD  */
+    BEZIERCURVE = 262,             /* BEZIERCURVE  */
+    BFACE = 263,                   /* BFACE  */
+    BILLBOARD = 264,               /* BILLBOARD  */
+    BILLBOARDCENTER = 265,         /* BILLBOARDCENTER  */
+    BINORMAL = 266,                /* BINORMAL  */
+    BUNDLE = 267,                  /* BUNDLE  */
+    CLOSED = 268,                  /* CLOSED  */
+    COLLIDE = 269,                 /* COLLIDE  */
+    COMMENT = 270,                 /* COMMENT  */
+    COMPONENT = 271,               /* COMPONENT  */
+    COORDSYSTEM = 272,             /* COORDSYSTEM  */
+    CV = 273,                      /* CV  */
+    DART = 274,                    /* DART  */
+    DNORMAL = 275,                 /* DNORMAL  */
+    DRGBA = 276,                   /* DRGBA  */
+    DUV = 277,                     /* DUV  */
+    DXYZ = 278,                    /* DXYZ  */
+    DCS = 279,                     /* DCS  */
+    DISTANCE = 280,                /* DISTANCE  */
+    DTREF = 281,                   /* DTREF  */
+    DYNAMICVERTEXPOOL = 282,       /* DYNAMICVERTEXPOOL  */
+    EXTERNAL_FILE = 283,           /* EXTERNAL_FILE  */
+    GROUP = 284,                   /* GROUP  */
+    DEFAULTPOSE = 285,             /* DEFAULTPOSE  */
+    JOINT = 286,                   /* JOINT  */
+    KNOTS = 287,                   /* KNOTS  */
+    INCLUDE = 288,                 /* INCLUDE  */
+    INSTANCE = 289,                /* INSTANCE  */
+    LINE = 290,                    /* LINE  */
+    LOOP = 291,                    /* LOOP  */
+    MATERIAL = 292,                /* MATERIAL  */
+    MATRIX3 = 293,                 /* MATRIX3  */
+    MATRIX4 = 294,                 /* MATRIX4  */
+    MODEL = 295,                   /* MODEL  */
+    MREF = 296,                    /* MREF  */
+    NORMAL = 297,                  /* NORMAL  */
+    NURBSCURVE = 298,              /* NURBSCURVE  */
+    NURBSSURFACE = 299,            /* NURBSSURFACE  */
+    OBJECTTYPE = 300,              /* OBJECTTYPE  */
+    ORDER = 301,                   /* ORDER  */
+    OUTTANGENT = 302,              /* OUTTANGENT  */
+    PATCH = 303,                   /* PATCH  */
+    POINTLIGHT = 304,              /* POINTLIGHT  */
+    POLYGON = 305,                 /* POLYGON  */
+    REF = 306,                     /* REF  */
+    RGBA = 307,                    /* RGBA  */
+    ROTATE = 308,                  /* ROTATE  */
+    ROTX = 309,                    /* ROTX  */
+    ROTY = 310,                    /* ROTY  */
+    ROTZ = 311,                    /* ROTZ  */
+    SANIM = 312,                   /* SANIM  */
+    SCALAR = 313,                  /* SCALAR  */
+    SCALE = 314,                   /* SCALE  */
+    SEQUENCE = 315,                /* SEQUENCE  */
+    SHADING = 316,                 /* SHADING  */
+    SWITCH = 317,                  /* SWITCH  */
+    SWITCHCONDITION = 318,         /* SWITCHCONDITION  */
+    TABLE = 319,                   /* TABLE  */
+    TABLE_V = 320,                 /* TABLE_V  */
+    TAG = 321,                     /* TAG  */
+    TANGENT = 322,                 /* TANGENT  */
+    TEXLIST = 323,                 /* TEXLIST  */
+    TEXTURE = 324,                 /* TEXTURE  */
+    TLENGTHS = 325,                /* TLENGTHS  */
+    TRANSFORM = 326,               /* TRANSFORM  */
+    TRANSLATE = 327,               /* TRANSLATE  */
+    TREF = 328,                    /* TREF  */
+    TRIANGLEFAN = 329,             /* TRIANGLEFAN  */
+    TRIANGLESTRIP = 330,           /* TRIANGLESTRIP  */
+    TRIM = 331,                    /* TRIM  */
+    TXT = 332,                     /* TXT  */
+    UKNOTS = 333,                  /* UKNOTS  */
+    UV = 334,                      /* UV  */
+    AUX = 335,                     /* AUX  */
+    VKNOTS = 336,                  /* VKNOTS  */
+    VERTEX = 337,                  /* VERTEX  */
+    VERTEXANIM = 338,              /* VERTEXANIM  */
+    VERTEXPOOL = 339,              /* VERTEXPOOL  */
+    VERTEXREF = 340,               /* VERTEXREF  */
+    XFMANIM = 341,                 /* XFMANIM  */
+    XFMSANIM = 342,                /* XFMSANIM  */
+    START_EGG = 343,               /* START_EGG  */
+    START_GROUP_BODY = 344,        /* START_GROUP_BODY  */
+    START_TEXTURE_BODY = 345,      /* START_TEXTURE_BODY  */
+    START_PRIMITIVE_BODY = 346     /* START_PRIMITIVE_BODY  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
+#define EGG_NUMBER 258
+#define EGG_ULONG 259
+#define EGG_STRING 260
+#define ANIMPRELOAD 261
+#define BEZIERCURVE 262
+#define BFACE 263
+#define BILLBOARD 264
+#define BILLBOARDCENTER 265
+#define BINORMAL 266
+#define BUNDLE 267
+#define CLOSED 268
+#define COLLIDE 269
+#define COMMENT 270
+#define COMPONENT 271
+#define COORDSYSTEM 272
+#define CV 273
+#define DART 274
+#define DNORMAL 275
+#define DRGBA 276
+#define DUV 277
+#define DXYZ 278
+#define DCS 279
+#define DISTANCE 280
+#define DTREF 281
+#define DYNAMICVERTEXPOOL 282
+#define EXTERNAL_FILE 283
+#define GROUP 284
+#define DEFAULTPOSE 285
+#define JOINT 286
+#define KNOTS 287
+#define INCLUDE 288
+#define INSTANCE 289
+#define LINE 290
+#define LOOP 291
+#define MATERIAL 292
+#define MATRIX3 293
+#define MATRIX4 294
+#define MODEL 295
+#define MREF 296
+#define NORMAL 297
+#define NURBSCURVE 298
+#define NURBSSURFACE 299
+#define OBJECTTYPE 300
+#define ORDER 301
+#define OUTTANGENT 302
+#define PATCH 303
+#define POINTLIGHT 304
+#define POLYGON 305
+#define REF 306
+#define RGBA 307
+#define ROTATE 308
+#define ROTX 309
+#define ROTY 310
+#define ROTZ 311
+#define SANIM 312
+#define SCALAR 313
+#define SCALE 314
+#define SEQUENCE 315
+#define SHADING 316
+#define SWITCH 317
+#define SWITCHCONDITION 318
+#define TABLE 319
+#define TABLE_V 320
+#define TAG 321
+#define TANGENT 322
+#define TEXLIST 323
+#define TEXTURE 324
+#define TLENGTHS 325
+#define TRANSFORM 326
+#define TRANSLATE 327
+#define TREF 328
+#define TRIANGLEFAN 329
+#define TRIANGLESTRIP 330
+#define TRIM 331
+#define TXT 332
+#define UKNOTS 333
+#define UV 334
+#define AUX 335
+#define VKNOTS 336
+#define VERTEX 337
+#define VERTEXANIM 338
+#define VERTEXPOOL 339
+#define VERTEXREF 340
+#define XFMANIM 341
+#define XFMSANIM 342
+#define START_EGG 343
+#define START_GROUP_BODY 344
+#define START_TEXTURE_BODY 345
+#define START_PRIMITIVE_BODY 346
+
+/* Value type.  */
+
+
+extern YYSTYPE eggyylval;
+
+
+int eggyyparse (void);
+
+
+#endif /* !YY_EGGYY_BUILT_GATE_BUILD_TMP_PARSER_YXX_H_INCLUDED  */
@@ -0,0 +1,79 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file partBundleCollection.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef PARTBUNDLECOLLECTION_H
+#define PARTBUNDLECOLLECTION_H
+
+#include "pandabase.h"
+
+#include "partBundle.h"
+#include "pointerTo.h"
+#include "pvector.h"
+
+/**
+ * A collection of PartBundles that can be updated all at once.  This is
+ * useful for crowds of animated characters: rather than updating each of the
+ * characters in turn, the bundles may be updated at the same time on several
+ * threads.
+ *
+ * Each bundle is only ever updated by one thread at a time, so this is safe
+ * as long as no two bundles in the collection share parts or AnimControls.
+ * Changes that the bundles make to the scene graph, such as the transforms of
+ * exposed joints, are applied on the calling thread after all of the bundles
+ * have been updated.
+ */
+class EXPCL_PANDA_CHAN PartBundleCollection {
+PUBLISHED:
+  PartBundleCollection();
+
+  void add_bundle(PartBundle *bundle);
+  bool remove_bundle(PartBundle *bundle);
+  bool has_bundle(PartBundle *bundle) const;
+  void clear();
+
+  INLINE int get_num_bundles() const;
+  INLINE PartBundle *get_bundle(int n) const;
+  MAKE_SEQ(get_bundles, get_num_bundles, get_bundle);
+
+  INLINE void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+  MAKE_PROPERTY(num_threads, get_num_threads, set_num_threads);
+
+  bool update();
+  bool force_update();
+
+  void output(std::ostream &out) const;
+
+private:
+  bool do_update(bool force);
+  static void update_bundles(size_t begin, size_t end, void *user_data);
+
+  typedef pvector<PT(PartBundle)> Bundles;
+  Bundles _bundles;
+
+  int _num_threads;
+
+  class ParallelUpdate {
+  public:
+    Bundles *_bundles;
+    bool _force;
+    int _pipeline_stage;
+    pvector<unsigned char> _changed;
+  };
+};
+
+INLINE std::ostream &operator << (std::ostream &out, const PartBundleCollection &collection);
+
+#include "partBundleCollection.I"
+
+#endif
@@ -0,0 +1,19 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file post_x11_include.h
+ * @author drose
+ * @date 2011-08-28
+ */
+
+// To be included after including X11*.h.
+
+#undef Display
+#undef Window
+#undef Cursor
+#undef Connection
@@ -0,0 +1,22 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file preprocess_argv.h
+ * @author drose
+ * @date 2011-11-08
+ */
+
+#ifndef PREPROCESS_ARGV_H
+#define PREPROCESS_ARGV_H
+
+#include "dtoolbase.h"
+
+extern EXPCL_DTOOL_DTOOLUTIL void
+preprocess_argv(int &argc, char **&argv);
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file receiveBufferPool.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef RECEIVEBUFFERPOOL_H
+#define RECEIVEBUFFERPOOL_H
+
+#include "pandabase.h"
+
+#include "pta_uchar.h"
+#include "lightMutex.h"
+#include "pvector.h"
+
+/**
+ * A pool of reference-counted buffers, used by the ConnectionReader to
+ * receive datagrams into without allocating new memory for each one.
+ *
+ * The pool keeps a reference to each buffer it hands out, and the buffer is
+ * stored directly in the received Datagram.  Once the application has
+ * released every Datagram that shares it, so that the pool holds the only
+ * remaining reference, the buffer is reused for a subsequent datagram.
+ * Datagram's copy-on-write semantics ensure that a pooled buffer is never
+ * modified while it is still shared.
+ */
+class EXPCL_PANDA_NET ReceiveBufferPool {
+public:
+  explicit ReceiveBufferPool(int max_buffers = -1);
+  ~ReceiveBufferPool();
+
+  PTA_uchar get_buffer(size_t size);
+
+  INLINE int get_max_buffers() const;
+  INLINE int get_num_buffers() const;
+
+private:
+  LightMutex _lock;
+  typedef pvector<PTA_uchar> Buffers;
+  Buffers _buffers;
+  size_t _next;
+  int _max_buffers;
+};
+
+#include "receiveBufferPool.I"
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef __SOCKET_BASE_H__
+#define __SOCKET_BASE_H__
+
+// Quick way to get all the network code defined
+#include "pandabase.h"
+#include "socket_portable.h"
+#include "socket_address.h"
+#include "socket_ip.h"
+#include "socket_tcp.h"
+#include "socket_tcp_listen.h"
+#include "socket_udp_incoming.h"
+#include "socket_udp_outgoing.h"
+#include "socket_fdset.h"
+#include "socket_selector.h"
+
+#endif //__SOCKET_BASE_H__
@@ -0,0 +1,29 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file typedef.h
+ * @author mike
+ * @date 1997-01-09
+ */
+
+#ifndef TYPEDEF_H
+#define TYPEDEF_H
+
+#include "pandabase.h"
+#include "numeric_types.h"
+
+typedef unsigned char uchar;
+typedef unsigned short ushort;
+typedef unsigned int uint;
+typedef unsigned long ulong;
+
+typedef int64_t longlong;
+typedef uint64_t ulonglong;
+
+
+#endif
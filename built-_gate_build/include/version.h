@@ -0,0 +1,22 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file version.h
+ */
+
+/* instead of this stuff probably want to use link.exe /VERSION flag instead, which might make auto-incrementing build number a little easier */
+
+#define PANDA_VERSION_MAJOR                0
+#define PANDA_VERSION_MINOR                0
+#define PANDA_VERSION_BUILDSUBVERSION      0
+#define PANDA_VERSION_BUILDSUBSUBVERSION   1
+
+#define PANDA_VERSION_MAJOR_STR                "0"
+#define PANDA_VERSION_MINOR_STR                "0"
+#define PANDA_VERSION_BUILDSUBVERSION_STR      "0"
+#define PANDA_VERSION_BUILDSUBSUBVERSION_STR   "1"
@@ -0,0 +1,9792 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         cppyyparse
+#define yylex           cppyylex
+#define yyerror         cppyyerror
+#define yydebug         cppyydebug
+#define yynerrs         cppyynerrs
+
+/* First part of user prologue.  */
+#line 7 "dtool/src/cppparser/cppBison.yxx"
+
+
+#include "cppBisonDefs.h"
+#include "cppParser.h"
+#include "cppClosureType.h"
+#include "cppExpression.h"
+#include "cppSimpleType.h"
+#include "cppExtensionType.h"
+#include "cppStructType.h"
+#include "cppEnumType.h"
+#include "cppFunctionType.h"
+#include "cppTBDType.h"
+#include "cppMakeProperty.h"
+#include "cppMakeSeq.h"
+#include "cppParameterList.h"
+#include "cppInstance.h"
+#include "cppClassTemplateParameter.h"
+#include "cppTemplateParameterList.h"
+#include "cppInstanceIdentifier.h"
+#include "cppTypedefType.h"
+#include "cppTypeDeclaration.h"
+#include "cppVisibility.h"
+#include "cppIdentifier.h"
+#include "cppScope.h"
+#include "cppTemplateScope.h"
+#include "cppNamespace.h"
+#include "cppUsing.h"
+
+using std::stringstream;
+using std::string;
+
+////////////////////////////////////////////////////////////////////
+// Defining the interface to the parser.
+////////////////////////////////////////////////////////////////////
+
+CPPScope *current_scope = nullptr;
+CPPScope *global_scope = nullptr;
+CPPPreprocessor *current_lexer = nullptr;
+
+static CPPStructType *current_struct = nullptr;
+static CPPEnumType *current_enum = nullptr;
+static int current_storage_class = 0;
+static CPPType *current_type = nullptr;
+static CPPExpression *current_expr = nullptr;
+static int publish_nest_level = 0;
+static CPPVisibility publish_previous;
+static YYLTYPE publish_loc;
+
+static std::vector<CPPScope *> last_scopes;
+static std::vector<int> last_storage_classes;
+static std::vector<CPPStructType *> last_structs;
+
+int yyparse();
+
+#define YYERROR_VERBOSE
+
+static void
+yyerror(const string &msg) {
+  current_lexer->error(msg, current_lexer->_last_token_loc);
+}
+
+static void
+yyerror(YYLTYPE *loc, const string &msg) {
+  current_lexer->error(msg, *loc);
+}
+
+static void
+yyerror(const string &msg, YYLTYPE &loc) {
+  current_lexer->error(msg, loc);
+}
+
+static void
+yywarning(const string &msg, YYLTYPE &loc) {
+  current_lexer->warning(msg, loc);
+}
+
+static int
+yylex(YYSTYPE *lval, YYLTYPE *lloc) {
+  CPPToken token = current_lexer->get_next_token();
+  *lval = token._lval;
+  *lloc = token._lloc;
+  return token._token;
+}
+
+void
+parse_cpp(CPPParser *cp) {
+  CPPScope *old_scope = current_scope;
+  CPPScope *old_global_scope = global_scope;
+  CPPPreprocessor *old_lexer = current_lexer;
+
+  current_scope = cp;
+  global_scope = cp;
+  current_lexer = cp;
+  publish_nest_level = 0;
+  yyparse();
+
+  if (publish_nest_level != 0) {
+    yyerror("Unclosed __begin_publish", publish_loc);
+    publish_nest_level = 0;
+  }
+
+  current_scope = old_scope;
+  global_scope = old_global_scope;
+  current_lexer = old_lexer;
+
+}
+
+CPPExpression *
+parse_const_expr(CPPPreprocessor *pp, CPPScope *new_current_scope,
+                 CPPScope *new_global_scope) {
+  CPPScope *old_scope = current_scope;
+  CPPScope *old_global_scope = global_scope;
+  CPPPreprocessor *old_lexer = current_lexer;
+  CPPExpression *old_expr = current_expr;
+
+  current_scope = new_current_scope;
+  global_scope = new_global_scope;
+  current_expr = nullptr;
+  current_lexer = pp;
+  yyparse();
+
+  CPPExpression *result = current_expr;
+
+  current_scope = old_scope;
+  global_scope = old_global_scope;
+  current_lexer = old_lexer;
+  current_expr = old_expr;
+
+  return result;
+}
+
+CPPType *
+parse_type(CPPPreprocessor *pp, CPPScope *new_current_scope,
+           CPPScope *new_global_scope) {
+  CPPScope *old_scope = current_scope;
+  CPPScope *old_global_scope = global_scope;
+  CPPPreprocessor *old_lexer = current_lexer;
+  CPPType *old_type = current_type;
+
+  current_scope = new_current_scope;
+  global_scope = new_global_scope;
+  current_type = nullptr;
+  current_lexer = pp;
+  yyparse();
+
+  CPPType *result = current_type;
+
+  current_scope = old_scope;
+  global_scope = old_global_scope;
+  current_lexer = old_lexer;
+  current_type = old_type;
+
+  return result;
+}
+
+static void
+push_scope(CPPScope *new_scope) {
+  last_scopes.push_back(current_scope);
+  if (new_scope != nullptr) {
+    current_scope = new_scope;
+  }
+}
+
+static void
+pop_scope() {
+  assert(!last_scopes.empty());
+  current_scope = last_scopes.back();
+  last_scopes.pop_back();
+}
+
+static void
+push_storage_class(int new_storage_class) {
+  last_storage_classes.push_back(current_storage_class);
+  current_storage_class = new_storage_class;
+}
+
+static void
+pop_storage_class() {
+  assert(!last_storage_classes.empty());
+  current_storage_class = last_storage_classes.back();
+  last_storage_classes.pop_back();
+}
+
+static void
+push_struct(CPPStructType *new_struct) {
+  last_structs.push_back(current_struct);
+  current_struct = new_struct;
+}
+
+static void
+pop_struct() {
+  assert(!last_structs.empty());
+  current_struct = last_structs.back();
+  last_structs.pop_back();
+}
+
+
+#line 274 "built-_gate_build/tmp/cppBison.yxx.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cppBison.yxx.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_REAL = 3,                       /* REAL  */
+  YYSYMBOL_INTEGER = 4,                    /* INTEGER  */
+  YYSYMBOL_CHAR_TOK = 5,                   /* CHAR_TOK  */
+  YYSYMBOL_SIMPLE_STRING = 6,              /* SIMPLE_STRING  */
+  YYSYMBOL_SIMPLE_IDENTIFIER = 7,          /* SIMPLE_IDENTIFIER  */
+  YYSYMBOL_STRING_LITERAL = 8,             /* STRING_LITERAL  */
+  YYSYMBOL_CUSTOM_LITERAL = 9,             /* CUSTOM_LITERAL  */
+  YYSYMBOL_IDENTIFIER = 10,                /* IDENTIFIER  */
+  YYSYMBOL_TYPENAME_IDENTIFIER = 11,       /* TYPENAME_IDENTIFIER  */
+  YYSYMBOL_TYPEPACK_IDENTIFIER = 12,       /* TYPEPACK_IDENTIFIER  */
+  YYSYMBOL_SCOPING = 13,                   /* SCOPING  */
+  YYSYMBOL_TYPEDEFNAME = 14,               /* TYPEDEFNAME  */
+  YYSYMBOL_ELLIPSIS = 15,                  /* ELLIPSIS  */
+  YYSYMBOL_OROR = 16,                      /* OROR  */
+  YYSYMBOL_ANDAND = 17,                    /* ANDAND  */
+  YYSYMBOL_EQCOMPARE = 18,                 /* EQCOMPARE  */
+  YYSYMBOL_NECOMPARE = 19,                 /* NECOMPARE  */
+  YYSYMBOL_LECOMPARE = 20,                 /* LECOMPARE  */
+  YYSYMBOL_GECOMPARE = 21,                 /* GECOMPARE  */
+  YYSYMBOL_LSHIFT = 22,                    /* LSHIFT  */
+  YYSYMBOL_RSHIFT = 23,                    /* RSHIFT  */
+  YYSYMBOL_POINTSAT_STAR = 24,             /* POINTSAT_STAR  */
+  YYSYMBOL_DOT_STAR = 25,                  /* DOT_STAR  */
+  YYSYMBOL_UNARY = 26,                     /* UNARY  */
+  YYSYMBOL_UNARY_NOT = 27,                 /* UNARY_NOT  */
+  YYSYMBOL_UNARY_NEGATE = 28,              /* UNARY_NEGATE  */
+  YYSYMBOL_UNARY_MINUS = 29,               /* UNARY_MINUS  */
+  YYSYMBOL_UNARY_PLUS = 30,                /* UNARY_PLUS  */
+  YYSYMBOL_UNARY_STAR = 31,                /* UNARY_STAR  */
+  YYSYMBOL_UNARY_REF = 32,                 /* UNARY_REF  */
+  YYSYMBOL_POINTSAT = 33,                  /* POINTSAT  */
+  YYSYMBOL_SCOPE = 34,                     /* SCOPE  */
+  YYSYMBOL_PLUSPLUS = 35,                  /* PLUSPLUS  */
+  YYSYMBOL_MINUSMINUS = 36,                /* MINUSMINUS  */
+  YYSYMBOL_TIMESEQUAL = 37,                /* TIMESEQUAL  */
+  YYSYMBOL_DIVIDEEQUAL = 38,               /* DIVIDEEQUAL  */
+  YYSYMBOL_MODEQUAL = 39,                  /* MODEQUAL  */
+  YYSYMBOL_PLUSEQUAL = 40,                 /* PLUSEQUAL  */
+  YYSYMBOL_MINUSEQUAL = 41,                /* MINUSEQUAL  */
+  YYSYMBOL_OREQUAL = 42,                   /* OREQUAL  */
+  YYSYMBOL_ANDEQUAL = 43,                  /* ANDEQUAL  */
+  YYSYMBOL_XOREQUAL = 44,                  /* XOREQUAL  */
+  YYSYMBOL_LSHIFTEQUAL = 45,               /* LSHIFTEQUAL  */
+  YYSYMBOL_RSHIFTEQUAL = 46,               /* RSHIFTEQUAL  */
+  YYSYMBOL_ATTR_LEFT = 47,                 /* ATTR_LEFT  */
+  YYSYMBOL_ATTR_RIGHT = 48,                /* ATTR_RIGHT  */
+  YYSYMBOL_KW_ALIGNAS = 49,                /* KW_ALIGNAS  */
+  YYSYMBOL_KW_ALIGNOF = 50,                /* KW_ALIGNOF  */
+  YYSYMBOL_KW_AUTO = 51,                   /* KW_AUTO  */
+  YYSYMBOL_KW_BEGIN_PUBLISH = 52,          /* KW_BEGIN_PUBLISH  */
+  YYSYMBOL_KW_BLOCKING = 53,               /* KW_BLOCKING  */
+  YYSYMBOL_KW_BOOL = 54,                   /* KW_BOOL  */
+  YYSYMBOL_KW_CATCH = 55,                  /* KW_CATCH  */
+  YYSYMBOL_KW_CHAR = 56,                   /* KW_CHAR  */
+  YYSYMBOL_KW_CHAR16_T = 57,               /* KW_CHAR16_T  */
+  YYSYMBOL_KW_CHAR32_T = 58,               /* KW_CHAR32_T  */
+  YYSYMBOL_KW_CLASS = 59,                  /* KW_CLASS  */
+  YYSYMBOL_KW_CONST = 60,                  /* KW_CONST  */
+  YYSYMBOL_KW_CONSTEXPR = 61,              /* KW_CONSTEXPR  */
+  YYSYMBOL_KW_CONST_CAST = 62,             /* KW_CONST_CAST  */
+  YYSYMBOL_KW_DECLTYPE = 63,               /* KW_DECLTYPE  */
+  YYSYMBOL_KW_DEFAULT = 64,                /* KW_DEFAULT  */
+  YYSYMBOL_KW_DELETE = 65,                 /* KW_DELETE  */
+  YYSYMBOL_KW_DOUBLE = 66,                 /* KW_DOUBLE  */
+  YYSYMBOL_KW_DYNAMIC_CAST = 67,           /* KW_DYNAMIC_CAST  */
+  YYSYMBOL_KW_ELSE = 68,                   /* KW_ELSE  */
+  YYSYMBOL_KW_END_PUBLISH = 69,            /* KW_END_PUBLISH  */
+  YYSYMBOL_KW_ENUM = 70,                   /* KW_ENUM  */
+  YYSYMBOL_KW_EXTENSION = 71,              /* KW_EXTENSION  */
+  YYSYMBOL_KW_EXTERN = 72,                 /* KW_EXTERN  */
+  YYSYMBOL_KW_EXPLICIT = 73,               /* KW_EXPLICIT  */
+  YYSYMBOL_KW_PUBLISHED = 74,              /* KW_PUBLISHED  */
+  YYSYMBOL_KW_FALSE = 75,                  /* KW_FALSE  */
+  YYSYMBOL_KW_FINAL = 76,                  /* KW_FINAL  */
+  YYSYMBOL_KW_FLOAT = 77,                  /* KW_FLOAT  */
+  YYSYMBOL_KW_FRIEND = 78,                 /* KW_FRIEND  */
+  YYSYMBOL_KW_FOR = 79,                    /* KW_FOR  */
+  YYSYMBOL_KW_GOTO = 80,                   /* KW_GOTO  */
+  YYSYMBOL_KW_HAS_VIRTUAL_DESTRUCTOR = 81, /* KW_HAS_VIRTUAL_DESTRUCTOR  */
+  YYSYMBOL_KW_IF = 82,                     /* KW_IF  */
+  YYSYMBOL_KW_INLINE = 83,                 /* KW_INLINE  */
+  YYSYMBOL_KW_INT = 84,                    /* KW_INT  */
+  YYSYMBOL_KW_IS_ABSTRACT = 85,            /* KW_IS_ABSTRACT  */
+  YYSYMBOL_KW_IS_BASE_OF = 86,             /* KW_IS_BASE_OF  */
+  YYSYMBOL_KW_IS_CLASS = 87,               /* KW_IS_CLASS  */
+  YYSYMBOL_KW_IS_CONSTRUCTIBLE = 88,       /* KW_IS_CONSTRUCTIBLE  */
+  YYSYMBOL_KW_IS_CONVERTIBLE_TO = 89,      /* KW_IS_CONVERTIBLE_TO  */
+  YYSYMBOL_KW_IS_DESTRUCTIBLE = 90,        /* KW_IS_DESTRUCTIBLE  */
+  YYSYMBOL_KW_IS_EMPTY = 91,               /* KW_IS_EMPTY  */
+  YYSYMBOL_KW_IS_ENUM = 92,                /* KW_IS_ENUM  */
+  YYSYMBOL_KW_IS_FINAL = 93,               /* KW_IS_FINAL  */
+  YYSYMBOL_KW_IS_FUNDAMENTAL = 94,         /* KW_IS_FUNDAMENTAL  */
+  YYSYMBOL_KW_IS_POD = 95,                 /* KW_IS_POD  */
+  YYSYMBOL_KW_IS_POLYMORPHIC = 96,         /* KW_IS_POLYMORPHIC  */
+  YYSYMBOL_KW_IS_STANDARD_LAYOUT = 97,     /* KW_IS_STANDARD_LAYOUT  */
+  YYSYMBOL_KW_IS_TRIVIAL = 98,             /* KW_IS_TRIVIAL  */
+  YYSYMBOL_KW_IS_UNION = 99,               /* KW_IS_UNION  */
+  YYSYMBOL_KW_LONG = 100,                  /* KW_LONG  */
+  YYSYMBOL_KW_MAKE_MAP_KEYS_SEQ = 101,     /* KW_MAKE_MAP_KEYS_SEQ  */
+  YYSYMBOL_KW_MAKE_MAP_PROPERTY = 102,     /* KW_MAKE_MAP_PROPERTY  */
+  YYSYMBOL_KW_MAKE_PROPERTY = 103,         /* KW_MAKE_PROPERTY  */
+  YYSYMBOL_KW_MAKE_PROPERTY2 = 104,        /* KW_MAKE_PROPERTY2  */
+  YYSYMBOL_KW_MAKE_SEQ = 105,              /* KW_MAKE_SEQ  */
+  YYSYMBOL_KW_MAKE_SEQ_PROPERTY = 106,     /* KW_MAKE_SEQ_PROPERTY  */
+  YYSYMBOL_KW_MUTABLE = 107,               /* KW_MUTABLE  */
+  YYSYMBOL_KW_NAMESPACE = 108,             /* KW_NAMESPACE  */
+  YYSYMBOL_KW_NEW = 109,                   /* KW_NEW  */
+  YYSYMBOL_KW_NOEXCEPT = 110,              /* KW_NOEXCEPT  */
+  YYSYMBOL_KW_NULLPTR = 111,               /* KW_NULLPTR  */
+  YYSYMBOL_KW_OPERATOR = 112,              /* KW_OPERATOR  */
+  YYSYMBOL_KW_OVERRIDE = 113,              /* KW_OVERRIDE  */
+  YYSYMBOL_KW_PRIVATE = 114,               /* KW_PRIVATE  */
+  YYSYMBOL_KW_PROTECTED = 115,             /* KW_PROTECTED  */
+  YYSYMBOL_KW_PUBLIC = 116,                /* KW_PUBLIC  */
+  YYSYMBOL_KW_REGISTER = 117,              /* KW_REGISTER  */
+  YYSYMBOL_KW_REINTERPRET_CAST = 118,      /* KW_REINTERPRET_CAST  */
+  YYSYMBOL_KW_RETURN = 119,                /* KW_RETURN  */
+  YYSYMBOL_KW_SHORT = 120,                 /* KW_SHORT  */
+  YYSYMBOL_KW_SIGNED = 121,                /* KW_SIGNED  */
+  YYSYMBOL_KW_SIZEOF = 122,                /* KW_SIZEOF  */
+  YYSYMBOL_KW_STATIC = 123,                /* KW_STATIC  */
+  YYSYMBOL_KW_STATIC_ASSERT = 124,         /* KW_STATIC_ASSERT  */
+  YYSYMBOL_KW_STATIC_CAST = 125,           /* KW_STATIC_CAST  */
+  YYSYMBOL_KW_STRUCT = 126,                /* KW_STRUCT  */
+  YYSYMBOL_KW_TEMPLATE = 127,              /* KW_TEMPLATE  */
+  YYSYMBOL_KW_THREAD_LOCAL = 128,          /* KW_THREAD_LOCAL  */
+  YYSYMBOL_KW_THROW = 129,                 /* KW_THROW  */
+  YYSYMBOL_KW_TRUE = 130,                  /* KW_TRUE  */
+  YYSYMBOL_KW_TRY = 131,                   /* KW_TRY  */
+  YYSYMBOL_KW_TYPEDEF = 132,               /* KW_TYPEDEF  */
+  YYSYMBOL_KW_TYPEID = 133,                /* KW_TYPEID  */
+  YYSYMBOL_KW_TYPENAME = 134,              /* KW_TYPENAME  */
+  YYSYMBOL_KW_UNDERLYING_TYPE = 135,       /* KW_UNDERLYING_TYPE  */
+  YYSYMBOL_KW_UNION = 136,                 /* KW_UNION  */
+  YYSYMBOL_KW_UNSIGNED = 137,              /* KW_UNSIGNED  */
+  YYSYMBOL_KW_USING = 138,                 /* KW_USING  */
+  YYSYMBOL_KW_VIRTUAL = 139,               /* KW_VIRTUAL  */
+  YYSYMBOL_KW_VOID = 140,                  /* KW_VOID  */
+  YYSYMBOL_KW_VOLATILE = 141,              /* KW_VOLATILE  */
+  YYSYMBOL_KW_WCHAR_T = 142,               /* KW_WCHAR_T  */
+  YYSYMBOL_KW_WHILE = 143,                 /* KW_WHILE  */
+  YYSYMBOL_START_CPP = 144,                /* START_CPP  */
+  YYSYMBOL_START_CONST_EXPR = 145,         /* START_CONST_EXPR  */
+  YYSYMBOL_START_TYPE = 146,               /* START_TYPE  */
+  YYSYMBOL_147_ = 147,                     /* '{'  */
+  YYSYMBOL_148_ = 148,                     /* ','  */
+  YYSYMBOL_149_ = 149,                     /* ';'  */
+  YYSYMBOL_150_ = 150,                     /* ':'  */
+  YYSYMBOL_151_ = 151,                     /* '='  */
+  YYSYMBOL_152_ = 152,                     /* '?'  */
+  YYSYMBOL_153_ = 153,                     /* '|'  */
+  YYSYMBOL_154_ = 154,                     /* '^'  */
+  YYSYMBOL_155_ = 155,                     /* '&'  */
+  YYSYMBOL_156_ = 156,                     /* '<'  */
+  YYSYMBOL_157_ = 157,                     /* '>'  */
+  YYSYMBOL_158_ = 158,                     /* '+'  */
+  YYSYMBOL_159_ = 159,                     /* '-'  */
+  YYSYMBOL_160_ = 160,                     /* '*'  */
+  YYSYMBOL_161_ = 161,                     /* '/'  */
+  YYSYMBOL_162_ = 162,                     /* '%'  */
+  YYSYMBOL_163_ = 163,                     /* '~'  */
+  YYSYMBOL_164_ = 164,                     /* '.'  */
+  YYSYMBOL_165_ = 165,                     /* '('  */
+  YYSYMBOL_166_ = 166,                     /* '['  */
+  YYSYMBOL_167_ = 167,                     /* ')'  */
+  YYSYMBOL_168_ = 168,                     /* '}'  */
+  YYSYMBOL_169_ = 169,                     /* '!'  */
+  YYSYMBOL_170_ = 170,                     /* ']'  */
+  YYSYMBOL_YYACCEPT = 171,                 /* $accept  */
+  YYSYMBOL_grammar = 172,                  /* grammar  */
+  YYSYMBOL_cpp = 173,                      /* cpp  */
+  YYSYMBOL_constructor_inits = 174,        /* constructor_inits  */
+  YYSYMBOL_constructor_init = 175,         /* constructor_init  */
+  YYSYMBOL_extern_c = 176,                 /* extern_c  */
+  YYSYMBOL_177_1 = 177,                    /* $@1  */
+  YYSYMBOL_declaration = 178,              /* declaration  */
+  YYSYMBOL_friend_declaration = 179,       /* friend_declaration  */
+  YYSYMBOL_180_2 = 180,                    /* $@2  */
+  YYSYMBOL_storage_class = 181,            /* storage_class  */
+  YYSYMBOL_attribute_specifiers = 182,     /* attribute_specifiers  */
+  YYSYMBOL_attribute_specifier = 183,      /* attribute_specifier  */
+  YYSYMBOL_type_like_declaration = 184,    /* type_like_declaration  */
+  YYSYMBOL_185_3 = 185,                    /* $@3  */
+  YYSYMBOL_186_4 = 186,                    /* $@4  */
+  YYSYMBOL_multiple_instance_identifiers = 187, /* multiple_instance_identifiers  */
+  YYSYMBOL_typedef_declaration = 188,      /* typedef_declaration  */
+  YYSYMBOL_189_5 = 189,                    /* $@5  */
+  YYSYMBOL_typedef_instance_identifiers = 190, /* typedef_instance_identifiers  */
+  YYSYMBOL_constructor_prototype = 191,    /* constructor_prototype  */
+  YYSYMBOL_192_6 = 192,                    /* $@6  */
+  YYSYMBOL_193_7 = 193,                    /* $@7  */
+  YYSYMBOL_function_prototype = 194,       /* function_prototype  */
+  YYSYMBOL_195_8 = 195,                    /* $@8  */
+  YYSYMBOL_196_9 = 196,                    /* $@9  */
+  YYSYMBOL_197_10 = 197,                   /* $@10  */
+  YYSYMBOL_198_11 = 198,                   /* $@11  */
+  YYSYMBOL_199_12 = 199,                   /* $@12  */
+  YYSYMBOL_function_post = 200,            /* function_post  */
+  YYSYMBOL_function_operator = 201,        /* function_operator  */
+  YYSYMBOL_more_template_declaration = 202, /* more_template_declaration  */
+  YYSYMBOL_template_declaration = 203,     /* template_declaration  */
+  YYSYMBOL_204_13 = 204,                   /* $@13  */
+  YYSYMBOL_template_formal_parameters = 205, /* template_formal_parameters  */
+  YYSYMBOL_template_nonempty_formal_parameters = 206, /* template_nonempty_formal_parameters  */
+  YYSYMBOL_typename_keyword = 207,         /* typename_keyword  */
+  YYSYMBOL_template_formal_parameter = 208, /* template_formal_parameter  */
+  YYSYMBOL_template_formal_parameter_type = 209, /* template_formal_parameter_type  */
+  YYSYMBOL_instance_identifier = 210,      /* instance_identifier  */
+  YYSYMBOL_211_14 = 211,                   /* $@14  */
+  YYSYMBOL_instance_identifier_and_maybe_trailing_return_type = 212, /* instance_identifier_and_maybe_trailing_return_type  */
+  YYSYMBOL_maybe_trailing_return_type = 213, /* maybe_trailing_return_type  */
+  YYSYMBOL_maybe_comma_identifier = 214,   /* maybe_comma_identifier  */
+  YYSYMBOL_function_parameter_list = 215,  /* function_parameter_list  */
+  YYSYMBOL_function_parameters = 216,      /* function_parameters  */
+  YYSYMBOL_formal_parameter_list = 217,    /* formal_parameter_list  */
+  YYSYMBOL_formal_parameters = 218,        /* formal_parameters  */
+  YYSYMBOL_template_parameter_maybe_initialize = 219, /* template_parameter_maybe_initialize  */
+  YYSYMBOL_maybe_initialize = 220,         /* maybe_initialize  */
+  YYSYMBOL_maybe_initialize_or_constructor_body = 221, /* maybe_initialize_or_constructor_body  */
+  YYSYMBOL_maybe_initialize_or_function_body = 222, /* maybe_initialize_or_function_body  */
+  YYSYMBOL_structure_init = 223,           /* structure_init  */
+  YYSYMBOL_structure_init_body = 224,      /* structure_init_body  */
+  YYSYMBOL_function_parameter = 225,       /* function_parameter  */
+  YYSYMBOL_formal_parameter = 226,         /* formal_parameter  */
+  YYSYMBOL_not_paren_formal_parameter_identifier = 227, /* not_paren_formal_parameter_identifier  */
+  YYSYMBOL_formal_parameter_identifier = 228, /* formal_parameter_identifier  */
+  YYSYMBOL_parameter_pack_identifier = 229, /* parameter_pack_identifier  */
+  YYSYMBOL_not_paren_empty_instance_identifier = 230, /* not_paren_empty_instance_identifier  */
+  YYSYMBOL_empty_instance_identifier = 231, /* empty_instance_identifier  */
+  YYSYMBOL_type = 232,                     /* type  */
+  YYSYMBOL_type_pack = 233,                /* type_pack  */
+  YYSYMBOL_type_decl = 234,                /* type_decl  */
+  YYSYMBOL_predefined_type = 235,          /* predefined_type  */
+  YYSYMBOL_var_type_decl = 236,            /* var_type_decl  */
+  YYSYMBOL_full_type = 237,                /* full_type  */
+  YYSYMBOL_struct_attributes = 238,        /* struct_attributes  */
+  YYSYMBOL_anonymous_struct = 239,         /* anonymous_struct  */
+  YYSYMBOL_240_15 = 240,                   /* $@15  */
+  YYSYMBOL_named_struct = 241,             /* named_struct  */
+  YYSYMBOL_242_16 = 242,                   /* $@16  */
+  YYSYMBOL_maybe_final = 243,              /* maybe_final  */
+  YYSYMBOL_maybe_class_derivation = 244,   /* maybe_class_derivation  */
+  YYSYMBOL_class_derivation = 245,         /* class_derivation  */
+  YYSYMBOL_base_specification = 246,       /* base_specification  */
+  YYSYMBOL_enum = 247,                     /* enum  */
+  YYSYMBOL_enum_decl = 248,                /* enum_decl  */
+  YYSYMBOL_enum_element_type = 249,        /* enum_element_type  */
+  YYSYMBOL_enum_body_trailing_comma = 250, /* enum_body_trailing_comma  */
+  YYSYMBOL_enum_body = 251,                /* enum_body  */
+  YYSYMBOL_enum_keyword = 252,             /* enum_keyword  */
+  YYSYMBOL_struct_keyword = 253,           /* struct_keyword  */
+  YYSYMBOL_namespace_declaration = 254,    /* namespace_declaration  */
+  YYSYMBOL_255_17 = 255,                   /* $@17  */
+  YYSYMBOL_256_18 = 256,                   /* $@18  */
+  YYSYMBOL_using_declaration = 257,        /* using_declaration  */
+  YYSYMBOL_simple_type = 258,              /* simple_type  */
+  YYSYMBOL_simple_int_type = 259,          /* simple_int_type  */
+  YYSYMBOL_simple_float_type = 260,        /* simple_float_type  */
+  YYSYMBOL_simple_void_type = 261,         /* simple_void_type  */
+  YYSYMBOL_code = 262,                     /* code  */
+  YYSYMBOL_263_19 = 263,                   /* $@19  */
+  YYSYMBOL_code_block = 264,               /* code_block  */
+  YYSYMBOL_element = 265,                  /* element  */
+  YYSYMBOL_optional_const_expr = 266,      /* optional_const_expr  */
+  YYSYMBOL_optional_const_expr_comma = 267, /* optional_const_expr_comma  */
+  YYSYMBOL_const_expr_comma = 268,         /* const_expr_comma  */
+  YYSYMBOL_no_angle_bracket_const_expr = 269, /* no_angle_bracket_const_expr  */
+  YYSYMBOL_const_expr = 270,               /* const_expr  */
+  YYSYMBOL_const_operand = 271,            /* const_operand  */
+  YYSYMBOL_formal_const_expr = 272,        /* formal_const_expr  */
+  YYSYMBOL_formal_const_operand = 273,     /* formal_const_operand  */
+  YYSYMBOL_capture_list = 274,             /* capture_list  */
+  YYSYMBOL_capture = 275,                  /* capture  */
+  YYSYMBOL_class_derivation_name = 276,    /* class_derivation_name  */
+  YYSYMBOL_name = 277,                     /* name  */
+  YYSYMBOL_name_no_final = 278,            /* name_no_final  */
+  YYSYMBOL_string_literal = 279,           /* string_literal  */
+  YYSYMBOL_empty = 280                     /* empty  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  104
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   7127
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  171
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  110
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  763
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1570
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   401
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   169,     2,     2,     2,   162,   155,     2,
+     165,   167,   160,   158,   148,   159,   164,   161,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   150,   149,
+     156,   151,   157,   152,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   166,     2,   170,   154,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   147,   153,   168,   163,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   452,   452,   453,   457,   464,   465,   466,   470,   471,
+     475,   479,   483,   496,   495,   507,   508,   509,   510,   511,
+     512,   513,   526,   535,   539,   547,   551,   555,   576,   603,
+     624,   653,   689,   732,   744,   765,   801,   835,   857,   893,
+     915,   926,   940,   939,   954,   958,   963,   967,   978,   982,
+     986,   990,   994,   998,  1002,  1006,  1010,  1014,  1018,  1022,
+    1027,  1031,  1038,  1039,  1043,  1044,  1045,  1050,  1049,  1065,
+    1075,  1074,  1091,  1099,  1107,  1118,  1134,  1133,  1148,  1163,
+    1172,  1187,  1186,  1224,  1223,  1260,  1259,  1290,  1289,  1308,
+    1307,  1328,  1327,  1359,  1358,  1384,  1397,  1401,  1405,  1409,
+    1422,  1426,  1430,  1434,  1438,  1443,  1448,  1452,  1456,  1460,
+    1467,  1471,  1475,  1479,  1483,  1487,  1491,  1495,  1499,  1503,
+    1507,  1511,  1515,  1519,  1523,  1527,  1531,  1535,  1539,  1543,
+    1547,  1551,  1555,  1559,  1563,  1567,  1571,  1575,  1579,  1583,
+    1587,  1591,  1595,  1599,  1603,  1607,  1611,  1615,  1619,  1626,
+    1627,  1628,  1632,  1634,  1633,  1641,  1642,  1646,  1647,  1651,
+    1657,  1666,  1667,  1671,  1675,  1679,  1683,  1689,  1695,  1701,
+    1708,  1713,  1722,  1726,  1731,  1739,  1751,  1755,  1769,  1784,
+    1789,  1794,  1799,  1804,  1809,  1814,  1819,  1825,  1824,  1855,
+    1865,  1875,  1879,  1883,  1892,  1896,  1904,  1908,  1913,  1917,
+    1922,  1930,  1935,  1943,  1947,  1952,  1956,  1961,  1969,  1974,
+    1982,  1986,  1993,  1997,  2004,  2008,  2012,  2016,  2020,  2027,
+    2031,  2035,  2039,  2043,  2047,  2054,  2055,  2056,  2060,  2063,
+    2064,  2065,  2069,  2074,  2080,  2086,  2091,  2097,  2103,  2107,
+    2118,  2122,  2132,  2136,  2140,  2145,  2150,  2155,  2160,  2165,
+    2170,  2178,  2182,  2186,  2191,  2196,  2201,  2206,  2211,  2216,
+    2221,  2227,  2235,  2240,  2245,  2250,  2255,  2260,  2265,  2270,
+    2275,  2280,  2286,  2294,  2298,  2303,  2308,  2313,  2318,  2323,
+    2328,  2333,  2338,  2346,  2350,  2355,  2360,  2365,  2370,  2375,
+    2380,  2385,  2390,  2395,  2401,  2408,  2415,  2425,  2429,  2437,
+    2441,  2445,  2449,  2453,  2469,  2485,  2494,  2498,  2508,  2515,
+    2526,  2530,  2538,  2542,  2546,  2550,  2554,  2570,  2586,  2604,
+    2613,  2617,  2627,  2634,  2638,  2646,  2650,  2666,  2682,  2691,
+    2701,  2708,  2712,  2720,  2724,  2729,  2733,  2741,  2742,  2743,
+    2744,  2749,  2748,  2773,  2772,  2802,  2803,  2810,  2811,  2815,
+    2816,  2820,  2824,  2828,  2832,  2836,  2840,  2844,  2848,  2852,
+    2856,  2863,  2871,  2875,  2879,  2884,  2892,  2896,  2903,  2904,
+    2909,  2916,  2917,  2922,  2930,  2934,  2938,  2945,  2949,  2953,
+    2961,  2960,  2983,  2982,  3005,  3006,  3010,  3016,  3023,  3032,
+    3033,  3034,  3038,  3042,  3046,  3050,  3054,  3058,  3063,  3068,
+    3073,  3078,  3082,  3087,  3096,  3101,  3109,  3113,  3117,  3125,
+    3135,  3135,  3145,  3146,  3150,  3151,  3152,  3153,  3154,  3155,
+    3156,  3157,  3158,  3159,  3160,  3161,  3161,  3161,  3162,  3162,
+    3162,  3162,  3163,  3163,  3163,  3163,  3163,  3164,  3164,  3164,
+    3165,  3165,  3165,  3165,  3165,  3166,  3166,  3166,  3166,  3166,
+    3167,  3167,  3168,  3168,  3168,  3168,  3168,  3169,  3169,  3169,
+    3169,  3169,  3170,  3170,  3170,  3170,  3171,  3171,  3171,  3171,
+    3171,  3172,  3172,  3172,  3172,  3172,  3173,  3173,  3173,  3173,
+    3173,  3173,  3174,  3174,  3174,  3174,  3174,  3175,  3175,  3175,
+    3175,  3176,  3176,  3176,  3176,  3177,  3177,  3177,  3177,  3177,
+    3178,  3178,  3178,  3178,  3179,  3179,  3179,  3179,  3179,  3180,
+    3180,  3180,  3180,  3181,  3181,  3181,  3181,  3181,  3182,  3182,
+    3185,  3185,  3185,  3185,  3185,  3185,  3185,  3185,  3185,  3185,
+    3185,  3186,  3186,  3186,  3186,  3186,  3186,  3186,  3186,  3186,
+    3186,  3187,  3187,  3191,  3195,  3202,  3206,  3213,  3217,  3224,
+    3228,  3232,  3236,  3240,  3244,  3248,  3252,  3264,  3268,  3272,
+    3276,  3280,  3284,  3288,  3292,  3296,  3300,  3304,  3308,  3312,
+    3316,  3320,  3324,  3328,  3332,  3336,  3340,  3344,  3348,  3352,
+    3356,  3360,  3364,  3368,  3372,  3376,  3380,  3384,  3392,  3396,
+    3400,  3404,  3408,  3412,  3416,  3426,  3436,  3442,  3448,  3454,
+    3460,  3466,  3472,  3479,  3486,  3493,  3500,  3506,  3512,  3516,
+    3528,  3532,  3536,  3540,  3544,  3555,  3566,  3570,  3574,  3578,
+    3582,  3586,  3590,  3594,  3598,  3602,  3606,  3610,  3614,  3618,
+    3622,  3626,  3630,  3634,  3638,  3642,  3646,  3650,  3654,  3658,
+    3662,  3666,  3670,  3674,  3678,  3682,  3686,  3693,  3697,  3701,
+    3705,  3709,  3713,  3717,  3721,  3725,  3731,  3737,  3741,  3747,
+    3754,  3758,  3762,  3766,  3770,  3774,  3778,  3782,  3786,  3790,
+    3794,  3798,  3802,  3806,  3810,  3814,  3818,  3832,  3836,  3840,
+    3844,  3848,  3852,  3856,  3860,  3872,  3876,  3880,  3884,  3888,
+    3899,  3910,  3914,  3918,  3922,  3926,  3930,  3934,  3938,  3942,
+    3946,  3950,  3954,  3958,  3962,  3966,  3970,  3974,  3978,  3982,
+    3986,  3990,  3994,  3998,  4002,  4006,  4010,  4014,  4018,  4022,
+    4026,  4033,  4037,  4041,  4045,  4049,  4053,  4057,  4061,  4065,
+    4071,  4077,  4085,  4089,  4093,  4097,  4104,  4114,  4120,  4126,
+    4136,  4148,  4156,  4160,  4190,  4194,  4198,  4202,  4206,  4210,
+    4216,  4220,  4224,  4228,  4232,  4243,  4247,  4251,  4255,  4263,
+    4267,  4271,  4277,  4288
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "REAL", "INTEGER",
+  "CHAR_TOK", "SIMPLE_STRING", "SIMPLE_IDENTIFIER", "STRING_LITERAL",
+  "CUSTOM_LITERAL", "IDENTIFIER", "TYPENAME_IDENTIFIER",
+  "TYPEPACK_IDENTIFIER", "SCOPING", "TYPEDEFNAME", "ELLIPSIS", "OROR",
+  "ANDAND", "EQCOMPARE", "NECOMPARE", "LECOMPARE", "GECOMPARE", "LSHIFT",
+  "RSHIFT", "POINTSAT_STAR", "DOT_STAR", "UNARY", "UNARY_NOT",
+  "UNARY_NEGATE", "UNARY_MINUS", "UNARY_PLUS", "UNARY_STAR", "UNARY_REF",
+  "POINTSAT", "SCOPE", "PLUSPLUS", "MINUSMINUS", "TIMESEQUAL",
+  "DIVIDEEQUAL", "MODEQUAL", "PLUSEQUAL", "MINUSEQUAL", "OREQUAL",
+  "ANDEQUAL", "XOREQUAL", "LSHIFTEQUAL", "RSHIFTEQUAL", "ATTR_LEFT",
+  "ATTR_RIGHT", "KW_ALIGNAS", "KW_ALIGNOF", "KW_AUTO", "KW_BEGIN_PUBLISH",
+  "KW_BLOCKING", "KW_BOOL", "KW_CATCH", "KW_CHAR", "KW_CHAR16_T",
+  "KW_CHAR32_T", "KW_CLASS", "KW_CONST", "KW_CONSTEXPR", "KW_CONST_CAST",
+  "KW_DECLTYPE", "KW_DEFAULT", "KW_DELETE", "KW_DOUBLE", "KW_DYNAMIC_CAST",
+  "KW_ELSE", "KW_END_PUBLISH", "KW_ENUM", "KW_EXTENSION", "KW_EXTERN",
+  "KW_EXPLICIT", "KW_PUBLISHED", "KW_FALSE", "KW_FINAL", "KW_FLOAT",
+  "KW_FRIEND", "KW_FOR", "KW_GOTO", "KW_HAS_VIRTUAL_DESTRUCTOR", "KW_IF",
+  "KW_INLINE", "KW_INT", "KW_IS_ABSTRACT", "KW_IS_BASE_OF", "KW_IS_CLASS",
+  "KW_IS_CONSTRUCTIBLE", "KW_IS_CONVERTIBLE_TO", "KW_IS_DESTRUCTIBLE",
+  "KW_IS_EMPTY", "KW_IS_ENUM", "KW_IS_FINAL", "KW_IS_FUNDAMENTAL",
+  "KW_IS_POD", "KW_IS_POLYMORPHIC", "KW_IS_STANDARD_LAYOUT",
+  "KW_IS_TRIVIAL", "KW_IS_UNION", "KW_LONG", "KW_MAKE_MAP_KEYS_SEQ",
+  "KW_MAKE_MAP_PROPERTY", "KW_MAKE_PROPERTY", "KW_MAKE_PROPERTY2",
+  "KW_MAKE_SEQ", "KW_MAKE_SEQ_PROPERTY", "KW_MUTABLE", "KW_NAMESPACE",
+  "KW_NEW", "KW_NOEXCEPT", "KW_NULLPTR", "KW_OPERATOR", "KW_OVERRIDE",
+  "KW_PRIVATE", "KW_PROTECTED", "KW_PUBLIC", "KW_REGISTER",
+  "KW_REINTERPRET_CAST", "KW_RETURN", "KW_SHORT", "KW_SIGNED", "KW_SIZEOF",
+  "KW_STATIC", "KW_STATIC_ASSERT", "KW_STATIC_CAST", "KW_STRUCT",
+  "KW_TEMPLATE", "KW_THREAD_LOCAL", "KW_THROW", "KW_TRUE", "KW_TRY",
+  "KW_TYPEDEF", "KW_TYPEID", "KW_TYPENAME", "KW_UNDERLYING_TYPE",
+  "KW_UNION", "KW_UNSIGNED", "KW_USING", "KW_VIRTUAL", "KW_VOID",
+  "KW_VOLATILE", "KW_WCHAR_T", "KW_WHILE", "START_CPP", "START_CONST_EXPR",
+  "START_TYPE", "'{'", "','", "';'", "':'", "'='", "'?'", "'|'", "'^'",
+  "'&'", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'~'", "'.'",
+  "'('", "'['", "')'", "'}'", "'!'", "']'", "$accept", "grammar", "cpp",
+  "constructor_inits", "constructor_init", "extern_c", "$@1",
+  "declaration", "friend_declaration", "$@2", "storage_class",
+  "attribute_specifiers", "attribute_specifier", "type_like_declaration",
+  "$@3", "$@4", "multiple_instance_identifiers", "typedef_declaration",
+  "$@5", "typedef_instance_identifiers", "constructor_prototype", "$@6",
+  "$@7", "function_prototype", "$@8", "$@9", "$@10", "$@11", "$@12",
+  "function_post", "function_operator", "more_template_declaration",
+  "template_declaration", "$@13", "template_formal_parameters",
+  "template_nonempty_formal_parameters", "typename_keyword",
+  "template_formal_parameter", "template_formal_parameter_type",
+  "instance_identifier", "$@14",
+  "instance_identifier_and_maybe_trailing_return_type",
+  "maybe_trailing_return_type", "maybe_comma_identifier",
+  "function_parameter_list", "function_parameters",
+  "formal_parameter_list", "formal_parameters",
+  "template_parameter_maybe_initialize", "maybe_initialize",
+  "maybe_initialize_or_constructor_body",
+  "maybe_initialize_or_function_body", "structure_init",
+  "structure_init_body", "function_parameter", "formal_parameter",
+  "not_paren_formal_parameter_identifier", "formal_parameter_identifier",
+  "parameter_pack_identifier", "not_paren_empty_instance_identifier",
+  "empty_instance_identifier", "type", "type_pack", "type_decl",
+  "predefined_type", "var_type_decl", "full_type", "struct_attributes",
+  "anonymous_struct", "$@15", "named_struct", "$@16", "maybe_final",
+  "maybe_class_derivation", "class_derivation", "base_specification",
+  "enum", "enum_decl", "enum_element_type", "enum_body_trailing_comma",
+  "enum_body", "enum_keyword", "struct_keyword", "namespace_declaration",
+  "$@17", "$@18", "using_declaration", "simple_type", "simple_int_type",
+  "simple_float_type", "simple_void_type", "code", "$@19", "code_block",
+  "element", "optional_const_expr", "optional_const_expr_comma",
+  "const_expr_comma", "no_angle_bracket_const_expr", "const_expr",
+  "const_operand", "formal_const_expr", "formal_const_operand",
+  "capture_list", "capture", "class_derivation_name", "name",
+  "name_no_final", "string_literal", "empty", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-926)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-759)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     162,  -926,  3677,  5743,    39,  4864,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,   -36,   -99,   -70,   -37,   -33,   -11,
+     -69,    -5,    24,  -926,  -926,    19,    33,    44,    57,    64,
+      67,    78,    92,    96,   102,   144,   171,   174,   179,   185,
+     191,   197,   211,   216,  6057,  -926,  -926,   108,   220,   222,
+      20,   246,  -926,   243,   245,   256,  3677,  3677,  3677,  3677,
+    3677,  1793,  1173,  3677,  3886,  -926,   158,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  5854,   264,  -926,   -23,  -926,
+    -926,  2240,  2171,  2171,  -926,  4505,   272,  -926,  2171,  -926,
+    -926,   305,   305,  -926,  -926,  -926,  -926,   152,    95,  -926,
+    -926,  -926,  -926,  -926,  -926,  6164,   280,  -926,  6986,  6986,
+    6986,  -926,  6986,  5233,  6986,   297,  -926,  6971,   296,   298,
+     307,   314,   319,   324,  6986,  1206,   336,   342,   345,  6986,
+    6986,   331,  6778,  6986,  6986,  5065,  6986,  6986,  -926,  -926,
+    -926,  -926,  2195,  -926,  -926,  -926,  -926,  -926,  3677,  3677,
+    5743,  3677,  3677,  3677,  3677,  5743,  3677,  5743,  3677,  5743,
+    3677,  5743,  5743,  5743,  5743,  5743,  5743,  5743,  5743,  5743,
+    5743,  5743,  5743,  5743,  5743,  5743,  3677,  -926,  -926,   332,
+    4505,   337,   338,  4505,  -926,  -926,  5743,  3677,  3677,   339,
+    5336,  5743,  1793,  3677,  3677,    88,    88,    88,    88,    88,
+     -36,   -70,   -37,   -33,   -11,    -5,    19,    44,  6195,  5244,
+    5695,  6068,   256,   334,   -78,  3886,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  4505,  4505,
+     -85,   358,  -926,  -926,    88,  3677,  3677,  3677,  3677,  3677,
+    3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,
+    3677,  3677,  3677,  3677,  3677,  3677,  2732,  3677,  -926,  -926,
+     305,   305,  2867,  -926,  -926,  -926,  2171,  -926,  -926,  -926,
+    -926,  5743,  -926,   353,   261,   150,   305,   305,   150,   150,
+    4978,   349,  -926,   350,  -926,  -926,  -926,  -926,  -926,  -926,
+    1338,   368,  5160,  -926,  4505,   472,   371,   356,  1936,  5250,
+    6986,  -926,  -926,  -926,  -926,  6986,  -926,  -926,  -926,  -926,
+    6871,  1355,  -926,  4505,  4505,  4505,  4505,  4505,  4505,  -926,
+    -926,   375,  -926,  -926,  -926,  -926,  -926,  3677,  -926,  4316,
+    -926,   367,  -926,  4408,  -926,  4505,    74,  -926,  -926,   -63,
+     364,  -926,   365,  5941,  4505,   366,  -926,  4505,  -926,   239,
+     383,  -926,  -926,  -926,  -926,   792,  -926,  -926,   372,   386,
+    -926,   369,   374,   382,   384,   390,   391,   393,   395,   396,
+     407,   408,   410,   412,   415,   414,   -75,   424,   416,   419,
+     428,   429,   431,   432,   435,   436,   437,   438,   439,  3677,
+    -926,  5743,  3677,  -926,  6759,   425,   443,   446,  4505,   450,
+     451,   434,   452,  4177,   462,   463,  3677,  3677,  -926,   524,
+    -926,  1294,   467,  3677,  -926,  -926,  1444,  4862,  1629,  1629,
+     908,   908,  1658,  1658,  -926,  2750,  1066,  4908,  5061,   908,
+     908,   166,   166,    88,    88,    88,  -926,  -926,   -74,  1595,
+    -926,  -926,   468,  4477,   473,   150,   476,   479,  4505,   150,
+     150,   150,   150,   150,   477,  -926,   349,  -926,   349,  -926,
+     477,   477,  -926,   150,  6164,  5830,  5714,   150,   150,   481,
+      53,  -926,   672,   720,  -926,  3677,  4505,   484,  -926,  -926,
+    -926,  -926,  1338,   -16,   -14,    -4,  6164,   489,   143,  -926,
+    -926,  -926,   494,  6986,  6164,  3812,   -36,   482,  4535,  -926,
+    -926,  -926,   509,   511,   513,   515,   522,   525,   526,  6239,
+    -926,  3831,  5486,   249,   492,   239,  -926,  -926,   523,  -926,
+    5743,  -926,    46,  3002,  6081,   916,  -926,  5743,  -926,   510,
+     202,  -926,  -926,  2079,  -926,  -926,   413,  -926,   531,  5160,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,   521,  -926,   533,
+    -926,  -926,  -926,  -926,  5743,  -926,  5743,  -926,  5743,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    4556,   529,   536,  -926,   535,  -926,  -926,   537,  -926,  -926,
+     540,  -926,  -926,  -926,  -926,    88,  3886,  -926,  4505,   358,
+    5593,  2226,  -926,  3886,  3677,  -926,  -926,  -926,  -926,  -926,
+     477,   150,  -926,   477,   477,   477,   477,   477,  3677,  -121,
+     658,  5854,   672,   720,  -926,   -29,    10,  -926,  -926,  5622,
+     555,   672,   672,   672,   672,   672,   672,   -57,  -926,  -926,
+     558,  4505,   720,   720,   720,   720,   720,   720,    99,   551,
+    3886,  -926,   -52,  -926,   582,   683,  1936,  -926,   660,  6164,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,   569,   584,
+     589,  -926,  -926,  6057,  -926,  -926,   590,    35,   594,  -926,
+     573,  3677,  3677,  3677,  3677,  1793,  3677,   585,    54,  -926,
+    -926,  4647,  -926,   158,  -926,  6986,  6986,  6312,  -926,   741,
+     743,   744,   748,   754,   755,  -926,  -926,   290,   617,  -926,
+    -926,  -926,  -926,  5518,  -926,   610,   620,  6753,  -926,   495,
+    -926,  -926,    46,  -926,   413,  -926,   621,  5593,   609,   413,
+    5593,   612,  4574,   916,   616,   916,   916,   916,   916,   916,
+     266,  -926,  -926,   614,  6385,  -926,  -926,  -926,  4505,   248,
+    -926,   615,  -926,   637,   638,  3137,  3024,   628,   413,   413,
+    4248,   413,   413,   413,   413,  -926,     8,   250,  -926,  1338,
+    -926,  3677,  3677,   624,   626,   629,  -926,  -926,  -926,  3677,
+    -926,  3677,  -926,   630,  -926,  5970,  6164,  -926,  -926,  -926,
+    -926,  -926,  -926,   634,  -926,  -926,   653,  -926,  3886,   477,
+     635,   641,  5714,   672,   720,   -57,    99,   642,   644,  2226,
+    -926,  -926,   672,   645,   645,   645,   645,   645,   212,  3677,
+    -926,   720,  -926,   649,   649,   649,   649,   649,   275,  3677,
+    -926,   650,  -926,  3677,  -926,   643,  4592,  6458,  -926,   669,
+    -926,  -926,  5743,  5743,  5743,   655,  5743,   659,  5365,  5743,
+    1793,    88,    88,    88,    88,   656,   -66,    88,  -926,  -926,
+    3953,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,
+    3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,  3677,
+    3677,  3677,  3272,  3677,  -926,  -926,  -926,  -926,   678,   -48,
+     685,   686,   690,   691,  6531,    23,  -926,   495,  6944,  5486,
+    4505,   680,   681,   495,   495,   495,   495,   495,   495,   134,
+     649,  -926,   250,  -926,   675,   413,   240,   676,  -926,  -926,
+     288,   916,   679,   679,   679,   679,   679,  -926,  3677,  -926,
+    -926,  5593,   687,   321,  -926,   -25,   697,   698,  -926,  2564,
+    -926,  -926,  -926,  3137,   692,   700,  3886,  -926,  -926,   413,
+     311,   311,   839,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,   684,
+     688,  -926,  -926,   311,   311,   311,   247,   849,  -926,  3677,
+    -926,  2079,   706,  -926,   582,   -44,   -40,  -926,  -926,  -926,
+     -28,   -22,  -926,  6057,   305,   811,   471,  -926,  -926,  5593,
+    -926,   -57,    99,  -926,  -926,  5593,  5593,  -926,   645,   699,
+     693,   649,   701,   695,  3294,  -926,  -926,  -926,  5324,   723,
+     714,  -926,   704,   710,   716,  3677,   724,  4505,   717,   721,
+     725,   722,  4629,  3677,  -926,  -926,  -926,  1444,  4862,  1629,
+    1629,   908,   908,  1658,  1658,  -926,  3564,  1066,  4908,  5061,
+     908,   908,   166,   166,    88,    88,    88,  -926,  -926,    -6,
+    1958,  6604,   867,   873,   738,   880,   733,  -926,   892,   893,
+     894,  -926,   760,   134,   649,  -926,  -926,  -926,  -926,  -926,
+    -926,  5743,   495,  4093,  -926,  -926,   764,  -926,  -926,   269,
+     749,  -926,  -926,   679,  5593,   746,   751,  -926,  -926,  4505,
+    3677,  3677,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,  -926,  -926,   771,  -926,  3407,   311,  -926,  -926,
+    -926,  -926,  -926,  3812,   753,  3024,   413,  -926,  -926,  -926,
+    -926,  2226,   305,  -926,  -926,  -926,    15,   776,   752,  -926,
+    -926,   778,   779,  5593,  -926,  5593,  -926,  -926,  5705,  6090,
+    6150,  4505,   343,  -926,  -926,   932,  -926,  5324,  -926,   783,
+     784,   812,   813,   814,  -926,  -926,   815,  -926,  -926,    88,
+    3677,  -926,  -926,  -926,   816,     1,  -926,   834,   835,    14,
+     819,    59,  -926,  -926,  -926,   822,   833,   837,   838,    38,
+     840,  4093,  4093,  4093,  4093,  4093,  1793,  4093,  4798,  -926,
+     413,  4016,   825,  -926,  4016,  5593,   828,  -926,  -926,   829,
+    -926,   830,   842,  2396,  -926,  3137,  3886,   845,  -926,  -926,
+     853,  -926,   850,  -926,  -926,  -926,  -926,  -926,   851,   852,
+    5929,  -926,  5929,  -926,  5929,  -926,  -926,  5929,  5929,  5929,
+    -926,  6677,  -926,  3677,  3677,  -926,  3677,  -926,  3677,  3886,
+     855,   992,   858,  1006,  -926,  1010,   874,   875,  1012,   876,
+    5743,  5743,  5743,  5743,   861,  5457,  5743,   123,   123,   123,
+     123,   123,   860,   101,   123,  4093,  4093,  4093,  4093,  4093,
+    4093,  4093,  4093,  4093,  4093,  4093,  4093,  4093,  4093,  4093,
+    4093,  4093,  4093,  4093,  3542,  3677,  -926,  -926,  5593,   863,
+    -926,  4016,  -926,  -926,  1013,  -926,   864,  -926,  -926,  -926,
+    2226,  2226,  2226,  -926,  -926,  -926,  -926,  -926,  -926,  -926,
+    -926,  -926,   114,   147,   168,   175,  -926,   885,  -926,   868,
+     888,  -926,  -926,   176,  -926,   872,   883,   884,   886,  4505,
+     877,   887,   895,  4093,  -926,  4144,  5038,  1181,  1181,  1608,
+    1608,  2116,  2116,  -926,  4744,  5088,  5104,  1648,   405,   405,
+     123,   123,   123,  -926,  -926,   181,  2329,  5593,   889,  -926,
+    4016,  -926,  -926,  4016,   882,  -926,  -926,  -926,  4016,  4016,
+    -926,  -926,  -926,  -926,  1043,   891,   906,  1049,  1050,   912,
+    -926,   897,   899,   900,   910,  -926,  -926,   913,   123,  4093,
+    -926,  -926,   914,  -926,  4016,  -926,  -926,   926,  -926,   923,
+     192,  -926,  3677,  3677,  3677,  -926,  3677,  4798,  -926,  2226,
+    -926,   930,  1070,   934,   193,   199,   206,   213,  2226,  -926,
+    -926,   925,  -926,  -926,  -926,  -926,  -926,  -926,   944,  -926
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,   763,     0,     0,     0,   763,     5,   651,   647,   650,
+     759,   760,   653,   654,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   649,   655,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   657,   656,     0,     0,     0,
+       0,     0,   648,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   763,     0,     3,   588,   652,   298,   309,   308,
+     392,   393,   395,   396,   377,     0,     0,   407,   374,   406,
+     401,   398,   397,   400,   378,     0,     0,   379,   399,   409,
+     394,   763,   763,     4,   300,   301,   302,     0,   363,   763,
+     297,   389,   390,   391,     1,     0,     0,    21,   763,   763,
+     763,    22,   763,   763,   763,     0,    42,   763,     0,     0,
+       0,     0,     0,     0,   763,     0,     0,     0,     0,   763,
+     763,     0,   763,   763,   763,     0,   763,   763,     6,    17,
+       7,    19,     0,    15,    16,    18,    73,    44,   763,   763,
+       0,   763,   763,   763,   763,     0,   763,     0,   763,     0,
+     763,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   763,   324,   330,     0,
+       0,     0,   612,     0,   763,   323,     0,   763,   763,     0,
+       0,     0,     0,   763,   763,   621,   619,   618,   620,   617,
+     298,   392,   393,   395,   396,   407,   406,   401,   398,   397,
+     400,   399,   394,     0,     0,   547,   744,   745,   746,   754,
+     747,   750,   748,   752,   751,   749,   753,   733,   734,     0,
+       0,   763,   739,   732,   616,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   761,   762,
+     763,   763,     0,   375,   376,   408,   398,   403,   402,   405,
+     299,     0,   404,     0,   284,   763,   763,   763,   763,   763,
+     763,     0,   333,   283,   335,   763,   755,   756,   757,   758,
+       0,   365,     0,   337,     0,     0,    62,    64,     0,   763,
+     763,    56,    45,    55,    57,   763,    46,   152,    51,    23,
+     763,     0,    49,     0,     0,     0,     0,     0,     0,    54,
+     763,     0,    26,    25,    24,    52,    48,     0,   156,     0,
+     155,     0,    58,     0,    20,     0,     0,    50,    53,   332,
+     311,   322,     0,     0,     0,     0,    13,     0,    70,     0,
+     331,    67,   313,   314,   315,   363,   763,   310,     0,   546,
+     545,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     325,     0,   763,   327,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   646,   737,
+     740,     0,   763,     0,   735,   212,   630,   631,   632,   633,
+     634,   635,   638,   639,   645,     0,   627,   628,   629,   636,
+     637,   625,   626,   622,   623,   624,   644,   643,     0,     0,
+     334,   336,     0,     0,     0,   763,   285,     0,   274,   763,
+     763,   763,   763,   763,   290,   273,     0,   286,     0,   287,
+     289,   288,   197,   763,     0,     0,     0,   763,   763,     0,
+     198,   201,   763,     0,   196,   763,   371,     0,   368,   367,
+     362,   366,     0,   744,   745,   746,     0,     0,   748,   341,
+     303,   343,     0,   763,     0,   763,   311,     0,     0,    47,
+      43,   763,     0,     0,     0,     0,     0,     0,     0,   763,
+     380,     0,   763,   332,   311,     0,   331,    76,     0,   386,
+       0,    81,    83,     0,     0,   763,   312,     0,   763,     0,
+       0,   410,   219,     0,    72,    69,     0,   318,   365,     0,
+     595,   594,   611,   601,   597,   599,   600,     0,   607,     0,
+     606,   660,   596,   661,     0,   663,     0,   664,     0,   667,
+     668,   669,   670,   671,   672,   673,   674,   675,   676,   603,
+       0,     0,     0,   326,     0,   602,   605,     0,   609,   608,
+       0,   614,   615,   604,   598,   589,   548,   738,     0,   763,
+     763,   763,    96,   213,     0,   642,   641,   306,   305,   307,
+     291,   763,   275,   280,   276,   277,   279,   278,   763,     0,
+       0,     0,   763,     0,   238,     0,     0,   763,   200,     0,
+       0,   763,   763,   763,   763,   763,   763,   763,   252,   251,
+       0,   262,     0,     0,     0,     0,     0,     0,   763,     0,
+     544,   543,   372,   361,   304,     0,     0,   763,   763,     0,
+      59,    63,   725,   721,   724,   727,   728,   204,     0,     0,
+       0,   723,   729,     0,   731,   730,     0,     0,     0,   722,
+       0,     0,     0,     0,     0,     0,     0,     0,   205,   240,
+     208,   241,   677,   726,   203,   763,   763,   763,   382,     0,
+       0,     0,     0,     0,     0,   384,   763,     0,     0,   173,
+     174,   175,   161,     0,   162,     0,   158,   163,   159,   763,
+     172,   157,     0,    78,     0,   388,     0,   763,     0,     0,
+     763,     0,     0,   763,     0,   763,   763,   763,   763,   763,
+       0,   243,   242,     0,   763,    85,   410,   214,     0,     0,
+      71,     0,   763,     0,     0,   763,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    68,   763,   763,   176,     0,
+     316,     0,     0,     0,     0,     0,   328,   329,   613,     0,
+     610,     0,   736,     0,   103,     0,     0,    97,   105,   100,
+     104,    99,   101,     0,    98,   102,     0,   191,   640,   281,
+       0,     0,     0,   763,     0,   763,   763,     0,     0,   763,
+     199,   202,   763,   257,   253,   254,   256,   255,     0,   763,
+     232,     0,   263,   268,   264,   265,   267,   266,     0,   763,
+     235,   292,   369,     0,   338,     0,     0,   763,   346,   763,
+     345,    66,     0,     0,     0,   687,     0,     0,     0,     0,
+       0,   695,   694,   693,   692,     0,     0,   691,    65,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    61,    60,   385,   763,     0,     0,
+     763,     0,     0,     0,   763,     0,    41,   763,   763,     0,
+     166,   164,     0,   763,   763,   763,   763,   763,   763,   763,
+     170,    77,   763,   387,     0,     0,     0,     0,   320,   319,
+       0,   763,   248,   244,   245,   247,   246,    91,   763,   321,
+      14,   763,     0,     0,     8,     0,     0,     0,   220,   411,
+     412,   222,   223,   763,     0,   226,   228,   225,   221,     0,
+     183,   179,     0,   120,   121,   122,   123,   124,   125,   128,
+     129,   144,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   148,   147,   131,   130,   117,   119,
+     118,   126,   127,   115,   116,   112,   113,   114,   111,     0,
+       0,   110,   177,   180,   182,   181,     0,     0,   187,   763,
+     189,     0,     0,    74,   317,     0,     0,   662,   665,   666,
+       0,     0,   763,     0,   763,     0,     0,   410,   282,   763,
+     239,   763,   763,   233,   236,   763,   763,   293,   258,   261,
+       0,   269,   272,     0,   373,   340,   339,   342,     0,     0,
+     348,   347,     0,     0,     0,   763,     0,     0,     0,     0,
+       0,     0,     0,     0,   720,   206,   209,   704,   705,   706,
+     707,   708,   709,   712,   713,   719,     0,   701,   702,   703,
+     710,   711,   699,   700,   696,   697,   698,   718,   717,     0,
+       0,   763,     0,     0,     0,     0,     0,   194,     0,     0,
+       0,   381,     0,   763,   171,   151,   149,   154,   150,   160,
+     167,     0,   763,     0,   168,   210,     0,    79,   763,     0,
+       0,   763,    93,   249,   763,     0,     0,   215,   410,     0,
+     763,   763,   217,   218,   414,   415,   419,   416,   424,   417,
+     418,   420,   421,   422,   423,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
+     460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
+     470,   471,   472,   492,   473,   474,   475,   476,   477,   478,
+     479,   480,   481,   482,   483,   484,   485,   486,   487,   488,
+     489,   490,   491,   493,   494,   495,   496,   497,   498,   499,
+     500,   501,   502,   503,   504,   505,   506,   507,   508,   509,
+     510,   511,   512,   513,   514,   515,   516,   517,   518,   519,
+     763,   536,   537,   538,   529,   541,   525,   526,   524,   531,
+     532,   520,   521,   522,   523,   530,   528,   535,   533,   539,
+     534,   527,   540,   413,     0,   224,   227,   184,   178,   146,
+     145,   186,   190,   763,     0,   213,     0,   592,   591,   593,
+     590,   763,   763,   192,   109,   106,     0,     0,     0,   234,
+     237,     0,     0,   763,   259,   763,   270,   370,   752,     0,
+     751,     0,     0,   349,   351,   741,   763,     0,   686,     0,
+       0,     0,     0,     0,   684,   683,     0,   689,   690,   678,
+       0,   716,   715,   383,     0,     0,    33,   195,     0,     0,
+       0,     0,    40,   169,   165,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   211,   549,
+       0,    82,     0,    87,    84,   763,     0,   250,   763,     0,
+       9,     0,     0,     0,   229,   763,   230,     0,   185,    75,
+       0,   193,     0,   107,   658,   763,   763,   763,     0,     0,
+       0,   354,     0,   353,     0,   352,   742,     0,     0,     0,
+     743,   763,   350,     0,     0,   688,     0,   685,     0,   714,
+       0,     0,     0,     0,    27,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   564,   562,   561,
+     563,   560,     0,     0,   559,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    80,    89,   763,     0,
+     763,    86,   216,    12,    10,   542,     0,   763,   410,   108,
+     763,   763,   763,   763,   763,   360,   359,   358,   357,   356,
+     355,   344,     0,     0,     0,     0,    36,   763,    34,     0,
+       0,    37,    39,     0,    29,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   587,   573,   574,   575,   576,   577,
+     578,   579,   580,   586,     0,   570,   571,   572,   568,   569,
+     565,   566,   567,   585,   584,     0,     0,   763,     0,   763,
+      92,    11,   231,   188,     0,   296,   295,   294,   260,   271,
+     681,   680,   682,   679,     0,     0,     0,     0,     0,     0,
+     558,     0,     0,     0,     0,   556,   555,     0,   550,     0,
+     583,   582,     0,   763,    94,   659,   195,     0,    28,     0,
+       0,    30,     0,     0,     0,   557,     0,   581,   763,   763,
+      35,     0,     0,     0,     0,     0,     0,     0,   763,    88,
+      38,     0,    31,   553,   552,   554,   551,    90,     0,    32
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -926,  -926,  -313,  -926,   -13,  -926,  -926,   785,  -128,  -926,
+     104,  -430,   449,  -126,  -926,  -926,  -155,  -926,  -926,  -228,
+    -926,  -926,  -926,   773,  -926,  -926,  -926,  -926,  -926,  -608,
+    -926,  -926,  -111,  -926,  -926,  -926,  -926,   218,   409,  -636,
+    -926,  -703,  -728,  -349,  -576,  -926,  -142,  -926,    30,  -513,
+    -926,  -510,  -925,  -926,  -428,   265,  -648,   312,  -218,    93,
+     -82,   -10,    22,  -279,  -640,   786,  1002,  -159,  -109,  -926,
+     -94,  -926,  -926,  -926,  -926,  -171,   -87,  -926,  -455,  -926,
+    -926,   -18,   -12,  -926,  -926,  -926,  -926,   -32,   -39,  -926,
+    -926,  -715,  -926,  -103,  -926,  -561,  -136,   -60,   302,   715,
+    -276,  -926,  -926,  -926,   707,    13,  1196,   -61,  -492,    -1
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     4,     5,   923,   924,   139,   528,   140,   141,   310,
+     142,   295,   296,   143,   536,   530,   755,   334,   714,   901,
+     348,   717,   720,   349,   921,  1428,  1497,  1104,  1335,   591,
+     982,  1087,   144,   331,   705,   706,   707,   708,   709,   756,
+    1253,   757,   786,  1076,   469,   470,   677,   678,  1094,   414,
+     740,   534,   934,   935,   471,   680,   730,   803,   813,   281,
+     282,    91,    92,   350,   182,   351,    93,   292,    94,   647,
+      95,   648,   829,  1029,  1030,  1283,    96,    97,   480,   476,
+     477,    98,    99,   145,   696,   877,   146,   100,   101,   102,
+     103,   741,   742,   929,  1243,   639,   358,   359,  1328,   215,
+      65,   681,   682,   230,   231,  1284,  1285,   628,    66,   147
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+       6,   214,   307,   683,   328,   713,   330,   509,  1244,   799,
+     284,   902,   185,   361,   773,   363,   364,   365,   366,   497,
+     368,   922,   370,   835,   372,   394,   183,   644,   990,   258,
+    1352,   259,   184,   352,   610,   189,   263,   291,   614,   104,
+     388,   775,   267,   268,   269,   608,   791,   790,   353,   272,
+     837,   396,   397,  1394,   516,   354,   645,   404,   405,   718,
+    -755,   233,  -756,   411,   651,   260,   150,   679,   618,   849,
+     407,  1017,  -757,   556,   407,   910,   772,   912,   913,   914,
+     915,   916,   407,   906,   -95,   412,   -95,   155,   -95,   408,
+     283,   283,   557,   595,   413,   151,   822,   261,   293,   823,
+    1073,  1044,   521,   264,   407,   286,   287,   288,   407,   809,
+     357,   148,   940,   941,   810,   983,   984,   985,   986,  1074,
+     407,   243,  1110,  1257,   355,   820,   407,  1258,   152,   149,
+     356,  -755,   153,  -756,  -755,  1004,  -756,   608,   797,  1259,
+    1111,   904,   407,  -757,   907,  1260,  -757,   360,   360,  1381,
+     360,   360,   360,   360,   154,   360,  1413,   360,   987,   360,
+     156,  1301,  1385,   447,   258,   448,   259,   449,  1382,   267,
+     268,   269,   272,   988,   989,   360,   608,   798,   440,   441,
+     157,  1386,  1353,   293,   158,   190,   360,   360,   687,   352,
+    1082,   801,   360,   360,   457,   459,   438,   539,   159,   243,
+     838,   619,   850,  1395,   353,   885,   719,  1388,   289,   160,
+     450,   354,   301,   302,   303,   734,   304,   306,   308,  -758,
+     352,   312,   161,   519,   352,   520,  1389,   267,   319,   162,
+     415,   491,   163,   325,   326,   353,   329,   332,   333,   353,
+     337,   338,   354,   164,   992,   290,   354,   993,  1020,   407,
+     413,   481,   255,   256,   257,   638,   572,   165,  1023,   283,
+     283,   166,   407,  1103,   186,   819,   357,   167,  1474,  1099,
+     472,   216,   217,   218,   455,   283,   283,   455,   455,   474,
+     355,  1510,  1013,  1014,   478,  1093,   356,  1423,  1424,  1425,
+    -758,   451,  1267,  -758,   538,   407,    10,   357,    11,   285,
+     809,   357,   473,  1247,   994,   452,     1,     2,     3,   168,
+     453,   355,   926,   927,  1511,   355,   407,   356,   273,     6,
+     274,   356,   275,   407,  1518,   219,   252,   253,   254,   407,
+     255,   256,   257,   525,   827,  1512,   169,   220,   221,   170,
+    1552,   407,  1513,  1519,   171,  1106,  1005,   407,  1530,   736,
+     172,   737,   738,   739,   407,   293,   173,  1105,   683,  1553,
+    1563,   407,   174,  1262,  1010,   276,  1564,   825,   454,   456,
+     458,   460,   461,  1565,   222,   223,   175,   224,   809,  1019,
+    1566,   176,   225,   884,   226,   187,   531,   188,   532,  1096,
+     533,   360,  1097,  1339,  1261,   796,   -95,   531,   -95,   532,
+     -95,   991,   191,   306,   312,   988,   989,  1100,   192,   499,
+     193,   592,   988,   989,  1251,   814,   815,   816,   817,   818,
+    1436,   194,   679,   286,   287,   288,   747,  -274,  1254,   262,
+     748,   917,   918,  1268,   988,   989,  1332,   271,  1413,  1271,
+    1272,   819,  1022,   481,   455,   298,   277,   309,   455,   455,
+     455,   455,   455,  1102,   918,   612,   472,  1367,  1368,  1369,
+     278,   313,   455,   314,   731,   279,   455,   455,  1108,  1109,
+     280,   629,   315,   749,   641,   758,   988,   989,   491,   316,
+     710,   216,   217,   218,   317,   472,   322,   613,   473,   318,
+    1331,   900,   323,  1334,   684,   324,   327,   389,  1269,  1270,
+       6,   406,   391,   392,   398,   286,   287,   288,   892,   413,
+     631,   711,   893,   445,   723,   475,  -273,   473,   482,   494,
+     493,   495,   510,   512,   732,   750,   289,     6,  1336,   522,
+     523,   527,   535,  1350,   407,   219,   541,   352,   600,   587,
+     540,   542,   603,   604,   605,   606,   607,   220,   221,   543,
+     547,   544,   353,   549,   751,   894,   609,   545,   546,   354,
+     615,   616,   548,   554,  1071,  1420,  1421,  1422,   752,  1423,
+    1424,  1425,   558,   753,   550,   551,  1012,   552,   754,   553,
+     472,   555,   574,   559,   222,   223,   560,   224,   415,   474,
+     787,   580,   225,  1021,   226,   561,   562,   650,   563,   564,
+     455,   793,   565,   566,   567,   568,   569,   641,   289,   472,
+     575,   629,   473,   576,   357,   846,   592,   578,   579,   581,
+     629,   629,   629,   629,   629,   629,   415,   902,   355,   583,
+     584,   185,   590,   794,   356,   597,   895,   415,  1265,   601,
+     599,   473,  -275,   608,   649,   183,     6,   830,   617,   685,
+     896,   184,   643,   758,   646,   897,   688,   712,   758,   689,
+     898,   690,   731,   691,   731,   731,   731,   731,   731,  1084,
+     692,   710,   715,   693,   694,   735,   814,   815,   816,   817,
+     818,   759,   286,   287,   288,   620,   761,   758,   758,   621,
+     758,   758,   758,   758,   789,     6,   767,  1358,   762,  1359,
+     769,   995,   996,   768,   770,   771,   792,   472,   629,  1000,
+     472,  1001,  1505,  1506,  1507,   802,   474,    64,   811,   474,
+     481,   821,   732,  1504,   732,   732,   732,   732,   732,  -364,
+    1431,   824,   622,   630,   832,   631,   828,   632,   840,   473,
+     833,   930,   473,   185,   937,   834,   836,  1440,  1441,  1442,
+     839,   878,   848,   879,   880,   787,   415,   183,   881,  1429,
+    1085,   683,  1086,   184,   882,   883,   886,   888,   889,   905,
+     903,   195,   196,   197,   198,   199,   911,  1088,   234,   908,
+     633,   919,   472,   928,   627,   289,   931,   932,   939,   874,
+     875,   997,   629,   998,   415,   415,   999,  1002,   787,  1006,
+    1007,   629,   483,   484,   485,  1008,  1009,  1015,   641,  1016,
+    1025,   809,  1069,   623,   473,   819,  -282,  1329,   641,  1028,
+    1035,  1559,  1500,  1043,  1037,   679,  1072,   624,  1031,  1503,
+    1567,  1091,   625,  1075,  1078,  1508,  1509,   626,  1079,  1080,
+     472,  1092,  1098,  1101,   758,   918,  1112,  1113,  1246,  1248,
+     731,  1249,  1498,  1252,  1256,  1107,   219,   710,  1250,  1264,
+    1245,   634,  1287,  1274,  1273,  1276,  1275,  1289,   220,   221,
+    1286,  1288,   473,  1290,  1021,   635,     6,  1304,   758,  1077,
+     636,  1292,  1296,  1305,  1294,   637,   629,  1306,  1295,  1297,
+    1307,  1534,   629,   629,   629,   629,   629,   629,  1095,  1291,
+    1308,   415,  1309,  1310,  1311,   488,   223,   403,   224,  1312,
+     732,   472,  1330,   225,  1333,   226,  1337,   641,  1338,  1355,
+     474,  1532,  1263,  1348,   795,  1549,   286,   287,   288,   724,
+     241,   242,   937,   725,   804,   805,   806,   807,   808,  1344,
+    1558,   243,   290,   473,  1354,  1356,  1357,  1370,  1373,  1374,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,   435,
+     436,   185,   439,  1371,  1341,  1342,   726,   443,  1376,  1375,
+    1378,  1377,  1383,  1380,  1384,   183,  1387,  1390,   641,  1391,
+    1427,   184,   329,  1392,  1393,  1430,  1396,  1432,  1433,   472,
+    1438,   592,  1457,   283,  1456,   472,   472,  1458,   474,  1434,
+     415,   415,  1437,   498,   474,   474,  1459,  1439,  1443,  1444,
+    1460,   899,  1463,  1461,  1462,  1464,  1469,  1473,  1501,   289,
+    1499,   473,  1502,  1514,   360,  1516,  1517,   473,   473,  1520,
+    1521,  1522,   511,  1523,  1525,  1329,  1329,  1329,  1329,  1329,
+    1535,  1329,  1527,  1536,  1526,  1538,  1533,   727,  1537,  1539,
+    1540,  1541,  1542,   213,  1543,  1544,   250,   251,   252,   253,
+     254,   728,   255,   256,   257,  1550,   729,  1545,  1546,  1560,
+    1561,  1548,  1095,  1562,   237,   238,   239,   240,   241,   242,
+    1551,   629,  1568,  1569,   472,   500,  1340,   592,   831,   243,
+     592,  1349,  1426,   474,   570,  1011,   515,  1089,  1515,   360,
+     360,  1347,   887,  1313,  1018,  1046,  1372,  1343,   589,   517,
+       0,   585,   586,     0,     0,     0,   473,     0,   593,  1329,
+    1329,  1329,  1329,  1329,  1329,  1329,  1329,  1329,  1329,  1329,
+    1329,  1329,  1329,  1329,  1329,  1329,  1329,  1329,     0,     0,
+       0,     0,   362,     0,     0,     0,     0,   367,     0,   369,
+       0,   371,     0,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,   386,   387,     0,     0,
+    1351,     0,     0,   216,   217,   218,     0,     0,   395,     0,
+     640,     0,   400,   401,   402,   758,     0,  1329,     0,  1083,
+       0,  1409,  1410,  1411,  1412,     0,   804,   805,   806,   807,
+     808,     0,     0,     0,  1413,     0,   216,   217,   218,   930,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,     0,
+     255,   256,   257,     0,     0,     0,     0,   219,   722,     0,
+       0,     0,     0,   472,     0,     0,     0,     0,   746,   220,
+     221,     0,   684,  1329,     0,     0,     0,     0,   232,     0,
+     787,   283,     0,   472,     0,   472,  1403,     0,     0,   758,
+     219,     0,   474,   444,   474,   473,     0,     0,     0,     0,
+       0,   270,   220,   221,     0,     6,   222,   223,     0,   224,
+       0,  1361,  1363,  1365,   225,   473,   226,   473,     0,     0,
+       0,   297,     0,     0,   216,   217,   218,     0,     0,   788,
+       0,     0,     0,  1452,  1453,     0,  1454,     0,  1455,   222,
+     223,   321,   224,   640,   227,   472,     0,   225,   228,   226,
+       0,   336,     0,   229,   474,     0,     0,   592,     0,  1418,
+    1419,  1420,  1421,  1422,   937,  1423,  1424,  1425,     0,   479,
+       0,     0,     0,   320,   592,   592,   592,   473,   219,     0,
+       0,   826,     0,     0,  1495,   216,   217,   218,     0,     0,
+     220,   221,     0,  1445,     0,  1446,   390,  1447,     0,   393,
+    1448,  1449,  1450,     0,     0,     0,   841,   842,   843,   844,
+       0,   847,    70,   571,    71,    72,    73,     0,     0,     0,
+       0,     0,     0,     0,  1018,     0,     0,   222,   223,     0,
+     224,     0,     0,     0,     0,   225,     0,   226,   472,   219,
+       0,     0,    80,     0,   409,   410,     0,   474,     0,   592,
+       0,   220,   221,     0,     0,     0,   592,     0,   266,   787,
+     787,   787,   592,   592,     0,     0,     0,     0,     0,   588,
+     473,     0,     0,     0,   229,     0,  1077,     0,    82,    83,
+     936,   236,   237,   238,   239,   240,   241,   242,   222,   223,
+     446,   224,     0,     0,     0,    88,   225,   243,   226,     0,
+      90,     0,  1554,  1555,  1556,     0,  1557,   472,   490,     0,
+     492,     0,     0,     0,     0,     0,   474,     0,   592,     0,
+       0,     0,   501,     0,     0,     0,     0,   502,     0,   503,
+     504,   505,   506,   507,   508,     0,     0,     0,     0,   473,
+       0,     0,   716,     0,   640,     0,     0,     0,     0,   733,
+       0,   518,   592,     0,   640,     0,     0,     0,  1024,     0,
+     526,     0,     0,   529,     0,     0,     0,   592,   787,     0,
+       0,   537,     0,     0,     0,  1042,   763,   787,   764,     0,
+     765,     0,     0,     0,     0,     0,  1047,  1048,  1049,  1050,
+    1051,  1052,  1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,
+    1061,  1062,  1063,  1064,  1065,  1066,  1067,     0,  1070,     0,
+     573,     0,     0,     0,   577,     0,     0,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   232,   255,   256,
+     257,   235,   236,   237,   238,   239,   240,   241,   242,     0,
+       0,     0,     0,  1397,  1398,  1399,  1400,  1401,   243,  1404,
+    1411,  1412,     0,   640,     0,     0,     0,     0,     0,     0,
+       0,  1413,     0,     0,   602,     0,     0,     0,   936,   239,
+     240,   241,   242,     0,     0,     0,     0,     0,     0,     0,
+     297,     0,   243,     0,     0,     0,  1407,  1408,  1409,  1410,
+    1411,  1412,   642,     0,     0,     0,     0,   845,     0,     0,
+       0,  1413,   297,     0,     0,     0,     0,     0,     0,     0,
+     297,   243,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   640,     0,  1255,  1475,  1476,  1477,
+    1478,  1479,  1480,  1481,  1482,  1483,  1484,  1485,  1486,  1487,
+    1488,  1489,  1490,  1491,  1492,  1493,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   760,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,  1299,   255,
+     256,   257,     0,     0,     0,   596,  1418,  1419,  1420,  1421,
+    1422,     0,  1423,  1424,  1425,  1528,     0,     0,     0,     0,
+       0,     0,     0,     0,   409,   248,   249,   250,   251,   252,
+     253,   254,     0,   255,   256,   257,     7,     8,     9,    10,
+       0,    11,    12,    13,   200,    68,  1418,  1419,  1420,  1421,
+    1422,     0,  1423,  1424,  1425,     0,   250,   251,   252,   253,
+     254,     0,   255,   256,   257,     0,     0,   812,     0,     0,
+       0,  1547,     0,     0,  1032,  1033,  1034,     0,  1036,     0,
+    1039,  1040,  1041,    15,    69,   297,     0,   201,     0,   202,
+     203,   204,    74,    75,     0,    20,    76,     0,     0,   205,
+      22,     0,     0,    78,     0,     0,     0,     0,    23,    24,
+     206,     0,     0,     0,    26,     0,     0,   207,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,   208,     0,     0,     0,     0,     0,     0,
+       0,     0,    44,   891,    45,     0,    46,     0,     0,     0,
+       0,    47,     0,   209,   210,    50,     0,     0,    51,    84,
+       0,     0,     0,    52,     0,     0,    53,    85,    86,    87,
+     211,     0,     0,    89,   925,   212,     0,     0,     0,     7,
+       8,     9,    10,     0,    11,    12,    13,   496,    56,     0,
+       0,    57,    58,    59,     0,     0,    60,     0,    61,    62,
+       0,  1346,    63,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   297,     0,   235,   236,   237,   238,   239,   240,
+     241,   242,     0,     0,     0,     0,    15,   341,     0,     0,
+     201,   243,   202,   203,   204,    74,     0,     0,    20,   342,
+       0,     0,   205,    22,     0,     0,    78,     0,     0,     0,
+       0,    23,    24,   206,     0,  1379,     0,    26,     0,     0,
+     207,    28,    29,    30,    31,    32,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,   208,     0,     0,     0,
+       0,     0,     0,     0,     0,    44,     0,    45,     0,    46,
+       0,     0,     0,     0,    47,     0,   209,   210,    50,     0,
+     936,    51,    84,     0,     0,     0,    52,     0,     0,    53,
+     344,   345,    87,   211,     0,     0,    89,     0,   212,     0,
+       0,     0,     7,     8,     9,    10,  1090,    11,    12,    13,
+      14,    56,     0,  1314,    57,    58,    59,     0,     0,    60,
+       0,    61,    62,     0,     0,    63,     0,     0,     0,     0,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,     0,   255,   256,   257,     0,     0,     0,  1302,    15,
+       0,     0,     0,    16,     0,    17,    18,    19,     0,     0,
+    1496,    20,     0,   743,   744,    21,    22,     0,     0,  1413,
+       0,     0,     0,     0,    23,    24,    25,     0,     0,     0,
+      26,     0,     0,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+       0,     0,     0,     0,     0,     0,     0,     0,    44,     0,
+      45,     0,    46,     0,     0,     0,     0,    47,     0,    48,
+      49,    50,  1266,     0,    51,   339,   340,     0,     0,    52,
+       0,     0,    53,     0,     0,     0,    54,     0,     0,     0,
+       0,    55,     0,     0,     0,    70,   745,    71,    72,    73,
+       0,     0,     0,  1293,    56,     0,     0,    57,    58,    59,
+       0,     0,    60,   774,    61,    62,   341,     0,    63,    70,
+       0,    71,    72,    73,    74,    80,     0,     0,   342,   775,
+       0,    77,     0,     0,     0,    78,     0,     0,     0,     0,
+       0,   266,    79,   776,  1418,  1419,  1420,  1421,  1422,    80,
+    1423,  1424,  1425,     0,     0,     0,   777,   778,     0,     0,
+       0,    82,    83,     0,    70,    81,    71,    72,    73,     0,
+       0,     0,   779,     0,     0,   925,   265,   343,    88,     0,
+       0,     0,     0,    90,     0,    82,    83,     0,     0,     0,
+       0,    84,     0,     0,    80,     0,     0,     0,  1402,   344,
+     345,    87,    88,   780,     0,    89,   781,    90,     0,   782,
+     266,     0,   346,     0,     0,   235,   236,   237,   238,   239,
+     240,   241,   242,     0,     0,   783,     0,     0,   347,     0,
+      82,    83,   243,     0,     0,     0,     0,   784,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    88,     0,     0,
+       0,   785,    90,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1465,  1466,  1467,  1468,     0,  1471,  1472,  1114,
+    1115,  1116,  1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,
+       0,  1125,  1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,
+    1134,  1135,     0,     0,     0,     0,     0,     0,     0,  1136,
+    1137,  1138,  1139,  1140,  1141,  1142,  1143,  1144,  1145,  1146,
+    1147,  1148,  1149,  1150,  1151,  1152,  1153,  1154,     0,     0,
+    1155,  1156,  1157,  1158,  1159,  1160,  1161,  1162,  1163,  1164,
+    1165,  1166,  1167,  1168,  1169,     0,  1170,     0,  1171,  1172,
+    1173,  1174,  1175,  1176,  1177,  1178,  1179,  1366,  1180,  1181,
+    1182,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,     0,   255,   256,   257,  1183,     0,     0,  1531,
+       0,     0,     0,  1184,  1185,  1186,     0,  1187,  1188,  1189,
+    1190,  1191,  1192,  1193,  1194,  1195,  1196,  1197,  1198,  1199,
+    1200,  1201,  1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,
+    1210,  1211,  1212,  1213,  1214,  1215,  1216,  1217,  1218,  1219,
+       0,     0,     0,  1220,  1221,  1222,  1223,  1224,  1225,  1226,
+    1227,  1228,  1229,  1230,  1231,  1232,  1233,  1234,  1235,  1236,
+    1237,  1238,  1239,  1240,  1435,  1241,  1242,  1114,  1115,  1116,
+    1117,  1118,  1119,  1120,  1121,  1122,  1123,  1124,     0,  1125,
+    1126,  1127,  1128,  1129,  1130,  1131,  1132,  1133,  1134,  1135,
+       0,     0,     0,     0,     0,     0,     0,  1136,  1137,  1138,
+    1139,  1140,  1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,
+    1149,  1150,  1151,  1152,  1153,  1154,     0,     0,  1155,  1156,
+    1157,  1158,  1159,  1160,  1161,  1162,  1163,  1164,  1165,  1166,
+    1167,  1168,  1169,     0,  1170,     0,  1171,  1172,  1173,  1174,
+    1175,  1176,  1177,  1178,  1179,     0,  1180,  1181,  1182,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1183,  1524,     0,     0,     0,     0,
+       0,  1184,  1185,  1186,     0,  1187,  1188,  1189,  1190,  1191,
+    1192,  1193,  1194,  1195,  1196,  1197,  1198,  1199,  1200,  1201,
+    1202,  1203,  1204,  1205,  1206,  1207,  1208,  1209,  1210,  1211,
+    1212,  1213,  1214,  1215,  1216,  1217,  1218,  1219,     0,     0,
+       0,  1220,  1221,  1222,  1223,  1224,  1225,  1226,  1227,  1228,
+    1229,  1230,  1231,  1232,  1233,  1234,  1235,  1236,  1237,  1238,
+    1239,  1240,     0,  1241,  1242,     7,     8,     9,    10,     0,
+      11,    12,    13,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   235,   236,   237,   238,
+     239,   240,   241,   242,     0,     0,     0,     0,     0,     0,
+       0,     0,    15,   243,     0,     0,    16,     0,    17,    18,
+      19,     0,     0,     0,    20,     0,     0,     0,    21,    22,
+       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
+       0,     0,     0,    26,     0,     0,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,    44,     0,    45,     0,    46,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,    51,     0,     0,
+       0,     0,    52,     0,     0,    53,     0,     0,     0,    54,
+       7,     8,     9,    10,    55,    11,    12,    13,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+      57,    58,    59,     0,     0,    60,     0,    61,    62,   437,
+     594,    63,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,     0,   255,   256,   257,    15,   442,     0,
+       0,    16,     0,    17,    18,    19,     0,     0,     0,    20,
+       0,     0,     0,    21,    22,     0,     0,     0,     0,     0,
+       0,     0,    23,    24,    25,     0,     0,     0,    26,     0,
+       0,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,    44,     0,    45,     0,
+      46,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,    51,     0,     0,     0,     0,    52,     0,     0,
+      53,     0,     0,     0,    54,     7,     8,     9,    10,    55,
+      11,    12,    13,    14,     0,     0,     0,     0,     0,     0,
+       0,     0,    56,     0,     0,    57,    58,    59,     0,     0,
+      60,     0,    61,    62,     0,     0,    63,     0,     0,     0,
+     235,   236,   237,   238,   239,   240,   241,   242,     0,     0,
+       0,     0,    15,   721,     0,     0,    16,   243,    17,    18,
+      19,     0,     0,     0,    20,     0,     0,     0,    21,    22,
+       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
+       0,     0,     0,    26,     0,     0,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,    44,     0,    45,     0,    46,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,    51,     0,     0,
+       0,     0,    52,     0,     0,    53,     0,     0,     0,    54,
+       7,     8,     9,    10,    55,    11,    12,    13,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+      57,    58,    59,     0,     0,    60,     0,    61,    62,     0,
+       0,    63,     0,   938,     0,     0,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    15,   255,   256,
+     257,    16,     0,    17,    18,    19,     0,     0,     0,    20,
+       0,     0,     0,    21,    22,     0,     0,     0,     0,     0,
+       0,     0,    23,    24,    25,     0,     0,     0,    26,     0,
+       0,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,    44,     0,    45,     0,
+      46,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,    51,     0,     0,     0,     0,    52,     0,     0,
+      53,     0,     0,     0,    54,     7,     8,     9,    10,    55,
+      11,    12,    13,    14,   933,     0,     0,     0,     0,     0,
+       0,     0,    56,     0,     0,    57,    58,    59,     0,     0,
+      60,     0,    61,    62,     0,     0,    63,     0,     0,     0,
+     235,   236,   237,   238,   239,   240,   241,   242,     0,     0,
+       0,     0,    15,     0,     0,     0,    16,   243,    17,    18,
+      19,     0,     0,     0,    20,     0,     0,     0,    21,    22,
+       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
+       0,     0,     0,    26,     0,     0,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,    44,     0,    45,     0,    46,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,    51,     0,     0,
+       0,     0,    52,     0,     0,    53,     0,     0,     0,    54,
+       7,     8,     9,    10,    55,    11,    12,    13,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+      57,    58,    59,     0,     0,    60,     0,    61,    62,  1068,
+       0,    63,  1277,     0,     0,     0,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    15,   255,   256,
+     257,    16,     0,    17,    18,    19,     0,     0,     0,    20,
+       0,     0,     0,    21,    22,     0,     0,     0,     0,     0,
+       0,     0,    23,    24,    25,     0,     0,     0,    26,     0,
+       0,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,    44,     0,    45,     0,
+      46,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,    51,     0,     0,     0,     0,    52,     0,     0,
+      53,     0,     0,     0,    54,     7,     8,     9,    10,    55,
+      11,    12,    13,    14,  1345,     0,     0,     0,     0,     0,
+       0,     0,    56,     0,     0,    57,    58,    59,     0,     0,
+      60,     0,    61,    62,     0,     0,    63,     0,     0,     0,
+     235,   236,   237,   238,   239,   240,   241,   242,     0,     0,
+       0,     0,    15,     0,     0,     0,    16,   243,    17,    18,
+      19,     0,     0,     0,    20,     0,     0,     0,    21,    22,
+       0,     0,     0,     0,     0,     0,     0,    23,    24,    25,
+       0,     0,     0,    26,     0,     0,    27,    28,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    42,    43,     0,     0,     0,     0,     0,     0,     0,
+       0,    44,     0,    45,     0,    46,     0,     0,     0,     0,
+      47,     0,    48,    49,    50,     0,     0,    51,     0,     0,
+       0,     0,    52,     0,     0,    53,     0,     0,     0,    54,
+       7,     8,     9,    10,    55,    11,    12,    13,    14,     0,
+       0,     0,     0,     0,     0,     0,     0,    56,     0,     0,
+      57,    58,    59,     0,     0,    60,     0,    61,    62,  1494,
+       0,    63,     0,     0,  1300,     0,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,    15,   255,   256,
+     257,    16,     0,    17,    18,    19,     0,     0,     0,    20,
+       0,     0,     0,    21,    22,     0,     0,     0,     0,     0,
+       0,     0,    23,    24,    25,     0,     0,     0,    26,     0,
+       0,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,     0,     0,
+       0,     0,     0,     0,     0,     0,    44,     0,    45,     0,
+      46,     0,     0,     0,     0,    47,     0,    48,    49,    50,
+       0,     0,    51,     0,     0,     0,     0,    52,     0,     0,
+      53,     0,     0,     0,    54,   652,   653,   654,    10,    55,
+      11,   655,   656,    67,    68,     0,     0,   657,     0,     0,
+       0,     0,    56,     0,     0,    57,    58,    59,     0,     0,
+      60,     0,    61,    62,     0,     0,    63,   235,   236,   237,
+     238,   239,   240,   241,   242,     0,     0,     0,     0,   464,
+       0,     0,   658,    69,   243,     0,    70,     0,    71,    72,
+      73,    74,   465,     0,   659,    76,     0,     0,    77,   660,
+       0,     0,    78,     0,     0,     0,     0,   661,   662,    79,
+       0,     0,     0,     0,     0,     0,    80,     0,     0,     0,
+       0,     0,   235,   236,   237,   238,   239,   240,   241,   242,
+       0,     0,    81,     0,     0,     0,     0,     0,     0,   243,
+       0,   663,     0,   664,     0,   665,     0,     0,     0,   466,
+     666,     0,    82,    83,   667,     0,     0,   668,    84,     0,
+       0,     0,   669,     0,     0,   670,    85,    86,    87,    88,
+       0,     0,    89,     0,    90,     0,   652,   653,   654,    10,
+       0,    11,   655,   656,    67,    68,     0,   671,  1045,     0,
+     672,   673,     0,     0,     0,   674,     0,   675,     0,   697,
+       0,   676,     0,   244,   245,   246,   247,   248,   249,   250,
+     251,   252,   253,   254,     0,   255,   256,   257,   698,     0,
+     464,     0,     0,   658,    69,     0,     0,    70,     0,    71,
+      72,    73,    74,   465,     0,   659,    76,     0,     0,    77,
+     660,     0,     0,    78,     0,     0,     0,     0,   661,   662,
+      79,     0,     0,   774,     0,     0,     0,    80,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,     0,
+     255,   256,   257,    81,     0,     0,     0,     0,     0,     0,
+       0,     0,   663,   776,   664,     0,   665,     0,     0,     0,
+     466,   666,     0,    82,    83,   667,   777,   778,   668,    84,
+       0,     0,     0,   669,     0,     0,   670,    85,    86,    87,
+      88,     0,   779,    89,     0,    90,     7,     8,     9,    10,
+       0,    11,    12,    13,     0,     0,     0,     0,   671,     0,
+       0,   672,   673,     0,     0,     0,   674,     0,   675,     0,
+       0,     0,   676,   780,     0,     0,   781,     0,     0,   782,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1315,     0,   783,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1316,     0,   784,     0,     0,
+    1317,  1406,  1407,  1408,  1409,  1410,  1411,  1412,    23,    24,
+       0,   785,     0,     0,    26,     0,     0,  1413,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,   235,   236,   237,   238,   239,   240,   241,
+     242,     0,     0,     0,    45,     0,    46,     0,     0,     0,
+     243,  1318,     0,     0,     0,  1319,     0,     0,  1320,     0,
+       0,     0,     0,    52,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1321,     0,
+       0,  1322,  1323,  1324,   942,     0,  1325,     0,  1326,    62,
+       0,     0,  1327,     0,   943,   944,   945,   946,   947,   948,
+     949,   950,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   951,     0,   952,   953,   954,   955,   956,   957,   958,
+     959,   960,   961,   962,   963,     0,     0,  1415,  1416,  1417,
+       0,     0,  1418,  1419,  1420,  1421,  1422,     0,  1423,  1424,
+    1425,     0,     0,   964,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   339,   340,     0,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+       0,   255,   256,   257,   582,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   965,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   341,     0,     0,
+      70,     0,    71,    72,    73,    74,     0,     0,     0,   342,
+       0,     0,    77,     0,     0,     0,    78,     0,     0,     0,
+       0,     0,     0,    79,     0,     0,   966,     0,     0,   967,
+      80,   968,   969,   970,   971,   972,   973,   974,   975,   976,
+     977,   978,     0,   979,   980,     0,    81,   981,   513,   514,
+       0,     0,     0,     0,     0,     0,     0,     0,   343,     0,
+       0,     0,     0,     0,     0,     0,    82,    83,     0,     0,
+       0,     0,    84,     0,     0,     0,     0,     0,     0,     0,
+     344,   345,    87,    88,     0,     0,    89,     0,    90,   341,
+       0,     0,    70,     0,    71,    72,    73,    74,     0,     0,
+       0,   342,     0,     0,    77,     0,     0,     0,    78,   347,
+       0,     0,     0,     0,     0,    79,     0,     0,     0,     0,
+       0,     0,    80,   235,   236,   237,   238,   239,   240,   241,
+     242,     0,     0,     0,     0,     0,     0,     0,    81,     0,
+     243,     0,     0,     0,     0,   216,   217,   218,     0,     0,
+     343,     0,     0,     0,     0,     0,     0,     0,    82,    83,
+       0,     0,     0,     0,    84,     0,     0,     0,     0,     0,
+       0,     0,   344,   345,    87,    88,     0,     0,    89,     0,
+      90,   235,   236,   237,   238,   239,   240,   241,   242,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   243,   219,
+       0,   347,   235,   236,   237,   238,   239,   240,   241,   242,
+       0,   220,   221,     0,     0,     0,     0,     0,     0,   243,
+     235,   236,   237,   238,   239,   240,   241,   242,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   243,   235,   236,
+     237,   238,   239,   240,   241,   242,     0,     0,   222,   223,
+       0,   224,     0,     0,     0,   243,   225,     0,   226,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+       0,   255,   256,   257,   598,   235,   236,   237,   238,   239,
+     240,   241,   242,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   243,   851,   852,   853,   854,   855,   856,   857,
+     858,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     859,     0,     0,     0,     0,     0,     0,   244,   245,   246,
+     247,   248,   249,   250,   251,   252,   253,   254,     0,   255,
+     256,   257,   686,     0,     0,     0,     0,     0,   244,   245,
+     246,   247,   248,   249,   250,   251,   252,   253,   254,     0,
+     255,   256,   257,   766,     0,     0,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,     0,   255,   256,
+     257,   909,     0,     0,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,     0,   255,   256,   257,  1026,
+    1405,  1406,  1407,  1408,  1409,  1410,  1411,  1412,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,  1413,     0,     0,
+       0,   244,   245,   246,   247,   248,   249,   250,   251,   252,
+     253,   254,     0,   255,   256,   257,  1298,     0,     0,   860,
+     861,   862,   863,   864,   865,   866,   867,   868,   869,   870,
+       0,   871,   872,   873,  1405,  1406,  1407,  1408,  1409,  1410,
+    1411,  1412,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1413,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    -2,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     237,   238,   239,   240,   241,   242,     0,     0,     0,     0,
+       0,     0,     0,     0,  1529,   243,  1414,  1415,  1416,  1417,
+       0,     0,  1418,  1419,  1420,  1421,  1422,     0,  1423,  1424,
+    1425,   105,     0,   106,     0,     0,   107,   108,     0,     0,
+       0,     0,     0,     0,   109,   110,   237,   238,   239,   240,
+     241,   242,     0,   111,     0,   112,   113,   114,   115,     0,
+       0,   243,   116,     0,     0,     0,     0,   117,     0,     0,
+    1414,  1415,  1416,  1417,     0,     0,  1418,  1419,  1420,  1421,
+    1422,     0,  1423,  1424,  1425,   118,   119,   120,   121,   122,
+     123,   124,   125,     0,     0,     0,     0,     0,   126,   127,
+     128,   129,     0,     0,     0,     0,     0,   130,   131,    67,
+      68,   132,   133,   462,     0,   463,   134,     0,     0,     0,
+       0,     0,   135,   136,     0,   137,     0,     0,     0,     0,
+       0,     0,     0,   138,     0,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   464,   255,   256,   257,    69,
+       0,     0,    70,     0,    71,    72,    73,    74,   465,     0,
+       0,    76,     0,     0,    77,     0,     0,     0,    78,     0,
+       0,     0,     0,     0,     0,    79,  1407,  1408,  1409,  1410,
+    1411,  1412,    80,   247,   248,   249,   250,   251,   252,   253,
+     254,  1413,   255,   256,   257,   216,   217,   218,    81,   237,
+     238,   239,   240,   241,   242,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   243,   466,     0,     0,    82,    83,
+       0,     0,     0,     0,    84,     0,  1407,  1408,  1409,  1410,
+    1411,  1412,    85,    86,    87,    88,     0,     0,    89,     0,
+      90,  1413,  1407,  1408,  1409,  1410,  1411,  1412,     0,   219,
+       0,     0,     0,   467,     0,     0,     0,  1413,   468,     0,
+       0,   220,   221,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     483,   484,   485,   335,     0,     0,     0,     0,   222,   223,
+       0,   224,     0,     0,     0,     0,   225,     0,   226,     0,
+       0,  1415,  1416,  1417,     0,     0,  1418,  1419,  1420,  1421,
+    1422,     0,  1423,  1424,  1425,     0,     0,   486,     0,   487,
+       0,     0,     0,     0,     0,     0,     0,   248,   249,   250,
+     251,   252,   253,   254,   219,   255,   256,   257,     0,     0,
+       0,     0,     0,     0,     0,     0,   220,   221,     0,   305,
+       0,     0,  1416,  1417,     0,     0,  1418,  1419,  1420,  1421,
+    1422,     0,  1423,  1424,  1425,     0,   305,     0,     0,  1417,
+       0,     0,  1418,  1419,  1420,  1421,  1422,     0,  1423,  1424,
+    1425,     0,     0,   488,   223,     0,   224,     0,     0,     0,
+     105,   225,   106,   226,     0,     0,   108,     0,     0,     0,
+       0,     0,     0,   109,   110,     0,     0,   105,    70,   106,
+      71,    72,    73,   108,   112,   113,   114,   489,     0,     0,
+     109,   110,     0,     0,     0,     0,   300,     0,     0,     0,
+       0,   112,   299,   114,     0,     0,     0,     0,    80,     0,
+       0,     0,     0,   300,   216,   217,   218,     0,     0,     0,
+     124,     0,     0,     0,   266,     0,   399,    67,    68,     0,
+     129,     0,     0,     0,     0,     0,   130,   124,     0,     0,
+     132,   133,     0,     0,    82,    83,     0,   129,     0,     0,
+       0,     0,   136,   130,   137,  1038,    67,    68,   133,     0,
+       0,    88,     0,     0,     0,     0,    90,    69,   219,   136,
+      70,   137,    71,    72,    73,    74,    75,     0,     0,    76,
+     220,   221,    77,     0,     0,     0,    78,     0,     0,   187,
+       0,     0,     0,    79,     0,     0,    69,     0,     0,    70,
+      80,    71,    72,    73,    74,    75,     0,     0,    76,     0,
+       0,    77,     0,     0,     0,    78,    81,   222,  1278,  1279,
+    1280,     0,    79,     0,     0,   225,     0,   226,     0,    80,
+       0,     0,     0,     0,     0,     0,    82,    83,  1281,     0,
+       0,     0,    84,  1282,     0,    81,     0,  1470,    67,    68,
+      85,    86,    87,    88,     0,     0,    89,     0,    90,     0,
+       0,     0,     0,     0,     0,    82,    83,     0,     0,     0,
+       0,    84,     0,     0,     0,     0,   699,   700,   701,    85,
+      86,    87,    88,     0,     0,    89,     0,    90,    69,     0,
+       0,    70,     0,    71,    72,    73,    74,    75,     0,     0,
+      76,     0,     0,    77,     0,     0,     0,    78,   699,   700,
+     701,     0,     0,     0,    79,     0,     0,     0,     0,     0,
+      70,    80,    71,    72,    73,   702,   703,     0,     0,     0,
+       0,     0,    77,     0,     0,     0,     0,    81,     0,     0,
+       0,     0,     0,    79,     0,     0,     0,     0,     0,     0,
+      80,     0,    70,     0,    71,    72,    73,    82,    83,     0,
+       0,     0,     0,    84,    77,     0,    81,     0,     0,     0,
+       0,    85,    86,    87,    88,    79,     0,    89,     0,    90,
+       0,     0,    80,     0,    67,    68,    82,    83,   462,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    81,     0,
+     704,     0,     0,    88,     0,     0,    89,     0,    90,     0,
+       0,     0,     0,    67,    68,     0,     0,   800,    82,    83,
+     464,     0,     0,     0,    69,     0,     0,    70,     0,    71,
+      72,    73,    74,   465,     0,    88,    76,     0,    89,    77,
+      90,     0,     0,    78,     0,     0,     0,     0,     0,   464,
+      79,     0,     0,    69,     0,     0,    70,    80,    71,    72,
+      73,    74,   465,     0,     0,    76,     0,     0,    77,     0,
+       0,     0,    78,    81,     0,     0,     0,     0,     0,    79,
+       0,     0,     0,     0,     0,     0,    80,     0,     0,     0,
+     466,     0,     0,    82,    83,   216,   217,   218,     0,    84,
+       0,     0,    81,     0,     0,    67,    68,    85,    86,    87,
+      88,     0,     0,    89,     0,    90,     0,     0,     0,   466,
+       0,     0,    82,    83,     0,     0,     0,     0,    84,    70,
+       0,    71,    72,    73,    67,    68,    85,    86,    87,    88,
+       0,   464,    89,     0,    90,    69,     0,     0,    70,   219,
+      71,    72,    73,    74,   465,     0,     0,    76,     0,    80,
+      77,   220,   221,     0,    78,     0,     0,     0,     0,     0,
+       0,    79,     0,     0,    69,   266,     0,    70,    80,    71,
+      72,    73,    74,    75,     0,     0,    76,     0,     0,    77,
+       0,     0,     0,    78,    81,    82,    83,     0,   222,   223,
+      79,   224,     0,     0,     0,     0,   225,    80,   226,     0,
+       0,   466,    88,     0,    82,    83,     0,    90,     0,  1281,
+      84,    67,    68,    81,  1360,     0,     0,     0,    85,    86,
+      87,    88,     0,     0,    89,     0,    90,     0,     0,     0,
+     188,     0,     0,    82,    83,    67,    68,     0,     0,    84,
+       0,     0,     0,     0,     0,     0,     0,    85,    86,    87,
+      88,    69,     0,    89,    70,    90,    71,    72,    73,    74,
+       0,     0,     0,    76,     0,     0,    77,     0,     0,     0,
+      78,     0,     0,     0,     0,    69,     0,    79,    70,     0,
+      71,    72,    73,    74,    80,     0,     0,    76,     0,     0,
+      77,     0,     0,     0,    78,     0,     0,     0,     0,     0,
+      81,    79,     0,     0,     0,     0,     0,     0,    80,   216,
+     217,   218,     0,     0,     0,     0,     0,   611,     0,     0,
+      82,    83,    67,     0,    81,     0,    84,     0,     0,     0,
+       0,     0,     0,     0,    85,    86,    87,    88,     0,     0,
+      89,     0,    90,     0,    82,    83,     0,     0,     0,     0,
+      84,   177,     0,     0,     0,     0,     0,     0,    85,    86,
+      87,    88,    69,   219,    89,    70,    90,    71,    72,    73,
+      74,   524,     0,     0,    76,   220,   221,    77,     0,     0,
+       0,    78,     0,     0,     0,     0,     0,     0,    79,     0,
+       0,   178,     0,     0,    70,    80,    71,    72,    73,    74,
+    1003,     0,     0,   179,     0,     0,    77,     0,     0,     0,
+      78,    81,   222,   223,     0,   224,     0,    79,     0,     0,
+     225,     0,   226,     0,    80,     0,     0,     0,     0,     0,
+       0,    82,    83,  1281,     0,     0,     0,    84,   177,     0,
+      81,     0,     0,     0,     0,    85,    86,    87,    88,     0,
+       0,    89,     0,    90,     0,     0,     0,     0,     0,     0,
+      82,    83,    67,     0,     0,     0,    84,     0,     0,     0,
+     216,   217,   218,     0,   180,   181,    87,    88,   178,     0,
+      89,    70,    90,    71,    72,    73,    74,     0,     0,     0,
+     179,     0,    70,    77,    71,    72,    73,    78,     0,     0,
+       0,     0,    69,     0,    79,    70,     0,    71,    72,    73,
+      74,    80,     0,     0,    76,     0,     0,    77,     0,     0,
+       0,    78,    80,     0,   219,     0,     0,    81,    79,     0,
+     216,   217,   218,     0,     0,    80,   220,   221,   266,     0,
+       0,     0,     0,     0,   216,   217,   218,    82,    83,     0,
+       0,    81,     0,    84,     0,     0,     0,     0,    82,    83,
+       0,   180,   181,    87,    88,     0,     0,    89,     0,    90,
+       0,    82,    83,   222,   223,    88,   224,    84,     0,     0,
+      90,   225,     0,   226,   219,    85,    86,    87,    88,     0,
+       0,    89,     0,    90,  1281,     0,   220,   221,   219,  1362,
+       0,     0,     0,   193,     0,     0,     0,     0,     0,     0,
+     220,   221,     0,     0,     0,     0,     0,     0,     0,    70,
+       0,    71,    72,    73,     0,     0,     0,     0,     0,     0,
+       0,   265,     0,   222,   223,     0,   224,     0,     0,     0,
+       0,   225,     0,   226,     0,     0,     0,   222,   223,    80,
+     224,     0,     0,     0,  1281,   225,   105,   226,   106,  1364,
+       0,   107,   108,     0,     0,   266,     0,     0,     0,   109,
+     110,     0,   294,     0,     0,     0,     0,     0,   111,     0,
+     112,   113,   114,   115,     0,    82,    83,   116,     0,     0,
+       0,     0,   117,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    88,     0,     0,     0,     0,    90,     0,     0,
+     118,   119,   120,   121,   122,   123,   124,   125,     0,     0,
+       0,     0,     0,   126,   127,   128,   129,     0,     0,   105,
+     176,   106,   130,   131,   107,   108,   132,   133,     0,     0,
+       0,   134,   109,   110,     0,     0,     0,   135,   136,     0,
+     137,   111,     0,   112,   113,   114,   115,     0,   138,     0,
+     116,     0,     0,     0,     0,   117,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   695,     0,     0,
+       0,     0,     0,   118,   119,   120,   121,   122,   123,   124,
+     125,     0,     0,     0,     0,     0,   126,   127,   128,   129,
+       0,     0,   105,     0,   106,   130,   131,   107,   108,   132,
+     133,     0,     0,     0,   134,   109,   110,     0,     0,     0,
+     135,   136,     0,   137,   111,     0,   112,   113,   114,   115,
+       0,   138,     0,   116,     0,     0,     0,     0,   117,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     876,     0,     0,     0,     0,     0,   118,   119,   120,   121,
+     122,   123,   124,   125,     0,     0,     0,     0,     0,   126,
+     127,   128,   129,     0,     0,   105,     0,   106,   130,   131,
+     107,   108,   132,   133,     0,     0,     0,   134,   109,   110,
+       0,     0,     0,   135,   136,     0,   137,   111,     0,   112,
+     113,   114,   115,     0,   138,     0,   116,     0,     0,     0,
+       0,   117,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   920,     0,     0,     0,     0,     0,   118,
+     119,   120,   121,   122,   123,   124,   125,     0,     0,     0,
+       0,     0,   126,   127,   128,   129,     0,     0,   105,     0,
+     106,   130,   131,   107,   108,   132,   133,     0,     0,     0,
+     134,   109,   110,     0,     0,     0,   135,   136,     0,   137,
+     111,     0,   112,   113,   114,   115,     0,   138,     0,   116,
+       0,     0,     0,     0,   117,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  1027,     0,     0,     0,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+       0,     0,     0,     0,     0,   126,   127,   128,   129,     0,
+       0,   105,     0,   106,   130,   131,   107,   108,   132,   133,
+       0,     0,     0,   134,   109,   110,     0,     0,     0,   135,
+     136,     0,   137,   111,     0,   112,   113,   114,   115,     0,
+     138,     0,   116,     0,     0,     0,     0,   117,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1081,
+       0,     0,     0,     0,     0,   118,   119,   120,   121,   122,
+     123,   124,   125,     0,     0,     0,     0,     0,   126,   127,
+     128,   129,     0,     0,   105,     0,   106,   130,   131,   107,
+     108,   132,   133,     0,     0,     0,   134,   109,   110,     0,
+       0,     0,   135,   136,     0,   137,   111,     0,   112,   113,
+     114,   115,     0,   138,     0,   116,     0,     0,     0,     0,
+     117,     0,     0,   216,   217,   218,     0,     0,   890,   216,
+     217,   218,  1303,     0,     0,     0,     0,     0,   118,   119,
+     120,   121,   122,   123,   124,   125,     0,     0,     0,     0,
+       0,   126,   127,   128,   129,     0,     0,     0,     0,     0,
+     130,   131,     0,     0,   132,   133,   486,     0,   487,   134,
+       0,     0,     0,     0,     0,   135,   136,   219,   137,     0,
+       0,     0,     0,   219,     0,   105,   138,   106,     0,   220,
+     221,   108,     0,     0,     0,   220,   221,     0,   109,   110,
+       0,     0,     0,     0,     0,  1451,     0,     0,     0,   112,
+     299,   114,     0,     0,     0,     0,   116,     0,     0,     0,
+       0,   300,     0,     0,     0,     0,   222,   223,     0,   224,
+       0,     0,   222,   223,   225,   224,   226,     0,     0,     0,
+     225,     0,   226,     0,     0,   124,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   129,     0,     0,     0,     0,
+       0,   130,     0,     0,     0,     0,   133,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   105,   137,
+     106,     0,     0,   107,   108,     0,     0,     0,     0,     0,
+       0,   109,   110,     0,  -153,     0,     0,     0,     0,     0,
+     111,     0,   112,   113,   114,   115,     0,     0,     0,   116,
+       0,     0,     0,     0,   117,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   118,   119,   120,   121,   122,   123,   124,   125,
+       0,     0,     0,     0,     0,   126,   127,   128,   129,     0,
+       0,   105,     0,   106,   130,   131,     0,   108,   132,   133,
+       0,     0,     0,   134,   109,   110,     0,     0,     0,   135,
+     136,     0,   137,     0,     0,   112,   113,   114,   105,     0,
+     106,     0,   116,     0,   108,     0,     0,   300,     0,     0,
+       0,   109,   110,   105,     0,   106,     0,     0,     0,   108,
+       0,     0,   112,   299,   114,     0,   109,   110,     0,     0,
+       0,   124,     0,     0,   300,     0,     0,   112,   299,   114,
+       0,   129,     0,     0,     0,     0,     0,   130,     0,   300,
+       0,   132,   133,     0,     0,     0,     0,     0,   124,   311,
+       0,     0,   135,   136,     0,   137,     0,     0,   129,     0,
+       0,     0,     0,   124,   130,     0,     0,     0,     0,   133,
+       0,     0,     0,   129,     0,     0,     0,     0,     0,   130,
+     136,     0,   137,     0,   133,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   136,     0,   137
+};
+
+static const yytype_int16 yycheck[] =
+{
+       1,    61,   113,   495,   132,   515,   132,   320,   933,   617,
+      92,   714,    44,   149,   590,   151,   152,   153,   154,   298,
+     156,   736,   158,   663,   160,   184,    44,   482,   756,     6,
+      15,     8,    44,   142,   464,    15,    59,    98,   466,     0,
+     176,    33,    81,    82,    83,   166,   167,   608,   142,    88,
+      15,   187,   188,    15,   333,   142,   486,   193,   194,    13,
+      76,    62,    76,   148,   494,    75,   165,   495,    15,    15,
+     148,   799,    76,   148,   148,   723,   589,   725,   726,   727,
+     728,   729,   148,   719,   147,   170,   149,   156,   151,   167,
+      91,    92,   167,   167,   151,   165,   148,    75,    99,   151,
+     148,   167,   165,   126,   148,    10,    11,    12,   148,   166,
+     142,   147,   748,   749,   627,   751,   752,   753,   754,   167,
+     148,    33,   147,   167,   142,   638,   148,   167,   165,   165,
+     142,   147,   165,   147,   150,   775,   150,   166,   167,   167,
+     165,   717,   148,   147,   720,   167,   150,   148,   149,   148,
+     151,   152,   153,   154,   165,   156,    33,   158,   150,   160,
+     165,   167,   148,    13,     6,    15,     8,    17,   167,   208,
+     209,   210,   211,   165,   166,   176,   166,   167,   260,   261,
+     156,   167,   167,   184,   165,   165,   187,   188,   501,   298,
+     167,   619,   193,   194,   276,   277,   256,   356,   165,    33,
+     165,   148,   148,   165,   298,   697,   160,   148,   113,   165,
+      60,   298,   108,   109,   110,   528,   112,   113,   114,    76,
+     329,   117,   165,   149,   333,   151,   167,   266,   124,   165,
+     231,   292,   165,   129,   130,   329,   132,   133,   134,   333,
+     136,   137,   329,   165,   757,   150,   333,   757,   809,   148,
+     151,   290,   164,   165,   166,   473,   392,   165,   819,   260,
+     261,   165,   148,   911,   156,   166,   298,   165,   167,   905,
+     280,    10,    11,    12,   275,   276,   277,   278,   279,   280,
+     298,   167,   795,   796,   285,   151,   298,   164,   165,   166,
+     147,   141,  1007,   150,   355,   148,     6,   329,     8,   147,
+     166,   333,   280,   939,   759,   155,   144,   145,   146,   165,
+     160,   329,    64,    65,   167,   333,   148,   329,    13,   320,
+      15,   333,    17,   148,   148,    64,   160,   161,   162,   148,
+     164,   165,   166,   343,   647,   167,   165,    76,    77,   165,
+     148,   148,   167,   167,   165,   921,   776,   148,   167,   147,
+     165,   149,   150,   151,   148,   356,   165,   918,   850,   167,
+     167,   148,   165,  1003,   792,    60,   167,   646,   275,   276,
+     277,   278,   279,   167,   113,   114,   165,   116,   166,   167,
+     167,   165,   121,   696,   123,   165,   147,   165,   149,   902,
+     151,   392,   902,  1108,  1002,   613,   147,   147,   149,   149,
+     151,   151,   156,   299,   300,   165,   166,   167,   165,   305,
+     165,   412,   165,   166,   167,   633,   634,   635,   636,   637,
+    1345,   165,   850,    10,    11,    12,    13,   166,   989,   165,
+      17,   165,   166,  1009,   165,   166,   167,   165,    33,  1015,
+    1016,   166,   167,   482,   445,   165,   141,   150,   449,   450,
+     451,   452,   453,   165,   166,   465,   466,   114,   115,   116,
+     155,   165,   463,   165,   525,   160,   467,   468,   147,   148,
+     165,   472,   165,    60,   475,   536,   165,   166,   539,   165,
+     512,    10,    11,    12,   165,   495,   150,   465,   466,   165,
+    1098,   709,   150,  1101,   495,   150,   165,   165,  1011,  1012,
+     501,   167,   165,   165,   165,    10,    11,    12,    13,   151,
+      15,   512,    17,   160,   524,   166,   166,   495,   150,   148,
+      48,   165,   147,   156,   525,   112,   113,   528,  1104,   165,
+     165,   165,   149,  1261,   148,    64,   167,   646,   445,    15,
+     168,   167,   449,   450,   451,   452,   453,    76,    77,   167,
+     157,   167,   646,   157,   141,    60,   463,   167,   167,   646,
+     467,   468,   167,   148,   877,   160,   161,   162,   155,   164,
+     165,   166,   148,   160,   167,   167,   794,   167,   165,   167,
+     590,   167,   157,   167,   113,   114,   167,   116,   589,   590,
+     591,   157,   121,   811,   123,   167,   167,   493,   167,   167,
+     601,   611,   167,   167,   167,   167,   167,   608,   113,   619,
+     167,   612,   590,   167,   646,   675,   617,   167,   167,   167,
+     621,   622,   623,   624,   625,   626,   627,  1330,   646,   167,
+     167,   663,   165,   611,   646,   167,   141,   638,   167,   160,
+     167,   619,   166,   166,   150,   663,   647,   648,   167,   167,
+     155,   663,   168,   714,   165,   160,   147,   165,   719,   148,
+     165,   148,   723,   148,   725,   726,   727,   728,   729,   887,
+     148,   703,   149,   148,   148,   165,   894,   895,   896,   897,
+     898,   150,    10,    11,    12,    13,   165,   748,   749,    17,
+     751,   752,   753,   754,   601,   696,   167,  1273,   165,  1275,
+     165,   761,   762,   167,   167,   165,    48,   717,   709,   769,
+     720,   771,  1440,  1441,  1442,   160,   717,     2,   160,   720,
+     759,   170,   723,  1438,   725,   726,   727,   728,   729,   147,
+    1338,    48,    60,    13,   165,    15,    76,    17,   165,   717,
+     156,   742,   720,   775,   745,   156,   156,  1355,  1356,  1357,
+     156,    10,   167,    10,    10,   756,   757,   775,    10,  1335,
+     888,  1253,   888,   775,    10,    10,   149,   157,   148,   160,
+     149,    56,    57,    58,    59,    60,   160,   888,    63,   167,
+      60,   167,   792,   168,   472,   113,   149,   149,   160,   685,
+     686,   167,   793,   167,   795,   796,   167,   167,   799,   165,
+     147,   802,    10,    11,    12,   170,   165,   165,   809,   165,
+     167,   166,   872,   141,   792,   166,   166,  1093,   819,   150,
+     165,  1549,  1430,   167,   165,  1253,   148,   155,   829,  1437,
+    1558,   151,   160,   148,   148,  1443,  1444,   165,   148,   148,
+     850,   160,   167,   167,   905,   166,   149,   149,   148,    10,
+     911,   167,  1428,     4,   148,   168,    64,   889,   170,    48,
+     168,   141,   148,   170,   165,   170,   165,   157,    76,    77,
+     147,   167,   850,   157,  1092,   155,   877,    10,   939,   880,
+     160,   157,   157,    10,   167,   165,   887,   149,   167,   167,
+      10,  1499,   893,   894,   895,   896,   897,   898,   899,  1035,
+     167,   902,    10,    10,    10,   113,   114,   192,   116,   149,
+     911,   921,   148,   121,   165,   123,   170,   918,   167,   167,
+     921,  1497,  1004,   170,   612,  1533,    10,    11,    12,    13,
+      22,    23,   933,    17,   622,   623,   624,   625,   626,   168,
+    1548,    33,   150,   921,   168,   167,   167,    15,   165,   165,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,  1003,   257,  1286,  1110,  1111,    60,   262,   165,   167,
+     165,   167,   148,   167,   149,  1003,   167,   165,   989,   156,
+     165,  1003,   888,   156,   156,   167,   156,   168,   168,  1009,
+     147,  1002,    10,  1004,   149,  1015,  1016,   149,  1009,   167,
+    1011,  1012,   167,   298,  1015,  1016,    10,   167,   167,   167,
+      10,   709,    10,   149,   149,   149,   165,   167,    15,   113,
+     167,  1009,   168,   148,  1035,   167,   148,  1015,  1016,   167,
+     157,   157,   327,   157,   167,  1321,  1322,  1323,  1324,  1325,
+     168,  1327,   157,    10,   167,   149,   167,   141,   167,    10,
+      10,   149,   165,    61,   165,   165,   158,   159,   160,   161,
+     162,   155,   164,   165,   166,   149,   160,   167,   165,   149,
+      10,   167,  1083,   149,    18,    19,    20,    21,    22,    23,
+     167,  1092,   167,   149,  1104,   310,  1109,  1098,   649,    33,
+    1101,  1256,  1330,  1104,   389,   793,   333,   889,  1457,  1110,
+    1111,  1253,   703,  1083,   802,   850,  1287,  1220,   411,   333,
+      -1,   406,   407,    -1,    -1,    -1,  1104,    -1,   413,  1405,
+    1406,  1407,  1408,  1409,  1410,  1411,  1412,  1413,  1414,  1415,
+    1416,  1417,  1418,  1419,  1420,  1421,  1422,  1423,    -1,    -1,
+      -1,    -1,   150,    -1,    -1,    -1,    -1,   155,    -1,   157,
+      -1,   159,    -1,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,    -1,    -1,
+    1262,    -1,    -1,    10,    11,    12,    -1,    -1,   186,    -1,
+     475,    -1,   190,   191,   192,  1256,    -1,  1473,    -1,   887,
+      -1,    20,    21,    22,    23,    -1,   894,   895,   896,   897,
+     898,    -1,    -1,    -1,    33,    -1,    10,    11,    12,  1220,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,    -1,
+     164,   165,   166,    -1,    -1,    -1,    -1,    64,   523,    -1,
+      -1,    -1,    -1,  1253,    -1,    -1,    -1,    -1,   533,    76,
+      77,    -1,  1253,  1529,    -1,    -1,    -1,    -1,    62,    -1,
+    1261,  1262,    -1,  1273,    -1,  1275,  1326,    -1,    -1,  1330,
+      64,    -1,  1273,   271,  1275,  1253,    -1,    -1,    -1,    -1,
+      -1,    85,    76,    77,    -1,  1286,   113,   114,    -1,   116,
+      -1,  1278,  1279,  1280,   121,  1273,   123,  1275,    -1,    -1,
+      -1,   105,    -1,    -1,    10,    11,    12,    -1,    -1,   594,
+      -1,    -1,    -1,  1373,  1374,    -1,  1376,    -1,  1378,   113,
+     114,   125,   116,   608,   151,  1335,    -1,   121,   155,   123,
+      -1,   135,    -1,   160,  1335,    -1,    -1,  1338,    -1,   158,
+     159,   160,   161,   162,  1345,   164,   165,   166,    -1,    11,
+      -1,    -1,    -1,   147,  1355,  1356,  1357,  1335,    64,    -1,
+      -1,   646,    -1,    -1,  1424,    10,    11,    12,    -1,    -1,
+      76,    77,    -1,  1360,    -1,  1362,   180,  1364,    -1,   183,
+    1367,  1368,  1369,    -1,    -1,    -1,   671,   672,   673,   674,
+      -1,   676,    54,   391,    56,    57,    58,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  1092,    -1,    -1,   113,   114,    -1,
+     116,    -1,    -1,    -1,    -1,   121,    -1,   123,  1428,    64,
+      -1,    -1,    84,    -1,   228,   229,    -1,  1428,    -1,  1430,
+      -1,    76,    77,    -1,    -1,    -1,  1437,    -1,   100,  1440,
+    1441,  1442,  1443,  1444,    -1,    -1,    -1,    -1,    -1,   155,
+    1428,    -1,    -1,    -1,   160,    -1,  1457,    -1,   120,   121,
+     745,    17,    18,    19,    20,    21,    22,    23,   113,   114,
+     274,   116,    -1,    -1,    -1,   137,   121,    33,   123,    -1,
+     142,    -1,  1542,  1543,  1544,    -1,  1546,  1497,   292,    -1,
+     294,    -1,    -1,    -1,    -1,    -1,  1497,    -1,  1499,    -1,
+      -1,    -1,   147,    -1,    -1,    -1,    -1,   311,    -1,   313,
+     314,   315,   316,   317,   318,    -1,    -1,    -1,    -1,  1497,
+      -1,    -1,   520,    -1,   809,    -1,    -1,    -1,    -1,   527,
+      -1,   335,  1533,    -1,   819,    -1,    -1,    -1,   823,    -1,
+     344,    -1,    -1,   347,    -1,    -1,    -1,  1548,  1549,    -1,
+      -1,   355,    -1,    -1,    -1,   840,   554,  1558,   556,    -1,
+     558,    -1,    -1,    -1,    -1,    -1,   851,   852,   853,   854,
+     855,   856,   857,   858,   859,   860,   861,   862,   863,   864,
+     865,   866,   867,   868,   869,   870,   871,    -1,   873,    -1,
+     394,    -1,    -1,    -1,   398,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   411,   164,   165,
+     166,    16,    17,    18,    19,    20,    21,    22,    23,    -1,
+      -1,    -1,    -1,  1321,  1322,  1323,  1324,  1325,    33,  1327,
+      22,    23,    -1,   918,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,   448,    -1,    -1,    -1,   933,    20,
+      21,    22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     464,    -1,    33,    -1,    -1,    -1,    18,    19,    20,    21,
+      22,    23,   476,    -1,    -1,    -1,    -1,   675,    -1,    -1,
+      -1,    33,   486,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     494,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   989,    -1,   991,  1405,  1406,  1407,
+    1408,  1409,  1410,  1411,  1412,  1413,  1414,  1415,  1416,  1417,
+    1418,  1419,  1420,  1421,  1422,  1423,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   539,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,  1043,   164,
+     165,   166,    -1,    -1,    -1,   170,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,  1473,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   588,   156,   157,   158,   159,   160,
+     161,   162,    -1,   164,   165,   166,     3,     4,     5,     6,
+      -1,     8,     9,    10,    11,    12,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,    -1,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,    -1,    -1,   631,    -1,    -1,
+      -1,  1529,    -1,    -1,   832,   833,   834,    -1,   836,    -1,
+     838,   839,   840,    50,    51,   649,    -1,    54,    -1,    56,
+      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    66,
+      67,    -1,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    -1,    -1,    -1,    81,    -1,    -1,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   109,   707,   111,    -1,   113,    -1,    -1,    -1,
+      -1,   118,    -1,   120,   121,   122,    -1,    -1,   125,   126,
+      -1,    -1,    -1,   130,    -1,    -1,   133,   134,   135,   136,
+     137,    -1,    -1,   140,   738,   142,    -1,    -1,    -1,     3,
+       4,     5,     6,    -1,     8,     9,    10,    11,   155,    -1,
+      -1,   158,   159,   160,    -1,    -1,   163,    -1,   165,   166,
+      -1,  1246,   169,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   776,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,    -1,    -1,    -1,    50,    51,    -1,    -1,
+      54,    33,    56,    57,    58,    59,    -1,    -1,    62,    63,
+      -1,    -1,    66,    67,    -1,    -1,    70,    -1,    -1,    -1,
+      -1,    75,    76,    77,    -1,  1300,    -1,    81,    -1,    -1,
+      84,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   109,    -1,   111,    -1,   113,
+      -1,    -1,    -1,    -1,   118,    -1,   120,   121,   122,    -1,
+    1345,   125,   126,    -1,    -1,    -1,   130,    -1,    -1,   133,
+     134,   135,   136,   137,    -1,    -1,   140,    -1,   142,    -1,
+      -1,    -1,     3,     4,     5,     6,   890,     8,     9,    10,
+      11,   155,    -1,  1091,   158,   159,   160,    -1,    -1,   163,
+      -1,   165,   166,    -1,    -1,   169,    -1,    -1,    -1,    -1,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,    -1,    -1,    -1,   170,    50,
+      -1,    -1,    -1,    54,    -1,    56,    57,    58,    -1,    -1,
+    1425,    62,    -1,    64,    65,    66,    67,    -1,    -1,    33,
+      -1,    -1,    -1,    -1,    75,    76,    77,    -1,    -1,    -1,
+      81,    -1,    -1,    84,    85,    86,    87,    88,    89,    90,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,
+     111,    -1,   113,    -1,    -1,    -1,    -1,   118,    -1,   120,
+     121,   122,  1006,    -1,   125,    10,    11,    -1,    -1,   130,
+      -1,    -1,   133,    -1,    -1,    -1,   137,    -1,    -1,    -1,
+      -1,   142,    -1,    -1,    -1,    54,   147,    56,    57,    58,
+      -1,    -1,    -1,  1037,   155,    -1,    -1,   158,   159,   160,
+      -1,    -1,   163,    17,   165,   166,    51,    -1,   169,    54,
+      -1,    56,    57,    58,    59,    84,    -1,    -1,    63,    33,
+      -1,    66,    -1,    -1,    -1,    70,    -1,    -1,    -1,    -1,
+      -1,   100,    77,    47,   158,   159,   160,   161,   162,    84,
+     164,   165,   166,    -1,    -1,    -1,    60,    61,    -1,    -1,
+      -1,   120,   121,    -1,    54,   100,    56,    57,    58,    -1,
+      -1,    -1,    76,    -1,    -1,  1109,    66,   112,   137,    -1,
+      -1,    -1,    -1,   142,    -1,   120,   121,    -1,    -1,    -1,
+      -1,   126,    -1,    -1,    84,    -1,    -1,    -1,  1326,   134,
+     135,   136,   137,   107,    -1,   140,   110,   142,    -1,   113,
+     100,    -1,   147,    -1,    -1,    16,    17,    18,    19,    20,
+      21,    22,    23,    -1,    -1,   129,    -1,    -1,   163,    -1,
+     120,   121,    33,    -1,    -1,    -1,    -1,   141,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   137,    -1,    -1,
+      -1,   155,   142,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1390,  1391,  1392,  1393,    -1,  1395,  1396,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    -1,    -1,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    65,    66,    67,    68,    -1,    70,    -1,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,  1281,    82,    83,
+      84,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,    -1,   164,   165,   166,   100,    -1,    -1,   170,
+      -1,    -1,    -1,   107,   108,   109,    -1,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+      -1,    -1,    -1,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,    -1,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    -1,    -1,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    67,    68,    -1,    70,    -1,    72,    73,    74,    75,
+      76,    77,    78,    79,    80,    -1,    82,    83,    84,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   100,  1469,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,    -1,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,    -1,    -1,
+      -1,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,    -1,   169,   170,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    50,    33,    -1,    -1,    54,    -1,    56,    57,
+      58,    -1,    -1,    -1,    62,    -1,    -1,    -1,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,    81,    -1,    -1,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+     118,    -1,   120,   121,   122,    -1,    -1,   125,    -1,    -1,
+      -1,    -1,   130,    -1,    -1,   133,    -1,    -1,    -1,   137,
+       3,     4,     5,     6,   142,     8,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,    -1,    -1,
+     158,   159,   160,    -1,    -1,   163,    -1,   165,   166,   167,
+     150,   169,   152,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,    -1,   164,   165,   166,    50,    51,    -1,
+      -1,    54,    -1,    56,    57,    58,    -1,    -1,    -1,    62,
+      -1,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    76,    77,    -1,    -1,    -1,    81,    -1,
+      -1,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,   111,    -1,
+     113,    -1,    -1,    -1,    -1,   118,    -1,   120,   121,   122,
+      -1,    -1,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+     133,    -1,    -1,    -1,   137,     3,     4,     5,     6,   142,
+       8,     9,    10,    11,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   155,    -1,    -1,   158,   159,   160,    -1,    -1,
+     163,    -1,   165,   166,    -1,    -1,   169,    -1,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      -1,    -1,    50,    51,    -1,    -1,    54,    33,    56,    57,
+      58,    -1,    -1,    -1,    62,    -1,    -1,    -1,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,    81,    -1,    -1,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+     118,    -1,   120,   121,   122,    -1,    -1,   125,    -1,    -1,
+      -1,    -1,   130,    -1,    -1,   133,    -1,    -1,    -1,   137,
+       3,     4,     5,     6,   142,     8,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,    -1,    -1,
+     158,   159,   160,    -1,    -1,   163,    -1,   165,   166,    -1,
+      -1,   169,    -1,   149,    -1,    -1,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,    50,   164,   165,
+     166,    54,    -1,    56,    57,    58,    -1,    -1,    -1,    62,
+      -1,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    76,    77,    -1,    -1,    -1,    81,    -1,
+      -1,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,   111,    -1,
+     113,    -1,    -1,    -1,    -1,   118,    -1,   120,   121,   122,
+      -1,    -1,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+     133,    -1,    -1,    -1,   137,     3,     4,     5,     6,   142,
+       8,     9,    10,    11,   147,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   155,    -1,    -1,   158,   159,   160,    -1,    -1,
+     163,    -1,   165,   166,    -1,    -1,   169,    -1,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      -1,    -1,    50,    -1,    -1,    -1,    54,    33,    56,    57,
+      58,    -1,    -1,    -1,    62,    -1,    -1,    -1,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,    81,    -1,    -1,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+     118,    -1,   120,   121,   122,    -1,    -1,   125,    -1,    -1,
+      -1,    -1,   130,    -1,    -1,   133,    -1,    -1,    -1,   137,
+       3,     4,     5,     6,   142,     8,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,    -1,    -1,
+     158,   159,   160,    -1,    -1,   163,    -1,   165,   166,   167,
+      -1,   169,   148,    -1,    -1,    -1,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,    50,   164,   165,
+     166,    54,    -1,    56,    57,    58,    -1,    -1,    -1,    62,
+      -1,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    76,    77,    -1,    -1,    -1,    81,    -1,
+      -1,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,   111,    -1,
+     113,    -1,    -1,    -1,    -1,   118,    -1,   120,   121,   122,
+      -1,    -1,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+     133,    -1,    -1,    -1,   137,     3,     4,     5,     6,   142,
+       8,     9,    10,    11,   147,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   155,    -1,    -1,   158,   159,   160,    -1,    -1,
+     163,    -1,   165,   166,    -1,    -1,   169,    -1,    -1,    -1,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      -1,    -1,    50,    -1,    -1,    -1,    54,    33,    56,    57,
+      58,    -1,    -1,    -1,    62,    -1,    -1,    -1,    66,    67,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,    81,    -1,    -1,    84,    85,    86,    87,
+      88,    89,    90,    91,    92,    93,    94,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,    -1,
+     118,    -1,   120,   121,   122,    -1,    -1,   125,    -1,    -1,
+      -1,    -1,   130,    -1,    -1,   133,    -1,    -1,    -1,   137,
+       3,     4,     5,     6,   142,     8,     9,    10,    11,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,    -1,    -1,
+     158,   159,   160,    -1,    -1,   163,    -1,   165,   166,   167,
+      -1,   169,    -1,    -1,   150,    -1,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,    50,   164,   165,
+     166,    54,    -1,    56,    57,    58,    -1,    -1,    -1,    62,
+      -1,    -1,    -1,    66,    67,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    75,    76,    77,    -1,    -1,    -1,    81,    -1,
+      -1,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,   111,    -1,
+     113,    -1,    -1,    -1,    -1,   118,    -1,   120,   121,   122,
+      -1,    -1,   125,    -1,    -1,    -1,    -1,   130,    -1,    -1,
+     133,    -1,    -1,    -1,   137,     3,     4,     5,     6,   142,
+       8,     9,    10,    11,    12,    -1,    -1,    15,    -1,    -1,
+      -1,    -1,   155,    -1,    -1,   158,   159,   160,    -1,    -1,
+     163,    -1,   165,   166,    -1,    -1,   169,    16,    17,    18,
+      19,    20,    21,    22,    23,    -1,    -1,    -1,    -1,    47,
+      -1,    -1,    50,    51,    33,    -1,    54,    -1,    56,    57,
+      58,    59,    60,    -1,    62,    63,    -1,    -1,    66,    67,
+      -1,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,    84,    -1,    -1,    -1,
+      -1,    -1,    16,    17,    18,    19,    20,    21,    22,    23,
+      -1,    -1,   100,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      -1,   109,    -1,   111,    -1,   113,    -1,    -1,    -1,   117,
+     118,    -1,   120,   121,   122,    -1,    -1,   125,   126,    -1,
+      -1,    -1,   130,    -1,    -1,   133,   134,   135,   136,   137,
+      -1,    -1,   140,    -1,   142,    -1,     3,     4,     5,     6,
+      -1,     8,     9,    10,    11,    12,    -1,   155,    15,    -1,
+     158,   159,    -1,    -1,    -1,   163,    -1,   165,    -1,   148,
+      -1,   169,    -1,   152,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,    -1,   164,   165,   166,   167,    -1,
+      47,    -1,    -1,    50,    51,    -1,    -1,    54,    -1,    56,
+      57,    58,    59,    60,    -1,    62,    63,    -1,    -1,    66,
+      67,    -1,    -1,    70,    -1,    -1,    -1,    -1,    75,    76,
+      77,    -1,    -1,    17,    -1,    -1,    -1,    84,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,    -1,
+     164,   165,   166,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   109,    47,   111,    -1,   113,    -1,    -1,    -1,
+     117,   118,    -1,   120,   121,   122,    60,    61,   125,   126,
+      -1,    -1,    -1,   130,    -1,    -1,   133,   134,   135,   136,
+     137,    -1,    76,   140,    -1,   142,     3,     4,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,    -1,    -1,   155,    -1,
+      -1,   158,   159,    -1,    -1,    -1,   163,    -1,   165,    -1,
+      -1,    -1,   169,   107,    -1,    -1,   110,    -1,    -1,   113,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    50,    -1,   129,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    62,    -1,   141,    -1,    -1,
+      67,    17,    18,    19,    20,    21,    22,    23,    75,    76,
+      -1,   155,    -1,    -1,    81,    -1,    -1,    33,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,    16,    17,    18,    19,    20,    21,    22,
+      23,    -1,    -1,    -1,   111,    -1,   113,    -1,    -1,    -1,
+      33,   118,    -1,    -1,    -1,   122,    -1,    -1,   125,    -1,
+      -1,    -1,    -1,   130,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,    -1,
+      -1,   158,   159,   160,     6,    -1,   163,    -1,   165,   166,
+      -1,    -1,   169,    -1,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    33,    -1,    35,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    -1,    -1,   153,   154,   155,
+      -1,    -1,   158,   159,   160,   161,   162,    -1,   164,   165,
+     166,    -1,    -1,    65,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    10,    11,    -1,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+      -1,   164,   165,   166,   167,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   109,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    51,    -1,    -1,
+      54,    -1,    56,    57,    58,    59,    -1,    -1,    -1,    63,
+      -1,    -1,    66,    -1,    -1,    -1,    70,    -1,    -1,    -1,
+      -1,    -1,    -1,    77,    -1,    -1,   148,    -1,    -1,   151,
+      84,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,    -1,   165,   166,    -1,   100,   169,    10,    11,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   112,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,   121,    -1,    -1,
+      -1,    -1,   126,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     134,   135,   136,   137,    -1,    -1,   140,    -1,   142,    51,
+      -1,    -1,    54,    -1,    56,    57,    58,    59,    -1,    -1,
+      -1,    63,    -1,    -1,    66,    -1,    -1,    -1,    70,   163,
+      -1,    -1,    -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,
+      -1,    -1,    84,    16,    17,    18,    19,    20,    21,    22,
+      23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,
+      33,    -1,    -1,    -1,    -1,    10,    11,    12,    -1,    -1,
+     112,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   120,   121,
+      -1,    -1,    -1,    -1,   126,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   134,   135,   136,   137,    -1,    -1,   140,    -1,
+     142,    16,    17,    18,    19,    20,    21,    22,    23,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    64,
+      -1,   163,    16,    17,    18,    19,    20,    21,    22,    23,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    33,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    16,    17,
+      18,    19,    20,    21,    22,    23,    -1,    -1,   113,   114,
+      -1,   116,    -1,    -1,    -1,    33,   121,    -1,   123,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+      -1,   164,   165,   166,   167,    16,    17,    18,    19,    20,
+      21,    22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    33,    16,    17,    18,    19,    20,    21,    22,
+      23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    -1,    -1,    -1,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,    -1,   164,
+     165,   166,   167,    -1,    -1,    -1,    -1,    -1,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,    -1,
+     164,   165,   166,   167,    -1,    -1,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,    -1,   164,   165,
+     166,   167,    -1,    -1,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,    -1,   164,   165,   166,   167,
+      16,    17,    18,    19,    20,    21,    22,    23,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,    -1,   164,   165,   166,   167,    -1,    -1,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+      -1,   164,   165,   166,    16,    17,    18,    19,    20,    21,
+      22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     0,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      18,    19,    20,    21,    22,    23,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   150,    33,   152,   153,   154,   155,
+      -1,    -1,   158,   159,   160,   161,   162,    -1,   164,   165,
+     166,    47,    -1,    49,    -1,    -1,    52,    53,    -1,    -1,
+      -1,    -1,    -1,    -1,    60,    61,    18,    19,    20,    21,
+      22,    23,    -1,    69,    -1,    71,    72,    73,    74,    -1,
+      -1,    33,    78,    -1,    -1,    -1,    -1,    83,    -1,    -1,
+     152,   153,   154,   155,    -1,    -1,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,   101,   102,   103,   104,   105,
+     106,   107,   108,    -1,    -1,    -1,    -1,    -1,   114,   115,
+     116,   117,    -1,    -1,    -1,    -1,    -1,   123,   124,    11,
+      12,   127,   128,    15,    -1,    17,   132,    -1,    -1,    -1,
+      -1,    -1,   138,   139,    -1,   141,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   149,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,    47,   164,   165,   166,    51,
+      -1,    -1,    54,    -1,    56,    57,    58,    59,    60,    -1,
+      -1,    63,    -1,    -1,    66,    -1,    -1,    -1,    70,    -1,
+      -1,    -1,    -1,    -1,    -1,    77,    18,    19,    20,    21,
+      22,    23,    84,   155,   156,   157,   158,   159,   160,   161,
+     162,    33,   164,   165,   166,    10,    11,    12,   100,    18,
+      19,    20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    33,   117,    -1,    -1,   120,   121,
+      -1,    -1,    -1,    -1,   126,    -1,    18,    19,    20,    21,
+      22,    23,   134,   135,   136,   137,    -1,    -1,   140,    -1,
+     142,    33,    18,    19,    20,    21,    22,    23,    -1,    64,
+      -1,    -1,    -1,   155,    -1,    -1,    -1,    33,   160,    -1,
+      -1,    76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      10,    11,    12,   108,    -1,    -1,    -1,    -1,   113,   114,
+      -1,   116,    -1,    -1,    -1,    -1,   121,    -1,   123,    -1,
+      -1,   153,   154,   155,    -1,    -1,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,    -1,    -1,    47,    -1,    49,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   156,   157,   158,
+     159,   160,   161,   162,    64,   164,   165,   166,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    76,    77,    -1,     6,
+      -1,    -1,   154,   155,    -1,    -1,   158,   159,   160,   161,
+     162,    -1,   164,   165,   166,    -1,     6,    -1,    -1,   155,
+      -1,    -1,   158,   159,   160,   161,   162,    -1,   164,   165,
+     166,    -1,    -1,   113,   114,    -1,   116,    -1,    -1,    -1,
+      47,   121,    49,   123,    -1,    -1,    53,    -1,    -1,    -1,
+      -1,    -1,    -1,    60,    61,    -1,    -1,    47,    54,    49,
+      56,    57,    58,    53,    71,    72,    73,   147,    -1,    -1,
+      60,    61,    -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,
+      -1,    71,    72,    73,    -1,    -1,    -1,    -1,    84,    -1,
+      -1,    -1,    -1,    83,    10,    11,    12,    -1,    -1,    -1,
+     107,    -1,    -1,    -1,   100,    -1,    10,    11,    12,    -1,
+     117,    -1,    -1,    -1,    -1,    -1,   123,   107,    -1,    -1,
+     127,   128,    -1,    -1,   120,   121,    -1,   117,    -1,    -1,
+      -1,    -1,   139,   123,   141,    10,    11,    12,   128,    -1,
+      -1,   137,    -1,    -1,    -1,    -1,   142,    51,    64,   139,
+      54,   141,    56,    57,    58,    59,    60,    -1,    -1,    63,
+      76,    77,    66,    -1,    -1,    -1,    70,    -1,    -1,   165,
+      -1,    -1,    -1,    77,    -1,    -1,    51,    -1,    -1,    54,
+      84,    56,    57,    58,    59,    60,    -1,    -1,    63,    -1,
+      -1,    66,    -1,    -1,    -1,    70,   100,   113,   114,   115,
+     116,    -1,    77,    -1,    -1,   121,    -1,   123,    -1,    84,
+      -1,    -1,    -1,    -1,    -1,    -1,   120,   121,   134,    -1,
+      -1,    -1,   126,   139,    -1,   100,    -1,    10,    11,    12,
+     134,   135,   136,   137,    -1,    -1,   140,    -1,   142,    -1,
+      -1,    -1,    -1,    -1,    -1,   120,   121,    -1,    -1,    -1,
+      -1,   126,    -1,    -1,    -1,    -1,    10,    11,    12,   134,
+     135,   136,   137,    -1,    -1,   140,    -1,   142,    51,    -1,
+      -1,    54,    -1,    56,    57,    58,    59,    60,    -1,    -1,
+      63,    -1,    -1,    66,    -1,    -1,    -1,    70,    10,    11,
+      12,    -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,
+      54,    84,    56,    57,    58,    59,    60,    -1,    -1,    -1,
+      -1,    -1,    66,    -1,    -1,    -1,    -1,   100,    -1,    -1,
+      -1,    -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,    -1,
+      84,    -1,    54,    -1,    56,    57,    58,   120,   121,    -1,
+      -1,    -1,    -1,   126,    66,    -1,   100,    -1,    -1,    -1,
+      -1,   134,   135,   136,   137,    77,    -1,   140,    -1,   142,
+      -1,    -1,    84,    -1,    11,    12,   120,   121,    15,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,    -1,
+     134,    -1,    -1,   137,    -1,    -1,   140,    -1,   142,    -1,
+      -1,    -1,    -1,    11,    12,    -1,    -1,    15,   120,   121,
+      47,    -1,    -1,    -1,    51,    -1,    -1,    54,    -1,    56,
+      57,    58,    59,    60,    -1,   137,    63,    -1,   140,    66,
+     142,    -1,    -1,    70,    -1,    -1,    -1,    -1,    -1,    47,
+      77,    -1,    -1,    51,    -1,    -1,    54,    84,    56,    57,
+      58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,    -1,
+      -1,    -1,    70,   100,    -1,    -1,    -1,    -1,    -1,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,    84,    -1,    -1,    -1,
+     117,    -1,    -1,   120,   121,    10,    11,    12,    -1,   126,
+      -1,    -1,   100,    -1,    -1,    11,    12,   134,   135,   136,
+     137,    -1,    -1,   140,    -1,   142,    -1,    -1,    -1,   117,
+      -1,    -1,   120,   121,    -1,    -1,    -1,    -1,   126,    54,
+      -1,    56,    57,    58,    11,    12,   134,   135,   136,   137,
+      -1,    47,   140,    -1,   142,    51,    -1,    -1,    54,    64,
+      56,    57,    58,    59,    60,    -1,    -1,    63,    -1,    84,
+      66,    76,    77,    -1,    70,    -1,    -1,    -1,    -1,    -1,
+      -1,    77,    -1,    -1,    51,   100,    -1,    54,    84,    56,
+      57,    58,    59,    60,    -1,    -1,    63,    -1,    -1,    66,
+      -1,    -1,    -1,    70,   100,   120,   121,    -1,   113,   114,
+      77,   116,    -1,    -1,    -1,    -1,   121,    84,   123,    -1,
+      -1,   117,   137,    -1,   120,   121,    -1,   142,    -1,   134,
+     126,    11,    12,   100,   139,    -1,    -1,    -1,   134,   135,
+     136,   137,    -1,    -1,   140,    -1,   142,    -1,    -1,    -1,
+     165,    -1,    -1,   120,   121,    11,    12,    -1,    -1,   126,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   134,   135,   136,
+     137,    51,    -1,   140,    54,   142,    56,    57,    58,    59,
+      -1,    -1,    -1,    63,    -1,    -1,    66,    -1,    -1,    -1,
+      70,    -1,    -1,    -1,    -1,    51,    -1,    77,    54,    -1,
+      56,    57,    58,    59,    84,    -1,    -1,    63,    -1,    -1,
+      66,    -1,    -1,    -1,    70,    -1,    -1,    -1,    -1,    -1,
+     100,    77,    -1,    -1,    -1,    -1,    -1,    -1,    84,    10,
+      11,    12,    -1,    -1,    -1,    -1,    -1,   117,    -1,    -1,
+     120,   121,    11,    -1,   100,    -1,   126,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   134,   135,   136,   137,    -1,    -1,
+     140,    -1,   142,    -1,   120,   121,    -1,    -1,    -1,    -1,
+     126,    11,    -1,    -1,    -1,    -1,    -1,    -1,   134,   135,
+     136,   137,    51,    64,   140,    54,   142,    56,    57,    58,
+      59,    60,    -1,    -1,    63,    76,    77,    66,    -1,    -1,
+      -1,    70,    -1,    -1,    -1,    -1,    -1,    -1,    77,    -1,
+      -1,    51,    -1,    -1,    54,    84,    56,    57,    58,    59,
+      60,    -1,    -1,    63,    -1,    -1,    66,    -1,    -1,    -1,
+      70,   100,   113,   114,    -1,   116,    -1,    77,    -1,    -1,
+     121,    -1,   123,    -1,    84,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,   121,   134,    -1,    -1,    -1,   126,    11,    -1,
+     100,    -1,    -1,    -1,    -1,   134,   135,   136,   137,    -1,
+      -1,   140,    -1,   142,    -1,    -1,    -1,    -1,    -1,    -1,
+     120,   121,    11,    -1,    -1,    -1,   126,    -1,    -1,    -1,
+      10,    11,    12,    -1,   134,   135,   136,   137,    51,    -1,
+     140,    54,   142,    56,    57,    58,    59,    -1,    -1,    -1,
+      63,    -1,    54,    66,    56,    57,    58,    70,    -1,    -1,
+      -1,    -1,    51,    -1,    77,    54,    -1,    56,    57,    58,
+      59,    84,    -1,    -1,    63,    -1,    -1,    66,    -1,    -1,
+      -1,    70,    84,    -1,    64,    -1,    -1,   100,    77,    -1,
+      10,    11,    12,    -1,    -1,    84,    76,    77,   100,    -1,
+      -1,    -1,    -1,    -1,    10,    11,    12,   120,   121,    -1,
+      -1,   100,    -1,   126,    -1,    -1,    -1,    -1,   120,   121,
+      -1,   134,   135,   136,   137,    -1,    -1,   140,    -1,   142,
+      -1,   120,   121,   113,   114,   137,   116,   126,    -1,    -1,
+     142,   121,    -1,   123,    64,   134,   135,   136,   137,    -1,
+      -1,   140,    -1,   142,   134,    -1,    76,    77,    64,   139,
+      -1,    -1,    -1,   165,    -1,    -1,    -1,    -1,    -1,    -1,
+      76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    54,
+      -1,    56,    57,    58,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    66,    -1,   113,   114,    -1,   116,    -1,    -1,    -1,
+      -1,   121,    -1,   123,    -1,    -1,    -1,   113,   114,    84,
+     116,    -1,    -1,    -1,   134,   121,    47,   123,    49,   139,
+      -1,    52,    53,    -1,    -1,   100,    -1,    -1,    -1,    60,
+      61,    -1,   138,    -1,    -1,    -1,    -1,    -1,    69,    -1,
+      71,    72,    73,    74,    -1,   120,   121,    78,    -1,    -1,
+      -1,    -1,    83,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   137,    -1,    -1,    -1,    -1,   142,    -1,    -1,
+     101,   102,   103,   104,   105,   106,   107,   108,    -1,    -1,
+      -1,    -1,    -1,   114,   115,   116,   117,    -1,    -1,    47,
+     165,    49,   123,   124,    52,    53,   127,   128,    -1,    -1,
+      -1,   132,    60,    61,    -1,    -1,    -1,   138,   139,    -1,
+     141,    69,    -1,    71,    72,    73,    74,    -1,   149,    -1,
+      78,    -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,
+      -1,    -1,    -1,   101,   102,   103,   104,   105,   106,   107,
+     108,    -1,    -1,    -1,    -1,    -1,   114,   115,   116,   117,
+      -1,    -1,    47,    -1,    49,   123,   124,    52,    53,   127,
+     128,    -1,    -1,    -1,   132,    60,    61,    -1,    -1,    -1,
+     138,   139,    -1,   141,    69,    -1,    71,    72,    73,    74,
+      -1,   149,    -1,    78,    -1,    -1,    -1,    -1,    83,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     168,    -1,    -1,    -1,    -1,    -1,   101,   102,   103,   104,
+     105,   106,   107,   108,    -1,    -1,    -1,    -1,    -1,   114,
+     115,   116,   117,    -1,    -1,    47,    -1,    49,   123,   124,
+      52,    53,   127,   128,    -1,    -1,    -1,   132,    60,    61,
+      -1,    -1,    -1,   138,   139,    -1,   141,    69,    -1,    71,
+      72,    73,    74,    -1,   149,    -1,    78,    -1,    -1,    -1,
+      -1,    83,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   168,    -1,    -1,    -1,    -1,    -1,   101,
+     102,   103,   104,   105,   106,   107,   108,    -1,    -1,    -1,
+      -1,    -1,   114,   115,   116,   117,    -1,    -1,    47,    -1,
+      49,   123,   124,    52,    53,   127,   128,    -1,    -1,    -1,
+     132,    60,    61,    -1,    -1,    -1,   138,   139,    -1,   141,
+      69,    -1,    71,    72,    73,    74,    -1,   149,    -1,    78,
+      -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,
+      -1,    -1,   101,   102,   103,   104,   105,   106,   107,   108,
+      -1,    -1,    -1,    -1,    -1,   114,   115,   116,   117,    -1,
+      -1,    47,    -1,    49,   123,   124,    52,    53,   127,   128,
+      -1,    -1,    -1,   132,    60,    61,    -1,    -1,    -1,   138,
+     139,    -1,   141,    69,    -1,    71,    72,    73,    74,    -1,
+     149,    -1,    78,    -1,    -1,    -1,    -1,    83,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   168,
+      -1,    -1,    -1,    -1,    -1,   101,   102,   103,   104,   105,
+     106,   107,   108,    -1,    -1,    -1,    -1,    -1,   114,   115,
+     116,   117,    -1,    -1,    47,    -1,    49,   123,   124,    52,
+      53,   127,   128,    -1,    -1,    -1,   132,    60,    61,    -1,
+      -1,    -1,   138,   139,    -1,   141,    69,    -1,    71,    72,
+      73,    74,    -1,   149,    -1,    78,    -1,    -1,    -1,    -1,
+      83,    -1,    -1,    10,    11,    12,    -1,    -1,    15,    10,
+      11,    12,   168,    -1,    -1,    -1,    -1,    -1,   101,   102,
+     103,   104,   105,   106,   107,   108,    -1,    -1,    -1,    -1,
+      -1,   114,   115,   116,   117,    -1,    -1,    -1,    -1,    -1,
+     123,   124,    -1,    -1,   127,   128,    47,    -1,    49,   132,
+      -1,    -1,    -1,    -1,    -1,   138,   139,    64,   141,    -1,
+      -1,    -1,    -1,    64,    -1,    47,   149,    49,    -1,    76,
+      77,    53,    -1,    -1,    -1,    76,    77,    -1,    60,    61,
+      -1,    -1,    -1,    -1,    -1,   168,    -1,    -1,    -1,    71,
+      72,    73,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
+      -1,    83,    -1,    -1,    -1,    -1,   113,   114,    -1,   116,
+      -1,    -1,   113,   114,   121,   116,   123,    -1,    -1,    -1,
+     121,    -1,   123,    -1,    -1,   107,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   117,    -1,    -1,    -1,    -1,
+      -1,   123,    -1,    -1,    -1,    -1,   128,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   138,   139,    47,   141,
+      49,    -1,    -1,    52,    53,    -1,    -1,    -1,    -1,    -1,
+      -1,    60,    61,    -1,   156,    -1,    -1,    -1,    -1,    -1,
+      69,    -1,    71,    72,    73,    74,    -1,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   101,   102,   103,   104,   105,   106,   107,   108,
+      -1,    -1,    -1,    -1,    -1,   114,   115,   116,   117,    -1,
+      -1,    47,    -1,    49,   123,   124,    -1,    53,   127,   128,
+      -1,    -1,    -1,   132,    60,    61,    -1,    -1,    -1,   138,
+     139,    -1,   141,    -1,    -1,    71,    72,    73,    47,    -1,
+      49,    -1,    78,    -1,    53,    -1,    -1,    83,    -1,    -1,
+      -1,    60,    61,    47,    -1,    49,    -1,    -1,    -1,    53,
+      -1,    -1,    71,    72,    73,    -1,    60,    61,    -1,    -1,
+      -1,   107,    -1,    -1,    83,    -1,    -1,    71,    72,    73,
+      -1,   117,    -1,    -1,    -1,    -1,    -1,   123,    -1,    83,
+      -1,   127,   128,    -1,    -1,    -1,    -1,    -1,   107,   108,
+      -1,    -1,   138,   139,    -1,   141,    -1,    -1,   117,    -1,
+      -1,    -1,    -1,   107,   123,    -1,    -1,    -1,    -1,   128,
+      -1,    -1,    -1,   117,    -1,    -1,    -1,    -1,    -1,   123,
+     139,    -1,   141,    -1,   128,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   139,    -1,   141
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   144,   145,   146,   172,   173,   280,     3,     4,     5,
+       6,     8,     9,    10,    11,    50,    54,    56,    57,    58,
+      62,    66,    67,    75,    76,    77,    81,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   109,   111,   113,   118,   120,   121,
+     122,   125,   130,   133,   137,   142,   155,   158,   159,   160,
+     163,   165,   166,   169,   270,   271,   279,    11,    12,    51,
+      54,    56,    57,    58,    59,    60,    63,    66,    70,    77,
+      84,   100,   120,   121,   126,   134,   135,   136,   137,   140,
+     142,   232,   233,   237,   239,   241,   247,   248,   252,   253,
+     258,   259,   260,   261,     0,    47,    49,    52,    53,    60,
+      61,    69,    71,    72,    73,    74,    78,    83,   101,   102,
+     103,   104,   105,   106,   107,   108,   114,   115,   116,   117,
+     123,   124,   127,   128,   132,   138,   139,   141,   149,   176,
+     178,   179,   181,   184,   203,   254,   257,   280,   147,   165,
+     165,   165,   165,   165,   165,   156,   165,   156,   165,   165,
+     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
+     165,   165,   165,   165,   165,   165,   165,    11,    51,    63,
+     134,   135,   235,   252,   253,   258,   156,   165,   165,    15,
+     165,   156,   165,   165,   165,   270,   270,   270,   270,   270,
+      11,    54,    56,    57,    58,    66,    77,    84,   100,   120,
+     121,   137,   142,   237,   268,   270,    10,    11,    12,    64,
+      76,    77,   113,   114,   116,   121,   123,   151,   155,   160,
+     274,   275,   277,   280,   270,    16,    17,    18,    19,    20,
+      21,    22,    23,    33,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   164,   165,   166,     6,     8,
+     232,   233,   165,    59,   126,    66,   100,   259,   259,   259,
+     277,   165,   259,    13,    15,    17,    60,   141,   155,   160,
+     165,   230,   231,   280,   231,   147,    10,    11,    12,   113,
+     150,   278,   238,   280,   138,   182,   183,   277,   165,    72,
+      83,   181,   181,   181,   181,     6,   181,   203,   181,   150,
+     180,   108,   181,   165,   165,   165,   165,   165,   165,   181,
+     147,   277,   150,   150,   150,   181,   181,   165,   179,   181,
+     184,   204,   181,   181,   188,   108,   277,   181,   181,    10,
+      11,    51,    63,   112,   134,   135,   147,   163,   191,   194,
+     234,   236,   239,   241,   247,   252,   253,   258,   267,   268,
+     280,   267,   237,   267,   267,   267,   267,   237,   267,   237,
+     267,   237,   267,   237,   237,   237,   237,   237,   237,   237,
+     237,   237,   237,   237,   237,   237,   237,   237,   267,   165,
+     277,   165,   165,   277,   238,   237,   267,   267,   165,    10,
+     237,   237,   237,   270,   267,   267,   167,   148,   167,   277,
+     277,   148,   170,   151,   220,   280,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   167,   268,   270,
+     231,   231,    51,   270,   237,   160,   277,    13,    15,    17,
+      60,   141,   155,   160,   230,   280,   230,   231,   230,   231,
+     230,   230,    15,    17,    47,    60,   117,   155,   160,   215,
+     216,   225,   232,   233,   280,   166,   250,   251,   280,    11,
+     249,   259,   150,    10,    11,    12,    47,    49,   113,   147,
+     277,   278,   277,    48,   148,   165,    11,   234,   270,   181,
+     178,   147,   277,   277,   277,   277,   277,   277,   277,   173,
+     147,   270,   156,    10,    11,   194,   234,   236,   277,   149,
+     151,   165,   165,   165,    60,   232,   277,   165,   177,   277,
+     186,   147,   149,   151,   222,   149,   185,   277,   278,   238,
+     168,   167,   167,   167,   167,   167,   167,   157,   167,   157,
+     167,   167,   167,   167,   148,   167,   148,   167,   148,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     270,   237,   267,   277,   157,   167,   167,   277,   167,   167,
+     157,   167,   167,   167,   167,   270,   270,    15,   155,   275,
+     165,   200,   280,   270,   150,   167,   170,   167,   167,   167,
+     230,   160,   277,   230,   230,   230,   230,   230,   166,   230,
+     182,   117,   232,   233,   225,   230,   230,   167,    15,   148,
+      13,    17,    60,   141,   155,   160,   165,   228,   278,   280,
+      13,    15,    17,    60,   141,   155,   160,   165,   229,   266,
+     270,   280,   277,   168,   249,   182,   165,   240,   242,   150,
+     181,   182,     3,     4,     5,     9,    10,    15,    50,    62,
+      67,    75,    76,   109,   111,   113,   118,   122,   125,   130,
+     133,   155,   158,   159,   163,   165,   169,   217,   218,   225,
+     226,   272,   273,   279,   280,   167,   167,   173,   147,   148,
+     148,   148,   148,   148,   148,   168,   255,   148,   167,    10,
+      11,    12,    59,    60,   134,   205,   206,   207,   208,   209,
+     258,   280,   165,   222,   189,   149,   237,   192,    13,   160,
+     193,    51,   270,   232,    13,    17,    60,   141,   155,   160,
+     227,   278,   280,   237,   173,   165,   147,   149,   150,   151,
+     221,   262,   263,    64,    65,   147,   270,    13,    17,    60,
+     112,   141,   155,   160,   165,   187,   210,   212,   278,   150,
+     277,   165,   165,   237,   237,   237,   167,   167,   167,   165,
+     167,   165,   220,   215,    17,    33,    47,    60,    61,    76,
+     107,   110,   113,   129,   141,   155,   213,   280,   270,   230,
+     266,   167,    48,   232,   233,   228,   229,   167,   167,   200,
+      15,   225,   160,   228,   228,   228,   228,   228,   228,   166,
+     220,   160,   277,   229,   229,   229,   229,   229,   229,   166,
+     220,   170,   148,   151,    48,   234,   270,   173,    76,   243,
+     280,   183,   165,   156,   156,   235,   156,    15,   165,   156,
+     165,   270,   270,   270,   270,   237,   268,   270,   167,    15,
+     148,    16,    17,    18,    19,    20,    21,    22,    23,    33,
+     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   164,   165,   166,   181,   181,   168,   256,    10,    10,
+      10,    10,    10,    10,   173,   279,   149,   209,   157,   148,
+      15,   277,    13,    17,    60,   141,   155,   160,   165,   228,
+     229,   190,   212,   149,   215,   160,   210,   215,   167,   167,
+     227,   160,   227,   227,   227,   227,   227,   165,   166,   167,
+     168,   195,   262,   174,   175,   277,    64,    65,   168,   264,
+     280,   149,   149,   147,   223,   224,   270,   280,   149,   160,
+     210,   210,     6,    16,    17,    18,    19,    20,    21,    22,
+      23,    33,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    65,   109,   148,   151,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   165,
+     166,   169,   201,   210,   210,   210,   210,   150,   165,   166,
+     213,   151,   220,   222,   249,   268,   268,   167,   167,   167,
+     268,   268,   167,    60,   235,   182,   165,   147,   170,   165,
+     225,   228,   229,   220,   220,   165,   165,   213,   228,   167,
+     266,   229,   167,   266,   270,   167,   167,   168,   150,   244,
+     245,   280,   237,   237,   237,   165,   237,   165,    10,   237,
+     237,   237,   270,   167,   167,    15,   226,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   167,   268,
+     270,   173,   148,   148,   167,   148,   214,   280,   148,   148,
+     148,   168,   167,   228,   229,   179,   184,   202,   203,   208,
+     277,   151,   160,   151,   219,   280,   220,   222,   167,   210,
+     167,   167,   165,   227,   198,   266,   215,   168,   147,   148,
+     147,   165,   149,   149,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      70,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      82,    83,    84,   100,   107,   108,   109,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   169,   170,   265,   223,   168,   148,   210,    10,   167,
+     170,   167,     4,   211,   266,   270,   148,   167,   167,   167,
+     167,   200,   235,   231,    48,   167,   277,   262,   215,   220,
+     220,   215,   215,   165,   170,   165,   170,   148,   114,   115,
+     116,   134,   139,   246,   276,   277,   147,   148,   167,   157,
+     157,   267,   157,   277,   167,   167,   157,   167,   167,   270,
+     150,   167,   170,   168,    10,    10,   149,    10,   167,    10,
+      10,    10,   149,   219,   237,    50,    62,    67,   118,   122,
+     125,   155,   158,   159,   160,   163,   165,   169,   269,   271,
+     148,   200,   167,   165,   200,   199,   215,   170,   167,   262,
+     175,   267,   267,   264,   168,   147,   270,   217,   170,   187,
+     213,   231,    15,   167,   168,   167,   167,   167,   215,   215,
+     139,   276,   139,   276,   139,   276,   277,   114,   115,   116,
+      15,   173,   246,   165,   165,   167,   165,   167,   165,   270,
+     167,   148,   167,   148,   149,   148,   167,   167,   148,   167,
+     165,   156,   156,   156,    15,   165,   156,   269,   269,   269,
+     269,   269,   237,   268,   269,    16,    17,    18,    19,    20,
+      21,    22,    23,    33,   152,   153,   154,   155,   158,   159,
+     160,   161,   162,   164,   165,   166,   190,   165,   196,   215,
+     167,   200,   168,   168,   167,   168,   223,   167,   147,   167,
+     200,   200,   200,   167,   167,   276,   276,   276,   276,   276,
+     276,   168,   268,   268,   268,   268,   149,    10,   149,    10,
+      10,   149,   149,    10,   149,   237,   237,   237,   237,   165,
+      10,   237,   237,   167,   167,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   167,   268,   270,   197,   215,   167,
+     200,    15,   168,   200,   262,   213,   213,   213,   200,   200,
+     167,   167,   167,   167,   148,   214,   167,   148,   148,   167,
+     167,   157,   157,   157,   277,   167,   167,   157,   269,   150,
+     167,   170,   215,   167,   200,   168,    10,   167,   149,    10,
+      10,   149,   165,   165,   165,   167,   165,   269,   167,   200,
+     149,   167,   148,   167,   268,   268,   268,   268,   200,   213,
+     149,    10,   149,   167,   167,   167,   167,   213,   167,   149
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   171,   172,   172,   172,   173,   173,   173,   174,   174,
+     175,   175,   175,   177,   176,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   178,   178,   178,   178,   178,   178,   178,   178,
+     178,   178,   180,   179,   181,   181,   181,   181,   181,   181,
+     181,   181,   181,   181,   181,   181,   181,   181,   181,   181,
+     181,   181,   182,   182,   183,   183,   183,   185,   184,   184,
+     186,   184,   184,   184,   187,   187,   189,   188,   188,   190,
+     190,   192,   191,   193,   191,   195,   194,   196,   194,   197,
+     194,   198,   194,   199,   194,   194,   200,   200,   200,   200,
+     200,   200,   200,   200,   200,   200,   200,   200,   200,   200,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   201,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   201,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   201,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   202,
+     202,   202,   203,   204,   203,   203,   203,   205,   205,   206,
+     206,   207,   207,   208,   208,   208,   208,   208,   208,   208,
+     208,   208,   209,   209,   209,   209,   210,   210,   210,   210,
+     210,   210,   210,   210,   210,   210,   210,   211,   210,   212,
+     212,   213,   213,   213,   214,   214,   215,   215,   215,   215,
+     215,   216,   216,   217,   217,   217,   217,   217,   218,   218,
+     219,   219,   220,   220,   221,   221,   221,   221,   221,   222,
+     222,   222,   222,   222,   222,   223,   223,   223,   224,   224,
+     224,   224,   225,   225,   225,   225,   225,   225,   225,   225,
+     226,   226,   227,   227,   227,   227,   227,   227,   227,   227,
+     227,   228,   228,   228,   228,   228,   228,   228,   228,   228,
+     228,   228,   229,   229,   229,   229,   229,   229,   229,   229,
+     229,   229,   229,   230,   230,   230,   230,   230,   230,   230,
+     230,   230,   230,   231,   231,   231,   231,   231,   231,   231,
+     231,   231,   231,   231,   231,   231,   231,   232,   232,   232,
+     232,   232,   232,   232,   232,   232,   232,   232,   232,   233,
+     234,   234,   234,   234,   234,   234,   234,   234,   234,   234,
+     234,   234,   234,   235,   235,   235,   235,   235,   235,   235,
+     235,   236,   236,   237,   237,   237,   237,   238,   238,   238,
+     238,   240,   239,   242,   241,   243,   243,   244,   244,   245,
+     245,   246,   246,   246,   246,   246,   246,   246,   246,   246,
+     246,   247,   248,   248,   248,   248,   249,   249,   250,   250,
+     250,   251,   251,   251,   252,   252,   252,   253,   253,   253,
+     255,   254,   256,   254,   254,   254,   257,   257,   257,   258,
+     258,   258,   259,   259,   259,   259,   259,   259,   259,   259,
+     259,   259,   259,   259,   259,   259,   260,   260,   260,   261,
+     263,   262,   264,   264,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   265,   265,   265,   265,   265,   265,   265,
+     265,   265,   265,   266,   266,   267,   267,   268,   268,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   269,   269,
+     269,   269,   269,   269,   269,   269,   269,   269,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   270,   270,   270,
+     270,   270,   270,   270,   270,   270,   270,   271,   271,   271,
+     271,   271,   271,   271,   271,   271,   271,   271,   271,   271,
+     271,   271,   271,   271,   271,   271,   271,   271,   271,   271,
+     271,   271,   271,   271,   271,   271,   271,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   273,   273,   273,   273,   273,   273,   273,   273,   273,
+     273,   273,   274,   274,   274,   274,   274,   275,   275,   275,
+     275,   276,   276,   276,   277,   277,   277,   277,   277,   277,
+     277,   277,   277,   277,   277,   278,   278,   278,   278,   279,
+     279,   279,   279,   280
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     2,     2,     2,     1,     2,     2,     1,     3,
+       4,     5,     4,     0,     5,     1,     1,     1,     1,     1,
+       2,     1,     1,     2,     2,     2,     2,     8,    11,     9,
+      11,    13,    15,     7,     9,    12,     9,     9,    13,     9,
+       7,     5,     0,     3,     1,     2,     2,     3,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     4,
+       5,     5,     1,     3,     1,     4,     4,     0,     4,     3,
+       0,     4,     3,     1,     2,     4,     0,     4,     3,     2,
+       4,     0,     6,     0,     6,     0,     7,     0,    11,     0,
+      12,     0,     8,     0,     9,     1,     1,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     4,     5,     6,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     1,     1,     1,
+       1,     1,     2,     0,     6,     2,     2,     1,     1,     1,
+       3,     1,     1,     1,     2,     4,     2,     3,     3,     4,
+       2,     3,     1,     1,     1,     1,     1,     2,     3,     2,
+       2,     2,     2,     2,     3,     4,     3,     0,     6,     2,
+       3,     1,     3,     4,     1,     2,     1,     1,     1,     3,
+       2,     1,     3,     1,     1,     1,     3,     2,     1,     3,
+       1,     2,     1,     2,     1,     3,     5,     3,     3,     1,
+       3,     3,     3,     3,     4,     1,     1,     2,     1,     3,
+       3,     5,     3,     4,     5,     3,     4,     5,     2,     4,
+       1,     1,     1,     1,     2,     2,     2,     2,     2,     3,
+       4,     1,     1,     2,     2,     2,     2,     2,     3,     4,
+       7,     3,     1,     2,     2,     2,     2,     2,     2,     3,
+       4,     7,     3,     1,     1,     2,     2,     2,     2,     2,
+       2,     3,     4,     1,     1,     2,     2,     2,     2,     2,
+       2,     3,     4,     5,     9,     9,     9,     1,     1,     2,
+       1,     1,     1,     3,     4,     4,     4,     4,     1,     1,
+       1,     1,     2,     1,     1,     1,     3,     4,     2,     4,
+       4,     4,     1,     1,     1,     2,     3,     2,     4,     4,
+       1,     1,     1,     2,     3,     2,     3,     1,     4,     5,
+       5,     0,     6,     0,     9,     1,     1,     1,     1,     2,
+       3,     1,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     4,     3,     1,     4,     2,     1,     1,     1,     3,
+       5,     1,     2,     4,     1,     2,     2,     1,     1,     1,
+       0,     6,     0,     7,     4,     5,     3,     5,     4,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     1,     1,     2,     1,
+       0,     2,     1,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     1,     1,     1,     1,     1,     3,     1,
+       4,     7,     7,     7,     7,     4,     4,     5,     4,     2,
+       2,     2,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     5,     4,     4,     3,     3,     3,     3,     1,     4,
+       7,     7,     7,     7,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       5,     4,     2,     5,     4,     4,     2,     2,     2,     2,
+       2,     2,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       5,     4,     4,     3,     3,     3,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     8,    11,
+       4,     4,     6,     4,     4,     6,     6,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     1,     4,     7,
+       7,     7,     7,     4,     4,     5,     4,     2,     5,     4,
+       4,     2,     2,     2,     2,     2,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     5,     4,     4,     3,     3,     3,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     2,     4,     2,     3,     1,
+       2,     1,     2,     2,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     2,     0
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+/* Location data for the lookahead symbol.  */
+static YYLTYPE yyloc_default
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+YYLTYPE yylloc = yyloc_default;
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, &yylloc);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* grammar: START_CONST_EXPR const_expr  */
+#line 454 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_expr = (yyvsp[0].u.expr);
+}
+#line 3875 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 4: /* grammar: START_TYPE full_type  */
+#line 458 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_type = (yyvsp[0].u.type);
+}
+#line 3883 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 10: /* constructor_init: name '(' optional_const_expr_comma ')'  */
+#line 476 "dtool/src/cppparser/cppBison.yxx"
+{
+  delete (yyvsp[-1].u.expr);
+}
+#line 3891 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 11: /* constructor_init: name '(' optional_const_expr_comma ')' ELLIPSIS  */
+#line 480 "dtool/src/cppparser/cppBison.yxx"
+{
+  delete (yyvsp[-2].u.expr);
+}
+#line 3899 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 12: /* constructor_init: name '{' optional_const_expr_comma '}'  */
+#line 484 "dtool/src/cppparser/cppBison.yxx"
+{
+  delete (yyvsp[-1].u.expr);
+}
+#line 3907 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 13: /* $@1: %empty  */
+#line 496 "dtool/src/cppparser/cppBison.yxx"
+{
+  push_storage_class((current_storage_class & ~CPPInstance::SC_c_binding) |
+                     ((yyvsp[-1].u.integer) & CPPInstance::SC_c_binding));
+}
+#line 3916 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 14: /* extern_c: storage_class '{' $@1 cpp '}'  */
+#line 501 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_storage_class();
+}
+#line 3924 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 21: /* declaration: KW_BEGIN_PUBLISH  */
+#line 514 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (publish_nest_level != 0) {
+    yyerror("Unclosed __begin_publish", publish_loc);
+    publish_nest_level = 0;
+    current_scope->set_current_vis(V_public);
+  }
+
+  publish_previous = current_scope->get_current_vis();
+  publish_loc = (yylsp[0]);
+  publish_nest_level++;
+  current_scope->set_current_vis(V_published);
+}
+#line 3941 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 22: /* declaration: KW_END_PUBLISH  */
+#line 527 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (publish_nest_level != 1) {
+    yyerror("Unmatched __end_publish", (yylsp[0]));
+  } else {
+    current_scope->set_current_vis(publish_previous);
+  }
+  publish_nest_level = 0;
+}
+#line 3954 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 23: /* declaration: KW_PUBLISHED ':'  */
+#line 536 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_scope->set_current_vis(V_published);
+}
+#line 3962 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 24: /* declaration: KW_PUBLIC ':'  */
+#line 540 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (publish_nest_level > 0) {
+    current_scope->set_current_vis(V_published);
+  } else {
+    current_scope->set_current_vis(V_public);
+  }
+}
+#line 3974 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 25: /* declaration: KW_PROTECTED ':'  */
+#line 548 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_scope->set_current_vis(V_protected);
+}
+#line 3982 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 26: /* declaration: KW_PRIVATE ':'  */
+#line 552 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_scope->set_current_vis(V_private);
+}
+#line 3990 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 27: /* declaration: KW_MAKE_PROPERTY '(' name ',' IDENTIFIER maybe_comma_identifier ')' ';'  */
+#line 556 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-3].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-3].u.identifier)->get_fully_scoped_name(), (yylsp[-3]));
+  } else {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-5].u.identifier), CPPMakeProperty::T_normal, current_scope, (yylsp[-7]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    if ((yyvsp[-2].u.identifier) != nullptr) {
+      CPPDeclaration *setter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+      if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+        yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+      } else {
+        make_property->_set_function = setter->as_function_group();
+      }
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-7]));
+  }
+}
+#line 4015 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 28: /* declaration: KW_MAKE_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 577 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-6].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+
+  } else {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-8].u.identifier), CPPMakeProperty::T_normal, current_scope, (yylsp[-10]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    CPPDeclaration *setter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    CPPDeclaration *deleter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (deleter == nullptr || deleter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid delete method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    } else {
+      make_property->_del_function = deleter->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-10]));
+  }
+}
+#line 4046 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 29: /* declaration: KW_MAKE_SEQ_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 604 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    getter = nullptr;
+  }
+
+  if (getter != nullptr && length_getter != nullptr) {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-6].u.identifier), CPPMakeProperty::T_sequence, current_scope, (yylsp[-8]).file);
+    make_property->_get_function = getter->as_function_group();
+    make_property->_length_function = length_getter->as_function_group();
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-8]));
+  }
+}
+#line 4071 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 30: /* declaration: KW_MAKE_SEQ_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 625 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-6].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *getter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    getter = nullptr;
+  }
+
+  if (getter != nullptr && length_getter != nullptr) {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-8].u.identifier), CPPMakeProperty::T_sequence, current_scope, (yylsp[-10]).file);
+    make_property->_get_function = getter->as_function_group();
+    make_property->_length_function = length_getter->as_function_group();
+
+    CPPDeclaration *setter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-10]));
+  }
+}
+#line 4104 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 31: /* declaration: KW_MAKE_SEQ_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 654 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-8].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-8].u.identifier)->get_fully_scoped_name(), (yylsp[-8]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *getter = (yyvsp[-6].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+    getter = nullptr;
+  }
+
+  if (getter != nullptr && length_getter != nullptr) {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-10].u.identifier), CPPMakeProperty::T_sequence, current_scope, (yylsp[-12]).file);
+    make_property->_get_function = getter->as_function_group();
+    make_property->_length_function = length_getter->as_function_group();
+
+    CPPDeclaration *setter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    CPPDeclaration *deleter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (deleter == nullptr || deleter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid delete method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    } else {
+      make_property->_del_function = deleter->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-12]));
+  }
+}
+#line 4144 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 32: /* declaration: KW_MAKE_SEQ_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 690 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-10].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-10].u.identifier)->get_fully_scoped_name(), (yylsp[-10]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *getter = (yyvsp[-8].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-8].u.identifier)->get_fully_scoped_name(), (yylsp[-8]));
+    getter = nullptr;
+  }
+
+  if (getter != nullptr && length_getter != nullptr) {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-12].u.identifier), CPPMakeProperty::T_sequence, current_scope, (yylsp[-14]).file);
+    make_property->_get_function = getter->as_function_group();
+    make_property->_length_function = length_getter->as_function_group();
+
+    CPPDeclaration *setter = (yyvsp[-6].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    CPPDeclaration *deleter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (deleter == nullptr || deleter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid delete method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_del_function = deleter->as_function_group();
+    }
+
+    CPPDeclaration *inserter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (inserter == nullptr || inserter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid append method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    } else {
+      make_property->_insert_function = inserter->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-14]));
+  }
+}
+#line 4191 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 33: /* declaration: KW_MAKE_MAP_PROPERTY '(' name ',' IDENTIFIER ')' ';'  */
+#line 733 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid item getter method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+
+  } else {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-4].u.identifier), CPPMakeProperty::T_mapping, current_scope, (yylsp[-6]).file);
+    make_property->_get_function = getter->as_function_group();
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-6]));
+  }
+}
+#line 4207 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 34: /* declaration: KW_MAKE_MAP_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 745 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+
+  } else {
+    CPPMakeProperty *make_property;
+    make_property = new CPPMakeProperty((yyvsp[-6].u.identifier), CPPMakeProperty::T_mapping, current_scope, (yylsp[-8]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    CPPDeclaration *hasser = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (hasser == nullptr || hasser->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid has/find method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_has_function = hasser->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-8]));
+  }
+}
+#line 4232 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 35: /* declaration: KW_MAKE_MAP_PROPERTY '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER maybe_comma_identifier ')' ';'  */
+#line 766 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-5].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-5].u.identifier)->get_fully_scoped_name(), (yylsp[-5]));
+
+  } else {
+    CPPMakeProperty *make_property = new CPPMakeProperty((yyvsp[-9].u.identifier), CPPMakeProperty::T_mapping, current_scope, (yylsp[-11]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    CPPDeclaration *hasser = (yyvsp[-7].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (hasser == nullptr || hasser->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid has/find method: " + (yyvsp[-7].u.identifier)->get_fully_scoped_name(), (yylsp[-7]));
+    } else {
+      make_property->_has_function = hasser->as_function_group();
+    }
+
+    CPPDeclaration *setter = (yyvsp[-3].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("Reference to non-existent or invalid setter: " + (yyvsp[-3].u.identifier)->get_fully_scoped_name(), (yylsp[-3]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    if ((yyvsp[-2].u.identifier) != nullptr) {
+      CPPDeclaration *deleter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+      if (deleter == nullptr || deleter->get_subtype() != CPPDeclaration::ST_function_group) {
+        yyerror("reference to non-existent or invalid delete method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+      } else {
+        make_property->_del_function = deleter->as_function_group();
+      }
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-11]));
+  }
+}
+#line 4272 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 36: /* declaration: KW_MAKE_MAP_KEYS_SEQ '(' name ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 802 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid getter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    getter = nullptr;
+  }
+
+  if (getter != nullptr && length_getter != nullptr) {
+    CPPMakeProperty *make_property = nullptr;
+    for (size_t i = 0; i < current_scope->_declarations.size(); ++i) {
+      make_property = current_scope->_declarations[i]->as_make_property();
+      if (make_property != nullptr) {
+        if (make_property->get_fully_scoped_name() == (yyvsp[-6].u.identifier)->get_fully_scoped_name()) {
+          break;
+        } else {
+          make_property = nullptr;
+        }
+      }
+    }
+    if (make_property != nullptr) {
+      make_property->_get_key_function = getter->as_function_group();
+      make_property->_length_function = length_getter->as_function_group();
+    } else {
+      yyerror("reference to non-existent MAKE_MAP_PROPERTY: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+    }
+  }
+}
+#line 4310 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 37: /* declaration: KW_MAKE_PROPERTY2 '(' name ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 836 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+
+  } else {
+    CPPMakeProperty *make_property;
+    make_property = new CPPMakeProperty((yyvsp[-6].u.identifier), CPPMakeProperty::T_normal,
+                                        current_scope, (yylsp[-8]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    CPPDeclaration *hasser = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (hasser == nullptr || hasser->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid has/find method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_has_function = hasser->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-8]));
+  }
+}
+#line 4336 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 38: /* declaration: KW_MAKE_PROPERTY2 '(' name ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 858 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *getter = (yyvsp[-6].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (getter == nullptr || getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("Reference to non-existent or invalid getter: " + (yyvsp[-6].u.identifier)->get_fully_scoped_name(), (yylsp[-6]));
+
+  } else {
+    CPPMakeProperty *make_property;
+    make_property = new CPPMakeProperty((yyvsp[-10].u.identifier), CPPMakeProperty::T_normal,
+                                        current_scope, (yylsp[-12]).file);
+    make_property->_get_function = getter->as_function_group();
+
+    CPPDeclaration *hasser = (yyvsp[-8].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (hasser == nullptr || hasser->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid has/find method: " + (yyvsp[-8].u.identifier)->get_fully_scoped_name(), (yylsp[-8]));
+    } else {
+      make_property->_has_function = hasser->as_function_group();
+    }
+
+    CPPDeclaration *setter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (setter == nullptr || setter->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid setter: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    } else {
+      make_property->_set_function = setter->as_function_group();
+    }
+
+    CPPDeclaration *clearer = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+    if (clearer == nullptr || clearer->get_subtype() != CPPDeclaration::ST_function_group) {
+      yyerror("reference to non-existent or invalid clear method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-2]));
+    } else {
+      make_property->_clear_function = clearer->as_function_group();
+    }
+
+    current_scope->add_declaration(make_property, global_scope, current_lexer, (yylsp[-12]));
+  }
+}
+#line 4376 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 39: /* declaration: KW_MAKE_SEQ '(' name ',' IDENTIFIER ',' IDENTIFIER ')' ';'  */
+#line 894 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *length_getter = (yyvsp[-4].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (length_getter == nullptr || length_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid length method: " + (yyvsp[-4].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    length_getter = nullptr;
+  }
+
+  CPPDeclaration *element_getter = (yyvsp[-2].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (element_getter == nullptr || element_getter->get_subtype() != CPPDeclaration::ST_function_group) {
+    yyerror("reference to non-existent or invalid element method: " + (yyvsp[-2].u.identifier)->get_fully_scoped_name(), (yylsp[-4]));
+    element_getter = nullptr;
+  }
+
+  if (length_getter != nullptr && element_getter != nullptr) {
+    CPPMakeSeq *make_seq = new CPPMakeSeq((yyvsp[-6].u.identifier),
+                                          length_getter->as_function_group(),
+                                          element_getter->as_function_group(),
+                                          current_scope, (yylsp[-8]).file);
+    current_scope->add_declaration(make_seq, global_scope, current_lexer, (yylsp[-8]));
+  }
+}
+#line 4402 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 40: /* declaration: KW_STATIC_ASSERT '(' const_expr ',' string_literal ')' ';'  */
+#line 916 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPExpression::Result result = (yyvsp[-4].u.expr)->evaluate();
+  if (result._type == CPPExpression::RT_error) {
+    yywarning("static_assert requires a constant expression", (yylsp[-4]));
+  } else if (!result.as_boolean()) {
+    stringstream str;
+    str << *(yyvsp[-2].u.expr);
+    yywarning("static_assert failed: " + str.str(), (yylsp[-4]));
+  }
+}
+#line 4417 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 41: /* declaration: KW_STATIC_ASSERT '(' const_expr ')' ';'  */
+#line 927 "dtool/src/cppparser/cppBison.yxx"
+{
+  // This alternative version of static_assert was introduced in C++17.
+  CPPExpression::Result result = (yyvsp[-2].u.expr)->evaluate();
+  if (result._type == CPPExpression::RT_error) {
+    yywarning("static_assert requires a constant expression", (yylsp[-2]));
+  } else if (!result.as_boolean()) {
+    yywarning("static_assert failed", (yylsp[-2]));
+  }
+}
+#line 4431 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 42: /* $@2: %empty  */
+#line 940 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *new_scope = new CPPScope(current_scope, CPPNameComponent("temp"),
+                                     V_public);
+  push_scope(new_scope);
+}
+#line 4441 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 43: /* friend_declaration: KW_FRIEND $@2 declaration  */
+#line 946 "dtool/src/cppparser/cppBison.yxx"
+{
+  delete current_scope;
+  pop_scope();
+}
+#line 4450 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 44: /* storage_class: empty  */
+#line 955 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = 0;
+}
+#line 4458 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 45: /* storage_class: KW_CONST storage_class  */
+#line 959 "dtool/src/cppparser/cppBison.yxx"
+{
+  // This isn't really a storage class, but it helps with parsing.
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_const;
+}
+#line 4467 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 46: /* storage_class: KW_EXTERN storage_class  */
+#line 964 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_extern;
+}
+#line 4475 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 47: /* storage_class: KW_EXTERN SIMPLE_STRING storage_class  */
+#line 968 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_extern;
+  if ((yyvsp[-1].str) == "C") {
+    (yyval.u.integer) |= (int)CPPInstance::SC_c_binding;
+  } else if ((yyvsp[-1].str) == "C++") {
+    (yyval.u.integer) &= ~(int)CPPInstance::SC_c_binding;
+  } else {
+    yywarning("Ignoring unknown linkage type \"" + (yyvsp[-1].str) + "\"", (yylsp[-1]));
+  }
+}
+#line 4490 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 48: /* storage_class: KW_STATIC storage_class  */
+#line 979 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_static;
+}
+#line 4498 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 49: /* storage_class: KW_INLINE storage_class  */
+#line 983 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_inline;
+}
+#line 4506 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 50: /* storage_class: KW_VIRTUAL storage_class  */
+#line 987 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_virtual;
+}
+#line 4514 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 51: /* storage_class: KW_EXPLICIT storage_class  */
+#line 991 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_explicit;
+}
+#line 4522 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 52: /* storage_class: KW_REGISTER storage_class  */
+#line 995 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_register;
+}
+#line 4530 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 53: /* storage_class: KW_VOLATILE storage_class  */
+#line 999 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_volatile;
+}
+#line 4538 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 54: /* storage_class: KW_MUTABLE storage_class  */
+#line 1003 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_mutable;
+}
+#line 4546 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 55: /* storage_class: KW_CONSTEXPR storage_class  */
+#line 1007 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_constexpr;
+}
+#line 4554 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 56: /* storage_class: KW_BLOCKING storage_class  */
+#line 1011 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_blocking;
+}
+#line 4562 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 57: /* storage_class: KW_EXTENSION storage_class  */
+#line 1015 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_extension;
+}
+#line 4570 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 58: /* storage_class: KW_THREAD_LOCAL storage_class  */
+#line 1019 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer) | (int)CPPInstance::SC_thread_local;
+}
+#line 4578 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 59: /* storage_class: ATTR_LEFT attribute_specifiers ATTR_RIGHT storage_class  */
+#line 1023 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Ignore attribute specifiers for now.
+  (yyval.u.integer) = (yyvsp[0].u.integer);
+}
+#line 4587 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 60: /* storage_class: KW_ALIGNAS '(' const_expr ')' storage_class  */
+#line 1028 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer);
+}
+#line 4595 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 61: /* storage_class: KW_ALIGNAS '(' type_decl ')' storage_class  */
+#line 1032 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[0].u.integer);
+}
+#line 4603 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 67: /* $@3: %empty  */
+#line 1050 "dtool/src/cppparser/cppBison.yxx"
+{
+  // We don't need to push/pop type, because we can't nest
+  // type_like_declaration.
+  if ((yyvsp[0].u.decl)->as_type_declaration()) {
+    current_type = (yyvsp[0].u.decl)->as_type_declaration()->_type;
+  } else {
+    current_type = (yyvsp[0].u.decl)->as_type();
+  }
+  push_storage_class((yyvsp[-1].u.integer));
+}
+#line 4618 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 68: /* type_like_declaration: storage_class var_type_decl $@3 multiple_instance_identifiers  */
+#line 1061 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_storage_class();
+}
+#line 4626 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 69: /* type_like_declaration: storage_class type_decl ';'  */
+#line 1066 "dtool/src/cppparser/cppBison.yxx"
+{
+  // We don't really care about the storage class here.  In fact, it's
+  // not actually legal to define a class or struct using a particular
+  // storage class, but we require it just to help yacc out in its
+  // parsing.
+
+  current_scope->add_declaration((yyvsp[-1].u.decl), global_scope, current_lexer, (yylsp[-1]));
+}
+#line 4639 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 70: /* $@4: %empty  */
+#line 1075 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[0].u.instance) != nullptr) {
+    // Push the scope so that the initializers can make use of things defined
+    // in the class body.
+    push_scope((yyvsp[0].u.instance)->get_scope(current_scope, global_scope));
+    (yyvsp[0].u.instance)->_storage_class |= (current_storage_class | (yyvsp[-1].u.integer));
+  }
+}
+#line 4652 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 71: /* type_like_declaration: storage_class constructor_prototype $@4 maybe_initialize_or_constructor_body  */
+#line 1084 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-2].u.instance) != nullptr) {
+    pop_scope();
+    current_scope->add_declaration((yyvsp[-2].u.instance), global_scope, current_lexer, (yylsp[-2]));
+    (yyvsp[-2].u.instance)->set_initializer((yyvsp[0].u.expr));
+  }
+}
+#line 4664 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 72: /* type_like_declaration: storage_class function_prototype maybe_initialize_or_function_body  */
+#line 1092 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-1].u.instance) != nullptr) {
+    (yyvsp[-1].u.instance)->_storage_class |= (current_storage_class | (yyvsp[-2].u.integer));
+    current_scope->add_declaration((yyvsp[-1].u.instance), global_scope, current_lexer, (yylsp[-1]));
+    (yyvsp[-1].u.instance)->set_initializer((yyvsp[0].u.expr));
+  }
+}
+#line 4676 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 74: /* multiple_instance_identifiers: instance_identifier_and_maybe_trailing_return_type maybe_initialize_or_function_body  */
+#line 1108 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (current_storage_class & CPPInstance::SC_const) {
+    (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  }
+  CPPInstance *inst = new CPPInstance(current_type, (yyvsp[-1].u.inst_ident),
+                                      current_storage_class,
+                                      (yylsp[-1]).file);
+  inst->set_initializer((yyvsp[0].u.expr));
+  current_scope->add_declaration(inst, global_scope, current_lexer, (yylsp[-1]));
+}
+#line 4691 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 75: /* multiple_instance_identifiers: instance_identifier_and_maybe_trailing_return_type maybe_initialize ',' multiple_instance_identifiers  */
+#line 1119 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (current_storage_class & CPPInstance::SC_const) {
+    (yyvsp[-3].u.inst_ident)->add_modifier(IIT_const);
+  }
+  CPPInstance *inst = new CPPInstance(current_type, (yyvsp[-3].u.inst_ident),
+                                      current_storage_class,
+                                      (yylsp[-3]).file);
+  inst->set_initializer((yyvsp[-2].u.expr));
+  current_scope->add_declaration(inst, global_scope, current_lexer, (yylsp[-3]));
+}
+#line 4706 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 76: /* $@5: %empty  */
+#line 1134 "dtool/src/cppparser/cppBison.yxx"
+{
+  // We don't need to push/pop type, because we can't nest
+  // multiple_var_declarations.
+  if ((yyvsp[0].u.decl)->as_type_declaration()) {
+    current_type = (yyvsp[0].u.decl)->as_type_declaration()->_type;
+  } else {
+    current_type = (yyvsp[0].u.decl)->as_type();
+  }
+  push_storage_class((yyvsp[-1].u.integer));
+}
+#line 4721 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 77: /* typedef_declaration: storage_class var_type_decl $@5 typedef_instance_identifiers  */
+#line 1145 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_storage_class();
+}
+#line 4729 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 78: /* typedef_declaration: storage_class function_prototype maybe_initialize_or_function_body  */
+#line 1149 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-1].u.instance) != nullptr) {
+    CPPInstance *inst = (yyvsp[-1].u.instance)->as_instance();
+    if (inst != nullptr) {
+      inst->_storage_class |= (current_storage_class | (yyvsp[-2].u.integer));
+      current_scope->add_declaration(inst, global_scope, current_lexer, (yylsp[-1]));
+      CPPTypedefType *typedef_type = new CPPTypedefType(inst->_type, inst->_ident, current_scope);
+      current_scope->add_declaration(CPPType::new_type(typedef_type), global_scope, current_lexer, (yylsp[-1]));
+    }
+  }
+}
+#line 4745 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 79: /* typedef_instance_identifiers: instance_identifier_and_maybe_trailing_return_type maybe_initialize_or_function_body  */
+#line 1164 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (current_storage_class & CPPInstance::SC_const) {
+    (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  }
+  CPPType *target_type = current_type;
+  CPPTypedefType *typedef_type = new CPPTypedefType(target_type, (yyvsp[-1].u.inst_ident), current_scope, (yylsp[-1]).file);
+  current_scope->add_declaration(CPPType::new_type(typedef_type), global_scope, current_lexer, (yylsp[-1]));
+}
+#line 4758 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 80: /* typedef_instance_identifiers: instance_identifier_and_maybe_trailing_return_type maybe_initialize ',' typedef_instance_identifiers  */
+#line 1173 "dtool/src/cppparser/cppBison.yxx"
+{
+  if (current_storage_class & CPPInstance::SC_const) {
+    (yyvsp[-3].u.inst_ident)->add_modifier(IIT_const);
+  }
+  CPPType *target_type = current_type;
+  CPPTypedefType *typedef_type = new CPPTypedefType(target_type, (yyvsp[-3].u.inst_ident), current_scope, (yylsp[-3]).file);
+  current_scope->add_declaration(CPPType::new_type(typedef_type), global_scope, current_lexer, (yylsp[-3]));
+}
+#line 4771 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 81: /* $@6: %empty  */
+#line 1187 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Create a scope for this function.
+  CPPScope *scope = new CPPScope((yyvsp[-1].u.identifier)->get_scope(current_scope, global_scope),
+                                 (yyvsp[-1].u.identifier)->_names.back(), V_private);
+
+  // It still needs to be able to pick up any template arguments, if this is
+  // a definition for a method template.  Add a fake "using" declaration to
+  // accomplish this.
+  scope->_using.insert(current_scope);
+
+  push_scope(scope);
+}
+#line 4788 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 82: /* constructor_prototype: IDENTIFIER '(' $@6 function_parameter_list ')' function_post  */
+#line 1200 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *scope = (yyvsp[-5].u.identifier)->get_scope(current_scope, global_scope);
+  CPPType *type;
+  std::string simple_name = (yyvsp[-5].u.identifier)->get_simple_name();
+  if (!simple_name.empty() && simple_name[0] == '~') {
+    // A destructor has no return type.
+    type = new CPPSimpleType(CPPSimpleType::T_void);
+  } else if (scope != nullptr && simple_name == scope->get_simple_name()) {
+    // Neither does a constructor.
+    type = new CPPSimpleType(CPPSimpleType::T_void);
+  } else {
+    // This isn't a constructor, so it has an implicit return type of
+    // int.
+    yywarning("function has no return type, assuming int", (yylsp[-5]));
+    type = new CPPSimpleType(CPPSimpleType::T_int);
+  }
+  pop_scope();
+
+  CPPInstanceIdentifier *ii = new CPPInstanceIdentifier((yyvsp[-5].u.identifier));
+  ii->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+
+  (yyval.u.instance) = new CPPInstance(type, ii, 0, (yylsp[-5]).file);
+}
+#line 4816 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 83: /* $@7: %empty  */
+#line 1224 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Create a scope for this function.
+  CPPScope *scope = new CPPScope((yyvsp[-1].u.identifier)->get_scope(current_scope, global_scope),
+                                 (yyvsp[-1].u.identifier)->_names.back(), V_private);
+
+  // It still needs to be able to pick up any template arguments, if this is
+  // a definition for a method template.  Add a fake "using" declaration to
+  // accomplish this.
+  scope->_using.insert(current_scope);
+
+  push_scope(scope);
+}
+#line 4833 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 84: /* constructor_prototype: TYPENAME_IDENTIFIER '(' $@7 function_parameter_list ')' function_post  */
+#line 1237 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+  CPPType *type;
+  if ((yyvsp[-5].u.identifier)->get_simple_name() == current_scope->get_simple_name()) {
+    // This is a constructor, and has no return.
+    type = new CPPSimpleType(CPPSimpleType::T_void);
+  } else {
+    // This isn't a constructor, so it has an implicit return type of
+    // int.
+    type = new CPPSimpleType(CPPSimpleType::T_int);
+  }
+
+  CPPInstanceIdentifier *ii = new CPPInstanceIdentifier((yyvsp[-5].u.identifier));
+  ii->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+
+  (yyval.u.instance) = new CPPInstance(type, ii, 0, (yylsp[-5]).file);
+}
+#line 4855 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 85: /* $@8: %empty  */
+#line 1260 "dtool/src/cppparser/cppBison.yxx"
+{
+  push_scope((yyvsp[-1].u.identifier)->get_scope(current_scope, global_scope));
+}
+#line 4863 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 86: /* function_prototype: '~' name '(' $@8 function_parameter_list ')' function_post  */
+#line 1264 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+  if ((yyvsp[-5].u.identifier)->is_scoped()) {
+    yyerror("Invalid destructor name: ~" + (yyvsp[-5].u.identifier)->get_fully_scoped_name(), (yylsp[-5]));
+  } else {
+    CPPIdentifier *ident =
+      new CPPIdentifier("~" + (yyvsp[-5].u.identifier)->get_simple_name(), (yylsp[-5]));
+    delete (yyvsp[-5].u.identifier);
+
+    CPPType *type;
+    type = new CPPSimpleType(CPPSimpleType::T_void);
+
+    CPPInstanceIdentifier *ii = new CPPInstanceIdentifier(ident);
+    ii->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+
+    (yyval.u.instance) = new CPPInstance(type, ii, 0, (yylsp[-5]).file);
+  }
+}
+#line 4886 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 87: /* $@9: %empty  */
+#line 1290 "dtool/src/cppparser/cppBison.yxx"
+{
+  push_scope((yyvsp[-2].u.inst_ident)->get_scope(current_scope, global_scope));
+}
+#line 4894 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 88: /* function_prototype: TYPENAME_IDENTIFIER '(' '*' instance_identifier ')' '(' $@9 function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 1294 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+  CPPType *type = (yyvsp[-10].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[-10].u.identifier)->get_fully_scoped_name(), (yylsp[-10]));
+  }
+  assert(type != nullptr);
+
+  CPPInstanceIdentifier *ii = (yyvsp[-7].u.inst_ident);
+  ii->add_modifier(IIT_pointer);
+  ii->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer));
+  (yyval.u.instance) = new CPPInstance(type, ii, 0, (yylsp[-10]).file);
+}
+#line 4912 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 89: /* $@10: %empty  */
+#line 1308 "dtool/src/cppparser/cppBison.yxx"
+{
+  push_scope((yyvsp[-2].u.inst_ident)->get_scope(current_scope, global_scope));
+}
+#line 4920 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 90: /* function_prototype: TYPENAME_IDENTIFIER '(' SCOPING '*' instance_identifier ')' '(' $@10 function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 1312 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+  CPPType *type = (yyvsp[-11].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[-11].u.identifier)->get_fully_scoped_name(), (yylsp[-11]));
+  }
+  assert(type != nullptr);
+
+  CPPInstanceIdentifier *ii = (yyvsp[-7].u.inst_ident);
+  ii->add_scoped_pointer_modifier((yyvsp[-9].u.identifier));
+  ii->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer));
+  (yyval.u.instance) = new CPPInstance(type, ii, 0, (yylsp[-11]).file);
+}
+#line 4938 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 91: /* $@11: %empty  */
+#line 1328 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-3].u.identifier) != nullptr) {
+    push_scope((yyvsp[-3].u.identifier)->get_scope(current_scope, global_scope));
+  }
+}
+#line 4948 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 92: /* function_prototype: KW_OPERATOR type not_paren_formal_parameter_identifier '(' $@11 function_parameter_list ')' function_post  */
+#line 1334 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-7].u.identifier) != nullptr) {
+    pop_scope();
+  }
+
+  // We use formal_parameter_identifier, because that can match a type
+  // name with or without an identifier, but especially without, which
+  // is what follows the keyword "operator" in a typecast function.
+  // As an added bonus, the type of the formal_parameter will be the
+  // typecast type, i.e. the return type of the typecast function.
+
+  // We give typecast operators the name "operator typecast <name>",
+  // where <name> is a simple name of the type to be typecast.  Use
+  // the method's return type to determine the full type description.
+  string name = "operator typecast " + (yyvsp[-6].u.type)->get_simple_name();
+  CPPIdentifier *ident = (yyvsp[-7].u.identifier);
+  if (ident == nullptr) {
+    ident = new CPPIdentifier(name, (yylsp[-6]));
+  } else {
+    ident->add_name(name);
+  }
+  (yyval.u.instance) = CPPInstance::make_typecast_function
+    (new CPPInstance((yyvsp[-6].u.type), (yyvsp[-5].u.inst_ident), 0, (yylsp[-5]).file), ident, (yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+}
+#line 4977 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 93: /* $@12: %empty  */
+#line 1359 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-4].u.identifier) != nullptr) {
+    push_scope((yyvsp[-4].u.identifier)->get_scope(current_scope, global_scope));
+  }
+}
+#line 4987 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 94: /* function_prototype: KW_OPERATOR KW_CONST type not_paren_formal_parameter_identifier '(' $@12 function_parameter_list ')' function_post  */
+#line 1365 "dtool/src/cppparser/cppBison.yxx"
+{
+  if ((yyvsp[-8].u.identifier) != nullptr) {
+    pop_scope();
+  }
+
+  CPPIdentifier *ident = (yyvsp[-8].u.identifier);
+  if (ident == nullptr) {
+    ident = new CPPIdentifier("operator typecast", (yylsp[-5]));
+  } else {
+    ident->add_name("operator typecast");
+  }
+  (yyvsp[-5].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.instance) = CPPInstance::make_typecast_function
+    (new CPPInstance((yyvsp[-6].u.type), (yyvsp[-5].u.inst_ident), 0, (yylsp[-5]).file), ident, (yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+}
+#line 5007 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 95: /* function_prototype: IDENTIFIER  */
+#line 1385 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *decl =
+    (yyvsp[0].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (decl != nullptr) {
+    (yyval.u.instance) = decl->as_instance();
+  } else {
+    (yyval.u.instance) = nullptr;
+  }
+}
+#line 5021 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 96: /* function_post: empty  */
+#line 1398 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = 0;
+}
+#line 5029 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 97: /* function_post: function_post KW_CONST  */
+#line 1402 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_const_method;
+}
+#line 5037 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 98: /* function_post: function_post KW_VOLATILE  */
+#line 1406 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_volatile_method;
+}
+#line 5045 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 99: /* function_post: function_post KW_NOEXCEPT  */
+#line 1410 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_noexcept;
+}
+#line 5053 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 100: /* function_post: function_post KW_FINAL  */
+#line 1423 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_final;
+}
+#line 5061 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 101: /* function_post: function_post KW_OVERRIDE  */
+#line 1427 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_override;
+}
+#line 5069 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 102: /* function_post: function_post '&'  */
+#line 1431 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_lvalue_method;
+}
+#line 5077 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 103: /* function_post: function_post ANDAND  */
+#line 1435 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-1].u.integer) | (int)CPPFunctionType::F_rvalue_method;
+}
+#line 5085 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 104: /* function_post: function_post KW_MUTABLE  */
+#line 1439 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Used for lambdas, currently ignored.
+  (yyval.u.integer) = (yyvsp[-1].u.integer);
+}
+#line 5094 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 105: /* function_post: function_post KW_CONSTEXPR  */
+#line 1444 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Used for lambdas in C++17, currently ignored.
+  (yyval.u.integer) = (yyvsp[-1].u.integer);
+}
+#line 5103 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 106: /* function_post: function_post KW_THROW '(' ')'  */
+#line 1449 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-3].u.integer);
+}
+#line 5111 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 107: /* function_post: function_post KW_THROW '(' name ')'  */
+#line 1453 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-4].u.integer);
+}
+#line 5119 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 108: /* function_post: function_post KW_THROW '(' name ELLIPSIS ')'  */
+#line 1457 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-5].u.integer);
+}
+#line 5127 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 109: /* function_post: function_post ATTR_LEFT attribute_specifiers ATTR_RIGHT  */
+#line 1461 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.integer) = (yyvsp[-3].u.integer);
+}
+#line 5135 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 110: /* function_operator: '!'  */
+#line 1468 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "!";
+}
+#line 5143 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 111: /* function_operator: '~'  */
+#line 1472 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "~";
+}
+#line 5151 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 112: /* function_operator: '*'  */
+#line 1476 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "*";
+}
+#line 5159 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 113: /* function_operator: '/'  */
+#line 1480 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "/";
+}
+#line 5167 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 114: /* function_operator: '%'  */
+#line 1484 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "%";
+}
+#line 5175 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 115: /* function_operator: '+'  */
+#line 1488 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "+";
+}
+#line 5183 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 116: /* function_operator: '-'  */
+#line 1492 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "-";
+}
+#line 5191 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 117: /* function_operator: '|'  */
+#line 1496 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "|";
+}
+#line 5199 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 118: /* function_operator: '&'  */
+#line 1500 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "&";
+}
+#line 5207 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 119: /* function_operator: '^'  */
+#line 1504 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "^";
+}
+#line 5215 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 120: /* function_operator: OROR  */
+#line 1508 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "||";
+}
+#line 5223 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 121: /* function_operator: ANDAND  */
+#line 1512 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "&&";
+}
+#line 5231 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 122: /* function_operator: EQCOMPARE  */
+#line 1516 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "==";
+}
+#line 5239 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 123: /* function_operator: NECOMPARE  */
+#line 1520 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "!=";
+}
+#line 5247 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 124: /* function_operator: LECOMPARE  */
+#line 1524 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "<=";
+}
+#line 5255 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 125: /* function_operator: GECOMPARE  */
+#line 1528 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = ">=";
+}
+#line 5263 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 126: /* function_operator: '<'  */
+#line 1532 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "<";
+}
+#line 5271 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 127: /* function_operator: '>'  */
+#line 1536 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = ">";
+}
+#line 5279 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 128: /* function_operator: LSHIFT  */
+#line 1540 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "<<";
+}
+#line 5287 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 129: /* function_operator: RSHIFT  */
+#line 1544 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = ">>";
+}
+#line 5295 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 130: /* function_operator: '='  */
+#line 1548 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "=";
+}
+#line 5303 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 131: /* function_operator: ','  */
+#line 1552 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = ",";
+}
+#line 5311 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 132: /* function_operator: PLUSPLUS  */
+#line 1556 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "++";
+}
+#line 5319 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 133: /* function_operator: MINUSMINUS  */
+#line 1560 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "--";
+}
+#line 5327 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 134: /* function_operator: TIMESEQUAL  */
+#line 1564 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "*=";
+}
+#line 5335 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 135: /* function_operator: DIVIDEEQUAL  */
+#line 1568 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "/=";
+}
+#line 5343 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 136: /* function_operator: MODEQUAL  */
+#line 1572 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "%=";
+}
+#line 5351 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 137: /* function_operator: PLUSEQUAL  */
+#line 1576 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "+=";
+}
+#line 5359 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 138: /* function_operator: MINUSEQUAL  */
+#line 1580 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "-=";
+}
+#line 5367 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 139: /* function_operator: OREQUAL  */
+#line 1584 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "|=";
+}
+#line 5375 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 140: /* function_operator: ANDEQUAL  */
+#line 1588 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "&=";
+}
+#line 5383 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 141: /* function_operator: XOREQUAL  */
+#line 1592 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "^=";
+}
+#line 5391 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 142: /* function_operator: LSHIFTEQUAL  */
+#line 1596 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "<<=";
+}
+#line 5399 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 143: /* function_operator: RSHIFTEQUAL  */
+#line 1600 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = ">>=";
+}
+#line 5407 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 144: /* function_operator: POINTSAT  */
+#line 1604 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "->";
+}
+#line 5415 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 145: /* function_operator: '[' ']'  */
+#line 1608 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "[]";
+}
+#line 5423 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 146: /* function_operator: '(' ')'  */
+#line 1612 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "()";
+}
+#line 5431 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 147: /* function_operator: KW_NEW  */
+#line 1616 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "new";
+}
+#line 5439 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 148: /* function_operator: KW_DELETE  */
+#line 1620 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.str) = "delete";
+}
+#line 5447 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 153: /* $@13: %empty  */
+#line 1634 "dtool/src/cppparser/cppBison.yxx"
+{
+  push_scope(new CPPTemplateScope(current_scope));
+}
+#line 5455 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 154: /* template_declaration: KW_TEMPLATE $@13 '<' template_formal_parameters '>' more_template_declaration  */
+#line 1638 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+}
+#line 5463 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 159: /* template_nonempty_formal_parameters: template_formal_parameter  */
+#line 1652 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPTemplateScope *ts = current_scope->as_template_scope();
+  assert(ts != nullptr);
+  ts->add_template_parameter((yyvsp[0].u.decl));
+}
+#line 5473 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 160: /* template_nonempty_formal_parameters: template_nonempty_formal_parameters ',' template_formal_parameter  */
+#line 1658 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPTemplateScope *ts = current_scope->as_template_scope();
+  assert(ts != nullptr);
+  ts->add_template_parameter((yyvsp[0].u.decl));
+}
+#line 5483 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 163: /* template_formal_parameter: typename_keyword  */
+#line 1672 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPClassTemplateParameter(nullptr));
+}
+#line 5491 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 164: /* template_formal_parameter: typename_keyword name  */
+#line 1676 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPClassTemplateParameter((yyvsp[0].u.identifier)));
+}
+#line 5499 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 165: /* template_formal_parameter: typename_keyword name '=' full_type  */
+#line 1680 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPClassTemplateParameter((yyvsp[-2].u.identifier), (yyvsp[0].u.type)));
+}
+#line 5507 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 166: /* template_formal_parameter: typename_keyword ELLIPSIS  */
+#line 1684 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPClassTemplateParameter *ctp = new CPPClassTemplateParameter(nullptr);
+  ctp->_packed = true;
+  (yyval.u.decl) = CPPType::new_type(ctp);
+}
+#line 5517 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 167: /* template_formal_parameter: typename_keyword ELLIPSIS name  */
+#line 1690 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPClassTemplateParameter *ctp = new CPPClassTemplateParameter((yyvsp[0].u.identifier));
+  ctp->_packed = true;
+  (yyval.u.decl) = CPPType::new_type(ctp);
+}
+#line 5527 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 168: /* template_formal_parameter: template_formal_parameter_type formal_parameter_identifier template_parameter_maybe_initialize  */
+#line 1696 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPInstance *inst = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  inst->set_initializer((yyvsp[0].u.expr));
+  (yyval.u.decl) = inst;
+}
+#line 5537 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 169: /* template_formal_parameter: KW_CONST template_formal_parameter_type formal_parameter_identifier template_parameter_maybe_initialize  */
+#line 1702 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  CPPInstance *inst = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  inst->set_initializer((yyvsp[0].u.expr));
+  (yyval.u.decl) = inst;
+}
+#line 5548 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 170: /* template_formal_parameter: template_formal_parameter_type parameter_pack_identifier  */
+#line 1709 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPInstance *inst = new CPPInstance((yyvsp[-1].u.type), (yyvsp[0].u.inst_ident), 0, (yylsp[0]).file);
+  (yyval.u.decl) = inst;
+}
+#line 5557 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 171: /* template_formal_parameter: KW_CONST template_formal_parameter_type parameter_pack_identifier  */
+#line 1714 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[0].u.inst_ident)->add_modifier(IIT_const);
+  CPPInstance *inst = new CPPInstance((yyvsp[-1].u.type), (yyvsp[0].u.inst_ident), 0, (yylsp[0]).file);
+  (yyval.u.decl) = inst;
+}
+#line 5567 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 172: /* template_formal_parameter_type: simple_type  */
+#line 1723 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.simple_type));
+}
+#line 5575 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 173: /* template_formal_parameter_type: IDENTIFIER  */
+#line 1727 "dtool/src/cppparser/cppBison.yxx"
+{
+  yywarning("Not a type: " + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  (yyval.u.type) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_unknown));
+}
+#line 5584 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 174: /* template_formal_parameter_type: TYPENAME_IDENTIFIER  */
+#line 1732 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.type) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.type) != nullptr);
+}
+#line 5596 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 175: /* template_formal_parameter_type: TYPEPACK_IDENTIFIER  */
+#line 1740 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.type) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.type) != nullptr);
+}
+#line 5608 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 176: /* instance_identifier: name_no_final  */
+#line 1752 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+}
+#line 5616 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 177: /* instance_identifier: KW_OPERATOR function_operator  */
+#line 1756 "dtool/src/cppparser/cppBison.yxx"
+{
+  // For an operator function.  We implement this simply by building a
+  // ficticious name for the function; in other respects it's just
+  // like a regular function.
+  CPPIdentifier *ident = (yyvsp[-1].u.identifier);
+  if (ident == nullptr) {
+    ident = new CPPIdentifier("operator "+(yyvsp[0].str), (yylsp[0]));
+  } else {
+    ident->_names.push_back("operator "+(yyvsp[0].str));
+  }
+
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(ident);
+}
+#line 5634 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 178: /* instance_identifier: KW_OPERATOR SIMPLE_STRING IDENTIFIER  */
+#line 1770 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A C++11 literal operator.
+  if (!(yyvsp[-1].str).empty()) {
+    yyerror("expected empty string", (yylsp[-1]));
+  }
+  CPPIdentifier *ident = (yyvsp[-2].u.identifier);
+  if (ident == nullptr) {
+    ident = new CPPIdentifier("operator \"\" "+(yyvsp[0].u.identifier)->get_simple_name(), (yylsp[0]));
+  } else {
+    ident->_names.push_back("operator \"\" "+(yyvsp[0].u.identifier)->get_simple_name());
+  }
+
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(ident);
+}
+#line 5653 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 179: /* instance_identifier: KW_CONST instance_identifier  */
+#line 1785 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 5662 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 180: /* instance_identifier: KW_VOLATILE instance_identifier  */
+#line 1790 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 5671 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 181: /* instance_identifier: '*' instance_identifier  */
+#line 1795 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 5680 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 182: /* instance_identifier: '&' instance_identifier  */
+#line 1800 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 5689 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 183: /* instance_identifier: ANDAND instance_identifier  */
+#line 1805 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 5698 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 184: /* instance_identifier: SCOPING '*' instance_identifier  */
+#line 1810 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 5707 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 185: /* instance_identifier: instance_identifier '[' optional_const_expr ']'  */
+#line 1815 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 5716 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 186: /* instance_identifier: '(' instance_identifier ')'  */
+#line 1820 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-1].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+}
+#line 5725 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 187: /* $@14: %empty  */
+#line 1825 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Create a scope for this function (in case it is a function)
+  CPPScope *scope = new CPPScope((yyvsp[-1].u.inst_ident)->get_scope(current_scope, global_scope),
+                                 CPPNameComponent(""), V_private);
+
+  // It still needs to be able to pick up any template arguments, if this is
+  // a definition for a method template.  Add a fake "using" declaration to
+  // accomplish this.
+  scope->_using.insert(current_scope);
+
+  push_scope(scope);
+}
+#line 5742 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 188: /* instance_identifier: instance_identifier '(' $@14 formal_parameter_list ')' function_post  */
+#line 1838 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+  (yyval.u.inst_ident) = (yyvsp[-5].u.inst_ident);
+  if ((yyvsp[-2].u.param_list)->is_parameter_expr() && (yyvsp[0].u.integer) == 0) {
+    // Oops, this must have been an instance declaration with a
+    // parameter list, not a function prototype.
+    (yyval.u.inst_ident)->add_initializer_modifier((yyvsp[-2].u.param_list));
+
+  } else {
+    // This was (probably) a function prototype.
+    (yyval.u.inst_ident)->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+  }
+}
+#line 5760 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 189: /* instance_identifier_and_maybe_trailing_return_type: instance_identifier maybe_trailing_return_type  */
+#line 1856 "dtool/src/cppparser/cppBison.yxx"
+{
+  // This is handled a bit awkwardly right now.  Ideally it'd be wrapped
+  // up in the instance_identifier rule, but then more needs to happen in
+  // order to avoid shift/reduce conflicts.
+  if ((yyvsp[0].u.type) != nullptr) {
+    (yyvsp[-1].u.inst_ident)->add_trailing_return_type((yyvsp[0].u.type));
+  }
+  (yyval.u.inst_ident) = (yyvsp[-1].u.inst_ident);
+}
+#line 5774 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 190: /* instance_identifier_and_maybe_trailing_return_type: instance_identifier ':' INTEGER  */
+#line 1866 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Bitfield definition.
+  (yyvsp[-2].u.inst_ident)->_bit_width = (yyvsp[0].u.integer);
+  (yyval.u.inst_ident) = (yyvsp[-2].u.inst_ident);
+}
+#line 5784 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 191: /* maybe_trailing_return_type: empty  */
+#line 1876 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = nullptr;
+}
+#line 5792 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 192: /* maybe_trailing_return_type: POINTSAT predefined_type empty_instance_identifier  */
+#line 1880 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 5800 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 193: /* maybe_trailing_return_type: POINTSAT KW_CONST predefined_type empty_instance_identifier  */
+#line 1884 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[0].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 5809 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 194: /* maybe_comma_identifier: empty  */
+#line 1893 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = nullptr;
+}
+#line 5817 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 195: /* maybe_comma_identifier: ',' IDENTIFIER  */
+#line 1897 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 5825 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 196: /* function_parameter_list: empty  */
+#line 1905 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+}
+#line 5833 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 197: /* function_parameter_list: ELLIPSIS  */
+#line 1909 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5842 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 198: /* function_parameter_list: function_parameters  */
+#line 1914 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[0].u.param_list);
+}
+#line 5850 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 199: /* function_parameter_list: function_parameters ',' ELLIPSIS  */
+#line 1918 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-2].u.param_list);
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5859 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 200: /* function_parameter_list: function_parameters ELLIPSIS  */
+#line 1923 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-1].u.param_list);
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5868 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 201: /* function_parameters: function_parameter  */
+#line 1931 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+  (yyval.u.param_list)->_parameters.push_back((yyvsp[0].u.instance));
+}
+#line 5877 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 202: /* function_parameters: function_parameters ',' function_parameter  */
+#line 1936 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-2].u.param_list);
+  (yyval.u.param_list)->_parameters.push_back((yyvsp[0].u.instance));
+}
+#line 5886 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 203: /* formal_parameter_list: empty  */
+#line 1944 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+}
+#line 5894 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 204: /* formal_parameter_list: ELLIPSIS  */
+#line 1948 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5903 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 205: /* formal_parameter_list: formal_parameters  */
+#line 1953 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[0].u.param_list);
+}
+#line 5911 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 206: /* formal_parameter_list: formal_parameters ',' ELLIPSIS  */
+#line 1957 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-2].u.param_list);
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5920 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 207: /* formal_parameter_list: formal_parameters ELLIPSIS  */
+#line 1962 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-1].u.param_list);
+  (yyval.u.param_list)->_includes_ellipsis = true;
+}
+#line 5929 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 208: /* formal_parameters: formal_parameter  */
+#line 1970 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = new CPPParameterList;
+  (yyval.u.param_list)->_parameters.push_back((yyvsp[0].u.instance));
+}
+#line 5938 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 209: /* formal_parameters: formal_parameters ',' formal_parameter  */
+#line 1975 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.param_list) = (yyvsp[-2].u.param_list);
+  (yyval.u.param_list)->_parameters.push_back((yyvsp[0].u.instance));
+}
+#line 5947 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 210: /* template_parameter_maybe_initialize: empty  */
+#line 1983 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 5955 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 211: /* template_parameter_maybe_initialize: '=' no_angle_bracket_const_expr  */
+#line 1987 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 5963 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 212: /* maybe_initialize: empty  */
+#line 1994 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 5971 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 213: /* maybe_initialize: '=' const_expr  */
+#line 1998 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 5979 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 214: /* maybe_initialize_or_constructor_body: ';'  */
+#line 2005 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 5987 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 215: /* maybe_initialize_or_constructor_body: '{' code '}'  */
+#line 2009 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 5995 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 216: /* maybe_initialize_or_constructor_body: ':' constructor_inits '{' code '}'  */
+#line 2013 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 6003 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 217: /* maybe_initialize_or_constructor_body: '=' KW_DEFAULT ';'  */
+#line 2017 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_default());
+}
+#line 6011 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 218: /* maybe_initialize_or_constructor_body: '=' KW_DELETE ';'  */
+#line 2021 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_delete());
+}
+#line 6019 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 219: /* maybe_initialize_or_function_body: ';'  */
+#line 2028 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 6027 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 220: /* maybe_initialize_or_function_body: '{' code '}'  */
+#line 2032 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 6035 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 221: /* maybe_initialize_or_function_body: '=' const_expr ';'  */
+#line 2036 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+}
+#line 6043 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 222: /* maybe_initialize_or_function_body: '=' KW_DEFAULT ';'  */
+#line 2040 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_default());
+}
+#line 6051 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 223: /* maybe_initialize_or_function_body: '=' KW_DELETE ';'  */
+#line 2044 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_delete());
+}
+#line 6059 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 224: /* maybe_initialize_or_function_body: '=' '{' structure_init '}'  */
+#line 2048 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 6067 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 228: /* structure_init_body: const_expr  */
+#line 2061 "dtool/src/cppparser/cppBison.yxx"
+{
+}
+#line 6074 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 232: /* function_parameter: type formal_parameter_identifier maybe_initialize  */
+#line 2070 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6083 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 233: /* function_parameter: KW_CONST type formal_parameter_identifier maybe_initialize  */
+#line 2075 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6093 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 234: /* function_parameter: KW_CONST KW_REGISTER type formal_parameter_identifier maybe_initialize  */
+#line 2081 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-2]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6103 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 235: /* function_parameter: type_pack parameter_pack_identifier maybe_initialize  */
+#line 2087 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6112 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 236: /* function_parameter: KW_CONST type_pack parameter_pack_identifier maybe_initialize  */
+#line 2092 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-1]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6122 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 237: /* function_parameter: KW_CONST KW_REGISTER type_pack parameter_pack_identifier maybe_initialize  */
+#line 2098 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-1].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.instance) = new CPPInstance((yyvsp[-2].u.type), (yyvsp[-1].u.inst_ident), 0, (yylsp[-2]).file);
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6132 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 238: /* function_parameter: KW_REGISTER function_parameter  */
+#line 2104 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.instance) = (yyvsp[0].u.instance);
+}
+#line 6140 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 239: /* function_parameter: ATTR_LEFT attribute_specifiers ATTR_RIGHT function_parameter  */
+#line 2108 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.instance) = (yyvsp[0].u.instance);
+}
+#line 6148 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 240: /* formal_parameter: function_parameter  */
+#line 2119 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.instance) = (yyvsp[0].u.instance);
+}
+#line 6156 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 241: /* formal_parameter: formal_const_expr  */
+#line 2123 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_parameter));
+  (yyval.u.instance) = new CPPInstance(type, "expr");
+  (yyval.u.instance)->set_initializer((yyvsp[0].u.expr));
+}
+#line 6167 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 242: /* not_paren_formal_parameter_identifier: empty  */
+#line 2133 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+}
+#line 6175 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 243: /* not_paren_formal_parameter_identifier: name_no_final  */
+#line 2137 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+}
+#line 6183 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 244: /* not_paren_formal_parameter_identifier: KW_CONST not_paren_formal_parameter_identifier  */
+#line 2141 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 6192 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 245: /* not_paren_formal_parameter_identifier: KW_VOLATILE not_paren_formal_parameter_identifier  */
+#line 2146 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 6201 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 246: /* not_paren_formal_parameter_identifier: '*' not_paren_formal_parameter_identifier  */
+#line 2151 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 6210 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 247: /* not_paren_formal_parameter_identifier: '&' not_paren_formal_parameter_identifier  */
+#line 2156 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 6219 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 248: /* not_paren_formal_parameter_identifier: ANDAND not_paren_formal_parameter_identifier  */
+#line 2161 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 6228 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 249: /* not_paren_formal_parameter_identifier: SCOPING '*' not_paren_formal_parameter_identifier  */
+#line 2166 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 6237 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 250: /* not_paren_formal_parameter_identifier: not_paren_formal_parameter_identifier '[' optional_const_expr ']'  */
+#line 2171 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 6246 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 251: /* formal_parameter_identifier: empty  */
+#line 2179 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+}
+#line 6254 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 252: /* formal_parameter_identifier: name_no_final  */
+#line 2183 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+}
+#line 6262 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 253: /* formal_parameter_identifier: KW_CONST formal_parameter_identifier  */
+#line 2187 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 6271 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 254: /* formal_parameter_identifier: KW_VOLATILE formal_parameter_identifier  */
+#line 2192 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 6280 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 255: /* formal_parameter_identifier: '*' formal_parameter_identifier  */
+#line 2197 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 6289 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 256: /* formal_parameter_identifier: '&' formal_parameter_identifier  */
+#line 2202 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 6298 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 257: /* formal_parameter_identifier: ANDAND formal_parameter_identifier  */
+#line 2207 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 6307 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 258: /* formal_parameter_identifier: SCOPING '*' formal_parameter_identifier  */
+#line 2212 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 6316 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 259: /* formal_parameter_identifier: formal_parameter_identifier '[' optional_const_expr ']'  */
+#line 2217 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 6325 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 260: /* formal_parameter_identifier: '(' formal_parameter_identifier ')' '(' function_parameter_list ')' function_post  */
+#line 2222 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-5].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+}
+#line 6335 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 261: /* formal_parameter_identifier: '(' formal_parameter_identifier ')'  */
+#line 2228 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-1].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+}
+#line 6344 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 262: /* parameter_pack_identifier: ELLIPSIS  */
+#line 2236 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6353 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 263: /* parameter_pack_identifier: ELLIPSIS name  */
+#line 2241 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6362 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 264: /* parameter_pack_identifier: KW_CONST parameter_pack_identifier  */
+#line 2246 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 6371 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 265: /* parameter_pack_identifier: KW_VOLATILE parameter_pack_identifier  */
+#line 2251 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 6380 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 266: /* parameter_pack_identifier: '*' parameter_pack_identifier  */
+#line 2256 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 6389 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 267: /* parameter_pack_identifier: '&' parameter_pack_identifier  */
+#line 2261 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 6398 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 268: /* parameter_pack_identifier: ANDAND parameter_pack_identifier  */
+#line 2266 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 6407 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 269: /* parameter_pack_identifier: SCOPING '*' parameter_pack_identifier  */
+#line 2271 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 6416 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 270: /* parameter_pack_identifier: parameter_pack_identifier '[' optional_const_expr ']'  */
+#line 2276 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 6425 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 271: /* parameter_pack_identifier: '(' parameter_pack_identifier ')' '(' function_parameter_list ')' function_post  */
+#line 2281 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-5].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-2].u.param_list), (yyvsp[0].u.integer));
+}
+#line 6435 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 272: /* parameter_pack_identifier: '(' parameter_pack_identifier ')'  */
+#line 2287 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-1].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+}
+#line 6444 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 273: /* not_paren_empty_instance_identifier: empty  */
+#line 2295 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+}
+#line 6452 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 274: /* not_paren_empty_instance_identifier: ELLIPSIS  */
+#line 2299 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6461 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 275: /* not_paren_empty_instance_identifier: ELLIPSIS name  */
+#line 2304 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6470 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 276: /* not_paren_empty_instance_identifier: KW_CONST not_paren_empty_instance_identifier  */
+#line 2309 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 6479 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 277: /* not_paren_empty_instance_identifier: KW_VOLATILE not_paren_empty_instance_identifier  */
+#line 2314 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 6488 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 278: /* not_paren_empty_instance_identifier: '*' not_paren_empty_instance_identifier  */
+#line 2319 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 6497 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 279: /* not_paren_empty_instance_identifier: '&' not_paren_empty_instance_identifier  */
+#line 2324 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 6506 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 280: /* not_paren_empty_instance_identifier: ANDAND not_paren_empty_instance_identifier  */
+#line 2329 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 6515 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 281: /* not_paren_empty_instance_identifier: SCOPING '*' not_paren_empty_instance_identifier  */
+#line 2334 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 6524 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 282: /* not_paren_empty_instance_identifier: not_paren_empty_instance_identifier '[' optional_const_expr ']'  */
+#line 2339 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 6533 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 283: /* empty_instance_identifier: empty  */
+#line 2347 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+}
+#line 6541 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 284: /* empty_instance_identifier: ELLIPSIS  */
+#line 2351 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6550 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 285: /* empty_instance_identifier: ELLIPSIS name  */
+#line 2356 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier((yyvsp[0].u.identifier));
+  (yyval.u.inst_ident)->_packed = true;
+}
+#line 6559 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 286: /* empty_instance_identifier: KW_CONST empty_instance_identifier  */
+#line 2361 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_const);
+}
+#line 6568 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 287: /* empty_instance_identifier: KW_VOLATILE empty_instance_identifier  */
+#line 2366 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_volatile);
+}
+#line 6577 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 288: /* empty_instance_identifier: '*' not_paren_empty_instance_identifier  */
+#line 2371 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+}
+#line 6586 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 289: /* empty_instance_identifier: '&' not_paren_empty_instance_identifier  */
+#line 2376 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+}
+#line 6595 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 290: /* empty_instance_identifier: ANDAND not_paren_empty_instance_identifier  */
+#line 2381 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+}
+#line 6604 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 291: /* empty_instance_identifier: SCOPING '*' not_paren_empty_instance_identifier  */
+#line 2386 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[0].u.inst_ident);
+  (yyval.u.inst_ident)->add_scoped_pointer_modifier((yyvsp[-2].u.identifier));
+}
+#line 6613 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 292: /* empty_instance_identifier: not_paren_empty_instance_identifier '[' optional_const_expr ']'  */
+#line 2391 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-3].u.inst_ident);
+  (yyval.u.inst_ident)->add_array_modifier((yyvsp[-1].u.expr));
+}
+#line 6622 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 293: /* empty_instance_identifier: '(' function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 2396 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = new CPPInstanceIdentifier(nullptr);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer), (yyvsp[0].u.type));
+}
+#line 6632 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 294: /* empty_instance_identifier: '(' '*' not_paren_empty_instance_identifier ')' '(' function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 2402 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-6].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_pointer);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer), (yyvsp[0].u.type));
+}
+#line 6643 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 295: /* empty_instance_identifier: '(' '&' not_paren_empty_instance_identifier ')' '(' function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 2409 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-6].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_reference);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer), (yyvsp[0].u.type));
+}
+#line 6654 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 296: /* empty_instance_identifier: '(' ANDAND not_paren_empty_instance_identifier ')' '(' function_parameter_list ')' function_post maybe_trailing_return_type  */
+#line 2416 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.inst_ident) = (yyvsp[-6].u.inst_ident);
+  (yyval.u.inst_ident)->add_modifier(IIT_rvalue_reference);
+  (yyval.u.inst_ident)->add_modifier(IIT_paren);
+  (yyval.u.inst_ident)->add_func_modifier((yyvsp[-3].u.param_list), (yyvsp[-1].u.integer), (yyvsp[0].u.type));
+}
+#line 6665 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 297: /* type: simple_type  */
+#line 2426 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.simple_type));
+}
+#line 6673 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 298: /* type: TYPENAME_IDENTIFIER  */
+#line 2430 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.type) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.type) != nullptr);
+}
+#line 6685 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 299: /* type: KW_TYPENAME name  */
+#line 2438 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPTBDType((yyvsp[0].u.identifier)));
+}
+#line 6693 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 300: /* type: anonymous_struct  */
+#line 2442 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.struct_type));
+}
+#line 6701 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 301: /* type: named_struct  */
+#line 2446 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.struct_type));
+}
+#line 6709 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 302: /* type: enum  */
+#line 2450 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.enum_type));
+}
+#line 6717 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 303: /* type: struct_keyword struct_attributes name  */
+#line 2454 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.type) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-2].u.extension_enum), (yyvsp[0].u.identifier), current_scope, (yylsp[-2]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.type) = et;
+  }
+}
+#line 6737 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 304: /* type: enum_keyword name_no_final ':' enum_element_type  */
+#line 2470 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[-2].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.type) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-3].u.extension_enum), (yyvsp[-2].u.identifier), current_scope, (yylsp[-3]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[-2].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.type) = et;
+  }
+}
+#line 6757 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 305: /* type: KW_DECLTYPE '(' const_expr ')'  */
+#line 2486 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[-1].u.expr)->determine_type();
+  if ((yyval.u.type) == nullptr) {
+    stringstream str;
+    str << *(yyvsp[-1].u.expr);
+    yyerror("could not determine type of " + str.str(), (yylsp[-1]));
+  }
+}
+#line 6770 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 306: /* type: KW_DECLTYPE '(' KW_AUTO ')'  */
+#line 2495 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_auto));
+}
+#line 6778 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 307: /* type: KW_UNDERLYING_TYPE '(' full_type ')'  */
+#line 2499 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPEnumType *enum_type = (yyvsp[-1].u.type)->as_enum_type();
+  if (enum_type == nullptr) {
+    yyerror("an enumeration type is required", (yylsp[-1]));
+    (yyval.u.type) = (yyvsp[-1].u.type);
+  } else {
+    (yyval.u.type) = enum_type->get_underlying_type();
+  }
+}
+#line 6792 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 308: /* type: KW_AUTO  */
+#line 2509 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_auto));
+}
+#line 6800 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 309: /* type_pack: TYPEPACK_IDENTIFIER  */
+#line 2516 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.type) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.type) != nullptr);
+}
+#line 6812 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 310: /* type_decl: simple_type  */
+#line 2527 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type((yyvsp[0].u.simple_type));
+}
+#line 6820 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 311: /* type_decl: TYPENAME_IDENTIFIER  */
+#line 2531 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.decl) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.decl) != nullptr);
+}
+#line 6832 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 312: /* type_decl: KW_TYPENAME name  */
+#line 2539 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPTBDType((yyvsp[0].u.identifier)));
+}
+#line 6840 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 313: /* type_decl: anonymous_struct  */
+#line 2543 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type((yyvsp[0].u.struct_type));
+}
+#line 6848 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 314: /* type_decl: named_struct  */
+#line 2547 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = new CPPTypeDeclaration(CPPType::new_type((yyvsp[0].u.struct_type)));
+}
+#line 6856 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 315: /* type_decl: enum  */
+#line 2551 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = new CPPTypeDeclaration(CPPType::new_type((yyvsp[0].u.enum_type)));
+}
+#line 6864 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 316: /* type_decl: struct_keyword struct_attributes name  */
+#line 2555 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.decl) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-2].u.extension_enum), (yyvsp[0].u.identifier), current_scope, (yylsp[-2]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.decl) = et;
+  }
+}
+#line 6884 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 317: /* type_decl: enum_keyword name_no_final ':' enum_element_type  */
+#line 2571 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[-2].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.decl) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-3].u.extension_enum), (yyvsp[-2].u.identifier), current_scope, (yylsp[-3]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[-2].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.decl) = et;
+  }
+}
+#line 6904 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 318: /* type_decl: enum_keyword name  */
+#line 2587 "dtool/src/cppparser/cppBison.yxx"
+{
+  yywarning(string("C++ does not permit forward declaration of untyped enum ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[-1]));
+
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.decl) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-1].u.extension_enum), (yyvsp[0].u.identifier), current_scope, (yylsp[-1]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.decl) = et;
+  }
+}
+#line 6926 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 319: /* type_decl: KW_DECLTYPE '(' const_expr ')'  */
+#line 2605 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = (yyvsp[-1].u.expr)->determine_type();
+  if ((yyval.u.decl) == nullptr) {
+    stringstream str;
+    str << *(yyvsp[-1].u.expr);
+    yyerror("could not determine type of " + str.str(), (yylsp[-1]));
+  }
+}
+#line 6939 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 320: /* type_decl: KW_DECLTYPE '(' KW_AUTO ')'  */
+#line 2614 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_auto));
+}
+#line 6947 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 321: /* type_decl: KW_UNDERLYING_TYPE '(' full_type ')'  */
+#line 2618 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPEnumType *enum_type = (yyvsp[-1].u.type)->as_enum_type();
+  if (enum_type == nullptr) {
+    yyerror("an enumeration type is required", (yylsp[-1]));
+    (yyval.u.decl) = (yyvsp[-1].u.type);
+  } else {
+    (yyval.u.decl) = enum_type->get_underlying_type();
+  }
+}
+#line 6961 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 322: /* type_decl: KW_AUTO  */
+#line 2628 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_auto));
+}
+#line 6969 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 323: /* predefined_type: simple_type  */
+#line 2635 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.simple_type));
+}
+#line 6977 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 324: /* predefined_type: TYPENAME_IDENTIFIER  */
+#line 2639 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if ((yyval.u.type) == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[0].u.identifier)->get_fully_scoped_name(), (yylsp[0]));
+  }
+  assert((yyval.u.type) != nullptr);
+}
+#line 6989 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 325: /* predefined_type: KW_TYPENAME name  */
+#line 2647 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPTBDType((yyvsp[0].u.identifier)));
+}
+#line 6997 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 326: /* predefined_type: struct_keyword struct_attributes name  */
+#line 2651 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.type) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-2].u.extension_enum), (yyvsp[0].u.identifier), current_scope, (yylsp[-2]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.type) = et;
+  }
+}
+#line 7017 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 327: /* predefined_type: enum_keyword name  */
+#line 2667 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type != nullptr) {
+    (yyval.u.type) = type;
+  } else {
+    CPPExtensionType *et =
+      CPPType::new_type(new CPPExtensionType((yyvsp[-1].u.extension_enum), (yyvsp[0].u.identifier), current_scope, (yylsp[-1]).file))
+      ->as_extension_type();
+    CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope);
+    if (scope != nullptr) {
+      scope->define_extension_type(et);
+    }
+    (yyval.u.type) = et;
+  }
+}
+#line 7037 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 328: /* predefined_type: KW_DECLTYPE '(' const_expr ')'  */
+#line 2683 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[-1].u.expr)->determine_type();
+  if ((yyval.u.type) == nullptr) {
+    stringstream str;
+    str << *(yyvsp[-1].u.expr);
+    yyerror("could not determine type of " + str.str(), (yylsp[-1]));
+  }
+}
+#line 7050 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 329: /* predefined_type: KW_UNDERLYING_TYPE '(' full_type ')'  */
+#line 2692 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPEnumType *enum_type = (yyvsp[-1].u.type)->as_enum_type();
+  if (enum_type == nullptr) {
+    yyerror("an enumeration type is required", (yylsp[-1]));
+    (yyval.u.type) = (yyvsp[-1].u.type);
+  } else {
+    (yyval.u.type) = enum_type->get_underlying_type();
+  }
+}
+#line 7064 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 330: /* predefined_type: KW_AUTO  */
+#line 2702 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_auto));
+}
+#line 7072 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 331: /* var_type_decl: type_decl  */
+#line 2709 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.decl) = (yyvsp[0].u.decl);
+}
+#line 7080 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 332: /* var_type_decl: IDENTIFIER  */
+#line 2713 "dtool/src/cppparser/cppBison.yxx"
+{
+  yyerror(string("unknown type '") + (yyvsp[0].u.identifier)->get_fully_scoped_name() + "'", (yylsp[0]));
+
+  (yyval.u.decl) = CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_unknown));
+}
+#line 7090 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 333: /* full_type: type empty_instance_identifier  */
+#line 2721 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 7098 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 334: /* full_type: KW_CONST type empty_instance_identifier  */
+#line 2725 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[0].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 7107 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 335: /* full_type: type_pack empty_instance_identifier  */
+#line 2730 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 7115 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 336: /* full_type: KW_CONST type_pack empty_instance_identifier  */
+#line 2734 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[0].u.inst_ident)->add_modifier(IIT_const);
+  (yyval.u.type) = (yyvsp[0].u.inst_ident)->unroll_type((yyvsp[-1].u.type));
+}
+#line 7124 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 341: /* $@15: %empty  */
+#line 2749 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPVisibility starting_vis =
+  ((yyvsp[-2].u.extension_enum) == CPPExtensionType::T_class) ? V_private : V_public;
+
+  CPPScope *new_scope = new CPPScope(current_scope, CPPNameComponent("anon"),
+                                     starting_vis);
+  CPPStructType *st = new CPPStructType((yyvsp[-2].u.extension_enum), nullptr, current_scope,
+                                        new_scope, (yylsp[-2]).file);
+  new_scope->set_struct_type(st);
+
+  push_scope(new_scope);
+  push_struct(st);
+}
+#line 7142 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 342: /* anonymous_struct: struct_keyword struct_attributes '{' $@15 cpp '}'  */
+#line 2763 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.struct_type) = current_struct;
+  current_struct->_incomplete = false;
+  pop_struct();
+  pop_scope();
+}
+#line 7153 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 343: /* $@16: %empty  */
+#line 2773 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPVisibility starting_vis =
+  ((yyvsp[-2].u.extension_enum) == CPPExtensionType::T_class) ? V_private : V_public;
+
+  CPPScope *scope = (yyvsp[0].u.identifier)->get_scope(current_scope, global_scope, current_lexer);
+  if (scope == nullptr) {
+    scope = current_scope;
+  }
+  CPPScope *new_scope = new CPPScope(scope, (yyvsp[0].u.identifier)->_names.back(),
+                                     starting_vis);
+
+  CPPStructType *st = new CPPStructType((yyvsp[-2].u.extension_enum), (yyvsp[0].u.identifier), current_scope,
+                                        new_scope, (yylsp[-2]).file);
+  new_scope->set_struct_type(st);
+  current_scope->define_extension_type(st);
+
+  push_scope(new_scope);
+  push_struct(st);
+}
+#line 7177 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 344: /* named_struct: struct_keyword struct_attributes name_no_final $@16 maybe_final maybe_class_derivation '{' cpp '}'  */
+#line 2793 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.struct_type) = current_struct;
+  current_struct->_incomplete = false;
+  pop_struct();
+  pop_scope();
+}
+#line 7188 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 346: /* maybe_final: KW_FINAL  */
+#line 2804 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->_final = true;
+}
+#line 7196 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 351: /* base_specification: class_derivation_name  */
+#line 2821 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_unknown, false);
+}
+#line 7204 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 352: /* base_specification: KW_PUBLIC class_derivation_name  */
+#line 2825 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_public, false);
+}
+#line 7212 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 353: /* base_specification: KW_PROTECTED class_derivation_name  */
+#line 2829 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_protected, false);
+}
+#line 7220 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 354: /* base_specification: KW_PRIVATE class_derivation_name  */
+#line 2833 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_private, false);
+}
+#line 7228 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 355: /* base_specification: KW_VIRTUAL KW_PUBLIC class_derivation_name  */
+#line 2837 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_public, true);
+}
+#line 7236 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 356: /* base_specification: KW_VIRTUAL KW_PROTECTED class_derivation_name  */
+#line 2841 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_protected, true);
+}
+#line 7244 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 357: /* base_specification: KW_VIRTUAL KW_PRIVATE class_derivation_name  */
+#line 2845 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_private, true);
+}
+#line 7252 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 358: /* base_specification: KW_PUBLIC KW_VIRTUAL class_derivation_name  */
+#line 2849 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_public, true);
+}
+#line 7260 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 359: /* base_specification: KW_PROTECTED KW_VIRTUAL class_derivation_name  */
+#line 2853 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_protected, true);
+}
+#line 7268 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 360: /* base_specification: KW_PRIVATE KW_VIRTUAL class_derivation_name  */
+#line 2857 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_struct->append_derivation((yyvsp[0].u.type), V_private, true);
+}
+#line 7276 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 361: /* enum: enum_decl '{' enum_body '}'  */
+#line 2864 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.enum_type) = current_enum;
+  current_enum = nullptr;
+}
+#line 7285 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 362: /* enum_decl: enum_keyword ':' enum_element_type  */
+#line 2872 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_enum = new CPPEnumType((yyvsp[-2].u.extension_enum), nullptr, (yyvsp[0].u.type), current_scope, nullptr, (yylsp[-2]).file);
+}
+#line 7293 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 363: /* enum_decl: enum_keyword  */
+#line 2876 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_enum = new CPPEnumType((yyvsp[0].u.extension_enum), nullptr, current_scope, nullptr, (yylsp[0]).file);
+}
+#line 7301 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 364: /* enum_decl: enum_keyword name_no_final ':' enum_element_type  */
+#line 2880 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *new_scope = new CPPScope(current_scope, (yyvsp[-2].u.identifier)->_names.back(), V_public);
+  current_enum = new CPPEnumType((yyvsp[-3].u.extension_enum), (yyvsp[-2].u.identifier), (yyvsp[0].u.type), current_scope, new_scope, (yylsp[-3]).file);
+}
+#line 7310 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 365: /* enum_decl: enum_keyword name_no_final  */
+#line 2885 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *new_scope = new CPPScope(current_scope, (yyvsp[0].u.identifier)->_names.back(), V_public);
+  current_enum = new CPPEnumType((yyvsp[-1].u.extension_enum), (yyvsp[0].u.identifier), current_scope, new_scope, (yylsp[-1]).file);
+}
+#line 7319 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 366: /* enum_element_type: simple_int_type  */
+#line 2893 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type((yyvsp[0].u.simple_type));
+}
+#line 7327 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 367: /* enum_element_type: TYPENAME_IDENTIFIER  */
+#line 2897 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+}
+#line 7335 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 369: /* enum_body_trailing_comma: enum_body_trailing_comma name ','  */
+#line 2905 "dtool/src/cppparser/cppBison.yxx"
+{
+  assert(current_enum != nullptr);
+  current_enum->add_element((yyvsp[-1].u.identifier)->get_simple_name(), nullptr, current_lexer, (yylsp[-1]));
+}
+#line 7344 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 370: /* enum_body_trailing_comma: enum_body_trailing_comma name '=' const_expr ','  */
+#line 2910 "dtool/src/cppparser/cppBison.yxx"
+{
+  assert(current_enum != nullptr);
+  current_enum->add_element((yyvsp[-3].u.identifier)->get_simple_name(), (yyvsp[-1].u.expr), current_lexer, (yylsp[-3]));
+}
+#line 7353 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 372: /* enum_body: enum_body_trailing_comma name  */
+#line 2918 "dtool/src/cppparser/cppBison.yxx"
+{
+  assert(current_enum != nullptr);
+  current_enum->add_element((yyvsp[0].u.identifier)->get_simple_name(), nullptr, current_lexer, (yylsp[0]));
+}
+#line 7362 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 373: /* enum_body: enum_body_trailing_comma name '=' const_expr  */
+#line 2923 "dtool/src/cppparser/cppBison.yxx"
+{
+  assert(current_enum != nullptr);
+  current_enum->add_element((yyvsp[-2].u.identifier)->get_simple_name(), (yyvsp[0].u.expr), current_lexer, (yylsp[-2]));
+}
+#line 7371 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 374: /* enum_keyword: KW_ENUM  */
+#line 2931 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_enum;
+}
+#line 7379 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 375: /* enum_keyword: KW_ENUM KW_CLASS  */
+#line 2935 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_enum_class;
+}
+#line 7387 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 376: /* enum_keyword: KW_ENUM KW_STRUCT  */
+#line 2939 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_enum_struct;
+}
+#line 7395 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 377: /* struct_keyword: KW_CLASS  */
+#line 2946 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_class;
+}
+#line 7403 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 378: /* struct_keyword: KW_STRUCT  */
+#line 2950 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_struct;
+}
+#line 7411 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 379: /* struct_keyword: KW_UNION  */
+#line 2954 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.extension_enum) = CPPExtensionType::T_union;
+}
+#line 7419 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 380: /* $@17: %empty  */
+#line 2961 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *scope = (yyvsp[-1].u.identifier)->find_scope(current_scope, global_scope, current_lexer);
+  if (scope == nullptr) {
+    // This must be a new namespace declaration.
+    CPPScope *parent_scope =
+      (yyvsp[-1].u.identifier)->get_scope(current_scope, global_scope, current_lexer);
+    if (parent_scope == nullptr) {
+      parent_scope = current_scope;
+    }
+    scope = new CPPScope(parent_scope, (yyvsp[-1].u.identifier)->_names.back(), V_public);
+  }
+
+  CPPNamespace *nspace = new CPPNamespace((yyvsp[-1].u.identifier), scope, (yylsp[-2]).file);
+  current_scope->add_declaration(nspace, global_scope, current_lexer, (yylsp[-2]));
+  current_scope->define_namespace(nspace);
+  push_scope(scope);
+}
+#line 7441 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 381: /* namespace_declaration: KW_NAMESPACE name '{' $@17 cpp '}'  */
+#line 2979 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+}
+#line 7449 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 382: /* $@18: %empty  */
+#line 2983 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPScope *scope = (yyvsp[-1].u.identifier)->find_scope(current_scope, global_scope, current_lexer);
+  if (scope == nullptr) {
+    // This must be a new namespace declaration.
+    CPPScope *parent_scope =
+      (yyvsp[-1].u.identifier)->get_scope(current_scope, global_scope, current_lexer);
+    if (parent_scope == nullptr) {
+      parent_scope = current_scope;
+    }
+    scope = new CPPScope(parent_scope, (yyvsp[-1].u.identifier)->_names.back(), V_public);
+  }
+
+  CPPNamespace *nspace = new CPPNamespace((yyvsp[-1].u.identifier), scope, (yylsp[-2]).file);
+  nspace->_is_inline = true;
+  current_scope->add_declaration(nspace, global_scope, current_lexer, (yylsp[-2]));
+  current_scope->define_namespace(nspace);
+  push_scope(scope);
+}
+#line 7472 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 383: /* namespace_declaration: KW_INLINE KW_NAMESPACE name '{' $@18 cpp '}'  */
+#line 3002 "dtool/src/cppparser/cppBison.yxx"
+{
+  pop_scope();
+}
+#line 7480 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 386: /* using_declaration: KW_USING name ';'  */
+#line 3011 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPUsing *using_decl = new CPPUsing((yyvsp[-1].u.identifier), false, (yylsp[-2]).file);
+  current_scope->add_declaration(using_decl, global_scope, current_lexer, (yylsp[-2]));
+  current_scope->add_using(using_decl, global_scope, current_lexer);
+}
+#line 7490 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 387: /* using_declaration: KW_USING name '=' full_type ';'  */
+#line 3017 "dtool/src/cppparser/cppBison.yxx"
+{
+  // This is really just an alternative way to declare a typedef.
+  CPPTypedefType *typedef_type = new CPPTypedefType((yyvsp[-1].u.type), (yyvsp[-3].u.identifier), current_scope);
+  typedef_type->_using = true;
+  current_scope->add_declaration(CPPType::new_type(typedef_type), global_scope, current_lexer, (yylsp[-4]));
+}
+#line 7501 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 388: /* using_declaration: KW_USING KW_NAMESPACE name ';'  */
+#line 3024 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPUsing *using_decl = new CPPUsing((yyvsp[-1].u.identifier), true, (yylsp[-3]).file);
+  current_scope->add_declaration(using_decl, global_scope, current_lexer, (yylsp[-3]));
+  current_scope->add_using(using_decl, global_scope, current_lexer);
+}
+#line 7511 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 392: /* simple_int_type: KW_BOOL  */
+#line 3039 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_bool);
+}
+#line 7519 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 393: /* simple_int_type: KW_CHAR  */
+#line 3043 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_char);
+}
+#line 7527 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 394: /* simple_int_type: KW_WCHAR_T  */
+#line 3047 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_wchar_t);
+}
+#line 7535 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 395: /* simple_int_type: KW_CHAR16_T  */
+#line 3051 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_char16_t);
+}
+#line 7543 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 396: /* simple_int_type: KW_CHAR32_T  */
+#line 3055 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_char32_t);
+}
+#line 7551 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 397: /* simple_int_type: KW_SHORT  */
+#line 3059 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_int,
+                         CPPSimpleType::F_short);
+}
+#line 7560 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 398: /* simple_int_type: KW_LONG  */
+#line 3064 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_int,
+                         CPPSimpleType::F_long);
+}
+#line 7569 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 399: /* simple_int_type: KW_UNSIGNED  */
+#line 3069 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_int,
+                         CPPSimpleType::F_unsigned);
+}
+#line 7578 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 400: /* simple_int_type: KW_SIGNED  */
+#line 3074 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_int,
+                         CPPSimpleType::F_signed);
+}
+#line 7587 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 401: /* simple_int_type: KW_INT  */
+#line 3079 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_int);
+}
+#line 7595 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 402: /* simple_int_type: KW_SHORT simple_int_type  */
+#line 3083 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = (yyvsp[0].u.simple_type);
+  (yyval.u.simple_type)->_flags |= CPPSimpleType::F_short;
+}
+#line 7604 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 403: /* simple_int_type: KW_LONG simple_int_type  */
+#line 3088 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = (yyvsp[0].u.simple_type);
+  if ((yyval.u.simple_type)->_flags & CPPSimpleType::F_long) {
+    (yyval.u.simple_type)->_flags |= CPPSimpleType::F_longlong;
+  } else {
+    (yyval.u.simple_type)->_flags |= CPPSimpleType::F_long;
+  }
+}
+#line 7617 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 404: /* simple_int_type: KW_UNSIGNED simple_int_type  */
+#line 3097 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = (yyvsp[0].u.simple_type);
+  (yyval.u.simple_type)->_flags |= CPPSimpleType::F_unsigned;
+}
+#line 7626 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 405: /* simple_int_type: KW_SIGNED simple_int_type  */
+#line 3102 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = (yyvsp[0].u.simple_type);
+  (yyval.u.simple_type)->_flags |= CPPSimpleType::F_signed;
+}
+#line 7635 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 406: /* simple_float_type: KW_FLOAT  */
+#line 3110 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_float);
+}
+#line 7643 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 407: /* simple_float_type: KW_DOUBLE  */
+#line 3114 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_double);
+}
+#line 7651 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 408: /* simple_float_type: KW_LONG KW_DOUBLE  */
+#line 3118 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_double,
+                         CPPSimpleType::F_long);
+}
+#line 7660 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 409: /* simple_void_type: KW_VOID  */
+#line 3126 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.simple_type) = new CPPSimpleType(CPPSimpleType::T_void);
+}
+#line 7668 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 410: /* $@19: %empty  */
+#line 3135 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_lexer->_resolve_identifiers = false;
+}
+#line 7676 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 411: /* code: $@19 code_block  */
+#line 3139 "dtool/src/cppparser/cppBison.yxx"
+{
+  current_lexer->_resolve_identifiers = true;
+}
+#line 7684 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 519: /* element: KW_WHILE  */
+#line 3183 "dtool/src/cppparser/cppBison.yxx"
+{
+}
+#line 7691 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 543: /* optional_const_expr: empty  */
+#line 3192 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 7699 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 544: /* optional_const_expr: const_expr  */
+#line 3196 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 7707 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 545: /* optional_const_expr_comma: empty  */
+#line 3203 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = nullptr;
+}
+#line 7715 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 546: /* optional_const_expr_comma: const_expr_comma  */
+#line 3207 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 7723 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 547: /* const_expr_comma: const_expr  */
+#line 3214 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 7731 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 548: /* const_expr_comma: const_expr_comma ',' const_expr  */
+#line 3218 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(',', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7739 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 549: /* no_angle_bracket_const_expr: const_operand  */
+#line 3225 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 7747 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 550: /* no_angle_bracket_const_expr: '(' full_type ')' no_angle_bracket_const_expr  */
+#line 3229 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-2].u.type), (yyvsp[0].u.expr)));
+}
+#line 7755 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 551: /* no_angle_bracket_const_expr: KW_STATIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3233 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_static_cast));
+}
+#line 7763 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 552: /* no_angle_bracket_const_expr: KW_DYNAMIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3237 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_dynamic_cast));
+}
+#line 7771 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 553: /* no_angle_bracket_const_expr: KW_CONST_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3241 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_const_cast));
+}
+#line 7779 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 554: /* no_angle_bracket_const_expr: KW_REINTERPRET_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3245 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_reinterpret_cast));
+}
+#line 7787 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 555: /* no_angle_bracket_const_expr: KW_SIZEOF '(' full_type ')'  */
+#line 3249 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func((yyvsp[-1].u.type)));
+}
+#line 7795 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 556: /* no_angle_bracket_const_expr: KW_SIZEOF '(' IDENTIFIER ')'  */
+#line 3253 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *arg = (yyvsp[-1].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (arg == nullptr) {
+    yyerror("undefined sizeof argument: " + (yyvsp[-1].u.identifier)->get_fully_scoped_name(), (yylsp[-1]));
+  } else if (arg->get_subtype() == CPPDeclaration::ST_instance) {
+    CPPInstance *inst = arg->as_instance();
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(inst->_type));
+  } else {
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(arg->as_type()));
+  }
+}
+#line 7811 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 557: /* no_angle_bracket_const_expr: KW_SIZEOF ELLIPSIS '(' name ')'  */
+#line 3265 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_ellipsis_func((yyvsp[-1].u.identifier)));
+}
+#line 7819 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 558: /* no_angle_bracket_const_expr: KW_ALIGNOF '(' full_type ')'  */
+#line 3269 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::alignof_func((yyvsp[-1].u.type)));
+}
+#line 7827 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 559: /* no_angle_bracket_const_expr: '!' no_angle_bracket_const_expr  */
+#line 3273 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NOT, (yyvsp[0].u.expr));
+}
+#line 7835 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 560: /* no_angle_bracket_const_expr: '~' no_angle_bracket_const_expr  */
+#line 3277 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NEGATE, (yyvsp[0].u.expr));
+}
+#line 7843 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 561: /* no_angle_bracket_const_expr: '-' no_angle_bracket_const_expr  */
+#line 3281 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_MINUS, (yyvsp[0].u.expr));
+}
+#line 7851 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 562: /* no_angle_bracket_const_expr: '+' no_angle_bracket_const_expr  */
+#line 3285 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_PLUS, (yyvsp[0].u.expr));
+}
+#line 7859 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 563: /* no_angle_bracket_const_expr: '*' no_angle_bracket_const_expr  */
+#line 3289 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_STAR, (yyvsp[0].u.expr));
+}
+#line 7867 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 564: /* no_angle_bracket_const_expr: '&' no_angle_bracket_const_expr  */
+#line 3293 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_REF, (yyvsp[0].u.expr));
+}
+#line 7875 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 565: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '*' no_angle_bracket_const_expr  */
+#line 3297 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('*', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7883 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 566: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '/' no_angle_bracket_const_expr  */
+#line 3301 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('/', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7891 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 567: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '%' no_angle_bracket_const_expr  */
+#line 3305 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('%', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7899 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 568: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '+' no_angle_bracket_const_expr  */
+#line 3309 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('+', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7907 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 569: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '-' no_angle_bracket_const_expr  */
+#line 3313 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('-', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7915 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 570: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '|' no_angle_bracket_const_expr  */
+#line 3317 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('|', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7923 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 571: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '^' no_angle_bracket_const_expr  */
+#line 3321 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('^', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7931 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 572: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '&' no_angle_bracket_const_expr  */
+#line 3325 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('&', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7939 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 573: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr OROR no_angle_bracket_const_expr  */
+#line 3329 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(OROR, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7947 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 574: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr ANDAND no_angle_bracket_const_expr  */
+#line 3333 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(ANDAND, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7955 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 575: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr EQCOMPARE no_angle_bracket_const_expr  */
+#line 3337 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(EQCOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7963 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 576: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr NECOMPARE no_angle_bracket_const_expr  */
+#line 3341 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(NECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7971 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 577: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr LECOMPARE no_angle_bracket_const_expr  */
+#line 3345 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7979 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 578: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr GECOMPARE no_angle_bracket_const_expr  */
+#line 3349 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(GECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7987 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 579: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr LSHIFT no_angle_bracket_const_expr  */
+#line 3353 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 7995 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 580: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr RSHIFT no_angle_bracket_const_expr  */
+#line 3357 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(RSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8003 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 581: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '?' no_angle_bracket_const_expr ':' no_angle_bracket_const_expr  */
+#line 3361 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('?', (yyvsp[-4].u.expr), (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8011 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 582: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '[' const_expr ']'  */
+#line 3365 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('[', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 8019 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 583: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '(' const_expr_comma ')'  */
+#line 3369 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 8027 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 584: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '(' ')'  */
+#line 3373 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-2].u.expr));
+}
+#line 8035 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 585: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr '.' no_angle_bracket_const_expr  */
+#line 3377 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('.', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8043 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 586: /* no_angle_bracket_const_expr: no_angle_bracket_const_expr POINTSAT no_angle_bracket_const_expr  */
+#line 3381 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(POINTSAT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8051 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 587: /* no_angle_bracket_const_expr: '(' const_expr_comma ')'  */
+#line 3385 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+}
+#line 8059 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 588: /* const_expr: const_operand  */
+#line 3393 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 8067 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 589: /* const_expr: '(' full_type ')' const_expr  */
+#line 3397 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-2].u.type), (yyvsp[0].u.expr)));
+}
+#line 8075 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 590: /* const_expr: KW_STATIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3401 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_static_cast));
+}
+#line 8083 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 591: /* const_expr: KW_DYNAMIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3405 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_dynamic_cast));
+}
+#line 8091 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 592: /* const_expr: KW_CONST_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3409 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_const_cast));
+}
+#line 8099 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 593: /* const_expr: KW_REINTERPRET_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3413 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_reinterpret_cast));
+}
+#line 8107 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 594: /* const_expr: TYPENAME_IDENTIFIER '(' optional_const_expr_comma ')'  */
+#line 3417 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A constructor call.
+  CPPType *type = (yyvsp[-3].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[-3].u.identifier)->get_fully_scoped_name(), (yylsp[-3]));
+  }
+  assert(type != nullptr);
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8121 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 595: /* const_expr: TYPENAME_IDENTIFIER '{' optional_const_expr_comma '}'  */
+#line 3427 "dtool/src/cppparser/cppBison.yxx"
+{
+  // Aggregate initialization.
+  CPPType *type = (yyvsp[-3].u.identifier)->find_type(current_scope, global_scope, false, current_lexer);
+  if (type == nullptr) {
+    yyerror(string("internal error resolving type ") + (yyvsp[-3].u.identifier)->get_fully_scoped_name(), (yylsp[-3]));
+  }
+  assert(type != nullptr);
+  (yyval.u.expr) = new CPPExpression(CPPExpression::aggregate_init_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8135 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 596: /* const_expr: KW_INT '(' optional_const_expr_comma ')'  */
+#line 3437 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_int));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8145 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 597: /* const_expr: KW_CHAR '(' optional_const_expr_comma ')'  */
+#line 3443 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_char));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8155 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 598: /* const_expr: KW_WCHAR_T '(' optional_const_expr_comma ')'  */
+#line 3449 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_wchar_t));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8165 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 599: /* const_expr: KW_CHAR16_T '(' optional_const_expr_comma ')'  */
+#line 3455 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_char16_t));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8175 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 600: /* const_expr: KW_CHAR32_T '(' optional_const_expr_comma ')'  */
+#line 3461 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_char32_t));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8185 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 601: /* const_expr: KW_BOOL '(' optional_const_expr_comma ')'  */
+#line 3467 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_bool));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8195 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 602: /* const_expr: KW_SHORT '(' optional_const_expr_comma ')'  */
+#line 3473 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_int,
+                                        CPPSimpleType::F_short));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8206 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 603: /* const_expr: KW_LONG '(' optional_const_expr_comma ')'  */
+#line 3480 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_int,
+                                        CPPSimpleType::F_long));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8217 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 604: /* const_expr: KW_UNSIGNED '(' optional_const_expr_comma ')'  */
+#line 3487 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_int,
+                                        CPPSimpleType::F_unsigned));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8228 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 605: /* const_expr: KW_SIGNED '(' optional_const_expr_comma ')'  */
+#line 3494 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_int,
+                                        CPPSimpleType::F_signed));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8239 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 606: /* const_expr: KW_FLOAT '(' optional_const_expr_comma ')'  */
+#line 3501 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_float));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8249 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 607: /* const_expr: KW_DOUBLE '(' optional_const_expr_comma ')'  */
+#line 3507 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type =
+    CPPType::new_type(new CPPSimpleType(CPPSimpleType::T_double));
+  (yyval.u.expr) = new CPPExpression(CPPExpression::construct_op(type, (yyvsp[-1].u.expr)));
+}
+#line 8259 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 608: /* const_expr: KW_SIZEOF '(' full_type ')'  */
+#line 3513 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func((yyvsp[-1].u.type)));
+}
+#line 8267 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 609: /* const_expr: KW_SIZEOF '(' IDENTIFIER ')'  */
+#line 3517 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *arg = (yyvsp[-1].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (arg == nullptr) {
+    yyerror("undefined sizeof argument: " + (yyvsp[-1].u.identifier)->get_fully_scoped_name(), (yylsp[-1]));
+  } else if (arg->get_subtype() == CPPDeclaration::ST_instance) {
+    CPPInstance *inst = arg->as_instance();
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(inst->_type));
+  } else {
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(arg->as_type()));
+  }
+}
+#line 8283 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 610: /* const_expr: KW_SIZEOF ELLIPSIS '(' name ')'  */
+#line 3529 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_ellipsis_func((yyvsp[-1].u.identifier)));
+}
+#line 8291 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 611: /* const_expr: KW_ALIGNOF '(' full_type ')'  */
+#line 3533 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::alignof_func((yyvsp[-1].u.type)));
+}
+#line 8299 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 612: /* const_expr: KW_NEW predefined_type  */
+#line 3537 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::new_op((yyvsp[0].u.type)));
+}
+#line 8307 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 613: /* const_expr: KW_NEW predefined_type '(' optional_const_expr_comma ')'  */
+#line 3541 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::new_op((yyvsp[-3].u.type), (yyvsp[-1].u.expr)));
+}
+#line 8315 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 614: /* const_expr: KW_TYPEID '(' full_type ')'  */
+#line 3545 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPIdentifier ident("");
+  ident.add_name("std");
+  ident.add_name("type_info");
+  CPPType *std_type_info = ident.find_type(current_scope, global_scope, false, current_lexer);
+  if (!std_type_info) {
+    yywarning("cannot use typeid before including <typeinfo>", (yylsp[-3]));
+  }
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typeid_op((yyvsp[-1].u.type), std_type_info));
+}
+#line 8330 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 615: /* const_expr: KW_TYPEID '(' const_expr ')'  */
+#line 3556 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPIdentifier ident("");
+  ident.add_name("std");
+  ident.add_name("type_info");
+  CPPType *std_type_info = ident.find_type(current_scope, global_scope, false, current_lexer);
+  if (!std_type_info) {
+    yywarning("cannot use typeid before including <typeinfo>", (yylsp[-3]));
+  }
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typeid_op((yyvsp[-1].u.expr), std_type_info));
+}
+#line 8345 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 616: /* const_expr: '!' const_expr  */
+#line 3567 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NOT, (yyvsp[0].u.expr));
+}
+#line 8353 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 617: /* const_expr: '~' const_expr  */
+#line 3571 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NEGATE, (yyvsp[0].u.expr));
+}
+#line 8361 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 618: /* const_expr: '-' const_expr  */
+#line 3575 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_MINUS, (yyvsp[0].u.expr));
+}
+#line 8369 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 619: /* const_expr: '+' const_expr  */
+#line 3579 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_PLUS, (yyvsp[0].u.expr));
+}
+#line 8377 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 620: /* const_expr: '*' const_expr  */
+#line 3583 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_STAR, (yyvsp[0].u.expr));
+}
+#line 8385 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 621: /* const_expr: '&' const_expr  */
+#line 3587 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_REF, (yyvsp[0].u.expr));
+}
+#line 8393 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 622: /* const_expr: const_expr '*' const_expr  */
+#line 3591 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('*', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8401 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 623: /* const_expr: const_expr '/' const_expr  */
+#line 3595 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('/', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8409 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 624: /* const_expr: const_expr '%' const_expr  */
+#line 3599 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('%', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8417 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 625: /* const_expr: const_expr '+' const_expr  */
+#line 3603 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('+', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8425 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 626: /* const_expr: const_expr '-' const_expr  */
+#line 3607 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('-', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8433 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 627: /* const_expr: const_expr '|' const_expr  */
+#line 3611 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('|', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8441 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 628: /* const_expr: const_expr '^' const_expr  */
+#line 3615 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('^', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8449 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 629: /* const_expr: const_expr '&' const_expr  */
+#line 3619 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('&', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8457 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 630: /* const_expr: const_expr OROR const_expr  */
+#line 3623 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(OROR, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8465 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 631: /* const_expr: const_expr ANDAND const_expr  */
+#line 3627 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(ANDAND, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8473 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 632: /* const_expr: const_expr EQCOMPARE const_expr  */
+#line 3631 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(EQCOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8481 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 633: /* const_expr: const_expr NECOMPARE const_expr  */
+#line 3635 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(NECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8489 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 634: /* const_expr: const_expr LECOMPARE const_expr  */
+#line 3639 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8497 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 635: /* const_expr: const_expr GECOMPARE const_expr  */
+#line 3643 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(GECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8505 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 636: /* const_expr: const_expr '<' const_expr  */
+#line 3647 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('<', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8513 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 637: /* const_expr: const_expr '>' const_expr  */
+#line 3651 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('>', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8521 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 638: /* const_expr: const_expr LSHIFT const_expr  */
+#line 3655 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8529 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 639: /* const_expr: const_expr RSHIFT const_expr  */
+#line 3659 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(RSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8537 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 640: /* const_expr: const_expr '?' const_expr ':' const_expr  */
+#line 3663 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('?', (yyvsp[-4].u.expr), (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8545 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 641: /* const_expr: const_expr '[' const_expr ']'  */
+#line 3667 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('[', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 8553 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 642: /* const_expr: const_expr '(' const_expr_comma ')'  */
+#line 3671 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 8561 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 643: /* const_expr: const_expr '(' ')'  */
+#line 3675 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-2].u.expr));
+}
+#line 8569 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 644: /* const_expr: const_expr '.' const_expr  */
+#line 3679 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('.', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8577 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 645: /* const_expr: const_expr POINTSAT const_expr  */
+#line 3683 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(POINTSAT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 8585 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 646: /* const_expr: '(' const_expr_comma ')'  */
+#line 3687 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+}
+#line 8593 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 647: /* const_operand: INTEGER  */
+#line 3694 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.integer));
+}
+#line 8601 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 648: /* const_operand: KW_TRUE  */
+#line 3698 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(true);
+}
+#line 8609 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 649: /* const_operand: KW_FALSE  */
+#line 3702 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(false);
+}
+#line 8617 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 650: /* const_operand: CHAR_TOK  */
+#line 3706 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.integer));
+}
+#line 8625 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 651: /* const_operand: REAL  */
+#line 3710 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.real));
+}
+#line 8633 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 652: /* const_operand: string_literal  */
+#line 3714 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 8641 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 653: /* const_operand: CUSTOM_LITERAL  */
+#line 3718 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 8649 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 654: /* const_operand: IDENTIFIER  */
+#line 3722 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.identifier), current_scope, global_scope, current_lexer);
+}
+#line 8657 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 655: /* const_operand: KW_FINAL  */
+#line 3726 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A variable named "final".  C++11 explicitly permits this.
+  CPPIdentifier *ident = new CPPIdentifier("final", (yylsp[0]));
+  (yyval.u.expr) = new CPPExpression(ident, current_scope, global_scope, current_lexer);
+}
+#line 8667 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 656: /* const_operand: KW_OVERRIDE  */
+#line 3732 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A variable named "override".  C++11 explicitly permits this.
+  CPPIdentifier *ident = new CPPIdentifier("override", (yylsp[0]));
+  (yyval.u.expr) = new CPPExpression(ident, current_scope, global_scope, current_lexer);
+}
+#line 8677 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 657: /* const_operand: KW_NULLPTR  */
+#line 3738 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_nullptr());
+}
+#line 8685 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 658: /* const_operand: '[' capture_list ']' function_post maybe_trailing_return_type '{' code '}'  */
+#line 3742 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-6].u.closure_type)->_flags = (yyvsp[-4].u.integer);
+  (yyvsp[-6].u.closure_type)->_return_type = (yyvsp[-3].u.type);
+  (yyval.u.expr) = new CPPExpression(CPPExpression::lambda((yyvsp[-6].u.closure_type)));
+}
+#line 8695 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 659: /* const_operand: '[' capture_list ']' '(' function_parameter_list ')' function_post maybe_trailing_return_type '{' code '}'  */
+#line 3748 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyvsp[-9].u.closure_type)->_parameters = (yyvsp[-6].u.param_list);
+  (yyvsp[-9].u.closure_type)->_flags = (yyvsp[-4].u.integer);
+  (yyvsp[-9].u.closure_type)->_return_type = (yyvsp[-3].u.type);
+  (yyval.u.expr) = new CPPExpression(CPPExpression::lambda((yyvsp[-9].u.closure_type)));
+}
+#line 8706 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 660: /* const_operand: KW_HAS_VIRTUAL_DESTRUCTOR '(' full_type ')'  */
+#line 3755 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_HAS_VIRTUAL_DESTRUCTOR, (yyvsp[-1].u.type)));
+}
+#line 8714 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 661: /* const_operand: KW_IS_ABSTRACT '(' full_type ')'  */
+#line 3759 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_ABSTRACT, (yyvsp[-1].u.type)));
+}
+#line 8722 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 662: /* const_operand: KW_IS_BASE_OF '(' full_type ',' full_type ')'  */
+#line 3763 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_CLASS, (yyvsp[-3].u.type), (yyvsp[-1].u.type)));
+}
+#line 8730 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 663: /* const_operand: KW_IS_CLASS '(' full_type ')'  */
+#line 3767 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_CLASS, (yyvsp[-1].u.type)));
+}
+#line 8738 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 664: /* const_operand: KW_IS_CONSTRUCTIBLE '(' full_type ')'  */
+#line 3771 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_CONSTRUCTIBLE, (yyvsp[-1].u.type)));
+}
+#line 8746 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 665: /* const_operand: KW_IS_CONSTRUCTIBLE '(' full_type ',' full_type ')'  */
+#line 3775 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_CONSTRUCTIBLE, (yyvsp[-3].u.type), (yyvsp[-1].u.type)));
+}
+#line 8754 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 666: /* const_operand: KW_IS_CONVERTIBLE_TO '(' full_type ',' full_type ')'  */
+#line 3779 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_CONVERTIBLE_TO, (yyvsp[-3].u.type), (yyvsp[-1].u.type)));
+}
+#line 8762 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 667: /* const_operand: KW_IS_DESTRUCTIBLE '(' full_type ')'  */
+#line 3783 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_DESTRUCTIBLE, (yyvsp[-1].u.type)));
+}
+#line 8770 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 668: /* const_operand: KW_IS_EMPTY '(' full_type ')'  */
+#line 3787 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_EMPTY, (yyvsp[-1].u.type)));
+}
+#line 8778 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 669: /* const_operand: KW_IS_ENUM '(' full_type ')'  */
+#line 3791 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_ENUM, (yyvsp[-1].u.type)));
+}
+#line 8786 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 670: /* const_operand: KW_IS_FINAL '(' full_type ')'  */
+#line 3795 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_FINAL, (yyvsp[-1].u.type)));
+}
+#line 8794 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 671: /* const_operand: KW_IS_FUNDAMENTAL '(' full_type ')'  */
+#line 3799 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_FUNDAMENTAL, (yyvsp[-1].u.type)));
+}
+#line 8802 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 672: /* const_operand: KW_IS_POD '(' full_type ')'  */
+#line 3803 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_POD, (yyvsp[-1].u.type)));
+}
+#line 8810 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 673: /* const_operand: KW_IS_POLYMORPHIC '(' full_type ')'  */
+#line 3807 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_POLYMORPHIC, (yyvsp[-1].u.type)));
+}
+#line 8818 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 674: /* const_operand: KW_IS_STANDARD_LAYOUT '(' full_type ')'  */
+#line 3811 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_STANDARD_LAYOUT, (yyvsp[-1].u.type)));
+}
+#line 8826 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 675: /* const_operand: KW_IS_TRIVIAL '(' full_type ')'  */
+#line 3815 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_TRIVIAL, (yyvsp[-1].u.type)));
+}
+#line 8834 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 676: /* const_operand: KW_IS_UNION '(' full_type ')'  */
+#line 3819 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::type_trait(KW_IS_UNION, (yyvsp[-1].u.type)));
+}
+#line 8842 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 677: /* formal_const_expr: formal_const_operand  */
+#line 3833 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 8850 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 678: /* formal_const_expr: '(' full_type ')' const_expr  */
+#line 3837 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-2].u.type), (yyvsp[0].u.expr)));
+}
+#line 8858 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 679: /* formal_const_expr: KW_STATIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3841 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_static_cast));
+}
+#line 8866 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 680: /* formal_const_expr: KW_DYNAMIC_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3845 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_dynamic_cast));
+}
+#line 8874 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 681: /* formal_const_expr: KW_CONST_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3849 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_const_cast));
+}
+#line 8882 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 682: /* formal_const_expr: KW_REINTERPRET_CAST '<' full_type '>' '(' const_expr_comma ')'  */
+#line 3853 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typecast_op((yyvsp[-4].u.type), (yyvsp[-1].u.expr), CPPExpression::T_reinterpret_cast));
+}
+#line 8890 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 683: /* formal_const_expr: KW_SIZEOF '(' full_type ')'  */
+#line 3857 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func((yyvsp[-1].u.type)));
+}
+#line 8898 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 684: /* formal_const_expr: KW_SIZEOF '(' IDENTIFIER ')'  */
+#line 3861 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPDeclaration *arg = (yyvsp[-1].u.identifier)->find_symbol(current_scope, global_scope, current_lexer);
+  if (arg == nullptr) {
+    yyerror("undefined sizeof argument: " + (yyvsp[-1].u.identifier)->get_fully_scoped_name(), (yylsp[-1]));
+  } else if (arg->get_subtype() == CPPDeclaration::ST_instance) {
+    CPPInstance *inst = arg->as_instance();
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(inst->_type));
+  } else {
+    (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_func(arg->as_type()));
+  }
+}
+#line 8914 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 685: /* formal_const_expr: KW_SIZEOF ELLIPSIS '(' name ')'  */
+#line 3873 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::sizeof_ellipsis_func((yyvsp[-1].u.identifier)));
+}
+#line 8922 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 686: /* formal_const_expr: KW_ALIGNOF '(' full_type ')'  */
+#line 3877 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::alignof_func((yyvsp[-1].u.type)));
+}
+#line 8930 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 687: /* formal_const_expr: KW_NEW predefined_type  */
+#line 3881 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::new_op((yyvsp[0].u.type)));
+}
+#line 8938 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 688: /* formal_const_expr: KW_NEW predefined_type '(' optional_const_expr_comma ')'  */
+#line 3885 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::new_op((yyvsp[-3].u.type), (yyvsp[-1].u.expr)));
+}
+#line 8946 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 689: /* formal_const_expr: KW_TYPEID '(' full_type ')'  */
+#line 3889 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPIdentifier ident("");
+  ident.add_name("std");
+  ident.add_name("type_info");
+  CPPType *std_type_info = ident.find_type(current_scope, global_scope, false, current_lexer);
+  if (!std_type_info) {
+    yywarning("cannot use typeid before including <typeinfo>", (yylsp[-3]));
+  }
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typeid_op((yyvsp[-1].u.type), std_type_info));
+}
+#line 8961 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 690: /* formal_const_expr: KW_TYPEID '(' const_expr ')'  */
+#line 3900 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPIdentifier ident("");
+  ident.add_name("std");
+  ident.add_name("type_info");
+  CPPType *std_type_info = ident.find_type(current_scope, global_scope, false, current_lexer);
+  if (!std_type_info) {
+    yywarning("cannot use typeid before including <typeinfo>", (yylsp[-3]));
+  }
+  (yyval.u.expr) = new CPPExpression(CPPExpression::typeid_op((yyvsp[-1].u.expr), std_type_info));
+}
+#line 8976 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 691: /* formal_const_expr: '!' const_expr  */
+#line 3911 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NOT, (yyvsp[0].u.expr));
+}
+#line 8984 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 692: /* formal_const_expr: '~' const_expr  */
+#line 3915 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_NEGATE, (yyvsp[0].u.expr));
+}
+#line 8992 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 693: /* formal_const_expr: '-' const_expr  */
+#line 3919 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_MINUS, (yyvsp[0].u.expr));
+}
+#line 9000 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 694: /* formal_const_expr: '+' const_expr  */
+#line 3923 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_PLUS, (yyvsp[0].u.expr));
+}
+#line 9008 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 695: /* formal_const_expr: '&' const_expr  */
+#line 3927 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(UNARY_REF, (yyvsp[0].u.expr));
+}
+#line 9016 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 696: /* formal_const_expr: formal_const_expr '*' const_expr  */
+#line 3931 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('*', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9024 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 697: /* formal_const_expr: formal_const_expr '/' const_expr  */
+#line 3935 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('/', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9032 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 698: /* formal_const_expr: formal_const_expr '%' const_expr  */
+#line 3939 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('%', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9040 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 699: /* formal_const_expr: formal_const_expr '+' const_expr  */
+#line 3943 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('+', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9048 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 700: /* formal_const_expr: formal_const_expr '-' const_expr  */
+#line 3947 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('-', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9056 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 701: /* formal_const_expr: formal_const_expr '|' const_expr  */
+#line 3951 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('|', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9064 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 702: /* formal_const_expr: formal_const_expr '^' const_expr  */
+#line 3955 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('^', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9072 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 703: /* formal_const_expr: formal_const_expr '&' const_expr  */
+#line 3959 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('&', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9080 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 704: /* formal_const_expr: formal_const_expr OROR const_expr  */
+#line 3963 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(OROR, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9088 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 705: /* formal_const_expr: formal_const_expr ANDAND const_expr  */
+#line 3967 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(ANDAND, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9096 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 706: /* formal_const_expr: formal_const_expr EQCOMPARE const_expr  */
+#line 3971 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(EQCOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9104 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 707: /* formal_const_expr: formal_const_expr NECOMPARE const_expr  */
+#line 3975 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(NECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9112 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 708: /* formal_const_expr: formal_const_expr LECOMPARE const_expr  */
+#line 3979 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9120 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 709: /* formal_const_expr: formal_const_expr GECOMPARE const_expr  */
+#line 3983 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(GECOMPARE, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9128 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 710: /* formal_const_expr: formal_const_expr '<' const_expr  */
+#line 3987 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('<', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9136 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 711: /* formal_const_expr: formal_const_expr '>' const_expr  */
+#line 3991 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('>', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9144 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 712: /* formal_const_expr: formal_const_expr LSHIFT const_expr  */
+#line 3995 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(LSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9152 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 713: /* formal_const_expr: formal_const_expr RSHIFT const_expr  */
+#line 3999 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(RSHIFT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9160 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 714: /* formal_const_expr: formal_const_expr '?' const_expr ':' const_expr  */
+#line 4003 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('?', (yyvsp[-4].u.expr), (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9168 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 715: /* formal_const_expr: formal_const_expr '[' const_expr ']'  */
+#line 4007 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('[', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 9176 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 716: /* formal_const_expr: formal_const_expr '(' const_expr_comma ')'  */
+#line 4011 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-3].u.expr), (yyvsp[-1].u.expr));
+}
+#line 9184 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 717: /* formal_const_expr: formal_const_expr '(' ')'  */
+#line 4015 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('f', (yyvsp[-2].u.expr));
+}
+#line 9192 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 718: /* formal_const_expr: formal_const_expr '.' const_expr  */
+#line 4019 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression('.', (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9200 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 719: /* formal_const_expr: formal_const_expr POINTSAT const_expr  */
+#line 4023 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(POINTSAT, (yyvsp[-2].u.expr), (yyvsp[0].u.expr));
+}
+#line 9208 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 720: /* formal_const_expr: '(' const_expr_comma ')'  */
+#line 4027 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+}
+#line 9216 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 721: /* formal_const_operand: INTEGER  */
+#line 4034 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.integer));
+}
+#line 9224 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 722: /* formal_const_operand: KW_TRUE  */
+#line 4038 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(true);
+}
+#line 9232 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 723: /* formal_const_operand: KW_FALSE  */
+#line 4042 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(false);
+}
+#line 9240 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 724: /* formal_const_operand: CHAR_TOK  */
+#line 4046 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.integer));
+}
+#line 9248 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 725: /* formal_const_operand: REAL  */
+#line 4050 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.real));
+}
+#line 9256 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 726: /* formal_const_operand: string_literal  */
+#line 4054 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 9264 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 727: /* formal_const_operand: CUSTOM_LITERAL  */
+#line 4058 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 9272 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 728: /* formal_const_operand: IDENTIFIER  */
+#line 4062 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].u.identifier), current_scope, global_scope, current_lexer);
+}
+#line 9280 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 729: /* formal_const_operand: KW_FINAL  */
+#line 4066 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A variable named "final".  C++11 explicitly permits this.
+  CPPIdentifier *ident = new CPPIdentifier("final", (yylsp[0]));
+  (yyval.u.expr) = new CPPExpression(ident, current_scope, global_scope, current_lexer);
+}
+#line 9290 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 730: /* formal_const_operand: KW_OVERRIDE  */
+#line 4072 "dtool/src/cppparser/cppBison.yxx"
+{
+  // A variable named "override".  C++11 explicitly permits this.
+  CPPIdentifier *ident = new CPPIdentifier("override", (yylsp[0]));
+  (yyval.u.expr) = new CPPExpression(ident, current_scope, global_scope, current_lexer);
+}
+#line 9300 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 731: /* formal_const_operand: KW_NULLPTR  */
+#line 4078 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression(CPPExpression::get_nullptr());
+}
+#line 9308 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 732: /* capture_list: empty  */
+#line 4086 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.closure_type) = new CPPClosureType();
+}
+#line 9316 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 733: /* capture_list: '='  */
+#line 4090 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.closure_type) = new CPPClosureType(CPPClosureType::CT_by_value);
+}
+#line 9324 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 734: /* capture_list: '&'  */
+#line 4094 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.closure_type) = new CPPClosureType(CPPClosureType::CT_by_reference);
+}
+#line 9332 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 735: /* capture_list: capture maybe_initialize  */
+#line 4098 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.closure_type) = new CPPClosureType();
+  (yyvsp[-1].u.capture)->_initializer = (yyvsp[0].u.expr);
+  (yyval.u.closure_type)->_captures.push_back(*(yyvsp[-1].u.capture));
+  delete (yyvsp[-1].u.capture);
+}
+#line 9343 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 736: /* capture_list: capture_list ',' capture maybe_initialize  */
+#line 4105 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.closure_type) = (yyvsp[-3].u.closure_type);
+  (yyvsp[-1].u.capture)->_initializer = (yyvsp[0].u.expr);
+  (yyval.u.closure_type)->_captures.push_back(*(yyvsp[-1].u.capture));
+  delete (yyvsp[-1].u.capture);
+}
+#line 9354 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 737: /* capture: '&' name  */
+#line 4115 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.capture) = new CPPClosureType::Capture;
+  (yyval.u.capture)->_name = (yyvsp[0].u.identifier)->get_simple_name();
+  (yyval.u.capture)->_type = CPPClosureType::CT_by_reference;
+}
+#line 9364 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 738: /* capture: '&' name ELLIPSIS  */
+#line 4121 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.capture) = new CPPClosureType::Capture;
+  (yyval.u.capture)->_name = (yyvsp[-1].u.identifier)->get_simple_name();
+  (yyval.u.capture)->_type = CPPClosureType::CT_by_reference;
+}
+#line 9374 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 739: /* capture: name  */
+#line 4127 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.capture) = new CPPClosureType::Capture;
+  (yyval.u.capture)->_name = (yyvsp[0].u.identifier)->get_simple_name();
+  if ((yyval.u.capture)->_name == "this") {
+    (yyval.u.capture)->_type = CPPClosureType::CT_by_reference;
+  } else {
+    (yyval.u.capture)->_type = CPPClosureType::CT_by_value;
+  }
+}
+#line 9388 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 740: /* capture: '*' name  */
+#line 4137 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.capture) = new CPPClosureType::Capture;
+  (yyval.u.capture)->_name = (yyvsp[0].u.identifier)->get_simple_name();
+  (yyval.u.capture)->_type = CPPClosureType::CT_by_value;
+  if ((yyval.u.capture)->_name != "this") {
+    yywarning("only capture name 'this' may be preceded by an asterisk", (yylsp[0]));
+  }
+}
+#line 9401 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 741: /* class_derivation_name: name  */
+#line 4149 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPType *type = (yyvsp[0].u.identifier)->find_type(current_scope, global_scope, true);
+  if (type == nullptr) {
+    type = CPPType::new_type(new CPPTBDType((yyvsp[0].u.identifier)));
+  }
+  (yyval.u.type) = type;
+}
+#line 9413 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 742: /* class_derivation_name: KW_TYPENAME name  */
+#line 4157 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.type) = CPPType::new_type(new CPPTBDType((yyvsp[0].u.identifier)));
+}
+#line 9421 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 743: /* class_derivation_name: name ELLIPSIS  */
+#line 4161 "dtool/src/cppparser/cppBison.yxx"
+{
+  CPPClassTemplateParameter *ctp = new CPPClassTemplateParameter((yyvsp[-1].u.identifier));
+  ctp->_packed = true;
+  (yyval.u.type) = CPPType::new_type(ctp);
+}
+#line 9431 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 744: /* name: IDENTIFIER  */
+#line 4191 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9439 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 745: /* name: TYPENAME_IDENTIFIER  */
+#line 4195 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9447 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 746: /* name: TYPEPACK_IDENTIFIER  */
+#line 4199 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9455 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 747: /* name: KW_FINAL  */
+#line 4203 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("final", (yylsp[0]));
+}
+#line 9463 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 748: /* name: KW_OVERRIDE  */
+#line 4207 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("override", (yylsp[0]));
+}
+#line 9471 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 749: /* name: KW_SIGNED  */
+#line 4211 "dtool/src/cppparser/cppBison.yxx"
+{
+  // This is not a keyword in Python, so it is useful to be able to use this
+  // in MAKE_PROPERTY definitions, etc.
+  (yyval.u.identifier) = new CPPIdentifier("signed", (yylsp[0]));
+}
+#line 9481 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 750: /* name: KW_FLOAT  */
+#line 4217 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("float", (yylsp[0]));
+}
+#line 9489 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 751: /* name: KW_PUBLIC  */
+#line 4221 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("public", (yylsp[0]));
+}
+#line 9497 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 752: /* name: KW_PRIVATE  */
+#line 4225 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("private", (yylsp[0]));
+}
+#line 9505 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 753: /* name: KW_STATIC  */
+#line 4229 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("static", (yylsp[0]));
+}
+#line 9513 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 754: /* name: KW_DEFAULT  */
+#line 4233 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("default", (yylsp[0]));
+}
+#line 9521 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 755: /* name_no_final: IDENTIFIER  */
+#line 4244 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9529 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 756: /* name_no_final: TYPENAME_IDENTIFIER  */
+#line 4248 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9537 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 757: /* name_no_final: TYPEPACK_IDENTIFIER  */
+#line 4252 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = (yyvsp[0].u.identifier);
+}
+#line 9545 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 758: /* name_no_final: KW_OVERRIDE  */
+#line 4256 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.identifier) = new CPPIdentifier("override", (yylsp[0]));
+}
+#line 9553 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 759: /* string_literal: SIMPLE_STRING  */
+#line 4264 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = new CPPExpression((yyvsp[0].str));
+}
+#line 9561 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 760: /* string_literal: STRING_LITERAL  */
+#line 4268 "dtool/src/cppparser/cppBison.yxx"
+{
+  (yyval.u.expr) = (yyvsp[0].u.expr);
+}
+#line 9569 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 761: /* string_literal: string_literal SIMPLE_STRING  */
+#line 4272 "dtool/src/cppparser/cppBison.yxx"
+{
+  // The right string takes on the literal type of the left.
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+  (yyval.u.expr)->_str += (yyvsp[0].str);
+}
+#line 9579 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+  case 762: /* string_literal: string_literal STRING_LITERAL  */
+#line 4278 "dtool/src/cppparser/cppBison.yxx"
+{
+  // We have to check that the two literal types match up.
+  (yyval.u.expr) = (yyvsp[-1].u.expr);
+  if ((yyvsp[0].u.expr)->_type != CPPExpression::T_string && (yyvsp[0].u.expr)->_type != (yyvsp[-1].u.expr)->_type) {
+    yywarning("cannot concatenate two string literals of different types", (yyloc));
+  }
+  (yyval.u.expr)->_str += (yyvsp[0].u.expr)->_str;
+}
+#line 9592 "built-_gate_build/tmp/cppBison.yxx.c"
+    break;
+
+
+#line 9596 "built-_gate_build/tmp/cppBison.yxx.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
@@ -0,0 +1,322 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file dcbench.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "dcbase.h"
+#include "dcFile.h"
+#include "dcClass.h"
+#include "dcField.h"
+#include "dcPacker.h"
+#include "dcPython.h"
+
+#include "clockObject.h"
+#include "pvector.h"
+
+#include <iomanip>
+#include <string.h>
+
+using std::string;
+
+/**
+ * A benchmark of DCPacker.  It packs a typical value into each of several
+ * fields of bench.dc, then measures how many fields per second can be
+ * skipped, validated and (when Python is available) unpacked into and packed
+ * from Python objects, both one nested field at a time and with the
+ * DCCompiledField of each field (dc-compiled-fields).  Before it measures
+ * anything, it checks that both ways give byte-for-byte the same result.
+ *
+ * The "simple" fields are the fixed-size position and state updates that make
+ * up most of the traffic of a typical game; the "nested" fields contain
+ * strings, arrays, nested structs and switches.
+ *
+ * Run it as "dcbench [bench.dc [seconds]]".
+ */
+
+namespace {
+
+class Sample {
+public:
+  const char *_class_name;
+  const char *_field_name;
+  const char *_value;
+  bool _nested;
+};
+
+const Sample samples[] = {
+  { "DistributedObject", "setParent", "(4000)", false },
+  { "DistributedNode", "setX", "(12.3)", false },
+  { "DistributedNode", "setH", "(271.5)", false },
+  { "DistributedNode", "setXYZH", "(1.5, -2.5, 3.0, 90.0)", false },
+  { "DistributedNode", "setPos", "(1.0, 2.0, 3.0)", false },
+  { "DistributedNode", "setPosHpr", "(1.0, 2.0, 3.0, 45.0, 0.0, 0.0)", false },
+  { "DistributedNode", "setVelocity", "({0.5, 1.5, -2.0}, 100000)", false },
+  { "DistributedAvatar", "setHp", "(85, 100)", false },
+  { "DistributedAvatar", "setEquipment", "([1, 2, 3, 4, 5, 6, 7, 8])", false },
+
+  { "DistributedAvatar", "setName", "(\"Flippy McFlipperson\")", true },
+  { "DistributedAvatar", "setDNA", "({\"a\", 3, 2, 1, (1, 10, 5, 3, 7), 7, 7})", true },
+  { "DistributedAvatar", "setChat", "(\"Hello there!\", 1, 100000123)", true },
+  { "DistributedAvatar", "setAnimState", "(\"walk\", 1.0, 123456)", true },
+  { "DistributedAvatar", "setInventory",
+    "([{1, 2, 3}, {4, 5, 6}, {7, 8, 9}, {10, 11, 12}, {13, 14, 15}, {16, 17, 18}])", true },
+  { "DistributedAvatar", "setBuffs", "([{1, 10, 1000}, {2, -5, 2000}, {3, 1, 3000}])", true },
+  { "DistributedAvatar", "setFriendsList",
+    "([100001, 100002, 100003, 100004, 100005, 100006, 100007, 100008])", true },
+  { "DistributedAvatar", "setPath",
+    "([{0, 0, 0}, {10, 0, 0}, {10, 10, 0}, {0, 10, 5}], 5000)", true },
+  { "DistributedAvatar", "grantReward", "({(1, {7, 2, 0})}, 12345)", true },
+  { "DistributedAvatar", "grantReward", "({(2, \"Hero\", [{1, 2, 3}, {4, 5, 6}])}, 12345)", true },
+};
+const int num_samples = sizeof(samples) / sizeof(Sample);
+
+enum Operation {
+  O_skip,
+  O_validate,
+  O_unpack_object,
+  O_pack_object,
+};
+
+const char *const operation_names[] = {
+  "unpack_skip", "unpack_validate", "unpack_object", "pack_object",
+};
+
+class Entry {
+public:
+  const DCField *_field;
+  string _data;
+#ifdef HAVE_PYTHON
+  PyObject *_object;
+#endif
+};
+typedef pvector<Entry> Entries;
+
+}
+
+/**
+ * Performs the operation once on the indicated field.  Returns true on
+ * success, false if the packer reported an error.  If output is not NULL, it
+ * is filled with the result of the operation: the bytes that were unpacked,
+ * the repr() of the unpacked object, or the bytes that were packed.
+ */
+static bool
+run_once(Operation op, const Entry &entry, string *output = nullptr) {
+  DCPacker packer;
+  switch (op) {
+  case O_skip:
+  case O_validate:
+#ifdef HAVE_PYTHON
+  case O_unpack_object:
+#endif
+    packer.set_unpack_data(entry._data.data(), entry._data.size(), false);
+    packer.begin_unpack(entry._field);
+    if (op == O_skip) {
+      packer.unpack_skip();
+    } else if (op == O_validate) {
+      packer.unpack_validate();
+    } else {
+#ifdef HAVE_PYTHON
+      PyObject *object = packer.unpack_object();
+      if (output != nullptr && object != nullptr) {
+        PyObject *repr = PyObject_Repr(object);
+        if (repr != nullptr) {
+          *output = PyUnicode_AsUTF8(repr);
+          Py_DECREF(repr);
+        }
+      }
+      Py_XDECREF(object);
+#endif
+    }
+    if (output != nullptr && op != O_unpack_object) {
+      *output = entry._data.substr(0, packer.get_num_unpacked_bytes());
+    }
+    return packer.end_unpack();
+
+#ifdef HAVE_PYTHON
+  case O_pack_object:
+    packer.begin_pack(entry._field);
+    packer.pack_object(entry._object);
+    if (output != nullptr) {
+      *output = packer.get_string();
+    }
+    return packer.end_pack() && packer.get_length() == entry._data.size();
+#endif
+
+  default:
+    return false;
+  }
+}
+
+/**
+ * Performs the operation once on each of the indicated fields with and
+ * without compiled fields, and makes sure that both give the same result,
+ * byte for byte.  Returns false if they don't.
+ */
+static bool
+verify(Operation op, const Entries &entries) {
+  bool okflag = true;
+  Entries::const_iterator ei;
+  for (ei = entries.begin(); ei != entries.end(); ++ei) {
+    string generic, compiled;
+    dc_compiled_fields.set_value(false);
+    bool generic_ok = run_once(op, *ei, &generic);
+    dc_compiled_fields.set_value(true);
+    bool compiled_ok = run_once(op, *ei, &compiled);
+
+    if (generic_ok != compiled_ok || generic.size() != compiled.size() ||
+        memcmp(generic.data(), compiled.data(), generic.size()) != 0) {
+      nout << "Mismatch in " << operation_names[op] << " of "
+           << (*ei)._field->get_name() << ": generic gives " << generic.size()
+           << " bytes (" << (generic_ok ? "ok" : "error") << "), compiled gives "
+           << compiled.size() << " bytes (" << (compiled_ok ? "ok" : "error")
+           << ").\n";
+      okflag = false;
+    }
+  }
+  return okflag;
+}
+
+/**
+ * Repeats the operation over all of the indicated fields for at least the
+ * given number of seconds, and returns the number of fields per second, or 0
+ * if any of them failed.
+ */
+static double
+measure(Operation op, const Entries &entries, bool compiled, double seconds) {
+  dc_compiled_fields.set_value(compiled);
+
+  ClockObject *global_clock = ClockObject::get_global_clock();
+  double start = global_clock->get_real_time();
+  double elapsed = 0.0;
+  long num_fields = 0;
+  do {
+    for (int i = 0; i < 1000; ++i) {
+      Entries::const_iterator ei;
+      for (ei = entries.begin(); ei != entries.end(); ++ei) {
+        if (!run_once(op, *ei)) {
+          return 0.0;
+        }
+      }
+      num_fields += entries.size();
+    }
+    elapsed = global_clock->get_real_time() - start;
+  } while (elapsed < seconds);
+
+  return num_fields / elapsed;
+}
+
+/**
+ * Measures and reports the rate of the operation with and without compiled
+ * fields.
+ */
+static void
+report(Operation op, const string &label, const Entries &entries,
+       double seconds) {
+  double generic = measure(op, entries, false, seconds);
+  double compiled = measure(op, entries, true, seconds);
+
+  nout << "  " << std::left << std::setw(16) << label
+       << std::setw(16) << operation_names[op] << std::right << std::fixed
+       << std::setprecision(0) << std::setw(11) << generic << " -> "
+       << std::setw(11) << compiled << " fields/s";
+  if (generic > 0.0 && compiled > 0.0) {
+    nout << std::setprecision(2) << "  (" << compiled / generic << "x)";
+  } else {
+    nout << "  (failed)";
+  }
+  nout << "\n";
+}
+
+int
+main(int argc, char *argv[]) {
+  Filename filename = (argc > 1) ? Filename::from_os_specific(argv[1]) :
+    Filename("bench.dc");
+  double seconds = (argc > 2) ? atof(argv[2]) : 0.2;
+
+#ifdef HAVE_PYTHON
+  Py_Initialize();
+#endif
+
+  DCFile file;
+  if (!file.read(filename)) {
+    nout << "Unable to read " << filename << ".\n";
+    return 1;
+  }
+
+  Entries simple, nested, all;
+  for (int i = 0; i < num_samples; ++i) {
+    const Sample &sample = samples[i];
+    DCClass *dclass = file.get_class_by_name(sample._class_name);
+    DCField *field = (dclass == nullptr) ? nullptr :
+      dclass->get_field_by_name(sample._field_name);
+    if (field == nullptr) {
+      nout << "No field " << sample._class_name << "::"
+           << sample._field_name << " in " << filename << ".\n";
+      return 1;
+    }
+
+    DCPacker packer;
+    packer.begin_pack(field);
+    packer.parse_and_pack(sample._value);
+    if (!packer.end_pack()) {
+      nout << "Unable to pack " << sample._value << " into "
+           << sample._field_name << ".\n";
+      return 1;
+    }
+
+    Entry entry;
+    entry._field = field;
+    entry._data = packer.get_string();
+#ifdef HAVE_PYTHON
+    DCPacker unpacker;
+    unpacker.set_unpack_data(entry._data.data(), entry._data.size(), false);
+    unpacker.begin_unpack(field);
+    entry._object = unpacker.unpack_object();
+    unpacker.end_unpack();
+#endif
+    (sample._nested ? nested : simple).push_back(entry);
+    all.push_back(entry);
+  }
+
+  pvector<Operation> ops;
+  ops.push_back(O_skip);
+  ops.push_back(O_validate);
+#ifdef HAVE_PYTHON
+  ops.push_back(O_unpack_object);
+  ops.push_back(O_pack_object);
+#endif
+
+  bool okflag = true;
+  for (size_t j = 0; j < ops.size(); ++j) {
+    if (!verify(ops[j], all)) {
+      okflag = false;
+    }
+  }
+  if (!okflag) {
+    return 1;
+  }
+
+  nout << "Generic -> compiled, " << filename << ":\n";
+  for (size_t i = 0; i < all.size(); ++i) {
+    Entries one(1, all[i]);
+    for (size_t j = 0; j < ops.size(); ++j) {
+      report(ops[j], all[i]._field->get_name(), one, seconds);
+    }
+  }
+
+  nout << "\nTotals:\n";
+  for (size_t j = 0; j < ops.size(); ++j) {
+    report(ops[j], "simple", simple, seconds);
+    report(ops[j], "nested", nested, seconds);
+  }
+
+  return 0;
+}
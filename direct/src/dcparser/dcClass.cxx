@@ -59,6 +59,15 @@ ConfigVariableBool dc_sort_inheritance_by_file
           "rather than based on the order in which the references are made "
           "within the class."));
 
+ConfigVariableBool dc_compiled_fields
+("dc-compiled-fields", true,
+ PRC_DESC("Set this true to pack and unpack fields with nested fields, such "
+          "as the arguments of an atomic field, from a precompiled, "
+          "flattened description of the field, instead of visiting each "
+          "nested field in turn.  This is much faster, and should give "
+          "identical results; it may be turned off to rule it out when "
+          "debugging."));
+
 
 #endif  // WITHIN_PANDA
 
@@ -463,6 +472,27 @@ receive_update(PyObject *distobj, DatagramIterator &di) const {
 }
 #endif  // HAVE_PYTHON
 
+#ifdef HAVE_PYTHON
+/**
+ * Applies an update to the indicated field, whose arguments have already been
+ * located and validated, to the indicated object by calling the appropriate
+ * method.  This is used by CConnectionRepository for messages that were
+ * pre-parsed on its dispatch threads.
+ */
+void DCClass::
+receive_field_update(PyObject *distobj, const DCField *field,
+                     const char *data, size_t length) const {
+#ifdef WITHIN_PANDA
+  PStatTimer timer(((DCClass *)this)->_class_update_pcollector);
+#endif
+  DCPacker packer;
+  packer.set_unpack_data(data, length, false);
+  packer.begin_unpack(field);
+  field->receive_update(packer, distobj);
+  packer.end_unpack();
+}
+#endif  // HAVE_PYTHON
+
 #ifdef HAVE_PYTHON
 /**
  * Processes a big datagram that includes all of the "required" fields that
@@ -26,12 +26,14 @@
 extern ConfigVariableBool dc_multiple_inheritance;
 extern ConfigVariableBool dc_virtual_inheritance;
 extern ConfigVariableBool dc_sort_inheritance_by_file;
+extern ConfigVariableBool dc_compiled_fields;
 
 #else  // WITHIN_PANDA
 
 static const bool dc_multiple_inheritance = true;
 static const bool dc_virtual_inheritance = true;
 static const bool dc_sort_inheritance_by_file = false;
+static const bool dc_compiled_fields = true;
 
 #endif  // WITHIN_PANDA
 
@@ -120,6 +122,11 @@ PUBLISHED:
 #endif
 
 public:
+#ifdef HAVE_PYTHON
+  void receive_field_update(PyObject *distobj, const DCField *field,
+                            const char *data, size_t length) const;
+#endif
+
   virtual void output(std::ostream &out, bool brief) const;
   virtual void write(std::ostream &out, bool brief, int indent_level) const;
   void output_instance(std::ostream &out, bool brief, const std::string &prename,
@@ -0,0 +1,1269 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file dcCompiledField.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "dcCompiledField.h"
+#include "dcPacker.h"
+#include "dcPackData.h"
+#include "dcField.h"
+#include "dcParameter.h"
+#include "dcSimpleParameter.h"
+#include "dcClassParameter.h"
+#include "dcSwitchParameter.h"
+#include "dcSwitch.h"
+#include "dcClass.h"
+
+using std::string;
+
+// A field that would compile into more Ops than this is left to the generic
+// code; this guards against pathologically large structures.
+static const int max_compiled_ops = 4096;
+
+/**
+ * The compiled field is created only by DCPackerInterface::get_compiled().
+ */
+DCCompiledField::
+DCCompiledField(const DCPackerInterface *root) {
+  _valid = true;
+  r_compile_sequence(Fields(1, root));
+  if (!_valid) {
+    _ops.clear();
+    _cases.clear();
+  }
+}
+
+/**
+ *
+ */
+DCCompiledField::
+~DCCompiledField() {
+}
+
+/**
+ * Internally unpacks the field and validates all of its nested values
+ * against their range limits, exactly as DCPacker::unpack_validate() would.
+ */
+void DCCompiledField::
+unpack_validate(const char *data, size_t length, size_t &p,
+                bool &pack_error, bool &range_error) const {
+  nassertv(_valid);
+  r_validate(0, data, length, p, pack_error, range_error, true);
+}
+
+/**
+ * Increments p to the end of the field without unpacking it, exactly as
+ * DCPacker::unpack_skip() would.
+ */
+void DCCompiledField::
+unpack_skip(const char *data, size_t length, size_t &p,
+            bool &pack_error, bool &range_error) const {
+  nassertv(_valid);
+  r_validate(0, data, length, p, pack_error, range_error, false);
+}
+
+#if defined(HAVE_PYTHON) && PY_MAJOR_VERSION >= 3
+/**
+ * Unpacks the field into a Python object, the same object that
+ * DCPacker::unpack_object() would return.
+ */
+PyObject *DCCompiledField::
+unpack_object(const char *data, size_t length, size_t &p,
+              bool &pack_error, bool &range_error) const {
+  nassertr(_valid, nullptr);
+  const Op &op = _ops[0];
+  if (op._type != OT_run) {
+    return r_unpack_object(0, data, length, p, pack_error, range_error);
+  }
+
+  if (p + op._size > length) {
+    pack_error = true;
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  PyObject *object = r_unpack_fixed(1, data, length, p, pack_error, range_error);
+  p += op._size;
+  return object;
+}
+#endif  // HAVE_PYTHON
+
+#if defined(HAVE_PYTHON) && PY_MAJOR_VERSION >= 3
+/**
+ * Packs the Python object into the field, as DCPacker::pack_object() would.
+ */
+void DCCompiledField::
+pack_object(DCPackData &pack_data, PyObject *object,
+            bool &pack_error, bool &range_error) const {
+  nassertv(_valid);
+  Py_ssize_t k = 0;
+  r_pack_sequence(0, (int)_ops.size(), pack_data, &object, k,
+                  pack_error, range_error);
+}
+#endif  // HAVE_PYTHON
+
+/**
+ * Returns the indicated field as a DCSimpleParameter, or NULL if it is some
+ * other kind of field.
+ */
+const DCSimpleParameter *DCCompiledField::
+as_simple_parameter(const DCPackerInterface *field) {
+  const DCField *dc_field = field->as_field();
+  if (dc_field == nullptr) {
+    return nullptr;
+  }
+  const DCParameter *parameter = dc_field->as_parameter();
+  if (parameter == nullptr) {
+    return nullptr;
+  }
+  return parameter->as_simple_parameter();
+}
+
+/**
+ * Compiles the indicated sequence of sibling fields, grouping consecutive
+ * fields with a fixed layout into runs.
+ */
+void DCCompiledField::
+r_compile_sequence(const Fields &fields) {
+  size_t i = 0;
+  while (i < fields.size() && _valid) {
+    if (fields[i] == nullptr) {
+      _valid = false;
+
+    } else if (!is_fixed(fields[i])) {
+      r_compile(fields[i], false, 0);
+      ++i;
+
+    } else {
+      int index = (int)_ops.size();
+      Op op;
+      op._type = OT_run;
+      op._skip_mode = SM_fixed;
+      op._field = nullptr;
+      op._pack_type = PT_invalid;
+      op._plain_type = ST_invalid;
+      op._dclass = nullptr;
+      op._has_range_limits = false;
+      op._offset = 0;
+      op._size = 0;
+      op._num_length_bytes = 0;
+      op._count = 0;
+      op._first_case = 0;
+      op._default_case = -1;
+      op._num_ops = 0;
+      _ops.push_back(op);
+
+      size_t offset = 0;
+      bool has_range_limits = false;
+      while (i < fields.size() && fields[i] != nullptr && is_fixed(fields[i]) &&
+             _valid) {
+        r_compile(fields[i], true, offset);
+        offset += fields[i]->get_fixed_byte_size();
+        has_range_limits = has_range_limits || fields[i]->has_range_limits();
+        ++i;
+      }
+
+      Op &run = _ops[index];
+      run._size = offset;
+      run._has_range_limits = has_range_limits;
+      run._num_ops = (int)_ops.size() - index - 1;
+    }
+  }
+}
+
+/**
+ * Compiles the indicated field and all of its nested fields.  If fixed is
+ * true, the field is part of a run, at the indicated offset from the
+ * beginning of the run (or of the array element that contains it).
+ */
+void DCCompiledField::
+r_compile(const DCPackerInterface *field, bool fixed, size_t offset) {
+  if (field == nullptr || (int)_ops.size() >= max_compiled_ops) {
+    _valid = false;
+    return;
+  }
+
+  int index = (int)_ops.size();
+  const DCSimpleParameter *simple = as_simple_parameter(field);
+
+  Op op;
+  op._type = OT_struct;
+  op._field = field;
+  op._pack_type = field->get_pack_type();
+  op._plain_type = ST_invalid;
+  op._dclass = nullptr;
+  op._has_range_limits = field->has_range_limits();
+  op._offset = offset;
+  op._size = field->has_fixed_byte_size() ? field->get_fixed_byte_size() : 0;
+  op._num_length_bytes = field->get_num_length_bytes();
+  op._count = 0;
+  op._first_case = 0;
+  op._default_case = -1;
+  op._num_ops = 0;
+
+  // This mirrors the cases handled by the unpack_skip() implementations.
+  if (field->has_fixed_byte_size()) {
+    op._skip_mode = SM_fixed;
+  } else if (op._pack_type == PT_string || op._pack_type == PT_blob) {
+    op._skip_mode = SM_field;
+  } else if (simple == nullptr && field->has_nested_fields() &&
+             op._num_length_bytes != 0) {
+    op._skip_mode = SM_length;
+  } else {
+    op._skip_mode = SM_walk;
+  }
+
+  switch (op._pack_type) {
+  case PT_double:
+  case PT_int:
+  case PT_uint:
+  case PT_int64:
+  case PT_uint64:
+    if (!field->has_fixed_byte_size()) {
+      _valid = false;
+      return;
+    }
+    op._type = OT_number;
+    if (simple != nullptr && simple->get_divisor() == 1 &&
+        !simple->has_modulus() && !op._has_range_limits) {
+      DCSubatomicType type = simple->get_type();
+      switch (type) {
+      case ST_int8:
+      case ST_int16:
+      case ST_int32:
+        op._plain_type = (op._pack_type == PT_int) ? type : ST_invalid;
+        break;
+
+      case ST_uint8:
+      case ST_uint16:
+      case ST_uint32:
+        op._plain_type = (op._pack_type == PT_uint) ? type : ST_invalid;
+        break;
+
+      case ST_int64:
+        op._plain_type = (op._pack_type == PT_int64) ? type : ST_invalid;
+        break;
+
+      case ST_uint64:
+        op._plain_type = (op._pack_type == PT_uint64) ? type : ST_invalid;
+        break;
+
+      case ST_float64:
+        op._plain_type = (op._pack_type == PT_double) ? type : ST_invalid;
+        break;
+
+      default:
+        break;
+      }
+    }
+    break;
+
+  case PT_string:
+  case PT_blob:
+    op._type = OT_string;
+    if (simple != nullptr && !op._has_range_limits &&
+        op._num_length_bytes != 0) {
+      DCSubatomicType type = simple->get_type();
+      if (type == ST_string || type == ST_blob || type == ST_blob32) {
+        op._plain_type = type;
+      }
+    }
+    break;
+
+  case PT_array:
+  case PT_field:
+  case PT_class:
+    if (!field->has_nested_fields()) {
+      _valid = false;
+      return;
+    }
+    if (op._pack_type == PT_class) {
+      const DCClassParameter *class_param = field->as_class_parameter();
+      if (class_param != nullptr) {
+        op._dclass = class_param->get_class();
+      }
+    }
+    op._count = field->get_num_nested_fields();
+    if (op._num_length_bytes != 0) {
+      op._type = OT_array;
+    } else if (op._count < 0) {
+      _valid = false;
+      return;
+    } else if (fixed && op._pack_type == PT_array) {
+      op._type = OT_repeat;
+    } else {
+      op._type = OT_struct;
+    }
+    if (fixed && op._type == OT_array) {
+      _valid = false;
+      return;
+    }
+    break;
+
+  case PT_switch:
+    if (fixed || field->as_switch_parameter() == nullptr) {
+      _valid = false;
+      return;
+    }
+    op._type = OT_switch;
+    break;
+
+  default:
+    _valid = false;
+    return;
+  }
+
+  _ops.push_back(op);
+
+  switch (op._type) {
+  case OT_struct:
+    if (fixed) {
+      size_t child_offset = offset;
+      for (int i = 0; i < op._count && _valid; ++i) {
+        const DCPackerInterface *child = field->get_nested_field(i);
+        if (child == nullptr || !is_fixed(child)) {
+          _valid = false;
+        } else {
+          r_compile(child, true, child_offset);
+          child_offset += child->get_fixed_byte_size();
+        }
+      }
+    } else {
+      Fields children;
+      children.reserve(op._count);
+      for (int i = 0; i < op._count; ++i) {
+        children.push_back(field->get_nested_field(i));
+      }
+      r_compile_sequence(children);
+    }
+    break;
+
+  case OT_repeat:
+    {
+      // Each element is compiled at offset 0, relative to the beginning of
+      // the element.
+      const DCPackerInterface *element = field->get_nested_field(0);
+      if (element == nullptr || !is_fixed(element)) {
+        _valid = false;
+      } else {
+        r_compile(element, true, 0);
+      }
+    }
+    break;
+
+  case OT_array:
+    r_compile_sequence(Fields(1, field->get_nested_field(0)));
+    break;
+
+  case OT_switch:
+    {
+      // The key comes first, followed by the fields of each of the cases.
+      // Cases that share the same fields share the same Ops.
+      r_compile_sequence(Fields(1, field->get_nested_field(0)));
+
+      const DCSwitch *dswitch = field->as_switch_parameter()->get_switch();
+      CasePrograms programs;
+      Cases cases;
+      int num_cases = dswitch->get_num_cases();
+      for (int i = 0; i < num_cases && _valid; ++i) {
+        Case dcase;
+        compile_case(dswitch->get_case(i), dcase, programs);
+        dcase._value = dswitch->get_value(i);
+        cases.push_back(dcase);
+      }
+
+      Case default_case;
+      const DCPackerInterface *default_fields = dswitch->get_default_case();
+      if (default_fields != nullptr && _valid) {
+        compile_case(default_fields, default_case, programs);
+      }
+
+      Op &sw = _ops[index];
+      sw._first_case = (int)_cases.size();
+      sw._count = (int)cases.size();
+      _cases.insert(_cases.end(), cases.begin(), cases.end());
+      if (default_fields != nullptr) {
+        sw._default_case = (int)_cases.size();
+        _cases.push_back(default_case);
+      }
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  _ops[index]._num_ops = (int)_ops.size() - index - 1;
+}
+
+/**
+ * Compiles the fields of one case of a switch (other than the key, which is
+ * the first of them), unless the same fields have already been compiled for
+ * another case.
+ */
+void DCCompiledField::
+compile_case(const DCPackerInterface *case_fields, Case &dcase,
+             CasePrograms &programs) {
+  CasePrograms::const_iterator pi = programs.find(case_fields);
+  if (pi != programs.end()) {
+    dcase = (*pi).second;
+    return;
+  }
+
+  Fields fields;
+  int num_fields = case_fields->get_num_nested_fields();
+  for (int i = 1; i < num_fields; ++i) {
+    fields.push_back(case_fields->get_nested_field(i));
+  }
+
+  dcase._begin = (int)_ops.size();
+  r_compile_sequence(fields);
+  dcase._end = (int)_ops.size();
+  dcase._num_fields = num_fields;
+  programs[case_fields] = dcase;
+}
+
+/**
+ * Returns the case of the indicated switch Op that matches the packed key
+ * value, or the default case, or NULL if there is no match.
+ */
+const DCCompiledField::Case *DCCompiledField::
+find_case(const Op &op, const char *key, size_t key_length) const {
+  int end = op._first_case + op._count;
+  for (int i = op._first_case; i < end; ++i) {
+    const Case &dcase = _cases[i];
+    if (dcase._value.size() == key_length &&
+        memcmp(dcase._value.data(), key, key_length) == 0) {
+      return &dcase;
+    }
+  }
+  if (op._default_case >= 0) {
+    return &_cases[op._default_case];
+  }
+  return nullptr;
+}
+
+/**
+ * Skips the field of the indicated Op, or validates it if validate is true.
+ * Stops at the first pack error, as DCPacker does.
+ */
+void DCCompiledField::
+r_validate(int i, const char *data, size_t length, size_t &p,
+           bool &pack_error, bool &range_error, bool validate) const {
+  const Op &op = _ops[i];
+  if (!validate || !op._has_range_limits) {
+    switch (op._skip_mode) {
+    case SM_fixed:
+      p += op._size;
+      if (p > length) {
+        pack_error = true;
+      }
+      return;
+
+    case SM_length:
+      if (p + op._num_length_bytes > length) {
+        pack_error = true;
+        return;
+      }
+      if (op._num_length_bytes == 4) {
+        p += 4 + DCPackerInterface::do_unpack_uint32(data + p);
+      } else {
+        p += 2 + DCPackerInterface::do_unpack_uint16(data + p);
+      }
+      if (p > length) {
+        pack_error = true;
+      }
+      return;
+
+    case SM_field:
+      if (!op._field->unpack_skip(data, length, p, pack_error)) {
+        pack_error = true;
+      }
+      return;
+
+    case SM_walk:
+      break;
+    }
+  }
+
+  switch (op._type) {
+  case OT_run:
+    {
+      if (p + op._size > length) {
+        pack_error = true;
+        return;
+      }
+      int end = next_op(i);
+      for (int j = i + 1; j < end; j = next_op(j)) {
+        r_validate_fixed(j, data, length, p, pack_error, range_error);
+      }
+      p += op._size;
+    }
+    break;
+
+  case OT_number:
+  case OT_string:
+    if (!op._field->unpack_validate(data, length, p, pack_error, range_error)) {
+      pack_error = true;
+    }
+    break;
+
+  case OT_struct:
+    {
+      int end = next_op(i);
+      for (int j = i + 1; j < end && !pack_error; j = next_op(j)) {
+        r_validate(j, data, length, p, pack_error, range_error, validate);
+      }
+    }
+    break;
+
+  case OT_repeat:
+    for (int k = 0; k < op._count && !pack_error; ++k) {
+      r_validate(i + 1, data, length, p, pack_error, range_error, validate);
+    }
+    break;
+
+  case OT_array:
+    {
+      if (p + op._num_length_bytes > length) {
+        pack_error = true;
+        return;
+      }
+      size_t array_length;
+      if (op._num_length_bytes == 4) {
+        array_length = DCPackerInterface::do_unpack_uint32(data + p);
+      } else {
+        array_length = DCPackerInterface::do_unpack_uint16(data + p);
+      }
+      p += op._num_length_bytes;
+      size_t end = p + array_length;
+      int num_elements = (array_length == 0) ? 0 :
+        op._field->calc_num_nested_fields(array_length);
+
+      int k = 0;
+      const Op &element = _ops[i + 1];
+      if (num_elements >= 0 && element._type == OT_run) {
+        // The elements have a fixed layout, so we can check the length of
+        // the whole array at once.
+        if (end > length) {
+          pack_error = true;
+          return;
+        }
+        if (validate && element._has_range_limits) {
+          for (; k < num_elements; ++k) {
+            r_validate_fixed(i + 2, data, length, p + k * element._size,
+                             pack_error, range_error);
+          }
+        }
+        k = num_elements;
+        p += num_elements * element._size;
+
+      } else {
+        while ((num_elements < 0 || k < num_elements) && p < end &&
+               !pack_error) {
+          r_validate(i + 1, data, length, p, pack_error, range_error, validate);
+          ++k;
+        }
+      }
+
+      if (!pack_error &&
+          (p != end || !op._field->validate_num_nested_fields(k))) {
+        pack_error = true;
+      }
+    }
+    break;
+
+  case OT_switch:
+    {
+      size_t key_start = p;
+      r_validate(i + 1, data, length, p, pack_error, range_error, validate);
+      if (pack_error) {
+        return;
+      }
+      const Case *dcase = find_case(op, data + key_start, p - key_start);
+      if (dcase == nullptr) {
+        // This means an invalid value was packed for the key.
+        range_error = true;
+        return;
+      }
+      for (int j = dcase->_begin; j < dcase->_end && !pack_error; j = next_op(j)) {
+        r_validate(j, data, length, p, pack_error, range_error, validate);
+      }
+    }
+    break;
+  }
+}
+
+/**
+ * Validates the field of the indicated Op, which is part of a run or an array
+ * element beginning at base.  The caller has already ensured that the whole
+ * run is within the buffer.
+ */
+void DCCompiledField::
+r_validate_fixed(int i, const char *data, size_t length, size_t base,
+                 bool &pack_error, bool &range_error) const {
+  const Op &op = _ops[i];
+  if (!op._has_range_limits) {
+    return;
+  }
+
+  size_t q = base + op._offset;
+  switch (op._type) {
+  case OT_number:
+  case OT_string:
+    if (!op._field->unpack_validate(data, length, q, pack_error, range_error)) {
+      pack_error = true;
+    }
+    break;
+
+  case OT_struct:
+    {
+      int end = next_op(i);
+      for (int j = i + 1; j < end; j = next_op(j)) {
+        r_validate_fixed(j, data, length, base, pack_error, range_error);
+      }
+    }
+    break;
+
+  case OT_repeat:
+    {
+      size_t stride = _ops[i + 1]._size;
+      for (int k = 0; k < op._count; ++k) {
+        r_validate_fixed(i + 1, data, length, q + k * stride,
+                         pack_error, range_error);
+      }
+    }
+    break;
+
+  default:
+    pack_error = true;
+    break;
+  }
+}
+
+#if defined(HAVE_PYTHON) && PY_MAJOR_VERSION >= 3
+/**
+ * Unpacks the fields of the Ops in the range [begin, end), appending one
+ * object per field to the list.  Stops at the first pack error.
+ */
+void DCCompiledField::
+r_unpack_sequence(int begin, int end, const char *data, size_t length,
+                  size_t &p, bool &pack_error, bool &range_error,
+                  PyObject *list) const {
+  for (int j = begin; j < end && !pack_error; j = next_op(j)) {
+    const Op &op = _ops[j];
+    if (op._type == OT_run) {
+      if (p + op._size > length) {
+        pack_error = true;
+        return;
+      }
+      int run_end = next_op(j);
+      for (int c = j + 1; c < run_end; c = next_op(c)) {
+        PyObject *element = r_unpack_fixed(c, data, length, p,
+                                           pack_error, range_error);
+        PyList_Append(list, element);
+        Py_DECREF(element);
+      }
+      p += op._size;
+
+    } else {
+      PyObject *element = r_unpack_object(j, data, length, p,
+                                          pack_error, range_error);
+      PyList_Append(list, element);
+      Py_DECREF(element);
+    }
+  }
+}
+
+/**
+ * Unpacks the field of the indicated Op, which is not part of a run, and
+ * returns a new reference to the resulting object.
+ */
+PyObject *DCCompiledField::
+r_unpack_object(int i, const char *data, size_t length, size_t &p,
+                bool &pack_error, bool &range_error) const {
+  const Op &op = _ops[i];
+  if (op._type == OT_number || op._type == OT_string) {
+    return unpack_leaf(op, data, length, p, pack_error, range_error);
+  }
+  if (op._dclass != nullptr && op._dclass->has_class_def()) {
+    return unpack_generic(op, data, length, p, pack_error, range_error);
+  }
+
+  PyObject *object = PyList_New(0);
+  switch (op._type) {
+  case OT_struct:
+    r_unpack_sequence(i + 1, next_op(i), data, length, p,
+                      pack_error, range_error, object);
+    break;
+
+  case OT_repeat:
+    for (int k = 0; k < op._count && !pack_error; ++k) {
+      r_unpack_sequence(i + 1, next_op(i), data, length, p,
+                        pack_error, range_error, object);
+    }
+    break;
+
+  case OT_array:
+    {
+      if (p + op._num_length_bytes > length) {
+        pack_error = true;
+        break;
+      }
+      size_t array_length;
+      if (op._num_length_bytes == 4) {
+        array_length = DCPackerInterface::do_unpack_uint32(data + p);
+      } else {
+        array_length = DCPackerInterface::do_unpack_uint16(data + p);
+      }
+      p += op._num_length_bytes;
+      size_t end = p + array_length;
+      int num_elements = (array_length == 0) ? 0 :
+        op._field->calc_num_nested_fields(array_length);
+
+      int k = 0;
+      const Op &element = _ops[i + 1];
+      if (num_elements >= 0 && element._type == OT_run) {
+        // The elements have a fixed layout, so we can check the length of
+        // the whole array at once.
+        if (end > length) {
+          pack_error = true;
+          break;
+        }
+        for (; k < num_elements; ++k) {
+          PyObject *item = r_unpack_fixed(i + 2, data, length,
+                                          p + k * element._size,
+                                          pack_error, range_error);
+          PyList_Append(object, item);
+          Py_DECREF(item);
+        }
+        p += num_elements * element._size;
+
+      } else {
+        while ((num_elements < 0 || k < num_elements) && p < end &&
+               !pack_error) {
+          r_unpack_sequence(i + 1, next_op(i), data, length, p,
+                            pack_error, range_error, object);
+          ++k;
+        }
+      }
+
+      if (!pack_error &&
+          (p != end || !op._field->validate_num_nested_fields(k))) {
+        pack_error = true;
+      }
+    }
+    break;
+
+  case OT_switch:
+    {
+      size_t key_start = p;
+      r_unpack_sequence(i + 1, next_op(i + 1), data, length, p,
+                        pack_error, range_error, object);
+      if (pack_error) {
+        break;
+      }
+      const Case *dcase = find_case(op, data + key_start, p - key_start);
+      if (dcase == nullptr) {
+        range_error = true;
+        break;
+      }
+      r_unpack_sequence(dcase->_begin, dcase->_end, data, length, p,
+                        pack_error, range_error, object);
+    }
+    break;
+
+  default:
+    break;
+  }
+
+  if (op._pack_type != PT_array) {
+    PyObject *tuple = PyList_AsTuple(object);
+    Py_DECREF(object);
+    object = tuple;
+  }
+  return object;
+}
+
+/**
+ * Unpacks the field of the indicated Op, which is part of a run or an array
+ * element beginning at base, and returns a new reference to the resulting
+ * object.  The caller has already ensured that the whole run is within the
+ * buffer.
+ */
+PyObject *DCCompiledField::
+r_unpack_fixed(int i, const char *data, size_t length, size_t base,
+               bool &pack_error, bool &range_error) const {
+  const Op &op = _ops[i];
+  size_t q = base + op._offset;
+
+  switch (op._type) {
+  case OT_number:
+  case OT_string:
+    return unpack_leaf(op, data, length, q, pack_error, range_error);
+
+  case OT_struct:
+    {
+      if (op._dclass != nullptr && op._dclass->has_class_def()) {
+        return unpack_generic(op, data, length, q, pack_error, range_error);
+      }
+      PyObject *tuple = PyTuple_New(op._count);
+      int end = next_op(i);
+      int k = 0;
+      for (int j = i + 1; j < end; j = next_op(j)) {
+        PyTuple_SET_ITEM(tuple, k++, r_unpack_fixed(j, data, length, base,
+                                                    pack_error, range_error));
+      }
+      return tuple;
+    }
+
+  case OT_repeat:
+    {
+      PyObject *list = PyList_New(op._count);
+      size_t stride = _ops[i + 1]._size;
+      for (int k = 0; k < op._count; ++k) {
+        PyList_SET_ITEM(list, k, r_unpack_fixed(i + 1, data, length,
+                                                q + k * stride,
+                                                pack_error, range_error));
+      }
+      return list;
+    }
+
+  default:
+    pack_error = true;
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+}
+
+/**
+ * Unpacks a numeric or string field and returns a new reference to the
+ * resulting object.  If the field has a plain numeric type, the caller must
+ * already have ensured that it is within the buffer.
+ */
+PyObject *DCCompiledField::
+unpack_leaf(const Op &op, const char *data, size_t length, size_t &p,
+            bool &pack_error, bool &range_error) const {
+  const char *buffer = data + p;
+  switch (op._plain_type) {
+  case ST_int8:
+    p += 1;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_int8(buffer));
+
+  case ST_int16:
+    p += 2;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_int16(buffer));
+
+  case ST_int32:
+    p += 4;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_int32(buffer));
+
+  case ST_int64:
+    p += 8;
+    return PyLong_FromLongLong(DCPackerInterface::do_unpack_int64(buffer));
+
+  case ST_uint8:
+    p += 1;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_uint8(buffer));
+
+  case ST_uint16:
+    p += 2;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_uint16(buffer));
+
+  case ST_uint32:
+    p += 4;
+    return PyLong_FromLong(DCPackerInterface::do_unpack_uint32(buffer));
+
+  case ST_uint64:
+    p += 8;
+    return PyLong_FromUnsignedLongLong(DCPackerInterface::do_unpack_uint64(buffer));
+
+  case ST_float64:
+    p += 8;
+    return PyFloat_FromDouble(DCPackerInterface::do_unpack_float64(buffer));
+
+  case ST_string:
+  case ST_blob:
+  case ST_blob32:
+    {
+      // A string with a length prefix and no length limits, which we can
+      // convert directly from the buffer.
+      const char *str = data + p;
+      size_t string_length = 0;
+      if (p + op._num_length_bytes > length) {
+        pack_error = true;
+      } else {
+        if (op._num_length_bytes == 4) {
+          string_length = DCPackerInterface::do_unpack_uint32(buffer);
+        } else {
+          string_length = DCPackerInterface::do_unpack_uint16(buffer);
+        }
+        p += op._num_length_bytes;
+        if (p + string_length > length) {
+          pack_error = true;
+          string_length = 0;
+        } else {
+          str = data + p;
+          p += string_length;
+        }
+      }
+      PyObject *object;
+      if (op._pack_type == PT_blob) {
+        object = PyBytes_FromStringAndSize(str, string_length);
+      } else {
+        object = PyUnicode_FromStringAndSize(str, string_length);
+      }
+      if (object == nullptr) {
+        PyErr_Clear();
+        pack_error = true;
+        Py_INCREF(Py_None);
+        object = Py_None;
+      }
+      return object;
+    }
+
+  default:
+    break;
+  }
+
+  const DCPackerInterface *field = op._field;
+  PyObject *object = nullptr;
+  switch (op._pack_type) {
+  case PT_double:
+    {
+      double value = 0.0;
+      field->unpack_double(data, length, p, value, pack_error, range_error);
+      object = PyFloat_FromDouble(value);
+    }
+    break;
+
+  case PT_int:
+    {
+      int value = 0;
+      field->unpack_int(data, length, p, value, pack_error, range_error);
+      object = PyLong_FromLong(value);
+    }
+    break;
+
+  case PT_uint:
+    {
+      unsigned int value = 0;
+      field->unpack_uint(data, length, p, value, pack_error, range_error);
+      object = PyLong_FromLong(value);
+    }
+    break;
+
+  case PT_int64:
+    {
+      int64_t value = 0;
+      field->unpack_int64(data, length, p, value, pack_error, range_error);
+      object = PyLong_FromLongLong(value);
+    }
+    break;
+
+  case PT_uint64:
+    {
+      uint64_t value = 0;
+      field->unpack_uint64(data, length, p, value, pack_error, range_error);
+      object = PyLong_FromUnsignedLongLong(value);
+    }
+    break;
+
+  case PT_blob:
+    {
+      string str;
+      field->unpack_string(data, length, p, str, pack_error, range_error);
+      object = PyBytes_FromStringAndSize(str.data(), str.size());
+    }
+    break;
+
+  default:
+    {
+      string str;
+      field->unpack_string(data, length, p, str, pack_error, range_error);
+      object = PyUnicode_FromStringAndSize(str.data(), str.size());
+    }
+    break;
+  }
+
+  if (object == nullptr) {
+    // This can happen if a string is not valid UTF-8.
+    PyErr_Clear();
+    pack_error = true;
+    Py_INCREF(Py_None);
+    object = Py_None;
+  }
+  return object;
+}
+
+/**
+ * Unpacks the field of the indicated Op with a DCPacker of its own.  This is
+ * used for fields that become class objects rather than tuples.
+ */
+PyObject *DCCompiledField::
+unpack_generic(const Op &op, const char *data, size_t length, size_t &p,
+               bool &pack_error, bool &range_error) const {
+  DCPacker packer;
+  packer.set_unpack_data(data, length, false);
+  packer._unpack_p = p;
+  packer.begin_unpack(op._field);
+  PyObject *object = packer.do_unpack_object();
+  p = packer._unpack_p;
+  pack_error = pack_error || packer._pack_error;
+  range_error = range_error || packer._range_error;
+  packer.end_unpack();
+
+  if (object == nullptr) {
+    Py_INCREF(Py_None);
+    object = Py_None;
+  }
+  return object;
+}
+
+/**
+ * Packs items[k], items[k + 1], ... into the fields of the Ops in the range
+ * [begin, end), incrementing k past each item it packs.  The caller must
+ * have ensured that there are enough items.
+ */
+void DCCompiledField::
+r_pack_sequence(int begin, int end, DCPackData &pack_data,
+                PyObject **items, Py_ssize_t &k,
+                bool &pack_error, bool &range_error) const {
+  for (int j = begin; j < end && !pack_error; j = next_op(j)) {
+    if (_ops[j]._type == OT_run) {
+      int run_end = next_op(j);
+      for (int c = j + 1; c < run_end && !pack_error; c = next_op(c)) {
+        r_pack_object(c, pack_data, items[k++], pack_error, range_error);
+      }
+    } else {
+      r_pack_object(j, pack_data, items[k++], pack_error, range_error);
+    }
+  }
+}
+
+/**
+ * Packs the object into the field of the indicated Op.  Only tuples and lists
+ * of exactly the expected number of items are packed here; anything else is
+ * handed to a DCPacker, which knows how to report the problem, or how to
+ * pack a class object.
+ */
+void DCCompiledField::
+r_pack_object(int i, DCPackData &pack_data, PyObject *object,
+              bool &pack_error, bool &range_error) const {
+  const Op &op = _ops[i];
+  if (op._type == OT_number || op._type == OT_string) {
+    if (!pack_leaf(op, pack_data, object, pack_error, range_error)) {
+      pack_generic(op, pack_data, object, pack_error, range_error);
+    }
+    return;
+  }
+
+  if ((op._dclass != nullptr && op._dclass->has_class_def()) ||
+      (!PyTuple_Check(object) && !PyList_Check(object))) {
+    pack_generic(op, pack_data, object, pack_error, range_error);
+    return;
+  }
+
+  // Take a tuple of the items, so that a list can't change underneath us if
+  // a nested class object runs Python code.
+  PyObject *sequence;
+  if (PyList_Check(object)) {
+    sequence = PyList_AsTuple(object);
+  } else {
+    sequence = object;
+    Py_INCREF(sequence);
+  }
+  Py_ssize_t size = PyTuple_GET_SIZE(sequence);
+  PyObject **items = &PyTuple_GET_ITEM(sequence, 0);
+
+  switch (op._type) {
+  case OT_struct:
+    if (size != op._count) {
+      pack_generic(op, pack_data, object, pack_error, range_error);
+    } else {
+      Py_ssize_t k = 0;
+      r_pack_sequence(i + 1, next_op(i), pack_data, items, k,
+                      pack_error, range_error);
+    }
+    break;
+
+  case OT_repeat:
+    if (size != op._count) {
+      pack_generic(op, pack_data, object, pack_error, range_error);
+    } else {
+      for (Py_ssize_t k = 0; k < size && !pack_error; ++k) {
+        r_pack_object(i + 1, pack_data, items[k], pack_error, range_error);
+      }
+    }
+    break;
+
+  case OT_array:
+    if (op._count >= 0 && size != op._count) {
+      pack_generic(op, pack_data, object, pack_error, range_error);
+    } else {
+      size_t push_marker = pack_data.get_length();
+      pack_data.append_junk(op._num_length_bytes);
+
+      int end = next_op(i);
+      Py_ssize_t k = 0;
+      while (k < size && !pack_error) {
+        r_pack_sequence(i + 1, end, pack_data, items, k,
+                        pack_error, range_error);
+      }
+
+      // Now go back and fill in the length of the array.
+      size_t length = pack_data.get_length() - push_marker - op._num_length_bytes;
+      if (op._num_length_bytes == 4) {
+        DCPackerInterface::do_pack_uint32
+          (pack_data.get_rewrite_pointer(push_marker, 4), length);
+      } else {
+        DCPackerInterface::validate_uint_limits(length, 16, range_error);
+        DCPackerInterface::do_pack_uint16
+          (pack_data.get_rewrite_pointer(push_marker, 2), length);
+      }
+      if (!op._field->validate_num_nested_fields((int)size)) {
+        pack_error = true;
+      }
+    }
+    break;
+
+  case OT_switch:
+    if (size == 0) {
+      pack_generic(op, pack_data, object, pack_error, range_error);
+    } else {
+      size_t key_start = pack_data.get_length();
+      Py_ssize_t k = 0;
+      r_pack_sequence(i + 1, next_op(i + 1), pack_data, items, k,
+                      pack_error, range_error);
+      if (pack_error) {
+        break;
+      }
+      const Case *dcase = find_case(op, pack_data.get_data() + key_start,
+                                    pack_data.get_length() - key_start);
+      if (dcase == nullptr) {
+        // An invalid value was packed for the key, so there are no fields
+        // for the rest of the items.
+        range_error = true;
+        if (size > 1) {
+          pack_error = true;
+        }
+      } else if (size != dcase->_num_fields) {
+        pack_error = true;
+      } else {
+        r_pack_sequence(dcase->_begin, dcase->_end, pack_data, items, k,
+                        pack_error, range_error);
+      }
+    }
+    break;
+
+  default:
+    pack_error = true;
+    break;
+  }
+
+  Py_DECREF(sequence);
+}
+
+/**
+ * Packs a numeric, string or bytes object into a numeric or string field,
+ * converting it the same way DCPacker::pack_object() does.  Returns false if
+ * the object is of some other type.
+ */
+bool DCCompiledField::
+pack_leaf(const Op &op, DCPackData &pack_data, PyObject *object,
+          bool &pack_error, bool &range_error) const {
+  const DCPackerInterface *field = op._field;
+
+  if (PyLong_Check(object)) {
+    switch (op._pack_type) {
+    case PT_int64:
+      field->pack_int64(pack_data, PyLong_AsLongLong(object), pack_error, range_error);
+      break;
+
+    case PT_uint64:
+      field->pack_uint64(pack_data, PyLong_AsUnsignedLongLong(object), pack_error, range_error);
+      break;
+
+    case PT_uint:
+      field->pack_uint(pack_data, PyLong_AsUnsignedLong(object), pack_error, range_error);
+      break;
+
+    default:
+      field->pack_int(pack_data, PyLong_AsLong(object), pack_error, range_error);
+      break;
+    }
+    return true;
+
+  } else if (PyFloat_Check(object)) {
+    field->pack_double(pack_data, PyFloat_AS_DOUBLE(object), pack_error, range_error);
+    return true;
+
+  } else if (PyUnicode_Check(object)) {
+    Py_ssize_t length;
+    const char *buffer = PyUnicode_AsUTF8AndSize(object, &length);
+    if (buffer == nullptr) {
+      pack_error = true;
+    } else if (op._type == OT_string && op._plain_type != ST_invalid) {
+      pack_plain_string(op, pack_data, buffer, length, range_error);
+    } else {
+      field->pack_string(pack_data, string(buffer, length), pack_error, range_error);
+    }
+    return true;
+
+  } else if (PyBytes_Check(object)) {
+    char *buffer;
+    Py_ssize_t length;
+    if (PyBytes_AsStringAndSize(object, &buffer, &length) != 0) {
+      pack_error = true;
+    } else if (op._type == OT_string && op._plain_type != ST_invalid) {
+      pack_plain_string(op, pack_data, buffer, length, range_error);
+    } else {
+      const unsigned char *ubuffer = (const unsigned char *)buffer;
+      field->pack_blob(pack_data, vector_uchar(ubuffer, ubuffer + length),
+                       pack_error, range_error);
+    }
+    return true;
+  }
+
+  return false;
+}
+
+/**
+ * Packs the string into a string field with a plain type, writing the length
+ * prefix and the bytes directly, as DCSimpleParameter::pack_string() would.
+ */
+void DCCompiledField::
+pack_plain_string(const Op &op, DCPackData &pack_data, const char *buffer,
+                  size_t length, bool &range_error) const {
+  if (op._num_length_bytes == 4) {
+    DCPackerInterface::do_pack_uint32(pack_data.get_write_pointer(4), length);
+  } else {
+    DCPackerInterface::validate_uint_limits(length, 16, range_error);
+    DCPackerInterface::do_pack_uint16(pack_data.get_write_pointer(2), length);
+  }
+  pack_data.append_data(buffer, length);
+}
+
+/**
+ * Packs the object into the field of the indicated Op with a DCPacker of its
+ * own, which handles the cases that the compiled field doesn't.
+ */
+void DCCompiledField::
+pack_generic(const Op &op, DCPackData &pack_data, PyObject *object,
+             bool &pack_error, bool &range_error) const {
+  DCPacker packer;
+  packer.begin_pack(op._field);
+  packer.do_pack_object(object);
+  packer.end_pack();
+  pack_error = pack_error || packer._pack_error;
+  range_error = range_error || packer._range_error;
+  pack_data.append_data(packer.get_data(), packer.get_length());
+}
+#endif  // HAVE_PYTHON
@@ -0,0 +1,184 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file dcCompiledField.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef DCCOMPILEDFIELD_H
+#define DCCOMPILEDFIELD_H
+
+#include "dcbase.h"
+#include "dcPackerInterface.h"
+#include "dcSubatomicType.h"
+#include "dcPython.h"
+
+class DCPackData;
+class DCClass;
+class DCSimpleParameter;
+
+/**
+ * This is a precompiled form of a field with nested fields, which DCPacker
+ * uses to validate, skip, pack or unpack the whole field in one pass, instead
+ * of calling push(), pop() and a virtual method for each nested field.
+ *
+ * The nested fields are flattened into a list of Ops in prefix order, each of
+ * which knows how many of the following Ops belong to it.  Consecutive fields
+ * with a fixed layout are grouped into a run, within which each field has a
+ * precomputed byte offset, so that the length of the buffer is checked once
+ * for the whole run and plain numeric values are decoded directly.
+ *
+ * It is created on demand when it is first requested from a particular field;
+ * its ownership is retained by the field so it must not be deleted.  A field
+ * that cannot be compiled (for instance, because it contains a type that the
+ * compiler doesn't understand) gets an invalid DCCompiledField, and is then
+ * handled by DCPacker the usual way.
+ */
+class EXPCL_DIRECT_DCPARSER DCCompiledField {
+private:
+  DCCompiledField(const DCPackerInterface *root);
+  ~DCCompiledField();
+
+public:
+  INLINE bool is_valid() const;
+  INLINE int get_num_ops() const;
+
+  void unpack_validate(const char *data, size_t length, size_t &p,
+                       bool &pack_error, bool &range_error) const;
+  void unpack_skip(const char *data, size_t length, size_t &p,
+                   bool &pack_error, bool &range_error) const;
+
+#if defined(HAVE_PYTHON) && PY_MAJOR_VERSION >= 3
+  PyObject *unpack_object(const char *data, size_t length, size_t &p,
+                          bool &pack_error, bool &range_error) const;
+  void pack_object(DCPackData &pack_data, PyObject *object,
+                   bool &pack_error, bool &range_error) const;
+#endif
+
+private:
+  enum OpType {
+    OT_run,     // A group of consecutive fields with a fixed layout.
+    OT_number,  // A numeric field.
+    OT_string,  // A string or blob field.
+    OT_struct,  // A fixed number of nested fields of various types.
+    OT_repeat,  // A fixed-size array with no length prefix.
+    OT_array,   // An array with a length prefix.
+    OT_switch,  // A switch key followed by the fields of the selected case.
+  };
+
+  // How to skip over a field (or validate one that has no range limits).
+  enum SkipMode {
+    SM_fixed,   // Jump over _size bytes.
+    SM_length,  // Jump over the length prefix and the bytes it counts.
+    SM_field,   // Ask the field to skip itself.
+    SM_walk,    // Skip each of the nested fields in turn.
+  };
+
+  class Op {
+  public:
+    OpType _type;
+    SkipMode _skip_mode;
+    const DCPackerInterface *_field;
+    DCPackType _pack_type;
+
+    // For a numeric field that needs no scaling or range checks, or a string
+    // with a length prefix and no length limits, this is its type, so that it
+    // can be converted inline; otherwise ST_invalid.
+    DCSubatomicType _plain_type;
+
+    // For a class parameter, the class it represents, which may have a
+    // Python class definition by the time the field is unpacked.
+    const DCClass *_dclass;
+
+    bool _has_range_limits;
+
+    // Within a run or an element of an OT_repeat, this is the byte offset of
+    // the field relative to the beginning of the run or element.
+    size_t _offset;
+    size_t _size;
+    size_t _num_length_bytes;
+
+    // The number of nested fields (OT_struct, OT_repeat, OT_array), or the
+    // number of cases (OT_switch).
+    int _count;
+    int _first_case;
+    int _default_case;
+
+    // The number of Ops following this one that belong to it.
+    int _num_ops;
+  };
+  typedef pvector<Op> Ops;
+
+  // Each case of a switch refers to the range of Ops that packs the fields
+  // following the key.
+  class Case {
+  public:
+    vector_uchar _value;
+    int _begin;
+    int _end;
+    int _num_fields;
+  };
+  typedef pvector<Case> Cases;
+
+  typedef pvector<const DCPackerInterface *> Fields;
+  typedef pmap<const DCPackerInterface *, Case> CasePrograms;
+
+  INLINE int next_op(int i) const;
+  static INLINE bool is_fixed(const DCPackerInterface *field);
+  static const DCSimpleParameter *as_simple_parameter(const DCPackerInterface *field);
+
+  void r_compile_sequence(const Fields &fields);
+  void r_compile(const DCPackerInterface *field, bool fixed, size_t offset);
+  void compile_case(const DCPackerInterface *case_fields, Case &dcase,
+                    CasePrograms &programs);
+  const Case *find_case(const Op &op, const char *key, size_t key_length) const;
+
+  void r_validate(int i, const char *data, size_t length, size_t &p,
+                  bool &pack_error, bool &range_error, bool validate) const;
+  void r_validate_fixed(int i, const char *data, size_t length, size_t base,
+                        bool &pack_error, bool &range_error) const;
+
+#if defined(HAVE_PYTHON) && PY_MAJOR_VERSION >= 3
+  void r_unpack_sequence(int begin, int end, const char *data, size_t length,
+                         size_t &p, bool &pack_error, bool &range_error,
+                         PyObject *list) const;
+  PyObject *r_unpack_object(int i, const char *data, size_t length, size_t &p,
+                            bool &pack_error, bool &range_error) const;
+  PyObject *r_unpack_fixed(int i, const char *data, size_t length, size_t base,
+                           bool &pack_error, bool &range_error) const;
+  PyObject *unpack_leaf(const Op &op, const char *data, size_t length,
+                        size_t &p, bool &pack_error, bool &range_error) const;
+  PyObject *unpack_generic(const Op &op, const char *data, size_t length,
+                           size_t &p, bool &pack_error, bool &range_error) const;
+
+  void r_pack_sequence(int begin, int end, DCPackData &pack_data,
+                       PyObject **items, Py_ssize_t &k,
+                       bool &pack_error, bool &range_error) const;
+  void r_pack_object(int i, DCPackData &pack_data, PyObject *object,
+                     bool &pack_error, bool &range_error) const;
+  bool pack_leaf(const Op &op, DCPackData &pack_data, PyObject *object,
+                 bool &pack_error, bool &range_error) const;
+  void pack_plain_string(const Op &op, DCPackData &pack_data,
+                         const char *buffer, size_t length,
+                         bool &range_error) const;
+  void pack_generic(const Op &op, DCPackData &pack_data, PyObject *object,
+                    bool &pack_error, bool &range_error) const;
+#endif
+
+private:
+  bool _valid;
+  Ops _ops;
+  Cases _cases;
+
+  friend class DCPackerInterface;
+};
+
+#include "dcCompiledField.I"
+
+#endif
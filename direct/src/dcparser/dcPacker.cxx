@@ -18,6 +18,7 @@
 #include "dcClassParameter.h"
 #include "dcSwitchParameter.h"
 #include "dcClass.h"
+#include "dcCompiledField.h"
 
 #ifdef HAVE_PYTHON
 #include "py_panda.h"
@@ -29,8 +30,20 @@ using std::ostream;
 using std::ostringstream;
 using std::string;
 
-DCPacker::StackElement *DCPacker::StackElement::_deleted_chain = nullptr;
-int DCPacker::StackElement::_num_ever_allocated = 0;
+thread_local DCPacker::StackElement *DCPacker::StackElement::_deleted_chain = nullptr;
+std::atomic<int> DCPacker::StackElement::_num_ever_allocated(0);
+
+/**
+ * Returns the compiled form of the indicated field, or NULL if it should be
+ * packed or unpacked one nested field at a time.
+ */
+static inline const DCCompiledField *
+get_compiled_field(const DCPackerInterface *field) {
+  if (field == nullptr || !field->has_nested_fields() || !dc_compiled_fields) {
+    return nullptr;
+  }
+  return field->get_compiled();
+}
 
 /**
  *
@@ -581,9 +594,17 @@ unpack_validate() {
     _pack_error = true;
 
   } else {
+    const DCCompiledField *compiled;
     if (_current_field->unpack_validate(_unpack_data, _unpack_length, _unpack_p,
                                         _pack_error, _range_error)) {
       advance();
+
+    } else if ((compiled = get_compiled_field(_current_field)) != nullptr &&
+               compiled_unpack(compiled, true)) {
+      // The field can't validate itself in one step, but it has been
+      // compiled, which is much faster than walking through it below.
+      advance_compiled();
+
     } else {
       // If the single field couldn't be validated, try validating nested
       // fields.
@@ -607,10 +628,15 @@ unpack_skip() {
     _pack_error = true;
 
   } else {
+    const DCCompiledField *compiled;
     if (_current_field->unpack_skip(_unpack_data, _unpack_length, _unpack_p,
                                     _pack_error)) {
       advance();
 
+    } else if ((compiled = get_compiled_field(_current_field)) != nullptr &&
+               compiled_unpack(compiled, false)) {
+      advance_compiled();
+
     } else {
       // If the single field couldn't be skipped, try skipping nested fields.
       push();
@@ -632,6 +658,40 @@ unpack_skip() {
 void DCPacker::
 pack_object(PyObject *object) {
   nassertv(_mode == M_pack || _mode == M_repack);
+
+#if PY_MAJOR_VERSION >= 3
+  if (_mode == M_pack) {
+    const DCCompiledField *compiled = get_compiled_field(_current_field);
+    if (compiled != nullptr) {
+      size_t start = _pack_data.get_length();
+      bool pack_error = false;
+      bool range_error = false;
+      compiled->pack_object(_pack_data, object, pack_error, range_error);
+      if (!pack_error && !range_error && !PyErr_Occurred()) {
+        advance_compiled();
+        return;
+      }
+
+      // Something is wrong with the object.  Start over, and let the code
+      // below work out exactly what, so that the errors and the data packed
+      // so far are the same as without the compiled field.
+      _pack_data.truncate(start);
+      PyErr_Clear();
+    }
+  }
+#endif
+
+  do_pack_object(object);
+}
+#endif  // HAVE_PYTHON
+
+#ifdef HAVE_PYTHON
+/**
+ * The implementation of pack_object() that handles the current field one
+ * nested field at a time, rather than with its DCCompiledField.
+ */
+void DCPacker::
+do_pack_object(PyObject *object) {
   DCPackType pack_type = get_pack_type();
 
   // had to add this for basic 64 and unsigned data to get packed right .. Not
@@ -818,6 +878,41 @@ pack_object(PyObject *object) {
  */
 PyObject *DCPacker::
 unpack_object() {
+#if PY_MAJOR_VERSION >= 3
+  if (_mode == M_unpack) {
+    const DCCompiledField *compiled = get_compiled_field(_current_field);
+    if (compiled != nullptr) {
+      size_t p = _unpack_p;
+      bool pack_error = false;
+      bool range_error = false;
+      PyObject *object = compiled->unpack_object(_unpack_data, _unpack_length,
+                                                 p, pack_error, range_error);
+      if (!pack_error && !range_error && object != nullptr) {
+        _unpack_p = p;
+        advance_compiled();
+        return object;
+      }
+
+      // The data is malformed.  Start over, and let the code below work out
+      // exactly how, so that the errors and the partial object are the same
+      // as without the compiled field.
+      Py_XDECREF(object);
+      PyErr_Clear();
+    }
+  }
+#endif
+
+  return do_unpack_object();
+}
+#endif  // HAVE_PYTHON
+
+#ifdef HAVE_PYTHON
+/**
+ * The implementation of unpack_object() that handles the current field one
+ * nested field at a time, rather than with its DCCompiledField.
+ */
+PyObject *DCPacker::
+do_unpack_object() {
   PyObject *object = nullptr;
 
   DCPackType pack_type = get_pack_type();
@@ -1207,6 +1302,32 @@ clear_stack() {
   }
 }
 
+/**
+ * Validates or skips the current field with its compiled form, and returns
+ * true if the data was good.  If it was not, leaves the unpack position where
+ * it was and returns false, so that the caller can walk through the nested
+ * fields instead; this way, the errors, and how much of the data is consumed,
+ * are the same as without the compiled field.
+ */
+bool DCPacker::
+compiled_unpack(const DCCompiledField *compiled, bool validate) {
+  size_t p = _unpack_p;
+  bool pack_error = false;
+  bool range_error = false;
+  if (validate) {
+    compiled->unpack_validate(_unpack_data, _unpack_length, p,
+                              pack_error, range_error);
+  } else {
+    compiled->unpack_skip(_unpack_data, _unpack_length, p,
+                          pack_error, range_error);
+  }
+  if (pack_error || range_error) {
+    return false;
+  }
+  _unpack_p = p;
+  return true;
+}
+
 #ifdef HAVE_PYTHON
 /**
  * Given that the current element is a ClassParameter for a Python class
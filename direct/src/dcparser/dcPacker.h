@@ -21,7 +21,10 @@
 #include "dcPackerCatalog.h"
 #include "dcPython.h"
 
+#include <atomic>
+
 class DCClass;
+class DCCompiledField;
 class DCSwitchParameter;
 
 /**
@@ -191,11 +194,15 @@ public:
 
 private:
   INLINE void advance();
+  INLINE void advance_compiled();
   void handle_switch(const DCSwitchParameter *switch_parameter);
   void clear();
   void clear_stack();
+  bool compiled_unpack(const DCCompiledField *compiled, bool validate);
 
 #ifdef HAVE_PYTHON
+  void do_pack_object(PyObject *object);
+  PyObject *do_unpack_object();
   void pack_class_object(const DCClass *dclass, PyObject *object);
   PyObject *unpack_class_object(const DCClass *dclass);
   void set_class_element(PyObject *class_def, PyObject *&object,
@@ -236,8 +243,10 @@ private:
     size_t _pop_marker;
     StackElement *_next;
 
-    static StackElement *_deleted_chain;
-    static int _num_ever_allocated;
+    // Each thread keeps its own free list, so that DCPackers may be used on
+    // several threads at once.  The count is shared by all of them.
+    static thread_local StackElement *_deleted_chain;
+    static std::atomic<int> _num_ever_allocated;
   };
   StackElement *_stack;
 
@@ -258,6 +267,8 @@ private:
   bool _parse_error;
   bool _pack_error;
   bool _range_error;
+
+  friend class DCCompiledField;
 };
 
 #include "dcPacker.I"
@@ -13,6 +13,7 @@
 
 #include "dcPackerInterface.h"
 #include "dcPackerCatalog.h"
+#include "dcCompiledField.h"
 #include "dcField.h"
 #include "dcParserDefs.h"
 #include "dcLexerDefs.h"
@@ -35,6 +36,7 @@ DCPackerInterface(const string &name) :
   _num_nested_fields = -1;
   _pack_type = PT_invalid;
   _catalog = nullptr;
+  _compiled = nullptr;
 }
 
 /**
@@ -53,6 +55,7 @@ DCPackerInterface(const DCPackerInterface &copy) :
   _pack_type(copy._pack_type)
 {
   _catalog = nullptr;
+  _compiled = nullptr;
 }
 
 /**
@@ -63,6 +66,10 @@ DCPackerInterface::
   if (_catalog != nullptr) {
     delete _catalog;
   }
+  DCCompiledField *compiled = _compiled.load();
+  if (compiled != nullptr) {
+    delete compiled;
+  }
 }
 
 /**
@@ -391,6 +398,35 @@ get_catalog() const {
   return _catalog;
 }
 
+/**
+ * Returns the DCCompiledField associated with this field, which DCPacker uses
+ * to pack and unpack it in one pass, or NULL if this field has no nested
+ * fields or could not be compiled.  Unlike get_catalog(), this may safely be
+ * called by several threads at once.
+ */
+const DCCompiledField *DCPackerInterface::
+get_compiled() const {
+  if (!_has_nested_fields || _pack_type == PT_string || _pack_type == PT_blob) {
+    return nullptr;
+  }
+
+  DCCompiledField *compiled = _compiled.load(std::memory_order_acquire);
+  if (compiled == nullptr) {
+    // Another thread may be compiling it at the same time; the first one to
+    // finish wins, and the other throws its copy away.
+    DCCompiledField *new_compiled = new DCCompiledField(this);
+    std::atomic<DCCompiledField *> &ptr = ((DCPackerInterface *)this)->_compiled;
+    if (ptr.compare_exchange_strong(compiled, new_compiled,
+                                    std::memory_order_acq_rel)) {
+      compiled = new_compiled;
+    } else {
+      delete new_compiled;
+    }
+  }
+
+  return compiled->is_valid() ? compiled : nullptr;
+}
+
 /**
  * Returns true if this field matches the indicated simple parameter, false
  * otherwise.
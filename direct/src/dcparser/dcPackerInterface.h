@@ -18,6 +18,8 @@
 #include "dcSubatomicType.h"
 #include "vector_uchar.h"
 
+#include <atomic>
+
 class DCFile;
 class DCField;
 class DCSimpleParameter;
@@ -28,6 +30,7 @@ class DCAtomicField;
 class DCMolecularField;
 class DCPackData;
 class DCPackerCatalog;
+class DCCompiledField;
 
 BEGIN_PUBLISH
 // This enumerated type is returned by get_pack_type() and represents the best
@@ -170,6 +173,7 @@ public:
                                             bool &range_error);
 
   const DCPackerCatalog *get_catalog() const;
+  const DCCompiledField *get_compiled() const;
 
 protected:
   virtual bool do_check_match(const DCPackerInterface *other) const=0;
@@ -201,6 +205,10 @@ protected:
 
 private:
   DCPackerCatalog *_catalog;
+
+  // This is created the first time get_compiled() is called, possibly by
+  // several threads at once.
+  std::atomic<DCCompiledField *> _compiled;
 };
 
 #include "dcPackerInterface.I"
@@ -3,6 +3,7 @@
 #include "hashGenerator.cxx"
 #include "dcAtomicField.cxx"
 #include "dcClass.cxx"
+#include "dcCompiledField.cxx"
 #include "dcDeclaration.cxx"
 #include "dcKeyword.cxx"
 #include "dcKeywordList.cxx"
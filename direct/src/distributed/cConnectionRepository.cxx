@@ -23,6 +23,8 @@
 #include "datagramIterator.h"
 #include "throw_event.h"
 #include "pStatTimer.h"
+#include "mutexHolder.h"
+#include "string_utils.h"
 
 #ifdef HAVE_PYTHON
 #include "py_panda.h"
@@ -37,12 +39,19 @@ const string CConnectionRepository::_overflow_event_name = "CRDatagramOverflow";
 PStatCollector CConnectionRepository::_update_pcollector("App:Show code:readerPollTask:Update");
 #endif  // CPPPARSER
 
+// The longest time a dispatch thread blocks on the socket while holding
+// _read_lock, so that the main thread is not kept out for long.
+static const double dispatch_block = 0.01;
+
 /**
  *
  */
 CConnectionRepository::
 CConnectionRepository(bool has_owner_view, bool threaded_net) :
   _lock("CConnectionRepository::_lock"),
+  _read_lock("CConnectionRepository::_read_lock"),
+  _dispatch_lock("CConnectionRepository::_dispatch_lock"),
+  _dispatch_cvar(_dispatch_lock),
 #ifdef HAVE_PYTHON
   _python_repository(nullptr),
 #endif
@@ -51,7 +60,7 @@ CConnectionRepository(bool has_owner_view, bool threaded_net) :
 #endif
 #ifdef HAVE_NET
   _cw(&_qcm, threaded_net ? 1 : 0),
-  _qcr(&_qcm, threaded_net ? 1 : 0),
+  _qcr(this, &_qcm, threaded_net ? 1 : 0),
 #endif
 #ifdef WANT_NATIVE_NET
   _bdc(4096000,4096000,1400),
@@ -65,6 +74,13 @@ CConnectionRepository(bool has_owner_view, bool threaded_net) :
 // _msg_channels(),
   _msg_sender(0),
   _msg_type(0),
+  _msg_field(nullptr),
+  _msg_args_index(0),
+  _next_read_seq(0),
+  _next_apply_seq(0),
+  _dispatch_generation(0),
+  _dispatch_connected(false),
+  _dispatch_shutdown(false),
   _has_owner_view(has_owner_view),
   _handle_c_updates(true),
   _want_message_bundling(true),
@@ -77,6 +93,10 @@ CConnectionRepository(bool has_owner_view, bool threaded_net) :
   }
 #endif
   _tcp_header_size = tcp_header_size;
+
+  if (cr_dispatch_threads > 0) {
+    set_num_dispatch_threads(cr_dispatch_threads);
+  }
 }
 
 /**
@@ -85,6 +105,7 @@ CConnectionRepository(bool has_owner_view, bool threaded_net) :
 CConnectionRepository::
 ~CConnectionRepository() {
   disconnect();
+  stop_dispatch_threads();
 }
 
 /**
@@ -109,6 +130,58 @@ set_tcp_header_size(int tcp_header_size) {
 #endif
 }
 
+/**
+ * Starts the indicated number of threads to read datagrams from the
+ * connection as they arrive.  Each thread parses the message header and, for
+ * a field update, looks up the field and validates its arguments with a
+ * DCPacker.  Messages are still returned by check_datagram() in the order
+ * they were received.
+ *
+ * This takes the reading of the socket, the parsing of the header and the
+ * lookup of the field off the main thread.  The arguments are still unpacked
+ * on the main thread, since they are unpacked directly into the Python
+ * objects that the update method is called with, and those can only be
+ * created while holding the GIL.  The validation on the threads is therefore
+ * extra work; it only means that the main thread can skip the field lookup
+ * and that a malformed update takes the ordinary path, which reports it.
+ *
+ * Most of the gain is in not having to poll the socket on the main thread.
+ * If the repository was created with threaded_net, the socket is already
+ * read on a thread of its own, and handing each message over once more costs
+ * the main thread more than the header parsing that it saves.
+ *
+ * This only applies to connections made with try_connect_net() or
+ * connect_native(); an HTTP connection is always read by check_datagram()
+ * itself.  Set this to 0 to stop the threads again.  This requires true
+ * threads; it has no effect in a build with SIMPLE_THREADS or without
+ * threading support.
+ */
+void CConnectionRepository::
+set_num_dispatch_threads(int num_threads) {
+  ReMutexHolder holder(_lock);
+
+  stop_dispatch_threads();
+  if (num_threads <= 0) {
+    return;
+  }
+
+  if (!Thread::is_true_threads()) {
+    distributed_cat.warning()
+      << "Cannot dispatch datagrams on threads without true threading support.\n";
+    return;
+  }
+
+  _dispatch_shutdown = false;
+  for (int i = 0; i < num_threads; ++i) {
+    PT(DispatchThread) thread = new DispatchThread(this, i);
+    _dispatch_threads.push_back(thread);
+  }
+  DispatchThreads::iterator ti;
+  for (ti = _dispatch_threads.begin(); ti != _dispatch_threads.end(); ++ti) {
+    (*ti)->start(TP_normal, true);
+  }
+}
+
 #ifdef HAVE_OPENSSL
 /**
  * Once a connection has been established via the HTTP interface, gets the
@@ -156,13 +229,17 @@ try_connect_net(const URLSpec &url) {
 
   disconnect();
 
-  _net_conn =
+  PT(Connection) net_conn =
     _qcm.open_TCP_client_connection(url.get_server(), url.get_port(),
                                     game_server_timeout_ms);
 
-  if (_net_conn != nullptr) {
-    _net_conn->set_no_delay(true);
-    _qcr.add_connection(_net_conn);
+  if (net_conn != nullptr) {
+    net_conn->set_no_delay(true);
+    _qcr.add_connection(net_conn);
+
+    MutexHolder read_holder(_read_lock);
+    _net_conn = net_conn;
+    set_dispatch_connected(true);
     return true;
   }
 
@@ -178,13 +255,16 @@ try_connect_net(const URLSpec &url) {
 bool CConnectionRepository::
 connect_native(const URLSpec &url) {
   ReMutexHolder holder(_lock);
+  MutexHolder read_holder(_read_lock);
 
   _native=true;
   Socket_Address addr;
   addr.set_host(url.get_server(),url.get_port());
   _bdc.ClearAddresses();
   _bdc.AddAddress(addr);
-  return _bdc.DoConnect();
+  bool connected = _bdc.DoConnect();
+  set_dispatch_connected(connected);
+  return connected;
 }
 
 #endif //WANT NATIVE NET
@@ -260,24 +340,12 @@ check_datagram() {
     _bdc.Flush();
   #endif //WANT_NATIVE_NET
 
-  while (do_check_datagram()) {
+  while (do_next_message()) {
     if (get_verbose()) {
       describe_message(nout, "RECV", _dg);
     }
 
-    // Start breaking apart the datagram.
-    _di = DatagramIterator(_dg);
-
     if (!_client_datagram) {
-      unsigned char  wc_cnt;
-      wc_cnt = _di.get_uint8();
-      _msg_channels.clear();
-      for (unsigned char lp1 = 0; lp1 < wc_cnt; lp1++) {
-        CHANNEL_TYPE  schan  = _di.get_uint64();
-        _msg_channels.push_back(schan);
-      }
-      _msg_sender = _di.get_uint64();
-
 #ifdef HAVE_PYTHON
       // For now, we need to stuff this field onto the Python structure, to
       // support legacy code that expects to find it there.
@@ -296,7 +364,6 @@ check_datagram() {
 #endif  // HAVE_PYTHON
     }
 
-    _msg_type = _di.get_uint16();
     // Is this a message that we can process directly?
     if (!_handle_datagrams_internally) {
       return true;
@@ -356,7 +423,9 @@ is_connected() {
         _qcm.close_connection(reset_connection);
         if (reset_connection == _net_conn) {
           // Whoops, lost our connection.
+          MutexHolder read_holder(_read_lock);
           _net_conn = nullptr;
+          set_dispatch_connected(false);
           return false;
         }
       }
@@ -382,8 +451,8 @@ is_connected() {
 
 /**
  * Queues the indicated datagram for sending to the server.  It may not get
- * sent immediately if collect_tcp is in effect; call flush() to guarantee it
- * is sent now.
+ * sent immediately if collect_tcp or net-writer-coalesce is in effect; call
+ * flush() to guarantee it is sent now.
  */
 bool CConnectionRepository::
 send_datagram(const Datagram &dg) {
@@ -533,7 +602,8 @@ bundle_msg(const Datagram &dg) {
 
 /**
  * Sends the most recently queued data if enough time has elapsed.  This only
- * has meaning if set_collect_tcp() has been set to true.
+ * has meaning if set_collect_tcp() has been set to true, or if the
+ * ConnectionWriter is coalescing (see net-writer-coalesce).
  */
 bool CConnectionRepository::
 consider_flush() {
@@ -550,7 +620,9 @@ consider_flush() {
 
 #ifdef HAVE_NET
   if (_net_conn) {
-    return _net_conn->consider_flush();
+    // A coalescing ConnectionWriter holds datagrams back as well.
+    bool okflag = _cw.consider_flush();
+    return _net_conn->consider_flush() && okflag;
   }
 #endif  // HAVE_NET
 
@@ -565,7 +637,8 @@ consider_flush() {
 
 /**
  * Sends the most recently queued data now.  This only has meaning if
- * set_collect_tcp() has been set to true.
+ * set_collect_tcp() has been set to true, or if the ConnectionWriter is
+ * coalescing (see net-writer-coalesce).
  */
 bool CConnectionRepository::
 flush() {
@@ -581,7 +654,9 @@ flush() {
 
   #ifdef HAVE_NET
   if (_net_conn) {
-    return _net_conn->flush();
+    // A coalescing ConnectionWriter holds datagrams back as well.
+    bool okflag = _cw.flush();
+    return _net_conn->flush() && okflag;
   }
   #endif  // HAVE_NET
 
@@ -600,6 +675,7 @@ flush() {
 void CConnectionRepository::
 disconnect() {
   ReMutexHolder holder(_lock);
+  MutexHolder read_holder(_read_lock);
 
   #ifdef WANT_NATIVE_NET
   if(_native) {
@@ -611,6 +687,13 @@ disconnect() {
   if (_net_conn) {
     _qcm.close_connection(_net_conn);
     _net_conn = nullptr;
+
+    // Don't let anything left over from this connection be mistaken for
+    // something that arrived on the next one.
+    Datagram discard;
+    while (_qcr.data_available()) {
+      _qcr.get_data(discard);
+    }
   }
   #endif  // HAVE_NET
 
@@ -622,6 +705,7 @@ disconnect() {
   }
   #endif  // HAVE_OPENSSL
 
+  reset_dispatch();
   _simulated_disconnect = false;
 }
 
@@ -631,6 +715,7 @@ disconnect() {
 void CConnectionRepository::
 shutdown() {
   disconnect();
+  stop_dispatch_threads();
 
   #ifdef HAVE_NET
   _cw.shutdown();
@@ -652,6 +737,7 @@ do_check_datagram() {
   #ifdef HAVE_NET
   if (_net_conn) {
     _net_conn->consider_flush();
+    _cw.consider_flush();
     if (_qcr.get_overflow_flag()) {
       throw_event(get_overflow_event_name());
       _qcr.reset_overflow_flag();
@@ -671,6 +757,77 @@ do_check_datagram() {
   return false;
 }
 
+/**
+ * Gets the next message to be processed by check_datagram(), either from the
+ * dispatch threads or by reading it directly, and parses its header.
+ * Returns false if there is no message available.
+ */
+bool CConnectionRepository::
+do_next_message() {
+  if (is_dispatching()) {
+    #ifdef HAVE_NET
+    if (_net_conn) {
+      _net_conn->consider_flush();
+    _cw.consider_flush();
+      if (_qcr.get_overflow_flag()) {
+        throw_event(get_overflow_event_name());
+        _qcr.reset_overflow_flag();
+      }
+    }
+    #endif  // HAVE_NET
+  }
+
+  // Any messages the dispatch threads have already read come first, even if
+  // the threads have since been stopped.
+  if (get_dispatched_message()) {
+    return true;
+  }
+
+  if (is_dispatching()) {
+    #ifdef WANT_NATIVE_NET
+    if (_native) {
+      return false;
+    }
+    #endif
+    #ifdef HAVE_NET
+    if (_net_conn) {
+      return false;
+    }
+    #endif  // HAVE_NET
+  }
+
+  if (!do_check_datagram()) {
+    return false;
+  }
+
+  parse_message_header();
+  return true;
+}
+
+/**
+ * Breaks apart the header of the datagram in _dg, filling in _di and the
+ * _msg_* members.
+ */
+void CConnectionRepository::
+parse_message_header() {
+  _di = DatagramIterator(_dg);
+
+  if (!_client_datagram) {
+    unsigned char  wc_cnt;
+    wc_cnt = _di.get_uint8();
+    _msg_channels.clear();
+    for (unsigned char lp1 = 0; lp1 < wc_cnt; lp1++) {
+      CHANNEL_TYPE  schan  = _di.get_uint64();
+      _msg_channels.push_back(schan);
+    }
+    _msg_sender = _di.get_uint64();
+  }
+
+  _msg_type = _di.get_uint16();
+  _msg_field = nullptr;
+  _msg_args_index = 0;
+}
+
 /**
  * Directly handles an update message on a field.  Python never touches the
  * datagram; it just gets its distributed method called with the appropriate
@@ -736,7 +893,16 @@ handle_update_field() {
       // get into trouble if it tried to delete the object from the doId2do
       // map.
       Py_INCREF(distobj);
-      dclass->receive_update(distobj, _di);
+      if (_msg_field != nullptr &&
+          dclass->get_field_by_index(_msg_field->get_number()) == _msg_field) {
+        // A dispatch thread has already found the field and validated its
+        // arguments, so we can go straight to calling the update method.
+        dclass->receive_field_update(distobj, _msg_field,
+                                     (const char *)_dg.get_data() + _msg_args_index,
+                                     _dg.get_length() - _msg_args_index);
+      } else {
+        dclass->receive_update(distobj, _di);
+      }
       Py_DECREF(distobj);
 
       if (PyErr_Occurred()) {
@@ -1009,3 +1175,315 @@ describe_message(std::ostream &out, const string &prefix,
     }
   }
 }
+
+/**
+ *
+ */
+CConnectionRepository::DispatchThread::
+DispatchThread(CConnectionRepository *repository, int thread_index) :
+  Thread("CRDispatch-" + format_string(thread_index),
+         "CRDispatch-" + format_string(thread_index)),
+  _repository(repository)
+{
+}
+
+/**
+ *
+ */
+void CConnectionRepository::DispatchThread::
+thread_main() {
+  _repository->dispatch_thread_run();
+}
+
+#ifdef HAVE_NET
+/**
+ *
+ */
+CConnectionRepository::DispatchReader::
+DispatchReader(CConnectionRepository *repository, ConnectionManager *manager,
+               int num_threads) :
+  QueuedConnectionReader(manager, num_threads),
+  _repository(repository)
+{
+}
+
+/**
+ *
+ */
+CConnectionRepository::DispatchReader::
+~DispatchReader() {
+  // Stop the reader threads before we go away, since they call
+  // receive_datagram().
+  shutdown();
+}
+
+/**
+ * Queues up the datagram, and wakes up a dispatch thread to read it.
+ */
+void CConnectionRepository::DispatchReader::
+receive_datagram(const NetDatagram &datagram) {
+  QueuedConnectionReader::receive_datagram(datagram);
+
+  MutexHolder holder(_repository->_dispatch_lock);
+  _repository->_dispatch_cvar.notify();
+}
+
+/**
+ * Queues up the datagrams, and wakes up the dispatch threads to read them.
+ */
+void CConnectionRepository::DispatchReader::
+receive_datagrams(const NetDatagram *datagrams, int num_datagrams) {
+  QueuedConnectionReader::receive_datagrams(datagrams, num_datagrams);
+
+  MutexHolder holder(_repository->_dispatch_lock);
+  _repository->_dispatch_cvar.notify_all();
+}
+#endif  // HAVE_NET
+
+/**
+ * Returns true if the dispatch threads are running.
+ */
+bool CConnectionRepository::
+is_dispatching() const {
+  return !_dispatch_threads.empty();
+}
+
+/**
+ * Stops and joins the dispatch threads.  Any messages they have already read
+ * remain in _dispatched, to be returned by check_datagram() as usual.
+ */
+void CConnectionRepository::
+stop_dispatch_threads() {
+  if (_dispatch_threads.empty()) {
+    return;
+  }
+
+  {
+    MutexHolder holder(_dispatch_lock);
+    _dispatch_shutdown = true;
+    _dispatch_cvar.notify_all();
+  }
+
+  DispatchThreads::iterator ti;
+  for (ti = _dispatch_threads.begin(); ti != _dispatch_threads.end(); ++ti) {
+    (*ti)->join();
+  }
+  _dispatch_threads.clear();
+}
+
+/**
+ * Discards all of the messages read by the dispatch threads, as well as any
+ * they are still working on.  This is called when the connection is closed.
+ * Assumes _read_lock is held.
+ */
+void CConnectionRepository::
+reset_dispatch() {
+  MutexHolder holder(_dispatch_lock);
+  _dispatched.clear();
+  _dispatch_connected = false;
+  _next_read_seq = 0;
+  _next_apply_seq = 0;
+  ++_dispatch_generation;
+  _dispatch_cvar.notify_all();
+}
+
+/**
+ * Records whether there is a connection for the dispatch threads to read
+ * from, and wakes them up accordingly.  Assumes _read_lock is held.
+ */
+void CConnectionRepository::
+set_dispatch_connected(bool connected) {
+  MutexHolder holder(_dispatch_lock);
+  _dispatch_connected = connected;
+  _dispatch_cvar.notify_all();
+}
+
+/**
+ * The main loop of each dispatch thread.  It reads the next datagram from
+ * the connection, pre-parses it, and files it away for check_datagram().
+ */
+void CConnectionRepository::
+dispatch_thread_run() {
+  DispatchedMessage msg;
+
+  while (wait_dispatch_data()) {
+    // Only one thread reads from the connection at a time, so the sequence
+    // numbers are handed out in the order the datagrams arrive.
+    unsigned int seq = 0;
+    unsigned int generation = 0;
+    {
+      MutexHolder holder(_read_lock);
+      if (!read_dispatch_datagram(msg._dg)) {
+        continue;
+      }
+      seq = _next_read_seq++;
+      generation = _dispatch_generation;
+      msg._client_datagram = _client_datagram;
+    }
+
+    preparse_message(msg);
+
+    MutexHolder holder(_dispatch_lock);
+    if (generation == _dispatch_generation) {
+      _dispatched[seq] = std::move(msg);
+    }
+  }
+}
+
+/**
+ * Blocks the calling dispatch thread until there is room in _dispatched and
+ * a connection to read from, and, if the connection has a threaded reader,
+ * until that reader has queued up a datagram.  Returns false if the thread
+ * should exit instead.
+ */
+bool CConnectionRepository::
+wait_dispatch_data() {
+  MutexHolder holder(_dispatch_lock);
+  while (!_dispatch_shutdown) {
+    if (_dispatch_connected &&
+        (int)_dispatched.size() < cr_dispatch_queue_size) {
+#ifdef HAVE_NET
+      if (_qcr.is_polling() || _qcr.get_current_queue_size() > 0) {
+        return true;
+      }
+#ifdef SIMULATE_NETWORK_DELAY
+      // Delayed datagrams are only moved to the queue by data_available(),
+      // so we have to go and look every so often.
+      _dispatch_cvar.wait(dispatch_block);
+      return !_dispatch_shutdown;
+#endif  // SIMULATE_NETWORK_DELAY
+#else
+      return true;
+#endif  // HAVE_NET
+    }
+    _dispatch_cvar.wait();
+  }
+  return false;
+}
+
+/**
+ * Reads the next datagram from the connection on behalf of a dispatch
+ * thread.  Unless the connection has a threaded reader, this blocks for a
+ * short while waiting for one to arrive.  Returns true if a datagram was
+ * read.  Assumes _read_lock is held.
+ */
+bool CConnectionRepository::
+read_dispatch_datagram(Datagram &dg) {
+  #ifdef WANT_NATIVE_NET
+  if (_native) {
+    if (!_bdc.IsConnected()) {
+      // The connection has been lost; check_datagram() will notice and
+      // report it.  Until then, there is nothing for us to read.
+      set_dispatch_connected(false);
+      return false;
+    }
+    if (_bdc.GetMessage(dg)) {
+      return true;
+    }
+    _bdc.WaitForNetworkReadEvent(dispatch_block);
+    return _bdc.GetMessage(dg);
+  }
+  #endif
+  #ifdef HAVE_NET
+  if (_net_conn) {
+    if (_qcr.data_available() && _qcr.get_data(dg)) {
+      return true;
+    }
+    if (_qcr.is_polling()) {
+      _qcm.wait_for_readers(dispatch_block);
+      return (_qcr.data_available() && _qcr.get_data(dg));
+    }
+    // Another dispatch thread took the datagram we were woken up for.
+    return false;
+  }
+  #endif  // HAVE_NET
+
+  set_dispatch_connected(false);
+  return false;
+}
+
+/**
+ * Parses the header of a newly-read message on a dispatch thread.  If it is
+ * a field update, also looks up the field in the DCFile and validates its
+ * arguments, recording them in _field and _args_index; if anything about the
+ * message is not right, these are left unset, and the main thread will
+ * handle the message the usual way, including reporting any errors.
+ */
+void CConnectionRepository::
+preparse_message(DispatchedMessage &msg) const {
+  msg._channels.clear();
+  msg._sender = 0;
+  msg._field = nullptr;
+  msg._args_index = 0;
+
+  DCPacker packer;
+  packer.set_unpack_data((const char *)msg._dg.get_data(),
+                         msg._dg.get_length(), false);
+
+  if (!msg._client_datagram) {
+    unsigned int num_channels = packer.raw_unpack_uint8();
+    for (unsigned int i = 0; i < num_channels && !packer.had_pack_error(); ++i) {
+      msg._channels.push_back(packer.RAW_UNPACK_CHANNEL());
+    }
+    msg._sender = packer.RAW_UNPACK_CHANNEL();
+  }
+  msg._msg_type = packer.raw_unpack_uint16();
+  msg._body_index = packer.get_num_unpacked_bytes();
+  msg._header_ok = !packer.had_pack_error();
+
+  if (msg._header_ok && dc_multiple_inheritance &&
+      (msg._msg_type == CLIENT_OBJECT_SET_FIELD ||
+       msg._msg_type == STATESERVER_OBJECT_SET_FIELD)) {
+    packer.raw_unpack_uint32();  // do_id
+    int field_id = packer.raw_unpack_uint16();
+    if (!packer.had_pack_error()) {
+      DCField *field = _dc_file.get_field_by_index(field_id);
+      if (field != nullptr) {
+        size_t args_index = packer.get_num_unpacked_bytes();
+        packer.begin_unpack(field);
+        packer.unpack_validate();
+        if (packer.end_unpack()) {
+          msg._field = field;
+          msg._args_index = args_index;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * If the dispatch threads have finished the next message in sequence, takes
+ * it and makes it the current message, as parse_message_header() would.
+ * Returns false if the next message is not yet available.
+ */
+bool CConnectionRepository::
+get_dispatched_message() {
+  DispatchedMessage msg;
+  {
+    MutexHolder holder(_dispatch_lock);
+    Dispatched::iterator di = _dispatched.find(_next_apply_seq);
+    if (di == _dispatched.end()) {
+      return false;
+    }
+    msg = std::move((*di).second);
+    _dispatched.erase(di);
+    ++_next_apply_seq;
+    _dispatch_cvar.notify_all();
+  }
+
+  _dg = std::move(msg._dg);
+  if (!msg._header_ok || msg._client_datagram != _client_datagram) {
+    // Let parse_message_header() report the problem, or parse it again with
+    // the new header format.
+    parse_message_header();
+    return true;
+  }
+
+  _di = DatagramIterator(_dg, msg._body_index);
+  _msg_channels.swap(msg._channels);
+  _msg_sender = msg._sender;
+  _msg_type = msg._msg_type;
+  _msg_field = msg._field;
+  _msg_args_index = msg._args_index;
+  return true;
+}
@@ -25,6 +25,10 @@
 #include "clockObject.h"
 #include "reMutex.h"
 #include "reMutexHolder.h"
+#include "pmutex.h"
+#include "conditionVar.h"
+#include "thread.h"
+#include "pmap.h"
 
 #ifdef HAVE_NET
 #include "queuedConnectionManager.h"
@@ -52,6 +56,11 @@ class SocketStream;
  * Certain server messages, like field updates, are handled entirely within
  * the C++ layer, while server messages that are not understood by the C++
  * layer are returned up to the Python layer for processing.
+ *
+ * If set_num_dispatch_threads() is given a nonzero value, incoming datagrams
+ * are read, parsed, and have their field updates validated against the
+ * DCFile by that many worker threads.  check_datagram() then only needs to
+ * apply the already-decoded messages, in the order they were received.
  */
 class EXPCL_DIRECT_DISTRIBUTED CConnectionRepository {
 PUBLISHED:
@@ -86,6 +95,9 @@ PUBLISHED:
   void set_tcp_header_size(int tcp_header_size);
   INLINE int get_tcp_header_size() const;
 
+  BLOCKING void set_num_dispatch_threads(int num_threads);
+  INLINE int get_num_dispatch_threads() const;
+
 #ifdef HAVE_PYTHON
   INLINE void set_python_repository(PyObject *python_repository);
 #endif
@@ -158,15 +170,79 @@ PUBLISHED:
 
 private:
   bool do_check_datagram();
+  bool do_next_message();
+  void parse_message_header();
   bool handle_update_field();
   bool handle_update_field_owner();
 
   void describe_message(std::ostream &out, const std::string &prefix,
                         const Datagram &dg) const;
 
+  // A message that has been read and pre-parsed by one of the dispatch
+  // threads, waiting for check_datagram() to apply it.
+  class DispatchedMessage {
+  public:
+    Datagram _dg;
+    bool _client_datagram;
+    bool _header_ok;
+    size_t _body_index;
+    std::vector<CHANNEL_TYPE> _channels;
+    CHANNEL_TYPE _sender;
+    unsigned int _msg_type;
+
+    // If this is a field update whose arguments have already been validated,
+    // this is the field, and _args_index is the offset of its arguments.
+    DCField *_field;
+    size_t _args_index;
+  };
+
+  class DispatchThread : public Thread {
+  public:
+    DispatchThread(CConnectionRepository *repository, int thread_index);
+    virtual void thread_main();
+
+    CConnectionRepository *_repository;
+  };
+
+#ifdef HAVE_NET
+  // A threaded QueuedConnectionReader fills its queue on its own threads.
+  // This wakes up the dispatch threads when it does, so that they need not
+  // poll the queue.
+  class DispatchReader : public QueuedConnectionReader {
+  public:
+    DispatchReader(CConnectionRepository *repository,
+                   ConnectionManager *manager, int num_threads);
+    virtual ~DispatchReader();
+
+  protected:
+    virtual void receive_datagram(const NetDatagram &datagram);
+    virtual void receive_datagrams(const NetDatagram *datagrams, int num_datagrams);
+
+  private:
+    CConnectionRepository *_repository;
+  };
+#endif  // HAVE_NET
+
+  bool is_dispatching() const;
+  void stop_dispatch_threads();
+  void set_dispatch_connected(bool connected);
+  void reset_dispatch();
+  void dispatch_thread_run();
+  bool wait_dispatch_data();
+  bool read_dispatch_datagram(Datagram &dg);
+  void preparse_message(DispatchedMessage &msg) const;
+  bool get_dispatched_message();
+
 private:
   ReMutex _lock;
 
+  // The dispatch threads read from the connection while holding _read_lock.
+  // Everything else about them is protected by _dispatch_lock.  These are
+  // declared before the reader, which signals _dispatch_cvar.
+  Mutex _read_lock;
+  Mutex _dispatch_lock;
+  ConditionVar _dispatch_cvar;
+
 #ifdef HAVE_PYTHON
   PyObject *_python_repository;
 #endif
@@ -178,7 +254,7 @@ private:
 #ifdef HAVE_NET
   QueuedConnectionManager _qcm;
   ConnectionWriter _cw;
-  QueuedConnectionReader _qcr;
+  DispatchReader _qcr;
   PT(Connection) _net_conn;
 #endif
 
@@ -204,6 +280,22 @@ private:
   std::vector<CHANNEL_TYPE>             _msg_channels;
   CHANNEL_TYPE                          _msg_sender;
   unsigned int                          _msg_type;
+  DCField                              *_msg_field;
+  size_t                                _msg_args_index;
+
+  // Each datagram is numbered as the dispatch threads read it, and the
+  // finished messages are stored in _dispatched until check_datagram() takes
+  // them out again in that same order.  The threads sleep on _dispatch_cvar
+  // while there is no connection for them to read from.
+  typedef pvector< PT(DispatchThread) > DispatchThreads;
+  DispatchThreads _dispatch_threads;
+  typedef pmap<unsigned int, DispatchedMessage> Dispatched;
+  Dispatched _dispatched;
+  unsigned int _next_read_seq;
+  unsigned int _next_apply_seq;
+  unsigned int _dispatch_generation;
+  bool _dispatch_connected;
+  bool _dispatch_shutdown;
 
   static const std::string _overflow_event_name;
 
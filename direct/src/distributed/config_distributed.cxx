@@ -50,6 +50,22 @@ ConfigVariableBool handle_datagrams_internally
           "for performance reasons.  When it is false, all datagrams "
           "are handled by the Python implementation."));
 
+ConfigVariableInt cr_dispatch_threads
+("cr-dispatch-threads", 0,
+ PRC_DESC("The number of threads each cConnectionRepository starts to read "
+          "incoming datagrams and pre-parse them, including validating the "
+          "arguments of field updates, so that the main thread only has to "
+          "apply them.  Set this to 0 to do all of the work on the thread "
+          "that calls check_datagram().  This requires true threads, and "
+          "only applies to connections made with try_connect_net() or "
+          "connect_native()."));
+
+ConfigVariableInt cr_dispatch_queue_size
+("cr-dispatch-queue-size", 1024,
+ PRC_DESC("The maximum number of pre-parsed datagrams that the "
+          "cConnectionRepository dispatch threads will hold waiting for "
+          "check_datagram() before they stop reading from the connection."));
+
 /**
  * Initializes the library.  This must be called at least once before any of
  * the functions or classes in this library can be used.  Normally it will be
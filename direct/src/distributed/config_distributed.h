@@ -27,6 +27,8 @@ extern ConfigVariableInt game_server_timeout_ms;
 extern ConfigVariableDouble min_lag;
 extern ConfigVariableDouble max_lag;
 extern ConfigVariableBool handle_datagrams_internally;
+extern ConfigVariableInt cr_dispatch_threads;
+extern ConfigVariableInt cr_dispatch_queue_size;
 
 extern EXPCL_DIRECT_DISTRIBUTED void init_libdistributed();
 
@@ -5764,6 +5764,13 @@ if not PkgSkip("PANDATOOL"):
   TargetAdd('bam-info.exe', input=COMMON_PANDA_LIBS)
   TargetAdd('bam-info.exe', opts=['ADVAPI', 'FFTW'])
 
+  TargetAdd('bam-cache-populate_bamCachePopulate.obj', opts=OPTS, input='bamCachePopulate.cxx')
+  TargetAdd('bam-cache-populate.exe', input='bam-cache-populate_bamCachePopulate.obj')
+  TargetAdd('bam-cache-populate.exe', input='libp3progbase.lib')
+  TargetAdd('bam-cache-populate.exe', input='libp3pandatoolbase.lib')
+  TargetAdd('bam-cache-populate.exe', input=COMMON_PANDA_LIBS)
+  TargetAdd('bam-cache-populate.exe', opts=['ADVAPI', 'FFTW'])
+
   if not PkgSkip("EGG"):
     TargetAdd('bam2egg_bamToEgg.obj', opts=OPTS, input='bamToEgg.cxx')
     TargetAdd('bam2egg.exe', input='bam2egg_bamToEgg.obj')
@@ -12,6 +12,8 @@
  */
 
 #include "animBundle.h"
+#include "animChannelMatrixXfmTable.h"
+#include "config_chan.h"
 
 #include "indent.h"
 #include "datagram.h"
@@ -30,7 +32,8 @@ AnimBundle::
 AnimBundle(AnimGroup *parent, const AnimBundle &copy) :
   AnimGroup(parent, copy),
   _fps(copy._fps),
-  _num_frames(copy._num_frames)
+  _num_frames(copy._num_frames),
+  _joint_table(copy._joint_table)
 {
   nassertv(_root == nullptr);
   _root = this;
@@ -47,6 +50,36 @@ copy_bundle() const {
   return DCAST(AnimBundle, group.p());
 }
 
+/**
+ * Packs the values of all of the AnimChannelMatrixXfmTables in the bundle
+ * into a single AnimJointTable, which keeps the values for each frame
+ * together in memory.  The channels will read their values from this table
+ * from now on, unless their tables are subsequently modified.
+ *
+ * This uses more memory than the separate tables, since a table that holds
+ * only a single value is expanded to cover every frame.  Also see
+ * pack-anim-joints.
+ */
+void AnimBundle::
+pack_joints() {
+  Joints joints;
+  r_collect_joints(this, joints);
+
+  if (joints.empty() || _num_frames <= 0) {
+    _joint_table.clear();
+    return;
+  }
+
+  PT(AnimJointTable) table = new AnimJointTable(_num_frames, (int)joints.size());
+  for (size_t j = 0; j < joints.size(); ++j) {
+    AnimChannelMatrixXfmTable *channel = joints[j];
+    table->set_joint((int)j, channel->_tables);
+    channel->_joint_table = table;
+    channel->_joint_index = (int)j;
+  }
+  _joint_table = table;
+}
+
 /**
  * Writes a one-line description of the bundle.
  */
@@ -66,6 +99,22 @@ make_copy(AnimGroup *parent) const {
   return new AnimBundle(parent, *this);
 }
 
+/**
+ * Recursively collects the AnimChannelMatrixXfmTables at and below the
+ * indicated group, in depth-first order.
+ */
+void AnimBundle::
+r_collect_joints(AnimGroup *group, Joints &joints) {
+  if (group->is_of_type(AnimChannelMatrixXfmTable::get_class_type())) {
+    joints.push_back(DCAST(AnimChannelMatrixXfmTable, group));
+  }
+
+  int num_children = group->get_num_children();
+  for (int i = 0; i < num_children; ++i) {
+    r_collect_joints(group->get_child(i), joints);
+  }
+}
+
 /**
  * Function to write the important information in the particular object to a
  * Datagram
@@ -87,6 +136,20 @@ fillin(DatagramIterator &scan, BamReader *manager) {
   AnimGroup::fillin(scan, manager);
   _fps = scan.get_stdfloat();
   _num_frames = scan.get_uint16();
+
+  if (pack_anim_joints) {
+    manager->register_finalize(this);
+  }
+}
+
+/**
+ * Called by the BamReader to perform any final actions needed for setting up
+ * the object after all objects have been read and all pointers have been
+ * completed.
+ */
+void AnimBundle::
+finalize(BamReader *) {
+  pack_joints();
 }
 
 /**
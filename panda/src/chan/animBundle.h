@@ -17,9 +17,11 @@
 #include "pandabase.h"
 
 #include "animGroup.h"
+#include "animJointTable.h"
 #include "pointerTo.h"
 
 class FactoryParams;
+class AnimChannelMatrixXfmTable;
 
 /**
  * This is the root of an AnimChannel hierarchy.  It knows the frame rate and
@@ -41,6 +43,10 @@ PUBLISHED:
   MAKE_PROPERTY(base_frame_rate, get_base_frame_rate);
   MAKE_PROPERTY(num_frames, get_num_frames);
 
+  void pack_joints();
+  INLINE AnimJointTable *get_joint_table() const;
+  MAKE_PROPERTY(joint_table, get_joint_table);
+
   virtual void output(std::ostream &out) const;
 
 protected:
@@ -49,12 +55,17 @@ protected:
   virtual AnimGroup *make_copy(AnimGroup *parent) const;
 
 private:
+  typedef pvector<AnimChannelMatrixXfmTable *> Joints;
+  void r_collect_joints(AnimGroup *group, Joints &joints);
+
   PN_stdfloat _fps;
   int _num_frames;
+  PT(AnimJointTable) _joint_table;
 
 public:
   static void register_with_read_factory();
   virtual void write_datagram(BamWriter* manager, Datagram &me);
+  virtual void finalize(BamReader *manager);
 
   static TypedWritable *make_AnimBundle(const FactoryParams &params);
 
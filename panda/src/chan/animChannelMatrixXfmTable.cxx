@@ -30,7 +30,9 @@ TypeHandle AnimChannelMatrixXfmTable::_type_handle;
  * Used only for bam loader.
  */
 AnimChannelMatrixXfmTable::
-AnimChannelMatrixXfmTable() {
+AnimChannelMatrixXfmTable() :
+  _joint_index(0)
+{
   for (int i = 0; i < num_matrix_components; i++) {
     _tables[i] = CPTA_stdfloat(get_class_type());
   }
@@ -43,7 +45,9 @@ AnimChannelMatrixXfmTable() {
  */
 AnimChannelMatrixXfmTable::
 AnimChannelMatrixXfmTable(AnimGroup *parent, const AnimChannelMatrixXfmTable &copy) :
-  AnimChannelMatrix(parent, copy)
+  AnimChannelMatrix(parent, copy),
+  _joint_table(copy._joint_table),
+  _joint_index(copy._joint_index)
 {
   for (int i = 0; i < num_matrix_components; i++) {
     _tables[i] = copy._tables[i];
@@ -55,7 +59,8 @@ AnimChannelMatrixXfmTable(AnimGroup *parent, const AnimChannelMatrixXfmTable &co
  */
 AnimChannelMatrixXfmTable::
 AnimChannelMatrixXfmTable(AnimGroup *parent, const std::string &name)
-  : AnimChannelMatrix(parent, name)
+  : AnimChannelMatrix(parent, name),
+    _joint_index(0)
 {
   for (int i = 0; i < num_matrix_components; i++) {
     _tables[i] = CPTA_stdfloat(get_class_type());
@@ -113,11 +118,7 @@ get_value(int frame, LMatrix4 &mat) {
   PN_stdfloat components[num_matrix_components];
 
   for (int i = 0; i < num_matrix_components; i++) {
-    if (_tables[i].empty()) {
-      components[i] = get_default_value(i);
-    } else {
-      components[i] = _tables[i][frame % _tables[i].size()];
-    }
+    components[i] = get_component(i, frame);
   }
 
   compose_matrix(mat, components);
@@ -138,11 +139,7 @@ get_value_no_scale_shear(int frame, LMatrix4 &mat) {
   components[5] = 0.0f;
 
   for (int i = 6; i < num_matrix_components; i++) {
-    if (_tables[i].empty()) {
-      components[i] = get_default_value(i);
-    } else {
-      components[i] = _tables[i][frame % _tables[i].size()];
-    }
+    components[i] = get_component(i, frame);
   }
 
   compose_matrix(mat, components);
@@ -154,11 +151,7 @@ get_value_no_scale_shear(int frame, LMatrix4 &mat) {
 void AnimChannelMatrixXfmTable::
 get_scale(int frame, LVecBase3 &scale) {
   for (int i = 0; i < 3; i++) {
-    if (_tables[i].empty()) {
-      scale[i] = 1.0f;
-    } else {
-      scale[i] = _tables[i][frame % _tables[i].size()];
-    }
+    scale[i] = get_component(i, frame);
   }
 }
 
@@ -169,11 +162,7 @@ get_scale(int frame, LVecBase3 &scale) {
 void AnimChannelMatrixXfmTable::
 get_hpr(int frame, LVecBase3 &hpr) {
   for (int i = 0; i < 3; i++) {
-    if (_tables[i + 6].empty()) {
-      hpr[i] = 0.0f;
-    } else {
-      hpr[i] = _tables[i + 6][frame % _tables[i + 6].size()];
-    }
+    hpr[i] = get_component(i + 6, frame);
   }
 }
 
@@ -186,11 +175,7 @@ void AnimChannelMatrixXfmTable::
 get_quat(int frame, LQuaternion &quat) {
   LVecBase3 hpr;
   for (int i = 0; i < 3; i++) {
-    if (_tables[i + 6].empty()) {
-      hpr[i] = 0.0f;
-    } else {
-      hpr[i] = _tables[i + 6][frame % _tables[i + 6].size()];
-    }
+    hpr[i] = get_component(i + 6, frame);
   }
 
   quat.set_hpr(hpr);
@@ -203,11 +188,7 @@ get_quat(int frame, LQuaternion &quat) {
 void AnimChannelMatrixXfmTable::
 get_pos(int frame, LVecBase3 &pos) {
   for (int i = 0; i < 3; i++) {
-    if (_tables[i + 9].empty()) {
-      pos[i] = 0.0f;
-    } else {
-      pos[i] = _tables[i + 9][frame % _tables[i + 9].size()];
-    }
+    pos[i] = get_component(i + 9, frame);
   }
 }
 
@@ -218,11 +199,7 @@ get_pos(int frame, LVecBase3 &pos) {
 void AnimChannelMatrixXfmTable::
 get_shear(int frame, LVecBase3 &shear) {
   for (int i = 0; i < 3; i++) {
-    if (_tables[i + 3].empty()) {
-      shear[i] = 0.0f;
-    } else {
-      shear[i] = _tables[i + 3][frame % _tables[i + 3].size()];
-    }
+    shear[i] = get_component(i + 3, frame);
   }
 }
 
@@ -249,6 +226,7 @@ set_table(char table_id, const CPTA_stdfloat &table) {
   }
 
   _tables[i] = table;
+  _joint_table.clear();
 }
 
 
@@ -261,6 +239,7 @@ clear_all_tables() {
   for (int i = 0; i < num_matrix_components; i++) {
     _tables[i] = CPTA_stdfloat(get_class_type());
   }
+  _joint_table.clear();
 }
 
 /**
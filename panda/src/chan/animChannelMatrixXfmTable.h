@@ -21,6 +21,7 @@
 #include "pointerToArray.h"
 #include "pta_stdfloat.h"
 #include "compose_matrix.h"
+#include "animJointTable.h"
 
 /**
  * An animation channel that issues a matrix each frame, read from a table
@@ -49,6 +50,9 @@ public:
   virtual void get_pos(int frame, LVecBase3 &pos);
   virtual void get_shear(int frame, LVecBase3 &shear);
 
+  INLINE AnimJointTable *get_joint_table() const;
+  INLINE int get_joint_index() const;
+
 PUBLISHED:
   static INLINE bool is_valid_id(char table_id);
 
@@ -70,9 +74,15 @@ protected:
   INLINE static char get_table_id(int table_index);
   static int get_table_index(char table_id);
   INLINE static PN_stdfloat get_default_value(int table_index);
+  INLINE PN_stdfloat get_component(int table_index, int frame) const;
 
   CPTA_stdfloat _tables[num_matrix_components];
 
+  // If the AnimBundle has been packed, this is the table that holds our
+  // values, and the index of our joint within it.
+  PT(AnimJointTable) _joint_table;
+  int _joint_index;
+
 public:
   static void register_with_read_factory();
   virtual void write_datagram(BamWriter* manager, Datagram &me);
@@ -98,6 +108,8 @@ public:
 
 private:
   static TypeHandle _type_handle;
+
+  friend class AnimBundle;
 };
 
 #include "animChannelMatrixXfmTable.I"
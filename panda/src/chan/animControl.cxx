@@ -13,6 +13,7 @@
 
 #include "animControl.h"
 #include "animChannelBase.h"
+#include "animChannelMatrixXfmTable.h"
 #include "partBundle.h"
 #include "config_chan.h"
 #include "dcast.h"
@@ -46,6 +47,11 @@ AnimControl(const std::string &name, PartBundle *part,
   set_num_frames(num_frames);
 
   _marked_frame = -1;
+  _joint_frames[0] = -1;
+  _joint_frames[1] = -1;
+  _joint_no_scale_shear[0] = false;
+  _joint_no_scale_shear[1] = false;
+  _joint_lru_slot = 0;
 }
 
 /**
@@ -206,6 +212,56 @@ mark_channels(bool frame_blend_flag) {
   }
 }
 
+/**
+ * If the indicated channel reads its values from the packed joint table of
+ * its AnimBundle, fills in its matrix at the indicated frame, as returned by
+ * its get_value() or get_value_no_scale_shear(), and returns true.
+ * Otherwise, returns false, and the caller should ask the channel.
+ *
+ * The first time a frame is requested, the matrices of all of the joints in
+ * the table are computed together, in one pass over the frame's data; the
+ * other joints then just copy their matrix out.  The results of the last two
+ * frames are kept, which covers both frames of a frame blend, and lets a
+ * blend between the same two frames in the next update skip the work.
+ */
+bool AnimControl::
+get_joint_value(AnimChannelBase *channel, int frame, LMatrix4 &mat,
+                bool no_scale_shear) {
+  if (!channel->is_exact_type(AnimChannelMatrixXfmTable::get_class_type())) {
+    return false;
+  }
+  AnimChannelMatrixXfmTable *xfm = (AnimChannelMatrixXfmTable *)channel;
+  const AnimJointTable *table = xfm->get_joint_table();
+  if (table == nullptr || frame < 0 || frame >= table->get_num_frames()) {
+    return false;
+  }
+
+  if (table != _joint_table) {
+    _joint_table = table;
+    for (int i = 0; i < 2; ++i) {
+      _joint_matrices[i].resize(table->get_num_joints());
+      _joint_frames[i] = -1;
+    }
+    _joint_lru_slot = 0;
+  }
+
+  int slot;
+  if (_joint_frames[0] == frame && _joint_no_scale_shear[0] == no_scale_shear) {
+    slot = 0;
+  } else if (_joint_frames[1] == frame && _joint_no_scale_shear[1] == no_scale_shear) {
+    slot = 1;
+  } else {
+    slot = _joint_lru_slot;
+    table->compose_frame(frame, &_joint_matrices[slot][0], no_scale_shear);
+    _joint_frames[slot] = frame;
+    _joint_no_scale_shear[slot] = no_scale_shear;
+  }
+  _joint_lru_slot = 1 - slot;
+
+  mat = _joint_matrices[slot][xfm->get_joint_index()];
+  return true;
+}
+
 /**
  * This is provided as a callback method for when the user calls one of the
  * play/loop/pose type methods to start the animation playing.
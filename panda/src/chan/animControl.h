@@ -25,6 +25,7 @@
 #include "namable.h"
 #include "pmutex.h"
 #include "conditionVar.h"
+#include "epvector.h"
 
 class PartBundle;
 class AnimChannelBase;
@@ -72,6 +73,9 @@ public:
   bool channel_has_changed(AnimChannelBase *channel, bool frame_blend_flag) const;
   void mark_channels(bool frame_blend_flag);
 
+  bool get_joint_value(AnimChannelBase *channel, int frame, LMatrix4 &mat,
+                       bool no_scale_shear = false);
+
 protected:
   virtual void animation_activated();
 
@@ -97,6 +101,15 @@ private:
   // have actually bound into this AnimControl.  See get_bound_joints().
   BitArray _bound_joints;
 
+  // If the AnimBundle has been packed, these are the matrices of all of its
+  // joints at the two most recently requested frames.  See get_joint_value().
+  typedef epvector<LMatrix4> JointMatrices;
+  CPT(AnimJointTable) _joint_table;
+  JointMatrices _joint_matrices[2];
+  int _joint_frames[2];
+  bool _joint_no_scale_shear[2];
+  int _joint_lru_slot;
+
   PT(PandaNode) _anim_model;
 
 public:
@@ -12,6 +12,7 @@
  */
 
 #include "animControlCollection.h"
+#include "partBundleCollection.h"
 
 using std::string;
 
@@ -226,6 +227,30 @@ pose_all(double frame) {
   }
 }
 
+/**
+ * Updates all of the PartBundles that the anims are bound to, so that their
+ * joints reflect the current frames of the anims.  Each bundle is updated
+ * once, even if several anims are bound to it.  If num_threads is greater
+ * than 1, the bundles are updated at the same time on that many threads; see
+ * PartBundleCollection.  Returns true if any part of any bundle has changed,
+ * false otherwise.
+ */
+bool AnimControlCollection::
+update_parts(int num_threads) {
+  PartBundleCollection bundles;
+  bundles.set_num_threads(num_threads);
+
+  Controls::const_iterator ci;
+  for (ci = _controls.begin(); ci != _controls.end(); ++ci) {
+    PartBundle *part = (*ci)._control->get_part();
+    if (part != nullptr) {
+      bundles.add_bundle(part);
+    }
+  }
+
+  return bundles.update();
+}
+
 /**
  * Returns the name of the bound AnimControl currently playing, if any.  If
  * more than one AnimControl is currently playing, returns all of the names
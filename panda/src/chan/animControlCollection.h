@@ -65,6 +65,8 @@ PUBLISHED:
   bool stop_all();
   void pose_all(double frame);
 
+  bool update_parts(int num_threads = 1);
+
   INLINE int get_frame(const std::string &anim_name) const;
   INLINE int get_frame() const;
 
@@ -0,0 +1,97 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file animJointTable.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "animJointTable.h"
+
+/**
+ * Creates a table for the indicated number of frames and joints, with all of
+ * the components set to their default values.
+ */
+AnimJointTable::
+AnimJointTable(int num_frames, int num_joints) :
+  _num_frames(num_frames),
+  _num_joints(num_joints)
+{
+  nassertv(num_frames > 0 && num_joints > 0);
+  _data.resize((size_t)num_frames * num_matrix_components * num_joints);
+
+  size_t num_values = (size_t)num_frames * num_joints;
+  for (size_t i = 0; i < num_values; ++i) {
+    PN_stdfloat *components = &_data[i * num_matrix_components];
+    for (int c = 0; c < num_matrix_components; ++c) {
+      components[c] = matrix_component_defaults[c];
+    }
+  }
+}
+
+/**
+ * Fills in the components of the indicated joint from the tables of an
+ * AnimChannelMatrixXfmTable.  An empty table leaves the component at its
+ * default value.
+ */
+void AnimJointTable::
+set_joint(int joint, const CPTA_stdfloat tables[num_matrix_components]) {
+  nassertv(joint >= 0 && joint < _num_joints);
+
+  for (int c = 0; c < num_matrix_components; ++c) {
+    const CPTA_stdfloat &table = tables[c];
+    if (table.empty()) {
+      continue;
+    }
+    size_t table_size = table.size();
+    for (int f = 0; f < _num_frames; ++f) {
+      size_t index = ((size_t)f * _num_joints + joint) * num_matrix_components + c;
+      _data[index] = table[f % table_size];
+    }
+  }
+}
+
+/**
+ * Computes the matrices of all of the joints at the indicated frame, storing
+ * them in the indicated array, which must have room for get_num_joints()
+ * matrices.  The result for each joint is exactly what the channel's
+ * get_value() returns, or its get_value_no_scale_shear() if no_scale_shear
+ * is true.
+ */
+void AnimJointTable::
+compose_frame(int frame, LMatrix4 *mats, bool no_scale_shear) const {
+  const PN_stdfloat *components = get_frame_data(frame);
+
+  if (!no_scale_shear) {
+    for (int j = 0; j < _num_joints; ++j) {
+      compose_matrix(mats[j], components);
+      components += num_matrix_components;
+    }
+
+  } else {
+    PN_stdfloat rotate_translate[num_matrix_components] = {
+      1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 0.0f,
+    };
+    for (int j = 0; j < _num_joints; ++j) {
+      for (int c = 6; c < num_matrix_components; ++c) {
+        rotate_translate[c] = components[c];
+      }
+      compose_matrix(mats[j], rotate_translate);
+      components += num_matrix_components;
+    }
+  }
+}
+
+/**
+ * Computes the matrix of the indicated joint at the indicated frame.
+ */
+void AnimJointTable::
+get_value(int frame, int joint, LMatrix4 &mat) const {
+  nassertv(joint >= 0 && joint < _num_joints);
+  compose_matrix(mat, get_frame_data(frame) + joint * num_matrix_components);
+}
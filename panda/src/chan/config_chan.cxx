@@ -101,6 +101,22 @@ PRC_DESC("This specifies the priority assign to an asynchronous bind "
          "model loads).  A higher number here makes the animations "
          "load sooner."));
 
+ConfigVariableBool pack_anim_joints
+("pack-anim-joints", false,
+PRC_DESC("Set this true to pack the joint tables of each AnimBundle into a "
+         "single AnimJointTable as soon as it is loaded, which keeps the "
+         "values of all of the joints for a frame together in memory.  This "
+         "makes sampling large skeletons more cache-friendly, at the cost "
+         "of some additional memory.  See AnimBundle::pack_joints()."));
+
+ConfigVariableInt anim_num_threads
+("anim-num-threads", 0,
+PRC_DESC("The number of threads to create for the \"anim\" task chain, "
+         "which is used by PartBundleCollections that have been asked to "
+         "update their bundles on more than one thread.  The default of 0 "
+         "means to create one thread per CPU, less one for the calling "
+         "thread."));
+
 ConfigureFn(config_chan) {
   AnimBundle::init_type();
   AnimBundleNode::init_type();
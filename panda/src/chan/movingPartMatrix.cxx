@@ -70,8 +70,11 @@ get_blend_value(const PartBundle *root) {
   } else if (_effective_control != nullptr &&
              !cdata->_frame_blend_flag) {
     // A single value, the normal case.
-    ChannelType *channel = DCAST(ChannelType, _effective_channel);
-    channel->get_value(_effective_control->get_frame(), _value);
+    int frame = _effective_control->get_frame();
+    if (!_effective_control->get_joint_value(_effective_channel, frame, _value)) {
+      ChannelType *channel = DCAST(ChannelType, _effective_channel);
+      channel->get_value(frame, _value);
+    }
 
   } else {
     // A blend of two or more values, either between multiple different
@@ -95,7 +98,10 @@ get_blend_value(const PartBundle *root) {
           ChannelType *channel = DCAST(ChannelType, _channels[channel_index]);
           if (channel != nullptr) {
             ValueType v;
-            channel->get_value(control->get_frame(), v);
+            int frame = control->get_frame();
+            if (!control->get_joint_value(channel, frame, v)) {
+              channel->get_value(frame, v);
+            }
 
             if (!cdata->_frame_blend_flag) {
               // Hold the current frame until the next one is ready.
@@ -105,7 +111,10 @@ get_blend_value(const PartBundle *root) {
               PN_stdfloat frac = (PN_stdfloat)control->get_frac();
               net_value += v * (effect * (1.0f - frac));
 
-              channel->get_value(control->get_next_frame(), v);
+              int next_frame = control->get_next_frame();
+              if (!control->get_joint_value(channel, next_frame, v)) {
+                channel->get_value(next_frame, v);
+              }
               net_value += v * (effect * frac);
             }
             net_effect += effect;
@@ -149,7 +158,9 @@ get_blend_value(const PartBundle *root) {
             int frame = control->get_frame();
             ValueType v;
             LVecBase3 iscale, ishear;
-            channel->get_value_no_scale_shear(frame, v);
+            if (!control->get_joint_value(channel, frame, v, true)) {
+              channel->get_value_no_scale_shear(frame, v);
+            }
             channel->get_scale(frame, iscale);
             channel->get_shear(frame, ishear);
 
@@ -167,7 +178,9 @@ get_blend_value(const PartBundle *root) {
               shear += ishear * e0;
 
               int next_frame = control->get_next_frame();
-              channel->get_value_no_scale_shear(next_frame, v);
+              if (!control->get_joint_value(channel, next_frame, v, true)) {
+                channel->get_value_no_scale_shear(next_frame, v);
+              }
               channel->get_scale(next_frame, iscale);
               channel->get_shear(next_frame, ishear);
               PN_stdfloat e1 = effect * frac;
@@ -12,4 +12,5 @@
 #include "animControl.cxx"
 #include "animControlCollection.cxx"
 #include "animGroup.cxx"
+#include "animJointTable.cxx"
 
@@ -28,6 +28,9 @@
 #include "configVariableEnum.h"
 #include "loaderOptions.h"
 #include "bindAnimRequest.h"
+#include "pandaNode.h"
+#include "vertexTransform.h"
+#include "vertexSlider.h"
 
 #include <algorithm>
 
@@ -55,6 +58,7 @@ PartBundle(const PartBundle &copy) :
 {
   _anim_preload = copy._anim_preload;
   _update_delay = 0.0;
+  _deferred = nullptr;
 
   CDWriter cdata(_cycler, true);
   CDReader cdata_from(copy._cycler);
@@ -73,6 +77,7 @@ PartBundle(const string &name) :
   PartGroup(name)
 {
   _update_delay = 0.0;
+  _deferred = nullptr;
 }
 
 /**
@@ -524,6 +529,51 @@ force_update() {
 }
 
 
+/**
+ * Called by the parts of the bundle during an update to change the transform
+ * of a node that is exposed to the scene graph.  If the bundle is being
+ * updated on a helper thread, the change is deferred until the update is
+ * complete.
+ */
+void PartBundle::
+set_node_transform(PandaNode *node, const TransformState *transform,
+                   Thread *current_thread) {
+  if (_deferred != nullptr) {
+    _deferred->_node_transforms.push_back(
+      DeferredChanges::NodeTransforms::value_type(node, transform));
+  } else {
+    node->set_transform(transform, current_thread);
+  }
+}
+
+/**
+ * Called by the parts of the bundle during an update to indicate that the
+ * matrix of the indicated VertexTransform has changed.  If the bundle is being
+ * updated on a helper thread, this is deferred until the update is complete.
+ */
+void PartBundle::
+mark_transform_modified(VertexTransform *transform, Thread *current_thread) {
+  if (_deferred != nullptr) {
+    _deferred->_transforms.push_back(transform);
+  } else {
+    transform->mark_modified(current_thread);
+  }
+}
+
+/**
+ * Called by the parts of the bundle during an update to indicate that the
+ * value of the indicated VertexSlider has changed.  If the bundle is being
+ * updated on a helper thread, this is deferred until the update is complete.
+ */
+void PartBundle::
+mark_slider_modified(VertexSlider *slider, Thread *current_thread) {
+  if (_deferred != nullptr) {
+    _deferred->_sliders.push_back(slider);
+  } else {
+    slider->mark_modified(current_thread);
+  }
+}
+
 /**
  * Called by the AnimControl whenever it starts an animation.  This is just a
  * hook so the bundle can do something, if necessary, before the animation
@@ -750,6 +800,26 @@ clear_and_stop_intersecting(AnimControl *control, CData *cdata) {
   }
 }
 
+/**
+ * Applies the changes that were queued up while the bundle was being updated
+ * on a helper thread, and empties the queue.
+ */
+void PartBundle::DeferredChanges::
+apply(Thread *current_thread) {
+  for (const NodeTransforms::value_type &nt : _node_transforms) {
+    nt.first->set_transform(nt.second, current_thread);
+  }
+  for (VertexTransform *transform : _transforms) {
+    transform->mark_modified(current_thread);
+  }
+  for (VertexSlider *slider : _sliders) {
+    slider->mark_modified(current_thread);
+  }
+  _node_transforms.clear();
+  _transforms.clear();
+  _sliders.clear();
+}
+
 /**
  * Called by the BamReader to perform any final actions needed for setting up
  * the object after all objects have been read and all pointers have been
@@ -38,6 +38,8 @@ class PartBundleNode;
 class PartBundleNode;
 class TransformState;
 class AnimPreloadTable;
+class VertexTransform;
+class VertexSlider;
 
 /**
  * This is the root of a MovingPart hierarchy.  It defines the hierarchy of
@@ -155,6 +157,12 @@ public:
   bool do_bind_anim(AnimControl *control, AnimBundle *anim,
                     int hierarchy_match_flags, const PartSubset &subset);
 
+  void set_node_transform(PandaNode *node, const TransformState *transform,
+                          Thread *current_thread);
+  void mark_transform_modified(VertexTransform *transform,
+                               Thread *current_thread);
+  void mark_slider_modified(VertexSlider *slider, Thread *current_thread);
+
 protected:
   virtual void add_node(PartBundleNode *node);
   virtual void remove_node(PartBundleNode *node);
@@ -177,6 +185,21 @@ private:
 
   double _update_delay;
 
+  // While the bundle is being updated on a thread other than the one that
+  // asked for the update (see PartBundleCollection), any changes made by the
+  // parts to objects outside of the bundle are queued up here instead, to be
+  // applied afterwards by the calling thread.
+  class DeferredChanges {
+  public:
+    void apply(Thread *current_thread);
+
+    typedef pvector<std::pair<PT(PandaNode), CPT(TransformState)> > NodeTransforms;
+    NodeTransforms _node_transforms;
+    pvector<PT(VertexTransform)> _transforms;
+    pvector<PT(VertexSlider)> _sliders;
+  };
+  DeferredChanges *_deferred;
+
   // This is the data that must be cycled between pipeline stages.
   class CData : public CycleData {
   public:
@@ -237,6 +260,7 @@ private:
   static TypeHandle _type_handle;
 
   friend class PartBundleNode;
+  friend class PartBundleCollection;
   friend class Character;
   friend class MovingPartBase;
   friend class MovingPartMatrix;
@@ -0,0 +1,172 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file partBundleCollection.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "partBundleCollection.h"
+#include "config_chan.h"
+#include "asyncParallelFor.h"
+
+#include <algorithm>
+
+/**
+ *
+ */
+PartBundleCollection::
+PartBundleCollection() :
+  _num_threads(1)
+{
+}
+
+/**
+ * Adds a new PartBundle to the collection.  It is not an error to add a
+ * bundle that is already in the collection, but it will only be updated once.
+ */
+void PartBundleCollection::
+add_bundle(PartBundle *bundle) {
+  nassertv(bundle != nullptr);
+  if (!has_bundle(bundle)) {
+    _bundles.push_back(bundle);
+  }
+}
+
+/**
+ * Removes the indicated PartBundle from the collection.  Returns true if the
+ * bundle was removed, false if it was not a member of the collection.
+ */
+bool PartBundleCollection::
+remove_bundle(PartBundle *bundle) {
+  Bundles::iterator bi = std::find(_bundles.begin(), _bundles.end(), bundle);
+  if (bi == _bundles.end()) {
+    return false;
+  }
+  _bundles.erase(bi);
+  return true;
+}
+
+/**
+ * Returns true if the indicated PartBundle is a member of the collection,
+ * false otherwise.
+ */
+bool PartBundleCollection::
+has_bundle(PartBundle *bundle) const {
+  return std::find(_bundles.begin(), _bundles.end(), bundle) != _bundles.end();
+}
+
+/**
+ * Removes all PartBundles from the collection.
+ */
+void PartBundleCollection::
+clear() {
+  _bundles.clear();
+}
+
+/**
+ * Calls PartBundle::update() on each of the bundles in the collection.
+ * Returns true if any part of any bundle has changed as a result, or false
+ * otherwise.
+ */
+bool PartBundleCollection::
+update() {
+  return do_update(false);
+}
+
+/**
+ * Calls PartBundle::force_update() on each of the bundles in the collection.
+ * Returns true if any part of any bundle has changed as a result, or false
+ * otherwise.
+ */
+bool PartBundleCollection::
+force_update() {
+  return do_update(true);
+}
+
+/**
+ *
+ */
+void PartBundleCollection::
+output(std::ostream &out) const {
+  out << _bundles.size() << " bundles";
+}
+
+/**
+ * The implementation of update() and force_update().
+ */
+bool PartBundleCollection::
+do_update(bool force) {
+  size_t num_bundles = _bundles.size();
+
+  if (_num_threads <= 1 || num_bundles <= 1) {
+    // Just update them all on this thread.
+    bool any_changed = false;
+    for (PartBundle *bundle : _bundles) {
+      if (force ? bundle->force_update() : bundle->update()) {
+        any_changed = true;
+      }
+    }
+    return any_changed;
+  }
+
+  Thread *current_thread = Thread::get_current_thread();
+
+  ParallelUpdate parallel;
+  parallel._bundles = &_bundles;
+  parallel._force = force;
+  parallel._pipeline_stage = current_thread->get_pipeline_stage();
+  parallel._changed.resize(num_bundles, 0);
+
+  // While the bundles are being updated, they must hold on to the changes
+  // that would affect the rest of the scene graph.
+  pvector<PartBundle::DeferredChanges> deferred(num_bundles);
+  for (size_t i = 0; i < num_bundles; ++i) {
+    nassertr(_bundles[i]->_deferred == nullptr, false);
+    _bundles[i]->_deferred = &deferred[i];
+  }
+
+  size_t grain_size = (num_bundles + _num_threads - 1) / _num_threads;
+  AsyncTaskChain *chain =
+    AsyncParallelFor::get_task_chain("anim", anim_num_threads);
+  AsyncParallelFor::run(chain, num_bundles, grain_size,
+                        &update_bundles, &parallel);
+
+  // Now apply those changes, in the order of the bundles.
+  bool any_changed = false;
+  for (size_t i = 0; i < num_bundles; ++i) {
+    _bundles[i]->_deferred = nullptr;
+    deferred[i].apply(current_thread);
+    if (parallel._changed[i]) {
+      any_changed = true;
+    }
+  }
+  return any_changed;
+}
+
+/**
+ * The work function for do_update(): updates the indicated range of bundles.
+ */
+void PartBundleCollection::
+update_bundles(size_t begin, size_t end, void *user_data) {
+  ParallelUpdate *parallel = (ParallelUpdate *)user_data;
+
+  // Make sure we update the same pipeline stage as the thread that asked for
+  // the update.
+  Thread *current_thread = Thread::get_current_thread();
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(parallel->_pipeline_stage);
+
+  for (size_t i = begin; i < end; ++i) {
+    PartBundle *bundle = (*parallel->_bundles)[i];
+    bool changed = parallel->_force ? bundle->force_update() : bundle->update();
+    parallel->_changed[i] = changed;
+  }
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
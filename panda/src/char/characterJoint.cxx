@@ -140,8 +140,7 @@ update_internals(PartBundle *root, PartGroup *parent, bool self_changed,
       for (ai = _net_transform_nodes.begin();
            ai != _net_transform_nodes.end();
            ++ai) {
-        PandaNode *node = *ai;
-        node->set_transform(t, current_thread);
+        root->set_node_transform(*ai, t, current_thread);
       }
     }
 
@@ -152,7 +151,7 @@ update_internals(PartBundle *root, PartGroup *parent, bool self_changed,
     // underlying matrix.
     VertexTransforms::iterator vti;
     for (vti = _vertex_transforms.begin(); vti != _vertex_transforms.end(); ++vti) {
-      (*vti)->mark_modified(current_thread);
+      root->mark_transform_modified(*vti, current_thread);
     }
   }
 
@@ -163,8 +162,7 @@ update_internals(PartBundle *root, PartGroup *parent, bool self_changed,
     for (ai = _local_transform_nodes.begin();
          ai != _local_transform_nodes.end();
          ++ai) {
-      PandaNode *node = *ai;
-      node->set_transform(t, current_thread);
+      root->set_node_transform(*ai, t, current_thread);
     }
   }
 
@@ -70,12 +70,12 @@ make_copy() const {
  * or false otherwise.
  */
 bool CharacterSlider::
-update_internals(PartBundle *, PartGroup *, bool, bool, Thread *current_thread) {
+update_internals(PartBundle *root, PartGroup *, bool, bool, Thread *current_thread) {
   // Tell our related CharacterVertexSliders that they now need to recompute
   // themselves.
   VertexSliders::iterator vsi;
   for (vsi = _vertex_sliders.begin(); vsi != _vertex_sliders.end(); ++vsi) {
-    (*vsi)->mark_modified(current_thread);
+    root->mark_slider_modified(*vsi, current_thread);
   }
 
   return true;
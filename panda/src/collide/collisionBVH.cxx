@@ -0,0 +1,193 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file collisionBVH.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "collisionBVH.h"
+#include "boundingBox.h"
+#include "finiteBoundingVolume.h"
+
+#include <algorithm>
+
+// The maximum number of items that are stored together in a leaf.  Testing a
+// handful of items directly is cheaper than descending further.
+static const int max_leaf_items = 4;
+
+/**
+ *
+ */
+CollisionBVH::
+CollisionBVH() :
+  _num_items(0)
+{
+}
+
+/**
+ * Adds a new item with the indicated bounding volume.  If the volume is
+ * empty, the item will never be returned; if it is infinite or otherwise not
+ * finite, it will always be returned.
+ */
+void CollisionBVH::
+add_item(const BoundingVolume *bounds) {
+  const FiniteBoundingVolume *fbv = bounds->as_finite_bounding_volume();
+  if (bounds->is_empty()) {
+    // Give it a bounding box that will never be returned.
+    nassertv(_nodes.empty());
+    Item item;
+    item._min = item._max = item._center = LPoint3::zero();
+    _items.push_back(item);
+    ++_num_items;
+
+  } else if (fbv != nullptr && !fbv->is_infinite()) {
+    add_item(fbv->get_min(), fbv->get_max());
+
+  } else {
+    add_unbounded_item();
+  }
+}
+
+/**
+ * Builds the hierarchy over all of the items added so far.  No more items may
+ * be added after this call.
+ */
+void CollisionBVH::
+build() {
+  nassertv(_nodes.empty());
+  if (_indices.empty()) {
+    return;
+  }
+
+  // A binary tree with leaves of at least one item has fewer than twice as
+  // many nodes as items.
+  _nodes.reserve(_indices.size() * 2);
+  _nodes.push_back(Node());
+  r_build(0, 0, (int)_indices.size());
+}
+
+/**
+ * Fills the result vector with the numbers of all of the items whose bounds
+ * might intersect the indicated volume, in increasing order.  If volume is
+ * NULL, all items are returned.
+ */
+void CollisionBVH::
+find_overlaps(const GeometricBoundingVolume *volume, vector_int &result) const {
+  result.clear();
+
+  if (volume == nullptr) {
+    result.reserve(_num_items);
+    for (int i = 0; i < _num_items; ++i) {
+      result.push_back(i);
+    }
+    return;
+  }
+
+  result.insert(result.end(), _unbounded.begin(), _unbounded.end());
+
+  if (!_nodes.empty()) {
+    // The tree is built by splitting at the median, so its depth is
+    // logarithmic in the number of items; this stack is plenty deep.
+    int stack[128];
+    int sp = 0;
+    stack[sp++] = 0;
+
+    BoundingBox box;
+    while (sp > 0) {
+      const Node &node = _nodes[stack[--sp]];
+      box.set_min_max(node._min, node._max);
+      if (box.contains(volume) == BoundingVolume::IF_no_intersection) {
+        continue;
+      }
+
+      if (node._num_items != 0) {
+        const int *ip = &_indices[node._first];
+        result.insert(result.end(), ip, ip + node._num_items);
+      } else {
+        nassertd(sp + 2 <= 128) break;
+        stack[sp++] = node._first + 1;
+        stack[sp++] = node._first;
+      }
+    }
+  }
+
+  // The callers rely on the items being returned in the order they were
+  // added, so that the results don't depend on the shape of the tree.
+  std::sort(result.begin(), result.end());
+}
+
+/**
+ *
+ */
+void CollisionBVH::
+output(std::ostream &out) const {
+  out << "CollisionBVH, " << _num_items << " items, " << _nodes.size()
+      << " nodes";
+}
+
+/**
+ * Recursively fills in the indicated node with the items in the range
+ * [begin, end) of _indices, splitting it if it has too many items.
+ */
+void CollisionBVH::
+r_build(int node_index, int begin, int end) {
+  // Compute the bounds of the items, and of their centers.
+  const Item &first = _items[_indices[begin]];
+  LPoint3 min_point = first._min;
+  LPoint3 max_point = first._max;
+  LPoint3 min_center = first._center;
+  LPoint3 max_center = first._center;
+  for (int i = begin + 1; i < end; ++i) {
+    const Item &item = _items[_indices[i]];
+    for (int c = 0; c < 3; ++c) {
+      min_point[c] = std::min(min_point[c], item._min[c]);
+      max_point[c] = std::max(max_point[c], item._max[c]);
+      min_center[c] = std::min(min_center[c], item._center[c]);
+      max_center[c] = std::max(max_center[c], item._center[c]);
+    }
+  }
+  _nodes[node_index]._min = min_point;
+  _nodes[node_index]._max = max_point;
+
+  // Split along the axis in which the centers are most spread out.
+  LVector3 extent = max_center - min_center;
+  int axis = 0;
+  if (extent[1] > extent[axis]) {
+    axis = 1;
+  }
+  if (extent[2] > extent[axis]) {
+    axis = 2;
+  }
+
+  if (end - begin <= max_leaf_items || extent[axis] <= 0.0f) {
+    // Make this a leaf.  We also end up here if all of the centers
+    // coincide, since there's no sensible way to split them up.
+    _nodes[node_index]._first = begin;
+    _nodes[node_index]._num_items = end - begin;
+    return;
+  }
+
+  int mid = begin + (end - begin) / 2;
+  const Items &items = _items;
+  std::nth_element(_indices.begin() + begin, _indices.begin() + mid,
+                   _indices.begin() + end,
+                   [&items, axis](int a, int b) {
+    return items[a]._center[axis] < items[b]._center[axis];
+  });
+
+  // The two children are stored next to each other.
+  int first_child = (int)_nodes.size();
+  _nodes[node_index]._first = first_child;
+  _nodes[node_index]._num_items = 0;
+  _nodes.push_back(Node());
+  _nodes.push_back(Node());
+
+  r_build(first_child, begin, mid);
+  r_build(first_child + 1, mid, end);
+}
@@ -61,6 +61,10 @@ CollisionNode(const CollisionNode &copy) :
   _collider_sort(copy._collider_sort),
   _solids(copy._solids)
 {
+  // The hierarchy only refers to the solids by index, so it can be shared.
+  LightMutexHolder holder(copy._bvh_lock);
+  _bvh = copy._bvh;
+  _bvh_bounds = copy._bvh_bounds;
 }
 
 /**
@@ -107,6 +111,7 @@ xform(const LMatrix4 &mat) {
     solid->xform(mat);
   }
   mark_internal_bounds_stale();
+  mark_bvh_stale();
 }
 
 /**
@@ -135,6 +140,7 @@ combine_with(PandaNode *other) {
         const COWPT(CollisionSolid) *solids_end = solids_begin + cother->_solids.size();
         _solids.insert(_solids.end(), solids_begin, solids_end);
         mark_internal_bounds_stale();
+        mark_bvh_stale();
         return this;
       }
 
@@ -268,6 +274,52 @@ set_from_collide_mask(CollideMask mask) {
   _from_collide_mask = mask;
 }
 
+/**
+ * Returns a bounding volume hierarchy over the solids of this node, for the
+ * benefit of the CollisionTraverser, or NULL if the node has too few solids
+ * for this to be worthwhile (see collision-bvh-min-items).  The hierarchy is
+ * built the first time it is requested, and kept until the set of solids is
+ * changed, or until one of the solids has different bounds than it had when
+ * the hierarchy was built, such as when it is modified in-place.
+ */
+CPT(CollisionBVH) CollisionNode::
+get_bvh() const {
+  int min_items = collision_bvh_min_items;
+  if (min_items <= 0 || _solids.size() < (size_t)min_items) {
+    return nullptr;
+  }
+
+  Thread *current_thread = Thread::get_current_thread();
+  LightMutexHolder holder(_bvh_lock);
+  if (_bvh != nullptr) {
+    // Make sure that none of the solids has been changed since.
+    nassertr(_bvh_bounds.size() == _solids.size(), nullptr);
+    for (size_t i = 0; i < _solids.size(); ++i) {
+      CPT(CollisionSolid) solid = _solids[i].get_read_pointer(current_thread);
+      if (solid->get_bounds() != _bvh_bounds[i]) {
+        _bvh.clear();
+        break;
+      }
+    }
+  }
+
+  if (_bvh == nullptr) {
+    PT(CollisionBVH) bvh = new CollisionBVH;
+    _bvh_bounds.clear();
+    _bvh_bounds.reserve(_solids.size());
+    Solids::const_iterator si;
+    for (si = _solids.begin(); si != _solids.end(); ++si) {
+      CPT(CollisionSolid) solid = (*si).get_read_pointer(current_thread);
+      CPT(BoundingVolume) bounds = solid->get_bounds();
+      bvh->add_item(bounds);
+      _bvh_bounds.push_back(std::move(bounds));
+    }
+    bvh->build();
+    _bvh = bvh;
+  }
+  return _bvh;
+}
+
 /**
  * Called when needed to recompute the node's _internal_bound object.  Nodes
  * that contain anything of substance should redefine this to do the right
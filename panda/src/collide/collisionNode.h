@@ -17,9 +17,12 @@
 #include "pandabase.h"
 
 #include "collisionSolid.h"
+#include "collisionBVH.h"
 
 #include "collideMask.h"
 #include "pandaNode.h"
+#include "lightMutex.h"
+#include "lightMutexHolder.h"
 
 /**
  * A node in the scene graph that can hold any number of CollisionSolids.
@@ -78,6 +81,9 @@ PUBLISHED:
   INLINE static CollideMask get_default_collide_mask();
   MAKE_PROPERTY(default_collide_mask, get_default_collide_mask);
 
+public:
+  CPT(CollisionBVH) get_bvh() const;
+
 protected:
   virtual void compute_internal_bounds(CPT(BoundingVolume) &internal_bounds,
                                        int &internal_vertices,
@@ -86,6 +92,7 @@ protected:
 
 private:
   CPT(RenderState) get_last_pos_state();
+  INLINE void mark_bvh_stale();
 
   // This data is not cycled, for now.  We assume the collision traversal will
   // take place in App only.  Perhaps we will revisit this later.
@@ -95,6 +102,15 @@ private:
   typedef pvector< COWPT(CollisionSolid) > Solids;
   Solids _solids;
 
+  // The hierarchy over _solids, built on demand by get_bvh(), and the bounds
+  // of each solid it was built from.  A solid gets a new bounding volume
+  // object whenever it is changed, so the hierarchy is rebuilt if any of
+  // these no longer match.
+  typedef pvector<CPT(BoundingVolume)> BVHBounds;
+  mutable LightMutex _bvh_lock;
+  mutable CPT(CollisionBVH) _bvh;
+  mutable BVHBounds _bvh_bounds;
+
   friend class CollisionTraverser;
 
 public:
@@ -35,6 +35,9 @@
 #include "nodePath.h"
 #include "pStatTimer.h"
 #include "indent.h"
+#include "vector_int.h"
+#include "asyncParallelFor.h"
+#include "lightMutexHolder.h"
 
 #include <algorithm>
 
@@ -74,6 +77,7 @@ CollisionTraverser(const std::string &name) :
   _this_pcollector(_collisions_pcollector, name)
 {
   _respect_prev_transform = respect_prev_transform;
+  _num_threads = 1;
   #ifdef DO_COLLISION_RECORDING
   _recorder = nullptr;
   #endif
@@ -260,6 +264,8 @@ traverse(const NodePath &root) {
   }
   #endif  // DO_COLLISION_RECORDING
 
+  clean_geom_triangles();
+
   Handlers::iterator hi;
   for (hi = _handlers.begin(); hi != _handlers.end(); ++hi) {
     if ((*hi).first->wants_all_potential_collidees()) {
@@ -279,13 +285,24 @@ traverse(const NodePath &root) {
     if (level_states.size() == 1 || !allow_collider_multiple) {
       traversal_done = true;
 
-      // Make a number of passes, one for each group of 32 Colliders (or
-      // whatever number of bits we have available in CurrentMask).
-      for (size_t pass = 0; pass < level_states.size(); ++pass) {
+      bool parallel = (_num_threads > 1 && level_states.size() > 1 &&
+                       Thread::is_threading_supported());
+#ifdef DO_COLLISION_RECORDING
+      parallel = parallel && !has_recorder();
+#endif
+
+      if (parallel) {
+        traverse_parallel_single(level_states);
+
+      } else {
+        // Make a number of passes, one for each group of 32 Colliders (or
+        // whatever number of bits we have available in CurrentMask).
+        for (size_t pass = 0; pass < level_states.size(); ++pass) {
 #ifdef DO_PSTATS
-        PStatTimer pass_timer(get_pass_collector(pass));
+          PStatTimer pass_timer(get_pass_collector(pass));
 #endif
-        r_traverse_single(level_states[pass], pass);
+          r_traverse_single(level_states[pass], pass);
+        }
       }
     }
   }
@@ -470,6 +487,121 @@ write(std::ostream &out, int indent_level) const {
   }
 }
 
+/**
+ * Holds the state of a parallel traversal.  The collisions detected in each
+ * pass are collected in the order they are detected, and only handed to the
+ * real handlers once all of the passes are done.
+ */
+class CollisionTraverser::ParallelTraversal {
+public:
+  typedef std::pair<CollisionHandler *, PT(CollisionEntry)> Entry;
+  typedef pvector<Entry> Entries;
+
+  // Stands in for a real handler during one pass.
+  class DeferredHandler : public CollisionHandler {
+  public:
+    DeferredHandler(CollisionHandler *handler, Entries *entries) :
+      _handler(handler),
+      _entries(entries)
+    {
+      _wants_all_potential_collidees = handler->_wants_all_potential_collidees;
+      _root = handler->_root;
+    }
+
+    virtual void add_entry(CollisionEntry *entry) {
+      _entries->push_back(Entry(_handler, entry));
+    }
+
+    CollisionHandler *_handler;
+    Entries *_entries;
+  };
+
+  class Pass {
+  public:
+    Entries _entries;
+    pmap<CollisionHandler *, PT(DeferredHandler)> _handlers;
+  };
+
+  CollisionTraverser *_trav;
+  LevelStatesSingle *_level_states;
+  pvector<Pass> _passes;
+  int _pipeline_stage;
+};
+
+/**
+ * Performs the passes of the traversal on several threads at once.  See
+ * set_num_threads().
+ */
+void CollisionTraverser::
+traverse_parallel_single(LevelStatesSingle &level_states) {
+  size_t num_passes = level_states.size();
+
+#ifdef DO_PSTATS
+  // Create the pass collectors up front, since the threads can't.
+  get_pass_collector((int)num_passes - 1);
+#endif
+
+  ParallelTraversal parallel;
+  parallel._trav = this;
+  parallel._level_states = &level_states;
+  parallel._passes.resize(num_passes);
+  parallel._pipeline_stage = Thread::get_current_pipeline_stage();
+
+  // Point each collider at a handler that will hold on to its entries.
+  for (size_t pass = 0; pass < num_passes; ++pass) {
+    ParallelTraversal::Pass &pass_data = parallel._passes[pass];
+    CollisionLevelStateSingle::Colliders &colliders = level_states[pass]._colliders;
+    for (size_t c = 0; c < colliders.size(); ++c) {
+      CollisionHandler *handler = colliders[c]._handler;
+      PT(ParallelTraversal::DeferredHandler) &deferred = pass_data._handlers[handler];
+      if (deferred == nullptr) {
+        deferred = new ParallelTraversal::DeferredHandler(handler, &pass_data._entries);
+      }
+      colliders[c]._handler = deferred;
+    }
+  }
+
+  // Divide the passes into as many groups as we have been asked to use
+  // threads.
+  size_t grain_size = (num_passes + _num_threads - 1) / _num_threads;
+  AsyncTaskChain *chain =
+    AsyncParallelFor::get_task_chain("collide", collision_num_threads);
+  AsyncParallelFor::run(chain, num_passes, grain_size,
+                        &traverse_passes, &parallel);
+
+  // Now deliver the entries, in the order of the passes.
+  for (const ParallelTraversal::Pass &pass_data : parallel._passes) {
+    for (const ParallelTraversal::Entry &entry : pass_data._entries) {
+      entry.first->add_entry(entry.second);
+    }
+  }
+}
+
+/**
+ * The work function for traverse_parallel_single(): traverses the indicated
+ * range of passes.
+ */
+void CollisionTraverser::
+traverse_passes(size_t begin, size_t end, void *user_data) {
+  ParallelTraversal *parallel = (ParallelTraversal *)user_data;
+  CollisionTraverser *trav = parallel->_trav;
+
+  // Make sure we read the scene graph from the same pipeline stage as the
+  // thread that started the traversal.
+  Thread *current_thread = Thread::get_current_thread();
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(parallel->_pipeline_stage);
+
+  for (size_t pass = begin; pass < end; ++pass) {
+#ifdef DO_PSTATS
+    PStatTimer pass_timer(trav->_pass_collectors[pass], current_thread);
+#endif
+    trav->r_traverse_single((*parallel->_level_states)[pass], pass);
+  }
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
+
 /**
  * Fills up the set of LevelStates corresponding to the active colliders in
  * use.
@@ -520,6 +652,7 @@ prepare_colliders_single(CollisionTraverser::LevelStatesSingle &level_states,
       CollisionLevelStateSingle::ColliderDef def;
       def._node = cnode;
       def._node_path = cnode_path;
+      def._handler = get_handler(cnode_path);
 
       int num_solids = cnode->get_num_solids();
       for (int s = 0; s < num_solids; ++s) {
@@ -589,7 +722,7 @@ r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -634,7 +767,7 @@ r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_geom_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -731,6 +864,7 @@ prepare_colliders_double(CollisionTraverser::LevelStatesDouble &level_states,
       CollisionLevelStateDouble::ColliderDef def;
       def._node = cnode;
       def._node_path = cnode_path;
+      def._handler = get_handler(cnode_path);
 
       int num_solids = cnode->get_num_solids();
       for (int s = 0; s < num_solids; ++s) {
@@ -800,7 +934,7 @@ r_traverse_double(CollisionLevelStateDouble &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -845,7 +979,7 @@ r_traverse_double(CollisionLevelStateDouble &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_geom_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -942,6 +1076,7 @@ prepare_colliders_quad(CollisionTraverser::LevelStatesQuad &level_states,
       CollisionLevelStateQuad::ColliderDef def;
       def._node = cnode;
       def._node_path = cnode_path;
+      def._handler = get_handler(cnode_path);
 
       int num_solids = cnode->get_num_solids();
       for (int s = 0; s < num_solids; ++s) {
@@ -1011,7 +1146,7 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -1056,7 +1191,7 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
           entry._from = level_state.get_collider(c);
 
           compare_collider_to_geom_node(
-              entry,
+              entry, level_state.get_collider_handler(c),
               level_state.get_parent_bound(c),
               level_state.get_local_bound(c),
               node_gbv);
@@ -1107,7 +1242,7 @@ r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass) {
  *
  */
 void CollisionTraverser::
-compare_collider_to_node(CollisionEntry &entry,
+compare_collider_to_node(CollisionEntry &entry, CollisionHandler *handler,
                          const GeometricBoundingVolume *from_parent_gbv,
                          const GeometricBoundingVolume *from_node_gbv,
                          const GeometricBoundingVolume *into_node_gbv) {
@@ -1137,14 +1272,21 @@ compare_collider_to_node(CollisionEntry &entry,
     // we just tested, is the same as the solid's bounding volume.)
     if (num_solids == 1) {
       entry._into = cnode->_solids[0].get_read_pointer(current_thread);
-      Colliders::const_iterator ci;
-      ci = _colliders.find(entry.get_from_node_path());
-      nassertv(ci != _colliders.end());
-      entry.test_intersection((*ci).second, this);
+      entry.test_intersection(handler, this);
     } else {
-      CollisionNode::Solids::const_iterator si;
-      for (si = cnode->_solids.begin(); si != cnode->_solids.end(); ++si) {
-        entry._into = (*si).get_read_pointer(current_thread);
+      // If the node has enough solids to have a bounding volume hierarchy,
+      // use it to narrow down the solids we need to look at.
+      CPT(CollisionBVH) bvh = cnode->get_bvh();
+      vector_int indices;
+      size_t num_tests = num_solids;
+      if (bvh != nullptr) {
+        bvh->find_overlaps(from_node_gbv, indices);
+        num_tests = indices.size();
+      }
+
+      for (size_t i = 0; i < num_tests; ++i) {
+        size_t si = (bvh != nullptr) ? (size_t)indices[i] : i;
+        entry._into = cnode->_solids[si].get_read_pointer(current_thread);
 
         // We should allow a collision test for solid into itself, because the
         // solid might be simply instanced into multiple different
@@ -1156,7 +1298,7 @@ compare_collider_to_node(CollisionEntry &entry,
           solid_gbv = (const GeometricBoundingVolume *)solid_bv.p();
         }
 
-        compare_collider_to_solid(entry, from_node_gbv, solid_gbv);
+        compare_collider_to_solid(entry, handler, from_node_gbv, solid_gbv);
       }
     }
   }
@@ -1166,7 +1308,7 @@ compare_collider_to_node(CollisionEntry &entry,
  *
  */
 void CollisionTraverser::
-compare_collider_to_geom_node(CollisionEntry &entry,
+compare_collider_to_geom_node(CollisionEntry &entry, CollisionHandler *handler,
                               const GeometricBoundingVolume *from_parent_gbv,
                               const GeometricBoundingVolume *from_node_gbv,
                               const GeometricBoundingVolume *into_node_gbv) {
@@ -1197,7 +1339,7 @@ compare_collider_to_geom_node(CollisionEntry &entry,
           DCAST_INTO_V(geom_gbv, geom_bv);
         }
 
-        compare_collider_to_geom(entry, geom, from_node_gbv, geom_gbv);
+        compare_collider_to_geom(entry, handler, geom, from_node_gbv, geom_gbv);
       }
     }
   }
@@ -1207,7 +1349,7 @@ compare_collider_to_geom_node(CollisionEntry &entry,
  *
  */
 void CollisionTraverser::
-compare_collider_to_solid(CollisionEntry &entry,
+compare_collider_to_solid(CollisionEntry &entry, CollisionHandler *handler,
                           const GeometricBoundingVolume *from_node_gbv,
                           const GeometricBoundingVolume *solid_gbv) {
   bool within_solid_bounds = true;
@@ -1227,10 +1369,7 @@ compare_collider_to_solid(CollisionEntry &entry,
 #endif  // NDEBUG
   }
   if (within_solid_bounds) {
-    Colliders::const_iterator ci;
-    ci = _colliders.find(entry.get_from_node_path());
-    nassertv(ci != _colliders.end());
-    entry.test_intersection((*ci).second, this);
+    entry.test_intersection(handler, this);
   }
 }
 
@@ -1238,7 +1377,8 @@ compare_collider_to_solid(CollisionEntry &entry,
  *
  */
 void CollisionTraverser::
-compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
+compare_collider_to_geom(CollisionEntry &entry, CollisionHandler *handler,
+                         const Geom *geom,
                          const GeometricBoundingVolume *from_node_gbv,
                          const GeometricBoundingVolume *geom_gbv) {
   bool within_geom_bounds = true;
@@ -1248,11 +1388,32 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
     _geom_volume_pcollector.add_level(1);
   }
   if (within_geom_bounds) {
-    Colliders::const_iterator ci;
-    ci = _colliders.find(entry.get_from_node_path());
-    nassertv(ci != _colliders.end());
+    const TriangleCache *triangles = get_geom_triangles(geom);
+    if (triangles != nullptr) {
+      // This is a large Geom, for which we have a hierarchy over its
+      // triangles.  Only visit the triangles that might intersect.
+      vector_int indices;
+      triangles->_bvh->find_overlaps(from_node_gbv, indices);
+
+      for (int index : indices) {
+        const LPoint3 *v = &triangles->_vertices[index * 3];
+        bool within_solid_bounds = true;
+        if (from_node_gbv != nullptr) {
+          PT(BoundingSphere) sphere = new BoundingSphere;
+          sphere->around(v, v + 3);
+          within_solid_bounds = (sphere->contains(from_node_gbv) != 0);
+#ifdef DO_PSTATS
+          CollisionGeom::_volume_pcollector.add_level(1);
+#endif  // DO_PSTATS
+        }
+        if (within_solid_bounds) {
+          PT(CollisionGeom) cgeom = new CollisionGeom(LVecBase3(v[0]), LVecBase3(v[1]), LVecBase3(v[2]));
+          entry._into = cgeom;
+          entry.test_intersection(handler, this);
+        }
+      }
 
-    if (geom->get_primitive_type() == Geom::PT_polygons) {
+    } else if (geom->get_primitive_type() == Geom::PT_polygons) {
       Thread *current_thread = Thread::get_current_thread();
       CPT(GeomVertexData) data = geom->get_animated_vertex_data(true, current_thread);
       GeomVertexReader vertex(data, InternalName::get_vertex());
@@ -1291,7 +1452,7 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
               if (within_solid_bounds) {
                 PT(CollisionGeom) cgeom = new CollisionGeom(LVecBase3(v[0]), LVecBase3(v[1]), LVecBase3(v[2]));
                 entry._into = cgeom;
-                entry.test_intersection((*ci).second, this);
+                entry.test_intersection(handler, this);
               }
             }
           }
@@ -1321,7 +1482,7 @@ compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
               if (within_solid_bounds) {
                 PT(CollisionGeom) cgeom = new CollisionGeom(LVecBase3(v[0]), LVecBase3(v[1]), LVecBase3(v[2]));
                 entry._into = cgeom;
-                entry.test_intersection((*ci).second, this);
+                entry.test_intersection(handler, this);
               }
             }
           }
@@ -1384,6 +1545,118 @@ remove_handler(CollisionTraverser::Handlers::iterator hi) {
   return hi;
 }
 
+/**
+ * Returns the cached triangles of the indicated Geom, building them first if
+ * necessary, or NULL if the Geom is not suitable for caching, because it is
+ * animated or has too few triangles.
+ */
+const CollisionTraverser::TriangleCache *CollisionTraverser::
+get_geom_triangles(const Geom *geom) {
+  int min_items = collision_bvh_min_items;
+  if (min_items <= 0 || geom->get_primitive_type() != Geom::PT_polygons) {
+    return nullptr;
+  }
+
+  Thread *current_thread = Thread::get_current_thread();
+  CPT(GeomVertexData) data = geom->get_vertex_data(current_thread);
+  if (data->get_format()->get_animation().get_animation_type() != Geom::AT_none) {
+    // The vertices may be different each time; don't bother.
+    return nullptr;
+  }
+
+  // This may be called from several threads at once during a parallel
+  // traversal.  Once an entry is built, it won't change again until the next
+  // traversal.
+  LightMutexHolder holder(_geom_triangles_lock);
+  TriangleCache &triangles = _geom_triangles[geom];
+  UpdateSeq geom_modified = geom->get_modified(current_thread);
+  UpdateSeq data_modified = data->get_modified(current_thread);
+  if (triangles._geom == geom && !triangles._geom.was_deleted() &&
+      triangles._geom_modified == geom_modified &&
+      triangles._data_modified == data_modified) {
+    return (triangles._bvh != nullptr) ? &triangles : nullptr;
+  }
+
+  // We have to (re)build the triangle list.  We collect the same triangles,
+  // in the same order, as compare_collider_to_geom() would otherwise visit.
+  triangles._geom = (Geom *)geom;
+  triangles._geom_modified = geom_modified;
+  triangles._data_modified = data_modified;
+  triangles._vertices.clear();
+  triangles._bvh.clear();
+
+  if (geom->get_nested_vertices(current_thread) < min_items) {
+    return nullptr;
+  }
+
+  GeomVertexReader vertex(data, InternalName::get_vertex(), current_thread);
+  int num_primitives = geom->get_num_primitives();
+  for (int i = 0; i < num_primitives; ++i) {
+    CPT(GeomPrimitive) tris = geom->get_primitive(i)->decompose();
+    nassertr(tris->is_of_type(GeomTriangles::get_class_type()), nullptr);
+
+    GeomVertexReader index;
+    if (tris->is_indexed()) {
+      index = GeomVertexReader(tris->get_vertices(), 0, current_thread);
+    } else {
+      vertex.set_row_unsafe(tris->get_first_vertex());
+    }
+    int num_vertices = tris->get_num_vertices();
+    for (int j = 0; j + 2 < num_vertices; j += 3) {
+      LPoint3 v[3];
+      for (int k = 0; k < 3; ++k) {
+        if (tris->is_indexed()) {
+          vertex.set_row_unsafe(index.get_data1i());
+        }
+        v[k] = vertex.get_data3();
+      }
+      if (CollisionPolygon::verify_points(v[0], v[1], v[2])) {
+        triangles._vertices.insert(triangles._vertices.end(), v, v + 3);
+      }
+    }
+  }
+
+  int num_triangles = (int)triangles._vertices.size() / 3;
+  if (num_triangles < min_items) {
+    return nullptr;
+  }
+
+  PT(CollisionBVH) bvh = new CollisionBVH;
+  for (int i = 0; i < num_triangles; ++i) {
+    const LPoint3 *v = &triangles._vertices[i * 3];
+    LPoint3 min_point = v[0];
+    LPoint3 max_point = v[0];
+    for (int c = 0; c < 3; ++c) {
+      min_point[c] = std::min(min_point[c], std::min(v[1][c], v[2][c]));
+      max_point[c] = std::max(max_point[c], std::max(v[1][c], v[2][c]));
+    }
+    bvh->add_item(min_point, max_point);
+  }
+  bvh->build();
+  triangles._bvh = bvh;
+
+  if (collide_cat.is_debug()) {
+    collide_cat.debug()
+      << "Built " << *bvh << " for " << *geom << "\n";
+  }
+  return &triangles;
+}
+
+/**
+ * Removes the cached triangles of any Geoms that have since been deleted.
+ */
+void CollisionTraverser::
+clean_geom_triangles() {
+  TriangleCaches::iterator gi = _geom_triangles.begin();
+  while (gi != _geom_triangles.end()) {
+    if ((*gi).second._geom.was_deleted()) {
+      gi = _geom_triangles.erase(gi);
+    } else {
+      ++gi;
+    }
+  }
+}
+
 /**
  * Returns the PStatCollector suitable for timing the nth pass.
  */
@@ -18,11 +18,15 @@
 
 #include "collisionHandler.h"
 #include "collisionLevelState.h"
+#include "collisionBVH.h"
 
 #include "pointerTo.h"
+#include "weakPointerTo.h"
+#include "updateSeq.h"
 #include "pStatCollector.h"
 
 #include "pset.h"
+#include "lightMutex.h"
 #include "register_type.h"
 
 class CollisionNode;
@@ -52,6 +56,10 @@ PUBLISHED:
   MAKE_PROPERTY(respect_prev_transform, get_respect_prev_transform,
                                         set_respect_prev_transform);
 
+  INLINE void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+  MAKE_PROPERTY(num_threads, get_num_threads, set_num_threads);
+
   void add_collider(const NodePath &collider, CollisionHandler *handler);
   bool remove_collider(const NodePath &collider);
   bool has_collider(const NodePath &collider) const;
@@ -83,6 +91,7 @@ private:
   typedef pvector<CollisionLevelStateSingle> LevelStatesSingle;
   void prepare_colliders_single(LevelStatesSingle &level_states, const NodePath &root);
   void r_traverse_single(CollisionLevelStateSingle &level_state, size_t pass);
+  void traverse_parallel_single(LevelStatesSingle &level_states);
 
   typedef pvector<CollisionLevelStateDouble> LevelStatesDouble;
   void prepare_colliders_double(LevelStatesDouble &level_states, const NodePath &root);
@@ -93,22 +102,45 @@ private:
   void r_traverse_quad(CollisionLevelStateQuad &level_state, size_t pass);
 
   void compare_collider_to_node(CollisionEntry &entry,
+                                CollisionHandler *handler,
                                 const GeometricBoundingVolume *from_parent_gbv,
                                 const GeometricBoundingVolume *from_node_gbv,
                                 const GeometricBoundingVolume *into_node_gbv);
   void compare_collider_to_geom_node(CollisionEntry &entry,
+                                     CollisionHandler *handler,
                                      const GeometricBoundingVolume *from_parent_gbv,
                                      const GeometricBoundingVolume *from_node_gbv,
                                      const GeometricBoundingVolume *into_node_gbv);
   void compare_collider_to_solid(CollisionEntry &entry,
+                                 CollisionHandler *handler,
                                  const GeometricBoundingVolume *from_node_gbv,
                                  const GeometricBoundingVolume *solid_gbv);
-  void compare_collider_to_geom(CollisionEntry &entry, const Geom *geom,
+  void compare_collider_to_geom(CollisionEntry &entry,
+                                CollisionHandler *handler, const Geom *geom,
                                 const GeometricBoundingVolume *from_node_gbv,
                                 const GeometricBoundingVolume *solid_gbv);
 
   PStatCollector &get_pass_collector(int pass);
 
+  // The non-degenerate triangles of a Geom that is being collided with, three
+  // vertices each, along with a hierarchy over them.  These are cached from
+  // one traversal to the next for large, non-animated Geoms.
+  class TriangleCache {
+  public:
+    WPT(Geom) _geom;
+    UpdateSeq _geom_modified;
+    UpdateSeq _data_modified;
+    pvector<LPoint3> _vertices;
+    PT(CollisionBVH) _bvh;
+  };
+  typedef pmap<const Geom *, TriangleCache> TriangleCaches;
+
+  const TriangleCache *get_geom_triangles(const Geom *geom);
+  void clean_geom_triangles();
+
+  class ParallelTraversal;
+  static void traverse_passes(size_t begin, size_t end, void *user_data);
+
 private:
   PT(CollisionHandler) _default_handler;
 
@@ -129,6 +161,9 @@ private:
   Handlers::iterator remove_handler(Handlers::iterator hi);
 
   bool _respect_prev_transform;
+  int _num_threads;
+  TriangleCaches _geom_triangles;
+  LightMutex _geom_triangles_lock;
 #ifdef DO_COLLISION_RECORDING
   CollisionRecorder *_recorder;
   NodePath _collision_visualizer_np;
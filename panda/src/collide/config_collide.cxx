@@ -111,6 +111,23 @@ ConfigVariableBool pushers_horizontal
           "set_horizontal() flag by default, false to let the move "
           "in three dimensions by default."));
 
+ConfigVariableInt collision_bvh_min_items
+("collision-bvh-min-items", 32,
+ PRC_DESC("A CollisionNode with at least this many solids, or a Geom that is "
+          "being collided with that has at least this many triangles, gets "
+          "a bounding volume hierarchy over its solids or triangles, so "
+          "that colliders need not be tested against each one in turn.  "
+          "The hierarchy is built the first time the node or Geom is "
+          "collided with.  Set this to 0 to disable the use of these "
+          "hierarchies altogether."));
+
+ConfigVariableInt collision_num_threads
+("collision-num-threads", 0,
+ PRC_DESC("The number of threads to create for the \"collide\" task chain, "
+          "which is used by CollisionTraversers that have been asked to split "
+          "up their traversal with set_num_threads().  The default of 0 means "
+          "to create one thread per CPU, less one for the calling thread."));
+
 /**
  * Initializes the library.  This must be called at least once before any of
  * the functions or classes in this library can be used.  Normally it will be
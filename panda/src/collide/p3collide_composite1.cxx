@@ -1,5 +1,6 @@
 #include "config_collide.cxx"
 #include "collisionBox.cxx"
+#include "collisionBVH.cxx"
 #include "collisionCapsule.cxx"
 #include "collisionEntry.cxx"
 #include "collisionGeom.cxx"
@@ -0,0 +1,114 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_collide_threads.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "collisionTraverser.h"
+#include "collisionHandlerQueue.h"
+#include "collisionNode.h"
+#include "collisionRay.h"
+#include "collisionPolygon.h"
+#include "nodePath.h"
+#include "pandaNode.h"
+#include "trueClock.h"
+#include "thread.h"
+
+// The number of ray colliders, one per NPC.
+static const int num_colliders = 5000;
+
+// The terrain is made of grid_size x grid_size CollisionNodes of
+// cell_size x cell_size quads each.
+static const int grid_size = 16;
+static const int cell_size = 16;
+
+// The number of times to traverse for each thread count.
+static const int num_iterations = 10;
+
+static NodePath
+make_terrain() {
+  NodePath terrain("terrain");
+  for (int gx = 0; gx < grid_size; ++gx) {
+    for (int gy = 0; gy < grid_size; ++gy) {
+      PT(CollisionNode) cnode = new CollisionNode("cell");
+      for (int x = 0; x < cell_size; ++x) {
+        for (int y = 0; y < cell_size; ++y) {
+          PN_stdfloat px = gx * cell_size + x;
+          PN_stdfloat py = gy * cell_size + y;
+          PN_stdfloat z = (x + y) % 3 * 0.1f;
+          cnode->add_solid(new CollisionPolygon(
+            LPoint3(px, py, z), LPoint3(px + 1, py, z),
+            LPoint3(px + 1, py + 1, z), LPoint3(px, py + 1, z)));
+        }
+      }
+      cnode->set_from_collide_mask(CollideMask::all_off());
+      terrain.attach_new_node(cnode);
+    }
+  }
+  return terrain;
+}
+
+int
+main(int argc, char *argv[]) {
+  NodePath root("root");
+  make_terrain().reparent_to(root);
+
+  PN_stdfloat extent = grid_size * cell_size;
+  CollisionTraverser trav("npcs");
+  PT(CollisionHandlerQueue) queue = new CollisionHandlerQueue;
+
+  unsigned int seed = 1;
+  for (int i = 0; i < num_colliders; ++i) {
+    seed = seed * 1103515245 + 12345;
+    PN_stdfloat x = (seed >> 8) % 10000 * extent / 10000.0f;
+    seed = seed * 1103515245 + 12345;
+    PN_stdfloat y = (seed >> 8) % 10000 * extent / 10000.0f;
+
+    PT(CollisionNode) cnode = new CollisionNode("npc");
+    cnode->add_solid(new CollisionRay(LPoint3(0, 0, 5), LVector3(0, 0, -1)));
+    cnode->set_into_collide_mask(CollideMask::all_off());
+    NodePath npc = root.attach_new_node(cnode);
+    npc.set_pos(x, y, 0);
+    trav.add_collider(npc, queue);
+  }
+
+  static const int thread_counts[] = { 1, 4, 16 };
+  TrueClock *clock = TrueClock::get_global_ptr();
+  int expected_entries = -1;
+
+  for (int num_threads : thread_counts) {
+    trav.set_num_threads(num_threads);
+
+    // Once to warm up the caches.
+    trav.traverse(root);
+    int num_entries = queue->get_num_entries();
+    if (expected_entries < 0) {
+      expected_entries = num_entries;
+    } else if (num_entries != expected_entries) {
+      nout << "Got " << num_entries << " entries with " << num_threads
+           << " threads, expected " << expected_entries << "!\n";
+      return 1;
+    }
+
+    double start = clock->get_short_time();
+    for (int i = 0; i < num_iterations; ++i) {
+      trav.traverse(root);
+    }
+    double elapsed = clock->get_short_time() - start;
+
+    nout << num_threads << " threads: "
+         << elapsed * 1000.0 / num_iterations << " ms per traversal, "
+         << num_entries << " entries\n";
+  }
+
+  Thread::prepare_for_exit();
+  return 0;
+}
@@ -40,6 +40,7 @@
 #include "bamCache.h"
 #include "cullableObject.h"
 #include "geomVertexArrayData.h"
+#include "sparseTextureImage.h"
 #include "vertexDataSaveFile.h"
 #include "vertexDataBook.h"
 #include "vertexDataPage.h"
@@ -919,6 +920,7 @@ render_frame() {
 #endif  // DO_PSTATS
 
     GeomVertexArrayData::lru_epoch();
+    SparseTextureImage::lru_epoch();
 
     // Now signal all of our threads to begin their next frame.
     Threads::const_iterator ti;
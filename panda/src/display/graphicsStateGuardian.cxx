@@ -301,11 +301,17 @@ GraphicsStateGuardian::
   // Note that if uniquify-states is false, we can't iterate over all the
   // states, and some GSGs will linger.  Let's hope this isn't a problem.
   LightReMutexHolder holder(*RenderState::_states_lock);
-  size_t size = RenderState::_states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const RenderState *state = RenderState::_states.get_key(si);
-    state->_mungers.remove(_id);
-    state->_munged_states.remove(_id);
+  RenderState::States::AllHolder shards_holder(RenderState::_states);
+  size_t num_shards = RenderState::_states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const RenderState::States::Table &table =
+      RenderState::_states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const RenderState *state = table.get_key(si);
+      state->_mungers.remove(_id);
+      state->_munged_states.remove(_id);
+    }
   }
 }
 
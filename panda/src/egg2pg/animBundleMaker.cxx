@@ -13,6 +13,7 @@
 
 #include "animBundleMaker.h"
 #include "config_egg2pg.h"
+#include "config_chan.h"
 
 #include "eggTable.h"
 #include "eggAnimData.h"
@@ -84,6 +85,10 @@ make_bundle() {
 
   bundle->sort_descendants();
 
+  if (pack_anim_joints) {
+    bundle->pack_joints();
+  }
+
   return bundle;
 }
 
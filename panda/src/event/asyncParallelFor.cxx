@@ -0,0 +1,161 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file asyncParallelFor.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "asyncParallelFor.h"
+#include "asyncTaskManager.h"
+#include "mutexHolder.h"
+#include "thread.h"
+
+#include <thread>
+
+TypeHandle AsyncParallelFor::Helper::_type_handle;
+
+/**
+ * Returns the task chain with the indicated name on the global
+ * AsyncTaskManager, creating it with the indicated number of threads if it
+ * does not already exist.  If num_threads is 0 or less, the chain is created
+ * with one thread per CPU, less one for the calling thread.
+ */
+AsyncTaskChain *AsyncParallelFor::
+get_task_chain(const std::string &chain_name, int num_threads) {
+  AsyncTaskManager *task_mgr = AsyncTaskManager::get_global_ptr();
+  AsyncTaskChain *chain = task_mgr->find_task_chain(chain_name);
+  if (chain == nullptr) {
+    chain = task_mgr->make_task_chain(chain_name);
+    if (num_threads <= 0) {
+      num_threads = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+    }
+    if (Thread::is_threading_supported()) {
+      chain->set_num_threads(num_threads);
+    }
+  }
+  return chain;
+}
+
+/**
+ * Processes all of the items in the range [0, num_items), in chunks of at
+ * most grain_size items, using the threads of the indicated task chain as
+ * well as the calling thread.  Returns when all items have been processed.
+ *
+ * The chain must belong to the global AsyncTaskManager; see
+ * get_task_chain().
+ */
+void AsyncParallelFor::
+run(AsyncTaskChain *chain, size_t num_items, size_t grain_size,
+    WorkFunc *func, void *user_data) {
+  if (num_items == 0) {
+    return;
+  }
+  grain_size = std::max(grain_size, (size_t)1);
+
+  int num_threads = (chain != nullptr) ? chain->get_num_threads() : 0;
+  size_t num_chunks = (num_items + grain_size - 1) / grain_size;
+  if (num_threads <= 0 || num_chunks <= 1 || !Thread::is_threading_supported()) {
+    // Not worth the trouble of handing the work off.
+    func(0, num_items, user_data);
+    return;
+  }
+
+  PT(Job) job = new Job(num_items, grain_size, func, user_data);
+
+  // There's no point in starting more helpers than there are chunks left
+  // over after the calling thread has taken its share.
+  size_t num_helpers = std::min((size_t)num_threads, num_chunks - 1);
+  AsyncTaskManager *task_mgr = AsyncTaskManager::get_global_ptr();
+  for (size_t i = 0; i < num_helpers; ++i) {
+    PT(Helper) helper = new Helper(job);
+    helper->set_task_chain(chain->get_name());
+    task_mgr->add(helper);
+  }
+
+  while (job->do_chunk()) {
+  }
+
+  // Some of the helpers may still be busy with their last chunk.  Helpers
+  // that haven't started yet will find nothing left to do; they hold their
+  // own reference to the job, so we don't need to wait for them.
+  job->wait_done();
+}
+
+/**
+ *
+ */
+AsyncParallelFor::Job::
+Job(size_t num_items, size_t grain_size, WorkFunc *func, void *user_data) :
+  _num_items(num_items),
+  _grain_size(grain_size),
+  _func(func),
+  _user_data(user_data),
+  _next_item(0),
+  _num_done(0),
+  _cvar(_lock)
+{
+}
+
+/**
+ * Claims the next chunk of items and processes it.  Returns true if a chunk
+ * was processed, or false if there was no work left to claim.
+ */
+bool AsyncParallelFor::Job::
+do_chunk() {
+  size_t begin = (size_t)AtomicAdjust::add(_next_item, (AtomicAdjust::Integer)_grain_size);
+  begin -= _grain_size;
+  if (begin >= _num_items) {
+    return false;
+  }
+  size_t end = std::min(begin + _grain_size, _num_items);
+  _func(begin, end, _user_data);
+
+  size_t num_done =
+    (size_t)AtomicAdjust::add(_num_done, (AtomicAdjust::Integer)(end - begin));
+  if (num_done == _num_items) {
+    MutexHolder holder(_lock);
+    _cvar.notify_all();
+  }
+  return true;
+}
+
+/**
+ * Blocks until every item of the job has been processed.
+ */
+void AsyncParallelFor::Job::
+wait_done() {
+  MutexHolder holder(_lock);
+  while ((size_t)AtomicAdjust::get(_num_done) < _num_items) {
+    _cvar.wait();
+  }
+}
+
+/**
+ *
+ */
+AsyncParallelFor::Helper::
+Helper(Job *job) :
+  AsyncTask("AsyncParallelFor"),
+  _job(job)
+{
+}
+
+/**
+ * Processes chunks of the job until there are none left.
+ */
+AsyncTask::DoneStatus AsyncParallelFor::Helper::
+do_task() {
+  while (_job->do_chunk()) {
+  }
+
+  // Let go of the job now, rather than whenever the task manager gets
+  // around to destructing this task.
+  _job.clear();
+  return DS_done;
+}
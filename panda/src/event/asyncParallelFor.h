@@ -0,0 +1,106 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file asyncParallelFor.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef ASYNCPARALLELFOR_H
+#define ASYNCPARALLELFOR_H
+
+#include "pandabase.h"
+
+#include "asyncTask.h"
+#include "asyncTaskChain.h"
+#include "referenceCount.h"
+#include "pmutex.h"
+#include "conditionVar.h"
+#include "atomicAdjust.h"
+
+/**
+ * Splits a loop over a range of independent work items into chunks, and
+ * processes the chunks on the threads of an AsyncTaskChain.  The calling
+ * thread takes part in the work as well, and run() does not return until
+ * every item has been processed.
+ *
+ * Because the caller helps out, the loop always makes progress, even if the
+ * task chain has no threads, the threads are all busy, or run() is itself
+ * called from one of the chain's threads.  If threading is not compiled in,
+ * the whole range is simply processed on the calling thread.
+ *
+ * The work function is called with a half-open range [begin, end) of item
+ * indices, and must be safe to call from several threads at once for
+ * disjoint ranges.
+ */
+class EXPCL_PANDA_EVENT AsyncParallelFor {
+public:
+  typedef void WorkFunc(size_t begin, size_t end, void *user_data);
+
+  static AsyncTaskChain *get_task_chain(const std::string &chain_name,
+                                        int num_threads);
+
+  static void run(AsyncTaskChain *chain, size_t num_items, size_t grain_size,
+                  WorkFunc *func, void *user_data);
+
+private:
+  class Job : public ReferenceCount {
+  public:
+    Job(size_t num_items, size_t grain_size, WorkFunc *func, void *user_data);
+
+    bool do_chunk();
+    void wait_done();
+
+    size_t _num_items;
+    size_t _grain_size;
+    WorkFunc *_func;
+    void *_user_data;
+
+    AtomicAdjust::Integer _next_item;
+    AtomicAdjust::Integer _num_done;
+
+    Mutex _lock;
+    ConditionVar _cvar;
+  };
+
+public:
+  /**
+   * The task that is added to the task chain to help out with a Job.  It
+   * keeps processing chunks until there are none left.
+   */
+  class EXPCL_PANDA_EVENT Helper : public AsyncTask {
+  public:
+    Helper(Job *job);
+    ALLOC_DELETED_CHAIN(Helper);
+
+  protected:
+    virtual DoneStatus do_task();
+
+  private:
+    PT(Job) _job;
+
+  public:
+    static TypeHandle get_class_type() {
+      return _type_handle;
+    }
+    static void init_type() {
+      AsyncTask::init_type();
+      register_type(_type_handle, "AsyncParallelFor::Helper",
+                    AsyncTask::get_class_type());
+    }
+    virtual TypeHandle get_type() const {
+      return get_class_type();
+    }
+    virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+  private:
+    static TypeHandle _type_handle;
+  };
+};
+
+#endif
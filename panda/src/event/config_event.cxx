@@ -13,6 +13,7 @@
 
 #include "config_event.h"
 #include "asyncFuture.h"
+#include "asyncParallelFor.h"
 #include "asyncTask.h"
 #include "asyncTaskChain.h"
 #include "asyncTaskManager.h"
@@ -38,6 +39,7 @@ NotifyCategoryDef(task, "");
 ConfigureFn(config_event) {
   AsyncFuture::init_type();
   AsyncGatheringFuture::init_type();
+  AsyncParallelFor::Helper::init_type();
   AsyncTask::init_type();
   AsyncTaskChain::init_type();
   AsyncTaskManager::init_type();
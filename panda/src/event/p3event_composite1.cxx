@@ -1,4 +1,5 @@
 #include "asyncFuture.cxx"
+#include "asyncParallelFor.cxx"
 #include "asyncTask.cxx"
 #include "asyncTaskChain.cxx"
 #include "asyncTaskCollection.cxx"
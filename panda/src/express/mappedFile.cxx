@@ -0,0 +1,147 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file mappedFile.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "mappedFile.h"
+#include "config_express.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/**
+ *
+ */
+MappedFile::
+MappedFile() :
+  _data(nullptr),
+  _size(0)
+{
+}
+
+/**
+ *
+ */
+MappedFile::
+~MappedFile() {
+  close();
+}
+
+/**
+ * Maps the entire contents of the indicated file, which must be a regular
+ * file on disk (not a file within the virtual file system).  Returns true on
+ * success, false on failure.  An empty file cannot be mapped.
+ */
+bool MappedFile::
+open(const Filename &filename) {
+  close();
+  _filename = filename;
+
+#ifdef _WIN32
+  std::wstring os_filename = filename.to_os_specific_w();
+  HANDLE file = CreateFileW(os_filename.c_str(), GENERIC_READ,
+                            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                            FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    express_cat.error()
+      << "Unable to open " << filename << " for mapping.\n";
+    return false;
+  }
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 ||
+      (ULONGLONG)size.QuadPart != (size_t)size.QuadPart) {
+    CloseHandle(file);
+    return false;
+  }
+
+  // The view keeps the file open, so we don't need to hold on to either
+  // handle.
+  HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(file);
+  if (mapping == nullptr) {
+    express_cat.error()
+      << "Unable to map " << filename << ".\n";
+    return false;
+  }
+
+  void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mapping);
+  if (data == nullptr) {
+    express_cat.error()
+      << "Unable to map " << filename << ".\n";
+    return false;
+  }
+
+  _size = (size_t)size.QuadPart;
+
+#else
+  std::string os_filename = filename.to_os_specific();
+  int fd = ::open(os_filename.c_str(), O_RDONLY);
+  if (fd == -1) {
+    express_cat.error()
+      << "Unable to open " << filename << " for mapping.\n";
+    return false;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+      (off_t)(size_t)st.st_size != st.st_size) {
+    ::close(fd);
+    return false;
+  }
+
+  // The mapping keeps the file open, so we don't need the descriptor.
+  void *data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {
+    express_cat.error()
+      << "Unable to map " << filename << ".\n";
+    return false;
+  }
+
+  _size = (size_t)st.st_size;
+#endif
+
+  _data = (const unsigned char *)data;
+
+  if (express_cat.is_debug()) {
+    express_cat.debug()
+      << "Mapped " << _size << " bytes of " << filename << "\n";
+  }
+  return true;
+}
+
+/**
+ * Unmaps the file.  Any pointers into the mapped memory are no longer valid
+ * after this call.
+ */
+void MappedFile::
+close() {
+  if (_data != nullptr) {
+#ifdef _WIN32
+    UnmapViewOfFile((void *)_data);
+#else
+    munmap((void *)_data, _size);
+#endif
+    _data = nullptr;
+    _size = 0;
+  }
+}
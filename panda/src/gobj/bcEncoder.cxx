@@ -0,0 +1,793 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file bcEncoder.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "bcEncoder.h"
+#include "cmath.h"
+
+#include <limits.h>
+
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+#define BCENCODER_SSE2
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
+
+using std::max;
+using std::min;
+
+#ifdef BCENCODER_SSE2
+/**
+ * Splits the red, green and blue channels of the block into two vectors each
+ * of eight 16-bit values, with the pixels whose bit is set in the transparent
+ * mask set to zero.  Also returns a mask of the remaining pixels, in the same
+ * layout.
+ */
+static INLINE void
+load_channels(__m128i chan[3][2], __m128i opaque[2],
+              const unsigned char block[16][4], unsigned int transparent) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+  __m128i byte_mask = _mm_set1_epi32(0xff);
+
+  for (int h = 0; h < 2; ++h) {
+    __m128i m0 = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(transparent >> (h * 8)), bits), zero);
+    __m128i m1 = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(transparent >> (h * 8 + 4)), bits), zero);
+    __m128i p0 = _mm_and_si128(_mm_loadu_si128((const __m128i *)block[h * 8]), m0);
+    __m128i p1 = _mm_and_si128(_mm_loadu_si128((const __m128i *)block[h * 8 + 4]), m1);
+
+    chan[0][h] = _mm_packs_epi32(_mm_and_si128(p0, byte_mask),
+                                 _mm_and_si128(p1, byte_mask));
+    chan[1][h] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 8), byte_mask),
+                                 _mm_and_si128(_mm_srli_epi32(p1, 8), byte_mask));
+    chan[2][h] = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(p0, 16), byte_mask),
+                                 _mm_and_si128(_mm_srli_epi32(p1, 16), byte_mask));
+    opaque[h] = _mm_packs_epi32(m0, m1);
+  }
+}
+
+/**
+ * Returns the sum of the four 32-bit values.
+ */
+static INLINE int
+hsum_epi32(__m128i v) {
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(v);
+}
+
+/**
+ * Returns the smallest of the eight 16-bit values.
+ */
+static INLINE int
+hmin_epi16(__m128i v) {
+  v = _mm_min_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_min_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  v = _mm_min_epi16(v, _mm_srli_epi32(v, 16));
+  return (short)_mm_cvtsi128_si32(v);
+}
+
+/**
+ * Returns the largest of the eight 16-bit values.
+ */
+static INLINE int
+hmax_epi16(__m128i v) {
+  v = _mm_max_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+  v = _mm_max_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+  v = _mm_max_epi16(v, _mm_srli_epi32(v, 16));
+  return (short)_mm_cvtsi128_si32(v);
+}
+#endif  // BCENCODER_SSE2
+
+/**
+ * Prepares to encode blocks in the indicated compression mode, from images
+ * with the indicated number of components.  Check is_valid() afterwards to
+ * see whether the combination is supported.
+ */
+BCEncoder::
+BCEncoder(Texture::CompressionMode compression, int num_components,
+          Texture::QualityLevel quality_level) :
+  _compression(compression),
+  _num_components(num_components),
+  _quality_level(quality_level),
+  _block_size(0)
+{
+  if (_quality_level == Texture::QL_default) {
+    _quality_level = Texture::QL_normal;
+  }
+
+  switch (compression) {
+  case Texture::CM_dxt1:
+    if (num_components >= 1 && num_components <= 4) {
+      _block_size = 8;
+    }
+    break;
+
+  case Texture::CM_dxt3:
+  case Texture::CM_dxt5:
+    if (num_components >= 1 && num_components <= 4) {
+      _block_size = 16;
+    }
+    break;
+
+  case Texture::CM_rgtc:
+    if (num_components == 1) {
+      _block_size = 8;
+    } else if (num_components == 2) {
+      _block_size = 16;
+    }
+    break;
+
+  default:
+    break;
+  }
+}
+
+/**
+ * Encodes the rows of blocks in the range [begin_row, end_row) of one page
+ * of an image.  Each row of blocks covers four rows of pixels.  The src
+ * pointer points to the start of the uncompressed page, in the usual Panda
+ * component order, and dest to the start of the compressed page.
+ */
+void BCEncoder::
+encode_rows(unsigned char *dest, const unsigned char *src,
+            int x_size, int y_size, int begin_row, int end_row) const {
+  nassertv(is_valid());
+
+  int x_blocks = (x_size + 3) >> 2;
+  Block block;
+
+  for (int by = begin_row; by < end_row; ++by) {
+    unsigned char *d = dest + (size_t)by * x_blocks * _block_size;
+
+    for (int bx = 0; bx < x_blocks; ++bx) {
+      load_block(block, src, x_size, y_size, bx << 2, by << 2);
+
+      switch (_compression) {
+      case Texture::CM_dxt1:
+        encode_color_block(d, block, true);
+        break;
+
+      case Texture::CM_dxt3:
+        encode_explicit_alpha_block(d, block);
+        encode_color_block(d + 8, block, false);
+        break;
+
+      case Texture::CM_dxt5:
+        encode_alpha_block(d, block, 3);
+        encode_color_block(d + 8, block, false);
+        break;
+
+      case Texture::CM_rgtc:
+        encode_alpha_block(d, block, 0);
+        if (_num_components == 2) {
+          encode_alpha_block(d + 8, block, 1);
+        }
+        break;
+
+      default:
+        break;
+      }
+
+      d += _block_size;
+    }
+  }
+}
+
+/**
+ * Copies the 4x4 block of pixels starting at the indicated pixel into the
+ * indicated block, as RGBA.  Pixels past the right or bottom edge of the
+ * image are filled in by repeating the last column or row.
+ */
+void BCEncoder::
+load_block(Block block, const unsigned char *src,
+           int x_size, int y_size, int x, int y) const {
+  for (int i = 0; i < 16; ++i) {
+    int xi = min(x + (i & 3), x_size - 1);
+    int yi = min(y + (i >> 2), y_size - 1);
+    const unsigned char *s = src + ((size_t)yi * x_size + xi) * _num_components;
+    unsigned char *t = block[i];
+
+    if (_compression == Texture::CM_rgtc) {
+      // These are stored as they are, red first.
+      t[0] = s[0];
+      t[1] = (_num_components == 2) ? s[1] : 0;
+      t[2] = 0;
+      t[3] = 255;
+      continue;
+    }
+
+    switch (_num_components) {
+    case 1:
+      t[0] = s[0];   // r
+      t[1] = s[0];   // g
+      t[2] = s[0];   // b
+      t[3] = 255;    // a
+      break;
+
+    case 2:
+      t[0] = s[0];   // r
+      t[1] = s[0];   // g
+      t[2] = s[0];   // b
+      t[3] = s[1];   // a
+      break;
+
+    case 3:
+      t[0] = s[2];   // r
+      t[1] = s[1];   // g
+      t[2] = s[0];   // b
+      t[3] = 255;    // a
+      break;
+
+    case 4:
+      t[0] = s[2];   // r
+      t[1] = s[1];   // g
+      t[2] = s[0];   // b
+      t[3] = s[3];   // a
+      break;
+    }
+  }
+}
+
+/**
+ * Encodes the RGB of the block as an 8-byte BC1 color block.  If allow_alpha
+ * is true, pixels whose alpha is below 128 are encoded as transparent, using
+ * the three-color mode of BC1.
+ *
+ * The endpoints are first estimated, according to the quality level, either
+ * from the bounding box of the colors or from their principal axis.  At the
+ * higher quality levels, they are then refined by a least-squares fit to the
+ * chosen indices, for as long as that reduces the error.  Only the power
+ * iteration on the 3x3 covariance matrix is always scalar; the per-pixel work
+ * uses SSE2 where available, with the same results as without.
+ */
+void BCEncoder::
+encode_color_block(unsigned char *dest, const Block block,
+                   bool allow_alpha) const {
+  unsigned int transparent = 0;
+  if (allow_alpha && (_num_components == 2 || _num_components == 4)) {
+    for (int i = 0; i < 16; ++i) {
+      if (block[i][3] < 128) {
+        transparent |= (1 << i);
+      }
+    }
+  }
+
+  if (transparent == 0xffff) {
+    // Equal endpoints select the three-color mode, in which index 3 is
+    // transparent black.
+    memset(dest, 0, 4);
+    memset(dest + 4, 0xff, 4);
+    return;
+  }
+  int num_colors = (transparent != 0) ? 3 : 4;
+
+  // Gather the statistics of the pixels that are to be encoded.
+  int sums[3], products[6], minc[3], maxc[3];
+  int num_pixels = get_color_stats(sums, products, minc, maxc, block, transparent);
+
+  float mean[3];
+  for (int c = 0; c < 3; ++c) {
+    mean[c] = (float)sums[c] / num_pixels;
+  }
+
+  // The covariance matrix, as rr, rg, rb, gg, gb, bb.
+  static const int product_channels[6][2] = {
+    {0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2},
+  };
+  float cov[6];
+  for (int k = 0; k < 6; ++k) {
+    cov[k] = products[k] - sums[product_channels[k][0]] * mean[product_channels[k][1]];
+  }
+
+  float end0[3], end1[3];
+  if (_quality_level == Texture::QL_fastest) {
+    // Use the corners of the bounding box, inset a little, picking the
+    // diagonal that follows the sign of the covariance.
+    for (int c = 0; c < 3; ++c) {
+      float inset = (maxc[c] - minc[c]) / 16.0f;
+      end0[c] = maxc[c] - inset;
+      end1[c] = minc[c] + inset;
+    }
+    if (cov[1] < 0.0f) {
+      std::swap(end0[1], end1[1]);
+    }
+    if (cov[2] < 0.0f) {
+      std::swap(end0[2], end1[2]);
+    }
+
+  } else {
+    // Find the principal axis by power iteration, starting from the axis
+    // with the greatest variance.
+    float axis[3] = {cov[0], cov[1], cov[2]};
+    if (cov[3] > cov[0] && cov[3] >= cov[5]) {
+      axis[0] = cov[1];
+      axis[1] = cov[3];
+      axis[2] = cov[4];
+    } else if (cov[5] > cov[0]) {
+      axis[0] = cov[2];
+      axis[1] = cov[4];
+      axis[2] = cov[5];
+    }
+    for (int iter = 0; iter < 8; ++iter) {
+      float x = axis[0] * cov[0] + axis[1] * cov[1] + axis[2] * cov[2];
+      float y = axis[0] * cov[1] + axis[1] * cov[3] + axis[2] * cov[4];
+      float z = axis[0] * cov[2] + axis[1] * cov[4] + axis[2] * cov[5];
+      float m = max(cabs(x), max(cabs(y), cabs(z)));
+      if (m <= 0.0f) {
+        break;
+      }
+      axis[0] = x / m;
+      axis[1] = y / m;
+      axis[2] = z / m;
+    }
+
+    float length2 = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+    float tmin = 0.0f, tmax = 0.0f;
+    if (length2 > 0.0f) {
+      get_axis_range(tmin, tmax, block, transparent, mean, axis, length2);
+    }
+    for (int c = 0; c < 3; ++c) {
+      end0[c] = max(0.0f, min(255.0f, mean[c] + axis[c] * tmax));
+      end1[c] = max(0.0f, min(255.0f, mean[c] + axis[c] * tmin));
+    }
+  }
+
+  int max_iterations = 1;
+  if (_quality_level == Texture::QL_normal) {
+    max_iterations = 2;
+  } else if (_quality_level == Texture::QL_best) {
+    max_iterations = 8;
+  }
+
+  int best_error = INT_MAX;
+  unsigned int best_color0 = 0, best_color1 = 0;
+  unsigned int best_indices[16];
+  memset(best_indices, 0, sizeof(best_indices));
+
+  for (int iter = 0; iter < max_iterations; ++iter) {
+    // Round the endpoints to 5:6:5.
+    unsigned int color0 =
+      ((unsigned int)(end0[0] * (31.0f / 255.0f) + 0.5f) << 11) |
+      ((unsigned int)(end0[1] * (63.0f / 255.0f) + 0.5f) << 5) |
+      (unsigned int)(end0[2] * (31.0f / 255.0f) + 0.5f);
+    unsigned int color1 =
+      ((unsigned int)(end1[0] * (31.0f / 255.0f) + 0.5f) << 11) |
+      ((unsigned int)(end1[1] * (63.0f / 255.0f) + 0.5f) << 5) |
+      (unsigned int)(end1[2] * (31.0f / 255.0f) + 0.5f);
+
+    // The order of the endpoints selects the mode: color0 > color1 for four
+    // colors, color0 <= color1 for three colors and transparency.
+    if ((num_colors == 4) ? (color0 < color1) : (color0 > color1)) {
+      std::swap(color0, color1);
+    }
+
+    int palette[4][3];
+    palette[0][0] = ((color0 >> 8) & 0xf8) | (color0 >> 13);
+    palette[0][1] = ((color0 >> 3) & 0xfc) | ((color0 >> 9) & 0x3);
+    palette[0][2] = ((color0 << 3) & 0xf8) | ((color0 >> 2) & 0x7);
+    palette[1][0] = ((color1 >> 8) & 0xf8) | (color1 >> 13);
+    palette[1][1] = ((color1 >> 3) & 0xfc) | ((color1 >> 9) & 0x3);
+    palette[1][2] = ((color1 << 3) & 0xf8) | ((color1 >> 2) & 0x7);
+    for (int c = 0; c < 3; ++c) {
+      if (num_colors == 4) {
+        palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+        palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+      } else {
+        palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+        palette[3][c] = 0;
+      }
+    }
+
+    unsigned int indices[16];
+    int error;
+    if (color0 == color1 && num_colors == 4) {
+      // Equal endpoints would be decoded in the three-color mode, so only
+      // index 0 may be used.
+      error = get_color_error(indices, block, palette, 1, 0);
+    } else {
+      error = get_color_error(indices, block, palette, num_colors, transparent);
+    }
+
+    if (error >= best_error) {
+      break;
+    }
+    best_error = error;
+    best_color0 = color0;
+    best_color1 = color1;
+    memcpy(best_indices, indices, sizeof(indices));
+
+    if (error == 0 || iter + 1 == max_iterations ||
+        !fit_endpoints(end0, end1, block, indices, num_colors, transparent)) {
+      break;
+    }
+  }
+
+  unsigned int bits = 0;
+  for (int i = 0; i < 16; ++i) {
+    bits |= best_indices[i] << (i * 2);
+  }
+
+  dest[0] = best_color0 & 0xff;
+  dest[1] = best_color0 >> 8;
+  dest[2] = best_color1 & 0xff;
+  dest[3] = best_color1 >> 8;
+  dest[4] = bits & 0xff;
+  dest[5] = (bits >> 8) & 0xff;
+  dest[6] = (bits >> 16) & 0xff;
+  dest[7] = bits >> 24;
+}
+
+/**
+ * Encodes one channel of the block as an 8-byte BC4 block, which is also the
+ * alpha block of BC3.  The endpoints are the minimum and maximum value in the
+ * block.
+ */
+void BCEncoder::
+encode_alpha_block(unsigned char *dest, const Block block, int channel) {
+  static const int remap[] = {1, 7, 6, 5, 4, 3, 2, 0};
+
+  // NB. This algorithm isn't fully optimal, since it doesn't try to make use
+  // of the secondary interpolation mode supported by BC4.  This is not
+  // important for most textures, but it may be added in the future.
+
+  // Find the minimum and maximum value in the block.
+  unsigned char minv = block[0][channel];
+  unsigned char maxv = block[0][channel];
+  for (int i = 1; i < 16; ++i) {
+    minv = min(block[i][channel], minv);
+    maxv = max(block[i][channel], maxv);
+  }
+
+  // Now calculate the index for each pixel.
+  float fac, add;
+  if (maxv > minv) {
+    fac = 7.5f / (maxv - minv);
+  } else {
+    fac = 0;
+  }
+  add = -minv * fac;
+
+  int idx[16];
+  for (int i = 0; i < 16; ++i) {
+    idx[i] = remap[(int)(block[i][channel] * fac + add)];
+  }
+  int a = idx[0] | (idx[1] << 3) | (idx[2] << 6) | (idx[3] << 9);
+  int b = (idx[4] << 4) | (idx[5] << 7) | (idx[6] << 10) | (idx[7] << 13);
+  int c = idx[8] | (idx[9] << 3) | (idx[10] << 6) | (idx[11] << 9);
+  int d = (idx[12] << 4) | (idx[13] << 7) | (idx[14] << 10) | (idx[15] << 13);
+
+  dest[0] = maxv;
+  dest[1] = minv;
+  dest[2] = a & 0xff;
+  dest[3] = (a >> 8) | (b & 0xf0);
+  dest[4] = b >> 8;
+  dest[5] = c & 0xff;
+  dest[6] = (c >> 8) | (d & 0xf0);
+  dest[7] = d >> 8;
+}
+
+/**
+ * Encodes the alpha channel of the block as the 8-byte explicit alpha block
+ * of BC2, with four bits per pixel.
+ */
+void BCEncoder::
+encode_explicit_alpha_block(unsigned char *dest, const Block block) {
+  for (int i = 0; i < 16; i += 2) {
+    unsigned int lo = (block[i][3] * 15 + 127) / 255;
+    unsigned int hi = (block[i + 1][3] * 15 + 127) / 255;
+    dest[i >> 1] = (unsigned char)(lo | (hi << 4));
+  }
+}
+
+/**
+ * Chooses the closest of the first num_colors palette entries for each of
+ * the pixels of the block, and returns the total squared error.  Pixels whose
+ * bit is set in the transparent mask are given index 3 instead, and do not
+ * count towards the error.
+ */
+int BCEncoder::
+get_color_error(unsigned int indices[16], const Block block,
+                const int palette[4][3], int num_colors,
+                unsigned int transparent) {
+#ifdef BCENCODER_SSE2
+  if (num_colors == 4 && transparent == 0) {
+    // Measure four pixels against all four palette entries at once.  The
+    // distances are whole numbers well within the precision of a float, so
+    // this chooses exactly the same indices as the loop below.
+    __m128 total = _mm_setzero_ps();
+    for (int i = 0; i < 16; i += 4) {
+      __m128 r = _mm_setr_ps(block[i][0], block[i + 1][0], block[i + 2][0], block[i + 3][0]);
+      __m128 g = _mm_setr_ps(block[i][1], block[i + 1][1], block[i + 2][1], block[i + 3][1]);
+      __m128 b = _mm_setr_ps(block[i][2], block[i + 1][2], block[i + 2][2], block[i + 3][2]);
+
+      __m128 best_dist = _mm_set1_ps(1e30f);
+      __m128i best_index = _mm_setzero_si128();
+      for (int k = 0; k < 4; ++k) {
+        __m128 dr = _mm_sub_ps(r, _mm_set1_ps((float)palette[k][0]));
+        __m128 dg = _mm_sub_ps(g, _mm_set1_ps((float)palette[k][1]));
+        __m128 db = _mm_sub_ps(b, _mm_set1_ps((float)palette[k][2]));
+        __m128 dist = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dr, dr), _mm_mul_ps(dg, dg)),
+                                 _mm_mul_ps(db, db));
+        __m128 closer = _mm_cmplt_ps(dist, best_dist);
+        best_dist = _mm_min_ps(dist, best_dist);
+        best_index = _mm_or_si128(_mm_andnot_si128(_mm_castps_si128(closer), best_index),
+                                  _mm_and_si128(_mm_castps_si128(closer), _mm_set1_epi32(k)));
+      }
+      total = _mm_add_ps(total, best_dist);
+
+      int index[4];
+      _mm_storeu_si128((__m128i *)index, best_index);
+      indices[i] = index[0];
+      indices[i + 1] = index[1];
+      indices[i + 2] = index[2];
+      indices[i + 3] = index[3];
+    }
+
+    float sum[4];
+    _mm_storeu_ps(sum, total);
+    return (int)(sum[0] + sum[1] + sum[2] + sum[3]);
+  }
+#endif  // BCENCODER_SSE2
+
+  int error = 0;
+  for (int i = 0; i < 16; ++i) {
+    if (transparent & (1 << i)) {
+      indices[i] = 3;
+      continue;
+    }
+
+    int best_dist = INT_MAX;
+    unsigned int best_index = 0;
+    for (int k = 0; k < num_colors; ++k) {
+      int dr = block[i][0] - palette[k][0];
+      int dg = block[i][1] - palette[k][1];
+      int db = block[i][2] - palette[k][2];
+      int dist = dr * dr + dg * dg + db * db;
+      if (dist < best_dist) {
+        best_dist = dist;
+        best_index = k;
+      }
+    }
+    indices[i] = best_index;
+    error += best_dist;
+  }
+  return error;
+}
+
+/**
+ * Returns the number of pixels of the block whose bit is not set in the
+ * transparent mask, and fills in the sum of each channel over those pixels,
+ * the sum of each product of two channels (rr, rg, rb, gg, gb, bb), and the
+ * bounds of each channel.  These are all whole numbers, so the SSE2 path
+ * gives exactly the same results as the loop below.
+ */
+int BCEncoder::
+get_color_stats(int sums[3], int products[6], int minc[3], int maxc[3],
+                const Block block, unsigned int transparent) {
+#ifdef BCENCODER_SSE2
+  __m128i chan[3][2], opaque[2];
+  load_channels(chan, opaque, block, transparent);
+
+  __m128i ones = _mm_set1_epi16(1);
+  __m128i white = _mm_set1_epi16(255);
+  for (int c = 0; c < 3; ++c) {
+    sums[c] = hsum_epi32(_mm_madd_epi16(_mm_add_epi16(chan[c][0], chan[c][1]), ones));
+
+    // The transparent pixels are zero, which is harmless for the maximum,
+    // but they must be made white for the minimum.
+    maxc[c] = hmax_epi16(_mm_max_epi16(chan[c][0], chan[c][1]));
+    minc[c] = hmin_epi16(_mm_min_epi16(
+      _mm_or_si128(chan[c][0], _mm_andnot_si128(opaque[0], white)),
+      _mm_or_si128(chan[c][1], _mm_andnot_si128(opaque[1], white))));
+  }
+
+  static const int product_channels[6][2] = {
+    {0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2},
+  };
+  for (int k = 0; k < 6; ++k) {
+    const __m128i *a = chan[product_channels[k][0]];
+    const __m128i *b = chan[product_channels[k][1]];
+    products[k] = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(a[0], b[0]),
+                                           _mm_madd_epi16(a[1], b[1])));
+  }
+
+  int num_pixels = 0;
+  for (int i = 0; i < 16; ++i) {
+    if ((transparent & (1 << i)) == 0) {
+      ++num_pixels;
+    }
+  }
+  return num_pixels;
+
+#else  // BCENCODER_SSE2
+  int num_pixels = 0;
+  for (int c = 0; c < 3; ++c) {
+    sums[c] = 0;
+    minc[c] = 255;
+    maxc[c] = 0;
+  }
+  for (int k = 0; k < 6; ++k) {
+    products[k] = 0;
+  }
+
+  for (int i = 0; i < 16; ++i) {
+    if ((transparent & (1 << i)) == 0) {
+      int r = block[i][0];
+      int g = block[i][1];
+      int b = block[i][2];
+      sums[0] += r;
+      sums[1] += g;
+      sums[2] += b;
+      products[0] += r * r;
+      products[1] += r * g;
+      products[2] += r * b;
+      products[3] += g * g;
+      products[4] += g * b;
+      products[5] += b * b;
+      for (int c = 0; c < 3; ++c) {
+        minc[c] = min(minc[c], (int)block[i][c]);
+        maxc[c] = max(maxc[c], (int)block[i][c]);
+      }
+      ++num_pixels;
+    }
+  }
+  return num_pixels;
+#endif  // BCENCODER_SSE2
+}
+
+/**
+ * Projects the pixels of the block whose bit is not set in the transparent
+ * mask onto the indicated axis through the mean, and extends [tmin, tmax] to
+ * cover the results.  The axis is given unnormalized, with its squared
+ * length.
+ */
+void BCEncoder::
+get_axis_range(float &tmin, float &tmax, const Block block,
+               unsigned int transparent, const float mean[3],
+               const float axis[3], float length2) {
+#ifdef BCENCODER_SSE2
+  // This does the same operations in the same order as the loop below, so
+  // the results are the same.  Transparent pixels are projected to zero,
+  // which doesn't change the range, since it always includes zero.
+  __m128i chan[3][2], opaque[2];
+  load_channels(chan, opaque, block, transparent);
+
+  __m128i zero = _mm_setzero_si128();
+  __m128 vmin = _mm_set1_ps(tmin);
+  __m128 vmax = _mm_set1_ps(tmax);
+  for (int h = 0; h < 2; ++h) {
+    for (int half = 0; half < 2; ++half) {
+      __m128 t = _mm_setzero_ps();
+      for (int c = 0; c < 3; ++c) {
+        __m128i wide = half ? _mm_unpackhi_epi16(chan[c][h], zero)
+                            : _mm_unpacklo_epi16(chan[c][h], zero);
+        __m128 d = _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(wide), _mm_set1_ps(mean[c])),
+                              _mm_set1_ps(axis[c]));
+        t = (c == 0) ? d : _mm_add_ps(t, d);
+      }
+      t = _mm_div_ps(t, _mm_set1_ps(length2));
+
+      __m128i mask = half ? _mm_unpackhi_epi16(opaque[h], opaque[h])
+                          : _mm_unpacklo_epi16(opaque[h], opaque[h]);
+      t = _mm_and_ps(t, _mm_castsi128_ps(mask));
+      vmin = _mm_min_ps(vmin, t);
+      vmax = _mm_max_ps(vmax, t);
+    }
+  }
+
+  float lo[4], hi[4];
+  _mm_storeu_ps(lo, vmin);
+  _mm_storeu_ps(hi, vmax);
+  tmin = min(min(lo[0], lo[1]), min(lo[2], lo[3]));
+  tmax = max(max(hi[0], hi[1]), max(hi[2], hi[3]));
+
+#else  // BCENCODER_SSE2
+  for (int i = 0; i < 16; ++i) {
+    if ((transparent & (1 << i)) == 0) {
+      float t = ((block[i][0] - mean[0]) * axis[0] +
+                 (block[i][1] - mean[1]) * axis[1] +
+                 (block[i][2] - mean[2]) * axis[2]) / length2;
+      tmin = min(tmin, t);
+      tmax = max(tmax, t);
+    }
+  }
+#endif  // BCENCODER_SSE2
+}
+
+/**
+ * Computes the endpoints that best reproduce the pixels of the block, in the
+ * least-squares sense, given the palette index chosen for each pixel.
+ * Returns false if the indices don't determine the endpoints, for instance
+ * because they are all the same.
+ *
+ * The weights of the endpoints are scaled to whole numbers, so that the sums
+ * are exact, and the SSE2 path gives the same endpoints as the loop below.
+ */
+bool BCEncoder::
+fit_endpoints(float end0[3], float end1[3], const Block block,
+              const unsigned int indices[16], int num_colors,
+              unsigned int transparent) {
+  // The weight of endpoint 0 in each of the palette entries, in thirds or in
+  // halves.
+  static const int weights4[4] = {3, 0, 2, 1};
+  static const int weights3[4] = {2, 0, 1, 0};
+  const int *weights = (num_colors == 4) ? weights4 : weights3;
+  int scale = (num_colors == 4) ? 3 : 2;
+
+  int aa, ab, bb;
+  int ax[3], bx[3];
+
+#ifdef BCENCODER_SSE2
+  short wa[16], wb[16];
+  for (int i = 0; i < 16; ++i) {
+    if (transparent & (1 << i)) {
+      wa[i] = 0;
+      wb[i] = 0;
+    } else {
+      wa[i] = (short)weights[indices[i]];
+      wb[i] = (short)(scale - weights[indices[i]]);
+    }
+  }
+
+  __m128i chan[3][2], opaque[2];
+  load_channels(chan, opaque, block, transparent);
+
+  __m128i a[2], b[2];
+  for (int h = 0; h < 2; ++h) {
+    a[h] = _mm_loadu_si128((const __m128i *)(wa + h * 8));
+    b[h] = _mm_loadu_si128((const __m128i *)(wb + h * 8));
+  }
+  aa = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(a[0], a[0]), _mm_madd_epi16(a[1], a[1])));
+  ab = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(a[0], b[0]), _mm_madd_epi16(a[1], b[1])));
+  bb = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(b[0], b[0]), _mm_madd_epi16(b[1], b[1])));
+  for (int c = 0; c < 3; ++c) {
+    ax[c] = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(a[0], chan[c][0]),
+                                     _mm_madd_epi16(a[1], chan[c][1])));
+    bx[c] = hsum_epi32(_mm_add_epi32(_mm_madd_epi16(b[0], chan[c][0]),
+                                     _mm_madd_epi16(b[1], chan[c][1])));
+  }
+
+#else  // BCENCODER_SSE2
+  aa = ab = bb = 0;
+  for (int c = 0; c < 3; ++c) {
+    ax[c] = 0;
+    bx[c] = 0;
+  }
+  for (int i = 0; i < 16; ++i) {
+    if (transparent & (1 << i)) {
+      continue;
+    }
+    int a = weights[indices[i]];
+    int b = scale - a;
+    aa += a * a;
+    ab += a * b;
+    bb += b * b;
+    for (int c = 0; c < 3; ++c) {
+      ax[c] += a * block[i][c];
+      bx[c] += b * block[i][c];
+    }
+  }
+#endif  // BCENCODER_SSE2
+
+  int det = aa * bb - ab * ab;
+  if (det == 0) {
+    return false;
+  }
+  float fac = (float)scale / det;
+
+  for (int c = 0; c < 3; ++c) {
+    end0[c] = max(0.0f, min(255.0f, (bb * ax[c] - ab * bx[c]) * fac));
+    end1[c] = max(0.0f, min(255.0f, (aa * bx[c] - ab * ax[c]) * fac));
+  }
+  return true;
+}
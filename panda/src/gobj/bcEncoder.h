@@ -0,0 +1,81 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file bcEncoder.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef BCENCODER_H
+#define BCENCODER_H
+
+#include "pandabase.h"
+
+#include "texture.h"
+
+/**
+ * Compresses 8-bit images into the S3TC/RGTC block formats, BC1 through BC5
+ * (CM_dxt1, CM_dxt3, CM_dxt5 and CM_rgtc), four rows of pixels at a time.
+ * This is used by Texture::compress_ram_image() to compress textures without
+ * the help of a graphics driver.
+ *
+ * The rows of blocks are independent of each other, so different rows of the
+ * same image may be encoded on different threads at once.
+ *
+ * Blocks that extend past the right or bottom edge of the image are padded
+ * by repeating the last column or row, not with black, so that the padding
+ * doesn't pull the endpoints of those blocks away from the real pixels.
+ */
+class EXPCL_PANDA_GOBJ BCEncoder {
+public:
+  BCEncoder(Texture::CompressionMode compression, int num_components,
+            Texture::QualityLevel quality_level);
+
+  INLINE bool is_valid() const;
+  INLINE size_t get_block_size() const;
+  INLINE size_t get_page_size(int x_size, int y_size) const;
+
+  void encode_rows(unsigned char *dest, const unsigned char *src,
+                   int x_size, int y_size, int begin_row, int end_row) const;
+
+private:
+  typedef unsigned char Block[16][4];
+
+  void load_block(Block block, const unsigned char *src,
+                  int x_size, int y_size, int x, int y) const;
+
+  void encode_color_block(unsigned char *dest, const Block block,
+                          bool allow_alpha) const;
+  static void encode_alpha_block(unsigned char *dest, const Block block,
+                                 int channel);
+  static void encode_explicit_alpha_block(unsigned char *dest,
+                                          const Block block);
+
+  static int get_color_error(unsigned int indices[16], const Block block,
+                             const int palette[4][3], int num_colors,
+                             unsigned int transparent);
+  static int get_color_stats(int sums[3], int products[6], int minc[3],
+                             int maxc[3], const Block block,
+                             unsigned int transparent);
+  static void get_axis_range(float &tmin, float &tmax, const Block block,
+                             unsigned int transparent, const float mean[3],
+                             const float axis[3], float length2);
+  static bool fit_endpoints(float end0[3], float end1[3], const Block block,
+                            const unsigned int indices[16], int num_colors,
+                            unsigned int transparent);
+
+private:
+  Texture::CompressionMode _compression;
+  int _num_components;
+  Texture::QualityLevel _quality_level;
+  size_t _block_size;
+};
+
+#include "bcEncoder.I"
+
+#endif
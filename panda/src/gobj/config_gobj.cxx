@@ -44,6 +44,7 @@
 #include "queryContext.h"
 #include "sliderTable.h"
 #include "texture.h"
+#include "textureLoadRequest.h"
 #include "texturePoolFilter.h"
 #include "textureReloadRequest.h"
 #include "textureStage.h"
@@ -128,10 +129,22 @@ ConfigVariableBool driver_compress_textures
           "or results by setting this true.  Setting it true may also "
           "allow you to take advantage of some exotic compression algorithm "
           "other than DXT1/3/5 that your graphics driver supports, but "
-          "which is unknown to Panda.  If the libsquish library is not "
-          "compiled into Panda, textures cannot be compressed in-memory, "
-          "and will always be handed to the graphics driver, regardless "
-          "of this setting."));
+          "which is unknown to Panda."));
+
+ConfigVariableInt texture_compress_num_threads
+("texture-compress-num-threads", 0,
+ PRC_DESC("The number of threads to use for compressing textures in-memory "
+          "into the DXT1/3/5 and RGTC formats.  The rows of each texture "
+          "image are divided among these threads.  The default of 0 means to "
+          "use one thread per CPU, less one for the thread that requested "
+          "the compression."));
+
+ConfigVariableInt texture_mipmap_num_threads
+("texture-mipmap-num-threads", 0,
+ PRC_DESC("The number of threads to use for generating mipmap images in "
+          "software.  The rows of each large mipmap level are divided among "
+          "these threads.  The default of 0 means to use one thread per CPU, "
+          "less one for the thread that requested the mipmaps."));
 
 ConfigVariableBool driver_generate_mipmaps
 ("driver-generate-mipmaps", true,
@@ -188,6 +201,15 @@ ConfigVariableBool hardware_animated_vertices
           "necessary on your computer's bus.  However, in some cases it "
           "may actually reduce performance."));
 
+ConfigVariableBool fast_animated_vertices
+("fast-animated-vertices", true,
+ PRC_DESC("When vertices are animated on the CPU, this enables a faster "
+          "code path for the common case of vertex data with 32-bit "
+          "floating-point columns and 16-bit transform blend indices, which "
+          "transforms the vertices with SSE2 instructions where available.  "
+          "Turn this off to use the general-purpose code path for all "
+          "vertex formats, e.g. to compare the performance of the two."));
+
 ConfigVariableBool hardware_point_sprites
 ("hardware-point-sprites", true,
  PRC_DESC("Set this true to allow the use of hardware extensions when "
@@ -590,6 +612,7 @@ ConfigureFn(config_gobj) {
   SliderTable::init_type();
   Texture::init_type();
   TextureContext::init_type();
+  TextureLoadRequest::init_type();
   TexturePoolFilter::init_type();
   TextureReloadRequest::init_type();
   TextureStage::init_type();
@@ -526,6 +526,25 @@ write_datagram(BamWriter *manager, Datagram &dg, void *extra_data) const {
   GeomVertexArrayData *array_data = (GeomVertexArrayData *)extra_data;
   dg.add_uint8(_usage_hint);
 
+  if (manager->get_file_minor_ver() >= 45) {
+    // Large arrays may be written in a separate block on a page boundary, so
+    // that they can be mapped directly from the file.
+    bool aligned = false;
+    if (manager->get_mappable_arrays()) {
+      if (manager->get_file_endian() == BamWriter::BE_native) {
+        aligned = manager->write_aligned_file_data(_buffer.get_read_pointer(true), _buffer.get_size());
+      } else {
+        pvector<unsigned char> new_data(_buffer.get_size());
+        array_data->reverse_data_endianness(new_data.data(), _buffer.get_read_pointer(true), _buffer.get_size());
+        aligned = manager->write_aligned_file_data(new_data.data(), new_data.size());
+      }
+    }
+    dg.add_bool(aligned);
+    if (aligned) {
+      return;
+    }
+  }
+
   dg.add_uint32(_buffer.get_size());
 
   if (manager->get_file_endian() == BamWriter::BE_native) {
@@ -557,16 +576,46 @@ fillin(DatagramIterator &scan, BamReader *manager, void *extra_data) {
     _buffer.set_size(new_data.size());
     memcpy(_buffer.get_write_pointer(), &new_data[0], new_data.size());
 
+  } else if (manager->get_file_minor_ver() >= 45 && scan.get_bool()) {
+    // The array data is stored in a separate, page-aligned block, which we
+    // may be able to map from the file rather than read.
+    SubfileInfo info;
+    manager->read_file_data(info);
+
+    const unsigned char *mapped_data = nullptr;
+    if (manager->get_map_arrays()) {
+      PT(MappedFile) mapped_file;
+      mapped_data = manager->map_file_data(info, mapped_file);
+      if (mapped_data != nullptr) {
+        _buffer.set_mapped_data(mapped_file, mapped_data, (size_t)info.get_size());
+      }
+    }
+    if (mapped_data == nullptr) {
+      _buffer.unclean_realloc((size_t)info.get_size());
+      _buffer.set_size((size_t)info.get_size());
+      if (!manager->copy_file_data(info, _buffer.get_write_pointer())) {
+        gobj_cat.error()
+          << "Unable to read vertex data from " << info << "\n";
+        _buffer.set_size(0);
+      }
+    }
+
   } else {
     // Now, the array data is just stored directly.
     size_t size = scan.get_uint32();
     _buffer.unclean_realloc(size);
     _buffer.set_size(size);
 
-    const unsigned char *source_data =
-      (const unsigned char *)scan.get_datagram().get_data();
-    memcpy(_buffer.get_write_pointer(), source_data + scan.get_current_index(), size);
-    scan.skip_bytes(size);
+    if (manager->get_file_endian() == BamReader::BE_native) {
+      // The copy may be put off until resolve(), since we don't look at the
+      // data again before then.
+      manager->extract_bytes(scan, _buffer.get_write_pointer(), size);
+    } else {
+      const unsigned char *source_data =
+        (const unsigned char *)scan.get_datagram().get_data();
+      memcpy(_buffer.get_write_pointer(), source_data + scan.get_current_index(), size);
+      scan.skip_bytes(size);
+    }
   }
 
   bool endian_reversed = false;
@@ -92,6 +92,8 @@ PUBLISHED:
   MAKE_PROPERTY(data_size_bytes, get_data_size_bytes);
   MAKE_PROPERTY(modified, get_modified);
 
+  INLINE bool is_mapped() const;
+
   void output(std::ostream &out) const;
   void write(std::ostream &out, int indent_level = 0) const;
 
@@ -21,6 +21,12 @@
 #include "bamWriter.h"
 #include "pset.h"
 #include "indent.h"
+#include "config_gobj.h"
+
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
 
 using std::ostream;
 
@@ -1596,10 +1602,50 @@ update_animated_vertices(GeomVertexData::CData *cdata, Thread *current_thread) {
         new GeomVertexArrayDataHandle(cdata->_arrays[blend_array_index].get_read_pointer(current_thread), current_thread);
       const unsigned short *blendt = (const unsigned short *)blend_array_handle->get_read_pointer(true);
 
+      // If the columns are packed floats, as they usually are, we can skin
+      // them a vertex at a time, looking up the matrix for each vertex in a
+      // table of precomputed blend matrices.  This saves us from having to
+      // break up the table into runs of vertices that share the same blend.
+      SkinMatrices blend_mats, vector_mats;
+      pvector<unsigned char> vector_normalize;
+      if (fast_animated_vertices) {
+        int num_blends = tb_table->get_num_blends();
+        blend_mats.reserve(num_blends);
+        for (int bi = 0; bi < num_blends; ++bi) {
+          LMatrix4 mat;
+          tb_table->get_blend(bi).get_blend(mat, current_thread);
+          blend_mats.push_back(LCAST(float, mat));
+        }
+      }
+
       size_t ci;
       for (ci = 0; ci < new_format->get_num_points(); ci++) {
         GeomVertexRewriter data(new_data, new_format->get_point(ci));
 
+        const GeomVertexColumn *data_column = data.get_column();
+        int num_values = data_column->get_num_values();
+        if (!blend_mats.empty() &&
+            (num_values == 3 || num_values == 4) &&
+            data_column->get_numeric_type() == NT_float32) {
+          size_t stride = data.get_stride();
+          unsigned char *datat = data.get_array_handle()->get_write_pointer();
+          datat += data_column->get_start();
+
+          for (int i = 0; i < num_subranges; ++i) {
+            int begin = rows.get_subrange_begin(i);
+            int end = rows.get_subrange_end(i);
+            nassertv(begin < end);
+            if (num_values == 3) {
+              table_skin_point3f(datat + begin * stride, end - begin, stride,
+                                 blendt + begin, &blend_mats[0]);
+            } else {
+              table_skin_vecbase4f(datat + begin * stride, end - begin, stride,
+                                   blendt + begin, &blend_mats[0]);
+            }
+          }
+          continue;
+        }
+
         for (int i = 0; i < num_subranges; ++i) {
           int begin = rows.get_subrange_begin(i);
           int end = rows.get_subrange_end(i);
@@ -1640,6 +1686,53 @@ update_animated_vertices(GeomVertexData::CData *cdata, Thread *current_thread) {
       for (ci = 0; ci < new_format->get_num_vectors(); ci++) {
         GeomVertexRewriter data(new_data, new_format->get_vector(ci));
 
+        const GeomVertexColumn *data_column = data.get_column();
+        int num_values = data_column->get_num_values();
+        bool is_normal = (data_column->get_contents() == C_normal);
+        if (!blend_mats.empty() &&
+            (num_values == 3 || (num_values == 4 && !is_normal)) &&
+            data_column->get_numeric_type() == NT_float32) {
+          const LMatrix4f *mats = &blend_mats[0];
+          const unsigned char *normalize = nullptr;
+          if (is_normal) {
+            // Normals need their own set of matrices, which we only have to
+            // compute once for all of the normal columns.
+            if (vector_mats.empty()) {
+              size_t num_blends = blend_mats.size();
+              vector_mats.reserve(num_blends);
+              vector_normalize.reserve(num_blends);
+              for (size_t bi = 0; bi < num_blends; ++bi) {
+                LMatrix4 mat, xform;
+                bool normalize_blend;
+                tb_table->get_blend(bi).get_blend(mat, current_thread);
+                get_vector_xform(mat, true, xform, normalize_blend);
+                vector_mats.push_back(LCAST(float, xform));
+                vector_normalize.push_back(normalize_blend);
+              }
+            }
+            mats = &vector_mats[0];
+            normalize = &vector_normalize[0];
+          }
+
+          size_t stride = data.get_stride();
+          unsigned char *datat = data.get_array_handle()->get_write_pointer();
+          datat += data_column->get_start();
+
+          for (int i = 0; i < num_subranges; ++i) {
+            int begin = rows.get_subrange_begin(i);
+            int end = rows.get_subrange_end(i);
+            nassertv(begin < end);
+            if (num_values == 3) {
+              table_skin_vector3f(datat + begin * stride, end - begin, stride,
+                                  blendt + begin, mats, normalize);
+            } else {
+              table_skin_vecbase4f(datat + begin * stride, end - begin, stride,
+                                   blendt + begin, mats);
+            }
+          }
+          continue;
+        }
+
         for (int i = 0; i < num_subranges; ++i) {
           int begin = rows.get_subrange_begin(i);
           int end = rows.get_subrange_end(i);
@@ -1827,35 +1920,9 @@ do_transform_vector_column(const GeomVertexFormat *format, GeomVertexRewriter &d
   int num_values = data_column->get_num_values();
 
   LMatrix4 xform;
-  bool normalize = false;
-  if (data_column->get_contents() == C_normal) {
-    // This is to preserve perpendicularity to the surface.
-    LVecBase3 scale_sq(mat.get_row3(0).length_squared(),
-                       mat.get_row3(1).length_squared(),
-                       mat.get_row3(2).length_squared());
-    if (IS_THRESHOLD_EQUAL(scale_sq[0], scale_sq[1], 2.0e-3f) &&
-        IS_THRESHOLD_EQUAL(scale_sq[0], scale_sq[2], 2.0e-3f)) {
-      // There is a uniform scale.
-      LVecBase3 scale, shear, hpr;
-      if (IS_THRESHOLD_EQUAL(scale_sq[0], 1, 2.0e-3f)) {
-        // No scale to worry about.
-        xform = mat;
-      } else if (decompose_matrix(mat.get_upper_3(), scale, shear, hpr)) {
-        // Make a new matrix with scale/translate taken out of the equation.
-        compose_matrix(xform, LVecBase3(1, 1, 1), shear, hpr, LVecBase3::zero());
-      } else {
-        normalize = true;
-      }
-    } else {
-      // There is a non-uniform scale, so we need to do all this to preserve
-      // orthogonality to the surface.
-      xform.invert_from(mat);
-      xform.transpose_in_place();
-      normalize = true;
-    }
-  } else {
-    xform = mat;
-  }
+  bool normalize;
+  get_vector_xform(mat, data_column->get_contents() == C_normal,
+                   xform, normalize);
 
   if ((num_values == 3 || num_values == 4) &&
       data_column->get_numeric_type() == NT_float32) {
@@ -1897,6 +1964,47 @@ do_transform_vector_column(const GeomVertexFormat *format, GeomVertexRewriter &d
   }
 }
 
+/**
+ * Computes the matrix with which to transform a column of vectors by the
+ * indicated matrix.  If is_normal is true, the vectors are normals, which
+ * must remain perpendicular to the surface; in this case, normalize may be
+ * set to true to indicate that the vectors must also be normalized after
+ * having been transformed.
+ */
+void GeomVertexData::
+get_vector_xform(const LMatrix4 &mat, bool is_normal,
+                 LMatrix4 &xform, bool &normalize) {
+  normalize = false;
+  if (is_normal) {
+    // This is to preserve perpendicularity to the surface.
+    LVecBase3 scale_sq(mat.get_row3(0).length_squared(),
+                       mat.get_row3(1).length_squared(),
+                       mat.get_row3(2).length_squared());
+    if (IS_THRESHOLD_EQUAL(scale_sq[0], scale_sq[1], 2.0e-3f) &&
+        IS_THRESHOLD_EQUAL(scale_sq[0], scale_sq[2], 2.0e-3f)) {
+      // There is a uniform scale.
+      LVecBase3 scale, shear, hpr;
+      if (IS_THRESHOLD_EQUAL(scale_sq[0], 1, 2.0e-3f)) {
+        // No scale to worry about.
+        xform = mat;
+      } else if (decompose_matrix(mat.get_upper_3(), scale, shear, hpr)) {
+        // Make a new matrix with scale/translate taken out of the equation.
+        compose_matrix(xform, LVecBase3(1, 1, 1), shear, hpr, LVecBase3::zero());
+      } else {
+        normalize = true;
+      }
+    } else {
+      // There is a non-uniform scale, so we need to do all this to preserve
+      // orthogonality to the surface.
+      xform.invert_from(mat);
+      xform.transpose_in_place();
+      normalize = true;
+    }
+  } else {
+    xform = mat;
+  }
+}
+
 /**
  * Transforms each of the LPoint3f objects in the indicated table by the
  * indicated matrix.
@@ -1973,6 +2081,108 @@ table_xform_vecbase4f(unsigned char *datat, size_t num_rows, size_t stride,
   }
 }
 
+/**
+ * Transforms each of the LPoint3f objects in the indicated table by the
+ * matrix of the blend whose index is given by the corresponding entry in the
+ * blendt table.
+ */
+void GeomVertexData::
+table_skin_point3f(unsigned char *datat, size_t num_rows, size_t stride,
+                   const unsigned short *blendt, const LMatrix4f *mats) {
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+  for (size_t i = 0; i < num_rows; ++i) {
+    float *vertex = (float *)(&datat[i * stride]);
+    const float *m = mats[blendt[i]].get_data();
+
+    __m128 r = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[0]), _mm_loadu_ps(m)),
+                 _mm_mul_ps(_mm_set1_ps(vertex[1]), _mm_loadu_ps(m + 4))),
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[2]), _mm_loadu_ps(m + 8)),
+                 _mm_loadu_ps(m + 12)));
+
+    // Be careful not to write past the third component.
+    _mm_storel_pi((__m64 *)vertex, r);
+    _mm_store_ss(vertex + 2, _mm_movehl_ps(r, r));
+  }
+#else
+  for (size_t i = 0; i < num_rows; ++i) {
+    LPoint3f &vertex = *(LPoint3f *)(&datat[i * stride]);
+    vertex *= mats[blendt[i]];
+  }
+#endif
+}
+
+/**
+ * Transforms each of the LVector3f objects in the indicated table by the
+ * matrix of the blend whose index is given by the corresponding entry in the
+ * blendt table.  If normalize is not NULL, it is a table of flags for each
+ * blend indicating whether the vectors it transforms should be normalized
+ * afterwards.
+ */
+void GeomVertexData::
+table_skin_vector3f(unsigned char *datat, size_t num_rows, size_t stride,
+                    const unsigned short *blendt, const LMatrix4f *mats,
+                    const unsigned char *normalize) {
+  for (size_t i = 0; i < num_rows; ++i) {
+    int bi = blendt[i];
+
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+    float *vertex = (float *)(&datat[i * stride]);
+    const float *m = mats[bi].get_data();
+
+    __m128 r = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[0]), _mm_loadu_ps(m)),
+                 _mm_mul_ps(_mm_set1_ps(vertex[1]), _mm_loadu_ps(m + 4))),
+      _mm_mul_ps(_mm_set1_ps(vertex[2]), _mm_loadu_ps(m + 8)));
+
+    _mm_storel_pi((__m64 *)vertex, r);
+    _mm_store_ss(vertex + 2, _mm_movehl_ps(r, r));
+#else
+    LVector3f &vertex = *(LVector3f *)(&datat[i * stride]);
+    vertex = mats[bi].xform_vec(vertex);
+#endif
+
+    if (normalize != nullptr && normalize[bi]) {
+      ((LNormalf *)(&datat[i * stride]))->normalize();
+    }
+  }
+}
+
+/**
+ * Transforms each of the LVecBase4f objects in the indicated table by the
+ * matrix of the blend whose index is given by the corresponding entry in the
+ * blendt table.
+ */
+void GeomVertexData::
+table_skin_vecbase4f(unsigned char *datat, size_t num_rows, size_t stride,
+                     const unsigned short *blendt, const LMatrix4f *mats) {
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+  // Unaligned loads and stores are no slower than aligned ones on any
+  // processor we care about, so we don't distinguish the aligned case.
+  for (size_t i = 0; i < num_rows; ++i) {
+    float *vertex = (float *)(&datat[i * stride]);
+    const float *m = mats[blendt[i]].get_data();
+
+    __m128 r = _mm_add_ps(
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[0]), _mm_loadu_ps(m)),
+                 _mm_mul_ps(_mm_set1_ps(vertex[1]), _mm_loadu_ps(m + 4))),
+      _mm_add_ps(_mm_mul_ps(_mm_set1_ps(vertex[2]), _mm_loadu_ps(m + 8)),
+                 _mm_mul_ps(_mm_set1_ps(vertex[3]), _mm_loadu_ps(m + 12))));
+    _mm_storeu_ps(vertex, r);
+  }
+#else
+  // The table may not be aligned, so we don't use LVecBase4f here.
+  for (size_t i = 0; i < num_rows; ++i) {
+    float *vertex = (float *)(&datat[i * stride]);
+    const LMatrix4f &mat = mats[blendt[i]];
+    float v0 = vertex[0], v1 = vertex[1], v2 = vertex[2], v3 = vertex[3];
+    for (int c = 0; c < 4; ++c) {
+      vertex[c] = v0 * mat(0, c) + v1 * mat(1, c) + v2 * mat(2, c) + v3 * mat(3, c);
+    }
+  }
+#endif
+}
+
 /**
  * Tells the BamReader how to create objects of type GeomVertexData.
  */
@@ -37,6 +37,7 @@
 #include "pointerTo.h"
 #include "pmap.h"
 #include "pvector.h"
+#include "epvector.h"
 #include "deletedChain.h"
 
 class FactoryParams;
@@ -348,6 +349,20 @@ private:
   static void table_xform_vecbase4f(unsigned char *datat, size_t num_rows,
                                     size_t stride, const LMatrix4f &matf);
 
+  typedef epvector<LMatrix4f> SkinMatrices;
+  static void get_vector_xform(const LMatrix4 &mat, bool is_normal,
+                               LMatrix4 &xform, bool &normalize);
+  static void table_skin_point3f(unsigned char *datat, size_t num_rows,
+                                 size_t stride, const unsigned short *blendt,
+                                 const LMatrix4f *mats);
+  static void table_skin_vector3f(unsigned char *datat, size_t num_rows,
+                                  size_t stride, const unsigned short *blendt,
+                                  const LMatrix4f *mats,
+                                  const unsigned char *normalize);
+  static void table_skin_vecbase4f(unsigned char *datat, size_t num_rows,
+                                   size_t stride, const unsigned short *blendt,
+                                   const LMatrix4f *mats);
+
   static PStatCollector _convert_pcollector;
   static PStatCollector _scale_color_pcollector;
   static PStatCollector _set_color_pcollector;
@@ -1,5 +1,6 @@
 #include "adaptiveLru.cxx"
 #include "animateVerticesRequest.cxx"
+#include "bcEncoder.cxx"
 #include "bufferContext.cxx"
 #include "bufferContextChain.cxx"
 #include "bufferResidencyTracker.cxx"
@@ -11,9 +11,11 @@
 #include "simpleAllocator.cxx"
 #include "simpleLru.cxx"
 #include "sliderTable.cxx"
+#include "sparseTextureImage.cxx"
 #include "texture.cxx"
 #include "textureCollection.cxx"
 #include "textureContext.cxx"
+#include "textureLoadRequest.cxx"
 #include "texturePeeker.cxx"
 #include "texturePool.cxx"
 #include "texturePoolFilter.cxx"
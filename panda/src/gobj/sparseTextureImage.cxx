@@ -0,0 +1,888 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file sparseTextureImage.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "sparseTextureImage.h"
+#include "configVariableInt.h"
+#include "configVariableString.h"
+#include "config_gobj.h"
+#include "mutexHolder.h"
+#include "atomicAdjust.h"
+#include "pnmImage.h"
+#include "pnmReader.h"
+#include "datagram.h"
+#include "datagramIterator.h"
+#include <algorithm>
+
+using std::max;
+using std::min;
+
+ConfigVariableInt sparse_texture_tile_size
+("sparse-texture-tile-size", 128,
+ PRC_DESC("The default size in pixels of the square tiles into which a "
+          "SparseTextureImage splits each mipmap level of a texture."));
+
+ConfigVariableInt max_resident_sparse_texture_data
+("max-resident-sparse-texture-data", 67108864,
+ PRC_DESC("Specifies the maximum number of bytes of sparse texture tiles "
+          "that are allowed to remain resident in system RAM at one time.  "
+          "If more than this number of bytes of tiles have been read, "
+          "the least-recently-used ones will be dropped again until they "
+          "are needed.  Set it to -1 for no limit."));
+
+ConfigVariableString sparse_texture_save_file_prefix
+("sparse-texture-save-file-prefix", "p3d_tdata_",
+ PRC_DESC("A prefix used to generate the filename for the temporary page "
+          "file which holds the tiles of a SparseTextureImage that was not "
+          "given a page filename.  It is created in "
+          "vertex-save-file-directory."));
+
+AdaptiveLru *TVOLATILE SparseTextureImage::_global_lru = nullptr;
+
+// The page file begins with this, followed by the format and the size of each
+// level.  The magic number is written last, so that a page file that was
+// never finished is not mistaken for a good one.
+static const char page_file_magic[4] = { 'p', 's', 't', '1' };
+static const char page_file_unfinished[4] = { 0, 0, 0, 0 };
+
+/**
+ * The rows of one mipmap level that are on their way into the page file,
+ * while an image is being read one strip at a time.
+ */
+class SparseTextureImage::RowStream {
+public:
+  // The tile row being filled in, and the rows of it received so far, from
+  // the top down.
+  int _ty;
+  int _num_rows;
+  pvector<unsigned char> _strip;
+
+  // A row waiting for the next one, to be filtered together into a row of
+  // the next mipmap level.  If the level has an odd number of rows, the top
+  // one is skipped, like the last row of the RAM image in
+  // Texture::generate_ram_mipmap_images().
+  bool _skip_row;
+  bool _has_pending;
+  pvector<unsigned char> _pending;
+};
+
+/**
+ * Copies the uncompressed RAM images of the indicated texture, one mipmap
+ * level at a time, into tiles of tile_size x tile_size pixels, and writes the
+ * tiles out to the page file.  If tile_size is 0, the value of sparse-
+ * texture-tile-size is used.  If page_filename is empty, a temporary file is
+ * used, which is deleted again with the SparseTextureImage.
+ */
+SparseTextureImage::
+SparseTextureImage(const Texture *tex, int tile_size,
+                   const Filename &page_filename) :
+  _tile_size(tile_size > 0 ? tile_size : max((int)sparse_texture_tile_size, 1)),
+  _num_components(0),
+  _component_width(0),
+  _format(Texture::F_rgb),
+  _component_type(Texture::T_unsigned_byte),
+  _page_file_valid(false),
+  _temporary(false),
+  _lock("SparseTextureImage::_lock"),
+  _resident_size(0)
+{
+  nassertv(tex != nullptr);
+  nassertv(tex->get_texture_type() == Texture::TT_2d_texture);
+  nassertv(tex->get_ram_image_compression() == Texture::CM_off);
+
+  _num_components = tex->get_num_components();
+  _component_width = tex->get_component_width();
+  _format = tex->get_format();
+  _component_type = tex->get_component_type();
+  size_t pixel_width = get_pixel_width();
+
+  // The tiled mipmap chain stops at the first missing level.
+  int num_levels = 0;
+  while (num_levels < tex->get_num_ram_mipmap_images() &&
+         tex->has_ram_mipmap_image(num_levels)) {
+    ++num_levels;
+  }
+  if (num_levels == 0) {
+    return;
+  }
+  make_levels(tex->get_x_size(), tex->get_y_size(), num_levels);
+
+  MutexHolder holder(_lock);
+  create_page_file(page_filename);
+
+  pvector<unsigned char> buffer;
+  for (int n = 0; n < num_levels; ++n) {
+    CPTA_uchar image = tex->get_ram_mipmap_image(n);
+    Level &level = _levels[n];
+    nassertd(level._x_size == tex->get_expected_mipmap_x_size(n) &&
+             level._y_size == tex->get_expected_mipmap_y_size(n) &&
+             image.size() >= (size_t)level._x_size * level._y_size * pixel_width) {
+      break;
+    }
+
+    size_t image_row = (size_t)level._x_size * pixel_width;
+    for (int ty = 0; ty < level._num_y_tiles; ++ty) {
+      int th = min(_tile_size, level._y_size - ty * _tile_size);
+      for (int tx = 0; tx < level._num_x_tiles; ++tx) {
+        Tile *tile = level._tiles[ty * level._num_x_tiles + tx];
+        size_t tile_row = tile->_size / th;
+
+        buffer.resize(tile->_size);
+        const unsigned char *src = image.p() +
+          (size_t)ty * _tile_size * image_row + (size_t)tx * _tile_size * pixel_width;
+        for (int r = 0; r < th; ++r) {
+          memcpy(&buffer[r * tile_row], src + r * image_row, tile_row);
+        }
+        write_tile(tile, &buffer[0]);
+      }
+    }
+  }
+
+  finish_page_file();
+}
+
+/**
+ * Reads the indicated image file, a few rows at a time, and writes it out to
+ * the page file in tiles of tile_size x tile_size pixels.  If
+ * generate_mipmaps is true, the mipmap levels are generated along the way by
+ * averaging each 2x2 block of pixels, and paged as well.  Only the strips of
+ * the image that are currently being tiled are held in memory.
+ *
+ * If tile_size is 0, the value of sparse-texture-tile-size is used.  If
+ * page_filename is empty, a temporary file is used, which is deleted again
+ * with the SparseTextureImage.  Check is_valid() to see whether the image
+ * could be read.
+ */
+SparseTextureImage::
+SparseTextureImage(const Filename &image_filename, int tile_size,
+                   const Filename &page_filename, bool generate_mipmaps) :
+  _tile_size(tile_size > 0 ? tile_size : max((int)sparse_texture_tile_size, 1)),
+  _num_components(0),
+  _component_width(0),
+  _format(Texture::F_rgb),
+  _component_type(Texture::T_unsigned_byte),
+  _page_file_valid(false),
+  _temporary(false),
+  _lock("SparseTextureImage::_lock"),
+  _resident_size(0)
+{
+  PNMImageHeader header;
+  PNMReader *reader = header.make_reader(image_filename);
+  if (reader == nullptr) {
+    gobj_cat.error()
+      << "Unable to read " << image_filename << " for SparseTextureImage.\n";
+    return;
+  }
+  reader->prepare_read();
+
+  int x_size = reader->get_x_size();
+  int y_size = reader->get_y_size();
+  xelval maxval = reader->get_maxval();
+  _num_components = reader->get_num_channels();
+  if (!reader->is_valid() || x_size <= 0 || y_size <= 0 ||
+      _num_components < 1 || _num_components > 4) {
+    gobj_cat.error()
+      << "Invalid image " << image_filename << " for SparseTextureImage.\n";
+    delete reader;
+    return;
+  }
+
+  if (maxval > 255) {
+    _component_width = 2;
+    _component_type = Texture::T_unsigned_short;
+  } else {
+    _component_width = 1;
+    _component_type = Texture::T_unsigned_byte;
+  }
+  static const Texture::Format formats[4] = {
+    Texture::F_luminance, Texture::F_luminance_alpha,
+    Texture::F_rgb, Texture::F_rgba,
+  };
+  _format = formats[_num_components - 1];
+
+  int num_levels = 1;
+  if (generate_mipmaps) {
+    int size = max(x_size, y_size);
+    while (size > 1) {
+      size >>= 1;
+      ++num_levels;
+    }
+  }
+  make_levels(x_size, y_size, num_levels);
+
+  MutexHolder holder(_lock);
+  create_page_file(page_filename);
+
+  pvector<RowStream> streams(num_levels);
+  for (int n = 0; n < num_levels; ++n) {
+    const Level &level = _levels[n];
+    RowStream &stream = streams[n];
+    stream._ty = level._num_y_tiles - 1;
+    stream._num_rows = 0;
+    stream._strip.resize((size_t)_tile_size * level._x_size * get_pixel_width());
+    stream._skip_row = (level._y_size > 1 && (level._y_size & 1) != 0);
+    stream._has_pending = false;
+  }
+
+  // The image file is stored from the top down, while the RAM image, and
+  // therefore each tile, is stored from the bottom up.  The rows are
+  // converted to the RAM image layout, including the BGR component order.
+  unsigned int scale = (_component_width == 1) ? 255 : 65535;
+  pvector<unsigned char> row((size_t)x_size * get_pixel_width());
+  PNMImage strip;
+  int rows_read = 0;
+  while (reader->read_strip(strip, _tile_size)) {
+    for (int y = 0; y < strip.get_y_size(); ++y) {
+      unsigned char *p = &row[0];
+      for (int x = 0; x < x_size; ++x) {
+        xelval values[4];
+        switch (_num_components) {
+        case 1:
+          values[0] = strip.get_gray_val(x, y);
+          break;
+        case 2:
+          values[0] = strip.get_gray_val(x, y);
+          values[1] = strip.get_alpha_val(x, y);
+          break;
+        case 3:
+          values[0] = strip.get_blue_val(x, y);
+          values[1] = strip.get_green_val(x, y);
+          values[2] = strip.get_red_val(x, y);
+          break;
+        case 4:
+          values[0] = strip.get_blue_val(x, y);
+          values[1] = strip.get_green_val(x, y);
+          values[2] = strip.get_red_val(x, y);
+          values[3] = strip.get_alpha_val(x, y);
+          break;
+        }
+        for (int c = 0; c < _num_components; ++c) {
+          unsigned int value = (maxval == scale) ? values[c] :
+            ((unsigned int)values[c] * scale + maxval / 2) / maxval;
+          if (_component_width == 1) {
+            *p++ = (unsigned char)value;
+          } else {
+            *(uint16_t *)p = (uint16_t)value;
+            p += 2;
+          }
+        }
+      }
+      add_row(streams, 0, &row[0]);
+    }
+    rows_read += strip.get_y_size();
+  }
+  delete reader;
+
+  if (rows_read != y_size) {
+    gobj_cat.error()
+      << "Read only " << rows_read << " of " << y_size << " rows of "
+      << image_filename << ".\n";
+    for (Level &level : _levels) {
+      for (Tile *tile : level._tiles) {
+        delete tile;
+      }
+    }
+    _levels.clear();
+    _resident_size = 0;
+    return;
+  }
+
+  finish_page_file();
+}
+
+/**
+ * Used by open_page_file().
+ */
+SparseTextureImage::
+SparseTextureImage() :
+  _tile_size(0),
+  _num_components(0),
+  _component_width(0),
+  _format(Texture::F_rgb),
+  _component_type(Texture::T_unsigned_byte),
+  _page_file_valid(false),
+  _temporary(false),
+  _lock("SparseTextureImage::_lock"),
+  _resident_size(0)
+{
+}
+
+/**
+ *
+ */
+SparseTextureImage::
+~SparseTextureImage() {
+  MutexHolder holder(_lock);
+  for (Level &level : _levels) {
+    for (Tile *tile : level._tiles) {
+      tile->dequeue_lru();
+      delete tile;
+    }
+  }
+  _levels.clear();
+
+  _page_file.close();
+  if (_temporary) {
+    _page_filename.unlink();
+  }
+}
+
+/**
+ * Opens a page file that was written by an earlier SparseTextureImage that
+ * was given a page filename, without having to read the original image
+ * again.  Returns NULL if the file cannot be read or was not completely
+ * written.
+ */
+PT(SparseTextureImage) SparseTextureImage::
+open_page_file(const Filename &page_filename) {
+  Filename filename = Filename::binary_filename(page_filename);
+  PT(SparseTextureImage) image = new SparseTextureImage;
+
+  MutexHolder holder(image->_lock);
+
+  // The tiles are only ever read from now on, so the file may be read-only.
+  std::string os_specific = filename.to_os_specific();
+  image->_page_file.open(os_specific.c_str(), std::ios::in | std::ios::binary);
+  if (image->_page_file.fail()) {
+    gobj_cat.error()
+      << "Unable to open sparse texture page file " << filename << ".\n";
+    return nullptr;
+  }
+
+  char magic[sizeof(page_file_magic)];
+  image->_page_file.read(magic, sizeof(magic));
+  if (image->_page_file.gcount() != sizeof(magic) ||
+      memcmp(magic, page_file_magic, sizeof(magic)) != 0) {
+    gobj_cat.error()
+      << filename << " is not a complete sparse texture page file.\n";
+    return nullptr;
+  }
+
+  // The format is followed by the size of each level.
+  char header[8];
+  image->_page_file.read(header, sizeof(header));
+  if (image->_page_file.gcount() != sizeof(header)) {
+    return nullptr;
+  }
+  Datagram dg(header, sizeof(header));
+  DatagramIterator scan(dg);
+  image->_tile_size = scan.get_uint16();
+  image->_num_components = scan.get_uint8();
+  image->_component_width = scan.get_uint8();
+  image->_format = (Texture::Format)scan.get_uint8();
+  image->_component_type = (Texture::ComponentType)scan.get_uint8();
+  int num_levels = scan.get_uint16();
+
+  vector_uchar sizes(num_levels * 8);
+  if (num_levels > 0) {
+    image->_page_file.read((char *)&sizes[0], sizes.size());
+  }
+  if (image->_tile_size <= 0 || num_levels <= 0 ||
+      image->_num_components < 1 || image->_num_components > 4 ||
+      (image->_component_width != 1 && image->_component_width != 2) ||
+      image->_page_file.gcount() != (std::streamsize)sizes.size()) {
+    gobj_cat.error()
+      << "Invalid sparse texture page file " << filename << ".\n";
+    return nullptr;
+  }
+  Datagram size_dg(std::move(sizes));
+  DatagramIterator size_scan(size_dg);
+  int x_size = size_scan.get_uint32();
+  int y_size = size_scan.get_uint32();
+  image->make_levels(x_size, y_size, num_levels);
+  for (int n = 1; n < num_levels; ++n) {
+    int level_x_size = size_scan.get_uint32();
+    int level_y_size = size_scan.get_uint32();
+    if (level_x_size != image->_levels[n]._x_size ||
+        level_y_size != image->_levels[n]._y_size) {
+      gobj_cat.error()
+        << "Invalid sparse texture page file " << filename << ".\n";
+      return nullptr;
+    }
+  }
+
+  for (Level &level : image->_levels) {
+    for (Tile *tile : level._tiles) {
+      tile->_paged = true;
+    }
+  }
+  image->_page_filename = filename;
+  image->_page_file_valid = true;
+  return image;
+}
+
+/**
+ * Returns the pixels of the indicated tile, reading it from disk first if it
+ * is not currently resident.  The pixels are in the same order as in the
+ * texture's RAM image, beginning with the lower-left corner of the tile; each
+ * row is get_tile_x_size(n, tx) pixels wide.
+ *
+ * The tile is also recorded as touched, see get_touched_tile().
+ */
+CPTA_uchar SparseTextureImage::
+get_tile(int n, int tx, int ty) {
+  CPTA_uchar result;
+  {
+    MutexHolder holder(_lock);
+    Tile *tile = get_tile_ptr(n, tx, ty);
+    nassertr(tile != nullptr, CPTA_uchar());
+    do_load_tile(tile);
+    result = tile->_data;
+  }
+
+  AdaptiveLru *lru = get_global_lru();
+  lru->consider_evict();
+  if (lru->get_total_size() > lru->get_max_size() * 2) {
+    // The LRU doesn't evict tiles used in the current frame, but we don't want
+    // an application that never renders a frame to grow without bound.
+    lru->evict_to(lru->get_max_size());
+  }
+  return result;
+}
+
+/**
+ * Returns the pixels within the indicated rectangle of the nth mipmap level,
+ * in the same layout as the texture's RAM image would have for an image of
+ * x_size by y_size pixels.  All of the tiles that intersect the rectangle are
+ * read from disk as needed, and recorded as touched.
+ */
+PTA_uchar SparseTextureImage::
+extract_region(int n, int x, int y, int x_size, int y_size) {
+  nassertr(n >= 0 && n < (int)_levels.size(), PTA_uchar());
+  const Level &level = _levels[n];
+  nassertr(x >= 0 && y >= 0 && x_size > 0 && y_size > 0 &&
+           x + x_size <= level._x_size && y + y_size <= level._y_size,
+           PTA_uchar());
+
+  size_t pixel_width = (size_t)_num_components * _component_width;
+  size_t dest_row = (size_t)x_size * pixel_width;
+  PTA_uchar result = PTA_uchar::empty_array(dest_row * y_size);
+  {
+    MutexHolder holder(_lock);
+    int tx_end = (x + x_size - 1) / _tile_size;
+    int ty_end = (y + y_size - 1) / _tile_size;
+    for (int ty = y / _tile_size; ty <= ty_end; ++ty) {
+      int ty0 = ty * _tile_size;
+      int y0 = max(y, ty0);
+      int y1 = min(y + y_size, ty0 + _tile_size);
+      for (int tx = x / _tile_size; tx <= tx_end; ++tx) {
+        int tx0 = tx * _tile_size;
+        int x0 = max(x, tx0);
+        int x1 = min(x + x_size, tx0 + _tile_size);
+
+        Tile *tile = level._tiles[ty * level._num_x_tiles + tx];
+        do_load_tile(tile);
+
+        size_t tile_row = (size_t)min(_tile_size, level._x_size - tx0) * pixel_width;
+        size_t span = (size_t)(x1 - x0) * pixel_width;
+        for (int yi = y0; yi < y1; ++yi) {
+          memcpy(result.p() + (size_t)(yi - y) * dest_row + (size_t)(x0 - x) * pixel_width,
+                 tile->_data.p() + (size_t)(yi - ty0) * tile_row + (size_t)(x0 - tx0) * pixel_width,
+                 span);
+        }
+      }
+    }
+  }
+
+  AdaptiveLru *lru = get_global_lru();
+  lru->consider_evict();
+  if (lru->get_total_size() > lru->get_max_size() * 2) {
+    lru->evict_to(lru->get_max_size());
+  }
+  return result;
+}
+
+/**
+ * Returns true if the indicated tile is currently in memory, false if it
+ * would have to be read from disk.
+ */
+bool SparseTextureImage::
+is_tile_resident(int n, int tx, int ty) const {
+  MutexHolder holder(_lock);
+  Tile *tile = get_tile_ptr(n, tx, ty);
+  nassertr(tile != nullptr, false);
+  return !tile->_data.is_null();
+}
+
+/**
+ * Returns the number of bytes of this image's tiles that are currently in
+ * memory.
+ */
+size_t SparseTextureImage::
+get_resident_size() const {
+  MutexHolder holder(_lock);
+  return _resident_size;
+}
+
+/**
+ * Drops all of this image's tiles from memory, except those that could not be
+ * written to disk.
+ */
+void SparseTextureImage::
+evict_tiles() {
+  MutexHolder holder(_lock);
+  for (Level &level : _levels) {
+    for (Tile *tile : level._tiles) {
+      if (tile->_paged && !tile->_data.is_null()) {
+        _resident_size -= tile->_size;
+        tile->_data.clear();
+        tile->dequeue_lru();
+      }
+    }
+  }
+}
+
+/**
+ * Returns the number of distinct tiles that have been requested since the
+ * last call to clear_touched_tiles().
+ */
+int SparseTextureImage::
+get_num_touched_tiles() const {
+  MutexHolder holder(_lock);
+  return (int)_touched.size();
+}
+
+/**
+ * Returns the nth tile that has been requested since the last call to
+ * clear_touched_tiles(), as (tx, ty, mipmap level), in the order in which the
+ * tiles were first requested.
+ */
+LVecBase3i SparseTextureImage::
+get_touched_tile(int i) const {
+  MutexHolder holder(_lock);
+  nassertr(i >= 0 && i < (int)_touched.size(), LVecBase3i::zero());
+  return _touched[i];
+}
+
+/**
+ * Resets the list of touched tiles.
+ */
+void SparseTextureImage::
+clear_touched_tiles() {
+  MutexHolder holder(_lock);
+  for (const LVecBase3i &t : _touched) {
+    get_tile_ptr(t[2], t[0], t[1])->_touched = false;
+  }
+  _touched.clear();
+}
+
+/**
+ * Returns the AdaptiveLru that limits the tiles of all SparseTextureImages
+ * held in memory to max-resident-sparse-texture-data bytes.
+ */
+AdaptiveLru *SparseTextureImage::
+get_global_lru() {
+  if (_global_lru == nullptr) {
+    size_t max_size = (size_t)max_resident_sparse_texture_data;
+    AdaptiveLru *lru = new AdaptiveLru("sparse-texture", max_size);
+    void *result = AtomicAdjust::compare_and_exchange_ptr
+      ((void * TVOLATILE &)_global_lru, nullptr, (void *)lru);
+    if (result != nullptr) {
+      // Someone else got there first.
+      delete lru;
+    }
+  }
+  return (AdaptiveLru *)_global_lru;
+}
+
+/**
+ * Marks that an epoch has passed in the global LRU.  This is called once per
+ * frame by the GraphicsEngine.
+ */
+void SparseTextureImage::
+lru_epoch() {
+  AdaptiveLru *lru = (AdaptiveLru *)AtomicAdjust::get_ptr((void * TVOLATILE &)_global_lru);
+  if (lru != nullptr) {
+    lru->begin_epoch();
+  }
+}
+
+/**
+ *
+ */
+void SparseTextureImage::
+output(std::ostream &out) const {
+  MutexHolder holder(_lock);
+  out << "SparseTextureImage " << _levels.size() << " levels, tile size "
+      << _tile_size << ", " << _resident_size << " bytes resident";
+}
+
+/**
+ * Sets up the indicated number of mipmap levels for an image of the given
+ * size, and their tiles, assigning each tile its place in the page file.
+ */
+void SparseTextureImage::
+make_levels(int x_size, int y_size, int num_levels) {
+  size_t pixel_width = get_pixel_width();
+  std::streamoff offset = sizeof(page_file_magic) + 8 + (std::streamoff)num_levels * 8;
+
+  _levels.resize(num_levels);
+  for (int n = 0; n < num_levels; ++n) {
+    Level &level = _levels[n];
+    level._x_size = max(x_size >> n, 1);
+    level._y_size = max(y_size >> n, 1);
+    level._num_x_tiles = (level._x_size + _tile_size - 1) / _tile_size;
+    level._num_y_tiles = (level._y_size + _tile_size - 1) / _tile_size;
+    level._tiles.reserve((size_t)level._num_x_tiles * level._num_y_tiles);
+
+    for (int ty = 0; ty < level._num_y_tiles; ++ty) {
+      int th = min(_tile_size, level._y_size - ty * _tile_size);
+      for (int tx = 0; tx < level._num_x_tiles; ++tx) {
+        int tw = min(_tile_size, level._x_size - tx * _tile_size);
+        Tile *tile = new Tile(this, n, tx, ty, (size_t)tw * th * pixel_width);
+        tile->_offset = offset;
+        offset += tile->_size;
+        level._tiles.push_back(tile);
+      }
+    }
+  }
+}
+
+/**
+ * Creates the page file, or a temporary file if page_filename is empty, and
+ * writes the header, except for the magic number.  Returns true on success.
+ * Assumes the lock is held.
+ */
+bool SparseTextureImage::
+create_page_file(const Filename &page_filename) {
+  if (page_filename.empty()) {
+    Filename dir = vertex_save_file_directory;
+    if (dir.empty()) {
+      dir = Filename::get_temp_directory();
+    }
+    _page_filename = Filename::temporary(dir, sparse_texture_save_file_prefix,
+                                         ".dat");
+    _temporary = true;
+  } else {
+    _page_filename = page_filename;
+  }
+  _page_filename.set_binary();
+  _page_filename.make_dir();
+
+  if (!_page_filename.open_read_write(_page_file, true)) {
+    gobj_cat.warning()
+      << "Unable to write sparse texture page file " << _page_filename
+      << "; keeping the tiles resident.\n";
+    return false;
+  }
+
+  Datagram dg;
+  dg.append_data(page_file_unfinished, sizeof(page_file_unfinished));
+  dg.add_uint16(_tile_size);
+  dg.add_uint8(_num_components);
+  dg.add_uint8(_component_width);
+  dg.add_uint8(_format);
+  dg.add_uint8(_component_type);
+  dg.add_uint16(_levels.size());
+  for (const Level &level : _levels) {
+    dg.add_uint32(level._x_size);
+    dg.add_uint32(level._y_size);
+  }
+  _page_file.write((const char *)dg.get_data(), dg.get_length());
+  _page_file_valid = !_page_file.fail();
+  return _page_file_valid;
+}
+
+/**
+ * Writes the magic number to the page file, now that all of the tiles have
+ * been written, and flushes it.  Returns true on success.  Assumes the lock
+ * is held.
+ */
+bool SparseTextureImage::
+finish_page_file() {
+  if (!_page_file_valid) {
+    return false;
+  }
+  _page_file.seekp(0);
+  _page_file.write(page_file_magic, sizeof(page_file_magic));
+  _page_file.flush();
+  if (_page_file.fail()) {
+    gobj_cat.error()
+      << "Unable to finish sparse texture page file " << _page_filename
+      << ".\n";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Writes the pixels of the indicated tile to its place in the page file.  If
+ * that fails, the tile keeps a copy of the pixels in memory instead.  Assumes
+ * the lock is held.
+ */
+void SparseTextureImage::
+write_tile(Tile *tile, const unsigned char *data) {
+  if (_page_file_valid) {
+    _page_file.seekp(tile->_offset);
+    _page_file.write((const char *)data, tile->_size);
+    if (!_page_file.fail()) {
+      tile->_paged = true;
+      return;
+    }
+
+    gobj_cat.warning()
+      << "Unable to write sparse texture tiles to " << _page_filename
+      << "; keeping them resident.\n";
+    _page_file.clear();
+    _page_file_valid = false;
+  }
+
+  // We couldn't page it out, so the tile stays resident for good.
+  tile->_data = PTA_uchar::empty_array(tile->_size);
+  memcpy(tile->_data.p(), data, tile->_size);
+  _resident_size += tile->_size;
+}
+
+/**
+ * Adds the next row of the nth mipmap level, counting from the top of the
+ * image down, while an image is being read.  Whenever a whole row of tiles
+ * has been received, they are written out.  Every two rows are also filtered
+ * down into a row of the next level.  Assumes the lock is held.
+ */
+void SparseTextureImage::
+add_row(pvector<RowStream> &streams, int n, const unsigned char *row) {
+  const Level &level = _levels[n];
+  RowStream &stream = streams[n];
+  size_t pixel_width = get_pixel_width();
+  size_t row_size = (size_t)level._x_size * pixel_width;
+
+  if (stream._ty >= 0) {
+    int th = min(_tile_size, level._y_size - stream._ty * _tile_size);
+    memcpy(&stream._strip[stream._num_rows * row_size], row, row_size);
+    ++stream._num_rows;
+
+    if (stream._num_rows == th) {
+      // The strip is complete.  Cut it into tiles, turning it upside down.
+      pvector<unsigned char> buffer;
+      for (int tx = 0; tx < level._num_x_tiles; ++tx) {
+        Tile *tile = level._tiles[stream._ty * level._num_x_tiles + tx];
+        size_t tile_row = tile->_size / th;
+        buffer.resize(tile->_size);
+        for (int r = 0; r < th; ++r) {
+          memcpy(&buffer[(th - 1 - r) * tile_row],
+                 &stream._strip[r * row_size + (size_t)tx * _tile_size * pixel_width],
+                 tile_row);
+        }
+        write_tile(tile, &buffer[0]);
+      }
+      stream._num_rows = 0;
+      --stream._ty;
+    }
+  }
+
+  if (n + 1 >= (int)_levels.size()) {
+    return;
+  }
+
+  const unsigned char *other = row;
+  if (level._y_size > 1) {
+    if (stream._skip_row) {
+      stream._skip_row = false;
+      return;
+    }
+    if (!stream._has_pending) {
+      stream._pending.assign(row, row + row_size);
+      stream._has_pending = true;
+      return;
+    }
+    other = &stream._pending[0];
+    stream._has_pending = false;
+  }
+
+  // Average each 2x2 block of pixels, or 2x1 in a level that is only one row
+  // high, into one pixel of the next level.
+  int next_x_size = _levels[n + 1]._x_size;
+  pvector<unsigned char> next_row((size_t)next_x_size * pixel_width);
+  for (int x = 0; x < next_x_size; ++x) {
+    int x0 = min(x * 2, level._x_size - 1);
+    int x1 = min(x * 2 + 1, level._x_size - 1);
+    for (int c = 0; c < _num_components; ++c) {
+      if (_component_width == 1) {
+        const unsigned char *a = row + c;
+        const unsigned char *b = other + c;
+        unsigned int sum = a[x0 * pixel_width] + a[x1 * pixel_width] +
+                           b[x0 * pixel_width] + b[x1 * pixel_width];
+        next_row[x * pixel_width + c] = (unsigned char)((sum + 2) >> 2);
+      } else {
+        const unsigned char *a = row + c * 2;
+        const unsigned char *b = other + c * 2;
+        unsigned int sum =
+          *(const uint16_t *)(a + x0 * pixel_width) +
+          *(const uint16_t *)(a + x1 * pixel_width) +
+          *(const uint16_t *)(b + x0 * pixel_width) +
+          *(const uint16_t *)(b + x1 * pixel_width);
+        *(uint16_t *)&next_row[x * pixel_width + c * 2] = (uint16_t)((sum + 2) >> 2);
+      }
+    }
+  }
+  add_row(streams, n + 1, &next_row[0]);
+}
+
+/**
+ * Makes sure that the indicated tile is resident and marks it as used.
+ * Assumes the lock is held.
+ */
+void SparseTextureImage::
+do_load_tile(Tile *tile) {
+  if (tile->_data.is_null()) {
+    PTA_uchar data = PTA_uchar::empty_array(tile->_size);
+    _page_file.seekg(tile->_offset);
+    _page_file.read((char *)data.p(), tile->_size);
+    if (_page_file.gcount() != (std::streamsize)tile->_size) {
+      gobj_cat.error()
+        << "Unable to read sparse texture tile " << tile->_tx << ", "
+        << tile->_ty << " of level " << tile->_n << " from "
+        << _page_filename << ".\n";
+      _page_file.clear();
+    }
+    tile->_data = data;
+    _resident_size += tile->_size;
+  }
+  if (tile->_paged) {
+    tile->mark_used_lru(get_global_lru());
+  }
+  if (!tile->_touched) {
+    tile->_touched = true;
+    _touched.push_back(LVecBase3i(tile->_tx, tile->_ty, tile->_n));
+  }
+}
+
+/**
+ *
+ */
+SparseTextureImage::Tile::
+Tile(SparseTextureImage *owner, int n, int tx, int ty, size_t size) :
+  AdaptiveLruPage(size),
+  _owner(owner),
+  _n(n),
+  _tx(tx),
+  _ty(ty),
+  _size(size),
+  _offset(0),
+  _paged(false),
+  _touched(false)
+{
+}
+
+/**
+ * Called by the AdaptiveLru when the tile should be dropped from memory.  It
+ * will be read from the page file again the next time it is requested.
+ */
+void SparseTextureImage::Tile::
+evict_lru() {
+  MutexHolder holder(_owner->_lock);
+  if (_paged && !_data.is_null()) {
+    _owner->_resident_size -= _size;
+    _data.clear();
+  }
+  dequeue_lru();
+}
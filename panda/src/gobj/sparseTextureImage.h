@@ -0,0 +1,174 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file sparseTextureImage.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef SPARSETEXTUREIMAGE_H
+#define SPARSETEXTUREIMAGE_H
+
+#include "pandabase.h"
+
+#include "referenceCount.h"
+#include "texture.h"
+#include "adaptiveLru.h"
+#include "filename.h"
+#include "pandaFileStream.h"
+#include "pta_uchar.h"
+#include "luse.h"
+#include "pmutex.h"
+#include "pvector.h"
+
+/**
+ * A tiled, paged image in the layout of a Texture's RAM images, for very
+ * large textures of which only a small part is needed at any one time.
+ *
+ * Each mipmap level is split into square tiles of a fixed size, which are
+ * written to a page file on disk.  A tile is read back into memory only when
+ * it is requested via get_tile() or extract_region(), and resident tiles are
+ * evicted again by a global AdaptiveLru when the max-resident-sparse-texture-
+ * data limit is exceeded.
+ *
+ * The image may be read from an image file, a few rows at a time, so that the
+ * whole image never has to be in memory at once; the mipmap levels are
+ * filtered down as the rows go by.  It may also be copied from the RAM images
+ * of a Texture, which may be cleared afterwards.  If a page filename is
+ * given, the page file is kept, and may be opened again later with
+ * open_page_file(); otherwise, a temporary file is used.
+ *
+ * The SparseTextureImage also records which tiles have been requested since
+ * the last call to clear_touched_tiles(), so that the application can decide
+ * which parts of the texture to upload or prefetch.
+ *
+ * Only uncompressed 2-d textures are supported.
+ */
+class EXPCL_PANDA_GOBJ SparseTextureImage : public ReferenceCount {
+PUBLISHED:
+  explicit SparseTextureImage(const Texture *tex, int tile_size = 0,
+                              const Filename &page_filename = Filename());
+  explicit SparseTextureImage(const Filename &image_filename,
+                              int tile_size = 0,
+                              const Filename &page_filename = Filename(),
+                              bool generate_mipmaps = true);
+  ~SparseTextureImage();
+
+  static PT(SparseTextureImage) open_page_file(const Filename &page_filename);
+
+  INLINE bool is_valid() const;
+  INLINE const Filename &get_page_filename() const;
+  INLINE int get_tile_size() const;
+  INLINE int get_num_levels() const;
+  INLINE int get_x_size(int n = 0) const;
+  INLINE int get_y_size(int n = 0) const;
+  INLINE int get_num_x_tiles(int n = 0) const;
+  INLINE int get_num_y_tiles(int n = 0) const;
+  INLINE int get_tile_x_size(int n, int tx) const;
+  INLINE int get_tile_y_size(int n, int ty) const;
+  INLINE int get_num_components() const;
+  INLINE int get_component_width() const;
+  INLINE Texture::Format get_format() const;
+  INLINE Texture::ComponentType get_component_type() const;
+
+  MAKE_PROPERTY(page_filename, get_page_filename);
+  MAKE_PROPERTY(tile_size, get_tile_size);
+  MAKE_PROPERTY(num_levels, get_num_levels);
+  MAKE_PROPERTY(num_components, get_num_components);
+  MAKE_PROPERTY(component_width, get_component_width);
+  MAKE_PROPERTY(format, get_format);
+  MAKE_PROPERTY(component_type, get_component_type);
+
+  CPTA_uchar get_tile(int n, int tx, int ty);
+  PTA_uchar extract_region(int n, int x, int y, int x_size, int y_size);
+  bool is_tile_resident(int n, int tx, int ty) const;
+  size_t get_resident_size() const;
+  void evict_tiles();
+
+  int get_num_touched_tiles() const;
+  LVecBase3i get_touched_tile(int i) const;
+  void clear_touched_tiles();
+
+  static AdaptiveLru *get_global_lru();
+  static void lru_epoch();
+
+  void output(std::ostream &out) const;
+
+private:
+  SparseTextureImage();
+
+  class Tile;
+  class RowStream;
+  INLINE Tile *get_tile_ptr(int n, int tx, int ty) const;
+  INLINE size_t get_pixel_width() const;
+  void make_levels(int x_size, int y_size, int num_levels);
+  bool create_page_file(const Filename &page_filename);
+  bool finish_page_file();
+  void write_tile(Tile *tile, const unsigned char *data);
+  void add_row(pvector<RowStream> &streams, int n, const unsigned char *row);
+  void do_load_tile(Tile *tile);
+
+private:
+  /**
+   * One tile of one mipmap level.  It is an AdaptiveLruPage while its image
+   * is resident in memory, and is dequeued again when it is evicted.
+   */
+  class Tile : public AdaptiveLruPage {
+  public:
+    Tile(SparseTextureImage *owner, int n, int tx, int ty, size_t size);
+
+    virtual void evict_lru();
+
+    SparseTextureImage *_owner;
+    int _n, _tx, _ty;
+    size_t _size;
+    std::streamoff _offset;
+    PTA_uchar _data;
+    bool _paged;
+    bool _touched;
+  };
+
+  class Level {
+  public:
+    int _x_size, _y_size;
+    int _num_x_tiles, _num_y_tiles;
+    pvector<Tile *> _tiles;
+  };
+  typedef pvector<Level> Levels;
+  Levels _levels;
+
+  int _tile_size;
+  int _num_components;
+  int _component_width;
+  Texture::Format _format;
+  Texture::ComponentType _component_type;
+
+  // The page file is laid out as a header, followed by the tiles of each
+  // level in turn.  It is only read or written while _lock is held.
+  Filename _page_filename;
+  pfstream _page_file;
+  bool _page_file_valid;
+  bool _temporary;
+
+  mutable Mutex _lock;
+  size_t _resident_size;
+
+  typedef pvector<LVecBase3i> Touched;
+  Touched _touched;
+
+  static AdaptiveLru *TVOLATILE _global_lru;
+};
+
+INLINE std::ostream &operator << (std::ostream &out, const SparseTextureImage &image) {
+  image.output(out);
+  return out;
+}
+
+#include "sparseTextureImage.I"
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_skinning.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "config_gobj.h"
+#include "geom.h"
+#include "geomVertexData.h"
+#include "geomVertexFormat.h"
+#include "geomVertexArrayFormat.h"
+#include "geomVertexWriter.h"
+#include "geomVertexReader.h"
+#include "transformBlendTable.h"
+#include "userVertexTransform.h"
+#include "trueClock.h"
+#include "thread.h"
+
+// The number of characters, each with its own skeleton and vertex data.
+static const int num_characters = 300;
+static const int num_vertices = 2000;
+static const int num_joints = 30;
+
+// The number of frames to animate for each code path.
+static const int num_frames = 20;
+
+class Character {
+public:
+  pvector<PT(UserVertexTransform)> _joints;
+  PT(GeomVertexData) _vdata;
+};
+
+static CPT(GeomVertexFormat)
+make_format() {
+  PT(GeomVertexArrayFormat) array_format = new GeomVertexArrayFormat;
+  array_format->add_column(InternalName::get_vertex(), 3,
+                           Geom::NT_float32, Geom::C_point);
+  array_format->add_column(InternalName::get_normal(), 3,
+                           Geom::NT_float32, Geom::C_normal);
+
+  PT(GeomVertexFormat) format = new GeomVertexFormat(array_format);
+
+  GeomVertexAnimationSpec animation;
+  animation.set_panda();
+  format->set_animation(animation);
+
+  PT(GeomVertexArrayFormat) anim_array_format = new GeomVertexArrayFormat;
+  anim_array_format->add_column(InternalName::get_transform_blend(), 1,
+                                Geom::NT_uint16, Geom::C_index, 0, 2);
+  format->add_array(anim_array_format);
+
+  return GeomVertexFormat::register_format(format);
+}
+
+static void
+make_character(Character &character, const GeomVertexFormat *format,
+               unsigned int &seed) {
+  for (int j = 0; j < num_joints; ++j) {
+    character._joints.push_back(new UserVertexTransform("joint"));
+  }
+
+  PT(TransformBlendTable) table = new TransformBlendTable;
+  table->set_rows(SparseArray::lower_on(num_vertices));
+
+  character._vdata = new GeomVertexData("character", format, Geom::UH_stream);
+  character._vdata->unclean_set_num_rows(num_vertices);
+
+  GeomVertexWriter vertex(character._vdata, InternalName::get_vertex());
+  GeomVertexWriter normal(character._vdata, InternalName::get_normal());
+  GeomVertexWriter blend(character._vdata, InternalName::get_transform_blend());
+
+  for (int i = 0; i < num_vertices; ++i) {
+    // Each vertex is influenced by four neighbouring joints, much like a
+    // typical skinned mesh.
+    int j = i * num_joints / num_vertices;
+    TransformBlend tb;
+    for (int k = 0; k < 4; ++k) {
+      tb.add_transform(character._joints[(j + k) % num_joints], 0.25f);
+    }
+    tb.normalize_weights();
+
+    seed = seed * 1103515245 + 12345;
+    PN_stdfloat z = (seed >> 8) % 1000 / 100.0f;
+    vertex.add_data3(cos(i * 0.1f), sin(i * 0.1f), z);
+    normal.add_data3(cos(i * 0.1f), sin(i * 0.1f), 0);
+    blend.add_data1i(table->add_blend(tb));
+  }
+
+  character._vdata->set_transform_blend_table(table);
+}
+
+static void
+pose_characters(pvector<Character> &characters, int frame) {
+  for (Character &character : characters) {
+    for (int j = 0; j < num_joints; ++j) {
+      PN_stdfloat angle = (frame + j) * 3.0f;
+      character._joints[j]->set_matrix(
+        LMatrix4::rotate_mat(angle, LVector3::up()) *
+        LMatrix4::scale_mat(1.0f, 1.0f + j * 0.01f, 1.0f) *
+        LMatrix4::translate_mat(j * 0.1f, 0, 0));
+    }
+  }
+}
+
+static double
+animate_characters(pvector<Character> &characters,
+                   pvector<CPT(GeomVertexData)> &results) {
+  Thread *current_thread = Thread::get_current_thread();
+  TrueClock *clock = TrueClock::get_global_ptr();
+
+  double elapsed = 0.0;
+  for (int frame = 0; frame < num_frames; ++frame) {
+    pose_characters(characters, frame);
+
+    double start = clock->get_short_time();
+    for (Character &character : characters) {
+      character._vdata->animate_vertices(true, current_thread);
+    }
+    elapsed += clock->get_short_time() - start;
+  }
+
+  // The animated vertices are reused from frame to frame, so we have to
+  // make copies of the final results in order to compare them.
+  results.clear();
+  for (Character &character : characters) {
+    CPT(GeomVertexData) animated =
+      character._vdata->animate_vertices(true, current_thread);
+    results.push_back(new GeomVertexData(*animated));
+  }
+  return elapsed;
+}
+
+int
+main(int argc, char *argv[]) {
+  CPT(GeomVertexFormat) format = make_format();
+
+  unsigned int seed = 1;
+  pvector<Character> characters(num_characters);
+  for (Character &character : characters) {
+    make_character(character, format, seed);
+  }
+
+  pvector<CPT(GeomVertexData)> generic_results, fast_results;
+
+  fast_animated_vertices = false;
+  double generic_time = animate_characters(characters, generic_results);
+
+  fast_animated_vertices = true;
+  double fast_time = animate_characters(characters, fast_results);
+
+  nout << "generic: " << generic_time * 1000.0 / num_frames
+       << " ms per frame\n"
+       << "fast: " << fast_time * 1000.0 / num_frames
+       << " ms per frame\n";
+
+  // Both code paths should produce the same vertices, within rounding.
+  for (int c = 0; c < num_characters; ++c) {
+    GeomVertexReader generic(generic_results[c], InternalName::get_vertex());
+    GeomVertexReader fast(fast_results[c], InternalName::get_vertex());
+    while (!generic.is_at_end()) {
+      LPoint3 a = generic.get_data3();
+      LPoint3 b = fast.get_data3();
+      if (!a.almost_equal(b, 0.001f)) {
+        nout << "Mismatch in character " << c << ": " << a << " vs. " << b
+             << "\n";
+        return 1;
+      }
+    }
+  }
+
+  return 0;
+}
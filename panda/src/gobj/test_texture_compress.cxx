@@ -0,0 +1,148 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_texture_compress.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "texture.h"
+#include "asyncParallelFor.h"
+#include "asyncTaskManager.h"
+#include "trueClock.h"
+
+#include <iomanip>
+
+// The size of the image to compress.
+static const int x_size = 1024;
+static const int y_size = 1024;
+
+// The minimum amount of time, in seconds, to spend on each measurement.
+static const double run_time = 1.0;
+
+// The number of threads to measure with, besides the calling thread alone.
+static const int num_threads = 4;
+
+/**
+ * Fills in an image with smooth gradients, some sharp edges and a little
+ * noise, so that it is not too easy to compress.
+ */
+static PTA_uchar
+make_image(int num_components) {
+  PTA_uchar image = PTA_uchar::empty_array((size_t)x_size * y_size * num_components);
+  unsigned int seed = 1;
+  unsigned char *p = image.p();
+  for (int y = 0; y < y_size; ++y) {
+    for (int x = 0; x < x_size; ++x) {
+      seed = seed * 1103515245 + 12345;
+      int noise = (seed >> 16) % 16;
+      int checker = (((x >> 5) ^ (y >> 5)) & 1) * 64;
+      unsigned char values[4] = {
+        (unsigned char)((x * 255 / x_size + noise) & 0xff),
+        (unsigned char)((y * 255 / y_size + checker) & 0xff),
+        (unsigned char)(((x + y) * 127 / x_size + noise) & 0xff),
+        (unsigned char)(((x * y) >> 8) & 0xff),
+      };
+      for (int c = 0; c < num_components; ++c) {
+        *p++ = values[c];
+      }
+    }
+  }
+  return image;
+}
+
+/**
+ * Compresses the image repeatedly for at least run_time seconds.  Returns
+ * the rate in megabytes of uncompressed input per second, and fills in the
+ * compressed result.
+ */
+static double
+measure(const PTA_uchar &image, Texture::Format format,
+        Texture::CompressionMode compression,
+        Texture::QualityLevel quality_level, std::string &result) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  PT(Texture) tex = new Texture("compress");
+
+  double elapsed = 0.0;
+  int count = 0;
+  do {
+    tex->setup_2d_texture(x_size, y_size, Texture::T_unsigned_byte, format);
+    tex->set_ram_image(image);
+
+    double start = clock->get_short_time();
+    if (!tex->compress_ram_image(compression, quality_level)) {
+      return 0.0;
+    }
+    elapsed += clock->get_short_time() - start;
+    ++count;
+  } while (elapsed < run_time);
+
+  CPTA_uchar compressed = tex->get_ram_image();
+  result.assign((const char *)compressed.p(), compressed.size());
+  return (double)image.size() * count / elapsed / 1048576.0;
+}
+
+int
+main(int argc, char *argv[]) {
+  struct Mode {
+    const char *_name;
+    Texture::CompressionMode _compression;
+    Texture::Format _format;
+    int _num_components;
+  };
+  static const Mode modes[] = {
+    { "dxt1", Texture::CM_dxt1, Texture::F_rgb, 3 },
+    { "dxt5", Texture::CM_dxt5, Texture::F_rgba, 4 },
+    { "rgtc", Texture::CM_rgtc, Texture::F_rg, 2 },
+  };
+  static const Texture::QualityLevel quality_levels[] = {
+    Texture::QL_fastest, Texture::QL_normal, Texture::QL_best,
+  };
+  static const char *const quality_names[] = {
+    "fastest", "normal", "best",
+  };
+
+  // compress_ram_image() uses this chain; we create it first, so that we can
+  // change its number of threads.
+  AsyncTaskChain *chain = AsyncParallelFor::get_task_chain("compress", num_threads);
+
+  nout << x_size << "x" << y_size << ", MB/s with 1 and " << num_threads + 1
+       << " threads:\n";
+
+  int result = 0;
+  for (const Mode &mode : modes) {
+    PTA_uchar image = make_image(mode._num_components);
+    for (int q = 0; q < 3; ++q) {
+      std::string serial, parallel;
+      chain->set_num_threads(0);
+      double serial_rate = measure(image, mode._format, mode._compression,
+                                   quality_levels[q], serial);
+      chain->set_num_threads(num_threads);
+      double parallel_rate = measure(image, mode._format, mode._compression,
+                                     quality_levels[q], parallel);
+
+      nout << "  " << std::left << std::setw(6) << mode._name
+           << std::setw(9) << quality_names[q] << std::right << std::fixed
+           << std::setprecision(1) << std::setw(8) << serial_rate
+           << std::setw(8) << parallel_rate;
+
+      // The result must not depend on the number of threads.
+      if (serial_rate == 0.0 || parallel_rate == 0.0) {
+        nout << "  (failed)";
+        result = 1;
+      } else if (serial != parallel) {
+        nout << "  (mismatch)";
+        result = 1;
+      }
+      nout << "\n";
+    }
+  }
+
+  return result;
+}
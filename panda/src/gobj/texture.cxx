@@ -42,6 +42,8 @@
 #include "streamReader.h"
 #include "texturePeeker.h"
 #include "convert_srgb.h"
+#include "bcEncoder.h"
+#include "asyncParallelFor.h"
 
 #ifdef HAVE_SQUISH
 #include <squish.h>
@@ -49,6 +51,12 @@
 
 #include <stddef.h>
 
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+#define TEXTURE_FILTER_SSE2
+#include <xmmintrin.h>
+#include <emmintrin.h>
+#endif
+
 using std::endl;
 using std::istream;
 using std::max;
@@ -5839,126 +5847,43 @@ do_compress_ram_image(CData *cdata, Texture::CompressionMode compression,
     quality_level = texture_quality_level;
   }
 
-  if (compression == CM_rgtc) {
-    // We should compress RGTC ourselves, as squish does not support it.
-    if (cdata->_component_type != T_unsigned_byte) {
-      return false;
-    }
-
-    if (!do_has_all_ram_mipmap_images(cdata)) {
-      // If we're about to compress the RAM image, we should ensure that we
-      // have all of the mipmap levels first.
-      do_generate_ram_mipmap_images(cdata, false);
-    }
-
-    RamImages compressed_ram_images;
-    compressed_ram_images.resize(cdata->_ram_images.size());
-
-    for (size_t n = 0; n < cdata->_ram_images.size(); ++n) {
-      const RamImage *uncompressed_image = &cdata->_ram_images[n];
-
-      int x_size = do_get_expected_mipmap_x_size(cdata, n);
-      int y_size = do_get_expected_mipmap_y_size(cdata, n);
-      int num_pages = do_get_expected_mipmap_num_pages(cdata, n);
-
-      // It is important that we handle image sizes that aren't a multiple of
-      // the block size, since this method may be used to compress mipmaps,
-      // which go all the way to 1x1.  Pad the image if necessary.
-      RamImage temp_image;
-      if ((x_size | y_size) & 0x3) {
-        int virtual_x_size = x_size;
-        int virtual_y_size = y_size;
-        x_size = (x_size + 3) & ~0x3;
-        y_size = (y_size + 3) & ~0x3;
-
-        temp_image._page_size = x_size * y_size * cdata->_num_components;
-        temp_image._image = PTA_uchar::empty_array(temp_image._page_size * num_pages);
-
-        for (int z = 0; z < num_pages; ++z) {
-          unsigned char *dest = temp_image._image.p() + z * temp_image._page_size;
-          unsigned const char *src = uncompressed_image->_image.p() + z * uncompressed_image->_page_size;
-
-          for (int y = 0; y < virtual_y_size; ++y) {
-            memcpy(dest, src, virtual_x_size);
-            src += virtual_x_size;
-            dest += x_size;
-          }
-        }
-
-        uncompressed_image = &temp_image;
-      }
-
-      // Create a new image to hold the compressed texture pages.
-      RamImage &compressed_image = compressed_ram_images[n];
-      compressed_image._page_size = (x_size * y_size * cdata->_num_components) >> 1;
-      compressed_image._image = PTA_uchar::empty_array(compressed_image._page_size * num_pages);
-
-      if (cdata->_num_components == 1) {
-        do_compress_ram_image_bc4(*uncompressed_image, compressed_image,
-                                  x_size, y_size, num_pages);
-      } else if (cdata->_num_components == 2) {
-        do_compress_ram_image_bc5(*uncompressed_image, compressed_image,
-                                  x_size, y_size, num_pages);
-      } else {
-        // Invalid.
-        return false;
-      }
-    }
-
-    cdata->_ram_images.swap(compressed_ram_images);
-    cdata->_ram_image_compression = CM_rgtc;
-    return true;
+  if (cdata->_component_type != T_unsigned_byte) {
+    return false;
   }
 
-#ifdef HAVE_SQUISH
-  if (cdata->_texture_type != TT_3d_texture &&
-      cdata->_texture_type != TT_2d_texture_array &&
-      cdata->_component_type == T_unsigned_byte) {
-    int squish_flags = 0;
-    switch (compression) {
-    case CM_dxt1:
-      squish_flags |= squish::kDxt1;
-      break;
-
-    case CM_dxt3:
-      squish_flags |= squish::kDxt3;
-      break;
-
-    case CM_dxt5:
-      squish_flags |= squish::kDxt5;
-      break;
-
-    default:
-      break;
+  switch (compression) {
+  case CM_dxt1:
+  case CM_dxt3:
+  case CM_dxt5:
+    if (cdata->_texture_type == TT_3d_texture ||
+        cdata->_texture_type == TT_2d_texture_array) {
+      return false;
     }
-
-    if (squish_flags != 0) {
-      // This compression mode is supported by squish; use it.
-      switch (quality_level) {
-      case QL_fastest:
-        squish_flags |= squish::kColourRangeFit;
-        break;
-
-      case QL_normal:
-        // ColourClusterFit is just too slow for everyday use.
-        squish_flags |= squish::kColourRangeFit;
-        // squish_flags |= squish::kColourClusterFit;
-        break;
-
-      case QL_best:
-        squish_flags |= squish::kColourIterativeClusterFit;
-        break;
-
-      default:
-        break;
+#ifdef HAVE_SQUISH
+    if (quality_level == QL_best) {
+      // squish's iterative cluster fit still finds better endpoints than our
+      // own encoder does, if slowly, so we let it have the best quality.
+      int squish_flags = squish::kColourIterativeClusterFit;
+      if (compression == CM_dxt1) {
+        squish_flags |= squish::kDxt1;
+      } else if (compression == CM_dxt3) {
+        squish_flags |= squish::kDxt3;
+      } else {
+        squish_flags |= squish::kDxt5;
       }
-
       if (do_squish(cdata, compression, squish_flags)) {
         return true;
       }
     }
-  }
 #endif  // HAVE_SQUISH
+    return do_compress_ram_image_bc(cdata, compression, quality_level);
+
+  case CM_rgtc:
+    return do_compress_ram_image_bc(cdata, compression, quality_level);
+
+  default:
+    break;
+  }
 
   return false;
 }
@@ -6036,261 +5961,80 @@ do_uncompress_ram_image(CData *cdata) {
 }
 
 /**
- * Compresses a RAM image using BC4 compression.
+ * Compresses the RAM images into one of the BC formats with the built-in
+ * BCEncoder.  The rows of blocks of each page are divided across the threads
+ * of the "compress" task chain (see texture-compress-num-threads).
  */
-void Texture::
-do_compress_ram_image_bc4(const RamImage &uncompressed_image,
-                          RamImage &compressed_image,
-                          int x_size, int y_size, int num_pages) {
-  int x_blocks = (x_size >> 2);
-  int y_blocks = (y_size >> 2);
+bool Texture::
+do_compress_ram_image_bc(CData *cdata, Texture::CompressionMode compression,
+                         Texture::QualityLevel quality_level) {
+  BCEncoder encoder(compression, cdata->_num_components, quality_level);
+  if (!encoder.is_valid()) {
+    return false;
+  }
 
-  // NB. This algorithm isn't fully optimal, since it doesn't try to make use
-  // of the secondary interpolation mode supported by BC4.  This is not
-  // important for most textures, but it may be added in the future.
+  if (!do_has_all_ram_mipmap_images(cdata)) {
+    // If we're about to compress the RAM image, we should ensure that we
+    // have all of the mipmap levels first.
+    do_generate_ram_mipmap_images(cdata, false);
+  }
 
-  nassertv((size_t)x_blocks * (size_t)y_blocks * 4 * 4 <= uncompressed_image._page_size);
-  nassertv((size_t)x_size * (size_t)y_size == uncompressed_image._page_size);
+  AsyncTaskChain *chain = nullptr;
+  RamImages compressed_ram_images;
+  compressed_ram_images.resize(cdata->_ram_images.size());
 
-  static const int remap[] = {1, 7, 6, 5, 4, 3, 2, 0};
+  for (size_t n = 0; n < cdata->_ram_images.size(); ++n) {
+    const RamImage &uncompressed_image = cdata->_ram_images[n];
+    int x_size = do_get_expected_mipmap_x_size(cdata, n);
+    int y_size = do_get_expected_mipmap_y_size(cdata, n);
+    int num_pages = do_get_expected_mipmap_num_pages(cdata, n);
+    nassertr((size_t)x_size * (size_t)y_size * cdata->_num_components <= uncompressed_image._page_size, false);
 
-  for (int z = 0; z < num_pages; ++z) {
-    unsigned char *dest = compressed_image._image.p() + z * compressed_image._page_size;
-    unsigned const char *src = uncompressed_image._image.p() + z * uncompressed_image._page_size;
+    RamImage &compressed_image = compressed_ram_images[n];
+    compressed_image._page_size = encoder.get_page_size(x_size, y_size);
+    compressed_image._image = PTA_uchar::empty_array(compressed_image._page_size * num_pages);
 
-    // Convert one 4 x 4 block at a time.
-    for (int y = 0; y < y_blocks; ++y) {
-      for (int x = 0; x < x_blocks; ++x) {
-        int a, b, c, d;
-        float fac, add;
-        unsigned char minv, maxv;
-        unsigned const char *blk = src;
-
-        // Find the minimum and maximum value in the block.
-        minv = blk[0];
-        maxv = blk[0];
-        minv = min(blk[1], minv); maxv = max(blk[1], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[3], minv); maxv = max(blk[3], maxv);
-        blk += x_size;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[1], minv); maxv = max(blk[1], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[3], minv); maxv = max(blk[3], maxv);
-        blk += x_size;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[1], minv); maxv = max(blk[1], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[3], minv); maxv = max(blk[3], maxv);
-        blk += x_size;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[1], minv); maxv = max(blk[1], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[3], minv); maxv = max(blk[3], maxv);
-
-        // Now calculate the index for each pixel.
-        blk = src;
-        if (maxv > minv) {
-          fac = 7.5f / (maxv - minv);
-        } else {
-          fac = 0;
+    int y_blocks = (y_size + 3) >> 2;
+    for (int z = 0; z < num_pages; ++z) {
+      CompressPage page;
+      page._encoder = &encoder;
+      page._dest = compressed_image._image.p() + z * compressed_image._page_size;
+      page._src = uncompressed_image._image.p() + z * uncompressed_image._page_size;
+      page._x_size = x_size;
+      page._y_size = y_size;
+
+      if (y_blocks < 16) {
+        // Not worth waking up the other threads for.
+        compress_rows(0, y_blocks, &page);
+      } else {
+        if (chain == nullptr) {
+          chain = AsyncParallelFor::get_task_chain("compress", texture_compress_num_threads);
         }
-        add = -minv * fac;
-        a = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[1] * fac + add)] << 3)
-          | (remap[(int)(blk[2] * fac + add)] << 6)
-          | (remap[(int)(blk[3] * fac + add)] << 9);
-        blk += x_size;
-        b = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[1] * fac + add)] << 7)
-          | (remap[(int)(blk[2] * fac + add)] << 10)
-          | (remap[(int)(blk[3] * fac + add)] << 13);
-        blk += x_size;
-        c = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[1] * fac + add)] << 3)
-          | (remap[(int)(blk[2] * fac + add)] << 6)
-          | (remap[(int)(blk[3] * fac + add)] << 9);
-        blk += x_size;
-        d = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[1] * fac + add)] << 7)
-          | (remap[(int)(blk[2] * fac + add)] << 10)
-          | (remap[(int)(blk[3] * fac + add)] << 13);
-
-        *(dest++) = maxv;
-        *(dest++) = minv;
-        *(dest++) = a & 0xff;
-        *(dest++) = (a >> 8) | (b & 0xf0);
-        *(dest++) = b >> 8;
-        *(dest++) = c & 0xff;
-        *(dest++) = (c >> 8) | (d & 0xf0);
-        *(dest++) = d >> 8;
-
-        // Advance to the beginning of the next 4x4 block.
-        src += 4;
+        // Hand out several pieces per thread, since some rows of blocks may
+        // take longer than others.
+        int num_threads = chain->get_num_threads() + 1;
+        size_t grain_size = max(1, y_blocks / (num_threads * 4));
+        AsyncParallelFor::run(chain, y_blocks, grain_size, &compress_rows, &page);
       }
-      src += x_size * 3;
+      Thread::consider_yield();
     }
-    Thread::consider_yield();
   }
+
+  cdata->_ram_images.swap(compressed_ram_images);
+  cdata->_ram_image_compression = compression;
+  return true;
 }
 
 /**
- * Compresses a RAM image using BC5 compression.
+ * The work function for do_compress_ram_image_bc().  Compresses the
+ * indicated range of rows of blocks of a page.
  */
 void Texture::
-do_compress_ram_image_bc5(const RamImage &uncompressed_image,
-                          RamImage &compressed_image,
-                          int x_size, int y_size, int num_pages) {
-  int x_blocks = (x_size >> 2);
-  int y_blocks = (y_size >> 2);
-  int stride = x_size * 2;
-
-  // BC5 uses the same compression algorithm as BC4, except repeated for two
-  // channels.
-
-  nassertv((size_t)x_blocks * (size_t)y_blocks * 4 * 4 * 2 <= uncompressed_image._page_size);
-  nassertv((size_t)stride * (size_t)y_size == uncompressed_image._page_size);
-
-  static const int remap[] = {1, 7, 6, 5, 4, 3, 2, 0};
-
-  for (int z = 0; z < num_pages; ++z) {
-    unsigned char *dest = compressed_image._image.p() + z * compressed_image._page_size;
-    unsigned const char *src = uncompressed_image._image.p() + z * uncompressed_image._page_size;
-
-    // Convert one 4 x 4 block at a time.
-    for (int y = 0; y < y_blocks; ++y) {
-      for (int x = 0; x < x_blocks; ++x) {
-        int a, b, c, d;
-        float fac, add;
-        unsigned char minv, maxv;
-        unsigned const char *blk = src;
-
-        // Find the minimum and maximum red value in the block.
-        minv = blk[0];
-        maxv = blk[0];
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-
-        // Now calculate the index for each pixel.
-        if (maxv > minv) {
-          fac = 7.5f / (maxv - minv);
-        } else {
-          fac = 0;
-        }
-        add = -minv * fac;
-        blk = src;
-        a = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[2] * fac + add)] << 3)
-          | (remap[(int)(blk[4] * fac + add)] << 6)
-          | (remap[(int)(blk[6] * fac + add)] << 9);
-        blk += stride;
-        b = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[2] * fac + add)] << 7)
-          | (remap[(int)(blk[4] * fac + add)] << 10)
-          | (remap[(int)(blk[6] * fac + add)] << 13);
-        blk += stride;
-        c = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[2] * fac + add)] << 3)
-          | (remap[(int)(blk[4] * fac + add)] << 6)
-          | (remap[(int)(blk[6] * fac + add)] << 9);
-        blk += stride;
-        d = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[2] * fac + add)] << 7)
-          | (remap[(int)(blk[4] * fac + add)] << 10)
-          | (remap[(int)(blk[6] * fac + add)] << 13);
-
-        *(dest++) = maxv;
-        *(dest++) = minv;
-        *(dest++) = a & 0xff;
-        *(dest++) = (a >> 8) | (b & 0xf0);
-        *(dest++) = b >> 8;
-        *(dest++) = c & 0xff;
-        *(dest++) = (c >> 8) | (d & 0xf0);
-        *(dest++) = d >> 8;
-
-        // Find the minimum and maximum green value in the block.
-        blk = src + 1;
-        minv = blk[0];
-        maxv = blk[0];
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-        blk += stride;
-        minv = min(blk[0], minv); maxv = max(blk[0], maxv);
-        minv = min(blk[2], minv); maxv = max(blk[2], maxv);
-        minv = min(blk[4], minv); maxv = max(blk[4], maxv);
-        minv = min(blk[6], minv); maxv = max(blk[6], maxv);
-
-        // Now calculate the index for each pixel.
-        if (maxv > minv) {
-          fac = 7.5f / (maxv - minv);
-        } else {
-          fac = 0;
-        }
-        add = -minv * fac;
-        blk = src + 1;
-        a = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[2] * fac + add)] << 3)
-          | (remap[(int)(blk[4] * fac + add)] << 6)
-          | (remap[(int)(blk[6] * fac + add)] << 9);
-        blk += stride;
-        b = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[2] * fac + add)] << 7)
-          | (remap[(int)(blk[4] * fac + add)] << 10)
-          | (remap[(int)(blk[6] * fac + add)] << 13);
-        blk += stride;
-        c = (remap[(int)(blk[0] * fac + add)])
-          | (remap[(int)(blk[2] * fac + add)] << 3)
-          | (remap[(int)(blk[4] * fac + add)] << 6)
-          | (remap[(int)(blk[6] * fac + add)] << 9);
-        blk += stride;
-        d = (remap[(int)(blk[0] * fac + add)] << 4)
-          | (remap[(int)(blk[2] * fac + add)] << 7)
-          | (remap[(int)(blk[4] * fac + add)] << 10)
-          | (remap[(int)(blk[6] * fac + add)] << 13);
-
-        *(dest++) = maxv;
-        *(dest++) = minv;
-        *(dest++) = a & 0xff;
-        *(dest++) = (a >> 8) | (b & 0xf0);
-        *(dest++) = b >> 8;
-        *(dest++) = c & 0xff;
-        *(dest++) = (c >> 8) | (d & 0xf0);
-        *(dest++) = d >> 8;
-
-        // Advance to the beginning of the next 4x4 block.
-        src += 8;
-      }
-      src += stride * 3;
-    }
-    Thread::consider_yield();
-  }
+compress_rows(size_t begin, size_t end, void *user_data) {
+  const CompressPage *page = (const CompressPage *)user_data;
+  page->_encoder->encode_rows(page->_dest, page->_src,
+                              page->_x_size, page->_y_size,
+                              (int)begin, (int)end);
 }
 
 /**
@@ -9087,8 +8831,8 @@ void Texture::
 do_filter_2d_mipmap_pages(const CData *cdata,
                           Texture::RamImage &to, const Texture::RamImage &from,
                           int x_size, int y_size) const {
-  Filter2DComponent *filter_component;
-  Filter2DComponent *filter_alpha;
+  FilterLevel level;
+  level._alpha_index = -1;
 
   if (is_srgb(cdata->_format)) {
     // We currently only support sRGB mipmap generation for unsigned byte
@@ -9096,26 +8840,32 @@ do_filter_2d_mipmap_pages(const CData *cdata,
     nassertv(cdata->_component_type == T_unsigned_byte);
 
     if (has_sse2_sRGB_encode()) {
-      filter_component = &filter_2d_unsigned_byte_srgb_sse2;
+      level._filter_row = &filter_row_unsigned_byte_srgb_sse2;
     } else {
-      filter_component = &filter_2d_unsigned_byte_srgb;
+      level._filter_row = &filter_row_unsigned_byte_srgb;
     }
 
     // Alpha is always linear.
-    filter_alpha = &filter_2d_unsigned_byte;
+    if (has_alpha(cdata->_format)) {
+      level._alpha_index = cdata->_num_components - 1;
+    }
 
   } else {
     switch (cdata->_component_type) {
     case T_unsigned_byte:
-      filter_component = &filter_2d_unsigned_byte;
+      level._filter_row = &filter_row_unsigned_byte;
       break;
 
     case T_unsigned_short:
-      filter_component = &filter_2d_unsigned_short;
+      level._filter_row = &filter_row_unsigned_short;
       break;
 
     case T_float:
-      filter_component = &filter_2d_float;
+      level._filter_row = &filter_row_float;
+      break;
+
+    case T_half_float:
+      level._filter_row = &filter_row_half_float;
       break;
 
     default:
@@ -9124,7 +8874,6 @@ do_filter_2d_mipmap_pages(const CData *cdata,
         << cdata->_component_type << "!";
       return;
     }
-    filter_alpha = filter_component;
   }
 
   size_t pixel_size = cdata->_num_components * cdata->_component_width;
@@ -9137,93 +8886,27 @@ do_filter_2d_mipmap_pages(const CData *cdata,
   to._page_size = (size_t)to_y_size * to_row_size;
   to._image = PTA_uchar::empty_array(to._page_size * cdata->_z_size * cdata->_num_views, get_class_type());
 
-  bool alpha = has_alpha(cdata->_format);
-  int num_color_components = cdata->_num_components;
-  if (alpha) {
-    --num_color_components;
-  }
-
-  int num_pages = cdata->_z_size * cdata->_num_views;
-  for (int z = 0; z < num_pages; ++z) {
-    // For each level.
-    unsigned char *p = to._image.p() + z * to._page_size;
-    nassertv(p <= to._image.p() + to._image.size() + to._page_size);
-    const unsigned char *q = from._image.p() + z * from._page_size;
-    nassertv(q <= from._image.p() + from._image.size() + from._page_size);
-    if (y_size != 1) {
-      int y;
-      for (y = 0; y < y_size - 1; y += 2) {
-        // For each row.
-        nassertv(p == to._image.p() + z * to._page_size + (y / 2) * to_row_size);
-        nassertv(q == from._image.p() + z * from._page_size + y * row_size);
-        if (x_size != 1) {
-          int x;
-          for (x = 0; x < x_size - 1; x += 2) {
-            // For each pixel.
-            for (int c = 0; c < num_color_components; ++c) {
-              // For each component.
-              filter_component(p, q, pixel_size, row_size);
-            }
-            if (alpha) {
-              filter_alpha(p, q, pixel_size, row_size);
-            }
-            q += pixel_size;
-          }
-          if (x < x_size) {
-            // Skip the last odd pixel.
-            q += pixel_size;
-          }
-        } else {
-          // Just one pixel.
-          for (int c = 0; c < num_color_components; ++c) {
-            // For each component.
-            filter_component(p, q, 0, row_size);
-          }
-          if (alpha) {
-            filter_alpha(p, q, 0, row_size);
-          }
-        }
-        q += row_size;
-        Thread::consider_yield();
-      }
-      if (y < y_size) {
-        // Skip the last odd row.
-        q += row_size;
-      }
-    } else {
-      // Just one row.
-      if (x_size != 1) {
-        int x;
-        for (x = 0; x < x_size - 1; x += 2) {
-          // For each pixel.
-          for (int c = 0; c < num_color_components; ++c) {
-            // For each component.
-            filter_component(p, q, pixel_size, 0);
-          }
-          if (alpha) {
-            filter_alpha(p, q, pixel_size, 0);
-          }
-          q += pixel_size;
-        }
-        if (x < x_size) {
-          // Skip the last odd pixel.
-          q += pixel_size;
-        }
-      } else {
-        // Just one pixel.
-        for (int c = 0; c < num_color_components; ++c) {
-          // For each component.
-          filter_component(p, q, 0, 0);
-        }
-        if (alpha) {
-          filter_alpha(p, q, pixel_size, 0);
-        }
-      }
-    }
-
-    nassertv(p == to._image.p() + (z + 1) * to._page_size);
-    nassertv(q == from._image.p() + (z + 1) * from._page_size);
-  }
+  // Each page is filtered as though it were a separate 3-D texture of depth
+  // 1.  The last odd row or pixel, if any, is skipped.
+  level._to = to._image.p();
+  level._from = from._image.p();
+  level._num_components = cdata->_num_components;
+  level._num_rows = 2;
+  level._num_views = cdata->_z_size * cdata->_num_views;
+  level._x_size = x_size;
+  level._to_x_size = to_x_size;
+  level._to_y_size = to_y_size;
+  level._to_z_size = 1;
+  level._x_step = (x_size != 1) ? cdata->_num_components : 0;
+  level._next_row = (y_size != 1) ? row_size : 0;
+  level._next_page = 0;
+  level._row_size = row_size;
+  level._page_size = from._page_size;
+  level._view_size = from._page_size;
+  level._to_row_size = to_row_size;
+  nassertv(from._image.size() >= from._page_size * level._num_views);
+
+  do_filter_mipmap_rows(level);
 }
 
 /**
@@ -9239,8 +8922,8 @@ void Texture::
 do_filter_3d_mipmap_level(const CData *cdata,
                           Texture::RamImage &to, const Texture::RamImage &from,
                           int x_size, int y_size, int z_size) const {
-  Filter3DComponent *filter_component;
-  Filter3DComponent *filter_alpha;
+  FilterLevel level;
+  level._alpha_index = -1;
 
   if (is_srgb(cdata->_format)) {
     // We currently only support sRGB mipmap generation for unsigned byte
@@ -9248,26 +8931,32 @@ do_filter_3d_mipmap_level(const CData *cdata,
     nassertv(cdata->_component_type == T_unsigned_byte);
 
     if (has_sse2_sRGB_encode()) {
-      filter_component = &filter_3d_unsigned_byte_srgb_sse2;
+      level._filter_row = &filter_row_unsigned_byte_srgb_sse2;
     } else {
-      filter_component = &filter_3d_unsigned_byte_srgb;
+      level._filter_row = &filter_row_unsigned_byte_srgb;
     }
 
     // Alpha is always linear.
-    filter_alpha = &filter_3d_unsigned_byte;
+    if (has_alpha(cdata->_format)) {
+      level._alpha_index = cdata->_num_components - 1;
+    }
 
   } else {
     switch (cdata->_component_type) {
     case T_unsigned_byte:
-      filter_component = &filter_3d_unsigned_byte;
+      level._filter_row = &filter_row_unsigned_byte;
       break;
 
     case T_unsigned_short:
-      filter_component = &filter_3d_unsigned_short;
+      level._filter_row = &filter_row_unsigned_short;
       break;
 
     case T_float:
-      filter_component = &filter_3d_float;
+      level._filter_row = &filter_row_float;
+      break;
+
+    case T_half_float:
+      level._filter_row = &filter_row_half_float;
       break;
 
     default:
@@ -9276,7 +8965,6 @@ do_filter_3d_mipmap_level(const CData *cdata,
         << cdata->_component_type << "!";
       return;
     }
-    filter_alpha = filter_component;
   }
 
   size_t pixel_size = cdata->_num_components * cdata->_component_width;
@@ -9290,368 +8978,549 @@ do_filter_3d_mipmap_level(const CData *cdata,
 
   size_t to_row_size = (size_t)to_x_size * pixel_size;
   size_t to_page_size = (size_t)to_y_size * to_row_size;
-  size_t to_view_size = (size_t)to_z_size * to_page_size;
   to._page_size = to_page_size;
   to._image = PTA_uchar::empty_array(to_page_size * to_z_size * cdata->_num_views, get_class_type());
 
-  bool alpha = has_alpha(cdata->_format);
-  int num_color_components = cdata->_num_components;
-  if (alpha) {
-    --num_color_components;
-  }
-
-  for (int view = 0; view < cdata->_num_views; ++view) {
-    unsigned char *start_to = to._image.p() + view * to_view_size;
-    const unsigned char *start_from = from._image.p() + view * view_size;
-    nassertv(start_to + to_view_size <= to._image.p() + to._image.size());
-    nassertv(start_from + view_size <= from._image.p() + from._image.size());
-    unsigned char *p = start_to;
-    const unsigned char *q = start_from;
-    if (z_size != 1) {
-      int z;
-      for (z = 0; z < z_size - 1; z += 2) {
-        // For each level.
-        nassertv(p == start_to + (z / 2) * to_page_size);
-        nassertv(q == start_from + z * page_size);
-        if (y_size != 1) {
-          int y;
-          for (y = 0; y < y_size - 1; y += 2) {
-            // For each row.
-            nassertv(p == start_to + (z / 2) * to_page_size + (y / 2) * to_row_size);
-            nassertv(q == start_from + z * page_size + y * row_size);
-            if (x_size != 1) {
-              int x;
-              for (x = 0; x < x_size - 1; x += 2) {
-                // For each pixel.
-                for (int c = 0; c < num_color_components; ++c) {
-                  // For each component.
-                  filter_component(p, q, pixel_size, row_size, page_size);
-                }
-                if (alpha) {
-                  filter_alpha(p, q, pixel_size, row_size, page_size);
-                }
-                q += pixel_size;
-              }
-              if (x < x_size) {
-                // Skip the last odd pixel.
-                q += pixel_size;
-              }
-            } else {
-              // Just one pixel.
-              for (int c = 0; c < num_color_components; ++c) {
-                // For each component.
-                filter_component(p, q, 0, row_size, page_size);
-              }
-              if (alpha) {
-                filter_alpha(p, q, 0, row_size, page_size);
-              }
-            }
-            q += row_size;
-            Thread::consider_yield();
-          }
-          if (y < y_size) {
-            // Skip the last odd row.
-            q += row_size;
-          }
-        } else {
-          // Just one row.
-          if (x_size != 1) {
-            int x;
-            for (x = 0; x < x_size - 1; x += 2) {
-              // For each pixel.
-              for (int c = 0; c < num_color_components; ++c) {
-                // For each component.
-                filter_component(p, q, pixel_size, 0, page_size);
-              }
-              if (alpha) {
-                filter_alpha(p, q, pixel_size, 0, page_size);
-              }
-              q += pixel_size;
-            }
-            if (x < x_size) {
-              // Skip the last odd pixel.
-              q += pixel_size;
-            }
-          } else {
-            // Just one pixel.
-            for (int c = 0; c < num_color_components; ++c) {
-              // For each component.
-              filter_component(p, q, 0, 0, page_size);
-            }
-            if (alpha) {
-              filter_alpha(p, q, 0, 0, page_size);
-            }
-          }
-        }
-        q += page_size;
-      }
-      if (z < z_size) {
-        // Skip the last odd page.
-        q += page_size;
-      }
-    } else {
-      // Just one page.
-      if (y_size != 1) {
-        int y;
-        for (y = 0; y < y_size - 1; y += 2) {
-          // For each row.
-          nassertv(p == start_to + (y / 2) * to_row_size);
-          nassertv(q == start_from + y * row_size);
-          if (x_size != 1) {
-            int x;
-            for (x = 0; x < x_size - 1; x += 2) {
-              // For each pixel.
-              for (int c = 0; c < num_color_components; ++c) {
-                // For each component.
-                filter_component(p, q, pixel_size, row_size, 0);
-              }
-              if (alpha) {
-                filter_alpha(p, q, pixel_size, row_size, 0);
-              }
-              q += pixel_size;
-            }
-            if (x < x_size) {
-              // Skip the last odd pixel.
-              q += pixel_size;
-            }
-          } else {
-            // Just one pixel.
-            for (int c = 0; c < num_color_components; ++c) {
-              // For each component.
-              filter_component(p, q, 0, row_size, 0);
-            }
-            if (alpha) {
-              filter_alpha(p, q, 0, row_size, 0);
-            }
-          }
-          q += row_size;
-          Thread::consider_yield();
-        }
-        if (y < y_size) {
-          // Skip the last odd row.
-          q += row_size;
-        }
-      } else {
-        // Just one row.
-        if (x_size != 1) {
-          int x;
-          for (x = 0; x < x_size - 1; x += 2) {
-            // For each pixel.
-            for (int c = 0; c < num_color_components; ++c) {
-              // For each component.
-              filter_component(p, q, pixel_size, 0, 0);
-            }
-            if (alpha) {
-              filter_alpha(p, q, pixel_size, 0, 0);
-            }
-            q += pixel_size;
-          }
-          if (x < x_size) {
-            // Skip the last odd pixel.
-            q += pixel_size;
-          }
-        } else {
-          // Just one pixel.
-          for (int c = 0; c < num_color_components; ++c) {
-            // For each component.
-            filter_component(p, q, 0, 0, 0);
-          }
-          if (alpha) {
-            filter_alpha(p, q, 0, 0, 0);
-          }
-        }
-      }
-    }
+  // The last odd page, row or pixel, if any, is skipped.
+  level._to = to._image.p();
+  level._from = from._image.p();
+  level._num_components = cdata->_num_components;
+  level._num_rows = (z_size != 1) ? 4 : 2;
+  level._num_views = cdata->_num_views;
+  level._x_size = x_size;
+  level._to_x_size = to_x_size;
+  level._to_y_size = to_y_size;
+  level._to_z_size = to_z_size;
+  level._x_step = (x_size != 1) ? cdata->_num_components : 0;
+  level._next_row = (y_size != 1) ? row_size : 0;
+  level._next_page = (z_size != 1) ? page_size : 0;
+  level._row_size = row_size;
+  level._page_size = page_size;
+  level._view_size = view_size;
+  level._to_row_size = to_row_size;
+  nassertv(from._image.size() >= view_size * cdata->_num_views);
+
+  do_filter_mipmap_rows(level);
+}
+
+/**
+ * Fills in all of the rows of the indicated mipmap level.  Large levels are
+ * divided across the threads of the "mipmap" task chain (see
+ * texture-mipmap-num-threads).
+ */
+void Texture::
+do_filter_mipmap_rows(const FilterLevel &level) {
+  size_t num_rows = (size_t)level._num_views * level._to_z_size * level._to_y_size;
 
-    nassertv(p == start_to + to_z_size * to_page_size);
-    nassertv(q == start_from + z_size * page_size);
+  if (num_rows < 8 || num_rows * level._to_row_size < 65536) {
+    // Not worth waking up the other threads for.
+    filter_mipmap_rows(0, num_rows, (void *)&level);
+    return;
   }
+
+  AsyncTaskChain *chain = AsyncParallelFor::get_task_chain("mipmap", texture_mipmap_num_threads);
+  int num_threads = chain->get_num_threads() + 1;
+  size_t grain_size = max((size_t)1, num_rows / (num_threads * 4));
+  AsyncParallelFor::run(chain, num_rows, grain_size, &filter_mipmap_rows, (void *)&level);
 }
 
 /**
- * Averages a 2x2 block of pixel components into a single pixel component, for
- * producing the next mipmap level.  Increments p and q to the next component.
+ * The work function for do_filter_mipmap_rows().  Fills in the indicated
+ * range of rows of the new level, counting across all of its pages and
+ * views.
  */
 void Texture::
-filter_2d_unsigned_byte(unsigned char *&p, const unsigned char *&q,
-                        size_t pixel_size, size_t row_size) {
-  unsigned int result = ((unsigned int)q[0] +
-                         (unsigned int)q[pixel_size] +
-                         (unsigned int)q[row_size] +
-                         (unsigned int)q[pixel_size + row_size]) >> 2;
-  *p = (unsigned char)result;
-  ++p;
-  ++q;
+filter_mipmap_rows(size_t begin, size_t end, void *user_data) {
+  const FilterLevel *level = (const FilterLevel *)user_data;
+
+  // Room for one row of sums, which take at most four bytes per component.
+  pvector<uint32_t> temp((size_t)level->_x_size * level->_num_components);
+
+  size_t rows_per_view = (size_t)level->_to_z_size * level->_to_y_size;
+  for (size_t n = begin; n < end; ++n) {
+    size_t view = n / rows_per_view;
+    size_t z = (n % rows_per_view) / level->_to_y_size;
+    size_t y = n % level->_to_y_size;
+
+    const unsigned char *q[4];
+    q[0] = level->_from + view * level->_view_size +
+      z * 2 * level->_page_size + y * 2 * level->_row_size;
+    q[1] = q[0] + level->_next_row;
+    q[2] = q[0] + level->_next_page;
+    q[3] = q[2] + level->_next_row;
+
+    level->_filter_row(level->_to + n * level->_to_row_size, q, level, &temp[0]);
+    Thread::consider_yield();
+  }
 }
 
 /**
- * Averages a 2x2 block of pixel components into a single pixel component, for
- * producing the next mipmap level.  Increments p and q to the next component.
+ * Adds together the corresponding components of the first num_rows of the
+ * indicated rows of unsigned bytes.
  */
-void Texture::
-filter_2d_unsigned_byte_srgb(unsigned char *&p, const unsigned char *&q,
-                             size_t pixel_size, size_t row_size) {
-  float result = (decode_sRGB_float(q[0]) +
-                  decode_sRGB_float(q[pixel_size]) +
-                  decode_sRGB_float(q[row_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size]));
+static void
+sum_rows_unsigned_byte(uint16_t *sum, const unsigned char *const q[4],
+                       int num_rows, size_t count) {
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= count; i += 16) {
+    __m128i lo = zero;
+    __m128i hi = zero;
+    for (int r = 0; r < num_rows; ++r) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(q[r] + i));
+      lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(v, zero));
+      hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(v, zero));
+    }
+    _mm_storeu_si128((__m128i *)(sum + i), lo);
+    _mm_storeu_si128((__m128i *)(sum + i + 8), hi);
+  }
+#endif
+  for (; i < count; ++i) {
+    unsigned int result = 0;
+    for (int r = 0; r < num_rows; ++r) {
+      result += q[r][i];
+    }
+    sum[i] = (uint16_t)result;
+  }
+}
 
-  *p = encode_sRGB_uchar(result * 0.25f);
-  ++p;
-  ++q;
+/**
+ * Adds together the corresponding components of the first num_rows of the
+ * indicated rows of unsigned shorts.
+ */
+static void
+sum_rows_unsigned_short(uint32_t *sum, const unsigned char *const q[4],
+                        int num_rows, size_t count) {
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= count; i += 8) {
+    __m128i lo = zero;
+    __m128i hi = zero;
+    for (int r = 0; r < num_rows; ++r) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(q[r] + i * 2));
+      lo = _mm_add_epi32(lo, _mm_unpacklo_epi16(v, zero));
+      hi = _mm_add_epi32(hi, _mm_unpackhi_epi16(v, zero));
+    }
+    _mm_storeu_si128((__m128i *)(sum + i), lo);
+    _mm_storeu_si128((__m128i *)(sum + i + 4), hi);
+  }
+#endif
+  for (; i < count; ++i) {
+    uint32_t result = 0;
+    for (int r = 0; r < num_rows; ++r) {
+      result += ((const uint16_t *)q[r])[i];
+    }
+    sum[i] = result;
+  }
 }
 
 /**
- * Averages a 2x2 block of pixel components into a single pixel component, for
- * producing the next mipmap level.  Increments p and q to the next component.
+ * Adds together the corresponding components of the first num_rows of the
+ * indicated rows of floats.
  */
-void Texture::
-filter_2d_unsigned_byte_srgb_sse2(unsigned char *&p, const unsigned char *&q,
-                                  size_t pixel_size, size_t row_size) {
-  float result = (decode_sRGB_float(q[0]) +
-                  decode_sRGB_float(q[pixel_size]) +
-                  decode_sRGB_float(q[row_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size]));
+static void
+sum_rows_float(float *sum, const unsigned char *const q[4],
+               int num_rows, size_t count) {
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  for (; i + 4 <= count; i += 4) {
+    __m128 result = _mm_loadu_ps((const float *)q[0] + i);
+    for (int r = 1; r < num_rows; ++r) {
+      result = _mm_add_ps(result, _mm_loadu_ps((const float *)q[r] + i));
+    }
+    _mm_storeu_ps(sum + i, result);
+  }
+#endif
+  for (; i < count; ++i) {
+    float result = ((const float *)q[0])[i];
+    for (int r = 1; r < num_rows; ++r) {
+      result += ((const float *)q[r])[i];
+    }
+    sum[i] = result;
+  }
+}
 
-  *p = encode_sRGB_uchar_sse2(result * 0.25f);
-  ++p;
-  ++q;
+/**
+ * Converts the indicated half-float to a float, treating denormals as zero,
+ * like get_half_float().
+ */
+static float
+decode_half_float(uint16_t in) {
+  union {
+    uint32_t ui;
+    float uf;
+  } v;
+  uint32_t t1 = in & 0x7fff; // Non-sign bits
+  uint32_t t2 = in & 0x8000; // Sign bit
+  uint32_t t3 = in & 0x7c00; // Exponent
+  t1 <<= 13; // Align mantissa on MSB
+  t2 <<= 16; // Shift sign bit into position
+  if (t3 != 0x7c00) {
+    t1 += 0x38000000; // Adjust bias
+    t1 = (t3 == 0 ? 0 : t1); // Denormals-as-zero
+  } else {
+    // Infinity / NaN
+    t1 |= 0x7f800000;
+  }
+  v.ui = t1 | t2;
+  return v.uf;
+}
+
+/**
+ * Adds together the corresponding components of the first num_rows of the
+ * indicated rows of half-floats.
+ */
+static void
+sum_rows_half_float(float *sum, const unsigned char *const q[4],
+                    int num_rows, size_t count) {
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i mantissa_mask = _mm_set1_epi32(0x7fff);
+  const __m128i sign_mask = _mm_set1_epi32(0x8000);
+  const __m128i exponent_mask = _mm_set1_epi32(0x7c00);
+  const __m128i bias = _mm_set1_epi32(0x38000000);
+  const __m128i inf = _mm_set1_epi32(0x7f800000);
+  for (; i + 4 <= count; i += 4) {
+    __m128 result = _mm_setzero_ps();
+    for (int r = 0; r < num_rows; ++r) {
+      __m128i h = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(q[r] + i * 2)), zero);
+      __m128i t1 = _mm_slli_epi32(_mm_and_si128(h, mantissa_mask), 13);
+      __m128i t2 = _mm_slli_epi32(_mm_and_si128(h, sign_mask), 16);
+      __m128i t3 = _mm_and_si128(h, exponent_mask);
+      __m128i is_special = _mm_cmpeq_epi32(t3, exponent_mask);
+      __m128i is_zero = _mm_cmpeq_epi32(t3, zero);
+      __m128i v = _mm_or_si128(_mm_and_si128(is_special, _mm_or_si128(t1, inf)),
+                               _mm_andnot_si128(is_special, _mm_add_epi32(t1, bias)));
+      v = _mm_or_si128(_mm_andnot_si128(is_zero, v), t2);
+      result = _mm_add_ps(result, _mm_castsi128_ps(v));
+    }
+    _mm_storeu_ps(sum + i, result);
+  }
+#endif
+  for (; i < count; ++i) {
+    float result = 0.0f;
+    for (int r = 0; r < num_rows; ++r) {
+      result += decode_half_float(((const uint16_t *)q[r])[i]);
+    }
+    sum[i] = result;
+  }
 }
 
 /**
- * Averages a 2x2 block of pixel components into a single pixel component, for
- * producing the next mipmap level.  Increments p and q to the next component.
+ * Converts the indicated float to the nearest half-float.  Values too small
+ * to be represented as a normalized half-float are flushed to zero.
  */
-void Texture::
-filter_2d_unsigned_short(unsigned char *&p, const unsigned char *&q,
-                         size_t pixel_size, size_t row_size) {
-  unsigned int result = ((unsigned int)*(unsigned short *)&q[0] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size] +
-                         (unsigned int)*(unsigned short *)&q[row_size] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size + row_size]) >> 2;
-  store_unscaled_short(p, result);
-  q += 2;
+static uint16_t
+encode_half_float(float value) {
+  union {
+    uint32_t ui;
+    float uf;
+  } v;
+  v.uf = value;
+  uint32_t sign = (v.ui >> 16) & 0x8000;
+  uint32_t bits = v.ui & 0x7fffffff;
+  if (bits >= 0x7f800000) {
+    // Infinity / NaN
+    return (uint16_t)(sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 : 0));
+  }
+  if (bits >= 0x47800000) {
+    // Too large; becomes infinity.
+    return (uint16_t)(sign | 0x7c00);
+  }
+  if (bits < 0x38800000) {
+    return (uint16_t)sign;
+  }
+  // Adjust the bias, and round to nearest even.
+  bits = (bits - 0x38000000 + 0xfff + ((bits >> 13) & 1)) >> 13;
+  return (uint16_t)(sign | bits);
 }
 
 /**
- * Averages a 2x2 block of pixel components into a single pixel component, for
- * producing the next mipmap level.  Increments p and q to the next component.
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.
  */
 void Texture::
-filter_2d_float(unsigned char *&p, const unsigned char *&q,
-                size_t pixel_size, size_t row_size) {
-  *(float *)p = (*(float *)&q[0] +
-                 *(float *)&q[pixel_size] +
-                 *(float *)&q[row_size] +
-                 *(float *)&q[pixel_size + row_size]) / 4.0f;
-  p += 4;
-  q += 4;
+filter_row_unsigned_byte(unsigned char *p, const unsigned char *const q[4],
+                         const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  uint16_t *sum = (uint16_t *)temp;
+  sum_rows_unsigned_byte(sum, q, level->_num_rows, (size_t)level->_x_size * num_components);
+
+  int shift = (level->_num_rows == 4) ? 3 : 2;
+  int x_step = level->_x_step;
+  size_t count = (size_t)level->_to_x_size * num_components;
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  if (x_step == 4) {
+    // Two new pixels of four components at a time.
+    __m128i sh = _mm_cvtsi32_si128(shift);
+    for (; i + 8 <= count; i += 8) {
+      __m128i a = _mm_loadu_si128((const __m128i *)(sum + i * 2));
+      __m128i b = _mm_loadu_si128((const __m128i *)(sum + i * 2 + 8));
+      __m128i s = _mm_add_epi16(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+      s = _mm_srl_epi16(s, sh);
+      _mm_storel_epi64((__m128i *)(p + i), _mm_packus_epi16(s, s));
+    }
+  }
+#endif
+  const uint16_t *s = sum + i * 2;
+  for (; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      p[i + c] = (unsigned char)((s[c] + s[c + x_step]) >> shift);
+    }
+    s += num_components * 2;
+  }
 }
 
 /**
- * Averages a 2x2x2 block of pixel components into a single pixel component,
- * for producing the next mipmap level.  Increments p and q to the next
- * component.
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.  The color components are averaged in
+ * linear space.
  */
 void Texture::
-filter_3d_unsigned_byte(unsigned char *&p, const unsigned char *&q,
-                        size_t pixel_size, size_t row_size, size_t page_size) {
-  unsigned int result = ((unsigned int)q[0] +
-                         (unsigned int)q[pixel_size] +
-                         (unsigned int)q[row_size] +
-                         (unsigned int)q[pixel_size + row_size] +
-                         (unsigned int)q[page_size] +
-                         (unsigned int)q[pixel_size + page_size] +
-                         (unsigned int)q[row_size + page_size] +
-                         (unsigned int)q[pixel_size + row_size + page_size]) >> 3;
-  *p = (unsigned char)result;
-  ++p;
-  ++q;
-}
-
-/**
- * Averages a 2x2x2 block of pixel components into a single pixel component,
- * for producing the next mipmap level.  Increments p and q to the next
- * component.
+filter_row_unsigned_byte_srgb(unsigned char *p, const unsigned char *const q[4],
+                              const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  int alpha_index = level->_alpha_index;
+  int num_rows = level->_num_rows;
+  float *sum = (float *)temp;
+
+  float *s = sum;
+  size_t count = (size_t)level->_x_size * num_components;
+  for (size_t i = 0; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      float result = 0.0f;
+      if (c == alpha_index) {
+        for (int r = 0; r < num_rows; ++r) {
+          result += (float)q[r][i + c];
+        }
+      } else {
+        for (int r = 0; r < num_rows; ++r) {
+          result += decode_sRGB_float(q[r][i + c]);
+        }
+      }
+      s[c] = result;
+    }
+    s += num_components;
+  }
+
+  int shift = (num_rows == 4) ? 3 : 2;
+  float scale = (num_rows == 4) ? 0.125f : 0.25f;
+  int x_step = level->_x_step;
+  count = (size_t)level->_to_x_size * num_components;
+  s = sum;
+  for (size_t i = 0; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      float result = s[c] + s[c + x_step];
+      if (c == alpha_index) {
+        p[i + c] = (unsigned char)((unsigned int)result >> shift);
+      } else {
+        p[i + c] = encode_sRGB_uchar(result * scale);
+      }
+    }
+    s += num_components * 2;
+  }
+}
+
+/**
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.  The color components are averaged in
+ * linear space.
  */
 void Texture::
-filter_3d_unsigned_byte_srgb(unsigned char *&p, const unsigned char *&q,
-                             size_t pixel_size, size_t row_size, size_t page_size) {
-  float result = (decode_sRGB_float(q[0]) +
-                  decode_sRGB_float(q[pixel_size]) +
-                  decode_sRGB_float(q[row_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size]) +
-                  decode_sRGB_float(q[page_size]) +
-                  decode_sRGB_float(q[pixel_size + page_size]) +
-                  decode_sRGB_float(q[row_size + page_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size + page_size]));
+filter_row_unsigned_byte_srgb_sse2(unsigned char *p, const unsigned char *const q[4],
+                                   const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  int alpha_index = level->_alpha_index;
+  int num_rows = level->_num_rows;
+  float *sum = (float *)temp;
+
+  float *s = sum;
+  size_t count = (size_t)level->_x_size * num_components;
+  for (size_t i = 0; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      float result = 0.0f;
+      if (c == alpha_index) {
+        for (int r = 0; r < num_rows; ++r) {
+          result += (float)q[r][i + c];
+        }
+      } else {
+        for (int r = 0; r < num_rows; ++r) {
+          result += decode_sRGB_float(q[r][i + c]);
+        }
+      }
+      s[c] = result;
+    }
+    s += num_components;
+  }
 
-  *p = encode_sRGB_uchar(result * 0.125f);
-  ++p;
-  ++q;
+  int shift = (num_rows == 4) ? 3 : 2;
+  float scale = (num_rows == 4) ? 0.125f : 0.25f;
+  int x_step = level->_x_step;
+  count = (size_t)level->_to_x_size * num_components;
+  s = sum;
+  for (size_t i = 0; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      float result = s[c] + s[c + x_step];
+      if (c == alpha_index) {
+        p[i + c] = (unsigned char)((unsigned int)result >> shift);
+      } else {
+        p[i + c] = encode_sRGB_uchar_sse2(result * scale);
+      }
+    }
+    s += num_components * 2;
+  }
 }
 
 /**
- * Averages a 2x2x2 block of pixel components into a single pixel component,
- * for producing the next mipmap level.  Increments p and q to the next
- * component.
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.
  */
 void Texture::
-filter_3d_unsigned_byte_srgb_sse2(unsigned char *&p, const unsigned char *&q,
-                                  size_t pixel_size, size_t row_size, size_t page_size) {
-  float result = (decode_sRGB_float(q[0]) +
-                  decode_sRGB_float(q[pixel_size]) +
-                  decode_sRGB_float(q[row_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size]) +
-                  decode_sRGB_float(q[page_size]) +
-                  decode_sRGB_float(q[pixel_size + page_size]) +
-                  decode_sRGB_float(q[row_size + page_size]) +
-                  decode_sRGB_float(q[pixel_size + row_size + page_size]));
-
-  *p = encode_sRGB_uchar_sse2(result * 0.125f);
-  ++p;
-  ++q;
+filter_row_unsigned_short(unsigned char *p, const unsigned char *const q[4],
+                          const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  uint32_t *sum = (uint32_t *)temp;
+  sum_rows_unsigned_short(sum, q, level->_num_rows, (size_t)level->_x_size * num_components);
+
+  int shift = (level->_num_rows == 4) ? 3 : 2;
+  int x_step = level->_x_step;
+  uint16_t *out = (uint16_t *)p;
+  size_t count = (size_t)level->_to_x_size * num_components;
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  if (x_step == 4) {
+    // Two new pixels of four components at a time.  There is no unsigned
+    // saturating pack in SSE2, so the results are offset into signed range.
+    __m128i sh = _mm_cvtsi32_si128(shift);
+    const __m128i offset = _mm_set1_epi32(0x8000);
+    const __m128i offset16 = _mm_set1_epi16((short)0x8000);
+    for (; i + 8 <= count; i += 8) {
+      const __m128i *src = (const __m128i *)(sum + i * 2);
+      __m128i s0 = _mm_add_epi32(_mm_loadu_si128(src), _mm_loadu_si128(src + 1));
+      __m128i s1 = _mm_add_epi32(_mm_loadu_si128(src + 2), _mm_loadu_si128(src + 3));
+      s0 = _mm_sub_epi32(_mm_srl_epi32(s0, sh), offset);
+      s1 = _mm_sub_epi32(_mm_srl_epi32(s1, sh), offset);
+      __m128i result = _mm_xor_si128(_mm_packs_epi32(s0, s1), offset16);
+      _mm_storeu_si128((__m128i *)(out + i), result);
+    }
+  }
+#endif
+  const uint32_t *s = sum + i * 2;
+  for (; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      out[i + c] = (uint16_t)((s[c] + s[c + x_step]) >> shift);
+    }
+    s += num_components * 2;
+  }
 }
 
 /**
- * Averages a 2x2x2 block of pixel components into a single pixel component,
- * for producing the next mipmap level.  Increments p and q to the next
- * component.
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.
  */
 void Texture::
-filter_3d_unsigned_short(unsigned char *&p, const unsigned char *&q,
-                         size_t pixel_size, size_t row_size,
-                         size_t page_size) {
-  unsigned int result = ((unsigned int)*(unsigned short *)&q[0] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size] +
-                         (unsigned int)*(unsigned short *)&q[row_size] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size + row_size] +
-                         (unsigned int)*(unsigned short *)&q[page_size] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size + page_size] +
-                         (unsigned int)*(unsigned short *)&q[row_size + page_size] +
-                         (unsigned int)*(unsigned short *)&q[pixel_size + row_size + page_size]) >> 3;
-  store_unscaled_short(p, result);
-  q += 2;
-}
-
-/**
- * Averages a 2x2x2 block of pixel components into a single pixel component,
- * for producing the next mipmap level.  Increments p and q to the next
- * component.
+filter_row_float(unsigned char *p, const unsigned char *const q[4],
+                 const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  float *sum = (float *)temp;
+  sum_rows_float(sum, q, level->_num_rows, (size_t)level->_x_size * num_components);
+
+  float scale = (level->_num_rows == 4) ? 0.125f : 0.25f;
+  int x_step = level->_x_step;
+  float *out = (float *)p;
+  size_t count = (size_t)level->_to_x_size * num_components;
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  if (x_step == 4) {
+    __m128 sc = _mm_set1_ps(scale);
+    for (; i + 4 <= count; i += 4) {
+      __m128 s = _mm_add_ps(_mm_loadu_ps(sum + i * 2), _mm_loadu_ps(sum + i * 2 + 4));
+      _mm_storeu_ps(out + i, _mm_mul_ps(s, sc));
+    }
+  }
+#endif
+  const float *s = sum + i * 2;
+  for (; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      out[i + c] = (s[c] + s[c + x_step]) * scale;
+    }
+    s += num_components * 2;
+  }
+}
+
+/**
+ * Averages the indicated rows of the previous level into a row of the next
+ * mipmap level, each component of each new pixel being the average of a 2x2
+ * or 2x2x2 block of the previous level.
  */
 void Texture::
-filter_3d_float(unsigned char *&p, const unsigned char *&q,
-                size_t pixel_size, size_t row_size, size_t page_size) {
-  *(float *)p = (*(float *)&q[0] +
-                 *(float *)&q[pixel_size] +
-                 *(float *)&q[row_size] +
-                 *(float *)&q[pixel_size + row_size] +
-                 *(float *)&q[page_size] +
-                 *(float *)&q[pixel_size + page_size] +
-                 *(float *)&q[row_size + page_size] +
-                 *(float *)&q[pixel_size + row_size + page_size]) / 8.0f;
-  p += 4;
-  q += 4;
+filter_row_half_float(unsigned char *p, const unsigned char *const q[4],
+                      const FilterLevel *level, void *temp) {
+  int num_components = level->_num_components;
+  float *sum = (float *)temp;
+  sum_rows_half_float(sum, q, level->_num_rows, (size_t)level->_x_size * num_components);
+
+  float scale = (level->_num_rows == 4) ? 0.125f : 0.25f;
+  int x_step = level->_x_step;
+  size_t count = (size_t)level->_to_x_size * num_components;
+
+  // The averages are written back to the front of the sum buffer, which is
+  // safe since each one only depends on sums at or past its own index.
+  const float *s = sum;
+  for (size_t i = 0; i < count; i += num_components) {
+    for (int c = 0; c < num_components; ++c) {
+      sum[i + c] = (s[c] + s[c + x_step]) * scale;
+    }
+    s += num_components * 2;
+  }
+
+  uint16_t *out = (uint16_t *)p;
+  size_t i = 0;
+#ifdef TEXTURE_FILTER_SSE2
+  // The same as encode_half_float(), four values at a time.
+  const __m128i abs_mask = _mm_set1_epi32(0x7fffffff);
+  const __m128i sign_mask = _mm_set1_epi32(0x80000000);
+  const __m128i bias = _mm_set1_epi32(0x38000000 - 0xfff);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i min_normal = _mm_set1_epi32(0x38800000);
+  const __m128i max_normal = _mm_set1_epi32(0x47800000 - 1);
+  const __m128i inf = _mm_set1_epi32(0x7f800000);
+  const __m128i half_inf = _mm_set1_epi32(0x7c00);
+  const __m128i half_nan = _mm_set1_epi32(0x7e00);
+  const __m128i offset = _mm_set1_epi32(0x8000);
+  const __m128i offset16 = _mm_set1_epi16((short)0x8000);
+  for (; i + 8 <= count; i += 8) {
+    __m128i h[2];
+    for (int j = 0; j < 2; ++j) {
+      __m128i v = _mm_castps_si128(_mm_loadu_ps(sum + i + j * 4));
+      __m128i sign = _mm_srli_epi32(_mm_and_si128(v, sign_mask), 16);
+      __m128i bits = _mm_and_si128(v, abs_mask);
+      __m128i round = _mm_and_si128(_mm_srli_epi32(bits, 13), one);
+      __m128i r = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(bits, bias), round), 13);
+      __m128i too_small = _mm_cmpgt_epi32(min_normal, bits);
+      __m128i too_large = _mm_cmpgt_epi32(bits, max_normal);
+      __m128i is_nan = _mm_cmpgt_epi32(bits, inf);
+      r = _mm_andnot_si128(_mm_or_si128(too_small, too_large), r);
+      r = _mm_or_si128(r, _mm_and_si128(too_large, half_inf));
+      r = _mm_or_si128(r, _mm_and_si128(is_nan, half_nan));
+      h[j] = _mm_sub_epi32(_mm_or_si128(r, sign), offset);
+    }
+    __m128i result = _mm_xor_si128(_mm_packs_epi32(h[0], h[1]), offset16);
+    _mm_storeu_si128((__m128i *)(out + i), result);
+  }
+#endif
+  for (; i < count; ++i) {
+    out[i] = encode_half_float(sum[i]);
+  }
 }
 
 /**
@@ -10324,7 +10193,7 @@ do_fillin_rawdata(CData *cdata, DatagramIterator &scan, BamReader *manager) {
     }
 
     PTA_uchar image = PTA_uchar::empty_array(u_size, get_class_type());
-    scan.extract_bytes(image.p(), u_size);
+    manager->extract_bytes(scan, image.p(), u_size);
 
     cdata->_ram_images[n]._image = image;
   }
@@ -53,6 +53,7 @@ class PreparedGraphicsObjects;
 class CullTraverser;
 class CullTraverserData;
 class TexturePeeker;
+class BCEncoder;
 struct DDSHeader;
 
 /**
@@ -703,10 +704,9 @@ protected:
                              GraphicsStateGuardianBase *gsg);
   bool do_uncompress_ram_image(CData *cdata);
 
-  static void do_compress_ram_image_bc4(const RamImage &src, RamImage &dest,
-                                        int x_size, int y_size, int z_size);
-  static void do_compress_ram_image_bc5(const RamImage &src, RamImage &dest,
-                                        int x_size, int y_size, int z_size);
+  bool do_compress_ram_image_bc(CData *cdata, CompressionMode compression,
+                                QualityLevel quality_level);
+  static void compress_rows(size_t begin, size_t end, void *user_data);
   static void do_uncompress_ram_image_bc4(const RamImage &src, RamImage &dest,
                                           int x_size, int y_size, int z_size);
   static void do_uncompress_ram_image_bc5(const RamImage &src, RamImage &dest,
@@ -792,6 +792,47 @@ protected:
     void *_pointer_image;
   };
 
+  // One page of an image being compressed by do_compress_ram_image_bc().
+  class CompressPage {
+  public:
+    const BCEncoder *_encoder;
+    unsigned char *_dest;
+    const unsigned char *_src;
+    int _x_size;
+    int _y_size;
+  };
+
+  class FilterLevel;
+  typedef void FilterRow(unsigned char *p, const unsigned char *const q[4],
+                         const FilterLevel *level, void *temp);
+
+  // One mipmap level being generated by do_filter_2d_mipmap_pages() or
+  // do_filter_3d_mipmap_level().  Each row of the new level is the average
+  // of _num_rows rows of the previous level: two adjacent rows, or two
+  // adjacent rows of two adjacent pages for a 3-D texture.  A dimension of
+  // size 1 is averaged with itself, by means of a zero offset.
+  class FilterLevel {
+  public:
+    FilterRow *_filter_row;
+    unsigned char *_to;
+    const unsigned char *_from;
+    int _num_components;
+    int _alpha_index;
+    int _num_rows;
+    int _num_views;
+    int _x_size;
+    int _to_x_size;
+    int _to_y_size;
+    int _to_z_size;
+    int _x_step;
+    size_t _next_row;
+    size_t _next_page;
+    size_t _row_size;
+    size_t _page_size;
+    size_t _view_size;
+    size_t _to_row_size;
+  };
+
 private:
   static void convert_from_pnmimage(PTA_uchar &image, size_t page_size,
                                     int row_stride, int x, int y, int z,
@@ -874,48 +915,27 @@ private:
                                  RamImage &to, const RamImage &from,
                                  int x_size, int y_size, int z_size) const;
 
-  typedef void Filter2DComponent(unsigned char *&p,
-                                 const unsigned char *&q,
-                                 size_t pixel_size, size_t row_size);
-
-  typedef void Filter3DComponent(unsigned char *&p,
-                                 const unsigned char *&q,
-                                 size_t pixel_size, size_t row_size,
-                                 size_t page_size);
-
-  static void filter_2d_unsigned_byte(unsigned char *&p,
-                                      const unsigned char *&q,
-                                      size_t pixel_size, size_t row_size);
-  static void filter_2d_unsigned_byte_srgb(unsigned char *&p,
-                                           const unsigned char *&q,
-                                           size_t pixel_size, size_t row_size);
-  static void filter_2d_unsigned_byte_srgb_sse2(unsigned char *&p,
-                                                const unsigned char *&q,
-                                                size_t pixel_size, size_t row_size);
-  static void filter_2d_unsigned_short(unsigned char *&p,
-                                       const unsigned char *&q,
-                                       size_t pixel_size, size_t row_size);
-  static void filter_2d_float(unsigned char *&p, const unsigned char *&q,
-                              size_t pixel_size, size_t row_size);
-
-  static void filter_3d_unsigned_byte(unsigned char *&p,
-                                      const unsigned char *&q,
-                                      size_t pixel_size, size_t row_size,
-                                      size_t page_size);
-  static void filter_3d_unsigned_byte_srgb(unsigned char *&p,
-                                           const unsigned char *&q,
-                                           size_t pixel_size, size_t row_size,
-                                           size_t page_size);
-  static void filter_3d_unsigned_byte_srgb_sse2(unsigned char *&p,
-                                                const unsigned char *&q,
-                                                size_t pixel_size, size_t row_size,
-                                                size_t page_size);
-  static void filter_3d_unsigned_short(unsigned char *&p,
-                                       const unsigned char *&q,
-                                       size_t pixel_size, size_t row_size,
-                                       size_t page_size);
-  static void filter_3d_float(unsigned char *&p, const unsigned char *&q,
-                              size_t pixel_size, size_t row_size, size_t page_size);
+  static void do_filter_mipmap_rows(const FilterLevel &level);
+  static void filter_mipmap_rows(size_t begin, size_t end, void *user_data);
+
+  static void filter_row_unsigned_byte(unsigned char *p,
+                                       const unsigned char *const q[4],
+                                       const FilterLevel *level, void *temp);
+  static void filter_row_unsigned_byte_srgb(unsigned char *p,
+                                            const unsigned char *const q[4],
+                                            const FilterLevel *level, void *temp);
+  static void filter_row_unsigned_byte_srgb_sse2(unsigned char *p,
+                                                 const unsigned char *const q[4],
+                                                 const FilterLevel *level, void *temp);
+  static void filter_row_unsigned_short(unsigned char *p,
+                                        const unsigned char *const q[4],
+                                        const FilterLevel *level, void *temp);
+  static void filter_row_float(unsigned char *p,
+                               const unsigned char *const q[4],
+                               const FilterLevel *level, void *temp);
+  static void filter_row_half_float(unsigned char *p,
+                                    const unsigned char *const q[4],
+                                    const FilterLevel *level, void *temp);
 
   bool do_squish(CData *cdata, CompressionMode compression, int squish_flags);
   bool do_unsquish(CData *cdata, int squish_flags);
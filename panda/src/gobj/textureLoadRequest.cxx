@@ -0,0 +1,53 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file textureLoadRequest.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "textureLoadRequest.h"
+#include "texturePool.h"
+
+TypeHandle TextureLoadRequest::_type_handle;
+
+/**
+ * Normally, a TextureLoadRequest is created by
+ * TexturePool::load_texture_async(), which also creates the placeholder
+ * texture and starts the request.
+ */
+TextureLoadRequest::
+TextureLoadRequest(const std::string &name, const Filename &filename,
+                   int primary_file_num_channels, bool read_mipmaps,
+                   const LoaderOptions &options, Texture *texture) :
+  AsyncTask(name),
+  _filename(filename),
+  _primary_file_num_channels(primary_file_num_channels),
+  _read_mipmaps(read_mipmaps),
+  _options(options),
+  _texture(texture)
+{
+  nassertv(_texture != nullptr);
+}
+
+/**
+ * Performs the task: that is, loads the one texture.
+ */
+AsyncTask::DoneStatus TextureLoadRequest::
+do_task() {
+  double delay = async_load_delay;
+  if (delay != 0.0) {
+    Thread::sleep(delay);
+  }
+
+  PT(Texture) tex = TexturePool::get_global_ptr()->finish_load_async(this);
+  set_result(tex);
+
+  // Don't continue the task; we're done.
+  return DS_done;
+}
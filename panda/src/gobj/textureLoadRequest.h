@@ -0,0 +1,93 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file textureLoadRequest.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef TEXTURELOADREQUEST_H
+#define TEXTURELOADREQUEST_H
+
+#include "pandabase.h"
+
+#include "asyncTask.h"
+#include "texture.h"
+#include "filename.h"
+#include "loaderOptions.h"
+#include "pointerTo.h"
+
+/**
+ * This request loads a texture from its image file in a sub-thread, on behalf
+ * of TexturePool::load_texture_async().  The image is decoded, and mipmapped
+ * and compressed if the LoaderOptions call for it, in the sub-thread.
+ *
+ * The texture returned by get_texture() is available right away, and may be
+ * applied to geometry immediately; it holds a placeholder image until the
+ * load has finished, at which point its contents are replaced with the real
+ * image.  The result of the request, once it is done, is the loaded texture,
+ * or NULL if the file could not be read.
+ */
+class EXPCL_PANDA_GOBJ TextureLoadRequest : public AsyncTask {
+public:
+  ALLOC_DELETED_CHAIN(TextureLoadRequest);
+
+PUBLISHED:
+  explicit TextureLoadRequest(const std::string &name,
+                              const Filename &filename,
+                              int primary_file_num_channels,
+                              bool read_mipmaps,
+                              const LoaderOptions &options,
+                              Texture *texture);
+
+  INLINE const Filename &get_filename() const;
+  INLINE int get_primary_file_num_channels() const;
+  INLINE bool get_read_mipmaps() const;
+  INLINE const LoaderOptions &get_options() const;
+  INLINE Texture *get_texture() const;
+
+  INLINE bool is_ready() const;
+
+  MAKE_PROPERTY(filename, get_filename);
+  MAKE_PROPERTY(options, get_options);
+  MAKE_PROPERTY(texture, get_texture);
+
+protected:
+  virtual DoneStatus do_task();
+
+private:
+  Filename _filename;
+  Filename _fullpath;
+  int _primary_file_num_channels;
+  bool _read_mipmaps;
+  LoaderOptions _options;
+  PT(Texture) _texture;
+
+public:
+  static TypeHandle get_class_type() {
+    return _type_handle;
+  }
+  static void init_type() {
+    AsyncTask::init_type();
+    register_type(_type_handle, "TextureLoadRequest",
+                  AsyncTask::get_class_type());
+  }
+  virtual TypeHandle get_type() const {
+    return get_class_type();
+  }
+  virtual TypeHandle force_init_type() {init_type(); return get_class_type();}
+
+private:
+  static TypeHandle _type_handle;
+
+  friend class TexturePool;
+};
+
+#include "textureLoadRequest.I"
+
+#endif
@@ -24,6 +24,8 @@
 #include "pnmFileTypeRegistry.h"
 #include "texturePoolFilter.h"
 #include "configVariableList.h"
+#include "configVariableEnum.h"
+#include "asyncTaskManager.h"
 #include "load_dso.h"
 #include "mutexHolder.h"
 #include "dcast.h"
@@ -205,6 +207,7 @@ ns_load_texture(const Filename &orig_filename, int primary_file_num_channels,
                 bool read_mipmaps, const LoaderOptions &options) {
   LookupKey key;
   key._primary_file_num_channels = primary_file_num_channels;
+  PT(TextureLoadRequest) pending;
   {
     MutexHolder holder(_lock);
     resolve_filename(key._fullpath, orig_filename, read_mipmaps, options);
@@ -217,12 +220,261 @@ ns_load_texture(const Filename &orig_filename, int primary_file_num_channels,
       nassertr(!tex->get_fullpath().empty(), tex);
       return tex;
     }
+
+    AsyncLoads::const_iterator ai = _async_loads.find(key);
+    if (ai != _async_loads.end()) {
+      pending = (*ai).second;
+    }
+  }
+
+  if (pending != nullptr) {
+    // The texture is being loaded asynchronously; wait for that to finish
+    // instead of loading it a second time.  If there is no thread to finish
+    // it, though, we have to finish it ourselves.
+    AsyncTaskManager *task_mgr = pending->get_manager();
+    AsyncTaskChain *chain = (task_mgr != nullptr) ?
+      task_mgr->find_task_chain(pending->get_task_chain()) : nullptr;
+    if (chain != nullptr && chain->get_num_threads() > 0 &&
+        Thread::is_threading_supported()) {
+      pending->wait();
+    } else {
+      finish_load_async(pending);
+    }
+
+    MutexHolder holder(_lock);
+    Textures::const_iterator ti;
+    ti = _textures.find(key);
+    if (ti != _textures.end()) {
+      Texture *tex = (*ti).second;
+      nassertr(!tex->get_fullpath().empty(), tex);
+      return tex;
+    }
   }
 
   // The texture was not found in the pool.
-  PT(Texture) tex;
   PT(BamCacheRecord) record;
   bool store_record = false;
+  PT(Texture) tex = read_texture(key, orig_filename, read_mipmaps, options,
+                                 record, store_record);
+  if (tex == nullptr) {
+    return nullptr;
+  }
+
+  {
+    MutexHolder holder(_lock);
+
+    // Now look again--someone may have just loaded this texture in another
+    // thread.
+    Textures::const_iterator ti;
+    ti = _textures.find(key);
+    if (ti != _textures.end()) {
+      // This texture was previously loaded.
+      Texture *tex = (*ti).second;
+      nassertr(!tex->get_fullpath().empty(), tex);
+      return tex;
+    }
+
+    _textures[std::move(key)] = tex;
+  }
+
+  if (store_record && tex->is_cacheable()) {
+    // Store the on-disk cache record for next time.
+    record->set_data(tex);
+    BamCache::get_global_ptr()->store(record);
+  }
+
+  if (!(options.get_texture_flags() & LoaderOptions::TF_preload)) {
+    // And now drop the RAM until we need it.
+    tex->clear_ram_image();
+  }
+
+  nassertr(!tex->get_fullpath().empty(), tex);
+
+  // Finally, apply any post-loading texture filters.
+  tex = post_load(tex);
+
+  return tex;
+}
+
+/**
+ * The nonstatic implementation of load_texture_async().
+ */
+PT(TextureLoadRequest) TexturePool::
+ns_load_texture_async(const Filename &orig_filename, int primary_file_num_channels,
+                      bool read_mipmaps, const LoaderOptions &options) {
+  LookupKey key;
+  key._primary_file_num_channels = primary_file_num_channels;
+  string task_name = string("load_texture:") + orig_filename.get_basename();
+  {
+    MutexHolder holder(_lock);
+    resolve_filename(key._fullpath, orig_filename, read_mipmaps, options);
+
+    AsyncLoads::const_iterator ai = _async_loads.find(key);
+    if (ai != _async_loads.end() && !(*ai).second->cancelled()) {
+      // This texture is already being loaded.
+      return (*ai).second;
+    }
+
+    Textures::const_iterator ti;
+    ti = _textures.find(key);
+    if (ti != _textures.end()) {
+      // This texture was previously loaded; return a request that is already
+      // done.
+      Texture *tex = (*ti).second;
+      PT(TextureLoadRequest) request =
+        new TextureLoadRequest(task_name, orig_filename,
+                               primary_file_num_channels, read_mipmaps,
+                               options, tex);
+      request->set_result(tex);
+      return request;
+    }
+  }
+
+  // Make a placeholder texture for the caller to use in the meantime.  It has
+  // a single mid-gray texel; everything is replaced when the real image is
+  // ready.  It doesn't have a fullpath yet, so that nothing tries to reload it
+  // from disk in the main thread.
+  PT(Texture) tex = ns_make_texture(downcase(key._fullpath.get_extension()));
+  tex->set_name(key._fullpath.get_basename_wo_extension());
+  tex->set_filename(orig_filename);
+  tex->setup_2d_texture(1, 1, Texture::T_unsigned_byte, Texture::F_rgba);
+
+  PTA_uchar image = PTA_uchar::empty_array(4);
+  image[0] = image[1] = image[2] = 0x80;
+  image[3] = 0xff;
+  tex->set_ram_image(image);
+  tex->set_simple_ram_image(image, 1, 1);
+
+  PT(TextureLoadRequest) request =
+    new TextureLoadRequest(task_name, orig_filename, primary_file_num_channels,
+                           read_mipmaps, options, tex);
+  request->_fullpath = key._fullpath;
+  {
+    MutexHolder holder(_lock);
+
+    // Someone may have just started loading this texture in another thread.
+    AsyncLoads::const_iterator ai = _async_loads.find(key);
+    if (ai != _async_loads.end() && !(*ai).second->cancelled()) {
+      return (*ai).second;
+    }
+    _async_loads[std::move(key)] = request;
+  }
+
+  AsyncTaskManager *task_mgr = AsyncTaskManager::get_global_ptr();
+  if (task_mgr->find_task_chain("texture_loader") == nullptr) {
+    PT(AsyncTaskChain) chain = task_mgr->make_task_chain("texture_loader");
+
+    ConfigVariableInt texture_loader_num_threads
+      ("texture-loader-num-threads", 1,
+       PRC_DESC("The number of threads that will be started by the TexturePool "
+                "to load textures with load_texture_async().  These threads "
+                "are only started if the asynchronous interface is used, and "
+                "if threading support is compiled into Panda."));
+    chain->set_num_threads(texture_loader_num_threads);
+
+    ConfigVariableEnum<ThreadPriority> texture_loader_thread_priority
+      ("texture-loader-thread-priority", TP_low,
+       PRC_DESC("The thread priority to assign to the threads created for "
+                "load_texture_async().  The default is 'low'; you may also "
+                "specify 'normal', 'high', or 'urgent'."));
+    chain->set_thread_priority(texture_loader_thread_priority);
+  }
+  request->set_task_chain("texture_loader");
+  task_mgr->add(request);
+  return request;
+}
+
+/**
+ * Called by a TextureLoadRequest in its sub-thread to load the texture and
+ * copy it into the request's placeholder texture.  Returns the loaded
+ * texture, or NULL on failure.
+ */
+PT(Texture) TexturePool::
+finish_load_async(TextureLoadRequest *request) {
+  LookupKey key;
+  key._fullpath = request->_fullpath;
+  key._primary_file_num_channels = request->_primary_file_num_channels;
+
+  // The RAM image is always kept, since the point is to have the texture
+  // ready to render without going back to disk in the main thread.
+  LoaderOptions options(request->_options);
+  options.set_texture_flags(options.get_texture_flags() | LoaderOptions::TF_preload);
+
+  {
+    MutexHolder holder(_lock);
+    AsyncLoads::const_iterator ai = _async_loads.find(key);
+    if (ai == _async_loads.end() || (*ai).second != request) {
+      // load_texture() already finished this request synchronously.
+      Textures::const_iterator ti = _textures.find(key);
+      return (ti != _textures.end()) ? (*ti).second : nullptr;
+    }
+  }
+
+  PT(BamCacheRecord) record;
+  bool store_record = false;
+  PT(Texture) tex = read_texture(key, request->_filename, request->_read_mipmaps,
+                                 options, record, store_record);
+  if (tex == nullptr) {
+    MutexHolder holder(_lock);
+    _async_loads.erase(key);
+    return nullptr;
+  }
+
+  if (store_record && tex->is_cacheable()) {
+    record->set_data(tex);
+    BamCache::get_global_ptr()->store(record);
+  }
+
+  tex = post_load(tex);
+
+  // Copy the loaded texture into the placeholder that the caller already
+  // has, all at once.
+  Texture *published = request->_texture;
+  {
+    Texture::CDWriter cdata(published->_cycler, true);
+    Texture::CDReader cdata_tex(tex->_cycler);
+    published->do_assign(cdata, tex, cdata_tex);
+    cdata->inc_properties_modified();
+    cdata->inc_image_modified();
+    cdata->inc_simple_image_modified();
+  }
+
+  if (tex->get_type() == published->get_type()) {
+    published->_texture_pool_key = key._fullpath;
+    tex = published;
+  } else {
+    // The placeholder can't become a texture of a different type, so the
+    // pool keeps the loaded texture instead; the placeholder only gets a
+    // copy of its image.
+    gobj_cat.warning()
+      << key._fullpath << " was loaded as a " << tex->get_type()
+      << ", but the placeholder texture is a " << published->get_type()
+      << "; the placeholder only receives a copy of the image.\n";
+  }
+
+  MutexHolder holder(_lock);
+  _async_loads.erase(key);
+  Textures::const_iterator ti;
+  ti = _textures.find(key);
+  if (ti == _textures.end()) {
+    _textures[std::move(key)] = tex;
+  }
+  return tex;
+}
+
+/**
+ * The part of load_texture() that does the actual loading, without touching
+ * the pool: the texture is obtained from a TexturePoolFilter, the on-disk
+ * cache, or else its source image.  Fills in the cache record that should be
+ * stored afterwards, if any.  Returns NULL if the texture could not be read.
+ */
+PT(Texture) TexturePool::
+read_texture(LookupKey &key, const Filename &orig_filename, bool read_mipmaps,
+             const LoaderOptions &options, PT(BamCacheRecord) &record,
+             bool &store_record) {
+  int primary_file_num_channels = key._primary_file_num_channels;
+  PT(Texture) tex;
+  store_record = false;
 
   // Can one of our texture filters supply the texture?
   tex = pre_load(orig_filename, Filename(), primary_file_num_channels, 0,
@@ -290,11 +542,7 @@ ns_load_texture(const Filename &orig_filename, int primary_file_num_channels,
   }
 
   if (cache->get_cache_compressed_textures() && tex->has_compression()) {
-#ifndef HAVE_SQUISH
-    bool needs_driver_compression = true;
-#else
     bool needs_driver_compression = driver_compress_textures;
-#endif // HAVE_SQUISH
     if (needs_driver_compression) {
       // We don't want to save the uncompressed version; we'll save the
       // compressed version when it becomes available.
@@ -315,39 +563,6 @@ ns_load_texture(const Filename &orig_filename, int primary_file_num_channels,
   tex->set_fullpath(key._fullpath);
   tex->_texture_pool_key = key._fullpath;
 
-  {
-    MutexHolder holder(_lock);
-
-    // Now look again--someone may have just loaded this texture in another
-    // thread.
-    Textures::const_iterator ti;
-    ti = _textures.find(key);
-    if (ti != _textures.end()) {
-      // This texture was previously loaded.
-      Texture *tex = (*ti).second;
-      nassertr(!tex->get_fullpath().empty(), tex);
-      return tex;
-    }
-
-    _textures[std::move(key)] = tex;
-  }
-
-  if (store_record && tex->is_cacheable()) {
-    // Store the on-disk cache record for next time.
-    record->set_data(tex);
-    cache->store(record);
-  }
-
-  if (!(options.get_texture_flags() & LoaderOptions::TF_preload)) {
-    // And now drop the RAM until we need it.
-    tex->clear_ram_image();
-  }
-
-  nassertr(!tex->get_fullpath().empty(), tex);
-
-  // Finally, apply any post-loading texture filters.
-  tex = post_load(tex);
-
   return tex;
 }
 
@@ -419,11 +634,7 @@ ns_load_texture(const Filename &orig_filename,
   }
 
   if (cache->get_cache_compressed_textures() && tex->has_compression()) {
-#ifndef HAVE_SQUISH
-    bool needs_driver_compression = true;
-#else
     bool needs_driver_compression = driver_compress_textures;
-#endif // HAVE_SQUISH
     if (needs_driver_compression) {
       // We don't want to save the uncompressed version; we'll save the
       // compressed version when it becomes available.
@@ -532,11 +743,7 @@ ns_load_3d_texture(const Filename &filename_pattern,
   }
 
   if (cache->get_cache_compressed_textures() && tex->has_compression()) {
-#ifndef HAVE_SQUISH
-    bool needs_driver_compression = true;
-#else
     bool needs_driver_compression = driver_compress_textures;
-#endif // HAVE_SQUISH
     if (needs_driver_compression) {
       // We don't want to save the uncompressed version; we'll save the
       // compressed version when it becomes available.
@@ -634,11 +841,7 @@ ns_load_2d_texture_array(const Filename &filename_pattern,
   }
 
   if (cache->get_cache_compressed_textures() && tex->has_compression()) {
-#ifndef HAVE_SQUISH
-    bool needs_driver_compression = true;
-#else
     bool needs_driver_compression = driver_compress_textures;
-#endif // HAVE_SQUISH
     if (needs_driver_compression) {
       // We don't want to save the uncompressed version; we'll save the
       // compressed version when it becomes available.
@@ -736,11 +939,7 @@ ns_load_cube_map(const Filename &filename_pattern, bool read_mipmaps,
   }
 
   if (cache->get_cache_compressed_textures() && tex->has_compression()) {
-#ifndef HAVE_SQUISH
-    bool needs_driver_compression = true;
-#else
     bool needs_driver_compression = driver_compress_textures;
-#endif // HAVE_SQUISH
     if (needs_driver_compression) {
       // We don't want to save the uncompressed version; we'll save the
       // compressed version when it becomes available.
@@ -24,6 +24,7 @@
 #include "pmutex.h"
 #include "pmap.h"
 #include "textureCollection.h"
+#include "textureLoadRequest.h"
 
 class TexturePoolFilter;
 class BamCache;
@@ -48,6 +49,10 @@ PUBLISHED:
                                                int alpha_file_channel = 0,
                                                bool read_mipmaps = false,
                                                const LoaderOptions &options = LoaderOptions());
+  INLINE static PT(TextureLoadRequest) load_texture_async(const Filename &filename,
+                                                          int primary_file_num_channels = 0,
+                                                          bool read_mipmaps = false,
+                                                          const LoaderOptions &options = LoaderOptions());
   BLOCKING INLINE static Texture *load_3d_texture(const Filename &filename_pattern,
                                                   bool read_mipmaps = false,
                                                   const LoaderOptions &options = LoaderOptions());
@@ -95,6 +100,8 @@ public:
 private:
   TexturePool();
 
+  struct LookupKey;
+
   bool ns_has_texture(const Filename &orig_filename);
   Texture *ns_load_texture(const Filename &orig_filename,
                            int primary_file_num_channels,
@@ -106,6 +113,14 @@ private:
                            int alpha_file_channel,
                            bool read_mipmaps,
                            const LoaderOptions &options);
+  PT(TextureLoadRequest) ns_load_texture_async(const Filename &orig_filename,
+                                               int primary_file_num_channels,
+                                               bool read_mipmaps,
+                                               const LoaderOptions &options);
+  PT(Texture) finish_load_async(TextureLoadRequest *request);
+  PT(Texture) read_texture(LookupKey &key, const Filename &orig_filename,
+                           bool read_mipmaps, const LoaderOptions &options,
+                           PT(BamCacheRecord) &record, bool &store_record);
   Texture *ns_load_3d_texture(const Filename &filename_pattern,
                               bool read_mipmaps,
                               const LoaderOptions &options);
@@ -160,6 +175,8 @@ private:
   };
   typedef pmap<LookupKey, PT(Texture)> Textures;
   Textures _textures;
+  typedef pmap<LookupKey, PT(TextureLoadRequest)> AsyncLoads;
+  AsyncLoads _async_loads;
   typedef pmap<Filename, Filename> RelpathLookup;
   RelpathLookup _relpath_lookup;
 
@@ -173,6 +190,8 @@ private:
 
   typedef pvector<TexturePoolFilter *> FilterRegistry;
   FilterRegistry _filter_registry;
+
+  friend class TextureLoadRequest;
 };
 
 #include "texturePool.I"
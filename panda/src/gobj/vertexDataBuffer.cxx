@@ -39,6 +39,8 @@ operator = (const VertexDataBuffer &copy) {
   _size = copy._size;
   _reserved_size = copy._size;
   _block = copy._block;
+  _mapped_file = copy._mapped_file;
+  _mapped_data = copy._mapped_data;
   nassertv(_reserved_size >= _size);
 }
 
@@ -55,6 +57,8 @@ swap(VertexDataBuffer &other) {
   size_t reserved_size = _reserved_size;
 
   _block.swap(other._block);
+  _mapped_file.swap(other._mapped_file);
+  std::swap(_mapped_data, other._mapped_data);
 
   _resident_data = other._resident_data;
   _size = other._size;
@@ -66,6 +70,29 @@ swap(VertexDataBuffer &other) {
   nassertv(_reserved_size >= _size);
 }
 
+/**
+ * Points the buffer at the indicated bytes within a mapped file, discarding
+ * its previous contents.  The data is not copied until the buffer is
+ * modified.  The MappedFile is kept open for as long as the buffer (or any
+ * copy of it) references it.
+ */
+void VertexDataBuffer::
+set_mapped_data(MappedFile *file, const unsigned char *data, size_t size) {
+  nassertv(file != nullptr && data != nullptr);
+  nassertv(data >= file->get_data() && data + size <= file->get_data() + file->get_size());
+  nassertv(((uintptr_t)data % MEMORY_HOOK_ALIGNMENT) == 0);
+
+  LightMutexHolder holder(_lock);
+  do_unclean_realloc(0);
+
+  if (size != 0) {
+    _mapped_file = file;
+    _mapped_data = data;
+    _size = size;
+    _reserved_size = size;
+  }
+}
+
 /**
  * Changes the reserved size of the buffer, preserving its data (except for
  * any data beyond the new end of the buffer, if the buffer is being reduced).
@@ -119,8 +146,10 @@ do_unclean_realloc(size_t reserved_size) {
         << this << ".unclean_realloc(" << reserved_size << ")\n";
     }
 
-    // If we're paged out, discard the page.
+    // If we're paged out or mapped, discard the page.
     _block = nullptr;
+    _mapped_file = nullptr;
+    _mapped_data = nullptr;
 
     if (_resident_data != nullptr) {
       nassertv(_reserved_size != 0);
@@ -155,6 +184,11 @@ do_page_out(VertexDataBook &book) {
     // We're already paged out.
     return;
   }
+  if (_mapped_data != nullptr) {
+    // The file already backs the memory; the OS can discard these pages
+    // and read them again as needed.
+    return;
+  }
   nassertv(_resident_data != nullptr);
 
   if (_size == 0) {
@@ -194,9 +228,21 @@ do_page_in() {
     return;
   }
 
-  nassertv(_block != nullptr);
   nassertv(_reserved_size == _size);
 
+  if (_mapped_data != nullptr) {
+    // Copy the data out of the mapped file, which we no longer need.
+    _resident_data = (unsigned char *)get_class_type().allocate_array(_size);
+    nassertv(_resident_data != nullptr);
+
+    memcpy(_resident_data, _mapped_data, _size);
+    _mapped_file = nullptr;
+    _mapped_data = nullptr;
+    return;
+  }
+
+  nassertv(_block != nullptr);
+
   _resident_data = (unsigned char *)get_class_type().allocate_array(_size);
   nassertv(_resident_data != nullptr);
 
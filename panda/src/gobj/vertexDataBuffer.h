@@ -22,12 +22,13 @@
 #include "pStatCollector.h"
 #include "lightMutex.h"
 #include "lightMutexHolder.h"
+#include "mappedFile.h"
 
 /**
  * A block of bytes that stores the actual raw vertex data referenced by a
  * GeomVertexArrayData object.
  *
- * At any point, a buffer may be in any of two states:
+ * At any point, a buffer may be in any of three states:
  *
  * independent - the buffer's memory is resident, and owned by the
  * VertexDataBuffer object itself (in _resident_data).  In this state,
@@ -39,6 +40,12 @@
  * memory is considered read-only.  In this state, _reserved_size will always
  * equal _size.
  *
+ * mapped - the buffer's memory is part of a file that has been mapped into
+ * memory, usually a bam file that was read with BamReader::set_map_arrays().
+ * This memory is read-only as well, and the OS reads it from disk as it is
+ * accessed.  Modifying the buffer copies it into independent memory.  In this
+ * state, _reserved_size will always equal _size.
+ *
  * VertexDataBuffers start out in independent state.  They get moved to paged
  * state when their owning GeomVertexArrayData objects get evicted from the
  * _independent_lru.  They can get moved back to independent state if they are
@@ -69,6 +76,9 @@ public:
 
   INLINE void page_out(VertexDataBook &book);
 
+  void set_mapped_data(MappedFile *file, const unsigned char *data, size_t size);
+  INLINE bool is_mapped() const;
+
   void swap(VertexDataBuffer &other);
 
 private:
@@ -82,6 +92,8 @@ private:
   size_t _size;
   size_t _reserved_size;
   PT(VertexDataBlock) _block;
+  PT(MappedFile) _mapped_file;
+  const unsigned char *_mapped_data;
   LightMutex _lock;
 
 public:
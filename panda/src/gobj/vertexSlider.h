@@ -104,6 +104,7 @@ private:
   static TypeHandle _type_handle;
 
   friend class SliderTable;
+  friend class PartBundle;
 };
 
 INLINE std::ostream &operator << (std::ostream &out, const VertexSlider &obj);
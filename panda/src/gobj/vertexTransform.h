@@ -105,6 +105,7 @@ private:
   static TypeHandle _type_handle;
 
   friend class TransformTable;
+  friend class PartBundle;
 };
 
 INLINE std::ostream &operator << (std::ostream &out, const VertexTransform &obj);
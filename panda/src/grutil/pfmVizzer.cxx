@@ -26,6 +26,13 @@
 using std::max;
 using std::min;
 
+// The arguments for PfmVizzer::project_rows().
+struct PfmVizzerProjectJob {
+  PfmVizzer *_vizzer;
+  const Lens *_lens;
+  const PfmFile *_undist_lut;
+};
+
 /**
  * The PfmVizzer constructor receives a reference to a PfmFile which it will
  * operate on.  It does not keep ownership of this reference; it is your
@@ -52,34 +59,57 @@ void PfmVizzer::
 project(const Lens *lens, const PfmFile *undist_lut) {
   nassertv(_pfm.is_valid());
 
-  static LMatrix4 to_uv(0.5f, 0.0f, 0.0f, 0.0f,
-                        0.0f, 0.5f, 0.0f, 0.0f,
-                        0.0f, 0.0f, 0.5f, 0.0f,
-                        0.5f, 0.5f, 0.5f, 1.0f);
+  PfmVizzerProjectJob job;
+  job._vizzer = this;
+  job._lens = lens;
+  job._undist_lut = undist_lut;
 
-  for (int yi = 0; yi < _pfm.get_y_size(); ++yi) {
-    for (int xi = 0; xi < _pfm.get_x_size(); ++xi) {
-      if (!_pfm.has_point(xi, yi)) {
+  // Lens computes its matrices lazily, the first time they are needed.  Make
+  // sure that has happened before the rows are divided among threads.
+  LPoint3 film;
+  lens->project(LPoint3(0.0f, 1.0f, 0.0f), film);
+
+  PfmFile::run_rows(_pfm.get_y_size(), (size_t)_pfm.get_x_size() * 3,
+                    &project_rows, &job);
+}
+
+/**
+ * Projects the points on rows [begin, end) for project().
+ */
+void PfmVizzer::
+project_rows(size_t begin, size_t end, void *data) {
+  const PfmVizzerProjectJob &job = *(const PfmVizzerProjectJob *)data;
+  PfmFile &pfm = job._vizzer->_pfm;
+  bool keep_beyond_lens = job._vizzer->_keep_beyond_lens;
+
+  static const LMatrix4 to_uv(0.5f, 0.0f, 0.0f, 0.0f,
+                              0.0f, 0.5f, 0.0f, 0.0f,
+                              0.0f, 0.0f, 0.5f, 0.0f,
+                              0.5f, 0.5f, 0.5f, 1.0f);
+
+  for (int yi = (int)begin; yi < (int)end; ++yi) {
+    for (int xi = 0; xi < pfm.get_x_size(); ++xi) {
+      if (!pfm.has_point(xi, yi)) {
         continue;
       }
-      LPoint3f &p = _pfm.modify_point(xi, yi);
+      LPoint3f &p = pfm.modify_point(xi, yi);
 
       LPoint3 film;
-      if (!lens->project(LCAST(PN_stdfloat, p), film) && !_keep_beyond_lens) {
-        if (_pfm.has_no_data_value()) {
-          _pfm.set_point4(xi, yi, _pfm.get_no_data_value());
+      if (!job._lens->project(LCAST(PN_stdfloat, p), film) && !keep_beyond_lens) {
+        if (pfm.has_no_data_value()) {
+          pfm.set_point4(xi, yi, pfm.get_no_data_value());
         } else {
-          _pfm.set_point4(xi, yi, LVecBase4f(0, 0, 0, 0));
+          pfm.set_point4(xi, yi, LVecBase4f(0, 0, 0, 0));
         }
       } else {
         // Now the lens gives us coordinates in the range [-1, 1]. Rescale
         // these to [0, 1].
         LPoint3f uvw = LCAST(float, film * to_uv);
 
-        if (undist_lut != nullptr) {
+        if (job._undist_lut != nullptr) {
           // Apply the undistortion map, if given.
           LPoint3f p2;
-          undist_lut->calc_bilinear_point(p2, uvw[0], 1.0 - uvw[1]);
+          job._undist_lut->calc_bilinear_point(p2, uvw[0], 1.0 - uvw[1]);
           uvw = p2;
           uvw[1] = 1.0 - uvw[1];
         }
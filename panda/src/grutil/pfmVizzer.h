@@ -88,6 +88,8 @@ PUBLISHED:
   BLOCKING void make_displacement(PfmFile &result, double max_u, double max_v, bool for_32bit) const;
 
 private:
+  static void project_rows(size_t begin, size_t end, void *data);
+
   bool uses_aux_pfm() const;
   void r_fill_displacement(PNMImage &result, int xi, int yi,
                            double nxi, double nyi, double u_scale, double v_scale,
@@ -23,9 +23,13 @@ SendMessage(const Datagram &msg) {
   if (IsConnected()) {
     // printf(" DO SendMessage %d\n",msg.get_length());
 
+    if (_Writer.AmountBuffered() == 0) {
+      _buffered_since = TrueClock::get_global_ptr()->get_short_time();
+    }
+
     int val = _Writer.AddData(msg.get_data(), msg.get_length(), *this);
     if (val >= 0) {
-      return true;
+      return ConsiderFlush();
     }
 
     // Raise an exception to give us more information at the python level
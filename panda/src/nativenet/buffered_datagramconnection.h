@@ -28,6 +28,7 @@
 #include "buffered_datagramreader.h"
 #include "buffered_datagramwriter.h"
 #include "config_nativenet.h"
+#include "trueClock.h"
 
 // there are 3 states 1. Socket not even assigned,,,, 2. Socket Assigned and
 // trying to get a active connect open 3. Socket is open and  writable.. (
@@ -89,6 +90,12 @@ PUBLISHED:
   inline bool Flush(void);
   inline void Reset(void);
 
+  // write coalescing: buffered writes are flushed once they have waited this
+  // long.  a negative deadline (the default) leaves flushing to the caller.
+  inline void SetFlushDeadline(double deadline);
+  inline double GetFlushDeadline(void) const;
+  inline bool ConsiderFlush(void);
+
   // int WaitFor_Read_Error(const Socket_fdset & fd, const Time_Span &
   // timeout);
 
@@ -110,6 +117,8 @@ private:
   Buffered_DatagramReader _Reader;      // buffered reader
   AddressQueue            _Addresslist;   // the location of the round robin address list
   Socket_Address          _Adddress;    // the conection address ( active one from list being used)
+  double                  _flush_deadline;  // see SetFlushDeadline
+  double                  _buffered_since;  // when the oldest unflushed data was buffered
 
   friend class Buffered_DatagramReader;
   friend class Buffered_DatagramWriter;
@@ -213,7 +222,8 @@ inline Buffered_DatagramConnection::~Buffered_DatagramConnection(void)
  *
  */
 inline Buffered_DatagramConnection::Buffered_DatagramConnection(int rbufsize, int wbufsize, int write_flush_point)
-    :  _Writer(wbufsize,write_flush_point) , _Reader(rbufsize)
+    :  _Writer(wbufsize,write_flush_point) , _Reader(rbufsize),
+       _flush_deadline(-1.0), _buffered_since(0.0)
 {
   nativenet_cat.error() << "Buffered_DatagramConnection Constructor rbufsize = " << rbufsize
                         << " wbufsize = " << wbufsize << " write_flush_point = " << write_flush_point << "\n";
@@ -285,6 +295,41 @@ bool Buffered_DatagramConnection::Flush(void)
     return false;
 }
 
+/**
+ * Sets the maximum time, in seconds, that data written by SendMessage() may
+ * sit in the write buffer before it is flushed.  Many small messages are
+ * thereby coalesced into one send, without the caller having to call Flush()
+ * after each of them.  The deadline is checked by SendMessage() and
+ * ConsiderFlush(); a negative value disables it.
+ */
+inline void Buffered_DatagramConnection::SetFlushDeadline(double deadline) {
+  _flush_deadline = deadline;
+}
+
+/**
+ * Returns the flush deadline.  See SetFlushDeadline().
+ */
+inline double Buffered_DatagramConnection::GetFlushDeadline(void) const {
+  return _flush_deadline;
+}
+
+/**
+ * Flushes the write buffer if the oldest data in it has waited longer than
+ * the flush deadline.  Call this periodically when a flush deadline is set.
+ */
+inline bool Buffered_DatagramConnection::ConsiderFlush(void) {
+  if (_flush_deadline < 0.0 || _Writer.AmountBuffered() == 0) {
+    return true;
+  }
+  double now = TrueClock::get_global_ptr()->get_short_time();
+  if (now - _buffered_since < _flush_deadline) {
+    return true;
+  }
+  bool okflag = Flush();
+  _buffered_since = now;
+  return okflag;
+}
+
 /**
  * Reset
  */
@@ -146,6 +146,63 @@ ConfigVariableEnum<ThreadPriority> net_thread_priority
  PRC_DESC("The default thread priority when creating threaded readers "
           "or writers."));
 
+ConfigVariableBool net_use_epoll
+("net-use-epoll", false,
+ PRC_DESC("Set this true to have each ConnectionReader and ConnectionListener "
+          "created from now on monitor its sockets with epoll, rather than "
+          "with select().  This is recommended for processes with more than "
+          "a few hundred connections.  It is only available on Linux; "
+          "elsewhere, select() is always used."));
+
+ConfigVariableInt net_receive_buffer_pool_size
+("net-receive-buffer-pool-size", 256,
+ PRC_DESC("The number of buffers each ConnectionReader keeps on hand to "
+          "receive datagrams into.  A buffer is reused as soon as the "
+          "application has released the datagram that was received into it, "
+          "so this should be at least the number of datagrams that are "
+          "typically held at any one time.  Set this to 0 to allocate a new "
+          "buffer for each datagram."));
+
+ConfigVariableInt net_receive_buffer_max_size
+("net-receive-buffer-max-size", 4096,
+ PRC_DESC("The size in bytes of the largest datagram that is received into a "
+          "pooled buffer; see net-receive-buffer-pool-size.  Larger datagrams "
+          "are always received into a newly allocated buffer."));
+
+ConfigVariableInt net_max_datagram_size
+("net-max-datagram-size", 16777216,
+ PRC_DESC("The size in bytes of the largest TCP datagram a ConnectionReader "
+          "will accept.  A datagram header that announces a larger size is "
+          "treated as a protocol error, and the connection is reset."));
+
+ConfigVariableInt net_udp_batch_size
+("net-udp-batch-size", 16,
+ PRC_DESC("The maximum number of UDP datagrams a ConnectionReader reads from "
+          "a socket with a single system call, on platforms that support "
+          "recvmmsg().  Set this to 1 to read one datagram at a time."));
+
+ConfigVariableBool net_writer_coalesce
+("net-writer-coalesce", false,
+ PRC_DESC("The default value of ConnectionWriter::set_coalesce() for newly "
+          "created ConnectionWriters.  When this is true, datagrams are "
+          "gathered up per connection and sent with as few system calls as "
+          "possible.  A threaded writer sends them on its own when the "
+          "flush deadline expires, but a writer without threads only checks "
+          "the deadline when something calls its consider_flush() or "
+          "flush(), or those of its ConnectionManager; polling a "
+          "ConnectionReader of the same ConnectionManager, "
+          "ConnectionManager::wait_for_readers(), and "
+          "CConnectionRepository::check_datagram() all do this.  An "
+          "application that uses such a writer without any of these must "
+          "flush it itself, or the last datagrams it sends are held back."));
+
+ConfigVariableDouble net_writer_flush_deadline
+("net-writer-flush-deadline", 0.01,
+ PRC_DESC("The default value of ConnectionWriter::set_flush_deadline() for "
+          "newly created ConnectionWriters.  This is the maximum amount of "
+          "time, in seconds, that a coalescing ConnectionWriter holds on to a "
+          "datagram while waiting for more datagrams to send along with it."));
+
 
 /**
  * Initializes the library.  This must be called at least once before any of
@@ -37,6 +37,13 @@ extern ConfigVariableInt net_max_read_per_epoch;
 extern ConfigVariableInt net_max_write_per_epoch;
 
 extern ConfigVariableEnum<ThreadPriority> net_thread_priority;
+extern ConfigVariableBool net_use_epoll;
+extern ConfigVariableInt net_receive_buffer_pool_size;
+extern ConfigVariableInt net_receive_buffer_max_size;
+extern ConfigVariableInt net_max_datagram_size;
+extern ConfigVariableInt net_udp_batch_size;
+extern ConfigVariableBool net_writer_coalesce;
+extern ConfigVariableDouble net_writer_flush_deadline;
 
 extern EXPCL_PANDA_NET void init_libnet();
 
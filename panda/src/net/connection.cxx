@@ -26,6 +26,23 @@
 #include "socket_udp.h"
 #include "dcast.h"
 
+#if !defined(CPPPARSER) && !defined(_WIN32)
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <errno.h>
+#define HAVE_SENDMSG 1
+#ifdef __linux__
+#define HAVE_SENDMMSG 1
+#endif
+#endif
+
+#ifdef HAVE_SENDMSG
+// The maximum number of datagrams gathered into a single sendmsg() or
+// sendmmsg() call.  Each TCP datagram takes up two iovecs.
+static const int max_send_batch = 256;
+#endif
+
 
 /**
  * Creates a connection.  Normally this constructor should not be used
@@ -409,6 +426,196 @@ send_raw_datagram(const NetDatagram &datagram) {
   return true;
 }
 
+/**
+ * This method is intended only to be called by ConnectionWriter.  It writes
+ * several datagrams to the socket at once, with their headers unless raw_mode
+ * is true, gathering them into as few system calls as possible: sendmsg() for
+ * TCP, or sendmmsg() for UDP where it is available.  Returns true on success,
+ * false on failure.
+ */
+bool Connection::
+send_datagrams(const NetDatagram *datagrams, int num_datagrams,
+               int tcp_header_size, bool raw_mode) {
+  nassertr(_socket != nullptr, false);
+  if (num_datagrams <= 1) {
+    if (num_datagrams == 0) {
+      return true;
+    }
+    return raw_mode ? send_raw_datagram(datagrams[0])
+                    : send_datagram(datagrams[0], tcp_header_size);
+  }
+
+  if (_socket->is_exact_type(Socket_UDP::get_class_type())) {
+#ifdef HAVE_SENDMMSG
+    Socket_UDP *udp;
+    DCAST_INTO_R(udp, _socket, false);
+
+    LightReMutexHolder holder(_write_mutex);
+    bool okflag = true;
+    for (int start = 0; start < num_datagrams && okflag; start += max_send_batch) {
+      int count = std::min(num_datagrams - start, max_send_batch);
+
+      // Each message is a header, if any, followed by the datagram itself.
+      std::string headers;
+      if (!raw_mode) {
+        for (int i = 0; i < count; ++i) {
+          headers += DatagramUDPHeader(datagrams[start + i]).get_header();
+        }
+      }
+
+      struct mmsghdr msgs[max_send_batch];
+      struct iovec iovecs[max_send_batch * 2];
+      memset(msgs, 0, sizeof(struct mmsghdr) * count);
+      int num_iovecs = 0;
+      for (int i = 0; i < count; ++i) {
+        const NetDatagram &datagram = datagrams[start + i];
+        msgs[i].msg_hdr.msg_iov = &iovecs[num_iovecs];
+        if (!raw_mode) {
+          iovecs[num_iovecs].iov_base = (void *)(headers.data() + i * datagram_udp_header_size);
+          iovecs[num_iovecs].iov_len = datagram_udp_header_size;
+          ++num_iovecs;
+        }
+        iovecs[num_iovecs].iov_base = (void *)datagram.get_data();
+        iovecs[num_iovecs].iov_len = datagram.get_length();
+        ++num_iovecs;
+        msgs[i].msg_hdr.msg_iovlen = raw_mode ? 1 : 2;
+
+        const sockaddr *addr = &datagram.get_address().get_addr().GetAddressInfo();
+        msgs[i].msg_hdr.msg_name = (void *)addr;
+        msgs[i].msg_hdr.msg_namelen = SA_SIZEOF(addr);
+      }
+
+      int num_sent = 0;
+      while (num_sent < count) {
+        int result = sendmmsg(udp->GetSocket(), msgs + num_sent, count - num_sent, 0);
+        if (result < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          okflag = false;
+          break;
+        }
+        num_sent += result;
+      }
+    }
+
+    if (net_cat.is_spam()) {
+      net_cat.spam()
+        << "Sent " << num_datagrams << " UDP datagrams to " << (void *)this
+        << ", ok = " << okflag << "\n";
+    }
+
+    return check_send_error(okflag);
+
+#else  // HAVE_SENDMMSG
+    bool okflag = true;
+    for (int i = 0; i < num_datagrams; ++i) {
+      if (raw_mode) {
+        okflag = send_raw_datagram(datagrams[i]) && okflag;
+      } else {
+        okflag = send_datagram(datagrams[i], tcp_header_size) && okflag;
+      }
+    }
+    return okflag;
+#endif  // HAVE_SENDMMSG
+  }
+
+  int header_size = raw_mode ? 0 : tcp_header_size;
+  std::string headers;
+  for (int i = 0; i < num_datagrams; ++i) {
+    const NetDatagram &datagram = datagrams[i];
+    if (header_size == 2 && datagram.get_length() >= 0x10000) {
+      net_cat.error()
+        << "Attempt to send TCP datagram of " << datagram.get_length()
+        << " bytes--too long!\n";
+      nassert_raise("Datagram too long");
+      return false;
+    }
+    if (header_size != 0) {
+      headers += DatagramTCPHeader(datagram, header_size).get_header();
+    }
+  }
+
+  LightReMutexHolder holder(_write_mutex);
+
+#if defined(HAVE_SENDMSG) && !(defined(HAVE_THREADS) && defined(SIMPLE_THREADS))
+  // Anything queued up by collect-tcp mode has to go first.
+  if (!_queued_data.empty() && !do_flush()) {
+    return false;
+  }
+
+  Socket_TCP *tcp;
+  DCAST_INTO_R(tcp, _socket, false);
+
+  // Gather the headers and datagrams into one big list of iovecs, and send
+  // them in chunks of no more than IOV_MAX.
+  pvector<struct iovec> iovecs;
+  iovecs.reserve(header_size != 0 ? num_datagrams * 2 : num_datagrams);
+  for (int i = 0; i < num_datagrams; ++i) {
+    struct iovec iov;
+    if (header_size != 0) {
+      iov.iov_base = (void *)(headers.data() + i * header_size);
+      iov.iov_len = header_size;
+      iovecs.push_back(iov);
+    }
+    iov.iov_base = (void *)datagrams[i].get_data();
+    iov.iov_len = datagrams[i].get_length();
+    if (iov.iov_len != 0) {
+      iovecs.push_back(iov);
+    }
+  }
+
+  bool okflag = true;
+  size_t next = 0;
+  while (next < iovecs.size()) {
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iovecs[next];
+    msg.msg_iovlen = std::min(iovecs.size() - next, (size_t)std::min(IOV_MAX, max_send_batch * 2));
+
+    ssize_t result = sendmsg(tcp->GetSocket(), &msg, 0);
+    if (result < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      okflag = false;
+      break;
+    }
+
+    // Skip past whatever was sent, which may have been only part of it.
+    size_t sent = (size_t)result;
+    while (next < iovecs.size() && sent >= iovecs[next].iov_len) {
+      sent -= iovecs[next].iov_len;
+      ++next;
+    }
+    if (sent > 0) {
+      iovecs[next].iov_base = (char *)iovecs[next].iov_base + sent;
+      iovecs[next].iov_len -= sent;
+    }
+  }
+
+  if (net_cat.is_spam()) {
+    net_cat.spam()
+      << "Sent " << num_datagrams << " TCP datagrams to " << (void *)this
+      << ", ok = " << okflag << "\n";
+  }
+
+  return check_send_error(okflag);
+
+#else
+  // Otherwise, we simply collect the datagrams together and send them with
+  // one call.
+  for (int i = 0; i < num_datagrams; ++i) {
+    if (header_size != 0) {
+      _queued_data.append(headers, i * header_size, header_size);
+    }
+    _queued_data += datagrams[i].get_message();
+    _queued_count++;
+  }
+  return do_flush();
+#endif
+}
+
 /**
  * The private implementation of flush(), this assumes the _write_mutex is
  * already held.
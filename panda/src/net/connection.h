@@ -58,6 +58,8 @@ PUBLISHED:
 private:
   bool send_datagram(const NetDatagram &datagram, int tcp_header_size);
   bool send_raw_datagram(const NetDatagram &datagram);
+  bool send_datagrams(const NetDatagram *datagrams, int num_datagrams,
+                      int tcp_header_size, bool raw_mode);
   bool do_flush();
   bool check_send_error(bool okflag);
 
@@ -33,6 +33,10 @@
 #include <ifaddrs.h>
 #endif
 
+#if !defined(CPPPARSER) && !defined(_WIN32)
+#include <poll.h>
+#endif
+
 using std::stringstream;
 using std::string;
 
@@ -236,6 +240,27 @@ open_TCP_server_rendezvous(const NetAddress &address, int backlog) {
   return connection;
 }
 
+/**
+ * Polls the indicated socket, without blocking, to see whether it is ready for
+ * writing.  Returns 1 if it is, 0 if it is not, or -1 on error.  Where
+ * available, this uses poll() rather than select(), which cannot handle
+ * socket descriptors beyond FD_SETSIZE.
+ */
+static int
+wait_for_write(Socket_TCP *socket) {
+#ifdef _WIN32
+  Socket_fdset fset;
+  fset.setForSocket(*socket);
+  return fset.WaitForWrite(true, 0);
+#else
+  struct pollfd pfd;
+  pfd.fd = socket->GetSocket();
+  pfd.events = POLLOUT;
+  pfd.revents = 0;
+  return poll(&pfd, 1, 0);
+#endif
+}
+
 /**
  * Attempts to establish a TCP client connection to a server at the indicated
  * address.  If the connection is not established within timeout_ms
@@ -253,9 +278,7 @@ open_TCP_client_connection(const NetAddress &address, int timeout_ms) {
     TrueClock *clock = TrueClock::get_global_ptr();
     double start = clock->get_short_time();
     Thread::force_yield();
-    Socket_fdset fset;
-    fset.setForSocket(*socket);
-    int ready = fset.WaitForWrite(true, 0);
+    int ready = wait_for_write(socket);
     while (ready == 0) {
       double elapsed = clock->get_short_time() - start;
       if (elapsed * 1000.0 > timeout_ms) {
@@ -264,8 +287,7 @@ open_TCP_client_connection(const NetAddress &address, int timeout_ms) {
         break;
       }
       Thread::force_yield();
-      fset.setForSocket(*socket);
-      ready = fset.WaitForWrite(true, 0);
+      ready = wait_for_write(socket);
     }
   }
 
@@ -378,9 +400,14 @@ close_connection(const PT(Connection) &connection) {
  * This only works if all ConnectionReaders and ConnectionListeners are non-
  * threaded.  If any threaded ConnectionReaders are part of the
  * ConnectionManager, the timeout value is implicitly treated as 0.
+ *
+ * Any datagrams held back by a coalescing ConnectionWriter are sent first
+ * (see flush_writers()), since nothing else would send them while we wait.
  */
 bool ConnectionManager::
 wait_for_readers(double timeout) {
+  flush_writers();
+
   bool block_forever = false;
   if (timeout < 0.0) {
     block_forever = true;
@@ -452,6 +479,59 @@ wait_for_readers(double timeout) {
   return false;
 }
 
+/**
+ * Calls consider_flush() on each of the non-threaded, coalescing
+ * ConnectionWriters that serve this ConnectionManager, sending the datagrams
+ * that have been held back for longer than the writer's flush deadline.
+ * Such a writer only checks the deadline when it is asked to, so this must
+ * be called periodically.  Polling ConnectionReaders do this each time they
+ * are polled.
+ */
+void ConnectionManager::
+consider_flush_writers() {
+  Writers writers;
+  {
+    LightMutexHolder holder(_set_mutex);
+    if (_writers.empty()) {
+      return;
+    }
+    // Get a copy first, so we can release the lock before sending.
+    writers = _writers;
+  }
+  Writers::iterator wi;
+  for (wi = writers.begin(); wi != writers.end(); ++wi) {
+    ConnectionWriter *writer = (*wi);
+    if (writer->is_immediate() && writer->get_coalesce()) {
+      writer->consider_flush();
+    }
+  }
+}
+
+/**
+ * Calls flush() on each of the non-threaded, coalescing ConnectionWriters
+ * that serve this ConnectionManager, sending all of the datagrams they have
+ * held back.  Threaded writers send their datagrams on their own.
+ */
+void ConnectionManager::
+flush_writers() {
+  Writers writers;
+  {
+    LightMutexHolder holder(_set_mutex);
+    if (_writers.empty()) {
+      return;
+    }
+    // Get a copy first, so we can release the lock before sending.
+    writers = _writers;
+  }
+  Writers::iterator wi;
+  for (wi = writers.begin(); wi != writers.end(); ++wi) {
+    ConnectionWriter *writer = (*wi);
+    if (writer->is_immediate() && writer->get_coalesce()) {
+      writer->flush();
+    }
+  }
+}
+
 /**
  * Returns the name of this particular machine on the network, if available,
  * or the empty string if the hostname cannot be determined.
@@ -58,6 +58,8 @@ PUBLISHED:
 
   bool close_connection(const PT(Connection) &connection);
   BLOCKING bool wait_for_readers(double timeout);
+  BLOCKING void consider_flush_writers();
+  BLOCKING void flush_writers();
 
   static std::string get_host_name();
 
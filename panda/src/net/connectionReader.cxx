@@ -27,10 +27,79 @@
 #include "atomicAdjust.h"
 #include "config_downloader.h"
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <errno.h>
+#include <unistd.h>
+#define HAVE_EPOLL 1
+#define HAVE_RECVMMSG 1
+#endif
+
 using std::min;
 
 static const int read_buffer_size = maximum_udp_datagram + datagram_udp_header_size;
 
+#ifdef HAVE_EPOLL
+// The maximum number of events to collect from a single epoll_wait() call.
+static const int max_epoll_events = 256;
+#endif
+
+// The upper limit on net-udp-batch-size.
+static const int max_udp_batch_size = 32;
+
+// The special return values of read_udp_packets().  udp_no_data means that
+// the socket had no data waiting after all, which is not an error.
+static const int udp_no_data = 0;
+static const int udp_error = -1;
+static const int udp_closed = -2;
+
+// The largest part of a TCP datagram that is allocated before its data has
+// actually arrived.  Beyond this, the buffer grows as the data is read.
+static const int tcp_initial_buffer_size = 65536;
+
+/**
+ * Reads up to max_packets packets from the indicated UDP socket into
+ * consecutive read_buffer_size blocks of the buffer, and fills in their
+ * lengths and source addresses.  Where recvmmsg() is available, this reads
+ * all of them with a single system call; otherwise, only one packet is read.
+ * Returns the number of packets read, or one of the udp_* codes below.
+ */
+static int
+read_udp_packets(Socket_UDP *socket, char *buffer, int *lengths,
+                 Socket_Address *addresses, int max_packets) {
+#ifdef HAVE_RECVMMSG
+  if (max_packets > 1) {
+    struct mmsghdr msgs[max_udp_batch_size];
+    struct iovec iovecs[max_udp_batch_size];
+    memset(msgs, 0, sizeof(struct mmsghdr) * max_packets);
+    for (int i = 0; i < max_packets; ++i) {
+      iovecs[i].iov_base = buffer + i * read_buffer_size;
+      iovecs[i].iov_len = read_buffer_size;
+      msgs[i].msg_hdr.msg_iov = &iovecs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &addresses[i].GetAddressInfo();
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+
+    int num_packets = recvmmsg(socket->GetSocket(), msgs, max_packets,
+                               MSG_DONTWAIT, nullptr);
+    if (num_packets < 0) {
+      return (errno == EAGAIN || errno == EWOULDBLOCK) ? udp_no_data : udp_error;
+    }
+    for (int i = 0; i < num_packets; ++i) {
+      lengths[i] = (int)msgs[i].msg_len;
+    }
+    return num_packets;
+  }
+#endif  // HAVE_RECVMMSG
+
+  lengths[0] = read_buffer_size;
+  if (!socket->GetPacket(buffer, &lengths[0], addresses[0])) {
+    return udp_error;
+  }
+  return (lengths[0] == 0) ? udp_closed : 1;
+}
+
 /**
  *
  */
@@ -40,6 +109,8 @@ SocketInfo(const PT(Connection) &connection) :
 {
   _busy = false;
   _error = false;
+  _removed = false;
+  _epoll_registered = false;
 }
 
 /**
@@ -113,6 +184,20 @@ ConnectionReader(ConnectionManager *manager, int num_threads,
 
   _currently_polling_thread = -1;
 
+  _epoll_fd = -1;
+  _epoll_events = nullptr;
+#ifdef HAVE_EPOLL
+  if (net_use_epoll) {
+    _epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (_epoll_fd < 0) {
+      net_cat.warning()
+        << "Unable to create epoll descriptor; using select() instead.\n";
+    } else {
+      _epoll_events = new epoll_event[max_epoll_events];
+    }
+  }
+#endif  // HAVE_EPOLL
+
   std::string reader_thread_name = thread_name;
   if (thread_name.empty()) {
     reader_thread_name = "ReaderThread";
@@ -158,6 +243,13 @@ ConnectionReader::
       sinfo->_connection.clear();
     }
   }
+
+#ifdef HAVE_EPOLL
+  if (_epoll_fd >= 0) {
+    close(_epoll_fd);
+    delete[] _epoll_events;
+  }
+#endif  // HAVE_EPOLL
 }
 
 /**
@@ -187,7 +279,26 @@ add_connection(Connection *connection) {
     }
   }
 
-  _sockets.push_back(new SocketInfo(connection));
+  SocketInfo *sinfo = new SocketInfo(connection);
+  _sockets.push_back(sinfo);
+
+#ifdef HAVE_EPOLL
+  if (_epoll_fd >= 0) {
+    // The socket is registered edge-triggered and one-shot: once it has
+    // reported activity, it is left alone until finish_socket() rearms it,
+    // which takes the place of the _busy check in rebuild_select_list().
+    epoll_event event;
+    event.events = EPOLLIN | EPOLLET | EPOLLONESHOT;
+    event.data.ptr = sinfo;
+    if (epoll_ctl(_epoll_fd, EPOLL_CTL_ADD, sinfo->get_socket()->GetSocket(), &event) == 0) {
+      sinfo->_epoll_registered = true;
+    } else {
+      net_cat.error()
+        << "Unable to add socket to epoll set: " << strerror(errno) << "\n";
+      sinfo->_error = true;
+    }
+  }
+#endif  // HAVE_EPOLL
 
   return true;
 }
@@ -214,7 +325,17 @@ remove_connection(Connection *connection) {
     return false;
   }
 
-  _removed_sockets.push_back(*si);
+  SocketInfo *sinfo = (*si);
+  sinfo->_removed = true;
+#ifdef HAVE_EPOLL
+  if (sinfo->_epoll_registered) {
+    epoll_event event;
+    epoll_ctl(_epoll_fd, EPOLL_CTL_DEL, sinfo->get_socket()->GetSocket(), &event);
+    sinfo->_epoll_registered = false;
+  }
+#endif  // HAVE_EPOLL
+
+  _removed_sockets.push_back(sinfo);
   _sockets.erase(si);
 
   return true;
@@ -255,6 +376,10 @@ is_connection_ok(Connection *connection) {
  * will return true).
  *
  * It is not necessary to call this explicitly for a QueuedConnectionReader.
+ *
+ * This also gives the coalescing ConnectionWriters of the same
+ * ConnectionManager a chance to send datagrams whose flush deadline has
+ * passed; see ConnectionManager::consider_flush_writers().
  */
 void ConnectionReader::
 poll() {
@@ -262,6 +387,10 @@ poll() {
     return;
   }
 
+  if (_manager != nullptr) {
+    _manager->consider_flush_writers();
+  }
+
   SocketInfo *sinfo = get_next_available_socket(false, -2);
   if (sinfo != nullptr) {
     double max_poll_cycle = get_net_max_poll_cycle();
@@ -421,6 +550,44 @@ finish_socket(SocketInfo *sinfo) {
 
   // By marking the SocketInfo nonbusy, we make it available for future polls.
   sinfo->_busy = false;
+
+#ifdef HAVE_EPOLL
+  if (sinfo->_epoll_registered) {
+    LightMutexHolder holder(_sockets_mutex);
+    if (sinfo->_epoll_registered && !sinfo->_error) {
+      // Rearm the socket.  If there is still unread data on it, this
+      // immediately reports it again.
+      epoll_event event;
+      event.events = EPOLLIN | EPOLLET | EPOLLONESHOT;
+      event.data.ptr = sinfo;
+      epoll_ctl(_epoll_fd, EPOLL_CTL_MOD, sinfo->get_socket()->GetSocket(), &event);
+    }
+  }
+#endif  // HAVE_EPOLL
+}
+
+/**
+ * An internal function called when several datagrams have been read at once.
+ * The default implementation passes each of them to receive_datagram(), but
+ * a derived class may override this to process them more efficiently.
+ */
+void ConnectionReader::
+receive_datagrams(const NetDatagram *datagrams, int num_datagrams) {
+  for (int i = 0; i < num_datagrams; ++i) {
+    receive_datagram(datagrams[i]);
+  }
+}
+
+/**
+ * Returns a buffer from the pool containing a copy of the indicated data.
+ */
+PTA_uchar ConnectionReader::
+copy_to_buffer(const char *data, int size) {
+  PTA_uchar buffer = _buffer_pool.get_buffer(size);
+  if (size > 0) {
+    memcpy(buffer.p(), data, size);
+  }
+  return buffer;
 }
 
 /**
@@ -452,19 +619,16 @@ bool ConnectionReader::
 process_incoming_udp_data(SocketInfo *sinfo) {
   Socket_UDP *socket;
   DCAST_INTO_R(socket, sinfo->get_socket(), false);
-  Socket_Address addr;
 
-  // Read as many bytes as we can.
-  char buffer[read_buffer_size];
-  int bytes_read = read_buffer_size;
+  // Read as many packets as we can, up to net-udp-batch-size.
+  int max_packets = std::max(1, std::min((int)net_udp_batch_size, max_udp_batch_size));
+  char buffer[read_buffer_size * max_udp_batch_size];
+  int lengths[max_udp_batch_size];
+  Socket_Address addrs[max_udp_batch_size];
 
-  bool okflag = socket->GetPacket(buffer, &bytes_read, addr);
+  int num_packets = read_udp_packets(socket, buffer, lengths, addrs, max_packets);
 
-  if (!okflag) {
-    finish_socket(sinfo);
-    return false;
-
-  } else if (bytes_read == 0) {
+  if (num_packets == udp_closed) {
     // The socket was closed (!).  This shouldn't happen with a UDP
     // connection.  Oh well.  Report that and return.
     if (_manager != nullptr) {
@@ -472,25 +636,13 @@ process_incoming_udp_data(SocketInfo *sinfo) {
     }
     finish_socket(sinfo);
     return false;
-  }
 
-  // Since we are not running in raw mode, we decode the header to determine
-  // how big the datagram is.  This means we must have read at least a full
-  // header.
-  if (bytes_read < datagram_udp_header_size) {
-    net_cat.error()
-      << "Did not read entire header, discarding UDP datagram.\n";
+  } else if (num_packets <= 0) {
+    // Either an error, or another thread got to the data first.
     finish_socket(sinfo);
-    return true;
+    return false;
   }
 
-  DatagramUDPHeader header(buffer);
-
-  char *dp = buffer + datagram_udp_header_size;
-  bytes_read -= datagram_udp_header_size;
-
-  NetDatagram datagram(dp, bytes_read);
-
   // Now that we've read all the data, it's time to finish the socket so
   // another thread can read the next datagram.
   finish_socket(sinfo);
@@ -499,13 +651,38 @@ process_incoming_udp_data(SocketInfo *sinfo) {
     return false;
   }
 
-  // And now do whatever we need to do to process the datagram.
-  if (!header.verify_datagram(datagram)) {
-    net_cat.error()
-      << "Ignoring invalid UDP datagram.\n";
-  } else {
+  NetDatagram datagrams[max_udp_batch_size];
+  int num_datagrams = 0;
+
+  for (int i = 0; i < num_packets; ++i) {
+    char *packet = buffer + i * read_buffer_size;
+    int bytes_read = lengths[i];
+
+    // Since we are not running in raw mode, we decode the header to determine
+    // how big the datagram is.  This means we must have read at least a full
+    // header.
+    if (bytes_read < datagram_udp_header_size) {
+      net_cat.error()
+        << "Did not read entire header, discarding UDP datagram.\n";
+      continue;
+    }
+
+    DatagramUDPHeader header(packet);
+    bytes_read -= datagram_udp_header_size;
+
+    NetDatagram &datagram = datagrams[num_datagrams];
+    datagram.set_array(copy_to_buffer(packet + datagram_udp_header_size, bytes_read));
+
+    // And now do whatever we need to do to process the datagram.
+    if (!header.verify_datagram(datagram)) {
+      net_cat.error()
+        << "Ignoring invalid UDP datagram.\n";
+      datagram.clear();
+      continue;
+    }
+
     datagram.set_connection(sinfo->_connection);
-    datagram.set_address(NetAddress(addr));
+    datagram.set_address(NetAddress(addrs[i]));
 
     if (net_cat.is_spam()) {
       net_cat.spam()
@@ -514,8 +691,13 @@ process_incoming_udp_data(SocketInfo *sinfo) {
         << " bytes on " << (void *)datagram.get_connection()
         << " from " << datagram.get_address() << "\n";
     }
+    ++num_datagrams;
+  }
 
-    receive_datagram(datagram);
+  if (num_datagrams == 1) {
+    receive_datagram(datagrams[0]);
+  } else if (num_datagrams > 1) {
+    receive_datagrams(datagrams, num_datagrams);
   }
 
   return true;
@@ -573,34 +755,52 @@ process_incoming_tcp_data(SocketInfo *sinfo) {
   DatagramTCPHeader header(buffer, _tcp_header_size);
   int size = header.get_datagram_size(_tcp_header_size);
 
-  // We have to loop until the entire datagram is read.
-  NetDatagram datagram;
+  if (size < 0 || size > net_max_datagram_size) {
+    // There is no way to find the next datagram in the stream after this, so
+    // we have to treat this like a closed connection.
+    net_cat.error()
+      << "Received TCP datagram header with invalid size " << size
+      << ", resetting connection.\n";
+    if (_manager != nullptr) {
+      _manager->connection_reset(sinfo->_connection, 0);
+    }
+    finish_socket(sinfo);
+    return false;
+  }
+
+  // Now that we know how big the datagram is, we can read it directly into
+  // its final buffer.  We have to loop until the entire datagram is read.
+  // Since the size came from the peer, a large datagram's buffer is only
+  // grown as its data actually arrives.
+  int capacity = std::min(size, std::max(tcp_initial_buffer_size, (int)net_receive_buffer_max_size));
+  PTA_uchar data = _buffer_pool.get_buffer(capacity);
+  int bytes_received = 0;
 
-  while (!_shutdown && (int)datagram.get_length() < size) {
+  while (!_shutdown && bytes_received < size) {
     int bytes_read;
 
-    int read_bytes = read_buffer_size;
+    if (bytes_received == capacity) {
+      capacity = (int)std::min((size_t)size, (size_t)capacity * 2);
+      data.v().resize(capacity);
+    }
+
+    int read_bytes = capacity - bytes_received;
 #ifdef SIMPLE_THREADS
     // In the SIMPLE_THREADS case, we want to limit the number of bytes we
     // read in a single epoch, to minimize the impact on the other threads.
-    read_bytes = min(read_buffer_size, (int)net_max_read_per_epoch);
+    read_bytes = min(read_bytes, (int)net_max_read_per_epoch);
 #endif
 
-    bytes_read =
-      socket->RecvData(buffer, min(read_bytes,
-                                   (int)(size - datagram.get_length())));
+    char *dp = (char *)data.p() + bytes_received;
+    bytes_read = socket->RecvData(dp, read_bytes);
 #if defined(HAVE_THREADS) && defined(SIMPLE_THREADS)
     while (bytes_read < 0 && socket->GetLastError() == LOCAL_BLOCKING_ERROR &&
            socket->Active()) {
       Thread::force_yield();
-      bytes_read =
-        socket->RecvData(buffer, min(read_bytes,
-                                     (int)(size - datagram.get_length())));
+      bytes_read = socket->RecvData(dp, read_bytes);
     }
 #endif  // SIMPLE_THREADS
 
-    char *dp = buffer;
-
     if (bytes_read <= 0) {
       // The socket was closed.  Report that and return.
       if (_manager != nullptr) {
@@ -610,20 +810,13 @@ process_incoming_tcp_data(SocketInfo *sinfo) {
       return false;
     }
 
-    int datagram_bytes =
-      min(bytes_read, (int)(size - datagram.get_length()));
-    datagram.append_data(dp, datagram_bytes);
-
-    if (bytes_read > datagram_bytes) {
-      // There were some extra bytes at the end of the datagram.  Maybe the
-      // beginning of the next datagram?  Huh.
-      net_cat.error()
-        << "Discarding " << bytes_read - datagram_bytes
-        << " bytes following TCP datagram.\n";
-    }
+    bytes_received += bytes_read;
     Thread::consider_yield();
   }
 
+  NetDatagram datagram;
+  datagram.set_array(data);
+
   // Now that we've read all the data, it's time to finish the socket so
   // another thread can read the next datagram.
   finish_socket(sinfo);
@@ -661,19 +854,16 @@ bool ConnectionReader::
 process_raw_incoming_udp_data(SocketInfo *sinfo) {
   Socket_UDP *socket;
   DCAST_INTO_R(socket, sinfo->get_socket(), false);
-  Socket_Address addr;
 
-  // Read as many bytes as we can.
-  char buffer[read_buffer_size];
-  int bytes_read = read_buffer_size;
+  // Read as many packets as we can, up to net-udp-batch-size.
+  int max_packets = std::max(1, std::min((int)net_udp_batch_size, max_udp_batch_size));
+  char buffer[read_buffer_size * max_udp_batch_size];
+  int lengths[max_udp_batch_size];
+  Socket_Address addrs[max_udp_batch_size];
 
-  bool okflag = socket->GetPacket(buffer, &bytes_read, addr);
+  int num_packets = read_udp_packets(socket, buffer, lengths, addrs, max_packets);
 
-  if (!okflag) {
-    finish_socket(sinfo);
-    return false;
-
-  } else if (bytes_read == 0) {
+  if (num_packets == udp_closed) {
     // The socket was closed (!).  This shouldn't happen with a UDP
     // connection.  Oh well.  Report that and return.
     if (_manager != nullptr) {
@@ -681,10 +871,12 @@ process_raw_incoming_udp_data(SocketInfo *sinfo) {
     }
     finish_socket(sinfo);
     return false;
-  }
 
-  // In raw mode, we simply extract all the bytes and make that a datagram.
-  NetDatagram datagram(buffer, bytes_read);
+  } else if (num_packets <= 0) {
+    // Either an error, or another thread got to the data first.
+    finish_socket(sinfo);
+    return false;
+  }
 
   // Now that we've read all the data, it's time to finish the socket so
   // another thread can read the next datagram.
@@ -694,17 +886,28 @@ process_raw_incoming_udp_data(SocketInfo *sinfo) {
     return false;
   }
 
-  datagram.set_connection(sinfo->_connection);
-  datagram.set_address(NetAddress(addr));
+  NetDatagram datagrams[max_udp_batch_size];
 
-  if (net_cat.is_spam()) {
-    net_cat.spam()
-      << "Received raw UDP datagram with " << datagram.get_length()
-      << " bytes on " << (void *)datagram.get_connection()
-      << " from " << datagram.get_address() << "\n";
+  for (int i = 0; i < num_packets; ++i) {
+    // In raw mode, we simply extract all the bytes and make that a datagram.
+    NetDatagram &datagram = datagrams[i];
+    datagram.set_array(copy_to_buffer(buffer + i * read_buffer_size, lengths[i]));
+    datagram.set_connection(sinfo->_connection);
+    datagram.set_address(NetAddress(addrs[i]));
+
+    if (net_cat.is_spam()) {
+      net_cat.spam()
+        << "Received raw UDP datagram with " << datagram.get_length()
+        << " bytes on " << (void *)datagram.get_connection()
+        << " from " << datagram.get_address() << "\n";
+    }
   }
 
-  receive_datagram(datagram);
+  if (num_packets == 1) {
+    receive_datagram(datagrams[0]);
+  } else {
+    receive_datagrams(datagrams, num_packets);
+  }
 
   return true;
 }
@@ -738,7 +941,8 @@ process_raw_incoming_tcp_data(SocketInfo *sinfo) {
   }
 
   // In raw mode, we simply extract all the bytes and make that a datagram.
-  NetDatagram datagram(buffer, bytes_read);
+  NetDatagram datagram;
+  datagram.set_array(copy_to_buffer(buffer, bytes_read));
 
   // Now that we've read all the data, it's time to finish the socket so
   // another thread can read the next datagram.
@@ -795,6 +999,10 @@ thread_run(int thread_index) {
  */
 ConnectionReader::SocketInfo *ConnectionReader::
 get_next_available_socket(bool allow_block, int current_thread_index) {
+  if (_epoll_fd >= 0) {
+    return get_next_available_epoll_socket(allow_block, current_thread_index);
+  }
+
   // Go to sleep on the select() mutex.  This guarantees that only one thread
   // is in this function at a time.
   MutexHolder holder(_select_mutex);
@@ -803,7 +1011,13 @@ get_next_available_socket(bool allow_block, int current_thread_index) {
     // First, check the result from the previous select call.  If there are
     // any sockets remaining there, process them first.
     while (!_shutdown && _num_results > 0) {
-      nassertr(_next_index < (int)_selecting_sockets.size(), nullptr);
+      if (_next_index >= (int)_selecting_sockets.size()) {
+        // A socket was closed by another thread while we were waiting on it,
+        // so its result can't be matched up with it any more.  Give up on
+        // this round; the select list is rebuilt next time.
+        _num_results = 0;
+        break;
+      }
       int i = _next_index;
       _next_index++;
 
@@ -874,6 +1088,66 @@ get_next_available_socket(bool allow_block, int current_thread_index) {
 }
 
 
+/**
+ * The epoll version of get_next_available_socket().
+ */
+ConnectionReader::SocketInfo *ConnectionReader::
+get_next_available_epoll_socket(bool allow_block, int current_thread_index) {
+#ifdef HAVE_EPOLL
+  MutexHolder holder(_select_mutex);
+
+  while (!_shutdown) {
+    // First, hand out the results of the previous epoll_wait() call.
+    while (_next_index < _num_results) {
+      SocketInfo *sinfo = (SocketInfo *)_epoll_events[_next_index].data.ptr;
+      _next_index++;
+
+      LightMutexHolder sockets_holder(_sockets_mutex);
+      if (!sinfo->_removed && !sinfo->_error) {
+        sinfo->_busy = true;
+        return sinfo;
+      }
+    }
+
+    // Now that no results refer to them any more, we can delete the sockets
+    // that have been removed in the meantime.
+    {
+      LightMutexHolder sockets_holder(_sockets_mutex);
+      delete_removed_sockets();
+    }
+
+    AtomicAdjust::set(_currently_polling_thread, current_thread_index);
+
+    int timeout = (int)(get_net_max_block() * 1000.0);
+    if (!allow_block) {
+      timeout = 0;
+    }
+#if defined(HAVE_THREADS) && defined(SIMPLE_THREADS)
+    timeout = 0;
+#endif
+
+    _next_index = 0;
+    _num_results = epoll_wait(_epoll_fd, _epoll_events, max_epoll_events, timeout);
+    if (_num_results < 0) {
+      _num_results = 0;
+      if (errno != EINTR) {
+        Thread::force_yield();
+        return nullptr;
+      }
+
+    } else if (_num_results == 0) {
+      if (!allow_block) {
+        return nullptr;
+      }
+      // We reached net_max_block; go back and check the shutdown flag.
+      Thread::force_yield();
+    }
+  }
+#endif  // HAVE_EPOLL
+
+  return nullptr;
+}
+
 /**
  * Rebuilds the _fdset and _selecting_sockets arrays based on the sockets that
  * are currently available for selecting.
@@ -895,8 +1169,18 @@ rebuild_select_list() {
 
   // This is also a fine time to delete the contents of the _removed_sockets
   // list.
+  delete_removed_sockets();
+}
+
+/**
+ * Deletes the sockets on the _removed_sockets list that are no longer busy.
+ * Assumes _sockets_mutex is held.
+ */
+void ConnectionReader::
+delete_removed_sockets() {
   if (!_removed_sockets.empty()) {
     Sockets still_busy_sockets;
+    Sockets::const_iterator si;
     for (si = _removed_sockets.begin(); si != _removed_sockets.end(); ++si) {
       SocketInfo *sinfo = (*si);
       if (sinfo->_busy) {
@@ -916,6 +1200,13 @@ rebuild_select_list() {
  */
 void ConnectionReader::
 accumulate_fdset(Socket_fdset &fdset) {
+  if (_epoll_fd >= 0) {
+    // The epoll descriptor itself becomes readable when any of the sockets
+    // it watches has data available.
+    fdset.setForSocketNative(_epoll_fd);
+    return;
+  }
+
   LightMutexHolder holder(_sockets_mutex);
   Sockets::const_iterator si;
   for (si = _sockets.begin(); si != _sockets.end(); ++si) {
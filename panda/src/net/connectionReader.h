@@ -25,9 +25,11 @@
 #include "pset.h"
 #include "socket_fdset.h"
 #include "atomicAdjust.h"
+#include "receiveBufferPool.h"
 
 class NetDatagram;
 class ConnectionManager;
+struct epoll_event;
 class Socket_Address;
 class Socket_IP;
 
@@ -42,6 +44,11 @@ class Socket_IP;
  * cannot be changed, but the set of sockets that is to be monitored may be
  * constantly modified at will.
  *
+ * On Linux, if net-use-epoll is true when the ConnectionReader is created, the
+ * sockets are monitored with epoll instead of select().  This is not limited
+ * to FD_SETSIZE sockets, and costs nothing per idle socket, so it is much
+ * better suited to servers with many thousands of connections.
+ *
  * This is an abstract class because it doesn't define how to process each
  * received datagram.  See QueuedConnectionReader.  Also note that
  * ConnectionListener derives from this class, extending it to accept
@@ -72,6 +79,7 @@ PUBLISHED:
 
   ConnectionManager *get_manager() const;
   INLINE bool is_polling() const;
+  INLINE bool is_using_epoll() const;
   int get_num_threads() const;
 
   void set_raw_mode(bool mode);
@@ -85,6 +93,7 @@ PUBLISHED:
 protected:
   virtual void flush_read_connection(Connection *connection);
   virtual void receive_datagram(const NetDatagram &datagram)=0;
+  virtual void receive_datagrams(const NetDatagram *datagrams, int num_datagrams);
 
   class SocketInfo {
   public:
@@ -95,11 +104,14 @@ protected:
     PT(Connection) _connection;
     bool _busy;
     bool _error;
+    bool _removed;
+    bool _epoll_registered;
   };
   typedef pvector<SocketInfo *> Sockets;
 
   void clear_manager();
   void finish_socket(SocketInfo *sinfo);
+  PTA_uchar copy_to_buffer(const char *data, int size);
 
   virtual bool process_incoming_data(SocketInfo *sinfo);
   virtual bool process_incoming_udp_data(SocketInfo *sinfo);
@@ -119,13 +131,20 @@ protected:
   // Any operations on _sockets are protected by this mutex.
   LightMutex _sockets_mutex;
 
+  // Incoming datagrams are received into buffers from this pool.
+  ReceiveBufferPool _buffer_pool;
+
 private:
   void thread_run(int thread_index);
 
   SocketInfo *get_next_available_socket(bool allow_block,
                                         int current_thread_index);
 
+  SocketInfo *get_next_available_epoll_socket(bool allow_block,
+                                              int current_thread_index);
+
   void rebuild_select_list();
+  void delete_removed_sockets();
   void accumulate_fdset(Socket_fdset &fdset);
 
 private:
@@ -162,6 +181,12 @@ private:
   // thread is so waiting.
   AtomicAdjust::Integer _currently_polling_thread;
 
+  // When the epoll backend is in use, this is the epoll descriptor, and
+  // _epoll_events receives the results of epoll_wait(); _next_index and
+  // _num_results walk through it.  Otherwise, _epoll_fd is -1.
+  int _epoll_fd;
+  epoll_event *_epoll_events;
+
   friend class ConnectionManager;
   friend class ReaderThread;
 };
@@ -19,6 +19,9 @@
 #include "socket_udp.h"
 #include "pnotify.h"
 #include "config_downloader.h"
+#include "trueClock.h"
+#include "lightMutexHolder.h"
+#include "mutexHolder.h"
 
 /**
  *
@@ -70,6 +73,11 @@ ConnectionWriter(ConnectionManager *manager, int num_threads,
   _immediate = (num_threads <= 0);
   _shutdown = false;
 
+  _coalesce = net_writer_coalesce;
+  _flush_deadline = net_writer_flush_deadline;
+  _num_pending = 0;
+  _pending_start = 0.0;
+
   std::string writer_thread_name = thread_name;
   if (thread_name.empty()) {
     writer_thread_name = "WriterThread";
@@ -149,6 +157,9 @@ send(const Datagram &datagram, const PT(Connection) &connection, bool block) {
   copy.set_connection(connection);
 
   if (_immediate) {
+    if (_coalesce) {
+      return add_pending(copy);
+    }
     if (_raw_mode) {
       return connection->send_raw_datagram(copy);
     } else {
@@ -193,6 +204,9 @@ send(const Datagram &datagram, const PT(Connection) &connection,
   copy.set_address(address);
 
   if (_immediate) {
+    if (_coalesce) {
+      return add_pending(copy);
+    }
     if (_raw_mode) {
       return connection->send_raw_datagram(copy);
     } else {
@@ -279,6 +293,160 @@ get_tcp_header_size() const {
   return _tcp_header_size;
 }
 
+/**
+ * Enables or disables coalescing mode.  In this mode, datagrams are not sent
+ * one at a time, but are gathered up per connection and sent together, with
+ * as few system calls as possible.  This greatly reduces the cost of sending
+ * many small datagrams, at the expense of some latency.
+ *
+ * If the ConnectionWriter has threads, each thread gathers up the datagrams
+ * that are queued until the flush deadline expires (see
+ * set_flush_deadline()), and then sends them all.  If it has no threads,
+ * datagrams are held until flush() is called, or until the flush deadline
+ * has passed when send() or consider_flush() is next called.
+ */
+void ConnectionWriter::
+set_coalesce(bool coalesce) {
+  if (!coalesce && _coalesce) {
+    _coalesce = false;
+    flush();
+  }
+  _coalesce = coalesce;
+}
+
+/**
+ * Returns the current setting of the coalescing flag.  See set_coalesce().
+ */
+bool ConnectionWriter::
+get_coalesce() const {
+  return _coalesce;
+}
+
+/**
+ * Sets the maximum amount of time, in seconds, that a datagram is held back
+ * in coalescing mode while waiting for more datagrams to send along with it.
+ * This only has meaning if set_coalesce() has been set to true.
+ */
+void ConnectionWriter::
+set_flush_deadline(double flush_deadline) {
+  _flush_deadline = flush_deadline;
+}
+
+/**
+ * Returns the current setting of the flush deadline.  See
+ * set_flush_deadline().
+ */
+double ConnectionWriter::
+get_flush_deadline() const {
+  return _flush_deadline;
+}
+
+/**
+ * Returns the number of datagrams that have been gathered up in coalescing
+ * mode, but not yet sent.
+ */
+int ConnectionWriter::
+get_num_pending() const {
+  LightMutexHolder holder(_pending_lock);
+  return _num_pending;
+}
+
+/**
+ * Sends the datagrams gathered up in coalescing mode, if the flush deadline
+ * has passed since the first of them was sent.  Returns true if successful,
+ * false if there was a transmission error.  An application that uses an
+ * immediate, coalescing ConnectionWriter should call this periodically.
+ */
+bool ConnectionWriter::
+consider_flush() {
+  {
+    LightMutexHolder holder(_pending_lock);
+    if (_num_pending == 0) {
+      return true;
+    }
+    double elapsed =
+      TrueClock::get_global_ptr()->get_short_time() - _pending_start;
+    if (elapsed >= 0.0 && elapsed < _flush_deadline) {
+      return true;
+    }
+  }
+  return flush();
+}
+
+/**
+ * Immediately sends all of the datagrams gathered up in coalescing mode.
+ * Returns true if successful, false if there was a transmission error on
+ * any of the connections.
+ */
+bool ConnectionWriter::
+flush() {
+  MutexHolder flush_holder(_flush_lock);
+
+  Pending pending;
+  {
+    LightMutexHolder holder(_pending_lock);
+    if (_num_pending == 0) {
+      return true;
+    }
+    pending.swap(_pending);
+    _num_pending = 0;
+  }
+
+  bool okflag = true;
+  Pending::iterator pi;
+  for (pi = pending.begin(); pi != pending.end(); ++pi) {
+    Connection *connection = (*pi).second._connection;
+    const pvector<NetDatagram> &datagrams = (*pi).second._datagrams;
+    if (!connection->get_socket()->Active()) {
+      // The connection was closed in the meantime.
+      continue;
+    }
+    if (!connection->send_datagrams(&datagrams[0], (int)datagrams.size(),
+                                    _tcp_header_size, _raw_mode)) {
+      okflag = false;
+    }
+  }
+
+  return okflag;
+}
+
+/**
+ * Adds the datagram to the set of datagrams waiting to be sent in coalescing
+ * mode.  In the immediate case, the datagrams are flushed if the deadline has
+ * passed or too many are waiting, and the return value is the result of the
+ * flush.  In the threaded case, the return value is true if the thread
+ * should flush now.
+ */
+bool ConnectionWriter::
+add_pending(const NetDatagram &datagram) {
+  bool flush_now;
+  {
+    LightMutexHolder holder(_pending_lock);
+    double now = TrueClock::get_global_ptr()->get_short_time();
+    if (_num_pending == 0) {
+      _pending_start = now;
+    }
+
+    PendingDatagrams &pending = _pending[datagram.get_connection()];
+    if (pending._connection == nullptr) {
+      pending._connection = datagram.get_connection();
+    }
+    pending._datagrams.push_back(datagram);
+    ++_num_pending;
+
+    flush_now = (_num_pending >= _queue.get_max_queue_size());
+    if (_immediate) {
+      double elapsed = now - _pending_start;
+      flush_now = flush_now || elapsed < 0.0 || elapsed >= _flush_deadline;
+    }
+  }
+
+  if (_immediate) {
+    return flush_now ? flush() : true;
+  }
+  return flush_now;
+}
+
 /**
  * Stops all the threads and cleans them up.  This is called automatically by
  * the destructor, but it may be called explicitly before destruction.
@@ -299,6 +467,9 @@ shutdown() {
     (*ti)->join();
   }
   _threads.clear();
+
+  // Send anything that is still being held back for coalescing.
+  flush();
 }
 
 /**
@@ -320,8 +491,27 @@ void ConnectionWriter::
 thread_run(int thread_index) {
   nassertv(!_immediate);
 
+  TrueClock *clock = TrueClock::get_global_ptr();
+
   NetDatagram datagram;
   while (_queue.extract(datagram)) {
+    if (_coalesce) {
+      // Gather up everything else that arrives before the flush deadline,
+      // then send it all at once.
+      double start = clock->get_short_time();
+      bool full = add_pending(datagram);
+      while (!full && !_shutdown) {
+        double remaining = _flush_deadline - (clock->get_short_time() - start);
+        if (_queue.extract(datagram, std::max(remaining, 0.0))) {
+          full = add_pending(datagram);
+        } else if (remaining <= 0.0) {
+          break;
+        }
+      }
+      flush();
+      continue;
+    }
+
     if (_raw_mode) {
       datagram.get_connection()->send_raw_datagram(datagram);
     } else {
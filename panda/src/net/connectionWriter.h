@@ -20,6 +20,9 @@
 #include "pointerTo.h"
 #include "thread.h"
 #include "pvector.h"
+#include "pmap.h"
+#include "lightMutex.h"
+#include "pmutex.h"
 
 class ConnectionManager;
 class NetAddress;
@@ -63,6 +66,15 @@ PUBLISHED:
   void set_tcp_header_size(int tcp_header_size);
   int get_tcp_header_size() const;
 
+  void set_coalesce(bool coalesce);
+  bool get_coalesce() const;
+  void set_flush_deadline(double flush_deadline);
+  double get_flush_deadline() const;
+  int get_num_pending() const;
+
+  BLOCKING bool consider_flush();
+  BLOCKING bool flush();
+
   void shutdown();
 
 protected:
@@ -71,6 +83,7 @@ protected:
 private:
   void thread_run(int thread_index);
   bool send_datagram(const NetDatagram &datagram);
+  bool add_pending(const NetDatagram &datagram);
 
 protected:
   ConnectionManager *_manager;
@@ -96,6 +109,23 @@ private:
 
   bool _immediate;
 
+  // In coalescing mode, datagrams wait here, grouped by connection, until
+  // they are flushed.  _flush_lock keeps concurrent flushes in order.
+  class PendingDatagrams {
+  public:
+    PT(Connection) _connection;
+    pvector<NetDatagram> _datagrams;
+  };
+  typedef pmap<Connection *, PendingDatagrams> Pending;
+
+  bool _coalesce;
+  double _flush_deadline;
+  mutable LightMutex _pending_lock;
+  Pending _pending;
+  int _num_pending;
+  double _pending_start;
+  Mutex _flush_lock;
+
   friend class ConnectionManager;
   friend class WriterThread;
 };
@@ -121,6 +121,35 @@ extract(NetDatagram &result) {
   return true;
 }
 
+/**
+ * Extracts a datagram from the head of the queue, waiting no longer than the
+ * indicated number of seconds for one to become available.  Returns true if
+ * a datagram was extracted, or false if the timeout expired first or the
+ * queue was shut down.  If timeout is 0, this does not wait at all.
+ */
+bool DatagramQueue::
+extract(NetDatagram &result, double timeout) {
+  result.clear();
+
+  MutexHolder holder(_cvlock);
+
+  if (_queue.empty() && !_shutdown && timeout > 0.0) {
+    _cv.wait(timeout);
+  }
+
+  if (_shutdown || _queue.empty()) {
+    return false;
+  }
+
+  result = std::move(_queue.front());
+  _queue.pop_front();
+
+  // Wake up any threads waiting to stuff things into the queue.
+  _cv.notify_all();
+
+  return true;
+}
+
 /**
  * Sets the maximum size the queue is allowed to grow to.  This is primarily
  * for a sanity check; this is a limit beyond which we can assume something
@@ -34,6 +34,7 @@ public:
 
   bool insert(const NetDatagram &data, bool block = false);
   bool extract(NetDatagram &result);
+  bool extract(NetDatagram &result, double timeout);
 
   void set_max_queue_size(int max_size);
   int get_max_queue_size() const;
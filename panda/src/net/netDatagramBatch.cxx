@@ -0,0 +1,38 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file netDatagramBatch.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "netDatagramBatch.h"
+
+/**
+ *
+ */
+void NetDatagramBatch::
+output(std::ostream &out) const {
+  size_t total = 0;
+  Datagrams::const_iterator di;
+  for (di = _datagrams.begin(); di != _datagrams.end(); ++di) {
+    total += (*di).get_length();
+  }
+  out << "NetDatagramBatch(" << _datagrams.size() << " datagrams, "
+      << total << " bytes)";
+}
+
+/**
+ * Returns an empty datagram, to return from get_datagram() when it is called
+ * with an invalid index.
+ */
+const NetDatagram &NetDatagramBatch::
+get_empty_datagram() {
+  static NetDatagram empty_datagram;
+  return empty_datagram;
+}
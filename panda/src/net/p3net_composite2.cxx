@@ -3,7 +3,9 @@
 #include "datagramUDPHeader.cxx"
 #include "netAddress.cxx"
 #include "netDatagram.cxx"
+#include "netDatagramBatch.cxx"
 #include "queuedConnectionListener.cxx"
 #include "queuedConnectionManager.cxx"
 #include "queuedConnectionReader.cxx"
+#include "receiveBufferPool.cxx"
 #include "recentConnectionReader.cxx"
@@ -84,6 +84,22 @@ get_data(Datagram &result) {
   return true;
 }
 
+/**
+ * Removes up to max_datagrams datagrams from the queue at once, replacing the
+ * contents of the indicated batch, and returns the number of datagrams
+ * returned.  If max_datagrams is negative, all available datagrams are
+ * returned.
+ *
+ * This is more efficient than calling get_data() repeatedly when many
+ * datagrams are expected, since the queue is only locked once.  As with
+ * get_data(), call data_available() first to poll for new datagrams when the
+ * reader has no threads of its own.
+ */
+int QueuedConnectionReader::
+get_data_batch(NetDatagramBatch &result, int max_datagrams) {
+  return get_things(result.modify_datagrams(), max_datagrams);
+}
+
 /**
  * An internal function called by ConnectionReader() when a new datagram has
  * become available.  The QueuedConnectionReader simply queues it up for later
@@ -110,6 +126,25 @@ receive_datagram(const NetDatagram &datagram) {
 #endif  // SIMULATE_NETWORK_DELAY
 }
 
+/**
+ * An internal function called by ConnectionReader() when several datagrams
+ * have been read at once.  They are all queued up with a single lock.
+ */
+void QueuedConnectionReader::
+receive_datagrams(const NetDatagram *datagrams, int num_datagrams) {
+#ifdef SIMULATE_NETWORK_DELAY
+  for (int i = 0; i < num_datagrams; ++i) {
+    delay_datagram(datagrams[i]);
+  }
+
+#else  // SIMULATE_NETWORK_DELAY
+  if (enqueue_things(datagrams, num_datagrams) < num_datagrams) {
+    net_cat.error()
+      << "QueuedConnectionReader queue full!\n";
+  }
+#endif  // SIMULATE_NETWORK_DELAY
+}
+
 
 #ifdef SIMULATE_NETWORK_DELAY
 /**
@@ -18,6 +18,7 @@
 
 #include "connectionReader.h"
 #include "netDatagram.h"
+#include "netDatagramBatch.h"
 #include "queuedReturn.h"
 #include "lightMutex.h"
 #include "pdeque.h"
@@ -39,9 +40,11 @@ PUBLISHED:
   BLOCKING bool data_available();
   bool get_data(NetDatagram &result);
   bool get_data(Datagram &result);
+  int get_data_batch(NetDatagramBatch &result, int max_datagrams = -1);
 
 protected:
   virtual void receive_datagram(const NetDatagram &datagram);
+  virtual void receive_datagrams(const NetDatagram *datagrams, int num_datagrams);
 
 #ifdef SIMULATE_NETWORK_DELAY
 PUBLISHED:
@@ -47,8 +47,10 @@ protected:
 
   INLINE bool thing_available() const;
   bool get_thing(Thing &thing);
+  int get_things(pdeque<Thing> &things, int max_things);
 
   bool enqueue_thing(const Thing &thing);
+  int enqueue_things(const Thing *things, int num_things);
   bool enqueue_unique_thing(const Thing &thing);
 
 private:
@@ -0,0 +1,81 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file receiveBufferPool.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "receiveBufferPool.h"
+#include "config_net.h"
+#include "lightMutexHolder.h"
+
+// The smallest capacity given to a pooled buffer, so that a buffer need not
+// be reallocated each time it is reused for a slightly larger datagram.
+static const size_t min_pooled_capacity = 256;
+
+// The number of buffers examined by get_buffer() before it gives up looking
+// for a free one.
+static const int max_probes = 4;
+
+/**
+ * Creates a pool that holds on to no more than max_buffers buffers.  If
+ * max_buffers is -1, the value of net-receive-buffer-pool-size is used.
+ */
+ReceiveBufferPool::
+ReceiveBufferPool(int max_buffers) :
+  _next(0),
+  _max_buffers(max_buffers)
+{
+  if (_max_buffers < 0) {
+    _max_buffers = net_receive_buffer_pool_size;
+  }
+}
+
+/**
+ *
+ */
+ReceiveBufferPool::
+~ReceiveBufferPool() {
+}
+
+/**
+ * Returns a buffer of exactly the indicated size, whose contents are
+ * undefined.  The buffer is recycled from the pool if a free one is found;
+ * otherwise a new one is allocated.  Buffers larger than
+ * net-receive-buffer-max-size are never pooled.
+ */
+PTA_uchar ReceiveBufferPool::
+get_buffer(size_t size) {
+  if (_max_buffers > 0 && size <= (size_t)net_receive_buffer_max_size) {
+    LightMutexHolder holder(_lock);
+
+    size_t num_buffers = _buffers.size();
+    int num_probes = std::min(max_probes, (int)num_buffers);
+    for (int i = 0; i < num_probes; ++i) {
+      PTA_uchar &buffer = _buffers[_next];
+      _next = (_next + 1) % num_buffers;
+      if (buffer.get_ref_count() == 1) {
+        // Nobody else is using this buffer any more.
+        buffer.v().resize(size);
+        return buffer;
+      }
+    }
+
+    if ((int)num_buffers < _max_buffers) {
+      PTA_uchar buffer = PTA_uchar::empty_array(0);
+      buffer.v().reserve(std::max(size, min_pooled_capacity));
+      buffer.v().resize(size);
+      _buffers.push_back(buffer);
+      return buffer;
+    }
+  }
+
+  // The pool is exhausted; allocate a buffer outside of the pool.
+  return PTA_uchar::empty_array(size);
+}
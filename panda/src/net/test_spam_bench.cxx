@@ -0,0 +1,173 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_spam_bench.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+
+#include "queuedConnectionManager.h"
+#include "queuedConnectionListener.h"
+#include "queuedConnectionReader.h"
+#include "connectionWriter.h"
+#include "netAddress.h"
+#include "connection.h"
+#include "netDatagram.h"
+#include "config_net.h"
+
+#include "load_prc_file.h"
+#include "clockObject.h"
+#include "thread.h"
+
+#include "pvector.h"
+
+/**
+ * A loopback benchmark of the ConnectionReader.  It opens n TCP connections
+ * to itself, then sends a few datagrams on each client connection and
+ * measures how quickly the server side reads them all back, which is mostly
+ * a measure of the cost of waiting on a large number of mostly idle sockets.
+ *
+ * Run it as "test_spam_bench epoll 1000 5000 10000" or "test_spam_bench
+ * select 500"; each connection needs two file descriptors, so large counts
+ * need a correspondingly raised "ulimit -n".
+ */
+static bool
+run_bench(int port, int num_connections, int rounds) {
+  QueuedConnectionManager cm;
+  PT(Connection) rendezvous = cm.open_TCP_server_rendezvous(port, 1024);
+  if (rendezvous.is_null()) {
+    nout << "Cannot grab port " << port << ".\n";
+    return false;
+  }
+
+  QueuedConnectionListener listener(&cm, 1);
+  listener.add_connection(rendezvous);
+  QueuedConnectionReader reader(&cm, 1);
+  ConnectionWriter writer(&cm, 0);
+
+  NetAddress address;
+  address.set_host("127.0.0.1", port);
+
+  typedef pvector< PT(Connection) > Connections;
+  Connections clients, servers;
+  clients.reserve(num_connections);
+  servers.reserve(num_connections);
+
+  ClockObject *global_clock = ClockObject::get_global_clock();
+  double start = global_clock->get_real_time();
+  while ((int)servers.size() < num_connections) {
+    if ((int)clients.size() < num_connections) {
+      PT(Connection) client = cm.open_TCP_client_connection(address, 5000);
+      if (client.is_null()) {
+        nout << "Could only open " << clients.size()
+             << " connections; try raising ulimit -n.\n";
+        return false;
+      }
+      clients.push_back(client);
+    } else if (global_clock->get_real_time() - start > 30.0) {
+      nout << "Timed out accepting connections.\n";
+      return false;
+    } else {
+      Thread::sleep(0.001);
+    }
+
+    while (listener.new_connection_available()) {
+      PT(Connection) rv;
+      NetAddress from;
+      PT(Connection) new_connection;
+      if (listener.get_new_connection(rv, from, new_connection)) {
+        reader.add_connection(new_connection);
+        servers.push_back(new_connection);
+      }
+    }
+  }
+  double open_time = global_clock->get_real_time() - start;
+
+  NetDatagram datagram;
+  datagram.add_string("The quick brown fox jumps over the lazy dog.");
+
+  int num_expected = num_connections * rounds;
+  int num_received = 0;
+  start = global_clock->get_real_time();
+  for (int r = 0; r < rounds; ++r) {
+    Connections::const_iterator ci;
+    for (ci = clients.begin(); ci != clients.end(); ++ci) {
+      writer.send(datagram, (*ci));
+    }
+
+    NetDatagram result;
+    while (reader.get_data(result)) {
+      num_received++;
+    }
+  }
+
+  while (num_received < num_expected &&
+         global_clock->get_real_time() - start < 30.0) {
+    NetDatagram result;
+    if (reader.get_data(result)) {
+      num_received++;
+    } else {
+      Thread::sleep(0.0005);
+    }
+  }
+  double elapsed = global_clock->get_real_time() - start;
+
+  nout << (reader.is_using_epoll() ? "epoll" : "select") << ": "
+       << num_connections << " connections (opened in "
+       << open_time << " s), received " << num_received << " of "
+       << num_expected << " datagrams in " << elapsed << " s, "
+       << num_received / elapsed << " datagrams/s\n";
+
+  Connections::const_iterator ci;
+  for (ci = clients.begin(); ci != clients.end(); ++ci) {
+    cm.close_connection(*ci);
+  }
+  for (ci = servers.begin(); ci != servers.end(); ++ci) {
+    cm.close_connection(*ci);
+  }
+  cm.close_connection(rendezvous);
+  return num_received == num_expected;
+}
+
+int
+main(int argc, char *argv[]) {
+  if (argc < 2 || (strcmp(argv[1], "select") != 0 && strcmp(argv[1], "epoll") != 0)) {
+    nout << "test_spam_bench select|epoll [num_connections ...]\n";
+    exit(1);
+  }
+
+  bool use_epoll = (strcmp(argv[1], "epoll") == 0);
+  load_prc_file_data("test_spam_bench", use_epoll ? "net-use-epoll 1" : "net-use-epoll 0");
+
+  pvector<int> counts;
+  for (int i = 2; i < argc; ++i) {
+    counts.push_back(atoi(argv[i]));
+  }
+  if (counts.empty()) {
+    counts.push_back(1000);
+    counts.push_back(5000);
+    counts.push_back(10000);
+  }
+
+  bool success = true;
+  int port = 18210;
+  for (size_t i = 0; i < counts.size(); ++i) {
+    if (!use_epoll && counts[i] * 2 + 16 > FD_SETSIZE) {
+      nout << "select: skipping " << counts[i]
+           << " connections, which exceeds FD_SETSIZE.\n";
+      continue;
+    }
+    if (!run_bench(port++, counts[i], 4)) {
+      success = false;
+    }
+  }
+
+  return success ? 0 : 1;
+}
@@ -23,6 +23,7 @@
 #include "config_express.h"
 #include "virtualFileSystem.h"
 #include "dcast.h"
+#include "asyncParallelFor.h"
 
 using std::string;
 
@@ -33,6 +34,7 @@ BamFile::
 BamFile() {
   _reader = nullptr;
   _writer = nullptr;
+  _num_threads = 1;
 }
 
 /**
@@ -112,6 +114,22 @@ resolve() {
     return false;
   }
 
+  if (_num_threads > 1) {
+    // Copy the data of the objects read so far on several threads, before the
+    // BamReader completes the objects (which it always does on this thread).
+    size_t num_decodes = _reader->get_num_pending_decodes();
+    if (num_decodes > 1) {
+      // The copies are all about the same size, so we can divide them up
+      // evenly.
+      size_t grain_size = (num_decodes + _num_threads - 1) / _num_threads;
+      AsyncTaskChain *chain =
+        AsyncParallelFor::get_task_chain("bam", bam_num_threads);
+      AsyncParallelFor::run(chain, num_decodes, grain_size,
+                            &do_pending_decodes, _reader);
+      _reader->clear_pending_decodes();
+    }
+  }
+
   return _reader->resolve();
 }
 
@@ -349,6 +367,41 @@ get_writer() {
   return _writer;
 }
 
+/**
+ * Specifies the number of threads across which the large blocks of data in
+ * the Bam file, such as vertex arrays and texture images, are copied when
+ * resolve() is called.  The copies are made on the threads of the "bam" task
+ * chain (see bam-num-threads) as well as on the thread that calls resolve().
+ *
+ * Only the copies are divided up.  The objects themselves are still read,
+ * created and completed one at a time, in the same order, on the calling
+ * thread: the reading of each object depends on the state that the
+ * BamReader has built up from the objects before it (such as the object and
+ * type indices and the file version), and the stream itself can only be read
+ * in order.  The gain is therefore limited to the share of the load time that
+ * is spent copying large blocks of data.
+ *
+ * This must be set before the objects are read.  The default is 1, which
+ * copies each block as soon as its object is read.
+ */
+void BamFile::
+set_num_threads(int num_threads) {
+  _num_threads = num_threads;
+  if (_reader != nullptr) {
+    _reader->set_defer_decode(_num_threads > 1);
+  }
+}
+
+/**
+ * The work function passed to AsyncParallelFor by resolve(), to perform some
+ * of the BamReader's pending copies.
+ */
+void BamFile::
+do_pending_decodes(size_t begin, size_t end, void *user_data) {
+  BamReader *reader = (BamReader *)user_data;
+  reader->do_pending_decodes(begin, end);
+}
+
 /**
  * Reads the header of the recently-opened bam stream and prepares to read the
  * contents of the file.  Returns true if successful, false otherwise.
@@ -382,6 +435,7 @@ continue_open_read(const string &bam_filename, bool report_errors) {
     close();
     return false;
   }
+  _reader->set_defer_decode(_num_threads > 1);
 
   return true;
 }
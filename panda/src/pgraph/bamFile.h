@@ -74,22 +74,29 @@ PUBLISHED:
   BamReader *get_reader();
   BamWriter *get_writer();
 
+  void set_num_threads(int num_threads);
+  INLINE int get_num_threads() const;
+
 PUBLISHED:
   MAKE_PROPERTY(file_endian, get_file_endian);
   MAKE_PROPERTY(file_stdfloat_double, get_file_stdfloat_double);
 
   MAKE_PROPERTY(reader, get_reader);
   MAKE_PROPERTY(writer, get_writer);
+  MAKE_PROPERTY(num_threads, get_num_threads, set_num_threads);
 
 private:
   bool continue_open_read(const std::string &bam_filename, bool report_errors);
   bool continue_open_write(const std::string &bam_filename, bool report_errors);
 
+  static void do_pending_decodes(size_t begin, size_t end, void *user_data);
+
   std::string _bam_filename;
   DatagramInputFile _din;
   DatagramOutputFile _dout;
   BamReader *_reader;
   BamWriter *_writer;
+  int _num_threads;
 };
 
 #include "bamFile.I"
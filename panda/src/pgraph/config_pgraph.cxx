@@ -37,6 +37,7 @@
 #include "depthTestAttrib.h"
 #include "depthWriteAttrib.h"
 #include "findApproxLevelEntry.h"
+#include "flattenTask.h"
 #include "fog.h"
 #include "fogAttrib.h"
 #include "geomDrawCallbackData.h"
@@ -130,6 +131,24 @@ ConfigVariableBool debug_portal_cull
           "(You first need to enable portal culling, using the allow-portal-cull"
           "variable.)"));
 
+ConfigVariableInt cull_parallel_depth
+("cull-parallel-depth", 0,
+ PRC_DESC("Set this to a value greater than 0 to split up the cull traversal "
+          "across several threads.  The scene graph is walked as usual down "
+          "to this many levels below the scene root, and each subtree found "
+          "there is then traversed on a separate thread.  The objects found "
+          "are still delivered to the bins in the same order as a serial "
+          "traversal would.  Cull callbacks may be called from any of these "
+          "threads, but never more than one at a time.  Set this to 0 to "
+          "disable."));
+
+ConfigVariableInt cull_num_threads
+("cull-num-threads", 0,
+ PRC_DESC("The number of threads to use for the parallel cull traversal, "
+          "when cull-parallel-depth is enabled.  The default of 0 means to "
+          "use one thread per CPU, less one for the thread that is already "
+          "performing the cull."));
+
 ConfigVariableBool show_occluder_volumes
 ("show-occluder-volumes", false,
  PRC_DESC("Set this true to enable debug visualization of the volumes used "
@@ -304,6 +323,27 @@ ConfigVariableBool flatten_geoms
           "only the NodePath interfaces; you may still make the lower-level "
           "SceneGraphReducer calls directly."));
 
+ConfigVariableInt flatten_num_threads
+("flatten-num-threads", 0,
+ PRC_DESC("The number of threads to create for the \"flatten\" task chain, "
+          "which is used by FlattenTasks that have been asked to unify their "
+          "Geoms with set_num_threads().  The default of 0 means to create "
+          "one thread per CPU, less one for the calling thread."));
+
+ConfigVariableDouble flatten_time_slice
+("flatten-time-slice", 0.005,
+ PRC_DESC("The default amount of time, in seconds, that a FlattenTask will "
+          "spend flattening its scene graph each time it is run by a task "
+          "manager, before it yields until the next epoch."));
+
+ConfigVariableInt bam_num_threads
+("bam-num-threads", 0,
+ PRC_DESC("The number of threads to create for the \"bam\" task chain, "
+          "which is used by BamFiles that have been asked to copy the data "
+          "of the objects they read with set_num_threads().  The default of "
+          "0 means to create one thread per CPU, less one for the calling "
+          "thread."));
+
 ConfigVariableInt max_lenses
 ("max-lenses", 100,
  PRC_DESC("Specifies an upper limit on the maximum number of lenses "
@@ -411,6 +451,7 @@ init_libpgraph() {
   DepthTestAttrib::init_type();
   DepthWriteAttrib::init_type();
   FindApproxLevelEntry::init_type();
+  FlattenTask::init_type();
   Fog::init_type();
   FogAttrib::init_type();
   GeomDrawCallbackData::init_type();
@@ -34,6 +34,8 @@
 #include "geomLinestrips.h"
 #include "geomLines.h"
 #include "geomVertexWriter.h"
+#include "cullPlanes.h"
+#include "asyncParallelFor.h"
 
 PStatCollector CullTraverser::_nodes_pcollector("Nodes");
 PStatCollector CullTraverser::_geom_nodes_pcollector("Nodes:GeomNodes");
@@ -42,6 +44,51 @@ PStatCollector CullTraverser::_geoms_occluded_pcollector("Geoms:Occluded");
 
 TypeHandle CullTraverser::_type_handle;
 
+/**
+ * A CullHandler that simply stores the objects it is given, so that they may
+ * be passed on to the real CullHandler later.
+ */
+class CullTraverser::ParallelCull {
+public:
+  typedef pvector<CullableObject *> Objects;
+
+  class Recorder : public CullHandler {
+  public:
+    Recorder(Objects *objects) : _objects(objects) {}
+    virtual void record_object(CullableObject *object,
+                               const CullTraverser *traverser) {
+      _objects->push_back(object);
+    }
+
+    Objects *_objects;
+  };
+
+  // A subtree that has been set aside to be traversed by a worker thread.
+  // _preceding holds the objects found by the serial part of the traversal
+  // just before the subtree was reached.
+  class SetAside {
+  public:
+    Objects _preceding;
+    NodePath _node_path;
+    CPT(TransformState) _net_transform;
+    CPT(RenderState) _state;
+    PT(GeometricBoundingVolume) _view_frustum;
+    CPT(CullPlanes) _cull_planes;
+    DrawMask _draw_mask;
+    int _portal_depth;
+    Objects _objects;
+  };
+  typedef pvector<SetAside> SetAsides;
+
+  CullTraverser *_trav;
+  int _pipeline_stage;
+  SetAsides _set_asides;
+  Objects _pending;
+
+  // Held by the worker threads while they call a cull callback.
+  ReMutex _callback_lock;
+};
+
 /**
  *
  */
@@ -56,6 +103,10 @@ CullTraverser() :
   _cull_handler = nullptr;
   _portal_clipper = nullptr;
   _effective_incomplete_render = true;
+  _parallel_depth = cull_parallel_depth;
+  _parallel = nullptr;
+  _depth = 0;
+  _callback_lock = nullptr;
 }
 
 /**
@@ -73,7 +124,11 @@ CullTraverser(const CullTraverser &copy) :
   _view_frustum(copy._view_frustum),
   _cull_handler(copy._cull_handler),
   _portal_clipper(copy._portal_clipper),
-  _effective_incomplete_render(copy._effective_incomplete_render)
+  _effective_incomplete_render(copy._effective_incomplete_render),
+  _parallel_depth(copy._parallel_depth),
+  _parallel(nullptr),
+  _depth(0),
+  _callback_lock(nullptr)
 {
 }
 
@@ -152,7 +207,12 @@ traverse(const NodePath &root) {
                            _initial_state, _view_frustum,
                            _current_thread);
 
-    do_traverse(data);
+    if (_parallel_depth > 0 && get_type() == get_class_type() &&
+        Thread::is_threading_supported()) {
+      do_parallel_traverse(data);
+    } else {
+      do_traverse(data);
+    }
   }
 }
 
@@ -199,6 +259,27 @@ traverse_below(CullTraverserData &data) {
   PandaNode::Children children = node_reader->get_children();
   node_reader->release();
   int num_children = children.get_num_children();
+
+  if (_parallel != nullptr && _depth + 1 >= _parallel_depth) {
+    // We're doing a parallel traversal, and the children are deep enough
+    // that they should each be traversed by a worker thread.
+    if (!node->has_selective_visibility()) {
+      for (int i = 0; i < num_children; ++i) {
+        CullTraverserData next_data(data, children.get_child(i));
+        set_aside(next_data);
+      }
+    } else {
+      int i = node->get_first_visible_child();
+      while (i < num_children) {
+        CullTraverserData next_data(data, children.get_child(i));
+        set_aside(next_data);
+        i = node->get_next_visible_child(i);
+      }
+    }
+    return;
+  }
+
+  ++_depth;
   if (!node->has_selective_visibility()) {
     for (int i = 0; i < num_children; ++i) {
       CullTraverserData next_data(data, children.get_child(i));
@@ -212,6 +293,7 @@ traverse_below(CullTraverserData &data) {
       i = node->get_next_visible_child(i);
     }
   }
+  --_depth;
 }
 
 /**
@@ -223,6 +305,117 @@ end_traverse() {
   _cull_handler->end_traverse();
 }
 
+/**
+ * Performs the traversal with the indicated data, splitting it up across the
+ * threads of the "cull" task chain at the depth given by
+ * set_parallel_depth().
+ *
+ * The top levels of the scene graph are traversed on the current thread as
+ * usual, except that the subtrees at the split depth are set aside rather
+ * than visited.  Once that is done, the set-aside subtrees are traversed in
+ * parallel, each thread collecting the objects it finds in a list of its own.
+ * Finally, all of the objects are passed on to the CullHandler on the current
+ * thread, in the same order in which a serial traversal would have found
+ * them, so that the contents of the bins do not depend on the timing of the
+ * threads.
+ */
+void CullTraverser::
+do_parallel_traverse(CullTraverserData &data) {
+  ParallelCull parallel;
+  parallel._trav = this;
+  parallel._pipeline_stage = _current_thread->get_pipeline_stage();
+
+  CullHandler *cull_handler = _cull_handler;
+  ParallelCull::Recorder recorder(&parallel._pending);
+  _cull_handler = &recorder;
+  _parallel = &parallel;
+  _depth = 0;
+
+  do_traverse(data);
+
+  _parallel = nullptr;
+  _cull_handler = cull_handler;
+
+  AsyncTaskChain *chain =
+    AsyncParallelFor::get_task_chain("cull", cull_num_threads);
+  AsyncParallelFor::run(chain, parallel._set_asides.size(), 1,
+                        &traverse_set_aside, &parallel);
+
+  for (ParallelCull::SetAside &set_aside : parallel._set_asides) {
+    for (CullableObject *object : set_aside._preceding) {
+      _cull_handler->record_object(object, this);
+    }
+    for (CullableObject *object : set_aside._objects) {
+      _cull_handler->record_object(object, this);
+    }
+  }
+  for (CullableObject *object : parallel._pending) {
+    _cull_handler->record_object(object, this);
+  }
+}
+
+/**
+ * Called during a parallel traversal to queue up the indicated node, which
+ * has not yet been converted into the node's space, to be traversed later by
+ * one of the worker threads.
+ */
+void CullTraverser::
+set_aside(CullTraverserData &data) {
+  // The CullTraverserData refers to its parent on the stack, so we have to
+  // make a copy of everything we'll need later.
+  ParallelCull::SetAsides &set_asides = _parallel->_set_asides;
+  set_asides.push_back(ParallelCull::SetAside());
+  ParallelCull::SetAside &set_aside = set_asides.back();
+
+  set_aside._preceding.swap(_parallel->_pending);
+  set_aside._node_path = data.get_node_path();
+  set_aside._net_transform = data._net_transform;
+  set_aside._state = data._state;
+  set_aside._view_frustum = data._view_frustum;
+  set_aside._cull_planes = data._cull_planes;
+  set_aside._draw_mask = data._draw_mask;
+  set_aside._portal_depth = data._portal_depth;
+}
+
+/**
+ * The work function for the parallel traversal.  Traverses the indicated
+ * range of set-aside subtrees.
+ */
+void CullTraverser::
+traverse_set_aside(size_t begin, size_t end, void *user_data) {
+  ParallelCull *parallel = (ParallelCull *)user_data;
+
+  // Make sure we read the scene graph from the same pipeline stage as the
+  // thread that started the traversal.
+  Thread *current_thread = Thread::get_current_thread();
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(parallel->_pipeline_stage);
+
+  PT(CullTraverser) trav = new CullTraverser(*parallel->_trav);
+  trav->_current_thread = current_thread;
+  trav->_callback_lock = &parallel->_callback_lock;
+
+  for (size_t i = begin; i < end; ++i) {
+    ParallelCull::SetAside &set_aside = parallel->_set_asides[i];
+    ParallelCull::Recorder recorder(&set_aside._objects);
+    trav->_cull_handler = &recorder;
+
+    CullTraverserData data(set_aside._node_path, set_aside._net_transform,
+                           set_aside._state, set_aside._view_frustum,
+                           current_thread);
+    data._cull_planes = set_aside._cull_planes;
+    data._draw_mask = set_aside._draw_mask;
+    data._portal_depth = set_aside._portal_depth;
+    if (!data._cull_planes->is_empty()) {
+      // The constructor only checked the bounds if there was a view frustum.
+      data.node_reader()->check_cached(true);
+    }
+    trav->do_traverse(data);
+  }
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
+
 /**
  * Draws an appropriate visualization of the indicated bounding volume.
  */
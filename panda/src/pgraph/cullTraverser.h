@@ -27,6 +27,7 @@
 #include "typedReferenceCount.h"
 #include "pStatCollector.h"
 #include "fogAttrib.h"
+#include "reMutex.h"
 
 class GraphicsStateGuardian;
 class PandaNode;
@@ -77,6 +78,9 @@ PUBLISHED:
 
   INLINE bool get_effective_incomplete_render() const;
 
+  INLINE void set_parallel_depth(int parallel_depth);
+  INLINE int get_parallel_depth() const;
+
   void traverse(const NodePath &root);
   void traverse(CullTraverserData &data);
   virtual void traverse_below(CullTraverserData &data);
@@ -100,6 +104,18 @@ public:
   static PStatCollector _geoms_pcollector;
   static PStatCollector _geoms_occluded_pcollector;
 
+  // Create one of these around each call to a cull callback.  During a
+  // parallel traversal, it makes sure that the callbacks are called only one
+  // at a time; otherwise, it does nothing.
+  class CallbackHolder {
+  public:
+    INLINE CallbackHolder(const CullTraverser *trav);
+    INLINE ~CallbackHolder();
+
+  private:
+    ReMutex *_lock;
+  };
+
 private:
   void show_bounds(CullTraverserData &data, bool tight);
   static PT(Geom) make_bounds_viz(const BoundingVolume *vol);
@@ -110,6 +126,11 @@ private:
   static CPT(RenderState) get_bounds_inner_viz_state();
   static CPT(RenderState) get_depth_offset_state();
 
+  class ParallelCull;
+  void do_parallel_traverse(CullTraverserData &data);
+  void set_aside(CullTraverserData &data);
+  static void traverse_set_aside(size_t begin, size_t end, void *user_data);
+
   GraphicsStateGuardianBase *_gsg;
   Thread *_current_thread;
   PT(SceneSetup) _scene_setup;
@@ -121,6 +142,16 @@ private:
   CullHandler *_cull_handler;
   PortalClipper *_portal_clipper;
   bool _effective_incomplete_render;
+  int _parallel_depth;
+
+  // These are only set while do_parallel_traverse() is walking the top
+  // levels of the scene graph.
+  ParallelCull *_parallel;
+  int _depth;
+
+  // This is only set on the traversers of the worker threads of a parallel
+  // traversal.
+  ReMutex *_callback_lock;
 
 public:
   static TypeHandle get_class_type() {
@@ -52,7 +52,10 @@ apply_transform_and_state(CullTraverser *trav) {
   } else {
     // The cull callback may decide to modify the node_transform.
     CPT(TransformState) node_transform = _node_reader.get_transform();
-    node_effects->cull_callback(trav, *this, node_transform, node_state);
+    {
+      CullTraverser::CallbackHolder holder(trav);
+      node_effects->cull_callback(trav, *this, node_transform, node_state);
+    }
     apply_transform(node_transform);
 
     // The cull callback may have changed the node properties.
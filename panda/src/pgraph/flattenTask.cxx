@@ -0,0 +1,489 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file flattenTask.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "flattenTask.h"
+#include "config_pgraph.h"
+#include "asyncParallelFor.h"
+#include "trueClock.h"
+#include "pStatTimer.h"
+
+TypeHandle FlattenTask::_type_handle;
+
+// The number of GeomNodes that each thread is given to unify per step.
+static const size_t unify_nodes_per_thread = 8;
+
+/**
+ * Prepares to flatten the scene graph at the indicated root and below, in the
+ * same way as the NodePath flatten call for the indicated level.  No work is
+ * done until the task is run or step() is called.
+ */
+FlattenTask::
+FlattenTask(PandaNode *root, FlattenLevel level) :
+  AsyncTask(root->get_name()),
+  _root(root),
+  _level(level),
+  _time_slice(flatten_time_slice),
+  _num_threads(1),
+  _num_removed(0),
+  _next_geom_node(0)
+{
+  if (level == FL_strong) {
+    _combine_siblings_bits = ~0;
+    _collect_bits = ~(SceneGraphReducer::CVD_format |
+                      SceneGraphReducer::CVD_name |
+                      SceneGraphReducer::CVD_animation_type);
+    _preserve_order = false;
+  } else {
+    _combine_siblings_bits = 0;
+    _collect_bits = ~0;
+    _preserve_order = true;
+  }
+
+  start_pass(P_apply_attribs);
+}
+
+/**
+ *
+ */
+FlattenTask::
+~FlattenTask() {
+  clear_frames();
+}
+
+/**
+ * Does the next part of the flatten, spending no more than about max_time
+ * seconds on it.  At least one node is always processed, so passing 0 does
+ * the smallest possible amount of work.  Returns true once the flatten has
+ * finished, or false if there is more work to be done.
+ */
+bool FlattenTask::
+step(double max_time) {
+  if (_pass == P_done) {
+    return true;
+  }
+
+  nassertd(_reducer.check_live_flatten(_root)) {
+    clear_frames();
+    _pass = P_done;
+    return true;
+  }
+
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double start = clock->get_short_time();
+  do {
+    do_step();
+  } while (_pass != P_done && clock->get_short_time() - start < max_time);
+
+  return _pass == P_done;
+}
+
+/**
+ * Performs one time slice of the flatten.
+ */
+AsyncTask::DoneStatus FlattenTask::
+do_task() {
+  if (!step(_time_slice)) {
+    return DS_cont;
+  }
+
+  set_result(_root.p());
+  return DS_done;
+}
+
+/**
+ * Sets up the walk for the indicated pass.
+ */
+void FlattenTask::
+start_pass(Pass pass) {
+  clear_frames();
+  _pass = pass;
+
+  switch (pass) {
+  case P_apply_attribs:
+    push_apply_frame(_root, AccumulatedAttribs());
+    break;
+
+  case P_flatten:
+    {
+      // The root itself is never removed; only its children are visited.
+      Frame frame(nullptr, _root);
+      frame._children = _root->get_children();
+      frame._bits = _combine_siblings_bits;
+      _frames.push_back(std::move(frame));
+    }
+    break;
+
+  case P_compatible_state:
+  case P_unify:
+    push_preorder_frame(_root);
+    break;
+
+  case P_collect:
+    push_collect_frame(_root);
+    break;
+
+  case P_done:
+    break;
+  }
+}
+
+/**
+ * Moves on to the pass that follows the current one, for the chosen level.
+ */
+void FlattenTask::
+next_pass() {
+  switch (_pass) {
+  case P_apply_attribs:
+    start_pass(_level == FL_light ? P_done : P_flatten);
+    break;
+
+  case P_flatten:
+    start_pass(flatten_geoms ? P_compatible_state : P_done);
+    break;
+
+  case P_compatible_state:
+    start_pass(P_collect);
+    break;
+
+  case P_collect:
+    start_pass(P_unify);
+    break;
+
+  case P_unify:
+  case P_done:
+    start_pass(P_done);
+    break;
+  }
+}
+
+/**
+ * Performs the smallest unit of work of the current pass.
+ */
+void FlattenTask::
+do_step() {
+  switch (_pass) {
+  case P_apply_attribs:
+    {
+      PStatTimer timer(SceneGraphReducer::_apply_collector);
+      step_apply_attribs();
+    }
+    break;
+
+  case P_flatten:
+    {
+      PStatTimer timer(SceneGraphReducer::_flatten_collector);
+      step_flatten();
+    }
+    break;
+
+  case P_compatible_state:
+    {
+      PStatTimer timer(SceneGraphReducer::_compatible_state_collector);
+      step_compatible_state();
+    }
+    break;
+
+  case P_collect:
+    {
+      PStatTimer timer(SceneGraphReducer::_collect_collector);
+      step_collect();
+    }
+    break;
+
+  case P_unify:
+    {
+      PStatTimer timer(SceneGraphReducer::_unify_collector);
+      step_unify();
+    }
+    break;
+
+  case P_done:
+    break;
+  }
+}
+
+/**
+ * Applies the attribs to the next node, as in
+ * SceneGraphReducer::apply_attribs().
+ */
+void FlattenTask::
+step_apply_attribs() {
+  Frame &frame = _frames.back();
+  if (frame._next_child < frame._children.get_num_children()) {
+    PandaNode *child_node = frame._children.get_child(frame._next_child++);
+    push_apply_frame(child_node, frame._attribs);
+    return;
+  }
+
+  _frames.pop_back();
+  if (_frames.empty()) {
+    _reducer._transformer.finish_apply();
+    next_pass();
+  }
+}
+
+/**
+ * Visits the next node of SceneGraphReducer::flatten().  The nodes are
+ * visited on the way down, and flattened on the way back up.
+ */
+void FlattenTask::
+step_flatten() {
+  Frame &frame = _frames.back();
+  if (frame._next_child < frame._children.get_num_children()) {
+    PandaNode *child_node = frame._children.get_child(frame._next_child++);
+    Frame child_frame(frame._node, child_node);
+    child_frame._bits = frame._bits;
+    if (_reducer.begin_flatten(child_node, child_frame._bits)) {
+      child_frame._children = child_node->get_children();
+      _frames.push_back(std::move(child_frame));
+    }
+    return;
+  }
+
+  if (_frames.size() > 1) {
+    int num_nodes = frame._num_nodes +
+      _reducer.finish_flatten(frame._grandparent, frame._node, frame._bits);
+    _frames.pop_back();
+    _frames.back()._num_nodes += num_nodes;
+    return;
+  }
+
+  // We are back at the root, which finishes the pass.
+  int num_pass_nodes = frame._num_nodes;
+  if (_combine_siblings_bits != 0 &&
+      _root->get_num_children() >= 2 &&
+      _root->safe_to_combine_children()) {
+    num_pass_nodes += _reducer.flatten_siblings(_root, _combine_siblings_bits);
+  }
+  _num_removed += num_pass_nodes;
+
+  // As in flatten(), with CS_recurse, we keep going until a pass no longer
+  // removes any nodes.
+  if ((_combine_siblings_bits & SceneGraphReducer::CS_recurse) != 0 &&
+      num_pass_nodes != 0) {
+    start_pass(P_flatten);
+  } else {
+    next_pass();
+  }
+}
+
+/**
+ * Visits the next node of SceneGraphReducer::make_compatible_state().
+ */
+void FlattenTask::
+step_compatible_state() {
+  Frame &frame = _frames.back();
+  if (frame._next_child < frame._children.get_num_children()) {
+    push_preorder_frame(frame._children.get_child(frame._next_child++));
+    return;
+  }
+
+  _frames.pop_back();
+  if (_frames.empty()) {
+    _reducer._transformer.finish_apply();
+    next_pass();
+  }
+}
+
+/**
+ * Visits the next node of SceneGraphReducer::collect_vertex_data().
+ */
+void FlattenTask::
+step_collect() {
+  Frame &frame = _frames.back();
+  if (frame._next_child < frame._children.get_num_children()) {
+    push_collect_frame(frame._children.get_child(frame._next_child++));
+    return;
+  }
+
+  if (frame._owns_transformer) {
+    frame._transformer->finish_collect(false);
+    delete frame._transformer;
+  }
+  _frames.pop_back();
+
+  if (_frames.empty()) {
+    _reducer._transformer.finish_collect(false);
+    next_pass();
+  }
+}
+
+/**
+ * Visits the next node in search of GeomNodes, or, once they have all been
+ * found, unifies the next batch of them, as in SceneGraphReducer::unify().
+ */
+void FlattenTask::
+step_unify() {
+  if (!_frames.empty()) {
+    Frame &frame = _frames.back();
+    if (frame._next_child < frame._children.get_num_children()) {
+      push_preorder_frame(frame._children.get_child(frame._next_child++));
+    } else {
+      _frames.pop_back();
+    }
+    return;
+  }
+
+  if (_next_geom_node < _geom_nodes.size()) {
+    unify_batch();
+  }
+
+  if (_next_geom_node >= _geom_nodes.size()) {
+    _geom_nodes.clear();
+    _next_geom_node = 0;
+    next_pass();
+  }
+}
+
+/**
+ * Unifies the next GeomNode, or, if more than one thread is to be used, the
+ * next batch of GeomNodes.
+ */
+void FlattenTask::
+unify_batch() {
+  int max_indices = _reducer.get_max_unify_indices();
+
+  if (_num_threads <= 1) {
+    _geom_nodes[_next_geom_node++]->unify(max_indices, _preserve_order);
+    return;
+  }
+
+  size_t num_nodes = std::min(_geom_nodes.size() - _next_geom_node,
+                              (size_t)_num_threads * unify_nodes_per_thread);
+
+  Thread *current_thread = Thread::get_current_thread();
+
+  ParallelUnify parallel;
+  parallel._geom_nodes = &_geom_nodes[_next_geom_node];
+  parallel._max_indices = max_indices;
+  parallel._preserve_order = _preserve_order;
+  parallel._pipeline_stage = current_thread->get_pipeline_stage();
+  parallel._changed.resize(num_nodes, 0);
+
+  size_t grain_size = (num_nodes + _num_threads - 1) / _num_threads;
+  AsyncTaskChain *chain =
+    AsyncParallelFor::get_task_chain("flatten", flatten_num_threads);
+  AsyncParallelFor::run(chain, num_nodes, grain_size,
+                        &unify_geom_nodes, &parallel);
+
+  // Marking the bounds stale reaches up into the parents, which may be shared
+  // between the nodes, so this is done afterwards, on this thread.
+  for (size_t i = 0; i < num_nodes; ++i) {
+    if (parallel._changed[i]) {
+      parallel._geom_nodes[i]->mark_internal_bounds_stale(current_thread);
+    }
+  }
+
+  _next_geom_node += num_nodes;
+}
+
+/**
+ * Applies the attribs to the indicated node, and pushes it onto the stack so
+ * that its children will be visited next.
+ */
+void FlattenTask::
+push_apply_frame(PandaNode *node, const AccumulatedAttribs &attribs) {
+  Frame frame(nullptr, node);
+  if (_reducer.apply_attribs_to_node(node, attribs,
+        ~(SceneGraphReducer::TT_clip_plane |
+          SceneGraphReducer::TT_cull_face |
+          SceneGraphReducer::TT_apply_texture_color),
+        _reducer._transformer, frame._attribs)) {
+    frame._children = node->get_children();
+  }
+  _frames.push_back(std::move(frame));
+}
+
+/**
+ * Visits the indicated node for the current pass, and pushes it onto the
+ * stack so that its children will be visited next.  This is used for the
+ * passes that simply visit each node in turn.
+ */
+void FlattenTask::
+push_preorder_frame(PandaNode *node) {
+  if (node->is_geom_node()) {
+    GeomNode *geom_node = DCAST(GeomNode, node);
+    if (_pass == P_compatible_state) {
+      _reducer._transformer.make_compatible_state(geom_node);
+    } else {
+      _geom_nodes.push_back(geom_node);
+    }
+  }
+
+  Frame frame(nullptr, node);
+  frame._children = node->get_children();
+  _frames.push_back(std::move(frame));
+}
+
+/**
+ * Collects the vertex data of the indicated node, and pushes it onto the
+ * stack so that its children will be visited next.  If the node begins a new
+ * collection, it is given its own GeomTransformer.
+ */
+void FlattenTask::
+push_collect_frame(PandaNode *node) {
+  GeomTransformer *transformer = _frames.empty()
+    ? &_reducer._transformer : _frames.back()._transformer;
+
+  Frame frame(nullptr, node);
+  if ((_collect_bits & SceneGraphReducer::get_collect_node_bits(node)) != 0) {
+    frame._transformer = new GeomTransformer(*transformer);
+    frame._owns_transformer = true;
+  } else {
+    frame._transformer = transformer;
+  }
+
+  if (node->is_geom_node()) {
+    frame._transformer->collect_vertex_data(DCAST(GeomNode, node),
+                                            _collect_bits, false);
+  }
+
+  frame._children = node->get_children();
+  _frames.push_back(std::move(frame));
+}
+
+/**
+ * Empties the stack, freeing any GeomTransformers it owns.
+ */
+void FlattenTask::
+clear_frames() {
+  for (Frame &frame : _frames) {
+    if (frame._owns_transformer) {
+      delete frame._transformer;
+    }
+  }
+  _frames.clear();
+}
+
+/**
+ * The work function for unify_batch(): unifies the indicated range of
+ * GeomNodes.
+ */
+void FlattenTask::
+unify_geom_nodes(size_t begin, size_t end, void *user_data) {
+  ParallelUnify *parallel = (ParallelUnify *)user_data;
+
+  // Make sure we modify the same pipeline stage as the thread that asked for
+  // the flatten.
+  Thread *current_thread = Thread::get_current_thread();
+  int pipeline_stage = current_thread->get_pipeline_stage();
+  current_thread->set_pipeline_stage(parallel->_pipeline_stage);
+
+  for (size_t i = begin; i < end; ++i) {
+    GeomNode *geom_node = parallel->_geom_nodes[i];
+    parallel->_changed[i] = geom_node->do_unify(parallel->_max_indices,
+                                                parallel->_preserve_order);
+  }
+
+  current_thread->set_pipeline_stage(pipeline_stage);
+}
@@ -520,9 +520,12 @@ add_for_draw(CullTraverser *trav, CullTraverserData &data) {
     }
 
     CPT(RenderState) state = data._state->compose(geoms.get_geom_state(i));
-    if (state->has_cull_callback() && !state->cull_callback(trav, data)) {
-      // Cull.
-      continue;
+    if (state->has_cull_callback()) {
+      CullTraverser::CallbackHolder holder(trav);
+      if (!state->cull_callback(trav, data)) {
+        // Cull.
+        continue;
+      }
     }
 
     // Cull the Geom bounding volume against the view frustum andor the cull
@@ -710,6 +713,21 @@ decompose() {
  */
 void GeomNode::
 unify(int max_indices, bool preserve_order) {
+  if (do_unify(max_indices, preserve_order)) {
+    mark_internal_bounds_stale();
+  }
+}
+
+/**
+ * The implementation of unify(), which leaves it to the caller to mark the
+ * internal bounds stale.  Returns true if any Geoms were combined, in which
+ * case the bounds must be marked stale.
+ *
+ * Since this only touches the node itself and its own Geoms, it may be called
+ * for different nodes on different threads at once.
+ */
+bool GeomNode::
+do_unify(int max_indices, bool preserve_order) {
   bool any_changed = false;
 
   Thread *current_thread = Thread::get_current_thread();
@@ -764,16 +782,14 @@ unify(int max_indices, bool preserve_order) {
     GeomList::iterator wgi;
     for (wgi = new_geoms->begin(); wgi != new_geoms->end(); ++wgi) {
       GeomEntry &entry = (*wgi);
-      nassertv(entry._geom.test_ref_count_integrity());
+      nassertr(entry._geom.test_ref_count_integrity(), any_changed);
       PT(Geom) geom = entry._geom.get_write_pointer();
       geom->unify_in_place(max_indices, preserve_order);
     }
   }
   CLOSE_ITERATE_CURRENT_AND_UPSTREAM(_cycler);
 
-  if (any_changed) {
-    mark_internal_bounds_stale();
-  }
+  return any_changed;
 }
 
 /**
@@ -99,6 +99,7 @@ public:
   void do_premunge(GraphicsStateGuardianBase *gsg,
                    const RenderState *node_state,
                    GeomTransformer &transformer);
+  bool do_unify(int max_indices, bool preserve_order);
 
 protected:
   virtual void r_mark_geom_bounds_stale(Thread *current_thread);
@@ -15,6 +15,7 @@
 #include "alphaTestAttrib.cxx"
 #include "findApproxPath.cxx"
 #include "findApproxLevelEntry.cxx"
+#include "flattenTask.cxx"
 #include "fog.cxx"
 #include "fogAttrib.cxx"
 #include "geomDrawCallbackData.cxx"
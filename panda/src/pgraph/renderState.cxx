@@ -42,7 +42,6 @@ LightReMutex *RenderState::_states_lock = nullptr;
 RenderState::States RenderState::_states;
 const RenderState *RenderState::_empty_state = nullptr;
 UpdateSeq RenderState::_last_cycle_detect;
-size_t RenderState::_garbage_index = 0;
 
 PStatCollector RenderState::_cache_update_pcollector("*:State Cache:Update");
 PStatCollector RenderState::_garbage_collect_pcollector("*:State Cache:Garbage Collect");
@@ -619,31 +618,44 @@ unref() const {
   // garbage collection in effect.  In this case we will pull the object out
   // of the cache when its reference count goes to 0.
 
-  // We always have to grab the lock, since we will definitely need to be
-  // holding it if we happen to drop the reference count to 0. Having to grab
-  // the lock at every call to unref() is a big limiting factor on
-  // parallelization.
-  LightReMutexHolder holder(*_states_lock);
-
   if (auto_break_cycles && uniquify_states) {
     if (get_cache_ref_count() > 0 &&
         get_ref_count() == get_cache_ref_count() + 1) {
       // If we are about to remove the one reference that is not in the cache,
       // leaving only references in the cache, then we need to check for a
-      // cycle involving this RenderState and break it if it exists.
+      // cycle involving this RenderState and break it if it exists.  The cache
+      // is protected by _states_lock.
+      LightReMutexHolder holder(*_states_lock);
       ((RenderState *)this)->detect_and_break_cycles();
     }
   }
 
-  if (ReferenceCount::unref()) {
-    // The reference count is still nonzero.
-    return true;
+  if (_saved_entry == -1) {
+    // This state isn't in the global table, so no one else can find it.
+    if (ReferenceCount::unref()) {
+      return true;
+    }
+
+  } else {
+    // Only the lock on this state's shard of the global table is needed to
+    // drop the reference, since return_unique() looks up states while holding
+    // only that lock.  Threads releasing unrelated states don't contend.
+    States::Holder shard_holder(_states.get_shard_for(this));
+    if (ReferenceCount::unref()) {
+      // The reference count is still nonzero.
+      return true;
+    }
+
+    // The reference count has just reached zero.  Make sure the object is
+    // removed from the global object pool, before anyone else finds it and
+    // tries to ref it.
+    ((RenderState *)this)->release_new();
   }
 
-  // The reference count has just reached zero.  Make sure the object is
-  // removed from the global object pool, before anyone else finds it and
-  // tries to ref it.
-  ((RenderState *)this)->release_new();
+  // Now nothing can find this object to ref it again, so it is safe to take
+  // _states_lock only now, after letting go of the shard, to clean up the
+  // composition caches that point to it.
+  LightReMutexHolder holder(*_states_lock);
   ((RenderState *)this)->remove_cache_pointers();
 
   return false;
@@ -716,8 +728,7 @@ get_max_priority() {
  */
 int RenderState::
 get_num_states() {
-  LightReMutexHolder holder(*_states_lock);
-  return _states.get_num_entries();
+  return (int)_states.get_num_entries();
 }
 
 /**
@@ -736,39 +747,44 @@ get_num_states() {
 int RenderState::
 get_num_unused_states() {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
   // First, we need to count the number of times each RenderState object is
   // recorded in the cache.
   typedef pmap<const RenderState *, int> StateCount;
   StateCount state_count;
 
-  size_t size = _states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const RenderState *state = _states.get_key(si);
-
-    size_t i;
-    size_t cache_size = state->_composition_cache.get_num_entries();
-    for (i = 0; i < cache_size; ++i) {
-      const RenderState *result = state->_composition_cache.get_data(i)._result;
-      if (result != nullptr && result != state) {
-        // Here's a RenderState that's recorded in the cache.  Count it.
-        std::pair<StateCount::iterator, bool> ir =
-          state_count.insert(StateCount::value_type(result, 1));
-        if (!ir.second) {
-          // If the above insert operation fails, then it's already in the
-          // cache; increment its value.
-          (*(ir.first)).second++;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const RenderState *state = table.get_key(si);
+
+      size_t i;
+      size_t cache_size = state->_composition_cache.get_num_entries();
+      for (i = 0; i < cache_size; ++i) {
+        const RenderState *result = state->_composition_cache.get_data(i)._result;
+        if (result != nullptr && result != state) {
+          // Here's a RenderState that's recorded in the cache.  Count it.
+          std::pair<StateCount::iterator, bool> ir =
+            state_count.insert(StateCount::value_type(result, 1));
+          if (!ir.second) {
+            // If the above insert operation fails, then it's already in the
+            // cache; increment its value.
+            (*(ir.first)).second++;
+          }
         }
       }
-    }
-    cache_size = state->_invert_composition_cache.get_num_entries();
-    for (i = 0; i < cache_size; ++i) {
-      const RenderState *result = state->_invert_composition_cache.get_data(i)._result;
-      if (result != nullptr && result != state) {
-        std::pair<StateCount::iterator, bool> ir =
-          state_count.insert(StateCount::value_type(result, 1));
-        if (!ir.second) {
-          (*(ir.first)).second++;
+      cache_size = state->_invert_composition_cache.get_num_entries();
+      for (i = 0; i < cache_size; ++i) {
+        const RenderState *result = state->_invert_composition_cache.get_data(i)._result;
+        if (result != nullptr && result != state) {
+          std::pair<StateCount::iterator, bool> ir =
+            state_count.insert(StateCount::value_type(result, 1));
+          if (!ir.second) {
+            (*(ir.first)).second++;
+          }
         }
       }
     }
@@ -818,7 +834,7 @@ clear_cache() {
   LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_cache_update_pcollector);
-  int orig_size = _states.get_num_entries();
+  int orig_size = (int)_states.get_num_entries();
 
   // First, we need to copy the entire set of states to a temporary vector,
   // reference-counting each object.  That way we can walk through the copy,
@@ -829,10 +845,15 @@ clear_cache() {
     TempStates temp_states;
     temp_states.reserve(orig_size);
 
-    size_t size = _states.get_num_entries();
-    for (size_t si = 0; si < size; ++si) {
-      const RenderState *state = _states.get_key(si);
-      temp_states.push_back(state);
+    size_t num_shards = _states.get_num_shards();
+    for (size_t shi = 0; shi < num_shards; ++shi) {
+      States::Shard &shard = _states.get_shard(shi);
+      States::Holder shard_holder(shard);
+      size_t size = shard._table.get_num_entries();
+      for (size_t si = 0; si < size; ++si) {
+        const RenderState *state = shard._table.get_key(si);
+        temp_states.push_back(state);
+      }
     }
 
     // Now it's safe to walk through the list, destroying the cache within
@@ -870,7 +891,7 @@ clear_cache() {
     // the various objects' caches will go away.
   }
 
-  int new_size = _states.get_num_entries();
+  int new_size = (int)_states.get_num_entries();
   return orig_size - new_size;
 }
 
@@ -893,74 +914,90 @@ garbage_collect() {
   LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_garbage_collect_pcollector);
-  size_t orig_size = _states.get_num_entries();
-
-  // How many elements to process this pass?
-  size_t size = orig_size;
-  size_t num_this_pass = std::max(0, int(size * garbage_collect_states_rate));
-  if (num_this_pass <= 0) {
-    return num_attribs;
-  }
-
   bool break_and_uniquify = (auto_break_cycles && uniquify_transforms);
 
-  size_t si = _garbage_index;
-  if (si >= size) {
-    si = 0;
-  }
+  // Each shard of the table is collected in turn, so that only one shard at a
+  // time is blocked from other threads looking up new states.
+  int num_freed = 0;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    States::Shard &shard = _states.get_shard(shi);
+    States::Holder shard_holder(shard);
+    States::Table &table = shard._table;
+    size_t orig_size = table.get_num_entries();
+
+    // How many elements to process this pass?
+    size_t size = orig_size;
+    size_t num_this_pass = std::max(0, int(size * garbage_collect_states_rate));
+    if (num_this_pass <= 0) {
+      continue;
+    }
 
-  num_this_pass = std::min(num_this_pass, size);
-  size_t stop_at_element = (si + num_this_pass) % size;
+    size_t si = shard._garbage_index;
+    if (si >= size) {
+      si = 0;
+    }
 
-  do {
-    RenderState *state = (RenderState *)_states.get_key(si);
-    if (break_and_uniquify) {
-      if (state->get_cache_ref_count() > 0 &&
-          state->get_ref_count() == state->get_cache_ref_count()) {
-        // If we have removed all the references to this state not in the
-        // cache, leaving only references in the cache, then we need to
-        // check for a cycle involving this RenderState and break it if it
-        // exists.
-        state->detect_and_break_cycles();
+    num_this_pass = std::min(num_this_pass, size);
+    size_t stop_at_element = (si + num_this_pass) % size;
+
+    do {
+      RenderState *state = (RenderState *)table.get_key(si);
+      if (break_and_uniquify) {
+        if (state->get_cache_ref_count() > 0 &&
+            state->get_ref_count() == state->get_cache_ref_count()) {
+          // If we have removed all the references to this state not in the
+          // cache, leaving only references in the cache, then we need to
+          // check for a cycle involving this RenderState and break it if
+          // it exists.
+          state->detect_and_break_cycles();
+        }
       }
-    }
 
-    if (state->get_ref_count() == 1) {
-      // This state has recently been unreffed to 1 (the one we added when
-      // we stored it in the cache).  Now it's time to delete it.  This is
-      // safe, because we're holding the _states_lock, so it's not possible
-      // for some other thread to find the state in the cache and ref it
-      // while we're doing this.
-      state->release_new();
-      state->remove_cache_pointers();
-      state->cache_unref();
-      delete state;
-
-      // When we removed it from the hash map, it swapped the last element
-      // with the one we just removed.  So the current index contains one we
-      // still need to visit.
-      --size;
-      --si;
-      if (stop_at_element > 0) {
-        --stop_at_element;
+      if (state->get_ref_count() == 1) {
+        // This state has recently been unreffed to 1 (the one we added when
+        // we stored it in the cache).  Now it's time to delete it.  This is
+        // safe, because we're holding the lock on its shard, so it's not
+        // possible for some other thread to find the state in the cache and
+        // ref it while we're doing this.
+        state->release_new();
+        state->remove_cache_pointers();
+        state->cache_unref();
+        delete state;
+
+        // When we removed it from the hash map, it swapped the last element
+        // with the one we just removed.  So the current index contains one
+        // we still need to visit.
+        --size;
+        --si;
+        if (stop_at_element > 0) {
+          --stop_at_element;
+        }
+        if (size == 0) {
+          // The shard is now empty.
+          si = 0;
+          break;
+        }
       }
-    }
 
-    si = (si + 1) % size;
-  } while (si != stop_at_element);
-  _garbage_index = si;
+      si = (si + 1) % size;
+    } while (si != stop_at_element);
+    shard._garbage_index = si;
 
-  nassertr(_states.get_num_entries() == size, 0);
+    nassertr(table.get_num_entries() == size, 0);
 
 #ifdef _DEBUG
-  nassertr(_states.validate(), 0);
+    nassertr(table.validate(), 0);
 #endif
 
-  // If we just cleaned up a lot of states, see if we can reduce the table in
-  // size.  This will help reduce iteration overhead in the future.
-  _states.consider_shrink_table();
+    // If we just cleaned up a lot of states, see if we can reduce the table
+    // in size.  This will help reduce iteration overhead in the future.
+    table.consider_shrink_table();
 
-  return (int)orig_size - (int)size + num_attribs;
+    num_freed += (int)orig_size - (int)size;
+  }
+
+  return num_freed + num_attribs;
 }
 
 /**
@@ -970,13 +1007,18 @@ garbage_collect() {
 void RenderState::
 clear_munger_cache() {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
-  size_t size = _states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    RenderState *state = (RenderState *)(_states.get_key(si));
-    state->_mungers.clear();
-    state->_munged_states.clear();
-    state->_last_mi = -1;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      RenderState *state = (RenderState *)(table.get_key(si));
+      state->_mungers.clear();
+      state->_munged_states.clear();
+      state->_last_mi = -1;
+    }
   }
 }
 
@@ -996,65 +1038,70 @@ clear_munger_cache() {
 void RenderState::
 list_cycles(ostream &out) {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
   typedef pset<const RenderState *> VisitedStates;
   VisitedStates visited;
   CompositionCycleDesc cycle_desc;
 
-  size_t size = _states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const RenderState *state = _states.get_key(si);
-
-    bool inserted = visited.insert(state).second;
-    if (inserted) {
-      ++_last_cycle_detect;
-      if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
-        // This state begins a cycle.
-        CompositionCycleDesc::reverse_iterator csi;
-
-        out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
-            << "state " << (void *)state << ":" << state->get_ref_count()
-            << " =\n";
-        state->write(out, 2);
-        for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
-          const CompositionCycleDescEntry &entry = (*csi);
-          if (entry._inverted) {
-            out << "invert composed with ";
-          } else {
-            out << "composed with ";
-          }
-          out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
-              << " " << *entry._obj << "\n"
-              << "produces " << (const void *)entry._result << ":"
-              << entry._result->get_ref_count() << " =\n";
-          entry._result->write(out, 2);
-          visited.insert(entry._result);
-        }
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const RenderState *state = table.get_key(si);
 
-        cycle_desc.clear();
-      } else {
+      bool inserted = visited.insert(state).second;
+      if (inserted) {
         ++_last_cycle_detect;
-        if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+        if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
           // This state begins a cycle.
-          CompositionCycleDesc::iterator csi;
+          CompositionCycleDesc::reverse_iterator csi;
 
-          out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
-              << "state ";
-          for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+          out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
+              << "state " << (void *)state << ":" << state->get_ref_count()
+              << " =\n";
+          state->write(out, 2);
+          for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
             const CompositionCycleDescEntry &entry = (*csi);
-            out << (const void *)entry._result << ":"
+            if (entry._inverted) {
+              out << "invert composed with ";
+            } else {
+              out << "composed with ";
+            }
+            out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
+                << " " << *entry._obj << "\n"
+                << "produces " << (const void *)entry._result << ":"
                 << entry._result->get_ref_count() << " =\n";
             entry._result->write(out, 2);
-            out << (const void *)entry._obj << ":"
-                << entry._obj->get_ref_count() << " =\n";
-            entry._obj->write(out, 2);
             visited.insert(entry._result);
           }
-          out << (void *)state << ":"
-              << state->get_ref_count() << " =\n";
-          state->write(out, 2);
 
           cycle_desc.clear();
+        } else {
+          ++_last_cycle_detect;
+          if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+            // This state begins a cycle.
+            CompositionCycleDesc::iterator csi;
+
+            out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
+                << "state ";
+            for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+              const CompositionCycleDescEntry &entry = (*csi);
+              out << (const void *)entry._result << ":"
+                  << entry._result->get_ref_count() << " =\n";
+              entry._result->write(out, 2);
+              out << (const void *)entry._obj << ":"
+                  << entry._obj->get_ref_count() << " =\n";
+              entry._obj->write(out, 2);
+              visited.insert(entry._result);
+            }
+            out << (void *)state << ":"
+                << state->get_ref_count() << " =\n";
+            state->write(out, 2);
+
+            cycle_desc.clear();
+          }
         }
       }
     }
@@ -1070,12 +1117,17 @@ list_cycles(ostream &out) {
 void RenderState::
 list_states(ostream &out) {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
-  size_t size = _states.get_num_entries();
-  out << size << " states:\n";
-  for (size_t si = 0; si < size; ++si) {
-    const RenderState *state = _states.get_key(si);
-    state->write(out, 2);
+  out << _states.get_num_entries() << " states:\n";
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const RenderState *state = table.get_key(si);
+      state->write(out, 2);
+    }
   }
 }
 
@@ -1090,48 +1142,115 @@ validate_states() {
   PStatTimer timer(_state_validate_pcollector);
 
   LightReMutexHolder holder(*_states_lock);
-  if (_states.is_empty()) {
-    return true;
-  }
-
-  if (!_states.validate()) {
-    pgraph_cat.error()
-      << "RenderState::_states cache is invalid!\n";
-    return false;
-  }
-
-  size_t size = _states.get_num_entries();
-  size_t si = 0;
-  nassertr(si < size, false);
-  nassertr(_states.get_key(si)->get_ref_count() >= 0, false);
-  size_t snext = si;
-  ++snext;
-  while (snext < size) {
-    nassertr(_states.get_key(snext)->get_ref_count() >= 0, false);
-    const RenderState *ssi = _states.get_key(si);
-    const RenderState *ssnext = _states.get_key(snext);
-    int c = ssi->compare_to(*ssnext);
-    int ci = ssnext->compare_to(*ssi);
-    if ((ci < 0) != (c > 0) ||
-        (ci > 0) != (c < 0) ||
-        (ci == 0) != (c == 0)) {
+  States::AllHolder shards_holder(_states);
+
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    if (table.is_empty()) {
+      continue;
+    }
+
+    if (!table.validate()) {
       pgraph_cat.error()
-        << "RenderState::compare_to() not defined properly!\n";
-      pgraph_cat.error(false)
-        << "(a, b): " << c << "\n";
-      pgraph_cat.error(false)
-        << "(b, a): " << ci << "\n";
-      ssi->write(pgraph_cat.error(false), 2);
-      ssnext->write(pgraph_cat.error(false), 2);
+        << "RenderState::_states cache shard " << shi << " is invalid!\n";
       return false;
     }
-    si = snext;
+
+    size_t size = table.get_num_entries();
+    size_t si = 0;
+    nassertr(si < size, false);
+    nassertr(table.get_key(si)->get_ref_count() >= 0, false);
+    size_t snext = si;
     ++snext;
+    while (snext < size) {
+      nassertr(table.get_key(snext)->get_ref_count() >= 0, false);
+      const RenderState *ssi = table.get_key(si);
+      const RenderState *ssnext = table.get_key(snext);
+      int c = ssi->compare_to(*ssnext);
+      int ci = ssnext->compare_to(*ssi);
+      if ((ci < 0) != (c > 0) ||
+          (ci > 0) != (c < 0) ||
+          (ci == 0) != (c == 0)) {
+        pgraph_cat.error()
+          << "RenderState::compare_to() not defined properly!\n";
+        pgraph_cat.error(false)
+          << "(a, b): " << c << "\n";
+        pgraph_cat.error(false)
+          << "(b, a): " << ci << "\n";
+        ssi->write(pgraph_cat.error(false), 2);
+        ssnext->write(pgraph_cat.error(false), 2);
+        return false;
+      }
+      si = snext;
+      ++snext;
+    }
   }
 
   return true;
 }
 
+/**
+ * Returns the number of separately-locked shards into which the global table
+ * of unique RenderStates is split.  This is controlled by the config variable
+ * state-cache-num-shards.
+ */
+size_t RenderState::
+get_num_state_shards() {
+  return _states.get_num_shards();
+}
+
+/**
+ * Returns the number of times a newly-created RenderState was found to
+ * already have an equivalent in the nth shard of the global table.  This is
+ * useful only for performance analysis.
+ */
+size_t RenderState::
+get_state_shard_hits(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._hits);
+}
+
+/**
+ * Returns the number of times a newly-created RenderState was added to the
+ * nth shard of the global table, because no equivalent state was found.  This
+ * is useful only for performance analysis.
+ */
+size_t RenderState::
+get_state_shard_misses(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._misses);
+}
+
+/**
+ * Returns the number of times a thread had to wait for another thread to
+ * release the lock on the nth shard of the global table.  This is useful only
+ * for performance analysis.
+ */
+size_t RenderState::
+get_state_shard_contentions(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._contentions);
+}
+
+/**
+ * Resets the hit, miss and contention counters on all shards of the global
+ * table to zero.
+ */
+void RenderState::
+clear_state_shard_counters() {
+  _states.clear_counters();
+}
+
+/**
+ * Lists the number of states and the hit, miss and contention counters for
+ * each shard of the global table, one per line.
+ */
+void RenderState::
+list_state_shards(ostream &out) {
+  _states.write(out, "RenderState");
+}
+
 /**
  * Returns the union of the Geom::GeomRendering bits that will be required
  * once this RenderState is applied to a geom which includes the indicated
@@ -1276,8 +1395,6 @@ return_unique(RenderState *state) {
   }
 #endif
 
-  LightReMutexHolder holder(*_states_lock);
-
   if (state->_saved_entry != -1) {
     // This state is already in the cache.  nassertr(_states.find(state) ==
     // state->_saved_entry, pt_state);
@@ -1285,7 +1402,8 @@ return_unique(RenderState *state) {
   }
 
   // Ensure each of the individual attrib pointers has been uniquified before
-  // we add the state to the cache.
+  // we add the state to the cache.  This must be done before we pick the
+  // shard, since it may change the state's hash.
   if (!uniquify_attribs && !state->is_empty()) {
     SlotMask mask = state->_filled_slots;
     int slot = mask.get_lowest_on_bit();
@@ -1298,29 +1416,47 @@ return_unique(RenderState *state) {
     }
   }
 
-  int si = _states.find(state);
-  if (si != -1) {
-    // There's an equivalent state already in the set.  Return it.  The state
-    // that was passed may be newly created and therefore may not be
-    // automatically deleted.  Do that if necessary.
-    if (state->get_ref_count() == 0) {
-      delete state;
+  CPT(RenderState) result;
+  {
+    // Only the shard of the table in which this state belongs needs to be
+    // locked, so other threads can look up unrelated states in parallel.
+    States::Shard &shard = _states.get_shard_for(state);
+    States::Holder holder(shard);
+
+    if (state->_saved_entry != -1) {
+      // Another thread beat us to adding this very state.
+      return state;
     }
-    return _states.get_key(si);
-  }
 
-  // Not already in the set; add it.
-  if (garbage_collect_states) {
-    // If we'll be garbage collecting states explicitly, we'll increment the
-    // reference count when we store it in the cache, so that it won't be
-    // deleted while it's in it.
-    state->cache_ref();
+    int si = shard._table.find(state);
+    if (si == -1) {
+      // Not already in the set; add it.
+      shard.inc_misses();
+      if (garbage_collect_states) {
+        // If we'll be garbage collecting states explicitly, we'll increment
+        // the reference count when we store it in the cache, so that it
+        // won't be deleted while it's in it.
+        state->cache_ref();
+      }
+      si = shard._table.store(state, nullptr);
+
+      // Save the index and return the input state.
+      state->_saved_entry = si;
+      return state;
+    }
+
+    shard.inc_hits();
+    result = shard._table.get_key(si);
   }
-  si = _states.store(state, nullptr);
 
-  // Save the index and return the input state.
-  state->_saved_entry = si;
-  return state;
+  // There's an equivalent state already in the set.  Return it.  The state
+  // that was passed may be newly created and therefore may not be
+  // automatically deleted.  Do that if necessary.  This has to happen after
+  // we have let go of the shard, since the destructor grabs _states_lock.
+  if (state->get_ref_count() == 0) {
+    delete state;
+  }
+  return result;
 }
 
 /**
@@ -1584,15 +1720,16 @@ r_detect_reverse_cycles(const RenderState *start_state,
  * This inverse of return_new, this releases this object from the global
  * RenderState table.
  *
- * You must already be holding _states_lock before you call this method.
+ * You must already be holding the lock on the shard of the table containing
+ * this state before you call this method.
  */
 void RenderState::
 release_new() {
-  nassertv(_states_lock->debug_is_locked());
-
   if (_saved_entry != -1) {
+    States::Shard &shard = _states.get_shard_for(this);
+    nassertv(shard.debug_is_locked());
     _saved_entry = -1;
-    nassertv_always(_states.remove(this));
+    nassertv_always(shard._table.remove(this));
   }
 }
 
@@ -1833,7 +1970,15 @@ init_states() {
   // _states_lock without a startup race condition.  For the meantime, this is
   // OK because we guarantee that this method is called at static init time,
   // presumably when there is still only one thread in the world.
+  ConfigVariableInt state_cache_num_shards
+  ("state-cache-num-shards", 16,
+   PRC_DESC("The number of separately-locked shards into which the global "
+            "tables of unique TransformState and RenderState objects are "
+            "split.  Increasing this reduces lock contention when many "
+            "threads are creating states at once."));
+
   _states_lock = new LightReMutex("RenderState::_states_lock");
+  _states.init(state_cache_num_shards);
   _cache_stats.init();
   nassertv(Thread::get_current_thread() == Thread::get_main_thread());
 
@@ -1841,7 +1986,7 @@ init_states() {
   // is declared globally, and lives forever.
   RenderState *state = new RenderState;
   state->local_object();
-  state->_saved_entry = _states.store(state, nullptr);
+  state->_saved_entry = _states.get_shard_for(state)._table.store(state, nullptr);
   _empty_state = state;
 }
 
@@ -30,6 +30,7 @@
 #include "lightMutex.h"
 #include "deletedChain.h"
 #include "simpleHashMap.h"
+#include "shardedStateTable.h"
 #include "cacheStats.h"
 #include "renderAttribRegistry.h"
 
@@ -146,6 +147,13 @@ PUBLISHED:
   static bool validate_states();
   EXTENSION(static PyObject *get_states());
 
+  static size_t get_num_state_shards();
+  static size_t get_state_shard_hits(size_t n);
+  static size_t get_state_shard_misses(size_t n);
+  static size_t get_state_shard_contentions(size_t n);
+  static void clear_state_shard_counters();
+  static void list_state_shards(std::ostream &out);
+
 PUBLISHED:
   // These methods are intended for use by low-level code, but they're also
   // handy enough to expose to high-level users.
@@ -227,11 +235,12 @@ public:
   mutable UpdateSeq _generated_shader_seq;
 
 private:
-  // This mutex protects _states.  It also protects any modification to the
-  // cache, which is encoded in _composition_cache and
-  // _invert_composition_cache.
+  // This mutex protects any modification to the cache, which is encoded in
+  // _composition_cache and _invert_composition_cache.  The global table of
+  // unique states is split into shards with their own locks; if both are
+  // needed, _states_lock must always be acquired first.
   static LightReMutex *_states_lock;
-  typedef SimpleHashMap<const RenderState *, std::nullptr_t, indirect_compare_to_hash<const RenderState *> > States;
+  typedef ShardedStateTable<RenderState, indirect_compare_to_hash<const RenderState *> > States;
   static States _states;
   static const RenderState *_empty_state;
 
@@ -281,10 +290,6 @@ private:
   UpdateSeq _cycle_detect;
   static UpdateSeq _last_cycle_detect;
 
-  // This keeps track of our current position through the garbage collection
-  // cycle.
-  static size_t _garbage_index;
-
   static PStatCollector _cache_update_pcollector;
   static PStatCollector _garbage_collect_pcollector;
   static PStatCollector _state_compose_pcollector;
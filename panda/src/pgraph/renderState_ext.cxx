@@ -119,21 +119,27 @@ PyObject *Extension<RenderState>::
 get_states() {
   extern struct Dtool_PyTypedObject Dtool_RenderState;
   LightReMutexHolder holder(*RenderState::_states_lock);
+  RenderState::States::AllHolder shards_holder(RenderState::_states);
 
   size_t num_states = RenderState::_states.get_num_entries();
   PyObject *list = PyList_New(num_states);
   size_t i = 0;
 
-  size_t size = RenderState::_states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const RenderState *state = RenderState::_states.get_key(si);
-    state->ref();
-    PyObject *a =
-      DTool_CreatePyInstanceTyped((void *)state, Dtool_RenderState,
-                                  true, true, state->get_type_index());
-    nassertr(i < num_states, list);
-    PyList_SET_ITEM(list, i, a);
-    ++i;
+  size_t num_shards = RenderState::_states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const RenderState::States::Table &table =
+      RenderState::_states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const RenderState *state = table.get_key(si);
+      state->ref();
+      PyObject *a =
+        DTool_CreatePyInstanceTyped((void *)state, Dtool_RenderState,
+                                    true, true, state->get_type_index());
+      nassertr(i < num_states, list);
+      PyList_SET_ITEM(list, i, a);
+      ++i;
+    }
   }
   nassertr(i == num_states, list);
   return list;
@@ -178,12 +178,7 @@ void SceneGraphReducer::
 unify(PandaNode *root, bool preserve_order) {
   nassertv(check_live_flatten(root));
   PStatTimer timer(_unify_collector);
-
-  int max_indices = max_collect_indices;
-  if (_gsg != nullptr) {
-    max_indices = std::min(max_indices, _gsg->get_max_vertices_per_primitive());
-  }
-  r_unify(root, max_indices, preserve_order);
+  r_unify(root, get_max_unify_indices(), preserve_order);
 }
 
 /**
@@ -202,6 +197,19 @@ remove_unused_vertices(PandaNode *root) {
   Thread::consider_yield();
 }
 
+/**
+ * Returns the maximum number of vertices that unify() will allow in a single
+ * GeomPrimitive.
+ */
+int SceneGraphReducer::
+get_max_unify_indices() const {
+  int max_indices = max_collect_indices;
+  if (_gsg != nullptr) {
+    max_indices = std::min(max_indices, _gsg->get_max_vertices_per_primitive());
+  }
+  return max_indices;
+}
+
 /**
  * In a non-release build, returns false if the node is correctly not in a
  * live scene graph.  (Calling flatten on a node that is part of a live scene
@@ -232,6 +240,30 @@ check_live_flatten(PandaNode *node) {
 void SceneGraphReducer::
 r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
                 int attrib_types, GeomTransformer &transformer) {
+  AccumulatedAttribs next_attribs;
+  if (apply_attribs_to_node(node, attribs, attrib_types, transformer,
+                            next_attribs)) {
+    // Now it's safe to traverse through all of our children.
+    int num_children = node->get_num_children();
+    for (int i = 0; i < num_children; i++) {
+      PandaNode *child_node = node->get_child(i);
+      r_apply_attribs(child_node, next_attribs, attrib_types, transformer);
+    }
+  }
+  Thread::consider_yield();
+}
+
+/**
+ * Performs the part of apply_attribs() that concerns the indicated node
+ * itself: applies the accumulated attribs to it, and duplicates any of its
+ * children that are instanced.  Fills in next_attribs with the attribs that
+ * should be passed on to each of the node's children.  Returns true if the
+ * children should be visited next, or false if the traversal stops here.
+ */
+bool SceneGraphReducer::
+apply_attribs_to_node(PandaNode *node, const AccumulatedAttribs &attribs,
+                      int attrib_types, GeomTransformer &transformer,
+                      AccumulatedAttribs &next_attribs) {
   if (pgraph_cat.is_spam()) {
     pgraph_cat.spam()
       << "r_apply_attribs(" << *node << "), node's attribs are:\n";
@@ -240,7 +272,7 @@ r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
     node->get_effects()->write(pgraph_cat.spam(false), 2);
   }
 
-  AccumulatedAttribs next_attribs(attribs);
+  next_attribs = attribs;
   next_attribs.collect(node, attrib_types);
 
   if (pgraph_cat.is_spam()) {
@@ -259,7 +291,7 @@ r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
         << " doesn't allow flattening below itself.\n";
     }
     next_attribs.apply_to_node(node, attrib_types);
-    return;
+    return false;
   }
 
   int apply_types = 0;
@@ -334,7 +366,7 @@ r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
 
           if (no_unsupported_copy) {
             nassert_raise("unsupported copy");
-            return;
+            return false;
           }
           resist_copy = true;
 
@@ -358,13 +390,8 @@ r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
     next_attribs.apply_to_node(node, attrib_types);
   }
 
-  // Now it's safe to traverse through all of our children.
-  nassertv(num_children == node->get_num_children());
-  for (i = 0; i < num_children; i++) {
-    PandaNode *child_node = node->get_child(i);
-    r_apply_attribs(child_node, next_attribs, attrib_types, transformer);
-  }
-  Thread::consider_yield();
+  nassertr(num_children == node->get_num_children(), false);
+  return true;
 }
 
 
@@ -381,105 +408,132 @@ r_flatten(PandaNode *grandparent_node, PandaNode *parent_node,
       << ")\n";
   }
 
+  int num_nodes = 0;
+
+  if (begin_flatten(parent_node, combine_siblings_bits)) {
+    // First, recurse on each of the children.
+    PandaNode::Children cr = parent_node->get_children();
+    int num_children = cr.get_num_children();
+    for (int i = 0; i < num_children; i++) {
+      PT(PandaNode) child_node = cr.get_child(i);
+      num_nodes += r_flatten(parent_node, child_node, combine_siblings_bits);
+    }
+
+    num_nodes += finish_flatten(grandparent_node, parent_node,
+                                combine_siblings_bits);
+  }
+
+  return num_nodes;
+}
+
+/**
+ * Performs the part of r_flatten() that precedes the visit to the children of
+ * parent_node.  This may adjust combine_siblings_bits for the children.
+ * Returns true if the children should be visited, or false if the node does
+ * not allow flattening below itself.
+ */
+bool SceneGraphReducer::
+begin_flatten(PandaNode *parent_node, int &combine_siblings_bits) {
   if ((combine_siblings_bits & (CS_geom_node | CS_other | CS_recurse)) != 0) {
     // Unset CS_within_radius, since we're going to flatten everything anyway.
     // This avoids needlessly calculating the bounding volume.
     combine_siblings_bits &= ~CS_within_radius;
   }
 
-  int num_nodes = 0;
-
   if (!parent_node->safe_to_flatten_below()) {
     if (pgraph_cat.is_spam()) {
       pgraph_cat.spam()
         << "Not traversing further; " << *parent_node
         << " doesn't allow flattening below itself.\n";
     }
+    return false;
+  }
 
-  } else {
-    if ((combine_siblings_bits & CS_within_radius) != 0) {
-      CPT(BoundingVolume) bv = parent_node->get_bounds();
-      if (bv->is_of_type(BoundingSphere::get_class_type())) {
-        const BoundingSphere *bs = DCAST(BoundingSphere, bv);
+  if ((combine_siblings_bits & CS_within_radius) != 0) {
+    CPT(BoundingVolume) bv = parent_node->get_bounds();
+    if (bv->is_of_type(BoundingSphere::get_class_type())) {
+      const BoundingSphere *bs = DCAST(BoundingSphere, bv);
+      if (pgraph_cat.is_spam()) {
+        pgraph_cat.spam()
+          << "considering radius of " << *parent_node
+          << ": " << *bs << " vs. " << _combine_radius << "\n";
+      }
+      if (!bs->is_infinite() && (bs->is_empty() || bs->get_radius() <= _combine_radius)) {
+        // This node fits within the specified radius; from here on down, we
+        // will have CS_other set, instead of CS_within_radius.
         if (pgraph_cat.is_spam()) {
           pgraph_cat.spam()
-            << "considering radius of " << *parent_node
-            << ": " << *bs << " vs. " << _combine_radius << "\n";
-        }
-        if (!bs->is_infinite() && (bs->is_empty() || bs->get_radius() <= _combine_radius)) {
-          // This node fits within the specified radius; from here on down, we
-          // will have CS_other set, instead of CS_within_radius.
-          if (pgraph_cat.is_spam()) {
-            pgraph_cat.spam()
-              << "node fits within radius; flattening tighter.\n";
-          }
-          combine_siblings_bits &= ~CS_within_radius;
-          combine_siblings_bits |= (CS_geom_node | CS_other | CS_recurse);
+            << "node fits within radius; flattening tighter.\n";
         }
+        combine_siblings_bits &= ~CS_within_radius;
+        combine_siblings_bits |= (CS_geom_node | CS_other | CS_recurse);
       }
     }
+  }
 
-    // First, recurse on each of the children.
-    {
-      PandaNode::Children cr = parent_node->get_children();
-      int num_children = cr.get_num_children();
-      for (int i = 0; i < num_children; i++) {
-        PT(PandaNode) child_node = cr.get_child(i);
-        num_nodes += r_flatten(parent_node, child_node, combine_siblings_bits);
-      }
-    }
+  return true;
+}
 
-    // Now that the above loop has removed some children, the child list saved
-    // above is no longer accurate, so hereafter we must ask the node for its
-    // real child list.
-
-    // If we have CS_recurse set, then we flatten siblings before trying to
-    // flatten children.  Otherwise, we flatten children first, and then
-    // flatten siblings, which avoids overly enthusiastic flattening.
-    if ((combine_siblings_bits & CS_recurse) != 0 &&
-        parent_node->get_num_children() >= 2 &&
-        parent_node->safe_to_combine_children()) {
-      num_nodes += flatten_siblings(parent_node, combine_siblings_bits);
-    }
+/**
+ * Performs the part of r_flatten() that follows the visit to the children of
+ * parent_node, removing or combining the nodes that have become unnecessary.
+ * Returns the number of nodes removed.
+ */
+int SceneGraphReducer::
+finish_flatten(PandaNode *grandparent_node, PandaNode *parent_node,
+               int combine_siblings_bits) {
+  int num_nodes = 0;
 
-    if (parent_node->get_num_children() == 1) {
-      // If we now have exactly one child, consider flattening the node out.
-      PT(PandaNode) child_node = parent_node->get_child(0);
-      int child_sort = parent_node->get_child_sort(0);
+  // Visiting the children may have removed some of them, so any child list
+  // saved before then is no longer accurate; hereafter we must ask the node
+  // for its real child list.
+
+  // If we have CS_recurse set, then we flatten siblings before trying to
+  // flatten children.  Otherwise, we flatten children first, and then
+  // flatten siblings, which avoids overly enthusiastic flattening.
+  if ((combine_siblings_bits & CS_recurse) != 0 &&
+      parent_node->get_num_children() >= 2 &&
+      parent_node->safe_to_combine_children()) {
+    num_nodes += flatten_siblings(parent_node, combine_siblings_bits);
+  }
 
-      if (consider_child(grandparent_node, parent_node, child_node)) {
-        // Ok, do it.
-        parent_node->remove_child(child_node);
+  if (parent_node->get_num_children() == 1) {
+    // If we now have exactly one child, consider flattening the node out.
+    PT(PandaNode) child_node = parent_node->get_child(0);
+    int child_sort = parent_node->get_child_sort(0);
 
-        if (do_flatten_child(grandparent_node, parent_node, child_node)) {
-          // Done!
-          num_nodes++;
-        } else {
-          // Chicken out.
-          parent_node->add_child(child_node, child_sort);
-        }
+    if (consider_child(grandparent_node, parent_node, child_node)) {
+      // Ok, do it.
+      parent_node->remove_child(child_node);
+
+      if (do_flatten_child(grandparent_node, parent_node, child_node)) {
+        // Done!
+        num_nodes++;
+      } else {
+        // Chicken out.
+        parent_node->add_child(child_node, child_sort);
       }
     }
+  }
 
-    if ((combine_siblings_bits & CS_recurse) == 0 &&
-        (combine_siblings_bits & ~CS_recurse) != 0 &&
-        parent_node->get_num_children() >= 2 &&
-        parent_node->safe_to_combine_children()) {
-      num_nodes += flatten_siblings(parent_node, combine_siblings_bits);
-    }
+  if ((combine_siblings_bits & CS_recurse) == 0 &&
+      (combine_siblings_bits & ~CS_recurse) != 0 &&
+      parent_node->get_num_children() >= 2 &&
+      parent_node->safe_to_combine_children()) {
+    num_nodes += flatten_siblings(parent_node, combine_siblings_bits);
+  }
 
-    // Finally, if any of our remaining children are plain PandaNodes with no
-    // children, just remove them.
-    if (parent_node->safe_to_combine_children()) {
-      for (int i = parent_node->get_num_children() - 1; i >= 0; --i) {
-        PandaNode *child_node = parent_node->get_child(i);
-        if (child_node->is_exact_type(PandaNode::get_class_type()) &&
-            child_node->get_num_children() == 0 &&
-            child_node->get_transform()->is_identity() &&
-            child_node->get_effects()->is_empty()) {
-          parent_node->remove_child(child_node);
-          ++num_nodes;
-        }
+  // Finally, if any of our remaining children are plain PandaNodes with no
+  // children, just remove them.
+  if (parent_node->safe_to_combine_children()) {
+    for (int i = parent_node->get_num_children() - 1; i >= 0; --i) {
+      PandaNode *child_node = parent_node->get_child(i);
+      if (child_node->is_exact_type(PandaNode::get_class_type()) &&
+          child_node->get_num_children() == 0 &&
+          child_node->get_transform()->is_identity() &&
+          child_node->get_effects()->is_empty()) {
+        parent_node->remove_child(child_node);
+        ++num_nodes;
       }
     }
   }
@@ -802,18 +856,7 @@ r_collect_vertex_data(PandaNode *node, int collect_bits,
                       GeomTransformer &transformer, bool format_only) {
   int num_adjusted = 0;
 
-  int this_node_bits = 0;
-  if (node->is_of_type(ModelNode::get_class_type())) {
-    this_node_bits |= CVD_model;
-  }
-  if (!node->get_transform()->is_identity()) {
-    this_node_bits |= CVD_transform;
-  }
-  if (node->is_geom_node()) {
-    this_node_bits |= CVD_one_node_only;
-  }
-
-  if ((collect_bits & this_node_bits) != 0) {
+  if ((collect_bits & get_collect_node_bits(node)) != 0) {
     // We need to start a unique collection here.
     GeomTransformer new_transformer(transformer);
 
@@ -850,6 +893,26 @@ r_collect_vertex_data(PandaNode *node, int collect_bits,
   return num_adjusted;
 }
 
+/**
+ * Returns the set of CollectVertexData bits that describe the indicated node
+ * itself.  If any of these are included in collect_bits, a new collection is
+ * started at this node by collect_vertex_data().
+ */
+int SceneGraphReducer::
+get_collect_node_bits(PandaNode *node) {
+  int this_node_bits = 0;
+  if (node->is_of_type(ModelNode::get_class_type())) {
+    this_node_bits |= CVD_model;
+  }
+  if (!node->get_transform()->is_identity()) {
+    this_node_bits |= CVD_transform;
+  }
+  if (node->is_geom_node()) {
+    this_node_bits |= CVD_one_node_only;
+  }
+  return this_node_bits;
+}
+
 /**
  * The recursive implementation of make_nonindexed().
  */
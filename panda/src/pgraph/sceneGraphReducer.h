@@ -144,9 +144,15 @@ PUBLISHED:
 protected:
   void r_apply_attribs(PandaNode *node, const AccumulatedAttribs &attribs,
                        int attrib_types, GeomTransformer &transformer);
+  bool apply_attribs_to_node(PandaNode *node, const AccumulatedAttribs &attribs,
+                             int attrib_types, GeomTransformer &transformer,
+                             AccumulatedAttribs &next_attribs);
 
   int r_flatten(PandaNode *grandparent_node, PandaNode *parent_node,
                 int combine_siblings_bits);
+  bool begin_flatten(PandaNode *parent_node, int &combine_siblings_bits);
+  int finish_flatten(PandaNode *grandparent_node, PandaNode *parent_node,
+                     int combine_siblings_bits);
   int flatten_siblings(PandaNode *parent_node,
                        int combine_siblings_bits);
 
@@ -173,6 +179,7 @@ protected:
 
   int r_collect_vertex_data(PandaNode *node, int collect_bits,
                             GeomTransformer &transformer, bool format_only);
+  static int get_collect_node_bits(PandaNode *node);
   int r_make_nonindexed(PandaNode *node, int collect_bits);
   void r_unify(PandaNode *node, int max_indices, bool preserve_order);
   void r_register_vertices(PandaNode *node, GeomTransformer &transformer);
@@ -180,6 +187,8 @@ protected:
 
   void r_premunge(PandaNode *node, const RenderState *state);
 
+  int get_max_unify_indices() const;
+
 private:
   PT(GraphicsStateGuardianBase) _gsg;
   PN_stdfloat _combine_radius;
@@ -194,6 +203,8 @@ private:
   static PStatCollector _unify_collector;
   static PStatCollector _remove_unused_collector;
   static PStatCollector _premunge_collector;
+
+  friend class FlattenTask;
 };
 
 #include "sceneGraphReducer.I"
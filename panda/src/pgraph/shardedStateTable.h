@@ -0,0 +1,113 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file shardedStateTable.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef SHARDEDSTATETABLE_H
+#define SHARDEDSTATETABLE_H
+
+#include "pandabase.h"
+#include "simpleHashMap.h"
+#include "lightReMutex.h"
+#include "atomicAdjust.h"
+
+/**
+ * This is the global table of unique state objects used by TransformState
+ * and RenderState.  Rather than a single hash map protected by a single lock,
+ * the table is split into a fixed number of independently-locked shards,
+ * selected by the hash of the state.  Threads that are interning unrelated
+ * states therefore rarely contend with each other.
+ *
+ * The Compare class is the hash and comparison functor used for the
+ * SimpleHashMap within each shard; it must hash equivalent states alike.
+ *
+ * Each shard also counts the number of hits and misses recorded against it,
+ * and the number of times a thread found its lock already held by another
+ * thread, for low-level performance tuning.
+ */
+template<class State, class Compare>
+class ShardedStateTable {
+public:
+  typedef SimpleHashMap<const State *, std::nullptr_t, Compare> Table;
+
+  class Shard {
+  public:
+    INLINE Shard();
+
+    INLINE void acquire();
+    INLINE void release();
+    INLINE bool debug_is_locked() const;
+
+    INLINE void inc_hits();
+    INLINE void inc_misses();
+
+    LightReMutex _lock;
+    Table _table;
+
+    AtomicAdjust::Integer _hits;
+    AtomicAdjust::Integer _misses;
+    AtomicAdjust::Integer _contentions;
+
+    // This keeps track of our current position through the garbage
+    // collection cycle.  It is protected by _lock.
+    size_t _garbage_index;
+
+  private:
+    // Keep adjacent shards out of each other's cache lines.
+    char _padding[64];
+  };
+
+  class Holder {
+  public:
+    INLINE explicit Holder(Shard &shard);
+    INLINE ~Holder();
+
+    Holder(const Holder &copy) = delete;
+    Holder &operator = (const Holder &copy) = delete;
+
+  private:
+    Shard &_shard;
+  };
+
+  class AllHolder {
+  public:
+    INLINE explicit AllHolder(ShardedStateTable &table);
+    INLINE ~AllHolder();
+
+    AllHolder(const AllHolder &copy) = delete;
+    AllHolder &operator = (const AllHolder &copy) = delete;
+
+  private:
+    ShardedStateTable &_table;
+  };
+
+  ShardedStateTable() = default;
+  ShardedStateTable(const ShardedStateTable &copy) = delete;
+  ShardedStateTable &operator = (const ShardedStateTable &copy) = delete;
+
+  void init(int num_shards);
+
+  INLINE size_t get_num_shards() const;
+  INLINE Shard &get_shard(size_t n);
+  INLINE Shard &get_shard_for(const State *state);
+
+  size_t get_num_entries();
+  void clear_counters();
+  void write(std::ostream &out, const char *name);
+
+private:
+  Shard *_shards = nullptr;
+  size_t _num_shards = 0;
+};
+
+#include "shardedStateTable.I"
+
+#endif
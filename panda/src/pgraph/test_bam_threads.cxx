@@ -0,0 +1,178 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_bam_threads.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "bamFile.h"
+#include "geomNode.h"
+#include "geom.h"
+#include "geomTriangles.h"
+#include "geomVertexData.h"
+#include "geomVertexWriter.h"
+#include "texture.h"
+#include "textureAttrib.h"
+#include "renderState.h"
+#include "asyncParallelFor.h"
+#include "trueClock.h"
+
+#include <iomanip>
+
+// The number of GeomNodes in the scene, and the number of vertices in each.
+static const int num_nodes = 64;
+static const int num_vertices = 100000;
+
+// The number of textures in the scene, and their size.
+static const int num_textures = 8;
+static const int texture_size = 1024;
+
+// The number of times to read the file with each number of threads.
+static const int num_reads = 3;
+
+/**
+ * Makes a scene with a lot of vertex data and a few large textures, so that
+ * most of the file is made up of the large blocks of data that BamFile can
+ * copy on several threads.
+ */
+static PT(PandaNode)
+make_scene() {
+  PT(PandaNode) root = new PandaNode("root");
+
+  pvector<CPT(RenderState)> states;
+  for (int t = 0; t < num_textures; ++t) {
+    PT(Texture) tex = new Texture("tex");
+    tex->setup_2d_texture(texture_size, texture_size, Texture::T_unsigned_byte,
+                          Texture::F_rgba);
+    PTA_uchar image = PTA_uchar::empty_array((size_t)texture_size * texture_size * 4);
+    for (size_t i = 0; i < image.size(); ++i) {
+      image[i] = (unsigned char)(i * (t + 1));
+    }
+    tex->set_ram_image(image);
+    states.push_back(RenderState::make(TextureAttrib::make(tex)));
+  }
+
+  for (int n = 0; n < num_nodes; ++n) {
+    PT(GeomVertexData) vdata = new GeomVertexData
+      ("vdata", GeomVertexFormat::get_v3n3c4t2(), Geom::UH_static);
+    vdata->unclean_set_num_rows(num_vertices);
+    GeomVertexWriter vertex(vdata, InternalName::get_vertex());
+    GeomVertexWriter normal(vdata, InternalName::get_normal());
+    GeomVertexWriter color(vdata, InternalName::get_color());
+    GeomVertexWriter texcoord(vdata, InternalName::get_texcoord());
+    for (int i = 0; i < num_vertices; ++i) {
+      PN_stdfloat f = (PN_stdfloat)i / num_vertices;
+      vertex.set_data3(f, (PN_stdfloat)n, f * f);
+      normal.set_data3(0, 0, 1);
+      color.set_data4(f, 1 - f, 0.5f, 1);
+      texcoord.set_data2(f, 1 - f);
+    }
+
+    PT(GeomTriangles) tris = new GeomTriangles(Geom::UH_static);
+    for (int i = 0; i + 2 < num_vertices; i += 3) {
+      tris->add_vertices(i, i + 1, i + 2);
+    }
+
+    PT(Geom) geom = new Geom(vdata);
+    geom->add_primitive(tris);
+
+    PT(GeomNode) node = new GeomNode("node");
+    node->add_geom(geom, states[n % num_textures]);
+    root->add_child(node);
+  }
+
+  return root;
+}
+
+/**
+ * Reads the scene back from the file.  Fills in the time it took, in seconds,
+ * to read the objects from the stream and then to resolve them, which is
+ * when the deferred copies are made.  Returns false on failure.
+ */
+static bool
+read_scene(const Filename &filename, int num_threads, double &read_time,
+           double &resolve_time) {
+  // BamFile uses the threads of this chain besides the calling thread.
+  AsyncTaskChain *chain = AsyncParallelFor::get_task_chain("bam", 1);
+  chain->set_num_threads(std::max(num_threads - 1, 1));
+
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double start = clock->get_short_time();
+
+  BamFile bam;
+  bam.set_num_threads(num_threads);
+  if (!bam.open_read(filename)) {
+    return false;
+  }
+  TypedWritable *object = bam.read_object();
+  double middle = clock->get_short_time();
+  if (object == nullptr || !bam.resolve()) {
+    return false;
+  }
+  PT(PandaNode) node = DCAST(PandaNode, object);
+  bam.close();
+  double end = clock->get_short_time();
+
+  read_time = middle - start;
+  resolve_time = end - middle;
+  return node->get_num_children() == num_nodes;
+}
+
+int
+main(int argc, char *argv[]) {
+  Filename filename = (argc > 1) ? Filename::from_os_specific(argv[1]) :
+    Filename::temporary("", "bam", ".bam");
+
+  {
+    PT(PandaNode) scene = make_scene();
+    BamFile bam;
+    if (!bam.open_write(filename) || !bam.write_object(scene)) {
+      nout << "Unable to write " << filename << ".\n";
+      return 1;
+    }
+    bam.close();
+  }
+
+  nout << "Reading " << filename << ", "
+       << filename.get_file_size() / 1048576 << " MB:\n";
+
+  // Read it once to get it into the disk cache.
+  double read_time, resolve_time;
+  read_scene(filename, 1, read_time, resolve_time);
+
+  // With more than one thread, the copies are deferred from the read stage
+  // to the resolve stage, where they are divided across the threads.
+  nout << "  threads     read  resolve    total (ms)\n";
+
+  static const int thread_counts[] = { 1, 2, 4, 8 };
+  for (int num_threads : thread_counts) {
+    double best_read = 0.0, best_resolve = 0.0;
+    for (int i = 0; i < num_reads; ++i) {
+      if (!read_scene(filename, num_threads, read_time, resolve_time)) {
+        nout << "Unable to read " << filename << ".\n";
+        return 1;
+      }
+      if (i == 0 || read_time + resolve_time < best_read + best_resolve) {
+        best_read = read_time;
+        best_resolve = resolve_time;
+      }
+    }
+
+    nout << "  " << std::setw(7) << num_threads << std::fixed
+         << std::setprecision(1) << std::setw(9) << best_read * 1000.0
+         << std::setw(9) << best_resolve * 1000.0
+         << std::setw(9) << (best_read + best_resolve) * 1000.0 << "\n";
+  }
+
+  if (argc <= 1) {
+    filename.unlink();
+  }
+  return 0;
+}
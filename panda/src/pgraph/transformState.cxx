@@ -31,7 +31,6 @@ TransformState::States TransformState::_states;
 CPT(TransformState) TransformState::_identity_state;
 CPT(TransformState) TransformState::_invalid_state;
 UpdateSeq TransformState::_last_cycle_detect;
-size_t TransformState::_garbage_index = 0;
 bool TransformState::_uniquify_matrix = true;
 
 PStatCollector TransformState::_cache_update_pcollector("*:State Cache:Update");
@@ -794,31 +793,44 @@ unref() const {
   // garbage collection in effect.  In this case we will pull the object out
   // of the cache when its reference count goes to 0.
 
-  // We always have to grab the lock, since we will definitely need to be
-  // holding it if we happen to drop the reference count to 0. Having to grab
-  // the lock at every call to unref() is a big limiting factor on
-  // parallelization.
-  LightReMutexHolder holder(*_states_lock);
-
   if (auto_break_cycles && uniquify_transforms) {
     if (get_cache_ref_count() > 0 &&
         get_ref_count() == get_cache_ref_count() + 1) {
       // If we are about to remove the one reference that is not in the cache,
       // leaving only references in the cache, then we need to check for a
-      // cycle involving this TransformState and break it if it exists.
+      // cycle involving this TransformState and break it if it exists.  The cache
+      // is protected by _states_lock.
+      LightReMutexHolder holder(*_states_lock);
       ((TransformState *)this)->detect_and_break_cycles();
     }
   }
 
-  if (ReferenceCount::unref()) {
-    // The reference count is still nonzero.
-    return true;
+  if (_saved_entry == -1) {
+    // This state isn't in the global table, so no one else can find it.
+    if (ReferenceCount::unref()) {
+      return true;
+    }
+
+  } else {
+    // Only the lock on this state's shard of the global table is needed to
+    // drop the reference, since return_unique() looks up states while holding
+    // only that lock.  Threads releasing unrelated states don't contend.
+    States::Holder shard_holder(_states.get_shard_for(this));
+    if (ReferenceCount::unref()) {
+      // The reference count is still nonzero.
+      return true;
+    }
+
+    // The reference count has just reached zero.  Make sure the object is
+    // removed from the global object pool, before anyone else finds it and
+    // tries to ref it.
+    ((TransformState *)this)->release_new();
   }
 
-  // The reference count has just reached zero.  Make sure the object is
-  // removed from the global object pool, before anyone else finds it and
-  // tries to ref it.
-  ((TransformState *)this)->release_new();
+  // Now nothing can find this object to ref it again, so it is safe to take
+  // _states_lock only now, after letting go of the shard, to clean up the
+  // composition caches that point to it.
+  LightReMutexHolder holder(*_states_lock);
   ((TransformState *)this)->remove_cache_pointers();
 
   return false;
@@ -988,8 +1000,7 @@ write_composition_cache(ostream &out, int indent_level) const {
  */
 int TransformState::
 get_num_states() {
-  LightReMutexHolder holder(*_states_lock);
-  return _states.get_num_entries();
+  return (int)_states.get_num_entries();
 }
 
 /**
@@ -1008,6 +1019,7 @@ get_num_states() {
 int TransformState::
 get_num_unused_states() {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
   // First, we need to count the number of times each TransformState object is
   // recorded in the cache.  We could just trust get_cache_ref_count(), but
@@ -1015,33 +1027,37 @@ get_num_unused_states() {
   typedef pmap<const TransformState *, int> StateCount;
   StateCount state_count;
 
-  size_t size = _states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const TransformState *state = _states.get_key(si);
-
-    size_t i;
-    size_t cache_size = state->_composition_cache.get_num_entries();
-    for (i = 0; i < cache_size; ++i) {
-      const TransformState *result = state->_composition_cache.get_data(i)._result;
-      if (result != nullptr && result != state) {
-        // Here's a TransformState that's recorded in the cache.  Count it.
-        std::pair<StateCount::iterator, bool> ir =
-          state_count.insert(StateCount::value_type(result, 1));
-        if (!ir.second) {
-          // If the above insert operation fails, then it's already in the
-          // cache; increment its value.
-          (*(ir.first)).second++;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const TransformState *state = table.get_key(si);
+
+      size_t i;
+      size_t cache_size = state->_composition_cache.get_num_entries();
+      for (i = 0; i < cache_size; ++i) {
+        const TransformState *result = state->_composition_cache.get_data(i)._result;
+        if (result != nullptr && result != state) {
+          // Here's a TransformState that's recorded in the cache.  Count it.
+          std::pair<StateCount::iterator, bool> ir =
+            state_count.insert(StateCount::value_type(result, 1));
+          if (!ir.second) {
+            // If the above insert operation fails, then it's already in the
+            // cache; increment its value.
+            (*(ir.first)).second++;
+          }
         }
       }
-    }
-    cache_size = state->_invert_composition_cache.get_num_entries();
-    for (i = 0; i < cache_size; ++i) {
-      const TransformState *result = state->_invert_composition_cache.get_data(i)._result;
-      if (result != nullptr && result != state) {
-        std::pair<StateCount::iterator, bool> ir =
-          state_count.insert(StateCount::value_type(result, 1));
-        if (!ir.second) {
-          (*(ir.first)).second++;
+      cache_size = state->_invert_composition_cache.get_num_entries();
+      for (i = 0; i < cache_size; ++i) {
+        const TransformState *result = state->_invert_composition_cache.get_data(i)._result;
+        if (result != nullptr && result != state) {
+          std::pair<StateCount::iterator, bool> ir =
+            state_count.insert(StateCount::value_type(result, 1));
+          if (!ir.second) {
+            (*(ir.first)).second++;
+          }
         }
       }
     }
@@ -1092,7 +1108,7 @@ clear_cache() {
   LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_cache_update_pcollector);
-  int orig_size = _states.get_num_entries();
+  int orig_size = (int)_states.get_num_entries();
 
   // First, we need to copy the entire set of states to a temporary vector,
   // reference-counting each object.  That way we can walk through the copy,
@@ -1103,10 +1119,15 @@ clear_cache() {
     TempStates temp_states;
     temp_states.reserve(orig_size);
 
-    size_t size = _states.get_num_entries();
-    for (size_t si = 0; si < size; ++si) {
-      const TransformState *state = _states.get_key(si);
-      temp_states.push_back(state);
+    size_t num_shards = _states.get_num_shards();
+    for (size_t shi = 0; shi < num_shards; ++shi) {
+      States::Shard &shard = _states.get_shard(shi);
+      States::Holder shard_holder(shard);
+      size_t size = shard._table.get_num_entries();
+      for (size_t si = 0; si < size; ++si) {
+        const TransformState *state = shard._table.get_key(si);
+        temp_states.push_back(state);
+      }
     }
 
     // Now it's safe to walk through the list, destroying the cache within
@@ -1144,7 +1165,7 @@ clear_cache() {
     // the various objects' caches will go away.
   }
 
-  int new_size = _states.get_num_entries();
+  int new_size = (int)_states.get_num_entries();
   return orig_size - new_size;
 }
 
@@ -1163,74 +1184,90 @@ garbage_collect() {
   LightReMutexHolder holder(*_states_lock);
 
   PStatTimer timer(_garbage_collect_pcollector);
-  size_t orig_size = _states.get_num_entries();
-
-  // How many elements to process this pass?
-  size_t size = orig_size;
-  size_t num_this_pass = std::max(0, int(size * garbage_collect_states_rate));
-  if (num_this_pass <= 0) {
-    return 0;
-  }
-
   bool break_and_uniquify = (auto_break_cycles && uniquify_transforms);
 
-  size_t si = _garbage_index;
-  if (si >= size) {
-    si = 0;
-  }
+  // Each shard of the table is collected in turn, so that only one shard at a
+  // time is blocked from other threads looking up new states.
+  int num_freed = 0;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    States::Shard &shard = _states.get_shard(shi);
+    States::Holder shard_holder(shard);
+    States::Table &table = shard._table;
+    size_t orig_size = table.get_num_entries();
+
+    // How many elements to process this pass?
+    size_t size = orig_size;
+    size_t num_this_pass = std::max(0, int(size * garbage_collect_states_rate));
+    if (num_this_pass <= 0) {
+      continue;
+    }
 
-  num_this_pass = std::min(num_this_pass, size);
-  size_t stop_at_element = (si + num_this_pass) % size;
+    size_t si = shard._garbage_index;
+    if (si >= size) {
+      si = 0;
+    }
 
-  do {
-    TransformState *state = (TransformState *)_states.get_key(si);
-    if (break_and_uniquify) {
-      if (state->get_cache_ref_count() > 0 &&
-          state->get_ref_count() == state->get_cache_ref_count()) {
-        // If we have removed all the references to this state not in the
-        // cache, leaving only references in the cache, then we need to
-        // check for a cycle involving this TransformState and break it if
-        // it exists.
-        state->detect_and_break_cycles();
+    num_this_pass = std::min(num_this_pass, size);
+    size_t stop_at_element = (si + num_this_pass) % size;
+
+    do {
+      TransformState *state = (TransformState *)table.get_key(si);
+      if (break_and_uniquify) {
+        if (state->get_cache_ref_count() > 0 &&
+            state->get_ref_count() == state->get_cache_ref_count()) {
+          // If we have removed all the references to this state not in the
+          // cache, leaving only references in the cache, then we need to
+          // check for a cycle involving this TransformState and break it if
+          // it exists.
+          state->detect_and_break_cycles();
+        }
       }
-    }
 
-    if (state->get_ref_count() == 1) {
-      // This state has recently been unreffed to 1 (the one we added when
-      // we stored it in the cache).  Now it's time to delete it.  This is
-      // safe, because we're holding the _states_lock, so it's not possible
-      // for some other thread to find the state in the cache and ref it
-      // while we're doing this.
-      state->release_new();
-      state->remove_cache_pointers();
-      state->cache_unref();
-      delete state;
-
-      // When we removed it from the hash map, it swapped the last element
-      // with the one we just removed.  So the current index contains one we
-      // still need to visit.
-      --size;
-      --si;
-      if (stop_at_element > 0) {
-        --stop_at_element;
+      if (state->get_ref_count() == 1) {
+        // This state has recently been unreffed to 1 (the one we added when
+        // we stored it in the cache).  Now it's time to delete it.  This is
+        // safe, because we're holding the lock on its shard, so it's not
+        // possible for some other thread to find the state in the cache and
+        // ref it while we're doing this.
+        state->release_new();
+        state->remove_cache_pointers();
+        state->cache_unref();
+        delete state;
+
+        // When we removed it from the hash map, it swapped the last element
+        // with the one we just removed.  So the current index contains one
+        // we still need to visit.
+        --size;
+        --si;
+        if (stop_at_element > 0) {
+          --stop_at_element;
+        }
+        if (size == 0) {
+          // The shard is now empty.
+          si = 0;
+          break;
+        }
       }
-    }
 
-    si = (si + 1) % size;
-  } while (si != stop_at_element);
-  _garbage_index = si;
+      si = (si + 1) % size;
+    } while (si != stop_at_element);
+    shard._garbage_index = si;
 
-  nassertr(_states.get_num_entries() == size, 0);
+    nassertr(table.get_num_entries() == size, 0);
 
 #ifdef _DEBUG
-  nassertr(_states.validate(), 0);
+    nassertr(table.validate(), 0);
 #endif
 
-  // If we just cleaned up a lot of states, see if we can reduce the table in
-  // size.  This will help reduce iteration overhead in the future.
-  _states.consider_shrink_table();
+    // If we just cleaned up a lot of states, see if we can reduce the table
+    // in size.  This will help reduce iteration overhead in the future.
+    table.consider_shrink_table();
+
+    num_freed += (int)orig_size - (int)size;
+  }
 
-  return (int)orig_size - (int)size;
+  return num_freed;
 }
 
 /**
@@ -1249,65 +1286,70 @@ garbage_collect() {
 void TransformState::
 list_cycles(ostream &out) {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
   typedef pset<const TransformState *> VisitedStates;
   VisitedStates visited;
   CompositionCycleDesc cycle_desc;
 
-  size_t size = _states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const TransformState *state = _states.get_key(si);
-
-    bool inserted = visited.insert(state).second;
-    if (inserted) {
-      ++_last_cycle_detect;
-      if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
-        // This state begins a cycle.
-        CompositionCycleDesc::reverse_iterator csi;
-
-        out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
-            << "state " << (void *)state << ":" << state->get_ref_count()
-            << " =\n";
-        state->write(out, 2);
-        for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
-          const CompositionCycleDescEntry &entry = (*csi);
-          if (entry._inverted) {
-            out << "invert composed with ";
-          } else {
-            out << "composed with ";
-          }
-          out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
-              << " " << *entry._obj << "\n"
-              << "produces " << (const void *)entry._result << ":"
-              << entry._result->get_ref_count() << " =\n";
-          entry._result->write(out, 2);
-          visited.insert(entry._result);
-        }
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const TransformState *state = table.get_key(si);
 
-        cycle_desc.clear();
-      } else {
+      bool inserted = visited.insert(state).second;
+      if (inserted) {
         ++_last_cycle_detect;
-        if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+        if (r_detect_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
           // This state begins a cycle.
-          CompositionCycleDesc::iterator csi;
+          CompositionCycleDesc::reverse_iterator csi;
 
-          out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
-              << "state ";
-          for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+          out << "\nCycle detected of length " << cycle_desc.size() + 1 << ":\n"
+              << "state " << (void *)state << ":" << state->get_ref_count()
+              << " =\n";
+          state->write(out, 2);
+          for (csi = cycle_desc.rbegin(); csi != cycle_desc.rend(); ++csi) {
             const CompositionCycleDescEntry &entry = (*csi);
-            out << (const void *)entry._result << ":"
+            if (entry._inverted) {
+              out << "invert composed with ";
+            } else {
+              out << "composed with ";
+            }
+            out << (const void *)entry._obj << ":" << entry._obj->get_ref_count()
+                << " " << *entry._obj << "\n"
+                << "produces " << (const void *)entry._result << ":"
                 << entry._result->get_ref_count() << " =\n";
             entry._result->write(out, 2);
-            out << (const void *)entry._obj << ":"
-                << entry._obj->get_ref_count() << " =\n";
-            entry._obj->write(out, 2);
             visited.insert(entry._result);
           }
-          out << (void *)state << ":"
-              << state->get_ref_count() << " =\n";
-          state->write(out, 2);
 
           cycle_desc.clear();
+        } else {
+          ++_last_cycle_detect;
+          if (r_detect_reverse_cycles(state, state, 1, _last_cycle_detect, &cycle_desc)) {
+            // This state begins a cycle.
+            CompositionCycleDesc::iterator csi;
+
+            out << "\nReverse cycle detected of length " << cycle_desc.size() + 1 << ":\n"
+                << "state ";
+            for (csi = cycle_desc.begin(); csi != cycle_desc.end(); ++csi) {
+              const CompositionCycleDescEntry &entry = (*csi);
+              out << (const void *)entry._result << ":"
+                  << entry._result->get_ref_count() << " =\n";
+              entry._result->write(out, 2);
+              out << (const void *)entry._obj << ":"
+                  << entry._obj->get_ref_count() << " =\n";
+              entry._obj->write(out, 2);
+              visited.insert(entry._result);
+            }
+            out << (void *)state << ":"
+                << state->get_ref_count() << " =\n";
+            state->write(out, 2);
+
+            cycle_desc.clear();
+          }
         }
       }
     }
@@ -1323,12 +1365,17 @@ list_cycles(ostream &out) {
 void TransformState::
 list_states(ostream &out) {
   LightReMutexHolder holder(*_states_lock);
+  States::AllHolder shards_holder(_states);
 
-  size_t size = _states.get_num_entries();
-  out << size << " states:\n";
-  for (size_t si = 0; si < size; ++si) {
-    const TransformState *state = _states.get_key(si);
-    state->write(out, 2);
+  out << _states.get_num_entries() << " states:\n";
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const TransformState *state = table.get_key(si);
+      state->write(out, 2);
+    }
   }
 }
 
@@ -1343,49 +1390,116 @@ validate_states() {
   PStatTimer timer(_transform_validate_pcollector);
 
   LightReMutexHolder holder(*_states_lock);
-  if (_states.is_empty()) {
-    return true;
-  }
+  States::AllHolder shards_holder(_states);
 
-  if (!_states.validate()) {
-    pgraph_cat.error()
-      << "TransformState::_states cache is invalid!\n";
-    return false;
-  }
-
-  size_t size = _states.get_num_entries();
-  size_t si = 0;
-  nassertr(si < size, false);
-  nassertr(_states.get_key(si)->get_ref_count() >= 0, false);
-  size_t snext = si;
-  ++snext;
-  while (snext < size) {
-    nassertr(_states.get_key(snext)->get_ref_count() >= 0, false);
-    const TransformState *ssi = _states.get_key(si);
-    if (!ssi->validate_composition_cache()) {
-      return false;
+  size_t num_shards = _states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const States::Table &table = _states.get_shard(shi)._table;
+    if (table.is_empty()) {
+      continue;
     }
-    const TransformState *ssnext = _states.get_key(snext);
-    bool c = (*ssi) == (*ssnext);
-    bool ci = (*ssnext) == (*ssi);
-    if (c != ci) {
+
+    if (!table.validate()) {
       pgraph_cat.error()
-        << "TransformState::operator == () not defined properly!\n";
-      pgraph_cat.error(false)
-        << "(a, b): " << c << "\n";
-      pgraph_cat.error(false)
-        << "(b, a): " << ci << "\n";
-      ssi->write(pgraph_cat.error(false), 2);
-      ssnext->write(pgraph_cat.error(false), 2);
+        << "TransformState::_states cache shard " << shi << " is invalid!\n";
       return false;
     }
-    si = snext;
+
+    size_t size = table.get_num_entries();
+    size_t si = 0;
+    nassertr(si < size, false);
+    nassertr(table.get_key(si)->get_ref_count() >= 0, false);
+    size_t snext = si;
     ++snext;
+    while (snext < size) {
+      nassertr(table.get_key(snext)->get_ref_count() >= 0, false);
+      const TransformState *ssi = table.get_key(si);
+      if (!ssi->validate_composition_cache()) {
+        return false;
+      }
+      const TransformState *ssnext = table.get_key(snext);
+      bool c = (*ssi) == (*ssnext);
+      bool ci = (*ssnext) == (*ssi);
+      if (c != ci) {
+        pgraph_cat.error()
+          << "TransformState::operator == () not defined properly!\n";
+        pgraph_cat.error(false)
+          << "(a, b): " << c << "\n";
+        pgraph_cat.error(false)
+          << "(b, a): " << ci << "\n";
+        ssi->write(pgraph_cat.error(false), 2);
+        ssnext->write(pgraph_cat.error(false), 2);
+        return false;
+      }
+      si = snext;
+      ++snext;
+    }
   }
 
   return true;
 }
 
+/**
+ * Returns the number of separately-locked shards into which the global table
+ * of unique TransformStates is split.  This is controlled by the config
+ * variable state-cache-num-shards.
+ */
+size_t TransformState::
+get_num_state_shards() {
+  return _states.get_num_shards();
+}
+
+/**
+ * Returns the number of times a newly-created TransformState was found to
+ * already have an equivalent in the nth shard of the global table.  This is
+ * useful only for performance analysis.
+ */
+size_t TransformState::
+get_state_shard_hits(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._hits);
+}
+
+/**
+ * Returns the number of times a newly-created TransformState was added to the
+ * nth shard of the global table, because no equivalent state was found.  This
+ * is useful only for performance analysis.
+ */
+size_t TransformState::
+get_state_shard_misses(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._misses);
+}
+
+/**
+ * Returns the number of times a thread had to wait for another thread to
+ * release the lock on the nth shard of the global table.  This is useful only
+ * for performance analysis.
+ */
+size_t TransformState::
+get_state_shard_contentions(size_t n) {
+  nassertr(n < _states.get_num_shards(), 0);
+  return (size_t)AtomicAdjust::get(_states.get_shard(n)._contentions);
+}
+
+/**
+ * Resets the hit, miss and contention counters on all shards of the global
+ * table to zero.
+ */
+void TransformState::
+clear_state_shard_counters() {
+  _states.clear_counters();
+}
+
+/**
+ * Lists the number of states and the hit, miss and contention counters for
+ * each shard of the global table, one per line.
+ */
+void TransformState::
+list_state_shards(ostream &out) {
+  _states.write(out, "TransformState");
+}
+
 /**
  * Make sure the global _states map is allocated.  This only has to be done
  * once.  We could make this map static, but then we run into problems if
@@ -1403,6 +1517,13 @@ init_states() {
             "a single pointer.  Nowadays, with the transforms stored in a "
             "hashtable, we're generally better off with this set true."));
 
+  ConfigVariableInt state_cache_num_shards
+  ("state-cache-num-shards", 16,
+   PRC_DESC("The number of separately-locked shards into which the global "
+            "tables of unique TransformState and RenderState objects are "
+            "split.  Increasing this reduces lock contention when many "
+            "threads are creating states at once."));
+
   // Store this at the beginning, so that we don't have to query this every
   // time that the comparison operator is invoked.
   _uniquify_matrix = uniquify_matrix;
@@ -1412,6 +1533,7 @@ init_states() {
   // OK because we guarantee that this method is called at static init time,
   // presumably when there is still only one thread in the world.
   _states_lock = new LightReMutex("TransformState::_states_lock");
+  _states.init(state_cache_num_shards);
   _cache_stats.init();
   nassertv(Thread::get_current_thread() == Thread::get_main_thread());
 }
@@ -1458,32 +1580,39 @@ return_unique(TransformState *state) {
 
   PStatTimer timer(_transform_new_pcollector);
 
-  LightReMutexHolder holder(*_states_lock);
+  // Save the state in a local PointerTo so that it will be freed at the end
+  // of this function if no one else uses it.  This has to be declared before
+  // the holder below, since freeing the state grabs _states_lock, which must
+  // not be acquired while holding the lock on a shard.
+  CPT(TransformState) pt_state = state;
+
+  // Only the shard of the table in which this state belongs needs to be
+  // locked, so other threads can look up unrelated states in parallel.
+  States::Shard &shard = _states.get_shard_for(state);
+  States::Holder holder(shard);
 
   if (state->_saved_entry != -1) {
     // This state is already in the cache.  nassertr(_states.find(state) ==
     // state->_saved_entry, state);
-    return state;
+    return pt_state;
   }
 
-  // Save the state in a local PointerTo so that it will be freed at the end
-  // of this function if no one else uses it.
-  CPT(TransformState) pt_state = state;
-
-  int si = _states.find(state);
+  int si = shard._table.find(state);
   if (si != -1) {
     // There's an equivalent state already in the set.  Return it.
-    return _states.get_key(si);
+    shard.inc_hits();
+    return shard._table.get_key(si);
   }
 
   // Not already in the set; add it.
+  shard.inc_misses();
   if (garbage_collect_states) {
     // If we'll be garbage collecting states explicitly, we'll increment the
     // reference count when we store it in the cache, so that it won't be
     // deleted while it's in it.
     state->cache_ref();
   }
-  si = _states.store(state, nullptr);
+  si = shard._table.store(state, nullptr);
 
   // Save the index and return the input state.
   state->_saved_entry = si;
@@ -1863,15 +1992,16 @@ r_detect_reverse_cycles(const TransformState *start_state,
  * This inverse of return_new, this releases this object from the global
  * TransformState table.
  *
- * You must already be holding _states_lock before you call this method.
+ * You must already be holding the lock on the shard of the table containing
+ * this state before you call this method.
  */
 void TransformState::
 release_new() {
-  nassertv(_states_lock->debug_is_locked());
-
   if (_saved_entry != -1) {
+    States::Shard &shard = _states.get_shard_for(this);
+    nassertv(shard.debug_is_locked());
     _saved_entry = -1;
-    nassertv_always(_states.remove(this));
+    nassertv_always(shard._table.remove(this));
   }
 }
 
@@ -30,6 +30,7 @@
 #include "config_pgraph.h"
 #include "deletedChain.h"
 #include "simpleHashMap.h"
+#include "shardedStateTable.h"
 #include "cacheStats.h"
 #include "extension.h"
 
@@ -208,6 +209,13 @@ PUBLISHED:
   EXTENSION(static PyObject *get_states());
   EXTENSION(static PyObject *get_unused_states());
 
+  static size_t get_num_state_shards();
+  static size_t get_state_shard_hits(size_t n);
+  static size_t get_state_shard_misses(size_t n);
+  static size_t get_state_shard_contentions(size_t n);
+  static void clear_state_shard_counters();
+  static void list_state_shards(std::ostream &out);
+
 public:
   static void init_states();
 
@@ -248,11 +256,12 @@ private:
   void remove_cache_pointers();
 
 private:
-  // This mutex protects _states.  It also protects any modification to the
-  // cache, which is encoded in _composition_cache and
-  // _invert_composition_cache.
+  // This mutex protects any modification to the cache, which is encoded in
+  // _composition_cache and _invert_composition_cache.  The global table of
+  // unique states is split into shards with their own locks; if both are
+  // needed, _states_lock must always be acquired first.
   static LightReMutex *_states_lock;
-  typedef SimpleHashMap<const TransformState *, std::nullptr_t, indirect_equals_hash<const TransformState *> > States;
+  typedef ShardedStateTable<TransformState, indirect_equals_hash<const TransformState *> > States;
   static States _states;
   static CPT(TransformState) _identity_state;
   static CPT(TransformState) _invalid_state;
@@ -290,10 +299,6 @@ private:
   UpdateSeq _cycle_detect;
   static UpdateSeq _last_cycle_detect;
 
-  // This keeps track of our current position through the garbage collection
-  // cycle.
-  static size_t _garbage_index;
-
   static bool _uniquify_matrix;
 
   static PStatCollector _cache_update_pcollector;
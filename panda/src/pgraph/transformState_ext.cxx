@@ -133,21 +133,27 @@ PyObject *Extension<TransformState>::
 get_states() {
   extern struct Dtool_PyTypedObject Dtool_TransformState;
   LightReMutexHolder holder(*TransformState::_states_lock);
+  TransformState::States::AllHolder shards_holder(TransformState::_states);
 
   size_t num_states = TransformState::_states.get_num_entries();
   PyObject *list = PyList_New(num_states);
   size_t i = 0;
 
-  size_t size = TransformState::_states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const TransformState *state = TransformState::_states.get_key(si);
-    state->ref();
-    PyObject *a =
-      DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState,
-                                  true, true, state->get_type_index());
-    nassertr(i < num_states, list);
-    PyList_SET_ITEM(list, i, a);
-    ++i;
+  size_t num_shards = TransformState::_states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const TransformState::States::Table &table =
+      TransformState::_states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const TransformState *state = table.get_key(si);
+      state->ref();
+      PyObject *a =
+        DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState,
+                                    true, true, state->get_type_index());
+      nassertr(i < num_states, list);
+      PyList_SET_ITEM(list, i, a);
+      ++i;
+    }
   }
   nassertr(i == num_states, list);
   return list;
@@ -161,18 +167,24 @@ PyObject *Extension<TransformState>::
 get_unused_states() {
   extern struct Dtool_PyTypedObject Dtool_TransformState;
   LightReMutexHolder holder(*TransformState::_states_lock);
+  TransformState::States::AllHolder shards_holder(TransformState::_states);
 
   PyObject *list = PyList_New(0);
-  size_t size = TransformState::_states.get_num_entries();
-  for (size_t si = 0; si < size; ++si) {
-    const TransformState *state = TransformState::_states.get_key(si);
-    if (state->get_cache_ref_count() == state->get_ref_count()) {
-      state->ref();
-      PyObject *a =
-        DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState,
-                                    true, true, state->get_type_index());
-      PyList_Append(list, a);
-      Py_DECREF(a);
+  size_t num_shards = TransformState::_states.get_num_shards();
+  for (size_t shi = 0; shi < num_shards; ++shi) {
+    const TransformState::States::Table &table =
+      TransformState::_states.get_shard(shi)._table;
+    size_t size = table.get_num_entries();
+    for (size_t si = 0; si < size; ++si) {
+      const TransformState *state = table.get_key(si);
+      if (state->get_cache_ref_count() == state->get_ref_count()) {
+        state->ref();
+        PyObject *a =
+          DTool_CreatePyInstanceTyped((void *)state, Dtool_TransformState,
+                                      true, true, state->get_type_index());
+        PyList_Append(list, a);
+        Py_DECREF(a);
+      }
     }
   }
   return list;
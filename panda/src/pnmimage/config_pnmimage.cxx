@@ -62,6 +62,23 @@ ConfigVariableDouble pfm_resize_radius
           "always call box_filter() or gaussian_filter() explicitly with "
           "a specific radius."));
 
+ConfigVariableInt pfm_num_threads
+("pfm-num-threads", 0,
+ PRC_DESC("The number of threads to use for the whole-file operations on a "
+          "PfmFile, such as xform(), merge(), apply_crop(), calc_min_max() "
+          "and quick_filter_from(), and for PfmVizzer::project().  The rows "
+          "of the file are divided among these threads.  The default of 0 "
+          "means to use one thread per CPU, less one for the calling "
+          "thread."));
+
+ConfigVariableInt pnm_filter_num_threads
+("pnm-filter-num-threads", 0,
+ PRC_DESC("The number of threads to use for resizing images with "
+          "box_filter_from(), gaussian_filter_from(), lanczos_filter_from(), "
+          "mitchell_filter_from() and quick_filter_from().  The rows of each "
+          "image are divided among these threads.  The default of 0 means "
+          "to use one thread per CPU, less one for the calling thread."));
+
 /**
  * Initializes the library.  This must be called at least once before any of
  * the functions or classes in this library can be used.  Normally it will be
@@ -18,6 +18,7 @@
 #include "notifyCategoryProxy.h"
 #include "configVariableBool.h"
 #include "configVariableDouble.h"
+#include "configVariableInt.h"
 
 NotifyCategoryDecl(pnmimage, EXPCL_PANDA_PNMIMAGE, EXPTP_PANDA_PNMIMAGE);
 
@@ -26,6 +27,8 @@ extern EXPCL_PANDA_PNMIMAGE ConfigVariableBool pfm_reverse_dimensions;
 extern EXPCL_PANDA_PNMIMAGE ConfigVariableBool pfm_resize_gaussian;
 extern EXPCL_PANDA_PNMIMAGE ConfigVariableBool pfm_resize_quick;
 extern EXPCL_PANDA_PNMIMAGE ConfigVariableDouble pfm_resize_radius;
+extern EXPCL_PANDA_PNMIMAGE ConfigVariableInt pfm_num_threads;
+extern EXPCL_PANDA_PNMIMAGE ConfigVariableInt pnm_filter_num_threads;
 
 extern EXPCL_PANDA_PNMIMAGE void init_libpnmimage();
 
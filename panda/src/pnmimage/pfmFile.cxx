@@ -23,12 +23,122 @@
 #include "pnmWriter.h"
 #include "string_utils.h"
 #include "look_at.h"
+#include "asyncParallelFor.h"
+
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+#define PFM_SSE2
+#include <emmintrin.h>
+#endif
 
 using std::istream;
 using std::max;
 using std::min;
 using std::ostream;
 
+// The number of rows converted at a time when reading or writing an integer
+// image file.
+static const int pfm_strip_rows = 64;
+
+// The arguments for the row functions, below, that divide up the work of the
+// whole-file operations among several threads.
+struct PfmQuickFilterJob {
+  const PfmFile *_from;
+  PN_float32 *_data;
+  int _x_size;
+  int _num_channels;
+  PN_float32 _x_scale;
+  PN_float32 _y_scale;
+};
+
+struct PfmXformJob {
+  PfmFile *_file;
+  const LMatrix4f *_transform;
+};
+
+struct PfmMergeJob {
+  PfmFile *_file;
+  const PfmFile *_other;
+};
+
+struct PfmCropJob {
+  PN_float32 *_dest;
+  const PN_float32 *_source;
+  size_t _dest_stride;
+  size_t _source_stride;
+};
+
+// The bounding box of the points on one row, for calc_min_max().
+struct PfmMinMaxRow {
+  LVecBase3f _min;
+  LVecBase3f _max;
+  bool _any;
+};
+
+struct PfmMinMaxJob {
+  const PfmFile *_file;
+  PfmMinMaxRow *_rows;
+};
+
+struct PfmHalfJob {
+  PN_float32 *_floats;
+  uint16_t *_halves;
+  size_t _row_length;
+};
+
+/**
+ * Converts the indicated half-float to a float, treating denormals as zero.
+ */
+static inline PN_float32
+decode_half_float(uint16_t in) {
+  union {
+    uint32_t ui;
+    float uf;
+  } v;
+  uint32_t t1 = in & 0x7fff; // Non-sign bits
+  uint32_t t2 = in & 0x8000; // Sign bit
+  uint32_t t3 = in & 0x7c00; // Exponent
+  t1 <<= 13; // Align mantissa on MSB
+  t2 <<= 16; // Shift sign bit into position
+  if (t3 != 0x7c00) {
+    t1 += 0x38000000; // Adjust bias
+    t1 = (t3 == 0 ? 0 : t1); // Denormals-as-zero
+  } else {
+    // Infinity / NaN
+    t1 |= 0x7f800000;
+  }
+  v.ui = t1 | t2;
+  return v.uf;
+}
+
+/**
+ * Converts the indicated float to the nearest half-float.  Values too small
+ * to be represented as a normalized half-float are flushed to zero.
+ */
+static inline uint16_t
+encode_half_float(PN_float32 value) {
+  union {
+    uint32_t ui;
+    float uf;
+  } v;
+  v.uf = value;
+  uint32_t sign = (v.ui >> 16) & 0x8000;
+  uint32_t bits = v.ui & 0x7fffffff;
+  if (bits >= 0x7f800000) {
+    // Infinity / NaN
+    return (uint16_t)(sign | 0x7c00 | (bits > 0x7f800000 ? 0x200 : 0));
+  }
+  if (bits >= 0x47800000) {
+    // Too large; becomes infinity.
+    return (uint16_t)(sign | 0x7c00);
+  }
+  if (bits < 0x38800000) {
+    return (uint16_t)sign;
+  }
+  // Adjust the bias, and round to nearest even.
+  bits = (bits - 0x38000000 + 0xfff + ((bits >> 13) & 1)) >> 13;
+  return (uint16_t)(sign | bits);
+}
+
 /**
  *
  */
@@ -178,13 +288,31 @@ read(PNMReader *reader) {
   }
 
   if (!reader->is_floating_point()) {
-    // Not a floating-point file.  Quietly convert it.
-    PNMImage pnm;
-    if (!pnm.read(reader)) {
-      return false;
+    // Not a floating-point file.  Quietly convert it, a strip at a time, so
+    // that we never hold an integer copy of the whole image.
+    reader->prepare_read();
+    clear(reader->get_x_size(), reader->get_y_size(), reader->get_num_channels());
+
+    PNMImage strip;
+    int y = 0;
+    while (reader->read_strip(strip, pfm_strip_rows)) {
+      if (!load_rows(strip, y)) {
+        break;
+      }
+      y += strip.get_y_size();
     }
+    delete reader;
 
-    return load(pnm);
+    if (y == 0) {
+      clear();
+      return false;
+    }
+    if (y < _y_size) {
+      // The file was truncated; keep the rows we got.
+      _y_size = y;
+      _table.resize((size_t)_x_size * _y_size * _num_channels);
+    }
+    return true;
   }
 
   bool success = reader->read_pfm(*this);
@@ -262,14 +390,19 @@ write(PNMWriter *writer) {
 
   if (!writer->supports_floating_point()) {
     // Hmm, it's an integer file type.  Convert it from the floating-point
-    // data we have.
-    PNMImage pnmimage;
-    if (!store(pnmimage)) {
-      delete writer;
-      return false;
+    // data we have, a strip at a time.
+    PNMImage strip(_x_size, min(pfm_strip_rows, _y_size), _num_channels, PGM_MAXMAXVAL);
+    writer->copy_header_from(strip);
+    writer->set_y_size(_y_size);
+
+    bool success = true;
+    for (int y = 0; y < _y_size && success; y += strip.get_y_size()) {
+      int num_rows = min(pfm_strip_rows, _y_size - y);
+      if (strip.get_y_size() != num_rows) {
+        strip.clear(_x_size, num_rows, _num_channels, PGM_MAXMAXVAL);
+      }
+      success = store_rows(strip, y) && writer->write_strip(strip);
     }
-    writer->copy_header_from(pnmimage);
-    bool success = (writer->write_data(pnmimage.get_array(), pnmimage.get_alpha_array()) != 0);
     delete writer;
     return success;
   }
@@ -290,66 +423,8 @@ load(const PNMImage &pnmimage) {
     return false;
   }
 
-  int num_channels = pnmimage.get_num_channels();
-
-  clear(pnmimage.get_x_size(), pnmimage.get_y_size(), num_channels);
-  switch (num_channels) {
-  case 1:
-    {
-      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
-        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
-          _table[yi * _x_size + xi] = pnmimage.get_gray(xi, yi);
-        }
-      }
-    }
-    break;
-
-  case 2:
-    {
-      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
-        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
-          PN_float32 *point = &_table[(yi * _x_size + xi) * _num_channels];
-          point[0] = pnmimage.get_gray(xi, yi);
-          point[1] = pnmimage.get_alpha(xi, yi);
-        }
-      }
-    }
-    break;
-
-  case 3:
-    {
-      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
-        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
-          PN_float32 *point = &_table[(yi * _x_size + xi) * _num_channels];
-          LRGBColorf xel = pnmimage.get_xel(xi, yi);
-          point[0] = xel[0];
-          point[1] = xel[1];
-          point[2] = xel[2];
-        }
-      }
-    }
-    break;
-
-  case 4:
-    {
-      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
-        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
-          PN_float32 *point = &_table[(yi * _x_size + xi) * _num_channels];
-          LColorf xel = pnmimage.get_xel_a(xi, yi);
-          point[0] = xel[0];
-          point[1] = xel[1];
-          point[2] = xel[2];
-          point[3] = xel[3];
-        }
-      }
-    }
-    break;
-
-  default:
-    nassert_raise("unexpected channel count");
-    return false;
-  }
-  return true;
+  clear(pnmimage.get_x_size(), pnmimage.get_y_size(), pnmimage.get_num_channels());
+  return load_rows(pnmimage, 0);
 }
 
 
@@ -363,58 +438,8 @@ store(PNMImage &pnmimage) const {
     return false;
   }
 
-  int num_channels = get_num_channels();
-  pnmimage.clear(get_x_size(), get_y_size(), num_channels, PGM_MAXMAXVAL);
-  switch (num_channels) {
-  case 1:
-    {
-      for (int yi = 0; yi < get_y_size(); ++yi) {
-        for (int xi = 0; xi < get_x_size(); ++xi) {
-          pnmimage.set_gray(xi, yi, _table[yi * _x_size + xi]);
-        }
-      }
-    }
-    break;
-
-  case 2:
-    {
-      for (int yi = 0; yi < get_y_size(); ++yi) {
-        for (int xi = 0; xi < get_x_size(); ++xi) {
-          const LPoint2f &point = get_point2(xi, yi);
-          pnmimage.set_gray(xi, yi, point[0]);
-          pnmimage.set_alpha(xi, yi, point[1]);
-        }
-      }
-    }
-    break;
-
-  case 3:
-    {
-      for (int yi = 0; yi < get_y_size(); ++yi) {
-        for (int xi = 0; xi < get_x_size(); ++xi) {
-          const LPoint3f &point = get_point3(xi, yi);
-          pnmimage.set_xel(xi, yi, point[0], point[1], point[2]);
-        }
-      }
-    }
-    break;
-
-  case 4:
-    {
-      for (int yi = 0; yi < get_y_size(); ++yi) {
-        for (int xi = 0; xi < get_x_size(); ++xi) {
-          const LPoint4f &point = get_point4(xi, yi);
-          pnmimage.set_xel_a(xi, yi, point[0], point[1], point[2], point[3]);
-        }
-      }
-    }
-    break;
-
-  default:
-    nassert_raise("unexpected channel count");
-    return false;
-  }
-  return true;
+  pnmimage.clear(get_x_size(), get_y_size(), get_num_channels(), PGM_MAXMAXVAL);
+  return store_rows(pnmimage, 0);
 }
 
 /**
@@ -476,6 +501,54 @@ store_mask(PNMImage &pnmimage, const LVecBase4f &min_point, const LVecBase4f &ma
   return true;
 }
 
+/**
+ * Fills the PfmFile with the indicated half-float values, as returned by
+ * store_half().  The array must contain exactly x_size * y_size *
+ * num_channels values.  Returns true on success, false on failure.
+ */
+bool PfmFile::
+load_half(int x_size, int y_size, int num_channels, CPTA_ushort data) {
+  nassertr(x_size >= 0 && y_size >= 0 && num_channels > 0 && num_channels <= 4, false);
+  nassertr(data.size() == (size_t)x_size * (size_t)y_size * (size_t)num_channels, false);
+
+  clear(x_size, y_size, num_channels);
+  if (data.empty()) {
+    return true;
+  }
+
+  PfmHalfJob job;
+  job._floats = &_table[0];
+  job._halves = (uint16_t *)data.p();
+  job._row_length = (size_t)x_size * num_channels;
+  run_rows(y_size, job._row_length, &load_half_rows, &job);
+  return true;
+}
+
+/**
+ * Returns the points of the PfmFile as an array of 16-bit half-floats, row by
+ * row, with get_num_channels() values per point.  This takes half the memory
+ * of the PfmFile itself, so it may be used to hold a large map in compact
+ * form while it is not being operated on; load_half() restores it.
+ *
+ * Values too large for a half-float become infinity, and values too small for
+ * a normalized half-float become zero.
+ */
+PTA_ushort PfmFile::
+store_half() const {
+  nassertr(is_valid(), PTA_ushort());
+  PTA_ushort data = PTA_ushort::empty_array((size_t)_x_size * (size_t)_y_size * (size_t)_num_channels);
+  if (data.empty()) {
+    return data;
+  }
+
+  PfmHalfJob job;
+  job._floats = (PN_float32 *)&_table[0];
+  job._halves = data.p();
+  job._row_length = (size_t)_x_size * _num_channels;
+  run_rows(_y_size, job._row_length, &store_half_rows, &job);
+  return data;
+}
+
 /**
  * Fills the table with all of the same value.
  */
@@ -740,25 +813,33 @@ calc_min_max(LVecBase3f &min_depth, LVecBase3f &max_depth) const {
   min_depth = LVecBase3f::zero();
   max_depth = LVecBase3f::zero();
 
-  for (int yi = 0; yi < _y_size; ++yi) {
-    for (int xi = 0; xi < _x_size; ++xi) {
-      if (!has_point(xi, yi)) {
-        continue;
-      }
+  // Each row is measured separately, and then the rows are combined in order.
+  pvector<PfmMinMaxRow> rows(_y_size);
+  if (rows.empty()) {
+    return false;
+  }
 
-      const LPoint3f &p = get_point(xi, yi);
-      if (!any_points) {
-        min_depth = p;
-        max_depth = p;
-        any_points = true;
-      } else {
-        min_depth[0] = min(min_depth[0], p[0]);
-        min_depth[1] = min(min_depth[1], p[1]);
-        min_depth[2] = min(min_depth[2], p[2]);
-        max_depth[0] = max(max_depth[0], p[0]);
-        max_depth[1] = max(max_depth[1], p[1]);
-        max_depth[2] = max(max_depth[2], p[2]);
-      }
+  PfmMinMaxJob job;
+  job._file = this;
+  job._rows = &rows[0];
+  run_rows(_y_size, (size_t)_x_size * _num_channels, &min_max_rows, &job);
+
+  for (const PfmMinMaxRow &row : rows) {
+    if (!row._any) {
+      continue;
+    }
+
+    if (!any_points) {
+      min_depth = row._min;
+      max_depth = row._max;
+      any_points = true;
+    } else {
+      min_depth[0] = min(min_depth[0], row._min[0]);
+      min_depth[1] = min(min_depth[1], row._min[1]);
+      min_depth[2] = min(min_depth[2], row._min[2]);
+      max_depth[0] = max(max_depth[0], row._max[0]);
+      max_depth[1] = max(max_depth[1], row._max[1]);
+      max_depth[2] = max(max_depth[2], row._max[2]);
     }
   }
 
@@ -999,143 +1080,32 @@ quick_filter_from(const PfmFile &from) {
   if (_x_size == 0 || _y_size == 0) {
     return;
   }
+  if (_num_channels < 1 || _num_channels > 4) {
+    nassert_raise("unexpected channel count");
+    return;
+  }
 
-  Table new_data;
-  new_data.reserve(_table.size());
-
-  PN_float32 from_x0, from_x1, from_y0, from_y1;
-
-  int orig_x_size = from.get_x_size();
-  int orig_y_size = from.get_y_size();
+  // Each row is written directly into its place in the new table, so the rows
+  // may be computed in any order.
+  Table new_data((size_t)_x_size * (size_t)_y_size * (size_t)_num_channels + 4, (PN_float32)0.0);
+  nassertv(new_data.size() == _table.size());
 
-  PN_float32 x_scale = 1.0;
-  PN_float32 y_scale = 1.0;
+  PfmQuickFilterJob job;
+  job._from = &from;
+  job._data = &new_data[0];
+  job._x_size = _x_size;
+  job._num_channels = _num_channels;
+  job._x_scale = 1.0;
+  job._y_scale = 1.0;
 
   if (_x_size > 1) {
-    x_scale = (PN_float32)orig_x_size / (PN_float32)_x_size;
+    job._x_scale = (PN_float32)from.get_x_size() / (PN_float32)_x_size;
   }
   if (_y_size > 1) {
-    y_scale = (PN_float32)orig_y_size / (PN_float32)_y_size;
-  }
-
-  switch (_num_channels) {
-  case 1:
-    {
-      from_y0 = 0.0;
-      for (int to_y = 0; to_y < _y_size; ++to_y) {
-        from_y1 = (to_y + 1.0) * y_scale;
-        from_y1 = min(from_y1, (PN_float32)orig_y_size);
-
-        from_x0 = 0.0;
-        for (int to_x = 0; to_x < _x_size; ++to_x) {
-          from_x1 = (to_x + 1.0) * x_scale;
-          from_x1 = min(from_x1, (PN_float32)orig_x_size);
-
-          // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
-          // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-          PN_float32 result;
-          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
-          new_data.push_back(result);
-
-          from_x0 = from_x1;
-        }
-        from_y0 = from_y1;
-      }
-    }
-    break;
-
-  case 2:
-    {
-      from_y0 = 0.0;
-      for (int to_y = 0; to_y < _y_size; ++to_y) {
-        from_y1 = (to_y + 1.0) * y_scale;
-        from_y1 = min(from_y1, (PN_float32)orig_y_size);
-
-        from_x0 = 0.0;
-        for (int to_x = 0; to_x < _x_size; ++to_x) {
-          from_x1 = (to_x + 1.0) * x_scale;
-          from_x1 = min(from_x1, (PN_float32)orig_x_size);
-
-          // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
-          // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-          LPoint2f result;
-          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
-          new_data.push_back(result[0]);
-          new_data.push_back(result[1]);
-
-          from_x0 = from_x1;
-        }
-        from_y0 = from_y1;
-      }
-    }
-    break;
-
-  case 3:
-    {
-      from_y0 = 0.0;
-      for (int to_y = 0; to_y < _y_size; ++to_y) {
-        from_y1 = (to_y + 1.0) * y_scale;
-        from_y1 = min(from_y1, (PN_float32)orig_y_size);
-
-        from_x0 = 0.0;
-        for (int to_x = 0; to_x < _x_size; ++to_x) {
-          from_x1 = (to_x + 1.0) * x_scale;
-          from_x1 = min(from_x1, (PN_float32)orig_x_size);
-
-          // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
-          // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-          LPoint3f result;
-          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
-          new_data.push_back(result[0]);
-          new_data.push_back(result[1]);
-          new_data.push_back(result[2]);
-
-          from_x0 = from_x1;
-        }
-        from_y0 = from_y1;
-      }
-    }
-    break;
-
-  case 4:
-    {
-      from_y0 = 0.0;
-      for (int to_y = 0; to_y < _y_size; ++to_y) {
-        from_y1 = (to_y + 1.0) * y_scale;
-        from_y1 = min(from_y1, (PN_float32)orig_y_size);
-
-        from_x0 = 0.0;
-        for (int to_x = 0; to_x < _x_size; ++to_x) {
-          from_x1 = (to_x + 1.0) * x_scale;
-          from_x1 = min(from_x1, (PN_float32)orig_x_size);
-
-          // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
-          // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-          LPoint4f result;
-          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
-          new_data.push_back(result[0]);
-          new_data.push_back(result[1]);
-          new_data.push_back(result[2]);
-          new_data.push_back(result[3]);
-
-          from_x0 = from_x1;
-        }
-        from_y0 = from_y1;
-      }
-    }
-    break;
-
-  default:
-    nassert_raise("unexpected channel count");
-    return;
+    job._y_scale = (PN_float32)from.get_y_size() / (PN_float32)_y_size;
   }
 
-  new_data.push_back(0.0);
-  new_data.push_back(0.0);
-  new_data.push_back(0.0);
-  new_data.push_back(0.0);
-
-  nassertv(new_data.size() == _table.size());
+  run_rows(_y_size, (size_t)_x_size * _num_channels, &quick_filter_rows, &job);
   _table.swap(new_data);
 }
 
@@ -1222,66 +1192,10 @@ void PfmFile::
 xform(const LMatrix4f &transform) {
   nassertv(is_valid());
 
-  int num_channels = get_num_channels();
-  switch (num_channels) {
-  case 1:
-    {
-      for (int yi = 0; yi < _y_size; ++yi) {
-        for (int xi = 0; xi < _x_size; ++xi) {
-          if (!has_point(xi, yi)) {
-            continue;
-          }
-          PN_float32 pi = get_point1(xi, yi);
-          LPoint3f po = transform.xform_point(LPoint3f(pi, 0.0, 0.0));
-          set_point1(xi, yi, po[0]);
-        }
-      }
-    }
-    break;
-
-  case 2:
-    {
-      for (int yi = 0; yi < _y_size; ++yi) {
-        for (int xi = 0; xi < _x_size; ++xi) {
-          if (!has_point(xi, yi)) {
-            continue;
-          }
-          LPoint2f pi = get_point2(xi, yi);
-          LPoint3f po = transform.xform_point(LPoint3f(pi[0], pi[1], 0.0));
-          set_point2(xi, yi, LPoint2f(po[0], po[1]));
-        }
-      }
-    }
-    break;
-
-  case 3:
-    {
-      for (int yi = 0; yi < _y_size; ++yi) {
-        for (int xi = 0; xi < _x_size; ++xi) {
-          if (!has_point(xi, yi)) {
-            continue;
-          }
-          LPoint3f &p = modify_point3(xi, yi);
-          transform.xform_point_general_in_place(p);
-        }
-      }
-    }
-    break;
-
-  case 4:
-    {
-      for (int yi = 0; yi < _y_size; ++yi) {
-        for (int xi = 0; xi < _x_size; ++xi) {
-          if (!has_point(xi, yi)) {
-            continue;
-          }
-          LPoint4f &p = modify_point4(xi, yi);
-          transform.xform_in_place(p);
-        }
-      }
-    }
-    break;
-  }
+  PfmXformJob job;
+  job._file = this;
+  job._transform = &transform;
+  run_rows(_y_size, (size_t)_x_size * _num_channels, &xform_rows, &job);
 }
 
 /**
@@ -1467,16 +1381,10 @@ merge(const PfmFile &other) {
     return;
   }
 
-  size_t point_size = _num_channels * sizeof(PN_float32);
-  for (int y = 0; y < _y_size; ++y) {
-    for (int x = 0; x < _x_size; ++x) {
-      if (!has_point(x, y) && other.has_point(x, y)) {
-        memcpy(&_table[(y * _x_size + x) * _num_channels],
-               &other._table[(y * _x_size + x) * _num_channels],
-               point_size);
-      }
-    }
-  }
+  PfmMergeJob job;
+  job._file = this;
+  job._other = &other;
+  run_rows(_y_size, (size_t)_x_size * _num_channels, &merge_rows, &job);
 }
 
 /**
@@ -1562,10 +1470,13 @@ apply_crop(int x_begin, int x_end, int y_begin, int y_end) {
   // image.
   new_table.insert(new_table.end(), new_size + 4, (PN_float32)0.0);
 
-  for (int yi = 0; yi < new_y_size; ++yi) {
-    memcpy(&new_table[(yi * new_x_size) * _num_channels],
-           &_table[((yi + y_begin) * _x_size + x_begin) * _num_channels],
-           new_x_size * sizeof(PN_float32) * _num_channels);
+  if (new_size != 0) {
+    PfmCropJob job;
+    job._dest = &new_table[0];
+    job._source = &_table[0] + ((size_t)y_begin * _x_size + x_begin) * _num_channels;
+    job._dest_stride = (size_t)new_x_size * _num_channels;
+    job._source_stride = (size_t)_x_size * _num_channels;
+    run_rows(new_y_size, job._dest_stride, &crop_rows, &job);
   }
 
   nassertv(new_table.size() == new_size + 4);
@@ -2357,6 +2268,159 @@ output(ostream &out) const {
       << _num_channels << " channels.";
 }
 
+/**
+ * Calls the indicated function on ranges of the rows [0, num_rows), dividing
+ * the rows among the threads of the "pfm" task chain, and returns when all of
+ * them have been processed.  Each row is row_length floats long; small files
+ * are processed entirely on the calling thread.
+ */
+void PfmFile::
+run_rows(size_t num_rows, size_t row_length, RowFunc *func, void *data) {
+  if (num_rows < 4 || num_rows * row_length < 65536) {
+    // Not worth waking up the other threads for.
+    func(0, num_rows, data);
+    return;
+  }
+
+  AsyncTaskChain *chain = AsyncParallelFor::get_task_chain("pfm", pfm_num_threads);
+  int num_threads = chain->get_num_threads() + 1;
+  size_t grain_size = max((size_t)1, num_rows / (num_threads * 4));
+  AsyncParallelFor::run(chain, num_rows, grain_size, func, data);
+}
+
+/**
+ * Fills the rows beginning at y_begin with the data in the indicated
+ * PNMImage, which must have the same width and number of channels as this
+ * PfmFile.  This is used to load an image a strip at a time.
+ */
+bool PfmFile::
+load_rows(const PNMImage &pnmimage, int y_begin) {
+  nassertr(pnmimage.get_x_size() == _x_size &&
+           pnmimage.get_num_channels() == _num_channels &&
+           y_begin + pnmimage.get_y_size() <= _y_size, false);
+
+  switch (_num_channels) {
+  case 1:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
+          _table[(size_t)(y_begin + yi) * _x_size + xi] = pnmimage.get_gray(xi, yi);
+        }
+      }
+    }
+    break;
+
+  case 2:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
+          PN_float32 *point = &_table[((size_t)(y_begin + yi) * _x_size + xi) * _num_channels];
+          point[0] = pnmimage.get_gray(xi, yi);
+          point[1] = pnmimage.get_alpha(xi, yi);
+        }
+      }
+    }
+    break;
+
+  case 3:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
+          PN_float32 *point = &_table[((size_t)(y_begin + yi) * _x_size + xi) * _num_channels];
+          LRGBColorf xel = pnmimage.get_xel(xi, yi);
+          point[0] = xel[0];
+          point[1] = xel[1];
+          point[2] = xel[2];
+        }
+      }
+    }
+    break;
+
+  case 4:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < pnmimage.get_x_size(); ++xi) {
+          PN_float32 *point = &_table[((size_t)(y_begin + yi) * _x_size + xi) * _num_channels];
+          LColorf xel = pnmimage.get_xel_a(xi, yi);
+          point[0] = xel[0];
+          point[1] = xel[1];
+          point[2] = xel[2];
+          point[3] = xel[3];
+        }
+      }
+    }
+    break;
+
+  default:
+    nassert_raise("unexpected channel count");
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Stores the rows beginning at y_begin into the indicated PNMImage, which
+ * must have the same width and number of channels as this PfmFile.  This is
+ * used to store an image a strip at a time.
+ */
+bool PfmFile::
+store_rows(PNMImage &pnmimage, int y_begin) const {
+  nassertr(pnmimage.get_x_size() == _x_size &&
+           pnmimage.get_num_channels() == _num_channels &&
+           y_begin + pnmimage.get_y_size() <= _y_size, false);
+
+  switch (_num_channels) {
+  case 1:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < get_x_size(); ++xi) {
+          pnmimage.set_gray(xi, yi, _table[(size_t)(y_begin + yi) * _x_size + xi]);
+        }
+      }
+    }
+    break;
+
+  case 2:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < get_x_size(); ++xi) {
+          const LPoint2f &point = get_point2(xi, y_begin + yi);
+          pnmimage.set_gray(xi, yi, point[0]);
+          pnmimage.set_alpha(xi, yi, point[1]);
+        }
+      }
+    }
+    break;
+
+  case 3:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < get_x_size(); ++xi) {
+          const LPoint3f &point = get_point3(xi, y_begin + yi);
+          pnmimage.set_xel(xi, yi, point[0], point[1], point[2]);
+        }
+      }
+    }
+    break;
+
+  case 4:
+    {
+      for (int yi = 0; yi < pnmimage.get_y_size(); ++yi) {
+        for (int xi = 0; xi < get_x_size(); ++xi) {
+          const LPoint4f &point = get_point4(xi, y_begin + yi);
+          pnmimage.set_xel_a(xi, yi, point[0], point[1], point[2], point[3]);
+        }
+      }
+    }
+    break;
+
+  default:
+    nassert_raise("unexpected channel count");
+    return false;
+  }
+  return true;
+}
+
 /**
  * Averages all the points in the rectangle from x0 .. y0 to x1 .. y1 into
  * result.  The region may be defined by floating-point boundaries; the result
@@ -2693,6 +2757,358 @@ box_filter_point(LPoint4f &result, PN_float32 &coverage,
   coverage += contrib;
 }
 
+/**
+ * Computes rows [begin, end) of quick_filter_from().
+ */
+void PfmFile::
+quick_filter_rows(size_t begin, size_t end, void *data) {
+  const PfmQuickFilterJob &job = *(const PfmQuickFilterJob *)data;
+  const PfmFile &from = *job._from;
+  int num_channels = job._num_channels;
+
+  PN_float32 orig_x_size = (PN_float32)from._x_size;
+  PN_float32 orig_y_size = (PN_float32)from._y_size;
+
+  for (size_t to_y = begin; to_y < end; ++to_y) {
+    // These are computed the same way the previous row computed its from_y1,
+    // so that adjacent rows meet exactly.
+    PN_float32 from_y0 = 0.0;
+    if (to_y != 0) {
+      from_y0 = (to_y + 0.0) * job._y_scale;
+      from_y0 = min(from_y0, orig_y_size);
+    }
+    PN_float32 from_y1 = (to_y + 1.0) * job._y_scale;
+    from_y1 = min(from_y1, orig_y_size);
+
+    PN_float32 *p = job._data + to_y * job._x_size * num_channels;
+    PN_float32 from_x0 = 0.0;
+    for (int to_x = 0; to_x < job._x_size; ++to_x) {
+      PN_float32 from_x1 = (to_x + 1.0) * job._x_scale;
+      from_x1 = min(from_x1, orig_x_size);
+
+      // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
+      // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
+      switch (num_channels) {
+      case 1:
+        from.box_filter_region(p[0], from_x0, from_y0, from_x1, from_y1);
+        break;
+
+      case 2:
+        {
+          LPoint2f result;
+          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
+          p[0] = result[0];
+          p[1] = result[1];
+        }
+        break;
+
+      case 3:
+        {
+          LPoint3f result;
+          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
+          p[0] = result[0];
+          p[1] = result[1];
+          p[2] = result[2];
+        }
+        break;
+
+      case 4:
+        {
+          LPoint4f result;
+          from.box_filter_region(result, from_x0, from_y0, from_x1, from_y1);
+          p[0] = result[0];
+          p[1] = result[1];
+          p[2] = result[2];
+          p[3] = result[3];
+        }
+        break;
+      }
+
+      p += num_channels;
+      from_x0 = from_x1;
+    }
+  }
+}
+
+/**
+ * Transforms the points on rows [begin, end) for xform().
+ */
+void PfmFile::
+xform_rows(size_t begin, size_t end, void *data) {
+  const PfmXformJob &job = *(const PfmXformJob *)data;
+  PfmFile &file = *job._file;
+  const LMatrix4f &transform = *job._transform;
+  int x_size = file._x_size;
+  int num_channels = file._num_channels;
+
+#ifdef PFM_SSE2
+  if (!file._has_no_data_value && num_channels >= 3) {
+    // Every point is transformed, so we can multiply each one by the rows of
+    // the matrix directly.  The load of a 3-component point may read one
+    // float past it, which the padding at the end of the table allows.
+    const PN_float32 *m = transform.get_data();
+    __m128 row0 = _mm_loadu_ps(m);
+    __m128 row1 = _mm_loadu_ps(m + 4);
+    __m128 row2 = _mm_loadu_ps(m + 8);
+    __m128 row3 = _mm_loadu_ps(m + 12);
+
+    for (size_t yi = begin; yi < end; ++yi) {
+      PN_float32 *p = &file._table[yi * x_size * num_channels];
+      if (num_channels == 3) {
+        for (int xi = 0; xi < x_size; ++xi) {
+          __m128 v = _mm_loadu_ps(p);
+          __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v, v, 0x00), row0),
+                                           _mm_mul_ps(_mm_shuffle_ps(v, v, 0x55), row1)),
+                                _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v, v, 0xaa), row2), row3));
+          r = _mm_div_ps(r, _mm_shuffle_ps(r, r, 0xff));
+          _mm_storel_pi((__m64 *)p, r);
+          _mm_store_ss(p + 2, _mm_movehl_ps(r, r));
+          p += 3;
+        }
+      } else {
+        for (int xi = 0; xi < x_size; ++xi) {
+          __m128 v = _mm_loadu_ps(p);
+          __m128 r = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v, v, 0x00), row0),
+                                           _mm_mul_ps(_mm_shuffle_ps(v, v, 0x55), row1)),
+                                _mm_add_ps(_mm_mul_ps(_mm_shuffle_ps(v, v, 0xaa), row2),
+                                           _mm_mul_ps(_mm_shuffle_ps(v, v, 0xff), row3)));
+          _mm_storeu_ps(p, r);
+          p += 4;
+        }
+      }
+    }
+    return;
+  }
+#endif  // PFM_SSE2
+
+  for (int yi = (int)begin; yi < (int)end; ++yi) {
+    switch (num_channels) {
+    case 1:
+      for (int xi = 0; xi < x_size; ++xi) {
+        if (!file.has_point(xi, yi)) {
+          continue;
+        }
+        PN_float32 pi = file.get_point1(xi, yi);
+        LPoint3f po = transform.xform_point(LPoint3f(pi, 0.0, 0.0));
+        file.set_point1(xi, yi, po[0]);
+      }
+      break;
+
+    case 2:
+      for (int xi = 0; xi < x_size; ++xi) {
+        if (!file.has_point(xi, yi)) {
+          continue;
+        }
+        LPoint2f pi = file.get_point2(xi, yi);
+        LPoint3f po = transform.xform_point(LPoint3f(pi[0], pi[1], 0.0));
+        file.set_point2(xi, yi, LPoint2f(po[0], po[1]));
+      }
+      break;
+
+    case 3:
+      for (int xi = 0; xi < x_size; ++xi) {
+        if (!file.has_point(xi, yi)) {
+          continue;
+        }
+        LPoint3f &p = file.modify_point3(xi, yi);
+        transform.xform_point_general_in_place(p);
+      }
+      break;
+
+    case 4:
+      for (int xi = 0; xi < x_size; ++xi) {
+        if (!file.has_point(xi, yi)) {
+          continue;
+        }
+        LPoint4f &p = file.modify_point4(xi, yi);
+        transform.xform_in_place(p);
+      }
+      break;
+    }
+  }
+}
+
+/**
+ * Fills in the missing points on rows [begin, end) for merge().
+ */
+void PfmFile::
+merge_rows(size_t begin, size_t end, void *data) {
+  const PfmMergeJob &job = *(const PfmMergeJob *)data;
+  PfmFile &file = *job._file;
+  const PfmFile &other = *job._other;
+
+  size_t point_size = file._num_channels * sizeof(PN_float32);
+  for (int y = (int)begin; y < (int)end; ++y) {
+    for (int x = 0; x < file._x_size; ++x) {
+      if (!file.has_point(x, y) && other.has_point(x, y)) {
+        size_t i = ((size_t)y * file._x_size + x) * file._num_channels;
+        memcpy(&file._table[i], &other._table[i], point_size);
+      }
+    }
+  }
+}
+
+/**
+ * Copies rows [begin, end) of the new table for apply_crop().
+ */
+void PfmFile::
+crop_rows(size_t begin, size_t end, void *data) {
+  const PfmCropJob &job = *(const PfmCropJob *)data;
+  for (size_t yi = begin; yi < end; ++yi) {
+    memcpy(job._dest + yi * job._dest_stride,
+           job._source + yi * job._source_stride,
+           job._dest_stride * sizeof(PN_float32));
+  }
+}
+
+/**
+ * Measures the bounding box of each of rows [begin, end) for calc_min_max().
+ */
+void PfmFile::
+min_max_rows(size_t begin, size_t end, void *data) {
+  const PfmMinMaxJob &job = *(const PfmMinMaxJob *)data;
+  const PfmFile &file = *job._file;
+  int x_size = file._x_size;
+
+  for (size_t yi = begin; yi < end; ++yi) {
+    PfmMinMaxRow &row = job._rows[yi];
+    row._any = false;
+
+#ifdef PFM_SSE2
+    if (!file._has_no_data_value && file._num_channels >= 3 && x_size > 0) {
+      // Every point counts.  The operand order matches that of std::min() and
+      // std::max() below, which matters if there are NaNs.
+      int num_channels = file._num_channels;
+      const PN_float32 *p = &file._table[yi * x_size * num_channels];
+      __m128 min_v = _mm_loadu_ps(p);
+      __m128 max_v = min_v;
+      for (int xi = 1; xi < x_size; ++xi) {
+        p += num_channels;
+        __m128 v = _mm_loadu_ps(p);
+        min_v = _mm_min_ps(v, min_v);
+        max_v = _mm_max_ps(v, max_v);
+      }
+
+      PN_float32 result[8];
+      _mm_storeu_ps(result, min_v);
+      _mm_storeu_ps(result + 4, max_v);
+      row._min.set(result[0], result[1], result[2]);
+      row._max.set(result[4], result[5], result[6]);
+      row._any = true;
+      continue;
+    }
+#endif  // PFM_SSE2
+
+    for (int xi = 0; xi < x_size; ++xi) {
+      if (!file.has_point(xi, (int)yi)) {
+        continue;
+      }
+
+      const LPoint3f &p = file.get_point(xi, (int)yi);
+      if (!row._any) {
+        row._min = p;
+        row._max = p;
+        row._any = true;
+      } else {
+        row._min[0] = min(row._min[0], p[0]);
+        row._min[1] = min(row._min[1], p[1]);
+        row._min[2] = min(row._min[2], p[2]);
+        row._max[0] = max(row._max[0], p[0]);
+        row._max[1] = max(row._max[1], p[1]);
+        row._max[2] = max(row._max[2], p[2]);
+      }
+    }
+  }
+}
+
+/**
+ * Converts rows [begin, end) from half-floats for load_half().
+ */
+void PfmFile::
+load_half_rows(size_t begin, size_t end, void *data) {
+  const PfmHalfJob &job = *(const PfmHalfJob *)data;
+  size_t i = begin * job._row_length;
+  size_t count = end * job._row_length;
+  PN_float32 *out = job._floats;
+  const uint16_t *in = job._halves;
+
+#ifdef PFM_SSE2
+  // The same as decode_half_float(), four values at a time.
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i mantissa_mask = _mm_set1_epi32(0x7fff);
+  const __m128i sign_mask = _mm_set1_epi32(0x8000);
+  const __m128i exponent_mask = _mm_set1_epi32(0x7c00);
+  const __m128i bias = _mm_set1_epi32(0x38000000);
+  const __m128i inf = _mm_set1_epi32(0x7f800000);
+  for (; i + 4 <= count; i += 4) {
+    __m128i h = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(in + i)), zero);
+    __m128i t1 = _mm_slli_epi32(_mm_and_si128(h, mantissa_mask), 13);
+    __m128i t2 = _mm_slli_epi32(_mm_and_si128(h, sign_mask), 16);
+    __m128i t3 = _mm_and_si128(h, exponent_mask);
+    __m128i is_special = _mm_cmpeq_epi32(t3, exponent_mask);
+    __m128i is_zero = _mm_cmpeq_epi32(t3, zero);
+    __m128i v = _mm_or_si128(_mm_and_si128(is_special, _mm_or_si128(t1, inf)),
+                             _mm_andnot_si128(is_special, _mm_add_epi32(t1, bias)));
+    v = _mm_or_si128(_mm_andnot_si128(is_zero, v), t2);
+    _mm_storeu_ps(out + i, _mm_castsi128_ps(v));
+  }
+#endif  // PFM_SSE2
+
+  for (; i < count; ++i) {
+    out[i] = decode_half_float(in[i]);
+  }
+}
+
+/**
+ * Converts rows [begin, end) to half-floats for store_half().
+ */
+void PfmFile::
+store_half_rows(size_t begin, size_t end, void *data) {
+  const PfmHalfJob &job = *(const PfmHalfJob *)data;
+  size_t i = begin * job._row_length;
+  size_t count = end * job._row_length;
+  const PN_float32 *in = job._floats;
+  uint16_t *out = job._halves;
+
+#ifdef PFM_SSE2
+  // The same as encode_half_float(), eight values at a time.
+  const __m128i abs_mask = _mm_set1_epi32(0x7fffffff);
+  const __m128i sign_mask = _mm_set1_epi32(0x80000000);
+  const __m128i bias = _mm_set1_epi32(0x38000000 - 0xfff);
+  const __m128i one = _mm_set1_epi32(1);
+  const __m128i min_normal = _mm_set1_epi32(0x38800000);
+  const __m128i max_normal = _mm_set1_epi32(0x47800000 - 1);
+  const __m128i inf = _mm_set1_epi32(0x7f800000);
+  const __m128i half_inf = _mm_set1_epi32(0x7c00);
+  const __m128i half_nan = _mm_set1_epi32(0x7e00);
+  const __m128i offset = _mm_set1_epi32(0x8000);
+  const __m128i offset16 = _mm_set1_epi16((short)0x8000);
+  for (; i + 8 <= count; i += 8) {
+    __m128i h[2];
+    for (int j = 0; j < 2; ++j) {
+      __m128i v = _mm_castps_si128(_mm_loadu_ps(in + i + j * 4));
+      __m128i sign = _mm_srli_epi32(_mm_and_si128(v, sign_mask), 16);
+      __m128i bits = _mm_and_si128(v, abs_mask);
+      __m128i round = _mm_and_si128(_mm_srli_epi32(bits, 13), one);
+      __m128i r = _mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(bits, bias), round), 13);
+      __m128i too_small = _mm_cmpgt_epi32(min_normal, bits);
+      __m128i too_large = _mm_cmpgt_epi32(bits, max_normal);
+      __m128i is_nan = _mm_cmpgt_epi32(bits, inf);
+      r = _mm_andnot_si128(_mm_or_si128(too_small, too_large), r);
+      r = _mm_or_si128(r, _mm_and_si128(too_large, half_inf));
+      r = _mm_or_si128(r, _mm_and_si128(is_nan, half_nan));
+      h[j] = _mm_sub_epi32(_mm_or_si128(r, sign), offset);
+    }
+    __m128i result = _mm_xor_si128(_mm_packs_epi32(h[0], h[1]), offset16);
+    _mm_storeu_si128((__m128i *)(out + i), result);
+  }
+#endif  // PFM_SSE2
+
+  for (; i < count; ++i) {
+    out[i] = encode_half_float(in[i]);
+  }
+}
+
 /**
  * A support function for calc_average_point(), this recursively fills in the
  * holes in the mini_grid data with the index to the nearest value.
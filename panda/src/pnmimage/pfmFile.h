@@ -19,6 +19,7 @@
 #include "luse.h"
 #include "boundingHexahedron.h"
 #include "vector_float.h"
+#include "pta_ushort.h"
 
 class PNMImage;
 class PNMReader;
@@ -48,6 +49,9 @@ PUBLISHED:
   BLOCKING bool store(PNMImage &pnmimage) const;
   BLOCKING bool store_mask(PNMImage &pnmimage) const;
   BLOCKING bool store_mask(PNMImage &pnmimage, const LVecBase4f &min_point, const LVecBase4f &max_point) const;
+  BLOCKING bool load_half(int x_size, int y_size, int num_channels,
+                          CPTA_ushort data);
+  BLOCKING PTA_ushort store_half() const;
 
   INLINE bool is_valid() const;
   MAKE_PROPERTY(valid, is_valid);
@@ -114,6 +118,8 @@ PUBLISHED:
   BLOCKING void resize(int new_x_size, int new_y_size);
   BLOCKING void box_filter_from(float radius, const PfmFile &copy);
   BLOCKING void gaussian_filter_from(float radius, const PfmFile &copy);
+  BLOCKING void lanczos_filter_from(float radius, const PfmFile &copy);
+  BLOCKING void mitchell_filter_from(float radius, const PfmFile &copy);
   BLOCKING void quick_filter_from(const PfmFile &copy);
 
   BLOCKING void reverse_rows();
@@ -180,7 +186,14 @@ public:
   INLINE const vector_float &get_table() const;
   INLINE void swap_table(vector_float &table);
 
+  typedef void RowFunc(size_t begin, size_t end, void *data);
+  static void run_rows(size_t num_rows, size_t row_length,
+                       RowFunc *func, void *data);
+
 private:
+  bool load_rows(const PNMImage &pnmimage, int y_begin);
+  bool store_rows(PNMImage &pnmimage, int y_begin) const;
+
   INLINE void setup_sub_image(const PfmFile &copy, int &xto, int &yto,
                               int &xfrom, int &yfrom, int &x_size, int &y_size,
                               int &xmin, int &ymin, int &xmax, int &ymax);
@@ -217,6 +230,14 @@ private:
     int _dist;
   };
 
+  static void quick_filter_rows(size_t begin, size_t end, void *data);
+  static void xform_rows(size_t begin, size_t end, void *data);
+  static void merge_rows(size_t begin, size_t end, void *data);
+  static void crop_rows(size_t begin, size_t end, void *data);
+  static void min_max_rows(size_t begin, size_t end, void *data);
+  static void load_half_rows(size_t begin, size_t end, void *data);
+  static void store_half_rows(size_t begin, size_t end, void *data);
+
   void fill_mini_grid(MiniGridCell *mini_grid, int x_size, int y_size,
                       int xi, int yi, int dist, int sxi, int syi) const;
 
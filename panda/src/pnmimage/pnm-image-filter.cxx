@@ -24,10 +24,11 @@
 // The image is filtered first along one axis, then along the other.  This
 // decreases the complexity of the convolution operation: it is faster to
 // convolve twice with a one-dimensional kernel than once with a two-
-// dimensional kernel.  In the interim, a temporary matrix of type StoreType
-// (a numeric type, described below) is built which contains the results from
-// the first convolution.  The entire process is then repeated for each
-// channel in the image.
+// dimensional kernel.  In the interim, a temporary matrix is built which
+// contains the results from the first convolution.  For sparse PfmFiles, this
+// is a matrix of type StoreType (a numeric type, described below), and the
+// entire process is repeated for each channel in the image; otherwise, all of
+// the channels are filtered at once in float32 (see FilterAxis, below).
 
 #include "pandabase.h"
 #include <math.h>
@@ -36,6 +37,17 @@
 
 #include "pnmImage.h"
 #include "pfmFile.h"
+#include "config_pnmimage.h"
+#include "mathNumbers.h"
+#include "asyncParallelFor.h"
+
+#include <limits.h>
+#include <string.h>
+
+#if defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)
+#define PNM_FILTER_SSE2
+#include <xmmintrin.h>
+#endif
 
 using std::max;
 using std::min;
@@ -95,80 +107,18 @@ static const WorkType source_max = 255;
 static const WorkType filter_max = 255;
 */
 
-// filter_row() filters a single row by convolving with a one-dimensional
-// kernel filter.  The kernel is defined by an array of weights in filter[],
-// where the ith element of filter corresponds to abs(d * scale), if
+// filter_sparse_row() filters a single row by convolving with a one-
+// dimensional kernel filter.  The kernel is defined by an array of weights in
+// filter[], where the ith element of filter corresponds to abs(d * scale), if
 // scale>1.0, and abs(d), if scale<=1.0, where d is the offset from the center
-// and varies from -filter_width to filter_width.
+// and varies from -filter_width to filter_width.  It also accepts an array of
+// weight values per element, to support scaling a sparse array (as in a
+// PfmFile).
 
 // Note that filter_width is not necessarily the length of the array; it is
 // the radius of interest of the filter function.  The array may need to be
 // larger (by a factor of scale), to adequately cover all the values.
 
-static void
-filter_row(StoreType dest[], int dest_len,
-           const StoreType source[], int source_len,
-           float scale,                    //  == dest_len / source_len
-           const WorkType filter[],
-           float filter_width) {
-  // If we are expanding the row (scale > 1.0), we need to look at a
-  // fractional granularity.  Hence, we scale our filter index by scale.  If
-  // we are compressing (scale < 1.0), we don't need to fiddle with the filter
-  // index, so we leave it at one.
-
-  float iscale;
-  if (scale < 1.0f) {
-    iscale = 1.0f;
-    filter_width /= scale;
-  } else {
-    iscale = scale;
-  }
-
-  for (int dest_x = 0; dest_x < dest_len; dest_x++) {
-    // The additional offset of 0.5 keeps the pixel centered.
-    float center = (dest_x + 0.5f) / scale - 0.5f;
-
-    // left and right are the starting and ending ranges of the radius of
-    // interest of the filter function.  We need to apply the filter to each
-    // value in this range.
-    int left = max((int)cfloor(center - filter_width), 0);
-    int right = min((int)cceil(center + filter_width), source_len - 1);
-
-    // right_center is the point just to the right of the center.  This allows
-    // us to flip the sign of the offset when we cross the center point.
-    int right_center = (int)cceil(center);
-
-    WorkType net_weight = 0;
-    WorkType net_value = 0;
-
-    int index, source_x;
-
-    // This loop is broken into two pieces--the left of center and the right
-    // of center--so we don't have to incur the overhead of calling fabs()
-    // each time through the loop.
-    for (source_x = left; source_x < right_center; source_x++) {
-      index = (int)(iscale * (center - source_x) + 0.5f);
-      net_value += filter[index] * source[source_x];
-      net_weight += filter[index];
-    }
-
-    for (; source_x <= right; source_x++) {
-      index = (int)(iscale * (source_x - center) + 0.5f);
-      net_value += filter[index] * source[source_x];
-      net_weight += filter[index];
-    }
-
-    if (net_weight > 0) {
-      dest[dest_x] = (StoreType)(net_value / net_weight);
-    } else {
-      dest[dest_x] = 0;
-    }
-  }
-  Thread::consider_yield();
-}
-
-// As above, but we also accept an array of weight values per element, to
-// support scaling a sparse array (as in a PfmFile).
 static void
 filter_sparse_row(StoreType dest[], StoreType dest_weight[], int dest_len,
                   const StoreType source[], const StoreType source_weight[], int source_len,
@@ -291,7 +241,7 @@ gaussian_filter_impl(float scale, float width,
 
   float sigma = width/2;
   filter_width = 3.0 * sigma;
-  int actual_width = (int)cceil((filter_width + 1) * fscale);
+  int actual_width = (int)cceil((filter_width + 1) * fscale) + 1;
 
   // G(x, y) = (1(2 pi sigma^2)) * exp( - (x^2 + y^2)  (2 sigma^2))
 
@@ -311,217 +261,551 @@ gaussian_filter_impl(float scale, float width,
   }
 }
 
+static void
+lanczos_filter_impl(float scale, float width,
+                    WorkType *&filter, float &filter_width) {
+  float fscale;
+  if (scale < 1.0) {
+    fscale = 1.0 / scale;
+  } else {
+    fscale = scale;
+  }
 
-// We have a function, defined in pnm-image-filter-core.cxx, that will scale
-// an image in both X and Y directions for a particular channel, by setting up
-// the temporary matrix appropriately and calling the above functions.
+  // The Lanczos kernel is a sinc function, windowed by the central lobe of a
+  // wider sinc function.  width is the number of lobes on either side:
+  // L(x) = sinc(x) * sinc(x / width), for abs(x) < width.
+  filter_width = width;
+  int actual_width = (int)cceil((filter_width + 1) * fscale) + 1;
 
-// What we really need is a series of such functions, one for each channel,
-// and also one to scale by X first, and one to scale by Y first.  This sounds
-// a lot like a C++ template: we want to compile the same function several
-// times to work on slightly different sorts of things each time.  However,
-// the things we want to vary are the particular member functions of PNMImage
-// that we call (e.g.  Red(), Green(), etc.), and we can't declare a template
-// of member functions, only of types.
+  filter = (WorkType *)PANDA_MALLOC_ARRAY(actual_width * sizeof(WorkType));
 
-// It's doable using templates.  It would involve the declaration of lots of
-// silly little functor objects.  This is much more compact and no more
-// difficult to read.
+  for (int i = 0; i < actual_width; i++) {
+    float x = i / fscale;
+    if (x == 0.0f) {
+      filter[i] = filter_max;
+    } else if (x < width) {
+      float px = MathNumbers::pi_f * x;
+      filter[i] = (WorkType)(filter_max * width * csin(px) * csin(px / width) / (px * px));
+    } else {
+      filter[i] = 0;
+    }
+  }
+}
 
-// The function in pnm-image-filter-core.cxx uses macros to access the member
-// functions of PNMImage.  Hence, we only need to redefine those macros with
-// each instance of the function to cause each instance to operate on the
-// correct member.
+static void
+mitchell_filter_impl(float scale, float width,
+                     WorkType *&filter, float &filter_width) {
+  float fscale;
+  if (scale < 1.0) {
+    fscale = 1.0 / scale;
+  } else {
+    fscale = scale;
+  }
 
+  // This is the cubic filter of Mitchell and Netravali, with B = C = 1/3.
+  // Its natural radius of 2 is stretched to width.
+  filter_width = width;
+  int actual_width = (int)cceil((filter_width + 1) * fscale) + 1;
 
-// These instances scale by X first, then by Y.
+  filter = (WorkType *)PANDA_MALLOC_ARRAY(actual_width * sizeof(WorkType));
 
-#define FUNCTION_NAME filter_red_xy
-#define IMAGETYPE PNMImage
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_red(a, b)
-#define SETVAL(a, b, channel, v) set_red(a, b, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+  for (int i = 0; i < actual_width; i++) {
+    float x = (i / fscale) * 2.0f / width;
+    float value;
+    if (x < 1.0f) {
+      value = ((7.0f * x - 12.0f) * x * x + 16.0f / 3.0f) / 6.0f;
+    } else if (x < 2.0f) {
+      value = (((-7.0f / 3.0f * x + 12.0f) * x - 20.0f) * x + 32.0f / 3.0f) / 6.0f;
+    } else {
+      value = 0.0f;
+    }
+    // The highest value is 8/9, at x = 0.
+    filter[i] = (WorkType)(filter_max * value * (9.0f / 8.0f));
+  }
+}
 
-#define FUNCTION_NAME filter_green_xy
-#define IMAGETYPE PNMImage
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_green(a, b)
-#define SETVAL(a, b, channel, v) set_green(a, b, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
 
-#define FUNCTION_NAME filter_blue_xy
-#define IMAGETYPE PNMImage
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_blue(a, b)
-#define SETVAL(a, b, channel, v) set_blue(a, b, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+// The non-sparse filters don't evaluate the kernel separately for each row.
+// Instead, the contribution of each source pixel to each destination pixel
+// along an axis is computed just once, with the weights of each destination
+// pixel already normalized to add up to 1.  The image is then filtered along
+// the X axis, one row at a time, into a temporary float32 matrix with all of
+// the channels of a pixel side by side, and then along the Y axis, one whole
+// row of that matrix at a time.  Both passes are divided across the threads
+// of the "pnm-filter" task chain; see pnm-filter-num-threads.
+
+class FilterAxis {
+public:
+  void compute(int dest_len, int source_len, float width,
+               FilterFunction *make_filter);
+  void compute_box(int dest_begin, int dest_end, int source_len, float scale);
+  void add_pixel(int source_pos, float weight);
+  void finish_pixel();
+
+  int get_num_pixels() const { return (int)_count.size(); }
+
+  // The destination pixel coordinate of the first element.
+  int _dest_offset;
+
+  // The first contributing source pixel and the number of them, per
+  // destination pixel, and the index of its first weight in _weights.
+  pvector<int> _first;
+  pvector<int> _count;
+  pvector<size_t> _start;
+  pvector<float> _weights;
+};
 
-#define FUNCTION_NAME filter_gray_xy
-#define IMAGETYPE PNMImage
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_bright(a, b)
-#define SETVAL(a, b, channel, v) set_xel(a, b, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+/**
+ * Computes the contributions for a filter kernel built by make_filter(),
+ * visiting the same source pixels as filter_sparse_row() does.
+ */
+void FilterAxis::
+compute(int dest_len, int source_len, float width,
+        FilterFunction *make_filter) {
+  _dest_offset = 0;
 
-#define FUNCTION_NAME filter_alpha_xy
-#define IMAGETYPE PNMImage
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_alpha(a, b)
-#define SETVAL(a, b, channel, v) set_alpha(a, b, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+  float scale = (float)dest_len / (float)source_len;
+  WorkType *filter;
+  float filter_width;
+  make_filter(scale, width, filter, filter_width);
 
+  float iscale;
+  if (scale < 1.0f) {
+    iscale = 1.0f;
+    filter_width /= scale;
+  } else {
+    iscale = scale;
+  }
 
-// These instances scale by Y first, then by X.
+  for (int dest_x = 0; dest_x < dest_len; dest_x++) {
+    // The additional offset of 0.5 keeps the pixel centered.
+    float center = (dest_x + 0.5f) / scale - 0.5f;
+    int left = max((int)cfloor(center - filter_width), 0);
+    int right = min((int)cceil(center + filter_width), source_len - 1);
+    int right_center = (int)cceil(center);
 
-#define FUNCTION_NAME filter_red_yx
-#define IMAGETYPE PNMImage
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_red(b, a)
-#define SETVAL(a, b, channel, v) set_red(b, a, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+    int source_x;
+    for (source_x = left; source_x < right_center; source_x++) {
+      add_pixel(source_x, filter[(int)(iscale * (center - source_x) + 0.5f)]);
+    }
+    for (; source_x <= right; source_x++) {
+      add_pixel(source_x, filter[(int)(iscale * (source_x - center) + 0.5f)]);
+    }
+    finish_pixel();
+  }
 
-#define FUNCTION_NAME filter_green_yx
-#define IMAGETYPE PNMImage
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_green(b, a)
-#define SETVAL(a, b, channel, v) set_green(b, a, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+  PANDA_FREE_ARRAY(filter);
+}
 
-#define FUNCTION_NAME filter_blue_yx
-#define IMAGETYPE PNMImage
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_blue(b, a)
-#define SETVAL(a, b, channel, v) set_blue(b, a, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+/**
+ * Computes the contributions for quick_filter_from(), which averages the
+ * source pixels covered by each destination pixel, weighted by their
+ * coverage.
+ */
+void FilterAxis::
+compute_box(int dest_begin, int dest_end, int source_len, float scale) {
+  _dest_offset = dest_begin;
+
+  for (int dest_x = dest_begin; dest_x < dest_end; ++dest_x) {
+    float x0 = dest_x * scale;
+    float x1 = (dest_x + 1) * scale;
+
+    // The first (partial) pixel.
+    int x = (int)x0;
+    add_pixel(x, (float)(x + 1) - x0);
+
+    int x_last = (int)x1;
+    if (x < x_last) {
+      // Each consecutive (complete) pixel.
+      for (++x; x < x_last; ++x) {
+        add_pixel(x, 1.0f);
+      }
 
-#define FUNCTION_NAME filter_gray_yx
-#define IMAGETYPE PNMImage
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_bright(b, a)
-#define SETVAL(a, b, channel, v) set_xel(b, a, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+      // The final (partial) pixel.
+      float contrib = x1 - (float)x_last;
+      if (contrib > 0.0001f && x < source_len) {
+        add_pixel(x, contrib);
+      }
+    }
+    finish_pixel();
+  }
+}
 
-#define FUNCTION_NAME filter_alpha_yx
-#define IMAGETYPE PNMImage
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_alpha(b, a)
-#define SETVAL(a, b, channel, v) set_alpha(b, a, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+/**
+ * Adds the indicated source pixel to the destination pixel being computed.
+ * The source pixels must be added in increasing order.
+ */
+void FilterAxis::
+add_pixel(int source_pos, float weight) {
+  if (_first.size() == _count.size()) {
+    // This is the first source pixel of a new destination pixel.
+    _start.push_back(_weights.size());
+    _first.push_back(source_pos);
+  }
+  _weights.push_back(weight);
+}
 
+/**
+ * Finishes the destination pixel being computed, trimming away the source
+ * pixels that don't contribute to it and normalizing the weights of the rest.
+ */
+void FilterAxis::
+finish_pixel() {
+  if (_first.size() == _count.size()) {
+    // No source pixels at all.
+    _start.push_back(_weights.size());
+    _first.push_back(0);
+  }
+  size_t start = _start.back();
+  size_t end = _weights.size();
 
-// filter_image pulls everything together, and filters one image into another.
-// Both images can be the same with no ill effects.
+  // Box filters in particular may have lots of zeroes at either end.
+  while (end > start && _weights[end - 1] == 0.0f) {
+    --end;
+  }
+  size_t begin = start;
+  while (begin < end && _weights[begin] == 0.0f) {
+    ++begin;
+  }
+
+  float net_weight = 0.0f;
+  for (size_t i = begin; i < end; ++i) {
+    net_weight += _weights[i];
+  }
+  if (net_weight <= 0.0f) {
+    // This will produce black, like filter_sparse_row() does.
+    begin = end;
+  }
+
+  _first.back() += (int)(begin - start);
+  for (size_t i = begin; i < end; ++i) {
+    _weights[start + i - begin] = _weights[i] / net_weight;
+  }
+  _weights.resize(start + (end - begin));
+  _count.push_back((int)(end - begin));
+}
+
+// These read a row of the source image into an array of num_channels floats
+// per pixel, and write such an array back into a row of the destination
+// image, starting at column x.
+typedef void LoadRowFunction(float *row, const void *image, int y,
+                             int num_channels);
+typedef void StoreRowFunction(void *image, int x, int y, const float *row,
+                              int num_pixels, int num_channels);
+
+// The state of a filter_image() call, shared by the threads doing the work.
+class FilterJob {
+public:
+  LoadRowFunction *_load_row;
+  StoreRowFunction *_store_row;
+  const void *_source;
+  void *_dest;
+  int _source_x_size;
+  int _num_channels;
+  FilterAxis _x_axis;
+  FilterAxis _y_axis;
+
+  // The matrix holds one row, filtered along X, for each source row from
+  // _first_row on.
+  int _first_row;
+  size_t _row_length;
+  float *_matrix;
+};
+
+/**
+ * Sets dest to the weighted sum of count consecutive rows of row_length
+ * floats, starting at source.
+ */
 static void
-filter_image(PNMImage &dest, const PNMImage &source,
-             float width, FilterFunction *make_filter) {
+add_weighted_rows(float *dest, const float *source, size_t row_length,
+                  const float *weights, int count) {
+  if (count == 0) {
+    memset(dest, 0, row_length * sizeof(float));
+    return;
+  }
 
-  // We want to scale by the smallest destination axis first, for a slight
-  // performance gain.
+  size_t i = 0;
+#ifdef PNM_FILTER_SSE2
+  __m128 w0 = _mm_set1_ps(weights[0]);
+  for (; i + 4 <= row_length; i += 4) {
+    _mm_storeu_ps(dest + i, _mm_mul_ps(w0, _mm_loadu_ps(source + i)));
+  }
+#endif
+  for (; i < row_length; ++i) {
+    dest[i] = weights[0] * source[i];
+  }
 
-  // In the PNMImage case (unlike the PfmFile case), the channel parameter is
-  // not used.  We *could* use it to avoid the replication of quite so many
-  // functions, but we replicate them anyway, for another tiny performance
-  // gain.
+  for (int k = 1; k < count; ++k) {
+    const float *row = source + k * row_length;
+    float weight = weights[k];
+    i = 0;
+#ifdef PNM_FILTER_SSE2
+    __m128 w = _mm_set1_ps(weight);
+    for (; i + 4 <= row_length; i += 4) {
+      __m128 value = _mm_mul_ps(w, _mm_loadu_ps(row + i));
+      _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), value));
+    }
+#endif
+    for (; i < row_length; ++i) {
+      dest[i] += weight * row[i];
+    }
+  }
+}
 
-  if (dest.get_x_size() <= dest.get_y_size()) {
-    if (dest.is_grayscale() || source.is_grayscale()) {
-      filter_gray_xy(dest, source, width, make_filter, 0);
-    } else {
-      filter_red_xy(dest, source, width, make_filter, 0);
-      filter_green_xy(dest, source, width, make_filter, 0);
-      filter_blue_xy(dest, source, width, make_filter, 0);
+/**
+ * Filters one row, with num_channels floats per pixel, along the indicated
+ * axis.
+ */
+static void
+filter_row(float *dest, const float *source, const FilterAxis &axis,
+           int num_channels) {
+  int num_pixels = axis.get_num_pixels();
+  const float *weights = axis._weights.data();
+
+#ifdef PNM_FILTER_SSE2
+  if (num_channels == 4) {
+    // Each pixel is just one vector.
+    for (int x = 0; x < num_pixels; ++x) {
+      const float *w = weights + axis._start[x];
+      const float *p = source + axis._first[x] * 4;
+      __m128 result = _mm_setzero_ps();
+      for (int k = 0; k < axis._count[x]; ++k) {
+        result = _mm_add_ps(result, _mm_mul_ps(_mm_set1_ps(w[k]), _mm_loadu_ps(p + k * 4)));
+      }
+      _mm_storeu_ps(dest + x * 4, result);
+    }
+    return;
+  }
+#endif
+
+  for (int x = 0; x < num_pixels; ++x) {
+    const float *w = weights + axis._start[x];
+    const float *p = source + axis._first[x] * num_channels;
+    float result[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    for (int k = 0; k < axis._count[x]; ++k) {
+      for (int c = 0; c < num_channels; ++c) {
+        result[c] += w[k] * p[c];
+      }
+      p += num_channels;
+    }
+    for (int c = 0; c < num_channels; ++c) {
+      dest[x * num_channels + c] = result[c];
     }
+  }
+}
+
+/**
+ * The work function for the first pass: filters the indicated source rows
+ * (counting from _first_row) along X, into the matrix.
+ */
+static void
+filter_x_rows(size_t begin, size_t end, void *user_data) {
+  const FilterJob *job = (const FilterJob *)user_data;
+
+  pvector<float> row((size_t)job->_source_x_size * job->_num_channels);
+  for (size_t r = begin; r < end; ++r) {
+    job->_load_row(row.data(), job->_source, job->_first_row + (int)r,
+                   job->_num_channels);
+    filter_row(job->_matrix + r * job->_row_length, row.data(),
+               job->_x_axis, job->_num_channels);
+    Thread::consider_yield();
+  }
+}
 
-    if (dest.has_alpha() && source.has_alpha()) {
-      filter_alpha_xy(dest, source, width, make_filter, 0);
+/**
+ * The work function for the second pass: filters the matrix along Y into the
+ * indicated destination rows (counting from the first row of _y_axis).
+ */
+static void
+filter_y_rows(size_t begin, size_t end, void *user_data) {
+  const FilterJob *job = (const FilterJob *)user_data;
+  const FilterAxis &axis = job->_y_axis;
+
+  pvector<float> row(job->_row_length);
+  for (size_t y = begin; y < end; ++y) {
+    const float *source = job->_matrix;
+    if (axis._count[y] != 0) {
+      source += (size_t)(axis._first[y] - job->_first_row) * job->_row_length;
     }
+    add_weighted_rows(row.data(), source, job->_row_length,
+                      axis._weights.data() + axis._start[y], axis._count[y]);
+    job->_store_row(job->_dest, job->_x_axis._dest_offset,
+                    axis._dest_offset + (int)y, row.data(),
+                    job->_x_axis.get_num_pixels(), job->_num_channels);
+    Thread::consider_yield();
+  }
+}
 
-  } else {
-    if (dest.is_grayscale() || source.is_grayscale()) {
-      filter_gray_yx(dest, source, width, make_filter, 0);
-    } else {
-      filter_red_yx(dest, source, width, make_filter, 0);
-      filter_green_yx(dest, source, width, make_filter, 0);
-      filter_blue_yx(dest, source, width, make_filter, 0);
+/**
+ * Calls func on all of the indicated rows, dividing them across the threads
+ * of the "pnm-filter" task chain if there is enough work to go around.
+ */
+static void
+run_rows(size_t num_rows, size_t row_length,
+         AsyncParallelFor::WorkFunc *func, FilterJob *job) {
+  if (num_rows < 4 || num_rows * row_length < 65536) {
+    // Not worth waking up the other threads for.
+    func(0, num_rows, job);
+    return;
+  }
+
+  AsyncTaskChain *chain = AsyncParallelFor::get_task_chain("pnm-filter", pnm_filter_num_threads);
+  int num_threads = chain->get_num_threads() + 1;
+  size_t grain_size = max((size_t)1, num_rows / (num_threads * 4));
+  AsyncParallelFor::run(chain, num_rows, grain_size, func, job);
+}
+
+/**
+ * Filters the source image into the destination image, according to the
+ * axes that have already been computed.
+ */
+static void
+run_filter_job(FilterJob &job) {
+  int num_y = job._y_axis.get_num_pixels();
+  if (num_y == 0 || job._x_axis.get_num_pixels() == 0) {
+    return;
+  }
+
+  // Find the range of source rows that are needed.
+  int first_row = INT_MAX;
+  int last_row = -1;
+  for (int y = 0; y < num_y; ++y) {
+    if (job._y_axis._count[y] != 0) {
+      first_row = min(first_row, job._y_axis._first[y]);
+      last_row = max(last_row, job._y_axis._first[y] + job._y_axis._count[y] - 1);
+    }
+  }
+  if (last_row < first_row) {
+    first_row = last_row = 0;
+  }
+
+  job._first_row = first_row;
+  job._row_length = (size_t)job._x_axis.get_num_pixels() * job._num_channels;
+
+  size_t num_rows = (size_t)(last_row - first_row + 1);
+  pvector<float> matrix(num_rows * job._row_length);
+  job._matrix = matrix.data();
+
+  // Both images may be the same, so the first pass must be complete before
+  // the second pass begins.
+  run_rows(num_rows, job._row_length, &filter_x_rows, &job);
+  run_rows(num_y, job._row_length, &filter_y_rows, &job);
+}
+
+// The row functions for PNMImage.  Grayscale images, or color images that are
+// being filtered into grayscale images, are filtered by brightness.  The alpha
+// channel, if any, follows the other channels.
+
+static void
+load_pnm_gray_row(float *row, const void *image, int y, int num_channels) {
+  const PNMImage &source = *(const PNMImage *)image;
+  int x_size = source.get_x_size();
+  for (int x = 0; x < x_size; ++x) {
+    row[0] = source.get_bright(x, y);
+    if (num_channels == 2) {
+      row[1] = source.get_alpha(x, y);
+    }
+    row += num_channels;
+  }
+}
+
+static void
+store_pnm_gray_row(void *image, int x, int y, const float *row,
+                   int num_pixels, int num_channels) {
+  PNMImage &dest = *(PNMImage *)image;
+  for (int i = 0; i < num_pixels; ++i) {
+    dest.set_xel(x + i, y, row[0]);
+    if (num_channels == 2) {
+      dest.set_alpha(x + i, y, row[1]);
+    }
+    row += num_channels;
+  }
+}
+
+static void
+load_pnm_color_row(float *row, const void *image, int y, int num_channels) {
+  const PNMImage &source = *(const PNMImage *)image;
+  int x_size = source.get_x_size();
+  for (int x = 0; x < x_size; ++x) {
+    LRGBColorf color = source.get_xel(x, y);
+    row[0] = color[0];
+    row[1] = color[1];
+    row[2] = color[2];
+    if (num_channels == 4) {
+      row[3] = source.get_alpha(x, y);
     }
+    row += num_channels;
+  }
+}
 
-    if (dest.has_alpha() && source.has_alpha()) {
-      filter_alpha_yx(dest, source, width, make_filter, 0);
+static void
+store_pnm_color_row(void *image, int x, int y, const float *row,
+                    int num_pixels, int num_channels) {
+  PNMImage &dest = *(PNMImage *)image;
+  for (int i = 0; i < num_pixels; ++i) {
+    dest.set_xel(x + i, y, LRGBColorf(row[0], row[1], row[2]));
+    if (num_channels == 4) {
+      dest.set_alpha(x + i, y, row[3]);
     }
+    row += num_channels;
+  }
+}
+
+static void
+load_pnm_rgba_row(float *row, const void *image, int y, int num_channels) {
+  const PNMImage &source = *(const PNMImage *)image;
+  int x_size = source.get_x_size();
+  for (int x = 0; x < x_size; ++x) {
+    LColorf color = source.get_xel_a(x, y);
+    row[0] = color[0];
+    row[1] = color[1];
+    row[2] = color[2];
+    row[3] = color[3];
+    row += 4;
+  }
+}
+
+static void
+store_pnm_rgba_row(void *image, int x, int y, const float *row,
+                   int num_pixels, int num_channels) {
+  PNMImage &dest = *(PNMImage *)image;
+  for (int i = 0; i < num_pixels; ++i) {
+    dest.set_xel_a(x + i, y, LColorf(row[0], row[1], row[2], row[3]));
+    row += 4;
   }
 }
 
+// filter_image pulls everything together, and filters one image into another.
+// Both images can be the same with no ill effects.
+static void
+filter_image(PNMImage &dest, const PNMImage &source,
+             float width, FilterFunction *make_filter) {
+  if (!dest.is_valid() || !source.is_valid()) {
+    return;
+  }
+
+  FilterJob job;
+  if (dest.is_grayscale() || source.is_grayscale()) {
+    job._load_row = &load_pnm_gray_row;
+    job._store_row = &store_pnm_gray_row;
+    job._num_channels = 1;
+  } else {
+    job._load_row = &load_pnm_color_row;
+    job._store_row = &store_pnm_color_row;
+    job._num_channels = 3;
+  }
+  if (dest.has_alpha() && source.has_alpha()) {
+    ++job._num_channels;
+  }
+
+  job._source = &source;
+  job._dest = &dest;
+  job._source_x_size = source.get_x_size();
+  job._x_axis.compute(dest.get_x_size(), source.get_x_size(), width, make_filter);
+  job._y_axis.compute(dest.get_y_size(), source.get_y_size(), width, make_filter);
+  run_filter_job(job);
+}
+
 /**
  * Makes a resized copy of the indicated image into this one using the
  * indicated filter.  The image to be copied is squashed and stretched to
@@ -544,38 +828,54 @@ gaussian_filter_from(float width, const PNMImage &copy) {
   filter_image(*this, copy, width, &gaussian_filter_impl);
 }
 
+/**
+ * Makes a resized copy of the indicated image into this one using a Lanczos
+ * filter with the indicated number of lobes on either side, usually 2 or 3.
+ * This gives sharper results than the Gaussian filter, at the cost of some
+ * ringing near hard edges.
+ */
+void PNMImage::
+lanczos_filter_from(float radius, const PNMImage &copy) {
+  filter_image(*this, copy, radius, &lanczos_filter_impl);
+}
+
+/**
+ * Makes a resized copy of the indicated image into this one using the cubic
+ * filter of Mitchell and Netravali (with B = C = 1/3), a good compromise
+ * between blurring and ringing.  Its natural radius is 2.
+ */
+void PNMImage::
+mitchell_filter_from(float radius, const PNMImage &copy) {
+  filter_image(*this, copy, radius, &mitchell_filter_impl);
+}
+
 // Now we do it again, this time for PfmFile.  In this case we also need to
 // support the sparse variants, since PfmFiles can be incomplete.  However, we
 // don't need to have a different function for each channel.
 
-#define FUNCTION_NAME filter_pfm_xy
-#define IMAGETYPE PfmFile
-#define ASIZE get_x_size
-#define BSIZE get_y_size
-#define GETVAL(a, b, channel) get_channel(a, b, channel)
-#define SETVAL(a, b, channel, v) set_channel(a, b, channel, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
-
-#define FUNCTION_NAME filter_pfm_yx
-#define IMAGETYPE PfmFile
-#define ASIZE get_y_size
-#define BSIZE get_x_size
-#define GETVAL(a, b, channel) get_channel(b, a, channel)
-#define SETVAL(a, b, channel, v) set_channel(b, a, channel, v)
-#include "pnm-image-filter-core.cxx"
-#undef SETVAL
-#undef GETVAL
-#undef BSIZE
-#undef ASIZE
-#undef IMAGETYPE
-#undef FUNCTION_NAME
+static void
+load_pfm_row(float *row, const void *image, int y, int num_channels) {
+  const PfmFile &source = *(const PfmFile *)image;
+  int x_size = source.get_x_size();
+  for (int x = 0; x < x_size; ++x) {
+    for (int c = 0; c < num_channels; ++c) {
+      row[c] = source.get_channel(x, y, c);
+    }
+    row += num_channels;
+  }
+}
 
+static void
+store_pfm_row(void *image, int x, int y, const float *row,
+              int num_pixels, int num_channels) {
+  PfmFile &dest = *(PfmFile *)image;
+  for (int i = 0; i < num_pixels; ++i) {
+    for (int c = 0; c < num_channels; ++c) {
+      dest.set_channel(x + i, y, c, row[c]);
+    }
+    row += num_channels;
+  }
+}
 
 #define FUNCTION_NAME filter_pfm_sparse_xy
 #define IMAGETYPE PfmFile
@@ -630,17 +930,22 @@ filter_image(PfmFile &dest, const PfmFile &source,
       }
     }
   } else {
-    // We can use the slightly faster fully-specified variant.
-    if (dest.get_x_size() <= dest.get_y_size()) {
-      for (int ci = 0; ci < num_channels; ++ci) {
-        filter_pfm_xy(dest, source, width, make_filter, ci);
-      }
-
-    } else {
-      for (int ci = 0; ci < num_channels; ++ci) {
-        filter_pfm_yx(dest, source, width, make_filter, ci);
-      }
+    // We can use the faster fully-specified variant, which filters all of
+    // the channels at once.
+    if (!dest.is_valid() || !source.is_valid()) {
+      return;
     }
+
+    FilterJob job;
+    job._load_row = &load_pfm_row;
+    job._store_row = &store_pfm_row;
+    job._num_channels = num_channels;
+    job._source = &source;
+    job._dest = &dest;
+    job._source_x_size = source.get_x_size();
+    job._x_axis.compute(dest.get_x_size(), source.get_x_size(), width, make_filter);
+    job._y_axis.compute(dest.get_y_size(), source.get_y_size(), width, make_filter);
+    run_filter_job(job);
   }
 }
 
@@ -666,80 +971,23 @@ gaussian_filter_from(float width, const PfmFile &copy) {
   filter_image(*this, copy, width, &gaussian_filter_impl);
 }
 
-// The following functions are support for quick_box_filter().
-
-static INLINE void
-box_filter_xel(const PNMImage &img,
-               int x, int y, float x_contrib, float y_contrib,
-               LColorf &color, float &pixel_count) {
-
-  float contrib = x_contrib * y_contrib;
-  color += img.get_xel_a(x, y) * contrib;
-  pixel_count += contrib;
-}
-
-static INLINE void
-box_filter_line(const PNMImage &image,
-                float x0, int y, float x1, float y_contrib,
-                LColorf &color, float &pixel_count) {
-  int x = (int)x0;
-  // Get the first (partial) xel
-  box_filter_xel(image, x, y, (float)(x+1)-x0, y_contrib,
-                 color, pixel_count);
-
-  int x_last = (int)x1;
-  if (x < x_last) {
-    x++;
-    while (x < x_last) {
-      // Get each consecutive (complete) xel
-      box_filter_xel(image, x, y, 1.0f, y_contrib,
-                     color, pixel_count);
-      x++;
-    }
-
-    // Get the final (partial) xel
-    float x_contrib = x1 - (float)x_last;
-    if (x_contrib > 0.0001f && x < image.get_x_size()) {
-      box_filter_xel(image, x, y, x_contrib, y_contrib,
-                     color, pixel_count);
-    }
-  }
+/**
+ * Makes a resized copy of the indicated image into this one using a Lanczos
+ * filter with the indicated number of lobes on either side, usually 2 or 3.
+ */
+void PfmFile::
+lanczos_filter_from(float radius, const PfmFile &copy) {
+  filter_image(*this, copy, radius, &lanczos_filter_impl);
 }
 
-static LColorf
-box_filter_region(const PNMImage &image,
-                  float x0, float y0, float x1, float y1) {
-  LColorf color = LColorf::zero();
-  float pixel_count = 0.0f;
-
-  assert(y0 >= 0 && y1 >= 0);
-
-  int y = (int)y0;
-  // Get the first (partial) row
-  box_filter_line(image, x0, y, x1, (float)(y+1)-y0,
-                  color, pixel_count);
-
-  int y_last = (int)y1;
-  if (y < y_last) {
-    y++;
-    while (y < y_last) {
-      // Get each consecutive (complete) row
-      box_filter_line(image, x0, y, x1, 1.0f,
-                      color, pixel_count);
-      y++;
-    }
-
-    // Get the final (partial) row
-    float y_contrib = y1 - (float)y_last;
-    if (y_contrib > 0.0001f && y < image.get_y_size()) {
-      box_filter_line(image, x0, y, x1, y_contrib,
-                      color, pixel_count);
-    }
-  }
-
-  // cerr << pixel_count << "\n";
-  color /= pixel_count;
-  return color;
+/**
+ * Makes a resized copy of the indicated image into this one using the cubic
+ * filter of Mitchell and Netravali (with B = C = 1/3).  Its natural radius is
+ * 2.
+ */
+void PfmFile::
+mitchell_filter_from(float radius, const PfmFile &copy) {
+  filter_image(*this, copy, radius, &mitchell_filter_impl);
 }
 
 /**
@@ -761,36 +1009,24 @@ quick_filter_from(const PNMImage &from, int xborder, int yborder) {
   int to_xoff = xborder / 2;
   int to_yoff = yborder / 2;
 
-  float from_x0, from_x1, from_y0, from_y1;
-  int to_x, to_y;
-
   float x_scale = (float)from_xs / (float)to_xs;
   float y_scale = (float)from_ys / (float)to_ys;
 
-  LColorf color;
-
-  from_y0 = max(0, -to_yoff) * y_scale;
-  for (to_y = max(0, -to_yoff);
-       to_y < min(to_ys, get_y_size()-to_yoff);
-       to_y++) {
-    from_y1 = (to_y+1) * y_scale;
-
-    from_x0 = max(0, -to_xoff) * x_scale;
-    for (to_x = max(0, -to_xoff);
-         to_x < min(to_xs, get_x_size()-to_xoff);
-         to_x++) {
-      from_x1 = (to_x+1) * x_scale;
-
-      // Now the box from (from_x0, from_y0) - (from_x1, from_y1) but not
-      // including (from_x1, from_y1) maps to the pixel (to_x, to_y).
-      color = box_filter_region(from,
-                                from_x0, from_y0, from_x1, from_y1);
-
-      set_xel_a(to_xoff + to_x, to_yoff + to_y, color);
-
-      from_x0 = from_x1;
-    }
-    from_y0 = from_y1;
-    Thread::consider_yield();
-  }
+  // Each destination pixel averages the source pixels it covers.  That is a
+  // box filter, which is separable like the others; the X and Y coverage
+  // weights are simply multiplied.
+  FilterJob job;
+  job._load_row = &load_pnm_rgba_row;
+  job._store_row = &store_pnm_rgba_row;
+  job._num_channels = 4;
+  job._source = &from;
+  job._dest = this;
+  job._source_x_size = from_xs;
+  job._x_axis.compute_box(max(0, -to_xoff), min(to_xs, get_x_size() - to_xoff),
+                          from_xs, x_scale);
+  job._y_axis.compute_box(max(0, -to_yoff), min(to_ys, get_y_size() - to_yoff),
+                          from_ys, y_scale);
+  job._x_axis._dest_offset += to_xoff;
+  job._y_axis._dest_offset += to_yoff;
+  run_filter_job(job);
 }
@@ -12,6 +12,7 @@
  */
 
 #include "pnmReader.h"
+#include "pnmImage.h"
 #include "virtualFileSystem.h"
 #include "thread.h"
 
@@ -46,6 +47,7 @@ prepare_read() {
     return;
   }
 
+  _row_index = 0;
   _x_shift = 0;
   _y_shift = 0;
   _orig_x_size = _x_size;
@@ -92,17 +94,111 @@ read_pfm(PfmFile &pfm) {
  */
 int PNMReader::
 read_data(xel *array, xelval *alpha) {
+  if (!supports_read_row()) {
+    // A derived class that can't read rows must override this method.
+    return 0;
+  }
+
+  return read_rows(array, alpha, _y_size);
+}
+
+/**
+ * Returns true if this particular PNMReader is capable of returning the data
+ * one row at a time, via repeated calls to read_row().  Returns false if the
+ * only way to read from this file is all at once, via read_data().
+ */
+bool PNMReader::
+supports_read_row() const {
+  return false;
+}
+
+/**
+ * If supports_read_row(), above, returns true, this function may be called
+ * repeatedly to read the image, one horizontal row at a time, beginning from
+ * the top.  Returns true if the row is successfully read, false if there is
+ * an error or end of file.
+ *
+ * The x_size and y_size parameters are the value of _x_size and _y_size as
+ * originally filled in by the constructor; it is the actual number of pixels
+ * in the image.  (The _x_size and _y_size members may have been automatically
+ * modified by the time this method is called if we are scaling on load, so
+ * should not be used.)
+ */
+bool PNMReader::
+read_row(xel *, xelval *, int, int) {
+  return false;
+}
+
+
+/**
+ * Returns true if this particular PNMReader can read from a general stream
+ * (including pipes, etc.), or false if the reader must occasionally fseek()
+ * on its input stream, and thus only disk streams are supported.
+ */
+bool PNMReader::
+supports_stream_read() const {
+  return false;
+}
+
+/**
+ * Reads the next num_rows rows of the image into the indicated array and
+ * alpha pointers, which must have room for num_rows * _x_size pixels, and
+ * returns the number of rows actually read.  This returns fewer rows at the
+ * end of the image, and 0 if there are no more rows or on error.
+ *
+ * Call prepare_read() first.  This allows a huge image to be processed a
+ * strip at a time, without ever holding the whole image in memory.  That is
+ * only true if the reader supports_read_row(), though; otherwise the whole
+ * image is read into a temporary buffer by the first call and handed out
+ * from there.
+ */
+int PNMReader::
+read_rows(xel *array, xelval *alpha, int num_rows) {
   if (!is_valid()) {
     return 0;
   }
 
+  num_rows = std::min(num_rows, _y_size - _row_index);
+  if (num_rows <= 0) {
+    return 0;
+  }
+
+  if (!supports_read_row()) {
+    if (_row_index == 0 && _buffer_array.empty()) {
+      _buffer_array.resize((size_t)_x_size * _y_size);
+      if (has_alpha()) {
+        _buffer_alpha.resize((size_t)_x_size * _y_size);
+      }
+      _buffer_rows = read_data(&_buffer_array[0],
+                               has_alpha() ? &_buffer_alpha[0] : nullptr);
+    }
+
+    num_rows = std::max(std::min(num_rows, _buffer_rows - _row_index), 0);
+    size_t start = (size_t)_row_index * _x_size;
+    size_t count = (size_t)num_rows * _x_size;
+    if (count != 0) {
+      memcpy(array, &_buffer_array[start], count * sizeof(xel));
+      if (has_alpha()) {
+        memcpy(alpha, &_buffer_alpha[start], count * sizeof(xelval));
+      }
+    }
+    _row_index += num_rows;
+
+    if (_row_index >= _buffer_rows) {
+      // Don't hold on to the image any longer than we need to.
+      pvector<xel>().swap(_buffer_array);
+      pvector<xelval>().swap(_buffer_alpha);
+    }
+    return num_rows;
+  }
+
+  int y;
   if (_x_shift == 0 && _y_shift == 0) {
     // Read with no reduction.
-    int y;
-    for (y = 0; y < _y_size; ++y) {
+    for (y = 0; y < num_rows; ++y) {
       if (!read_row(array + y * _x_size, alpha + y * _x_size, _x_size, _y_size)) {
         Thread::consider_yield();
-        return y;
+        break;
       }
     }
 
@@ -114,34 +210,34 @@ read_data(xel *array, xelval *alpha) {
 
     // We need a temporary buffer, at least one row wide, with full-width
     // integers, for accumulating pixel data.
-    int *accum_row_array = (int *)alloca(_orig_x_size * sizeof(int) * 3);
-    int *accum_row_alpha = (int *)alloca(_orig_x_size * sizeof(int));
+    pvector<int> accum_row_array(_x_size * 3);
+    pvector<int> accum_row_alpha(_x_size);
 
     // Each time we read a row, we will actually read the full row here,
     // before we filter it down into the above.
-    xel *orig_row_array = (xel *)alloca(_orig_x_size * sizeof(xel));
-    xelval *orig_row_alpha = (xelval *)alloca(_orig_x_size * sizeof(xelval));
+    pvector<xel> orig_row_array(_orig_x_size);
+    pvector<xelval> orig_row_alpha(_orig_x_size);
 
-    int y;
-    for (y = 0; y < _y_size; ++y) {
+    for (y = 0; y < num_rows; ++y) {
       // Zero out the accumulation data, in preparation for holding the
       // results of the below.
-      memset(accum_row_array, 0, _x_size * sizeof(int) * 3);
+      std::fill(accum_row_array.begin(), accum_row_array.end(), 0);
       if (has_alpha()) {
-        memset(accum_row_alpha, 0, _x_size * sizeof(int));
+        std::fill(accum_row_alpha.begin(), accum_row_alpha.end(), 0);
       }
 
-      for (int yi = 0; yi < y_reduction; ++yi) {
+      int yi;
+      for (yi = 0; yi < y_reduction; ++yi) {
         // OK, read a row.  This reads the original, full-size row.
-        if (!read_row(orig_row_array, orig_row_alpha, _orig_x_size, _orig_y_size)) {
+        if (!read_row(&orig_row_array[0], &orig_row_alpha[0], _orig_x_size, _orig_y_size)) {
           Thread::consider_yield();
-          return y;
+          break;
         }
 
         // Boil that row down to its proper, reduced size, and accumulate it
         // into the target row.
-        xel *p = orig_row_array;
-        int *q = accum_row_array;
+        const xel *p = &orig_row_array[0];
+        int *q = &accum_row_array[0];
         int *qstop = q + _x_size * 3;
         while (q < qstop) {
           for (int xi = 0; xi < x_reduction; ++xi) {
@@ -154,8 +250,8 @@ read_data(xel *array, xelval *alpha) {
         }
         if (has_alpha()) {
           // Now do it again for the alpha channel.
-          xelval *p = orig_row_alpha;
-          int *q = accum_row_alpha;
+          const xelval *p = &orig_row_alpha[0];
+          int *q = &accum_row_alpha[0];
           int *qstop = q + _x_size;
           while (q < qstop) {
             for (int xi = 0; xi < x_reduction; ++xi) {
@@ -166,12 +262,15 @@ read_data(xel *array, xelval *alpha) {
           }
         }
       }
+      if (yi < y_reduction) {
+        break;
+      }
 
       // OK, now copy the accumulated pixel data into the final result.
       xel *target_row_array = array + y * _x_size;
       xelval *target_row_alpha = alpha + y * _x_size;
 
-      int *p = accum_row_array;
+      const int *p = &accum_row_array[0];
       xel *q = target_row_array;
       xel *qstop = q + _x_size;
       while (q < qstop) {
@@ -182,7 +281,7 @@ read_data(xel *array, xelval *alpha) {
       }
 
       if (has_alpha()) {
-        int *p = accum_row_alpha;
+        const int *p = &accum_row_alpha[0];
         xelval *q = target_row_alpha;
         xelval *qstop = q + _x_size;
         while (q < qstop) {
@@ -193,47 +292,55 @@ read_data(xel *array, xelval *alpha) {
     }
   }
 
-
-  return _y_size;
+  _row_index += y;
+  return y;
 }
 
-
 /**
- * Returns true if this particular PNMReader is capable of returning the data
- * one row at a time, via repeated calls to read_row().  Returns false if the
- * only way to read from this file is all at once, via read_data().
- */
-bool PNMReader::
-supports_read_row() const {
-  return false;
-}
-
-/**
- * If supports_read_row(), above, returns true, this function may be called
- * repeatedly to read the image, one horizontal row at a time, beginning from
- * the top.  Returns true if the row is successfully read, false if there is
- * an error or end of file.
+ * Reads the next strip of up to max_rows rows of the image into the
+ * indicated PNMImage, which is resized to _x_size by the number of rows
+ * read.  Returns true if any rows were read, or false at the end of the
+ * image or on error.
  *
- * The x_size and y_size parameters are the value of _x_size and _y_size as
- * originally filled in by the constructor; it is the actual number of pixels
- * in the image.  (The _x_size and _y_size members may have been automatically
- * modified by the time this method is called if we are scaling on load, so
- * should not be used.)
+ * This is a convenient way to process a huge image in bounded memory:
+ *
+ *   reader->prepare_read();
+ *   PNMImage strip;
+ *   while (reader->read_strip(strip, 64)) { ... }
+ *
+ * See read_rows().
  */
 bool PNMReader::
-read_row(xel *, xelval *, int, int) {
-  return false;
-}
+read_strip(PNMImage &strip, int max_rows) {
+  int num_rows = std::min(max_rows, _y_size - _row_index);
+  if (!is_valid() || num_rows <= 0) {
+    strip.clear();
+    return false;
+  }
 
+  ColorSpace color_space = (_color_space != CS_unspecified) ? _color_space : CS_linear;
+  if (strip.get_x_size() != _x_size || strip.get_y_size() != num_rows ||
+      strip.get_num_channels() != _num_channels ||
+      strip.get_maxval() != _maxval ||
+      strip.get_color_space() != color_space) {
+    // Only reallocate the strip when its shape changes, which is usually
+    // just the first and last time.
+    strip.clear(_x_size, num_rows, _num_channels, _maxval, _type, color_space);
+  }
 
-/**
- * Returns true if this particular PNMReader can read from a general stream
- * (including pipes, etc.), or false if the reader must occasionally fseek()
- * on its input stream, and thus only disk streams are supported.
- */
-bool PNMReader::
-supports_stream_read() const {
-  return false;
+  int rows_read = read_rows(strip.get_array(), strip.get_alpha_array(), num_rows);
+  if (rows_read == 0) {
+    strip.clear();
+    return false;
+  }
+
+  if (rows_read < num_rows) {
+    // The file was truncated.  Keep just the rows we got.
+    PNMImage part(_x_size, rows_read, _num_channels, _maxval, _type, color_space);
+    part.copy_sub_image(strip, 0, 0, 0, 0, _x_size, rows_read);
+    strip.take_from(part);
+  }
+  return true;
 }
 
 /**
@@ -18,6 +18,7 @@
 
 #include "pnmImageHeader.h"
 class PfmFile;
+class PNMImage;
 
 /**
  * This is an abstract base class that defines the interface for reading image
@@ -43,6 +44,10 @@ public:
 
   virtual bool supports_stream_read() const;
 
+  int read_rows(xel *array, xelval *alpha, int num_rows);
+  bool read_strip(PNMImage &strip, int max_rows);
+  INLINE int get_row_index() const;
+
   INLINE bool is_valid() const;
 
 private:
@@ -59,6 +64,16 @@ protected:
 
   int _x_shift, _y_shift;
   int _orig_x_size, _orig_y_size;
+
+private:
+  // The number of rows already returned by read_rows().
+  int _row_index;
+
+  // Used by read_rows() to hold the entire image when the reader can't read
+  // it one row at a time.
+  pvector<xel> _buffer_array;
+  pvector<xelval> _buffer_alpha;
+  int _buffer_rows;
 };
 
 #include "pnmReader.I"
@@ -12,6 +12,7 @@
  */
 
 #include "pnmWriter.h"
+#include "pnmImage.h"
 #include "thread.h"
 
 /**
@@ -153,3 +154,114 @@ bool PNMWriter::
 supports_stream_write() const {
   return false;
 }
+
+/**
+ * Writes the next num_rows rows of the image from the indicated array and
+ * alpha pointers, which hold num_rows * _x_size pixels, and returns the
+ * number of rows actually written, which is less than num_rows on error.
+ * The header is written by the first call.
+ *
+ * As with write_header(), fill in the header data before the first call.
+ * Delete the writer after the last row has been written, to be sure all the
+ * data gets flushed.
+ *
+ * This allows a huge image to be written a strip at a time, without ever
+ * holding the whole image in memory.  That is only true if the writer
+ * supports_write_row(), though; otherwise the rows are collected in a
+ * temporary buffer, and written all at once when the last row is received.
+ */
+int PNMWriter::
+write_rows(xel *array, xelval *alpha, int num_rows) {
+  if (!is_valid()) {
+    return 0;
+  }
+
+  num_rows = std::min(num_rows, _y_size - _row_index);
+  if (num_rows <= 0) {
+    return 0;
+  }
+
+  if (!supports_write_row()) {
+    if (_row_index == 0) {
+      _buffer_array.resize((size_t)_x_size * _y_size);
+      if (has_alpha()) {
+        _buffer_alpha.resize((size_t)_x_size * _y_size);
+      }
+    }
+
+    size_t start = (size_t)_row_index * _x_size;
+    size_t count = (size_t)num_rows * _x_size;
+    memcpy(&_buffer_array[start], array, count * sizeof(xel));
+    if (has_alpha()) {
+      memcpy(&_buffer_alpha[start], alpha, count * sizeof(xelval));
+    }
+    _row_index += num_rows;
+
+    if (_row_index == _y_size) {
+      int result = write_data(&_buffer_array[0],
+                              has_alpha() ? &_buffer_alpha[0] : nullptr);
+      pvector<xel>().swap(_buffer_array);
+      pvector<xelval>().swap(_buffer_alpha);
+      if (result != _y_size) {
+        return 0;
+      }
+    }
+    return num_rows;
+  }
+
+  if (_row_index == 0) {
+    if (!write_header()) {
+      return 0;
+    }
+  }
+
+  int y;
+  for (y = 0; y < num_rows; ++y) {
+    if (!write_row(array + y * _x_size, alpha + y * _x_size)) {
+      Thread::consider_yield();
+      break;
+    }
+  }
+
+  _row_index += y;
+  return y;
+}
+
+/**
+ * Writes all of the rows of the indicated PNMImage as the next strip of the
+ * image.  The strip must be _x_size pixels wide; it is converted to this
+ * writer's maxval and number of channels if necessary.  Returns true on
+ * success, false on failure.
+ *
+ * See write_rows().
+ */
+bool PNMWriter::
+write_strip(const PNMImage &strip) {
+  nassertr(strip.get_x_size() == _x_size, false);
+  if (!strip.is_valid()) {
+    return false;
+  }
+
+  const PNMImage *source = &strip;
+  PNMImage converted;
+  if (strip.get_maxval() != _maxval ||
+      strip.get_num_channels() != _num_channels ||
+      (is_grayscale() && !supports_grayscale())) {
+    converted = strip;
+    converted.set_maxval(_maxval);
+    converted.set_num_channels(_num_channels);
+    if (is_grayscale() && !supports_grayscale()) {
+      // Copy the gray values to all channels to help out the writer.
+      for (int y = 0; y < converted.get_y_size(); y++) {
+        for (int x = 0; x < converted.get_x_size(); x++) {
+          converted.set_xel_val(x, y, converted.get_gray_val(x, y));
+        }
+      }
+    }
+    source = &converted;
+  }
+
+  int num_rows = source->get_y_size();
+  return write_rows((xel *)source->get_array(), (xelval *)source->get_alpha_array(),
+                    num_rows) == num_rows;
+}
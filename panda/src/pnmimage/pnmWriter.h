@@ -18,6 +18,7 @@
 
 #include "pnmImageHeader.h"
 class PfmFile;
+class PNMImage;
 
 /**
  * This is an abstract base class that defines the interface for writing image
@@ -57,6 +58,10 @@ public:
 
   virtual bool supports_stream_write() const;
 
+  int write_rows(xel *array, xelval *alpha, int num_rows);
+  bool write_strip(const PNMImage &strip);
+  INLINE int get_row_index() const;
+
   INLINE bool is_valid() const;
 
 protected:
@@ -64,6 +69,15 @@ protected:
   bool _owns_file;
   std::ostream *_file;
   bool _is_valid;
+
+private:
+  // The number of rows already passed to write_rows().
+  int _row_index;
+
+  // Used by write_rows() to collect the entire image when the writer can't
+  // write it one row at a time.
+  pvector<xel> _buffer_array;
+  pvector<xelval> _buffer_alpha;
 };
 
 #include "pnmWriter.I"
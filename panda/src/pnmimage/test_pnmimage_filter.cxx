@@ -0,0 +1,90 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_pnmimage_filter.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "pnmImage.h"
+#include "trueClock.h"
+#include "config_pnmimage.h"
+
+#include <stdlib.h>
+
+// A benchmark for the PNMImage resampling filters.  Usage:
+//
+//   test_pnmimage_filter [x_size y_size [num_channels [iterations]]]
+//
+// Set pnm-filter-num-threads to compare different numbers of threads.
+
+typedef void (PNMImage::*FilterMethod)(float radius, const PNMImage &copy);
+
+static void
+time_filter(const char *name, FilterMethod method, float radius,
+            PNMImage &dest, const PNMImage &source, int iterations) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double best = 1.0e30;
+  for (int i = 0; i < iterations; ++i) {
+    double start = clock->get_short_time();
+    (dest.*method)(radius, source);
+    best = std::min(best, clock->get_short_time() - start);
+  }
+  double mpixels = (double)source.get_x_size() * source.get_y_size() / 1.0e6;
+  nout << "  " << name << ": " << best * 1000.0 << " ms, "
+       << mpixels / best << " Mpixels/s\n";
+}
+
+static void
+time_quick_filter(PNMImage &dest, const PNMImage &source, int iterations) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double best = 1.0e30;
+  for (int i = 0; i < iterations; ++i) {
+    double start = clock->get_short_time();
+    dest.quick_filter_from(source);
+    best = std::min(best, clock->get_short_time() - start);
+  }
+  double mpixels = (double)source.get_x_size() * source.get_y_size() / 1.0e6;
+  nout << "  quick: " << best * 1000.0 << " ms, "
+       << mpixels / best << " Mpixels/s\n";
+}
+
+int
+main(int argc, char *argv[]) {
+  int x_size = (argc > 2) ? atoi(argv[1]) : 2048;
+  int y_size = (argc > 2) ? atoi(argv[2]) : 2048;
+  int num_channels = (argc > 3) ? atoi(argv[3]) : 4;
+  int iterations = (argc > 4) ? atoi(argv[4]) : 3;
+
+  PNMImage source(x_size, y_size, num_channels);
+  for (int y = 0; y < y_size; ++y) {
+    for (int x = 0; x < x_size; ++x) {
+      source.set_xel_val(x, y, x & 0xff, y & 0xff, (x ^ y) & 0xff);
+      if (source.has_alpha()) {
+        source.set_alpha_val(x, y, (x + y) & 0xff);
+      }
+    }
+  }
+
+  nout << "Filtering " << x_size << "x" << y_size << "x" << num_channels
+       << " with " << pnm_filter_num_threads << " threads\n";
+
+  static const float scales[] = { 0.5f, 0.3f, 2.0f };
+  for (float scale : scales) {
+    PNMImage dest((int)(x_size * scale), (int)(y_size * scale), num_channels);
+    nout << "to " << dest.get_x_size() << "x" << dest.get_y_size() << ":\n";
+    time_filter("box", &PNMImage::box_filter_from, 1.0f, dest, source, iterations);
+    time_filter("gaussian", &PNMImage::gaussian_filter_from, 1.0f, dest, source, iterations);
+    time_filter("lanczos", &PNMImage::lanczos_filter_from, 3.0f, dest, source, iterations);
+    time_filter("mitchell", &PNMImage::mitchell_filter_from, 2.0f, dest, source, iterations);
+    time_quick_filter(dest, source, iterations);
+  }
+
+  return 0;
+}
@@ -34,7 +34,7 @@ TypeHandle PNMFileTypePNG::_type_handle;
 
 static const int png_max_palette = 256;
 
-// This STL comparison functor is used in write_data(), below.  It sorts the
+// This STL comparison functor is used in setup_png(), below.  It sorts the
 // non-maxval alpha pixels to the front of the list.
 class LowAlphaCompare {
 public:
@@ -168,6 +168,8 @@ Reader(PNMFileType *type, istream *file, bool owns_file, string magic_number) :
 {
   _png = nullptr;
   _info = nullptr;
+  _interlaced = false;
+  _rows_read = 0;
   _is_valid = false;
 
   _png = png_create_read_struct(PNG_LIBPNG_VER_STRING, nullptr,
@@ -204,8 +206,11 @@ Reader(PNMFileType *type, istream *file, bool owns_file, string magic_number) :
   int srgb_intent;
   double gamma;
 
+  int interlace_type;
+
   png_get_IHDR(_png, _info, &width, &height,
-               &bit_depth, &color_type, nullptr, nullptr, nullptr);
+               &bit_depth, &color_type, &interlace_type, nullptr, nullptr);
+  _interlaced = (interlace_type != PNG_INTERLACE_NONE);
 
   // Look for an sRGB chunk.
   if (png_get_sRGB(_png, _info, &srgb_intent) == PNG_INFO_sRGB) {
@@ -325,6 +330,12 @@ read_data(xel *array, xelval *alpha_data) {
     return 0;
   }
 
+  if (supports_read_row()) {
+    // Reading it one row at a time doesn't need a second copy of the image,
+    // and lets us reduce it on the fly if a read size was requested.
+    return PNMReader::read_data(array, alpha_data);
+  }
+
   if (setjmp(_jmpbuf)) {
     // This is the ANSI C way to handle exceptions.  If setjmp(), above,
     // returns true, it means that libpng detected an exception while
@@ -347,9 +358,8 @@ read_data(xel *array, xelval *alpha_data) {
   }
 
   // We need to read a full copy of the image in first, in libpng's 2-d array
-  // format, mainly because we keep array and alpha data separately, and there
-  // doesn't appear to be good support to get this stuff out row-at-a-time for
-  // interlaced files.
+  // format, because there doesn't appear to be good support to get this stuff
+  // out row-at-a-time for interlaced files.
   png_bytep *rows = (png_bytep *)alloca(num_rows * sizeof(png_bytep));
   int yi;
 
@@ -360,67 +370,116 @@ read_data(xel *array, xelval *alpha_data) {
 
   png_read_image(_png, rows);
 
+  for (yi = 0; yi < num_rows; yi++) {
+    decode_row(array + yi * _x_size, alpha_data + yi * _x_size, rows[yi], _x_size);
+  }
+
+  png_read_end(_png, nullptr);
+  PANDA_FREE_ARRAY(alloc);
+
+  return _y_size;
+}
+
+/**
+ * Returns true if this particular PNMReader is capable of returning the data
+ * one row at a time, via repeated calls to read_row().  Returns false if the
+ * only way to read from this file is all at once, via read_data().
+ */
+bool PNMFileTypePNG::Reader::
+supports_read_row() const {
+  return !_interlaced;
+}
+
+/**
+ * If supports_read_row(), above, returns true, this function may be called
+ * repeatedly to read the image, one horizontal row at a time, beginning from
+ * the top.  Returns true if the row is successfully read, false if there is
+ * an error or end of file.
+ */
+bool PNMFileTypePNG::Reader::
+read_row(xel *array, xelval *alpha_data, int x_size, int y_size) {
+  if (!is_valid() || _rows_read >= y_size) {
+    return false;
+  }
+
+  if (setjmp(_jmpbuf)) {
+    // libpng detected an exception while reading the row, below.
+    free_png();
+    return false;
+  }
+
+  size_t row_byte_length = (size_t)x_size * _num_channels;
+  if (_maxval > 255) {
+    row_byte_length *= 2;
+  }
+  _row.resize(row_byte_length);
+
+  png_read_row(_png, &_row[0], nullptr);
+  decode_row(array, alpha_data, &_row[0], x_size);
+
+  ++_rows_read;
+  if (_rows_read == y_size) {
+    png_read_end(_png, nullptr);
+  }
+  return true;
+}
+
+/**
+ * Converts one row of pixels from libpng's interleaved format into the
+ * indicated array and alpha pointers.
+ */
+void PNMFileTypePNG::Reader::
+decode_row(xel *array, xelval *alpha_data, const png_byte *source,
+           int x_size) const {
   bool get_color = !is_grayscale();
   bool get_alpha = has_alpha();
 
-  int pi = 0;
-  for (yi = 0; yi < num_rows; yi++) {
-    png_bytep source = rows[yi];
-    for (int xi = 0; xi < _x_size; xi++) {
-      int red = 0;
-      int green = 0;
-      int blue = 0;
-      int alpha = 0;
-
-      if (_maxval > 255) {
-        if (get_color) {
-          red = (source[0] << 8) | source[1];
-          source += 2;
-
-          green = (source[0] << 8) | source[1];
-          source += 2;
-        }
+  for (int xi = 0; xi < x_size; xi++) {
+    int red = 0;
+    int green = 0;
+    int blue = 0;
+    int alpha = 0;
 
-        blue = (source[0] << 8) | source[1];
+    if (_maxval > 255) {
+      if (get_color) {
+        red = (source[0] << 8) | source[1];
         source += 2;
 
-        if (get_alpha) {
-          alpha = (source[0] << 8) | source[1];
-          source += 2;
-        }
+        green = (source[0] << 8) | source[1];
+        source += 2;
+      }
 
-      } else {
-        if (get_color) {
-          red = *source;
-          source++;
+      blue = (source[0] << 8) | source[1];
+      source += 2;
 
-          green = *source;
-          source++;
-        }
+      if (get_alpha) {
+        alpha = (source[0] << 8) | source[1];
+        source += 2;
+      }
 
-        blue = *source;
+    } else {
+      if (get_color) {
+        red = *source;
         source++;
 
-        if (get_alpha) {
-          alpha = *source;
-          source++;
-        }
+        green = *source;
+        source++;
       }
 
-      PPM_ASSIGN(array[pi], red, green, blue);
+      blue = *source;
+      source++;
+
       if (get_alpha) {
-        alpha_data[pi] = alpha;
+        alpha = *source;
+        source++;
       }
-      pi++;
     }
 
-    nassertr(source <= rows[yi] + row_byte_length, yi);
+    PPM_ASSIGN(array[xi], red, green, blue);
+    if (get_alpha) {
+      alpha_data[xi] = alpha;
+    }
   }
-
-  png_read_end(_png, nullptr);
-  PANDA_FREE_ARRAY(alloc);
-
-  return _y_size;
 }
 
 /**
@@ -491,6 +550,10 @@ Writer(PNMFileType *type, ostream *file, bool owns_file) :
 {
   _png = nullptr;
   _info = nullptr;
+  _png_bit_depth = 8;
+  _color_type = 0;
+  _val_scale = 1.0;
+  _rows_written = 0;
   _is_valid = false;
 
   _png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr,
@@ -539,6 +602,92 @@ write_data(xel *array, xelval *alpha_data) {
     return 0;
   }
 
+  // Since we have the whole image, we can see whether it would be smaller as
+  // a palette image.
+  setup_png(array, alpha_data);
+
+  for (int yi = 0; yi < _y_size; yi++) {
+    encode_row(&_row[0], array + yi * _x_size, alpha_data + yi * _x_size);
+    png_write_row(_png, &_row[0]);
+    Thread::consider_yield();
+  }
+
+  png_write_end(_png, nullptr);
+
+  return _y_size;
+}
+
+/**
+ * Returns true if this particular PNMWriter supports a streaming interface to
+ * writing the data: that is, it is capable of writing the image one row at a
+ * time, via repeated calls to write_row().  Returns false if the only way to
+ * write from this file is all at once, via write_data().
+ */
+bool PNMFileTypePNG::Writer::
+supports_write_row() const {
+  return true;
+}
+
+/**
+ * If supports_write_row(), above, returns true, this function may be called
+ * to write out the image header in preparation to writing out the image data
+ * one row at a time.  Returns true if the header is successfully written,
+ * false if there is an error.
+ *
+ * Since the image data isn't known yet, an image written this way is never
+ * made into a palette image.
+ */
+bool PNMFileTypePNG::Writer::
+write_header() {
+  if (!is_valid()) {
+    return false;
+  }
+
+  if (setjmp(_jmpbuf)) {
+    // libpng detected an exception while writing the header.
+    free_png();
+    return false;
+  }
+
+  setup_png(nullptr, nullptr);
+  return true;
+}
+
+/**
+ * If supports_write_row(), above, returns true, this function may be called
+ * repeatedly to write the image, one horizontal row at a time, beginning from
+ * the top.  Returns true if the row is successfully written, false if there
+ * is an error.
+ */
+bool PNMFileTypePNG::Writer::
+write_row(xel *array, xelval *alpha_data) {
+  if (!is_valid() || _rows_written >= _y_size) {
+    return false;
+  }
+
+  if (setjmp(_jmpbuf)) {
+    // libpng detected an exception while writing the row.
+    free_png();
+    return false;
+  }
+
+  encode_row(&_row[0], array, alpha_data);
+  png_write_row(_png, &_row[0]);
+
+  ++_rows_written;
+  if (_rows_written == _y_size) {
+    png_write_end(_png, nullptr);
+  }
+  return true;
+}
+
+/**
+ * Writes the PNG header and sets up the transformations for encode_row().  If
+ * the image data is given, it is examined to see whether a palette image
+ * would be smaller.  libpng errors longjmp to the caller's _jmpbuf.
+ */
+void PNMFileTypePNG::Writer::
+setup_png(xel *array, xelval *alpha_data) {
   png_set_write_fn(_png, (void *)this, png_write_data, png_flush_data);
 
   // The compression level corresponds directly to the compression levels for
@@ -571,11 +720,16 @@ write_data(xel *array, xelval *alpha_data) {
   // coloralpha combinations for a color image, and the resulting bitdepth
   // should be smaller than what we would have otherwise.
   Palette palette;
-  HistMap palette_lookup;
+  _palette_lookup.clear();
   png_color png_palette_table[png_max_palette];
   png_byte png_trans[png_max_palette];
 
-  if (png_palette) {
+  if (array == nullptr) {
+    if (pnmimage_png_cat.is_debug()) {
+      pnmimage_png_cat.debug()
+        << "writing one row at a time; not making a palette image.\n";
+    }
+  } else if (png_palette) {
     if (png_bit_depth <= 8) {
       if (compute_palette(palette, array, alpha_data, png_max_palette)) {
         if (pnmimage_png_cat.is_debug()) {
@@ -622,7 +776,7 @@ write_data(xel *array, xelval *alpha_data) {
 
             // Also build a reverse-lookup from color to palette index in the
             // "histogram" structure.
-            palette_lookup[palette[i]] = i;
+            _palette_lookup[palette[i]] = i;
           }
 
           png_set_PLTE(_png, _info, png_palette_table, palette.size());
@@ -694,25 +848,26 @@ write_data(xel *array, xelval *alpha_data) {
     png_set_packing(_png);
   }
 
-  double val_scale = 1.0;
+  _val_scale = 1.0;
 
   if (color_type != PNG_COLOR_TYPE_PALETTE) {
     if (png_bit_depth != true_bit_depth) {
       png_set_shift(_png, &sig_bit);
     }
     // Since this assumes that _maxval is one less than a power of 2, we set
-    // val_scale to the appropriate factor in case it is not.
+    // _val_scale to the appropriate factor in case it is not.
     int png_maxval = (1 << png_bit_depth) - 1;
-    val_scale = (double)png_maxval / (double)_maxval;
+    _val_scale = (double)png_maxval / (double)_maxval;
   }
 
-  int row_byte_length = _x_size * _num_channels;
+  _png_bit_depth = png_bit_depth;
+  _color_type = color_type;
+
+  size_t row_byte_length = (size_t)_x_size * _num_channels;
   if (png_bit_depth > 8) {
     row_byte_length *= 2;
   }
 
-  int num_rows = _y_size;
-
   if (pnmimage_png_cat.is_debug()) {
     pnmimage_png_cat.debug()
       << "Allocating one row of " << row_byte_length
@@ -722,138 +877,119 @@ write_data(xel *array, xelval *alpha_data) {
   // When writing, we only need to copy the image out one row at a time,
   // because we don't mess around with writing interlaced files.  If we were
   // writing an interlaced file, we'd have to copy the whole image first.
+  _row.resize(row_byte_length);
+  _rows_written = 0;
+}
 
-  png_bytep row = (png_byte *)PANDA_MALLOC_ARRAY(row_byte_length * sizeof(png_byte));
-
+/**
+ * Converts one row of pixels from the indicated array and alpha pointers into
+ * the format set up by setup_png().
+ */
+void PNMFileTypePNG::Writer::
+encode_row(png_bytep dest, const xel *array, const xelval *alpha_data) {
   bool save_color = !is_grayscale();
   bool save_alpha = has_alpha();
 
-  if (val_scale == 1.0) {
+  if (_val_scale == 1.0) {
     // No scale needed; we're already a power of 2.
-    int pi = 0;
-    for (int yi = 0; yi < num_rows; yi++) {
-      png_bytep dest = row;
-
-      if (color_type == PNG_COLOR_TYPE_PALETTE) {
-        for (int xi = 0; xi < _x_size; xi++) {
-          int index;
-
-          if (save_color) {
-            if (save_alpha) {
-              index = palette_lookup[PixelSpec(PPM_GETR(array[pi]), PPM_GETG(array[pi]), PPM_GETB(array[pi]), alpha_data[pi])];
-            } else {
-              index = palette_lookup[PixelSpec(PPM_GETR(array[pi]), PPM_GETG(array[pi]), PPM_GETB(array[pi]))];
-            }
+    if (_color_type == PNG_COLOR_TYPE_PALETTE) {
+      for (int xi = 0; xi < _x_size; xi++) {
+        int index;
+
+        if (save_color) {
+          if (save_alpha) {
+            index = _palette_lookup[PixelSpec(PPM_GETR(array[xi]), PPM_GETG(array[xi]), PPM_GETB(array[xi]), alpha_data[xi])];
           } else {
-            if (save_alpha) {
-              index = palette_lookup[PixelSpec(PPM_GETB(array[pi]), alpha_data[pi])];
-            } else {
-              index = palette_lookup[PixelSpec(PPM_GETB(array[pi]))];
-            }
+            index = _palette_lookup[PixelSpec(PPM_GETR(array[xi]), PPM_GETG(array[xi]), PPM_GETB(array[xi]))];
+          }
+        } else {
+          if (save_alpha) {
+            index = _palette_lookup[PixelSpec(PPM_GETB(array[xi]), alpha_data[xi])];
+          } else {
+            index = _palette_lookup[PixelSpec(PPM_GETB(array[xi]))];
           }
-
-          *dest++ = index;
-          pi++;
         }
 
-      } else if (png_bit_depth > 8) {
-        for (int xi = 0; xi < _x_size; xi++) {
-          if (save_color) {
-            xelval red = PPM_GETR(array[pi]);
-            *dest++ = (red >> 8) & 0xff;
-            *dest++ = red & 0xff;
-            xelval green = PPM_GETG(array[pi]);
-            *dest++ = (green >> 8) & 0xff;
-            *dest++ = green & 0xff;
-          }
-          xelval blue = PPM_GETB(array[pi]);
-          *dest++ = (blue >> 8) & 0xff;
-          *dest++ = blue & 0xff;
+        *dest++ = index;
+      }
 
-          if (save_alpha) {
-            xelval alpha = alpha_data[pi];
-            *dest++ = (alpha >> 8) & 0xff;
-            *dest++ = alpha & 0xff;
-          }
-          pi++;
+    } else if (_png_bit_depth > 8) {
+      for (int xi = 0; xi < _x_size; xi++) {
+        if (save_color) {
+          xelval red = PPM_GETR(array[xi]);
+          *dest++ = (red >> 8) & 0xff;
+          *dest++ = red & 0xff;
+          xelval green = PPM_GETG(array[xi]);
+          *dest++ = (green >> 8) & 0xff;
+          *dest++ = green & 0xff;
         }
+        xelval blue = PPM_GETB(array[xi]);
+        *dest++ = (blue >> 8) & 0xff;
+        *dest++ = blue & 0xff;
+
+        if (save_alpha) {
+          xelval alpha = alpha_data[xi];
+          *dest++ = (alpha >> 8) & 0xff;
+          *dest++ = alpha & 0xff;
+        }
+      }
 
-      } else {
-        for (int xi = 0; xi < _x_size; xi++) {
-          if (save_color) {
-            *dest++ = PPM_GETR(array[pi]);
-            *dest++ = PPM_GETG(array[pi]);
-          }
+    } else {
+      for (int xi = 0; xi < _x_size; xi++) {
+        if (save_color) {
+          *dest++ = PPM_GETR(array[xi]);
+          *dest++ = PPM_GETG(array[xi]);
+        }
 
-          *dest++ = PPM_GETB(array[pi]);
+        *dest++ = PPM_GETB(array[xi]);
 
-          if (save_alpha) {
-            *dest++ = alpha_data[pi];
-          }
-          pi++;
+        if (save_alpha) {
+          *dest++ = alpha_data[xi];
         }
       }
-
-      nassertr(dest <= row + row_byte_length, yi);
-      png_write_row(_png, row);
-      Thread::consider_yield();
     }
   } else {
     // Here we might need to scale each component to match the png
     // requirement.
-    nassertr(color_type != PNG_COLOR_TYPE_PALETTE, 0);
-    int pi = 0;
-    for (int yi = 0; yi < num_rows; yi++) {
-      png_bytep dest = row;
-
-      if (png_bit_depth > 8) {
-        for (int xi = 0; xi < _x_size; xi++) {
-          if (save_color) {
-            xelval red = (xelval)(PPM_GETR(array[pi]) * val_scale + 0.5);
-            *dest++ = (red >> 8) & 0xff;
-            *dest++ = red & 0xff;
-            xelval green = (xelval)(PPM_GETG(array[pi]) * val_scale + 0.5);
-            *dest++ = (green >> 8) & 0xff;
-            *dest++ = green & 0xff;
-          }
-          xelval blue = (xelval)(PPM_GETB(array[pi]) * val_scale + 0.5);
-          *dest++ = (blue >> 8) & 0xff;
-          *dest++ = blue & 0xff;
-
-          if (save_alpha) {
-            xelval alpha = (xelval)(alpha_data[pi] * val_scale + 0.5);
-            *dest++ = (alpha >> 8) & 0xff;
-            *dest++ = alpha & 0xff;
-          }
-          pi++;
+    nassertv(_color_type != PNG_COLOR_TYPE_PALETTE);
+    double val_scale = _val_scale;
+
+    if (_png_bit_depth > 8) {
+      for (int xi = 0; xi < _x_size; xi++) {
+        if (save_color) {
+          xelval red = (xelval)(PPM_GETR(array[xi]) * val_scale + 0.5);
+          *dest++ = (red >> 8) & 0xff;
+          *dest++ = red & 0xff;
+          xelval green = (xelval)(PPM_GETG(array[xi]) * val_scale + 0.5);
+          *dest++ = (green >> 8) & 0xff;
+          *dest++ = green & 0xff;
+        }
+        xelval blue = (xelval)(PPM_GETB(array[xi]) * val_scale + 0.5);
+        *dest++ = (blue >> 8) & 0xff;
+        *dest++ = blue & 0xff;
+
+        if (save_alpha) {
+          xelval alpha = (xelval)(alpha_data[xi] * val_scale + 0.5);
+          *dest++ = (alpha >> 8) & 0xff;
+          *dest++ = alpha & 0xff;
         }
+      }
 
-      } else {
-        for (int xi = 0; xi < _x_size; xi++) {
-          if (save_color) {
-            *dest++ = (xelval)(PPM_GETR(array[pi]) * val_scale + 0.5);
-            *dest++ = (xelval)(PPM_GETG(array[pi]) * val_scale + 0.5);
-          }
+    } else {
+      for (int xi = 0; xi < _x_size; xi++) {
+        if (save_color) {
+          *dest++ = (xelval)(PPM_GETR(array[xi]) * val_scale + 0.5);
+          *dest++ = (xelval)(PPM_GETG(array[xi]) * val_scale + 0.5);
+        }
 
-          *dest++ = (xelval)(PPM_GETB(array[pi]) * val_scale + 0.5);
+        *dest++ = (xelval)(PPM_GETB(array[xi]) * val_scale + 0.5);
 
-          if (save_alpha) {
-            *dest++ = (xelval)(alpha_data[pi] * val_scale + 0.5);
-          }
-          pi++;
+        if (save_alpha) {
+          *dest++ = (xelval)(alpha_data[xi] * val_scale + 0.5);
         }
       }
-
-      nassertr(dest <= row + row_byte_length, yi);
-      png_write_row(_png, row);
-      Thread::consider_yield();
     }
   }
-  PANDA_FREE_ARRAY(row);
-
-  png_write_end(_png, nullptr);
-
-  return _y_size;
 }
 
 /**
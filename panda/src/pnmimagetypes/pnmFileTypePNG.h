@@ -52,8 +52,12 @@ public:
     virtual ~Reader();
 
     virtual int read_data(xel *array, xelval *alpha_data);
+    virtual bool supports_read_row() const;
+    virtual bool read_row(xel *array, xelval *alpha, int x_size, int y_size);
 
   private:
+    void decode_row(xel *array, xelval *alpha_data, const png_byte *source,
+                    int x_size) const;
     void free_png();
     static void png_read_data(png_structp png_ptr, png_bytep data,
                               png_size_t length);
@@ -64,6 +68,11 @@ public:
     png_structp _png;
     png_infop _info;
 
+    // Interlaced files can't be read one row at a time.
+    bool _interlaced;
+    int _rows_read;
+    pvector<png_byte> _row;
+
     // We need a jmp_buf to support libpng's fatal error handling, in which
     // the error handler must not immediately leave libpng code, but must
     // return to the caller in Panda.
@@ -76,8 +85,14 @@ public:
     virtual ~Writer();
 
     virtual int write_data(xel *array, xelval *alpha);
+    virtual bool supports_write_row() const;
+    virtual bool write_header();
+    virtual bool write_row(xel *array, xelval *alpha);
 
   private:
+    void setup_png(xel *array, xelval *alpha_data);
+    void encode_row(png_bytep dest, const xel *array,
+                    const xelval *alpha_data);
     void free_png();
     static int make_png_bit_depth(int bit_depth);
     static void png_write_data(png_structp png_ptr, png_bytep data,
@@ -90,6 +105,14 @@ public:
     png_structp _png;
     png_infop _info;
 
+    // These are filled in by setup_png() for encode_row().
+    int _png_bit_depth;
+    int _color_type;
+    double _val_scale;
+    HistMap _palette_lookup;
+    int _rows_written;
+    pvector<png_byte> _row;
+
     // We need a jmp_buf to support libpng's fatal error handling, in which
     // the error handler must not immediately leave libpng code, but must
     // return to the caller in Panda.
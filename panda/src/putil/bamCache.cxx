@@ -27,6 +27,15 @@
 #include "configVariableFilename.h"
 #include "virtualFileSystem.h"
 
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN 1
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 using std::istream;
 using std::ostream;
 using std::ostringstream;
@@ -41,6 +50,7 @@ BamCache::
 BamCache() :
   _active(true),
   _read_only(false),
+  _concurrent(false),
   _index(new BamCacheIndex),
   _index_stale_since(0)
 {
@@ -86,6 +96,14 @@ BamCache() :
     ("model-cache-max-kbytes", 10485760,
      PRC_DESC("This is the maximum size of the model cache, in kilobytes."));
 
+  ConfigVariableBool model_cache_concurrent
+    ("model-cache-concurrent", false,
+     PRC_DESC("If this is set to true, the model cache is kept without an "
+              "index, with each cache file named for the contents of its "
+              "source file.  This allows many processes to share one cache "
+              "directory efficiently, but model-cache-max-kbytes is not "
+              "enforced in this mode.  See BamCache::set_concurrent()."));
+
   _cache_models = model_cache_models;
   _cache_textures = model_cache_textures;
   _cache_compressed_textures = model_cache_compressed_textures;
@@ -93,6 +111,7 @@ BamCache() :
 
   _flush_time = model_cache_flush;
   _max_kbytes = model_cache_max_kbytes;
+  _concurrent = model_cache_concurrent;
 
   if (!model_cache_dir.empty()) {
     set_root(model_cache_dir);
@@ -133,12 +152,42 @@ set_root(const Filename &root) {
   delete _index;
   _index = new BamCacheIndex;
   _index_stale_since = 0;
-  read_index();
-  check_cache_size();
+  if (!_concurrent) {
+    read_index();
+    check_cache_size();
+  }
 
   nassertv(vfs->is_directory(_root));
 }
 
+/**
+ * Puts the cache into or out of concurrent mode.
+ *
+ * In concurrent mode, the cache keeps no index.  Each cache file is named for
+ * a hash of the source pathname and of the contents of the source file, and
+ * is written atomically, by itself, to a subdirectory of the root.  Lookups
+ * and stores do not hold the cache's lock, so any number of threads and
+ * processes may use the same cache at once; and since a changed source file
+ * gets a new cache file, a record is never rewritten while another process
+ * is reading it.  The cost is that each lookup must read the source file to
+ * hash it, and that the cache-max-kbytes limit is not enforced.
+ *
+ * All processes sharing a cache directory should use the same mode.  The mode
+ * should not be changed, nor the root, while loads are in progress.
+ */
+void BamCache::
+set_concurrent(bool flag) {
+  ReMutexHolder holder(_lock);
+  if (flag == _concurrent) {
+    return;
+  }
+  flush_index();
+  _concurrent = flag;
+  if (!_root.empty()) {
+    set_root(_root);
+  }
+}
+
 /**
  * Looks up a file in the cache.
  *
@@ -157,6 +206,41 @@ set_root(const Filename &root) {
  */
 PT(BamCacheRecord) BamCache::
 lookup(const Filename &source_filename, const string &cache_extension) {
+  if (_concurrent) {
+    VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+
+    Filename source_pathname(source_filename);
+    source_pathname.make_absolute(vfs->get_cwd());
+
+    Filename rel_pathname(source_pathname);
+    rel_pathname.make_relative_to(_root, false);
+    if (rel_pathname.is_local()) {
+      return nullptr;
+    }
+
+    string contents_hash = hash_contents(source_pathname);
+    if (contents_hash.empty()) {
+      // We can't read the source file, so we can't cache it either.
+      return nullptr;
+    }
+
+    // The first two digits of the hash name a subdirectory, to keep any one
+    // directory from growing too large.
+    string hash = hash_filename(source_pathname.get_fullpath() + "\n" + contents_hash);
+    Filename cache_filename(Filename(hash.substr(0, 2)), Filename(hash));
+    cache_filename.set_extension(cache_extension);
+
+    int pass = 0;
+    while (true) {
+      PT(BamCacheRecord) record =
+        read_record(source_pathname, cache_filename, pass);
+      if (record != nullptr) {
+        return record;
+      }
+      ++pass;
+    }
+  }
+
   ReMutexHolder holder(_lock);
   consider_flush_index();
 
@@ -186,8 +270,29 @@ lookup(const Filename &source_filename, const string &cache_extension) {
  */
 bool BamCache::
 store(BamCacheRecord *record) {
-  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+  if (_concurrent) {
+    return do_store(record);
+  }
+
   ReMutexHolder holder(_lock);
+  consider_flush_index();
+
+  if (!do_store(record)) {
+    return false;
+  }
+
+  add_to_index(record);
+
+  return true;
+}
+
+/**
+ * The implementation of store(), less the index update.  In the normal mode,
+ * assumes the lock is held.
+ */
+bool BamCache::
+do_store(BamCacheRecord *record) {
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
   nassertr(!record->_cache_pathname.empty(), false);
   nassertr(record->has_data(), false);
 
@@ -195,8 +300,6 @@ store(BamCacheRecord *record) {
     return false;
   }
 
-  consider_flush_index();
-
 #ifndef NDEBUG
   // Ensure that the cache_pathname is within the _root directory tree.
   Filename rel_pathname(record->_cache_pathname);
@@ -207,12 +310,25 @@ store(BamCacheRecord *record) {
   record->_recorded_time = time(nullptr);
 
   Filename cache_pathname = Filename::binary_filename(record->_cache_pathname);
+  if (_concurrent) {
+    Filename dirname = cache_pathname.get_dirname();
+    if (!vfs->is_directory(dirname)) {
+      vfs->make_directory_full(dirname);
+    }
+  }
 
   // We actually do the write to a temporary filename first, and then move it
   // into place, so that no one attempts to read the file while it is in the
   // process of being written.
+  // The thread's unique id includes the process id, but in concurrent mode
+  // the cache may be shared with processes on other machines, so add the
+  // hostname as well.
   Thread *current_thread = Thread::get_current_thread();
   string extension = current_thread->get_unique_id() + string(".tmp");
+  if (_concurrent) {
+    static const string hostname = get_hostname();
+    extension = hostname + "." + extension;
+  }
   Filename temp_pathname = cache_pathname;
   temp_pathname.set_extension(extension);
   temp_pathname.set_binary();
@@ -292,8 +408,6 @@ store(BamCacheRecord *record) {
     }
   }
 
-  add_to_index(record);
-
   return true;
 }
 
@@ -615,6 +729,10 @@ rebuild_index() {
  */
 void BamCache::
 add_to_index(const BamCacheRecord *record) {
+  if (_concurrent) {
+    return;
+  }
+
   PT(BamCacheRecord) new_record = record->make_copy();
 
   if (_index->add_record(new_record)) {
@@ -628,6 +746,10 @@ add_to_index(const BamCacheRecord *record) {
  */
 void BamCache::
 remove_from_index(const Filename &source_pathname) {
+  if (_concurrent) {
+    return;
+  }
+
   if (_index->remove_record(source_pathname)) {
     mark_index_stale();
   }
@@ -813,7 +935,7 @@ read_record(const Filename &source_pathname,
       << "Reading cache file " << cache_pathname << " for " << source_pathname << "\n";
   }
 
-  PT(BamCacheRecord) record = do_read_record(cache_pathname, true);
+  PT(BamCacheRecord) record = do_read_record(cache_pathname, true, _concurrent);
   if (record == nullptr) {
     // Well, it was invalid, so blow it away, and make a new one.
     if (util_cat.is_debug()) {
@@ -850,10 +972,13 @@ read_record(const Filename &source_pathname,
 }
 
 /**
- * Actually reads a record from the file.
+ * Actually reads a record from the file.  If content_addressed is true, the
+ * cache filename was derived from the contents of the source file, so the
+ * source file's timestamp need not be checked.
  */
 PT(BamCacheRecord) BamCache::
-do_read_record(const Filename &cache_pathname, bool read_data) {
+do_read_record(const Filename &cache_pathname, bool read_data,
+               bool content_addressed) {
   DatagramInputFile din;
   if (!din.open(cache_pathname)) {
     if (util_cat.is_debug()) {
@@ -916,7 +1041,8 @@ do_read_record(const Filename &cache_pathname, bool read_data) {
   // cache record will be returned.
 
   // We still need to decide whether the cache record is stale.
-  if (read_data && record->dependents_unchanged()) {
+  if (read_data && (content_addressed ? content_dependents_unchanged(record)
+                                      : record->dependents_unchanged())) {
     // The cache record doesn't appear to be stale.  Load the cached object.
     TypedWritable *ptr;
     ReferenceCount *ref_ptr;
@@ -947,9 +1073,231 @@ do_read_record(const Filename &cache_pathname, bool read_data) {
   return record;
 }
 
+/**
+ * Returns the name of this machine, for use in temporary filenames.
+ */
+string BamCache::
+get_hostname() {
+  char buffer[256];
+#ifdef _WIN32
+  DWORD size = sizeof(buffer);
+  if (GetComputerNameA(buffer, &size) && size != 0) {
+    return string(buffer, size);
+  }
+#else
+  if (gethostname(buffer, sizeof(buffer)) == 0 && buffer[0] != '\0') {
+    buffer[sizeof(buffer) - 1] = '\0';
+    return string(buffer);
+  }
+#endif
+  return "unknown";
+}
+
+/**
+ * Like BamCacheRecord::dependents_unchanged(), but for a record found by the
+ * contents of its source file.  The source file is known to be unchanged, even
+ * if its timestamp differs (for instance, because it was checked out again
+ * or copied from another machine), so only its size is checked, as a guard
+ * against a hash collision; the other dependent files are checked by
+ * timestamp and size as usual.
+ */
+bool BamCache::
+content_dependents_unchanged(const BamCacheRecord *record) {
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+
+  for (const BamCacheRecord::DependentFile &dfile : record->_files) {
+    PT(VirtualFile) file = vfs->get_file(dfile._pathname);
+    if (dfile._pathname == record->_source_pathname) {
+      // Its timestamp may differ, but its size must still match.
+      if (file == nullptr || file->get_file_size() != dfile._size) {
+        if (util_cat.is_debug()) {
+          util_cat.debug()
+            << dfile._pathname << " has changed size.\n";
+        }
+        return false;
+      }
+      continue;
+    }
+    if (file == nullptr) {
+      if (dfile._timestamp != 0) {
+        return false;
+      }
+    } else if (file->get_timestamp() != dfile._timestamp ||
+               file->get_file_size() != dfile._size) {
+      if (util_cat.is_debug()) {
+        util_cat.debug()
+          << dfile._pathname << " has changed timestamp or size.\n";
+      }
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#ifndef HAVE_OPENSSL
+/**
+ * A minimal implementation of MD5 (RFC 1321), used by hash_filename() and
+ * hash_contents() when OpenSSL is not available, so that the cache is
+ * addressed by the same strong hash in every build.
+ */
+class BamCacheMD5 {
+public:
+  BamCacheMD5();
+
+  void update(const unsigned char *data, size_t length);
+  string finish_hex();
+
+private:
+  void transform(const unsigned char *block);
+
+  uint32_t _state[4];
+  uint64_t _length;
+  unsigned char _buffer[64];
+};
+
+/**
+ *
+ */
+BamCacheMD5::
+BamCacheMD5() : _length(0) {
+  _state[0] = 0x67452301;
+  _state[1] = 0xefcdab89;
+  _state[2] = 0x98badcfe;
+  _state[3] = 0x10325476;
+}
+
+/**
+ * Adds the indicated bytes to the hash.
+ */
+void BamCacheMD5::
+update(const unsigned char *data, size_t length) {
+  size_t used = (size_t)(_length & 63);
+  _length += length;
+
+  if (used != 0) {
+    size_t count = std::min(length, 64 - used);
+    memcpy(_buffer + used, data, count);
+    data += count;
+    length -= count;
+    if (used + count < 64) {
+      return;
+    }
+    transform(_buffer);
+  }
+
+  while (length >= 64) {
+    transform(data);
+    data += 64;
+    length -= 64;
+  }
+  memcpy(_buffer, data, length);
+}
+
+/**
+ * Pads the message, and returns the digest as a 32-digit hexadecimal string,
+ * the same as HashVal::as_hex().
+ */
+string BamCacheMD5::
+finish_hex() {
+  uint64_t bits = _length * 8;
+  unsigned char pad[72];
+  size_t pad_length = 64 - (size_t)((_length + 8) & 63);
+  memset(pad, 0, sizeof(pad));
+  pad[0] = 0x80;
+  for (int i = 0; i < 8; ++i) {
+    pad[pad_length + i] = (unsigned char)(bits >> (i * 8));
+  }
+  update(pad, pad_length + 8);
+
+  static const char digits[] = "0123456789abcdef";
+  string result;
+  for (int i = 0; i < 16; ++i) {
+    unsigned int byte = (_state[i / 4] >> ((i % 4) * 8)) & 0xff;
+    result += digits[byte >> 4];
+    result += digits[byte & 0xf];
+  }
+  return result;
+}
+
+/**
+ * Processes one 64-byte block of the message.
+ */
+void BamCacheMD5::
+transform(const unsigned char *block) {
+  static const uint32_t k[64] = {
+    0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
+    0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+    0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
+    0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+    0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa,
+    0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+    0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+    0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+    0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c,
+    0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+    0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05,
+    0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+    0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039,
+    0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+    0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1,
+    0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+  };
+  static const int shift[16] = {
+    7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21,
+  };
+
+  uint32_t m[16];
+  for (int i = 0; i < 16; ++i) {
+    m[i] = (uint32_t)block[i * 4] | ((uint32_t)block[i * 4 + 1] << 8) |
+      ((uint32_t)block[i * 4 + 2] << 16) | ((uint32_t)block[i * 4 + 3] << 24);
+  }
+
+  uint32_t a = _state[0];
+  uint32_t b = _state[1];
+  uint32_t c = _state[2];
+  uint32_t d = _state[3];
+
+  for (int i = 0; i < 64; ++i) {
+    uint32_t f;
+    int g;
+    switch (i / 16) {
+    case 0:
+      f = (b & c) | (~b & d);
+      g = i;
+      break;
+    case 1:
+      f = (d & b) | (~d & c);
+      g = (5 * i + 1) & 15;
+      break;
+    case 2:
+      f = b ^ c ^ d;
+      g = (3 * i + 5) & 15;
+      break;
+    default:
+      f = c ^ (b | ~d);
+      g = (7 * i) & 15;
+      break;
+    }
+    int s = shift[(i / 16) * 4 + (i & 3)];
+    f += a + k[i] + m[g];
+    a = d;
+    d = c;
+    c = b;
+    b += (f << s) | (f >> (32 - s));
+  }
+
+  _state[0] += a;
+  _state[1] += b;
+  _state[2] += c;
+  _state[3] += d;
+}
+#endif  // HAVE_OPENSSL
+
 /**
  * Returns the appropriate filename to use for a cache file, given the
- * fullpath string to the source filename.
+ * fullpath string to the source filename.  This is the MD5 hash of the
+ * string, in every build.
  */
 string BamCache::
 hash_filename(const string &filename) {
@@ -962,17 +1310,48 @@ hash_filename(const string &filename) {
   return strm.str();
 
 #else  // HAVE_OPENSSL
-  // Without OpenSSL, don't get fancy; just build a simple hash.
-  unsigned int hash = 0;
-  for (string::const_iterator si = filename.begin();
-       si != filename.end();
-       ++si) {
-    hash = (hash * 9109) + (unsigned int)(*si);
+  BamCacheMD5 md5;
+  md5.update((const unsigned char *)filename.data(), filename.size());
+  return md5.finish_hex();
+
+#endif  // HAVE_OPENSSL
+}
+
+/**
+ * Returns the MD5 hash of the contents of the indicated file, as a hex
+ * string, or the empty string if the file cannot be read.
+ */
+string BamCache::
+hash_contents(const Filename &pathname) {
+#ifdef HAVE_OPENSSL
+  HashVal hv;
+  if (!hv.hash_file(pathname)) {
+    return string();
   }
+  return hv.as_hex();
 
-  ostringstream strm;
-  strm << std::hex << std::setw(8) << std::setfill('0') << hash;
-  return strm.str();
+#else  // HAVE_OPENSSL
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+  istream *in = vfs->open_read_file(Filename::binary_filename(pathname), false);
+  if (in == nullptr) {
+    return string();
+  }
+
+  BamCacheMD5 md5;
+  char buffer[4096];
+  in->read(buffer, sizeof(buffer));
+  size_t count = in->gcount();
+  while (count != 0) {
+    md5.update((const unsigned char *)buffer, count);
+    in->read(buffer, sizeof(buffer));
+    count = in->gcount();
+  }
+  bool failed = in->bad();
+  vfs->close_read_file(in);
+  if (failed) {
+    return string();
+  }
+  return md5.finish_hex();
 
 #endif  // HAVE_OPENSSL
 }
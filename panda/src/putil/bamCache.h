@@ -38,6 +38,12 @@ class BamCacheIndex;
  * multiple different processes writing to the same index, and without relying
  * too heavily on low-level os-provided file locks (which work poorly with C++
  * iostreams).
+ *
+ * Alternatively, in concurrent mode (see set_concurrent()), no index is kept
+ * at all.  Each cache file is named for a hash of the source pathname and
+ * the source file's contents, and is written atomically on its own, so that
+ * many threads and processes can look up and store records at once without
+ * contending for a lock or for the index.
  */
 class EXPCL_PANDA_PUTIL BamCache {
 PUBLISHED:
@@ -71,6 +77,9 @@ PUBLISHED:
   INLINE void set_read_only(bool ro);
   INLINE bool get_read_only() const;
 
+  void set_concurrent(bool flag);
+  INLINE bool get_concurrent() const;
+
   PT(BamCacheRecord) lookup(const Filename &source_filename,
                             const std::string &cache_extension);
   bool store(BamCacheRecord *record);
@@ -96,6 +105,7 @@ PUBLISHED:
   MAKE_PROPERTY(flush_time, get_flush_time, set_flush_time);
   MAKE_PROPERTY(cache_max_kbytes, get_cache_max_kbytes, set_cache_max_kbytes);
   MAKE_PROPERTY(read_only, get_read_only, set_read_only);
+  MAKE_PROPERTY(concurrent, get_concurrent, set_concurrent);
 
 private:
   void read_index();
@@ -110,6 +120,7 @@ private:
 
   void check_cache_size();
 
+  bool do_store(BamCacheRecord *record);
   void emergency_read_only();
 
   static BamCacheIndex *do_read_index(const Filename &index_pathname);
@@ -121,9 +132,13 @@ private:
                                  const Filename &cache_filename,
                                  int pass);
   static PT(BamCacheRecord) do_read_record(const Filename &cache_pathname,
-                                           bool read_data);
+                                           bool read_data,
+                                           bool content_addressed = false);
+  static bool content_dependents_unchanged(const BamCacheRecord *record);
 
   static std::string hash_filename(const std::string &filename);
+  static std::string hash_contents(const Filename &pathname);
+  static std::string get_hostname();
   static void make_global();
 
   bool _active;
@@ -132,6 +147,7 @@ private:
   bool _cache_compressed_textures;
   bool _cache_compiled_shaders;
   bool _read_only;
+  bool _concurrent;
   Filename _root;
   int _flush_time;
   int _max_kbytes;
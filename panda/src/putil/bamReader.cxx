@@ -19,6 +19,7 @@
 #include "datagramIterator.h"
 #include "config_putil.h"
 #include "pipelineCyclerBase.h"
+#include "virtualFileSystem.h"
 
 using std::string;
 
@@ -49,6 +50,11 @@ BamReader(DatagramGenerator *source)
   _pta_id = -1;
   _long_object_id = false;
   _long_pta_id = false;
+  _map_arrays = bam_map_arrays;
+  _mapped_start = 0;
+  _mapped_size = 0;
+  _data_in = nullptr;
+  _defer_decode = false;
 }
 
 
@@ -59,6 +65,11 @@ BamReader::
 ~BamReader() {
   nassertv(_num_extra_objects == 0);
   nassertv(_nesting_level == 0);
+
+  if (_data_in != nullptr) {
+    _data_vfile->close_read_file(_data_in);
+    _data_in = nullptr;
+  }
 }
 
 /**
@@ -323,6 +334,12 @@ read_object(TypedWritable *&ptr, ReferenceCount *&ref_ptr) {
  */
 bool BamReader::
 resolve() {
+  // The objects' data must be in place before any of them are completed.
+  if (!_pending_decodes.empty()) {
+    do_pending_decodes(0, _pending_decodes.size());
+    clear_pending_decodes();
+  }
+
   bool all_completed;
   bool any_completed_this_pass;
 
@@ -685,6 +702,155 @@ read_file_data(SubfileInfo &info) {
   _file_data_records.pop_front();
 }
 
+/**
+ * Returns a pointer to the block of file data described by info, which was
+ * returned by read_file_data(), within a read-only mapping of the file.  The
+ * mapping is stored in mapped_file, which must be kept for as long as the
+ * pointer is used.
+ *
+ * Returns NULL if the data cannot be mapped, for instance because the file is
+ * compressed or is not on disk, or because the data was not written on a
+ * page boundary with BamWriter::write_aligned_file_data().  In this case, the
+ * data may still be read with copy_file_data().
+ */
+const unsigned char *BamReader::
+map_file_data(const SubfileInfo &info, PT(MappedFile) &mapped_file) {
+  if (info.get_file() != _mapped_source) {
+    // Map the entire file the first time it is requested.  If it can't be
+    // mapped, we remember that too, and don't try again.
+    _mapped_source = info.get_file();
+    _mapped_file = new MappedFile;
+    _mapped_start = 0;
+    _mapped_size = 0;
+
+    std::string extension = info.get_filename().get_extension();
+    if (extension != "pz" && extension != "gz") {
+      VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+      PT(VirtualFile) vfile = vfs->get_file(info.get_filename(), true);
+      SubfileInfo system_info;
+      if (vfile != nullptr && vfile->get_system_info(system_info) &&
+          _mapped_file->open(system_info.get_filename())) {
+        _mapped_start = (size_t)system_info.get_start();
+        _mapped_size = (size_t)system_info.get_size();
+      }
+    }
+  }
+
+  if (!_mapped_file->is_open()) {
+    return nullptr;
+  }
+
+  size_t start = (size_t)info.get_start();
+  size_t size = (size_t)info.get_size();
+  if (start + size > _mapped_size ||
+      _mapped_start + _mapped_size > _mapped_file->get_size()) {
+    return nullptr;
+  }
+
+  const unsigned char *data = _mapped_file->get_data() + _mapped_start + start;
+  if (((uintptr_t)data % MEMORY_HOOK_ALIGNMENT) != 0) {
+    return nullptr;
+  }
+
+  mapped_file = _mapped_file;
+  return data;
+}
+
+/**
+ * Reads the block of file data described by info, which was returned by
+ * read_file_data(), into the indicated buffer, which must be at least
+ * info.get_size() bytes.  Returns true on success, false on failure.
+ */
+bool BamReader::
+copy_file_data(const SubfileInfo &info, unsigned char *data) {
+  if (info.get_file() != _data_source) {
+    if (_data_in != nullptr) {
+      _data_vfile->close_read_file(_data_in);
+      _data_in = nullptr;
+    }
+    _data_source = info.get_file();
+
+    VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+    _data_vfile = vfs->get_file(info.get_filename(), true);
+    if (_data_vfile != nullptr) {
+      _data_in = _data_vfile->open_read_file(true);
+    }
+  }
+
+  if (_data_in == nullptr) {
+    bam_cat.error()
+      << "Unable to open " << info.get_filename() << "\n";
+    return false;
+  }
+
+  _data_in->clear();
+  _data_in->seekg(info.get_start());
+  _data_in->read((char *)data, info.get_size());
+  if (_data_in->fail() || _data_in->gcount() != info.get_size()) {
+    bam_cat.error()
+      << "Unable to read " << info << "\n";
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Copies size bytes from the current position of the datagram into the
+ * indicated buffer, and advances the iterator past them.  This is intended
+ * for objects that read large blocks of raw data, such as vertex arrays and
+ * texture images.
+ *
+ * If set_defer_decode() is in effect, the copy of a large block is only
+ * recorded, and performed at the next call to resolve().  The buffer must
+ * remain valid until then, and its contents may not be used before then.
+ */
+void BamReader::
+extract_bytes(DatagramIterator &scan, unsigned char *into, size_t size) {
+  // Copies smaller than this aren't worth putting off, and copies larger
+  // than this are divided into pieces of this size, so that a single large
+  // block may be copied by several threads.
+  static const size_t decode_piece_size = 256 * 1024;
+
+  nassertv(scan.get_remaining_size() >= size);
+  const unsigned char *source =
+    (const unsigned char *)scan.get_datagram().get_data() + scan.get_current_index();
+  scan.skip_bytes(size);
+
+  if (!_defer_decode || size < decode_piece_size) {
+    memcpy(into, source, size);
+    return;
+  }
+
+  PendingDecode decode;
+  decode._datagram = scan.get_datagram();
+  while (size > 0) {
+    decode._source = source;
+    decode._dest = into;
+    decode._size = std::min(size, decode_piece_size);
+    _pending_decodes.push_back(decode);
+
+    source += decode._size;
+    into += decode._size;
+    size -= decode._size;
+  }
+}
+
+/**
+ * Performs the copies that extract_bytes() has put off, from index begin up
+ * to but not including end.  This may be called from several threads at
+ * once, for different ranges.  It is called by resolve() for all of the
+ * pending copies, unless they have already been performed and cleared with
+ * clear_pending_decodes().
+ */
+void BamReader::
+do_pending_decodes(size_t begin, size_t end) const {
+  nassertv(begin <= end && end <= _pending_decodes.size());
+  for (size_t i = begin; i < end; ++i) {
+    const PendingDecode &decode = _pending_decodes[i];
+    memcpy(decode._dest, decode._source, decode._size);
+  }
+}
+
 /**
  * Reads in the indicated CycleData object.  This should be used by classes
  * that store some or all of their data within a CycleData subclass, in
@@ -25,12 +25,15 @@
 #include "bamReaderParam.h"
 #include "bamEnums.h"
 #include "subfileInfo.h"
+#include "mappedFile.h"
+#include "virtualFile.h"
 #include "loaderOptions.h"
 #include "factory.h"
 #include "vector_int.h"
 #include "pset.h"
 #include "pmap.h"
 #include "pdeque.h"
+#include "pvector.h"
 #include "dcast.h"
 #include "pipelineCyclerBase.h"
 #include "referenceCount.h"
@@ -132,6 +135,12 @@ PUBLISHED:
   INLINE const LoaderOptions &get_loader_options() const;
   INLINE void set_loader_options(const LoaderOptions &options);
 
+  INLINE bool get_map_arrays() const;
+  INLINE void set_map_arrays(bool map_arrays);
+
+  INLINE bool get_defer_decode() const;
+  INLINE void set_defer_decode(bool defer_decode);
+
   BLOCKING TypedWritable *read_object();
   BLOCKING bool read_object(TypedWritable *&ptr, ReferenceCount *&ref_ptr);
 
@@ -154,6 +163,8 @@ PUBLISHED:
   MAKE_PROPERTY(source, get_source, set_source);
   MAKE_PROPERTY(filename, get_filename);
   MAKE_PROPERTY(loader_options, get_loader_options, set_loader_options);
+  MAKE_PROPERTY(map_arrays, get_map_arrays, set_map_arrays);
+  MAKE_PROPERTY(defer_decode, get_defer_decode, set_defer_decode);
 
   MAKE_PROPERTY(file_version, get_file_version);
   MAKE_PROPERTY(file_endian, get_file_endian);
@@ -167,6 +178,14 @@ public:
   void skip_pointer(DatagramIterator &scan);
 
   void read_file_data(SubfileInfo &info);
+  const unsigned char *map_file_data(const SubfileInfo &info,
+                                     PT(MappedFile) &mapped_file);
+  bool copy_file_data(const SubfileInfo &info, unsigned char *data);
+
+  void extract_bytes(DatagramIterator &scan, unsigned char *into, size_t size);
+  INLINE size_t get_num_pending_decodes() const;
+  void do_pending_decodes(size_t begin, size_t end) const;
+  INLINE void clear_pending_decodes();
 
   void read_cdata(DatagramIterator &scan, PipelineCyclerBase &cycler);
   void read_cdata(DatagramIterator &scan, PipelineCyclerBase &cycler,
@@ -321,6 +340,31 @@ private:
   typedef pdeque<SubfileInfo> FileDataRecords;
   FileDataRecords _file_data_records;
 
+  // These are used by map_file_data() and copy_file_data() to avoid opening
+  // the same file again for each block of file data.
+  bool _map_arrays;
+  CPT(FileReference) _mapped_source;
+  PT(MappedFile) _mapped_file;
+  size_t _mapped_start;
+  size_t _mapped_size;
+  CPT(FileReference) _data_source;
+  PT(VirtualFile) _data_vfile;
+  std::istream *_data_in;
+
+  // These are the bulk copies that extract_bytes() has put off until the
+  // next call to resolve().  Each one keeps a reference to the datagram that
+  // it copies from.
+  class PendingDecode {
+  public:
+    Datagram _datagram;
+    const unsigned char *_source;
+    unsigned char *_dest;
+    size_t _size;
+  };
+  typedef pvector<PendingDecode> PendingDecodes;
+  PendingDecodes _pending_decodes;
+  bool _defer_decode;
+
   // This is used internally to record all of the new types created on-the-fly
   // to satisfy bam requirements.  We keep track of this just so we can
   // suppress warning messages from attempts to create objects of these types.
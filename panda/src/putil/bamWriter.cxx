@@ -100,6 +100,7 @@ BamWriter(DatagramSink *target) :
   _file_endian = bam_endian;
   _file_stdfloat_double = bam_stdfloat_double;
   _file_texture_mode = bam_texture_mode;
+  _mappable_arrays = bam_mappable_arrays;
 }
 
 /**
@@ -415,6 +416,60 @@ write_file_data(SubfileInfo &result, const SubfileInfo &source) {
   // order and queued up in the BamReader.
 }
 
+/**
+ * Writes a block of raw data as auxiliary file data, positioned in the file
+ * so that the data begins on a page boundary.  This must be balanced by a
+ * matching call to read_file_data() on restore, after which the data may be
+ * mapped with BamReader::map_file_data().
+ *
+ * This is only possible when writing a version 6.45 or later Bam file to an
+ * uncompressed file on disk, and it is only worth doing for blocks of at
+ * least a page in size.  If any of these conditions is not met, nothing is
+ * written and false is returned, in which case the caller should write the
+ * data inline instead.  False is also returned if there was an error writing
+ * to the output; the output then remains in an error state, so that writing
+ * the object fails as well.
+ */
+bool BamWriter::
+write_aligned_file_data(const unsigned char *data, size_t size) {
+  static const size_t page_size = 4096;
+
+  if (_file_minor < 45 || size < page_size || _target->get_file() == nullptr) {
+    return false;
+  }
+  std::string extension = _target->get_filename().get_extension();
+  if (extension == "pz" || extension == "gz") {
+    return false;
+  }
+  std::streampos pos = _target->get_file_pos();
+  if (pos <= 0) {
+    return false;
+  }
+
+  // The BOC_file_data token is written in a datagram of its own, as in
+  // write_file_data(), but padded out so that the data in the following
+  // datagram starts on a page boundary.  The reader skips over the padding.
+  size_t header_size = (size >= (uint32_t)-1) ? 12 : 4;
+  size_t data_start = (size_t)pos + 4 + 1 + header_size;
+  size_t pad_size = (page_size - data_start % page_size) % page_size;
+
+  Datagram dg;
+  dg.add_uint8(BOC_file_data);
+  dg.pad_bytes(pad_size);
+  if (!_target->put_datagram(dg)) {
+    util_cat.error()
+      << "Unable to write data to output.\n";
+    return false;
+  }
+
+  if (!_target->put_datagram(Datagram(data, size))) {
+    util_cat.error()
+      << "Unable to write file data to output.\n";
+    return false;
+  }
+  return true;
+}
+
 /**
  * Writes out the indicated CycleData object.  This should be used by classes
  * that store some or all of their data within a CycleData subclass, in
@@ -89,6 +89,23 @@ ConfigVariableEnum<BamEnums::BamTextureMode> bam_texture_mode
  PRC_DESC("Set this to specify how textures should be written into Bam files."
           "See the panda source or documentation for available options."));
 
+ConfigVariableBool bam_mappable_arrays
+("bam-mappable-arrays", false,
+ PRC_DESC("Set this true to write large vertex arrays into bam files on "
+          "page boundaries, so that they can later be mapped directly from "
+          "the file with bam-map-arrays, rather than read into memory.  "
+          "This only applies to uncompressed bam files on disk, and makes "
+          "the files somewhat larger."));
+
+ConfigVariableBool bam_map_arrays
+("bam-map-arrays", false,
+ PRC_DESC("Set this true to map the vertex arrays that were written with "
+          "bam-mappable-arrays directly from the bam file into memory, "
+          "instead of reading them.  The array data is then only read from "
+          "disk when it is used, and is shared between processes that load "
+          "the same file.  The bam file should not be modified while it is "
+          "in use."));
+
 ConfigureFn(config_putil) {
   init_libputil();
 }
@@ -406,6 +406,13 @@ void gl_draw_triangle_fill(GLContext *c,
   }
 #endif
 
+  if (c->triangle_bin != nullptr) {
+    c->triangle_bin->push_back(p0->zp);
+    c->triangle_bin->push_back(p1->zp);
+    c->triangle_bin->push_back(p2->zp);
+    return;
+  }
+
   (*c->zb_fill_tri)(c->zb,&p0->zp,&p1->zp,&p2->zp);
 }
 
@@ -55,6 +55,22 @@ ConfigVariableBool td_perspective_textures
             "textures on the tinydisplay software renderer, for a small "
             "performance gain."));
 
+ConfigVariableInt td_num_bands
+  ("td-num-bands", 0,
+   PRC_DESC("Set this to a value greater than 1 to fill the triangles of "
+            "each Geom on several threads.  The frame buffer is divided "
+            "into this many horizontal bands, and each band is filled "
+            "separately, with the triangles that overlap it drawn in the "
+            "same order as before, so that the result is exactly the same "
+            "as when this is 0, which disables it."));
+
+ConfigVariableInt td_num_threads
+  ("td-num-threads", 0,
+   PRC_DESC("The number of threads to use for filling triangles, when "
+            "td-num-bands is enabled.  The default of 0 means to use one "
+            "thread per CPU, less one for the thread that is already "
+            "drawing."));
+
 /**
  * Initializes the library.  This must be called at least once before any of
  * the functions or classes in this library can be used.  Normally it will be
@@ -48,6 +48,7 @@ void glInit(GLContext *c, ZBuffer *zbuffer)
   c->current_normal.v[3]=0.0f;
 
   c->cull_face_enabled=0;
+  c->triangle_bin = nullptr;
   
   /* specular buffer */
   c->specbuf_first = nullptr;
@@ -0,0 +1,187 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file test_vertex_transform.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "pandabase.h"
+#include "zgl.h"
+#include "trueClock.h"
+
+#include <string.h>
+#include <iomanip>
+
+// The number of vertices transformed in one batch.  This is odd on purpose,
+// so that the last few vertices aren't a multiple of four.
+static const int num_vertices = 4099;
+
+// The minimum amount of time, in seconds, to spend on each measurement.
+static const double run_time = 1.0;
+
+/**
+ * Fills in a matrix that is something like a typical model-view or
+ * projection matrix, with a bit of everything in it.
+ */
+static void
+make_matrix(M4 *m, PN_stdfloat s) {
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      m->m[i][j] = (i == j) ? 1.0f + 0.1f * s : 0.05f * s * (i - j);
+    }
+  }
+  m->m[0][3] = 2.0f * s;
+  m->m[1][3] = -1.5f * s;
+  m->m[2][3] = -10.0f;
+}
+
+/**
+ * Fills in the vertices with coordinates and normals scattered around the
+ * view volume, so that some of them are clipped.
+ */
+static void
+make_vertices(GLVertex *v) {
+  unsigned int seed = 1;
+  for (int i = 0; i < num_vertices; ++i) {
+    PN_stdfloat r[6];
+    for (int j = 0; j < 6; ++j) {
+      seed = seed * 1103515245 + 12345;
+      r[j] = (PN_stdfloat)((seed >> 8) & 0xffff) / 32768.0f - 1.0f;
+    }
+    v[i].coord.v[0] = r[0] * 12.0f;
+    v[i].coord.v[1] = r[1] * 12.0f;
+    v[i].coord.v[2] = r[2] * 12.0f;
+    v[i].coord.v[3] = 1.0f;
+    v[i].normal.v[0] = r[3];
+    v[i].normal.v[1] = r[4];
+    v[i].normal.v[2] = r[5];
+  }
+}
+
+/**
+ * Transforms the vertices the way begin_draw_primitives() used to, one at a
+ * time, with the normal of each passed in c->current_normal.
+ */
+static void
+transform_each(GLContext *c, GLVertex *v) {
+  for (int i = 0; i < num_vertices; ++i) {
+    c->current_normal.v[0] = v[i].normal.v[0];
+    c->current_normal.v[1] = v[i].normal.v[1];
+    c->current_normal.v[2] = v[i].normal.v[2];
+    c->current_normal.v[3] = 0.0f;
+    gl_vertex_transform(c, v + i);
+  }
+}
+
+/**
+ * Repeatedly copies the source vertices and transforms them, either one at a
+ * time or all together, for at least run_time seconds.  Returns the number of
+ * vertices transformed per second, and leaves the last result in dest.
+ */
+static double
+measure(GLContext *c, const GLVertex *source, GLVertex *dest, bool array) {
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double elapsed = 0.0;
+  long long count = 0;
+  do {
+    memcpy(dest, source, sizeof(GLVertex) * num_vertices);
+
+    double start = clock->get_short_time();
+    if (array) {
+      gl_vertex_transform_array(c, dest, num_vertices);
+    } else {
+      transform_each(c, dest);
+    }
+    elapsed += clock->get_short_time() - start;
+    count += num_vertices;
+  } while (elapsed < run_time);
+
+  return count / elapsed;
+}
+
+/**
+ * Returns true if the transformed vertices are exactly the same.
+ */
+static bool
+compare(const GLVertex *a, const GLVertex *b, bool lighting) {
+  for (int i = 0; i < num_vertices; ++i) {
+    if (memcmp(a[i].pc.v, b[i].pc.v, sizeof(a[i].pc.v)) != 0 ||
+        a[i].clip_code != b[i].clip_code) {
+      return false;
+    }
+    if (lighting &&
+        (memcmp(a[i].ec.v, b[i].ec.v, sizeof(a[i].ec.v)) != 0 ||
+         memcmp(a[i].normal.v, b[i].normal.v, sizeof(a[i].normal.v)) != 0)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int
+main(int argc, char *argv[]) {
+  GLContext *c = (GLContext *)PANDA_MALLOC_SINGLE(sizeof(GLContext));
+  memset(c, 0, sizeof(GLContext));
+  make_matrix(&c->matrix_model_view, 1.0f);
+  make_matrix(&c->matrix_projection, 0.5f);
+  gl_M4_Inv(&c->matrix_model_view_inv, &c->matrix_model_view);
+  gl_M4_Mul(&c->matrix_model_projection, &c->matrix_projection,
+            &c->matrix_model_view);
+  c->normal_scale = 1.0f;
+
+  GLVertex *source = (GLVertex *)PANDA_MALLOC_ARRAY(sizeof(GLVertex) * num_vertices);
+  GLVertex *each = (GLVertex *)PANDA_MALLOC_ARRAY(sizeof(GLVertex) * num_vertices);
+  GLVertex *array = (GLVertex *)PANDA_MALLOC_ARRAY(sizeof(GLVertex) * num_vertices);
+  memset(source, 0, sizeof(GLVertex) * num_vertices);
+  make_vertices(source);
+
+  struct Case {
+    const char *_name;
+    int _lighting;
+    int _normalize;
+    int _no_w_transform;
+  };
+  static const Case cases[] = {
+    { "unlit", 0, 0, 0 },
+    { "unlit, no w", 0, 0, 1 },
+    { "lit", 1, 0, 0 },
+    { "lit, normalize", 1, 1, 0 },
+  };
+
+  nout << num_vertices << " vertices, millions of vertices/s one at a time "
+       << "and all together:\n";
+
+  int result = 0;
+  for (const Case &cs : cases) {
+    c->lighting_enabled = cs._lighting;
+    c->normalize_enabled = cs._normalize;
+    c->matrix_model_projection_no_w_transform = cs._no_w_transform;
+
+    double each_rate = measure(c, source, each, false);
+    double array_rate = measure(c, source, array, true);
+
+    nout << "  " << std::left << std::setw(16) << cs._name << std::right
+         << std::fixed << std::setprecision(1) << std::setw(8)
+         << each_rate / 1000000.0 << std::setw(8) << array_rate / 1000000.0
+         << std::setprecision(2) << "  (" << array_rate / each_rate << "x)";
+
+    // Transforming them all together must give exactly the same result.
+    if (!compare(each, array, cs._lighting != 0)) {
+      nout << "  (mismatch)";
+      result = 1;
+    }
+    nout << "\n";
+  }
+
+  PANDA_FREE_ARRAY(array);
+  PANDA_FREE_ARRAY(each);
+  PANDA_FREE_ARRAY(source);
+  PANDA_FREE_SINGLE(c);
+  return result;
+}
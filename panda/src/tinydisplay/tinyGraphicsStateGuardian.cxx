@@ -39,6 +39,7 @@
 #include "ztriangle_table.h"
 #include "store_pixel_table.h"
 #include "graphicsEngine.h"
+#include "asyncParallelFor.h"
 
 using std::max;
 using std::min;
@@ -687,6 +688,9 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
 
   bool lighting_enabled = (needs_normal && _c->lighting_enabled);
 
+  // The vertices are transformed all together once the rest of their data is
+  // filled in, and then lit one at a time.
+
   for (i = 0; i < num_used_vertices; ++i) {
     GLVertex *v = &_vertices[i];
     const LVecBase4 &d = rvertex.get_data4();
@@ -708,40 +712,48 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
       _c->current_color.v[1] = max(d[1] * s[1], (PN_stdfloat)0);
       _c->current_color.v[2] = max(d[2] * s[2], (PN_stdfloat)0);
       _c->current_color.v[3] = max(d[3] * s[3], (PN_stdfloat)0);
-
-      if (_color_material_flags) {
-        if (_color_material_flags & CMF_ambient) {
-          _c->materials[0].ambient = _c->current_color;
-          _c->materials[1].ambient = _c->current_color;
-        }
-        if (_color_material_flags & CMF_diffuse) {
-          _c->materials[0].diffuse = _c->current_color;
-          _c->materials[1].diffuse = _c->current_color;
-        }
-      }
     }
 
     v->color = _c->current_color;
 
     if (lighting_enabled) {
       const LVecBase3 &d = rnormal.get_data3();
-      _c->current_normal.v[0] = d[0];
-      _c->current_normal.v[1] = d[1];
-      _c->current_normal.v[2] = d[2];
-      _c->current_normal.v[3] = 0.0f;
+      v->normal.v[0] = d[0];
+      v->normal.v[1] = d[1];
+      v->normal.v[2] = d[2];
+
+    } else if (_c->lighting_enabled) {
+      v->normal.v[0] = _c->current_normal.v[0];
+      v->normal.v[1] = _c->current_normal.v[1];
+      v->normal.v[2] = _c->current_normal.v[2];
+    }
 
-      gl_vertex_transform(_c, v);
-      gl_shade_vertex(_c, v);
+    v->edge_flag = 1;
+  }
 
-    } else {
-      gl_vertex_transform(_c, v);
+  gl_vertex_transform_array(_c, _vertices, num_used_vertices);
+
+  for (i = 0; i < num_used_vertices; ++i) {
+    GLVertex *v = &_vertices[i];
+
+    if (lighting_enabled) {
+      if (needs_color && _color_material_flags) {
+        // The material tracks the color of each vertex in turn.
+        if (_color_material_flags & CMF_ambient) {
+          _c->materials[0].ambient = v->color;
+          _c->materials[1].ambient = v->color;
+        }
+        if (_color_material_flags & CMF_diffuse) {
+          _c->materials[0].diffuse = v->color;
+          _c->materials[1].diffuse = v->color;
+        }
+      }
+      gl_shade_vertex(_c, v);
     }
 
     if (v->clip_code == 0) {
       gl_transform_to_viewport(_c, v);
     }
-
-    v->edge_flag = 1;
   }
 
   // Set up the appropriate function callback for filling triangles, according
@@ -937,6 +949,16 @@ begin_draw_primitives(const GeomPipelineReader *geom_reader,
   pixel_count_smooth_multitex3 = 0;
 #endif  // DO_PSTATS
 
+  // If the triangles are to be filled in parallel, collect them in the bin
+  // for now.  This is only done for solid polygons, which are filled
+  // entirely by zb_fill_tri.
+  if (td_num_bands > 1 && _c->draw_triangle_front == gl_draw_triangle_fill &&
+      _c->draw_triangle_back == gl_draw_triangle_fill) {
+    _c->triangle_bin = &_triangle_bin;
+  } else {
+    _c->triangle_bin = nullptr;
+  }
+
   return true;
 }
 
@@ -1175,6 +1197,9 @@ draw_lines(const GeomPrimitivePipelineReader *reader, bool force) {
   }
 #endif  // NDEBUG
 
+  // Any triangles of the same Geom must be filled first.
+  fill_triangle_bin();
+
   int num_vertices = reader->get_num_vertices();
   _vertices_other_pcollector.add_level(num_vertices);
 
@@ -1252,6 +1277,9 @@ draw_points(const GeomPrimitivePipelineReader *reader, bool force) {
   }
 #endif  // NDEBUG
 
+  // Any triangles of the same Geom must be filled first.
+  fill_triangle_bin();
+
   int num_vertices = reader->get_num_vertices();
   _vertices_other_pcollector.add_level(num_vertices);
 
@@ -1319,6 +1347,8 @@ draw_points(const GeomPrimitivePipelineReader *reader, bool force) {
  */
 void TinyGraphicsStateGuardian::
 end_draw_primitives() {
+  fill_triangle_bin();
+  _c->triangle_bin = nullptr;
 
 #ifdef DO_PSTATS
   _pixel_count_white_untextured_pcollector.add_level(pixel_count_white_untextured);
@@ -2970,6 +3000,86 @@ setup_material(GLMaterial *gl_material, const Material *material) {
   }
 }
 
+/**
+ * Fills the triangles that have been collected in the triangle bin, if any,
+ * and empties the bin.
+ *
+ * The frame buffer is divided into td-num-bands horizontal bands, which are
+ * filled on the threads of the "tinydisplay" task chain.  Each band is given
+ * every triangle that overlaps it, in the order in which they were drawn, and
+ * the rows of each triangle that fall within the band are filled exactly as
+ * they would have been had the triangle been filled all at once.  Thus the
+ * result does not depend on the number of bands or threads.
+ */
+void TinyGraphicsStateGuardian::
+fill_triangle_bin() {
+  if (_triangle_bin.empty()) {
+    return;
+  }
+
+  ParallelFill parallel;
+  parallel._zb = _c->zb;
+  parallel._fill_tri = _c->zb_fill_tri;
+  parallel._points = &_triangle_bin[0];
+  parallel._num_triangles = _triangle_bin.size() / 3;
+
+  // Don't bother with the threads unless there are at least as many rows to
+  // fill as there are in the whole frame buffer.
+  size_t num_rows = 0;
+  for (size_t ti = 0; ti < parallel._num_triangles; ++ti) {
+    const ZBufferPoint *p = parallel._points + ti * 3;
+    int ymin = std::min(p[0].y, std::min(p[1].y, p[2].y));
+    int ymax = std::max(p[0].y, std::max(p[1].y, p[2].y));
+    num_rows += (size_t)(ymax - ymin + 1);
+  }
+
+  int ysize = parallel._zb->ysize;
+  parallel._num_bands = std::min((int)td_num_bands, ysize);
+  if (parallel._num_bands <= 1 || num_rows < (size_t)ysize) {
+    parallel._num_bands = 1;
+    fill_bands(0, 1, &parallel);
+  } else {
+    AsyncTaskChain *chain =
+      AsyncParallelFor::get_task_chain("tinydisplay", td_num_threads);
+    AsyncParallelFor::run(chain, parallel._num_bands, 1,
+                          &fill_bands, &parallel);
+  }
+
+  _triangle_bin.clear();
+}
+
+/**
+ * The work function for fill_triangle_bin().  Fills the indicated range of
+ * bands of the frame buffer.
+ */
+void TinyGraphicsStateGuardian::
+fill_bands(size_t begin, size_t end, void *user_data) {
+  const ParallelFill *parallel = (const ParallelFill *)user_data;
+
+  // Each band gets its own copy of the ZBuffer, limited to its rows.  The
+  // frame buffer memory itself is shared.
+  ZBuffer zb = *parallel->_zb;
+  int ysize = zb.ysize;
+
+  for (size_t bi = begin; bi < end; ++bi) {
+    zb.band_ymin = (int)(((size_t)ysize * bi) / parallel->_num_bands);
+    zb.band_ymax = (int)(((size_t)ysize * (bi + 1)) / parallel->_num_bands);
+
+    const ZBufferPoint *p = parallel->_points;
+    for (size_t ti = 0; ti < parallel->_num_triangles; ++ti, p += 3) {
+      int ymin = std::min(p[0].y, std::min(p[1].y, p[2].y));
+      int ymax = std::max(p[0].y, std::max(p[1].y, p[2].y));
+      if (ymax >= zb.band_ymin && ymin < zb.band_ymax) {
+        // The fill function writes into the points, so give it copies.
+        ZBufferPoint p0 = p[0];
+        ZBufferPoint p1 = p[1];
+        ZBufferPoint p2 = p[2];
+        (*parallel->_fill_tri)(&zb, &p0, &p1, &p2);
+      }
+    }
+  }
+}
+
 /**
  * Sets the state to either rescale or normalize the normals according to the
  * current transform.
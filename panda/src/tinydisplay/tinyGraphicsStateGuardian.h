@@ -130,6 +130,9 @@ private:
 
   INLINE void clear_light_state();
 
+  void fill_triangle_bin();
+  static void fill_bands(size_t begin, size_t end, void *user_data);
+
   // Methods used to generate texture coordinates.
   class TexCoordData {
   public:
@@ -179,6 +182,20 @@ private:
   GLVertex *_vertices;
   int _vertices_size;
 
+  // The triangles collected during begin_draw_primitives() ..
+  // end_draw_primitives(), when they are to be filled in parallel.
+  typedef pvector<ZBufferPoint> TriangleBin;
+  TriangleBin _triangle_bin;
+
+  class ParallelFill {
+  public:
+    ZBuffer *_zb;
+    ZB_fillTriangleFunc _fill_tri;
+    const ZBufferPoint *_points;
+    size_t _num_triangles;
+    int _num_bands;
+  };
+
   static PStatCollector _vertices_immediate_pcollector;
   static PStatCollector _draw_transform_pcollector;
   static PStatCollector _pixel_count_white_untextured_pcollector;
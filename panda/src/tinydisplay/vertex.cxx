@@ -1,6 +1,11 @@
 #include "zgl.h"
 #include <string.h>
 
+#if (defined(__SSE2__) || (_M_IX86_FP >= 2) || defined(_M_X64) || defined(_M_AMD64)) && !defined(STDFLOAT_DOUBLE)
+#define TRANSFORM_SSE
+#include <xmmintrin.h>
+#endif
+
 void gl_eval_viewport(GLContext * c) {
   GLViewport *v = &c->viewport;
   GLScissor *s = &c->scissor;
@@ -82,3 +87,193 @@ gl_vertex_transform(GLContext * c, GLVertex * v) {
 
   v->clip_code = gl_clipcode(v->pc.v[0], v->pc.v[1], v->pc.v[2], v->pc.v[3]);
 }
+
+#ifdef TRANSFORM_SSE
+/* computes the clip codes of four vertices, as in gl_clipcode, and stores
+   their projection coordinates, given one register per axis */
+static inline void
+store_clip_coords(GLVertex *q, __m128 px, __m128 py, __m128 pz, __m128 pw) {
+  __m128 cw = _mm_mul_ps(pw, _mm_set1_ps(1.0f + CLIP_EPSILON));
+  __m128 ncw = _mm_xor_ps(cw, _mm_set1_ps(-0.0f));
+  int xmin = _mm_movemask_ps(_mm_cmplt_ps(px, ncw));
+  int xmax = _mm_movemask_ps(_mm_cmpgt_ps(px, cw));
+  int ymin = _mm_movemask_ps(_mm_cmplt_ps(py, ncw));
+  int ymax = _mm_movemask_ps(_mm_cmpgt_ps(py, cw));
+  int zmin = _mm_movemask_ps(_mm_cmplt_ps(pz, ncw));
+  int zmax = _mm_movemask_ps(_mm_cmpgt_ps(pz, cw));
+
+  _MM_TRANSPOSE4_PS(px, py, pz, pw);
+  _mm_storeu_ps(q[0].pc.v, px);
+  _mm_storeu_ps(q[1].pc.v, py);
+  _mm_storeu_ps(q[2].pc.v, pz);
+  _mm_storeu_ps(q[3].pc.v, pw);
+
+  for (int j = 0; j < 4; ++j) {
+    q[j].clip_code =
+      ((xmin >> j) & 1) |
+      (((xmax >> j) & 1) << 1) |
+      (((ymin >> j) & 1) << 2) |
+      (((ymax >> j) & 1) << 3) |
+      (((zmin >> j) & 1) << 4) |
+      (((zmax >> j) & 1) << 5);
+  }
+}
+
+/* computes a*x + b*y + c*z for four vertices at once, in the same order of
+   operations as gl_vertex_transform */
+static inline __m128
+dot_row(__m128 x, __m128 y, __m128 z, __m128 a, __m128 b, __m128 c) {
+  return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, a), _mm_mul_ps(y, b)),
+                    _mm_mul_ps(z, c));
+}
+
+/* computes a*x + b*y + c*z + d, likewise */
+static inline __m128
+transform_row(__m128 x, __m128 y, __m128 z, __m128 a, __m128 b, __m128 c,
+              __m128 d) {
+  return _mm_add_ps(dot_row(x, y, z, a, b, c), d);
+}
+#endif  /* TRANSFORM_SSE */
+
+/* the same as calling gl_vertex_transform on each of the vertices in turn,
+   except that with lighting, the normal of each vertex is taken from (and
+   replaced in) v->normal, instead of from c->current_normal.  Four vertices
+   are transformed at a time with SSE, in the same order of operations, so
+   that the results are exactly the same. */
+void
+gl_vertex_transform_array(GLContext * c, GLVertex * v, int num_vertices) {
+  int i = 0;
+
+#ifdef TRANSFORM_SSE
+  if (c->lighting_enabled) {
+    const PN_stdfloat *m = &c->matrix_model_view.m[0][0];
+    __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]);
+    __m128 m2 = _mm_set1_ps(m[2]), m3 = _mm_set1_ps(m[3]);
+    __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]);
+    __m128 m6 = _mm_set1_ps(m[6]), m7 = _mm_set1_ps(m[7]);
+    __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]);
+    __m128 m10 = _mm_set1_ps(m[10]), m11 = _mm_set1_ps(m[11]);
+    __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]);
+    __m128 m14 = _mm_set1_ps(m[14]), m15 = _mm_set1_ps(m[15]);
+
+    const PN_stdfloat *p = &c->matrix_projection.m[0][0];
+    __m128 p0 = _mm_set1_ps(p[0]), p1 = _mm_set1_ps(p[1]);
+    __m128 p2 = _mm_set1_ps(p[2]), p3 = _mm_set1_ps(p[3]);
+    __m128 p4 = _mm_set1_ps(p[4]), p5 = _mm_set1_ps(p[5]);
+    __m128 p6 = _mm_set1_ps(p[6]), p7 = _mm_set1_ps(p[7]);
+    __m128 p8 = _mm_set1_ps(p[8]), p9 = _mm_set1_ps(p[9]);
+    __m128 p10 = _mm_set1_ps(p[10]), p11 = _mm_set1_ps(p[11]);
+    __m128 p12 = _mm_set1_ps(p[12]), p13 = _mm_set1_ps(p[13]);
+    __m128 p14 = _mm_set1_ps(p[14]), p15 = _mm_set1_ps(p[15]);
+
+    const PN_stdfloat *n = &c->matrix_model_view_inv.m[0][0];
+    __m128 n0 = _mm_set1_ps(n[0]), n1 = _mm_set1_ps(n[1]);
+    __m128 n2 = _mm_set1_ps(n[2]), n4 = _mm_set1_ps(n[4]);
+    __m128 n5 = _mm_set1_ps(n[5]), n6 = _mm_set1_ps(n[6]);
+    __m128 n8 = _mm_set1_ps(n[8]), n9 = _mm_set1_ps(n[9]);
+    __m128 n10 = _mm_set1_ps(n[10]);
+    __m128 normal_scale = _mm_set1_ps(c->normal_scale);
+
+    for (; i + 4 <= num_vertices; i += 4) {
+      GLVertex *q = v + i;
+
+      /* eye coordinates, needed for lighting */
+      __m128 x = _mm_loadu_ps(q[0].coord.v);
+      __m128 y = _mm_loadu_ps(q[1].coord.v);
+      __m128 z = _mm_loadu_ps(q[2].coord.v);
+      __m128 w = _mm_loadu_ps(q[3].coord.v);
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+
+      __m128 ex = transform_row(x, y, z, m0, m1, m2, m3);
+      __m128 ey = transform_row(x, y, z, m4, m5, m6, m7);
+      __m128 ez = transform_row(x, y, z, m8, m9, m10, m11);
+      __m128 ew = transform_row(x, y, z, m12, m13, m14, m15);
+
+      /* projection coordinates */
+      __m128 px = _mm_add_ps(dot_row(ex, ey, ez, p0, p1, p2), _mm_mul_ps(ew, p3));
+      __m128 py = _mm_add_ps(dot_row(ex, ey, ez, p4, p5, p6), _mm_mul_ps(ew, p7));
+      __m128 pz = _mm_add_ps(dot_row(ex, ey, ez, p8, p9, p10), _mm_mul_ps(ew, p11));
+      __m128 pw = _mm_add_ps(dot_row(ex, ey, ez, p12, p13, p14), _mm_mul_ps(ew, p15));
+
+      /* normals; the fourth value loaded for each is not a part of it */
+      __m128 nx = _mm_loadu_ps(q[0].normal.v);
+      __m128 ny = _mm_loadu_ps(q[1].normal.v);
+      __m128 nz = _mm_loadu_ps(q[2].normal.v);
+      __m128 nw = _mm_loadu_ps(q[3].normal.v);
+      _MM_TRANSPOSE4_PS(nx, ny, nz, nw);
+
+      __m128 tx = _mm_mul_ps(dot_row(nx, ny, nz, n0, n1, n2), normal_scale);
+      __m128 ty = _mm_mul_ps(dot_row(nx, ny, nz, n4, n5, n6), normal_scale);
+      __m128 tz = _mm_mul_ps(dot_row(nx, ny, nz, n8, n9, n10), normal_scale);
+
+      _MM_TRANSPOSE4_PS(ex, ey, ez, ew);
+      _mm_storeu_ps(q[0].ec.v, ex);
+      _mm_storeu_ps(q[1].ec.v, ey);
+      _mm_storeu_ps(q[2].ec.v, ez);
+      _mm_storeu_ps(q[3].ec.v, ew);
+
+      store_clip_coords(q, px, py, pz, pw);
+
+      /* the normals are stored one value at a time, since storing four
+         values at once would overwrite the coordinates that follow them */
+      float nv[3][4];
+      _mm_storeu_ps(nv[0], tx);
+      _mm_storeu_ps(nv[1], ty);
+      _mm_storeu_ps(nv[2], tz);
+      for (int j = 0; j < 4; ++j) {
+        q[j].normal.v[0] = nv[0][j];
+        q[j].normal.v[1] = nv[1][j];
+        q[j].normal.v[2] = nv[2][j];
+        if (c->normalize_enabled) {
+          gl_V3_Norm(&q[j].normal);
+        }
+      }
+    }
+
+  } else {
+    const PN_stdfloat *m = &c->matrix_model_projection.m[0][0];
+    __m128 m0 = _mm_set1_ps(m[0]), m1 = _mm_set1_ps(m[1]);
+    __m128 m2 = _mm_set1_ps(m[2]), m3 = _mm_set1_ps(m[3]);
+    __m128 m4 = _mm_set1_ps(m[4]), m5 = _mm_set1_ps(m[5]);
+    __m128 m6 = _mm_set1_ps(m[6]), m7 = _mm_set1_ps(m[7]);
+    __m128 m8 = _mm_set1_ps(m[8]), m9 = _mm_set1_ps(m[9]);
+    __m128 m10 = _mm_set1_ps(m[10]), m11 = _mm_set1_ps(m[11]);
+    __m128 m12 = _mm_set1_ps(m[12]), m13 = _mm_set1_ps(m[13]);
+    __m128 m14 = _mm_set1_ps(m[14]), m15 = _mm_set1_ps(m[15]);
+    int no_w_transform = c->matrix_model_projection_no_w_transform;
+
+    for (; i + 4 <= num_vertices; i += 4) {
+      GLVertex *q = v + i;
+
+      /* turn the coordinates of four vertices into one register per axis */
+      __m128 x = _mm_loadu_ps(q[0].coord.v);
+      __m128 y = _mm_loadu_ps(q[1].coord.v);
+      __m128 z = _mm_loadu_ps(q[2].coord.v);
+      __m128 w = _mm_loadu_ps(q[3].coord.v);
+      _MM_TRANSPOSE4_PS(x, y, z, w);
+
+      __m128 px = transform_row(x, y, z, m0, m1, m2, m3);
+      __m128 py = transform_row(x, y, z, m4, m5, m6, m7);
+      __m128 pz = transform_row(x, y, z, m8, m9, m10, m11);
+      __m128 pw;
+      if (no_w_transform) {
+        pw = m15;
+      } else {
+        pw = transform_row(x, y, z, m12, m13, m14, m15);
+      }
+
+      store_clip_coords(q, px, py, pz, pw);
+    }
+  }
+#endif  /* TRANSFORM_SSE */
+
+  for (; i < num_vertices; ++i) {
+    if (c->lighting_enabled) {
+      c->current_normal.v[0] = v[i].normal.v[0];
+      c->current_normal.v[1] = v[i].normal.v[1];
+      c->current_normal.v[2] = v[i].normal.v[2];
+      c->current_normal.v[3] = 0.0f;
+    }
+    gl_vertex_transform(c, v + i);
+  }
+}
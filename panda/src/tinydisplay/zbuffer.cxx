@@ -48,6 +48,8 @@ ZB_open(int xsize, int ysize, int mode,
   zb->ysize = ysize;
   zb->mode = mode;
   zb->linesize = (xsize * PSZB + 3) & ~3;
+  zb->band_ymin = 0;
+  zb->band_ymax = ysize;
 
   switch (mode) {
 #ifdef TGL_FEATURE_8_BITS
@@ -118,6 +120,8 @@ ZB_resize(ZBuffer * zb, void *frame_buffer, int xsize, int ysize) {
   zb->xsize = xsize;
   zb->ysize = ysize;
   zb->linesize = (xsize * PSZB + 3) & ~3;
+  zb->band_ymin = 0;
+  zb->band_ymax = ysize;
 
   size = zb->xsize * zb->ysize * sizeof(ZPOINT);
   gl_free(zb->zbuf);
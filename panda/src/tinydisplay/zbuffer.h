@@ -174,6 +174,10 @@ struct ZBuffer {
   int reference_alpha;
   int blend_r, blend_g, blend_b, blend_a;
   ZB_storePixelFunc store_pix_func;
+
+  /* only the rows band_ymin <= y < band_ymax are filled by the triangle
+     functions; normally this is the whole buffer */
+  int band_ymin, band_ymax;
 };
 
 struct ZBufferPoint {
@@ -10,6 +10,7 @@
 #include "zbuffer.h"
 #include "zmath.h"
 #include "zfeatures.h"
+#include "pvector.h"
 
 /* initially # of allocated GLVertexes (will grow when necessary) */
 #define POLYGON_MAX_VERTEX 16
@@ -180,6 +181,10 @@ typedef struct GLContext {
   gl_draw_triangle_func draw_triangle_front,draw_triangle_back;
   ZB_fillTriangleFunc zb_fill_tri;
 
+  /* if not null, gl_draw_triangle_fill appends the three points of each
+     triangle here to be filled later, rather than filling it right away */
+  pvector<ZBufferPoint> *triangle_bin;
+
   /* current vertex state */
   V4 current_color;
   V4 current_normal;
@@ -221,6 +226,7 @@ void gl_shade_vertex(GLContext *c,GLVertex *v);
 /* vertex.c */
 void gl_eval_viewport(GLContext *c);
 void gl_vertex_transform(GLContext * c, GLVertex * v);
+void gl_vertex_transform_array(GLContext * c, GLVertex * v, int num_vertices);
 
 /* image_util.c */
 void gl_convertRGB_to_5R6G5B(unsigned short *pixmap,unsigned char *rgb,
@@ -9,7 +9,7 @@
   PIXEL *pp1;
   int part, update_left, update_right;
 
-  int nb_lines, dx1, dy1, tmp, dx2, dy2;
+  int nb_lines, dx1, dy1, tmp, dx2, dy2, line_y;
 
   int error, derror;
   int x1, dxdy_min, dxdy_max;
@@ -53,8 +53,6 @@
 
   EARLY_OUT();
 
-  COUNT_PIXELS(PIXEL_COUNT, p0, p1, p2);
-
   /* we sort the vertex with increasing y */
   if (p1->y < p0->y) {
     t = p0;
@@ -72,6 +70,12 @@
     p2 = t;
   }
 
+  /* when the buffer is filled one band at a time, count the triangle only
+     in the first band it touches */
+  if (p0->y >= zb->band_ymin) {
+    COUNT_PIXELS(PIXEL_COUNT, p0, p1, p2);
+  }
+
   /* we compute dXdx and dXdy for all interpolated values */
   
   fdx1 = (PN_stdfloat) (p1->x - p0->x);
@@ -213,6 +217,7 @@
 
   pp1 = (PIXEL *) ((char *) zb->pbuf + zb->linesize * p0->y);
   pz1 = zb->zbuf + p0->y * zb->xsize;
+  line_y = p0->y;
 
   DRAW_INIT();
 
@@ -341,6 +346,12 @@
 
     while (nb_lines>0) {
       nb_lines--;
+      if (line_y >= zb->band_ymax) {
+        return;
+      }
+      /* the edges are still stepped through the rows above the band, so
+         that the rows within it come out exactly as when drawn whole */
+      if (line_y >= zb->band_ymin) {
 #ifndef DRAW_LINE
       /* generic draw line */
       {
@@ -417,6 +428,7 @@
 #else
       DRAW_LINE();
 #endif
+      }
       
       /* left edge */
       error+=derror;
@@ -483,6 +495,7 @@
       /* screen coordinates */
       pp1=(PIXEL *)((char *)pp1 + zb->linesize);
       pz1+=zb->xsize;
+      line_y++;
     }
   }
 }
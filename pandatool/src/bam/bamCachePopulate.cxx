@@ -0,0 +1,269 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file bamCachePopulate.cxx
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#include "bamCachePopulate.h"
+
+#include "bamCache.h"
+#include "loader.h"
+#include "loaderFileType.h"
+#include "loaderFileTypeRegistry.h"
+#include "loaderOptions.h"
+#include "texturePool.h"
+#include "pnmFileTypeRegistry.h"
+#include "virtualFileSystem.h"
+#include "asyncParallelFor.h"
+#include "trueClock.h"
+#include "load_prc_file.h"
+
+/**
+ *
+ */
+BamCachePopulate::
+BamCachePopulate() {
+  set_program_brief("fill the model cache ahead of time");
+  set_program_description
+    ("This program searches the named directories for model and texture "
+     "files, and loads each one, using several threads at once, so that "
+     "the cached versions are written to the model cache.  Subsequent "
+     "loads of these files, by this or any other process using the same "
+     "cache, will then be fast.\n\n"
+
+     "By default, the cache is put in concurrent mode, in which many "
+     "processes may share the cache without contention; see "
+     "model-cache-concurrent.");
+
+  clear_runlines();
+  add_runline("[opts] dir [dir ... ]");
+
+  add_option
+    ("d", "dir", 0,
+     "Specify the model cache directory.  The default is the value of "
+     "model-cache-dir.",
+     &BamCachePopulate::dispatch_filename, nullptr, &_cache_dir);
+
+  add_option
+    ("j", "threads", 0,
+     "Specify the number of threads to load with.  The default, 0, uses "
+     "one thread per CPU.",
+     &BamCachePopulate::dispatch_int, nullptr, &_num_threads);
+
+  add_option
+    ("i", "", 0,
+     "Use the indexed cache mode, rather than the concurrent mode.  Use this "
+     "if the applications using the cache do not set model-cache-concurrent.",
+     &BamCachePopulate::dispatch_none, &_indexed);
+
+  add_option
+    ("compress", "", 0,
+     "Compress the textures on the CPU, and store them in the cache in "
+     "compressed form, for applications that set "
+     "model-cache-compressed-textures.",
+     &BamCachePopulate::dispatch_none, &_compress);
+
+  add_option
+    ("nomodels", "", 0,
+     "Don't load model files.",
+     &BamCachePopulate::dispatch_none, &_no_models);
+
+  add_option
+    ("notextures", "", 0,
+     "Don't load texture files, other than those referenced by models.",
+     &BamCachePopulate::dispatch_none, &_no_textures);
+
+  _num_threads = 0;
+  _indexed = false;
+  _compress = false;
+  _no_models = false;
+  _no_textures = false;
+  _num_failed = 0;
+}
+
+/**
+ *
+ */
+void BamCachePopulate::
+run() {
+  if (_compress) {
+    // There's no GSG to compress the textures for us, so do it ourselves.
+    load_prc_file_data("bam-cache-populate",
+                       "compressed-textures 1\n"
+                       "driver-compress-textures 0\n");
+  }
+
+  BamCache *cache = BamCache::get_global_ptr();
+  cache->set_concurrent(!_indexed);
+  if (_compress) {
+    // The textures are compressed as they are read, so they are stored in
+    // compressed form even though we also allow uncompressed textures here.
+    cache->set_cache_textures(true);
+    cache->set_cache_compressed_textures(true);
+  }
+  if (!_cache_dir.empty()) {
+    cache->set_root(_cache_dir);
+    cache->set_active(true);
+  }
+  if (!cache->get_active() || cache->get_root().empty()) {
+    nout << "No model cache directory; specify one with -d or model-cache-dir.\n";
+    exit(1);
+  }
+
+  if (!_no_textures && !cache->get_cache_textures() &&
+      !cache->get_cache_compressed_textures()) {
+    nout << "Textures are not cached; set model-cache-textures, or use "
+            "-compress.\n";
+    _no_textures = true;
+  }
+
+  Filenames::const_iterator fi;
+  for (fi = _roots.begin(); fi != _roots.end(); ++fi) {
+    scan(*fi);
+  }
+
+  size_t num_files = _models.size() + _textures.size();
+  nout << "Loading " << num_files << " files into " << cache->get_root()
+       << "\n";
+
+  TrueClock *clock = TrueClock::get_global_ptr();
+  double start = clock->get_short_time();
+
+  // Items are handed out in order, so the models, which are generally the
+  // slowest to load and which load their own textures too, are started first.
+  AsyncTaskChain *chain =
+    AsyncParallelFor::get_task_chain("bam_cache_populate", _num_threads);
+  AsyncParallelFor::run(chain, num_files, 1, &load_files, this);
+
+  cache->flush_index();
+  TexturePool::garbage_collect();
+
+  double elapsed = clock->get_short_time() - start;
+  nout << num_files - (size_t)_num_failed << " files loaded in "
+       << elapsed << " s";
+  if (_num_failed != 0) {
+    nout << ", " << _num_failed << " failed";
+  }
+  nout << ".\n";
+
+  if (_num_failed != 0) {
+    exit(1);
+  }
+}
+
+/**
+ *
+ */
+bool BamCachePopulate::
+handle_args(ProgramBase::Args &args) {
+  if (args.empty()) {
+    nout << "You must specify the directories to search on the command line.\n";
+    return false;
+  }
+
+  ProgramBase::Args::const_iterator ai;
+  for (ai = args.begin(); ai != args.end(); ++ai) {
+    _roots.push_back(Filename::from_os_specific(*ai));
+  }
+
+  return true;
+}
+
+/**
+ * Adds the indicated file, or all of the model and texture files within the
+ * indicated directory tree, to the list of files to load.
+ */
+void BamCachePopulate::
+scan(const Filename &filename) {
+  VirtualFileSystem *vfs = VirtualFileSystem::get_global_ptr();
+
+  if (vfs->is_directory(filename)) {
+    PT(VirtualFileList) contents = vfs->scan_directory(filename);
+    if (contents == nullptr) {
+      nout << "Unable to read directory " << filename << "\n";
+      return;
+    }
+    int num_files = contents->get_num_files();
+    for (int ci = 0; ci < num_files; ++ci) {
+      scan(contents->get_file(ci)->get_filename());
+    }
+    return;
+  }
+
+  std::string extension = filename.get_extension();
+  if (extension == "pz" || extension == "gz") {
+    extension = Filename(filename.get_basename_wo_extension()).get_extension();
+  }
+  if (extension.empty()) {
+    return;
+  }
+
+  LoaderFileTypeRegistry *model_reg = LoaderFileTypeRegistry::get_global_ptr();
+  LoaderFileType *model_type = model_reg->get_type_from_extension(extension);
+  if (model_type != nullptr) {
+    // Bam files and the like are not cached, so there's no point in loading
+    // them here.
+    if (!_no_models && model_type->get_allow_disk_cache(LoaderOptions())) {
+      _models.push_back(filename);
+    }
+    return;
+  }
+
+  PNMFileTypeRegistry *image_reg = PNMFileTypeRegistry::get_global_ptr();
+  if (!_no_textures &&
+      (image_reg->get_type_from_extension(filename) != nullptr ||
+       extension == "dds" || extension == "ktx")) {
+    _textures.push_back(filename);
+  }
+}
+
+/**
+ * The work function passed to AsyncParallelFor by run(), to load some of the
+ * files.
+ */
+void BamCachePopulate::
+load_files(size_t begin, size_t end, void *user_data) {
+  BamCachePopulate *self = (BamCachePopulate *)user_data;
+  Loader *loader = Loader::get_global_ptr();
+  LoaderOptions options(LoaderOptions::LF_search | LoaderOptions::LF_report_errors |
+                        LoaderOptions::LF_no_ram_cache);
+  if (self->_compress) {
+    options.set_texture_flags(options.get_texture_flags() |
+                              LoaderOptions::TF_preload |
+                              LoaderOptions::TF_allow_compression);
+  }
+
+  for (size_t i = begin; i < end; ++i) {
+    bool success;
+    if (i < self->_models.size()) {
+      const Filename &filename = self->_models[i];
+      success = (loader->load_sync(filename, options) != nullptr);
+    } else {
+      const Filename &filename = self->_textures[i - self->_models.size()];
+      PT(Texture) tex = TexturePool::load_texture(filename, 0, false, options);
+      success = (tex != nullptr);
+      if (success) {
+        // We only want it in the cache, not in memory.
+        TexturePool::release_texture(tex);
+      }
+    }
+
+    if (!success) {
+      AtomicAdjust::inc(self->_num_failed);
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  BamCachePopulate prog;
+  prog.parse_command_line(argc, argv);
+  prog.run();
+  return 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * PANDA 3D SOFTWARE
+ * Copyright (c) Carnegie Mellon University.  All rights reserved.
+ *
+ * All use of this software is subject to the terms of the revised BSD
+ * license.  You should have received a copy of this license along
+ * with this source code in a file named "LICENSE."
+ *
+ * @file bamCachePopulate.h
+ * @author bluekyu
+ * @date 2026-10-18
+ */
+
+#ifndef BAMCACHEPOPULATE_H
+#define BAMCACHEPOPULATE_H
+
+#include "pandatoolbase.h"
+
+#include "programBase.h"
+#include "filename.h"
+#include "atomicAdjust.h"
+#include "pvector.h"
+
+/**
+ * Walks one or more directory trees, and loads every model and texture file
+ * it finds, on several threads at once, so that the model cache is populated
+ * before the files are needed by the application.
+ */
+class BamCachePopulate : public ProgramBase {
+public:
+  BamCachePopulate();
+
+  void run();
+
+protected:
+  virtual bool handle_args(Args &args);
+
+private:
+  void scan(const Filename &filename);
+  static void load_files(size_t begin, size_t end, void *user_data);
+
+  typedef pvector<Filename> Filenames;
+  Filenames _roots;
+  Filenames _models;
+  Filenames _textures;
+
+  Filename _cache_dir;
+  int _num_threads;
+  bool _indexed;
+  bool _compress;
+  bool _no_models;
+  bool _no_textures;
+
+  AtomicAdjust::Integer _num_failed;
+};
+
+#endif
@@ -0,0 +1,160 @@
+from panda3d import core
+
+
+def make_bundle(num_frames):
+    bundle = core.AnimBundle("bundle", 24, num_frames)
+    root = core.AnimGroup(bundle, "<skeleton>")
+
+    joint1 = core.AnimChannelMatrixXfmTable(root, "joint1")
+    joint1.set_table('h', core.PTA_stdfloat([i * 10.0 for i in range(num_frames)]))
+    joint1.set_table('x', core.PTA_stdfloat([1.5]))
+
+    joint2 = core.AnimChannelMatrixXfmTable(joint1, "joint2")
+    joint2.set_table('i', core.PTA_stdfloat([2.0]))
+    joint2.set_table('z', core.PTA_stdfloat([i * 0.5 for i in range(num_frames)]))
+
+    return bundle, [joint1, joint2]
+
+
+def test_anim_joint_table_values():
+    num_frames = 8
+    bundle, joints = make_bundle(num_frames)
+    assert bundle.joint_table is None
+
+    expected = []
+    for joint in joints:
+        mats = []
+        for frame in range(num_frames):
+            mat = core.LMatrix4()
+            joint.get_value(frame, mat)
+            mats.append(mat)
+        expected.append(mats)
+
+    bundle.pack_joints()
+    table = bundle.joint_table
+    assert table is not None
+    assert table.num_frames == num_frames
+    assert table.num_joints == 2
+    assert table.get_component(3, 0, 6) == 30.0
+    assert table.get_component(3, 1, 0) == 2.0
+
+    for j, joint in enumerate(joints):
+        for frame in range(num_frames):
+            mat = core.LMatrix4()
+            joint.get_value(frame, mat)
+            assert mat.almost_equal(expected[j][frame])
+
+            table.get_value(frame, j, mat)
+            assert mat.almost_equal(expected[j][frame])
+
+
+def test_anim_joint_table_set_table():
+    bundle, joints = make_bundle(4)
+    bundle.pack_joints()
+
+    # Modifying a table must take effect, even though the bundle was packed.
+    joints[0].set_table('x', core.PTA_stdfloat([5.0]))
+    pos = core.LVecBase3()
+    joints[0].get_pos(2, pos)
+    assert pos == (5, 0, 0)
+
+    joints[1].get_pos(2, pos)
+    assert pos == (0, 0, 1)
+
+
+def test_anim_joint_table_matches_channels():
+    num_frames = 5
+    bundle = core.AnimBundle("bundle", 24, num_frames)
+    root = core.AnimGroup(bundle, "<skeleton>")
+
+    # Every component, animated or constant, in several joints.
+    joints = []
+    parent = root
+    for j in range(4):
+        joint = core.AnimChannelMatrixXfmTable(parent, "joint%d" % (j))
+        for c, name in enumerate("ijkabchprxyz"):
+            if (c + j) % 3 == 0:
+                continue
+            if (c + j) % 2 == 0:
+                values = [1.0 + 0.1 * (c + j)]
+            else:
+                values = [0.25 * (f + 1) * (c - j) for f in range(num_frames)]
+            joint.set_table(name, core.PTA_stdfloat(values))
+        joints.append(joint)
+        parent = joint
+
+    expected = []
+    for joint in joints:
+        mats = []
+        for frame in range(num_frames):
+            mat = core.LMatrix4()
+            joint.get_value(frame, mat)
+            mats.append(mat)
+        expected.append(mats)
+
+    bundle.pack_joints()
+    table = bundle.joint_table
+    assert table.num_joints == len(joints)
+
+    for j, joint in enumerate(joints):
+        for frame in range(num_frames):
+            mat = core.LMatrix4()
+            table.get_value(frame, j, mat)
+            assert mat.almost_equal(expected[j][frame])
+
+            joint.get_value(frame, mat)
+            assert mat.almost_equal(expected[j][frame])
+
+
+def make_character(num_joints):
+    char = core.Character("char")
+    bundle = char.get_bundle(0)
+    parent = bundle
+    joints = []
+    for j in range(num_joints):
+        joint = core.CharacterJoint(char, bundle, parent, "joint%d" % (j),
+                                    core.LMatrix4.ident_mat())
+        joints.append(joint)
+        parent = joint
+    return char, bundle, joints
+
+
+def make_anim(num_joints, num_frames):
+    anim = core.AnimBundle("anim", 24, num_frames)
+    parent = anim
+    for j in range(num_joints):
+        joint = core.AnimChannelMatrixXfmTable(parent, "joint%d" % (j))
+        joint.set_table('h', core.PTA_stdfloat([f * 7.0 + j for f in range(num_frames)]))
+        joint.set_table('x', core.PTA_stdfloat([f * 0.1 for f in range(num_frames)]))
+        joint.set_table('i', core.PTA_stdfloat([1.5]))
+        parent = joint
+    return anim
+
+
+def test_anim_joint_table_part_bundle():
+    # A packed bundle is evaluated a frame at a time when the PartBundle is
+    # updated; this must give exactly the same joint matrices.
+    num_joints = 6
+    num_frames = 10
+    results = []
+    for pack in (False, True):
+        char, bundle, joints = make_character(num_joints)
+        anim = make_anim(num_joints, num_frames)
+        if pack:
+            anim.pack_joints()
+        control = bundle.bind_anim(anim, core.PartGroup.HMF_ok_wrong_root_name)
+        assert control is not None
+
+        mats = []
+        for blend_type in (core.PartBundle.BT_linear,
+                           core.PartBundle.BT_normalized_linear):
+            bundle.blend_type = blend_type
+            for frame_blend in (False, True):
+                bundle.frame_blend_flag = frame_blend
+                for i in range(25):
+                    control.pose(i * 0.4)
+                    bundle.force_update()
+                    mats.append([core.LMatrix4(joint.get_transform()) for joint in joints])
+        results.append(mats)
+
+    assert results[0] == results[1]
@@ -0,0 +1,121 @@
+from panda3d import core
+
+
+def make_character(name, num_joints):
+    char = core.Character(name)
+    bundle = char.get_bundle(0)
+
+    parent = bundle
+    nodes = []
+    for i in range(num_joints):
+        joint = core.CharacterJoint(char, bundle, parent, "joint%d" % i,
+                                    core.LMatrix4.translate_mat(1, 0, 0))
+        node = core.PandaNode("joint%d" % i)
+        joint.add_net_transform(node)
+        nodes.append(node)
+        parent = joint
+
+    return char, bundle, nodes
+
+
+def pose(bundle, num_joints, angle):
+    for i in range(num_joints):
+        bundle.freeze_joint("joint%d" % i, (1, 0, 0), (angle + i, 0, 0), (1, 1, 1))
+
+
+def test_part_bundle_collection_membership():
+    collection = core.PartBundleCollection()
+    assert collection.get_num_bundles() == 0
+    assert collection.num_threads == 1
+
+    char1, bundle1, _ = make_character("char1", 1)
+    char2, bundle2, _ = make_character("char2", 1)
+    collection.add_bundle(bundle1)
+    collection.add_bundle(bundle2)
+    collection.add_bundle(bundle1)
+    assert collection.get_num_bundles() == 2
+    assert collection.has_bundle(bundle1)
+    assert list(collection.bundles) == [bundle1, bundle2]
+
+    assert collection.remove_bundle(bundle1)
+    assert not collection.remove_bundle(bundle1)
+    assert not collection.has_bundle(bundle1)
+    collection.clear()
+    assert collection.get_num_bundles() == 0
+
+
+def test_part_bundle_collection_threads():
+    num_joints = 5
+    chars = [make_character("char%d" % i, num_joints) for i in range(20)]
+
+    results = {}
+    for num_threads in (1, 4):
+        collection = core.PartBundleCollection()
+        collection.num_threads = num_threads
+        for char, bundle, nodes in chars:
+            for node in nodes:
+                node.set_transform(core.TransformState.make_identity())
+            pose(bundle, num_joints, 30)
+            collection.add_bundle(bundle)
+
+        assert collection.force_update()
+        results[num_threads] = [[node.get_transform().get_mat() for node in nodes]
+                                for char, bundle, nodes in chars]
+
+    # The exposed joints must have been moved, and the result may not depend
+    # on the number of threads.
+    for mats1, mats4 in zip(results[1], results[4]):
+        assert not mats1[0].almost_equal(core.LMatrix4.ident_mat())
+        for mat1, mat4 in zip(mats1, mats4):
+            assert mat1.almost_equal(mat4)
+
+
+def make_anim(num_frames):
+    anim = core.AnimBundle("anim", 24, num_frames)
+    root = core.AnimGroup(anim, "<skeleton>")
+
+    joint1 = core.AnimChannelMatrixXfmTable(root, "joint1")
+    joint1.set_table('h', core.PTA_stdfloat([i * 10.0 for i in range(num_frames)]))
+    joint1.set_table('x', core.PTA_stdfloat([1.5]))
+
+    joint2 = core.AnimChannelMatrixXfmTable(joint1, "joint2")
+    joint2.set_table('z', core.PTA_stdfloat([i * 0.5 for i in range(num_frames)]))
+    return anim
+
+
+def test_anim_control_collection_update_parts():
+    num_frames = 8
+
+    results = {}
+    for num_threads in (1, 4):
+        controls = core.AnimControlCollection()
+        nodes = []
+        for i in range(num_frames):
+            char = core.Character("char%d" % i)
+            bundle = char.get_bundle(0)
+            skeleton = core.PartGroup(bundle, "<skeleton>")
+            joint1 = core.CharacterJoint(char, bundle, skeleton, "joint1",
+                                         core.LMatrix4.ident_mat())
+            joint2 = core.CharacterJoint(char, bundle, joint1, "joint2",
+                                         core.LMatrix4.ident_mat())
+            node = core.PandaNode("joint2")
+            joint2.add_net_transform(node)
+            nodes.append((char, node))
+
+            # Two anims on the same bundle; it must still be updated once.
+            for name in ("walk", "run"):
+                control = bundle.bind_anim(make_anim(num_frames),
+                                           core.PartGroup.HMF_ok_wrong_root_name)
+                assert control is not None
+                controls.store_anim(control, "%s%d" % (name, i))
+            controls.pose("walk%d" % i, i)
+
+        assert controls.update_parts(num_threads)
+        assert not controls.update_parts(num_threads)
+        results[num_threads] = [node.get_transform().get_mat() for char, node in nodes]
+
+    # Each character is on a different frame, and the result may not depend
+    # on the number of threads.
+    assert not results[1][1].almost_equal(results[1][2])
+    for mat1, mat4 in zip(results[1], results[4]):
+        assert mat1.almost_equal(mat4)
@@ -0,0 +1,98 @@
+from collisions import *
+from panda3d.core import ConfigVariableInt
+
+
+def make_grid_node(size):
+    # A flat grid of size x size unit quads, facing up.
+    node = CollisionNode("grid")
+    for x in range(size):
+        for y in range(size):
+            node.add_solid(CollisionPolygon(
+                Point3(x, y, 0), Point3(x + 1, y, 0),
+                Point3(x + 1, y + 1, 0), Point3(x, y + 1, 0)))
+    return node
+
+
+def collide_into_grid(solid_from, node_into):
+    root = NodePath("root")
+    node_from = CollisionNode("from")
+    node_from.add_solid(solid_from)
+    np_from = root.attach_new_node(node_from)
+    root.attach_new_node(node_into)
+
+    trav = CollisionTraverser()
+    queue = CollisionHandlerQueue()
+    trav.add_collider(np_from, queue)
+    trav.traverse(root)
+
+    hits = []
+    for entry in queue.get_entries():
+        origin = entry.get_into().get_collision_origin()
+        point = entry.get_surface_point(root)
+        hits.append((tuple(origin), tuple(point)))
+    return sorted(hits)
+
+
+def test_bvh_matches_linear():
+    min_items = ConfigVariableInt("collision-bvh-min-items")
+    old_value = min_items.get_value()
+
+    solids = [
+        CollisionRay((10.5, 20.5, 5), (0, 0, -1)),
+        CollisionRay((-1, -1, 1), (1, 1, -0.05)),
+        CollisionSphere((7, 7, 0), 1.5),
+        CollisionSegment((3.5, 3.5, 1), (30.5, 3.5, -1)),
+    ]
+
+    try:
+        for solid in solids:
+            min_items.set_value(0)
+            expected = collide_into_grid(solid, make_grid_node(40))
+            assert len(expected) > 0
+
+            min_items.set_value(4)
+            node = make_grid_node(40)
+            assert collide_into_grid(solid, node) == expected
+
+            # Changing the solids must throw away the old hierarchy.
+            node.remove_solid(0)
+            node.add_solid(CollisionPolygon(
+                Point3(0, 0, 0), Point3(1, 0, 0), Point3(1, 1, 0), Point3(0, 1, 0)))
+            assert collide_into_grid(solid, node) == expected
+    finally:
+        min_items.set_value(old_value)
+
+
+def test_bvh_ray_miss():
+    node = make_grid_node(20)
+    assert collide_into_grid(CollisionRay((50, 50, 5), (0, 0, -1)), node) == []
+
+
+def test_bvh_solid_moved():
+    min_items = ConfigVariableInt("collision-bvh-min-items")
+    old_value = min_items.get_value()
+
+    try:
+        min_items.set_value(4)
+        node = CollisionNode("spheres")
+        spheres = []
+        for i in range(40):
+            sphere = CollisionSphere((i * 10, 0, 0), 1)
+            node.add_solid(sphere)
+            spheres.append(sphere)
+
+        ray = CollisionRay((5, 50, 0), (0, -1, 0))
+        assert collide_into_grid(ray, node) == []
+
+        # Move one of the spheres into the path of the ray, after the
+        # hierarchy was built by the first traversal.
+        spheres[17].set_center((5, 0, 0))
+        hits = collide_into_grid(ray, node)
+        assert len(hits) == 1
+        assert hits[0][0] == (5, 0, 0)
+
+        # And out again.
+        spheres[17].set_center((170, 0, 0))
+        assert collide_into_grid(ray, node) == []
+    finally:
+        min_items.set_value(old_value)
@@ -0,0 +1,37 @@
+from collisions import *
+
+
+def traverse_rays(num_threads):
+    root = NodePath("root")
+
+    floor = CollisionNode("floor")
+    for x in range(10):
+        floor.add_solid(CollisionPolygon(
+            Point3(x, 0, 0), Point3(x + 1, 0, 0),
+            Point3(x + 1, 10, 0), Point3(x, 10, 0)))
+    root.attach_new_node(floor)
+
+    trav = CollisionTraverser()
+    trav.num_threads = num_threads
+    queue = CollisionHandlerQueue()
+
+    # Enough colliders to need several passes.
+    for i in range(200):
+        node = CollisionNode("ray%d" % i)
+        node.add_solid(CollisionRay((i % 20 * 0.5 + 0.25, i // 20 + 0.5, 1), (0, 0, -1)))
+        node.set_into_collide_mask(0)
+        trav.add_collider(root.attach_new_node(node), queue)
+
+    trav.traverse(root)
+    return [(entry.get_from_node_path().get_name(),
+             tuple(entry.get_surface_point(root)))
+            for entry in queue.get_entries()]
+
+
+def test_parallel_traverse_matches_serial():
+    expected = traverse_rays(1)
+    assert len(expected) == 200
+
+    # The entries must arrive in the very same order.
+    assert traverse_rays(4) == expected
+    assert traverse_rays(16) == expected
@@ -0,0 +1,107 @@
+from panda3d import core
+import pytest
+import time
+
+
+@pytest.fixture
+def buffer(graphics_pipe, graphics_engine, gsg):
+    buffer = graphics_engine.make_output(
+        graphics_pipe,
+        'cull',
+        0,
+        core.FrameBufferProperties(),
+        core.WindowProperties.size(32, 32),
+        core.GraphicsPipe.BF_refuse_window,
+        gsg
+    )
+    graphics_engine.open_windows()
+
+    if buffer is None:
+        pytest.skip("GraphicsPipe cannot make offscreen buffers")
+
+    yield buffer
+
+    graphics_engine.remove_window(buffer)
+
+
+def make_scene(draw_order, cull_callback=None, levels=4, fanout=3):
+    """Makes a tree of CallbackNodes, each of which records its name in
+    draw_order when it is drawn.  They are all in the unsorted bin, so they
+    are drawn in the order in which the cull traversal found them."""
+
+    root = core.NodePath("root")
+    root.set_bin("unsorted", 0)
+
+    def draw(cbdata, name):
+        draw_order.append(name)
+
+    def populate(parent, prefix, level):
+        for i in range(fanout):
+            name = "%s%d" % (prefix, i)
+            node = core.CallbackNode(name)
+            node.set_bounds(core.OmniBoundingVolume())
+            node.set_draw_callback(core.PythonCallbackObject(
+                lambda cbdata, name=name: draw(cbdata, name)))
+            if cull_callback is not None:
+                node.set_cull_callback(core.PythonCallbackObject(cull_callback))
+            np = parent.attach_new_node(node)
+            if level > 1:
+                populate(np, name + ".", level - 1)
+
+    populate(root, "", levels)
+    return root
+
+
+def render(engine, buffer, root, parallel_depth):
+    dr = buffer.make_display_region()
+    camera = root.attach_new_node(core.Camera("camera"))
+    dr.camera = camera
+    dr.get_cull_traverser().set_parallel_depth(parallel_depth)
+    assert dr.get_cull_traverser().get_parallel_depth() == parallel_depth
+
+    engine.render_frame()
+    engine.render_frame()
+
+    buffer.remove_display_region(dr)
+    camera.remove_node()
+
+
+@pytest.mark.parametrize("parallel_depth", [1, 2, 3, 5])
+def test_cull_parallel_matches_serial(graphics_engine, buffer, parallel_depth):
+    serial = []
+    render(graphics_engine, buffer, make_scene(serial), 0)
+    assert len(serial) == 2 * (3 + 9 + 27 + 81)
+
+    parallel = []
+    render(graphics_engine, buffer, make_scene(parallel), parallel_depth)
+    assert parallel == serial
+
+
+def test_cull_parallel_callbacks_serialized(graphics_engine, buffer):
+    active = [0]
+    overlapped = [False]
+    calls = [0]
+
+    def cull_callback(cbdata):
+        active[0] += 1
+        if active[0] > 1:
+            overlapped[0] = True
+        calls[0] += 1
+
+        # Give another thread a chance to call a callback at the same time.
+        time.sleep(0.0005)
+        active[0] -= 1
+
+        # This calls the callbacks of the children on this same thread.
+        cbdata.upcall()
+
+    serial = []
+    render(graphics_engine, buffer, make_scene(serial), 0)
+
+    parallel = []
+    root = make_scene(parallel, cull_callback)
+    render(graphics_engine, buffer, root, 2)
+
+    assert calls[0] == 2 * (3 + 9 + 27 + 81)
+    assert not overlapped[0]
+    assert parallel == serial
@@ -0,0 +1,115 @@
+from panda3d import core
+import pytest
+import random
+
+
+@pytest.fixture(scope='module')
+def tiny_pipe():
+    selection = core.GraphicsPipeSelection.get_global_ptr()
+    pipe = selection.make_module_pipe("p3tinydisplay")
+
+    if pipe is None or not pipe.is_valid():
+        pytest.skip("tinydisplay GraphicsPipe is not available")
+
+    yield pipe
+
+
+@pytest.fixture(scope='module')
+def tiny_buffer(tiny_pipe):
+    engine = core.GraphicsEngine()
+    engine.set_threading_model("")
+
+    fbprops = core.FrameBufferProperties()
+    fbprops.set_rgba_bits(8, 8, 8, 8)
+    fbprops.depth_bits = 16
+
+    buffer = engine.make_output(
+        tiny_pipe,
+        'buffer',
+        0,
+        fbprops,
+        core.WindowProperties.size(256, 192),
+        core.GraphicsPipe.BF_refuse_window,
+    )
+    engine.open_windows()
+
+    if buffer is None:
+        pytest.skip("tinydisplay cannot make offscreen buffers")
+
+    buffer.set_clear_color_active(True)
+    buffer.set_clear_color((0, 0, 0, 1))
+    buffer.set_clear_depth_active(True)
+
+    yield buffer
+
+    engine.remove_window(buffer)
+
+
+def make_scene():
+    """Makes lots of overlapping triangles at different depths, some of them
+    blended, and some of them partly off the screen."""
+
+    rand = random.Random(1)
+    scene = core.NodePath("root")
+
+    for blend in (False, True):
+        vdata = core.GeomVertexData("tris", core.GeomVertexFormat.get_v3c4(),
+                                    core.Geom.UH_static)
+        vertex = core.GeomVertexWriter(vdata, "vertex")
+        color = core.GeomVertexWriter(vdata, "color")
+        tris = core.GeomTriangles(core.Geom.UH_static)
+
+        for i in range(1500):
+            x = rand.uniform(-1.3, 1.3)
+            z = rand.uniform(-1.3, 1.3)
+            for j in range(3):
+                vertex.add_data3(x + rand.uniform(-0.4, 0.4),
+                                 rand.uniform(2, 10),
+                                 z + rand.uniform(-0.4, 0.4))
+                color.add_data4(rand.random(), rand.random(), rand.random(),
+                                0.5 if blend else 1.0)
+            tris.add_next_vertices(3)
+
+        geom = core.Geom(vdata)
+        geom.add_primitive(tris)
+        node = core.GeomNode("tris")
+        node.add_geom(geom)
+        np = scene.attach_new_node(node)
+        np.set_two_sided(True)
+        if blend:
+            np.set_transparency(core.TransparencyAttrib.M_alpha)
+
+    return scene
+
+
+def render(buffer, scene, num_bands):
+    core.ConfigVariableInt("td-num-bands").set_value(num_bands)
+
+    tex = core.Texture("fb")
+    buffer.add_render_texture(tex, core.GraphicsOutput.RTM_copy_ram)
+    dr = buffer.make_display_region()
+    camera = scene.attach_new_node(core.Camera("camera"))
+    camera.node().get_lens(0).set_near_far(1, 20)
+    dr.camera = camera
+
+    buffer.engine.render_frame()
+
+    buffer.remove_display_region(dr)
+    buffer.clear_render_textures()
+    camera.remove_node()
+    core.ConfigVariableInt("td-num-bands").clear_local_value()
+
+    assert tex.has_ram_image()
+    return bytes(tex.get_ram_image())
+
+
+@pytest.mark.parametrize("num_bands", [2, 4, 7, 64])
+def test_tinydisplay_bands_match_serial(tiny_buffer, num_bands):
+    scene = make_scene()
+    serial = render(tiny_buffer, scene, 1)
+
+    # Make sure something was actually drawn.
+    assert serial.count(b"\x00") < len(serial) // 2
+
+    parallel = render(tiny_buffer, scene, num_bands)
+    assert parallel == serial
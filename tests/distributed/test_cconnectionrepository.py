@@ -0,0 +1,164 @@
+from panda3d import core
+import pytest
+import socket
+import time
+
+direct = pytest.importorskip("panda3d.direct")
+
+pytestmark = pytest.mark.skipif(not core.Thread.is_true_threads(),
+                                reason="requires true threads")
+
+MSG_TYPE = 4242
+
+
+class Server(object):
+    """A bare TCP server that the repository can connect to."""
+
+    def __init__(self):
+        self.manager = core.QueuedConnectionManager()
+        self.listener = core.QueuedConnectionListener(self.manager, 0)
+        self.writer = core.ConnectionWriter(self.manager, 0)
+
+        s = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        s.bind(("127.0.0.1", 0))
+        self.port = s.getsockname()[1]
+        s.close()
+
+        self.rendezvous = self.manager.open_TCP_server_rendezvous(self.port, 5)
+        assert self.rendezvous is not None
+        self.listener.add_connection(self.rendezvous)
+
+    def connect(self, repo):
+        url = core.URLSpec("http://127.0.0.1:%d" % (self.port))
+        assert repo.try_connect_net(url)
+
+        end = time.time() + 5.0
+        while not self.listener.new_connection_available():
+            assert time.time() < end
+            time.sleep(0.001)
+
+        conn = core.PointerToConnection()
+        assert self.listener.get_new_connection(conn)
+        return conn.p()
+
+    def send(self, conn, values):
+        for value in values:
+            dg = core.Datagram()
+            dg.add_uint16(MSG_TYPE)
+            dg.add_uint32(value)
+            assert self.writer.send(dg, conn)
+
+    def close(self):
+        self.listener.remove_connection(self.rendezvous)
+        self.manager.close_connection(self.rendezvous)
+
+
+def make_repository(threaded_net, num_threads):
+    repo = direct.CConnectionRepository(False, threaded_net)
+    repo.set_handle_datagrams_internally(False)
+    repo.set_num_dispatch_threads(num_threads)
+    assert repo.get_num_dispatch_threads() == num_threads
+    return repo
+
+
+def receive(repo, count, timeout=5.0):
+    """Calls check_datagram() until count messages have arrived."""
+    received = []
+    end = time.time() + timeout
+    while len(received) < count and time.time() < end:
+        if repo.check_datagram():
+            assert repo.get_msg_type() == MSG_TYPE
+            dg = core.Datagram()
+            repo.get_datagram(dg)
+            di = core.DatagramIterator(dg)
+            assert di.get_uint16() == MSG_TYPE
+            received.append(di.get_uint32())
+        else:
+            time.sleep(0.001)
+    return received
+
+
+@pytest.mark.parametrize("threaded_net", [False, True])
+def test_dispatch_in_order(threaded_net):
+    server = Server()
+    repo = make_repository(threaded_net, 4)
+    conn = server.connect(repo)
+
+    count = 2000
+    server.send(conn, range(count))
+    assert receive(repo, count) == list(range(count))
+    assert not repo.check_datagram()
+
+    repo.shutdown()
+    server.close()
+
+
+@pytest.mark.parametrize("threaded_net", [False, True])
+def test_dispatch_stop_threads(threaded_net):
+    server = Server()
+    repo = make_repository(threaded_net, 2)
+    conn = server.connect(repo)
+
+    server.send(conn, range(500))
+    received = receive(repo, 100)
+
+    # Whatever the threads have already read is still returned in order, and
+    # the rest is read by check_datagram() itself.
+    repo.set_num_dispatch_threads(0)
+    assert repo.get_num_dispatch_threads() == 0
+    received += receive(repo, 400)
+    assert received == list(range(500))
+
+    repo.shutdown()
+    server.close()
+
+
+@pytest.mark.parametrize("threaded_net", [False, True])
+def test_dispatch_disconnect(threaded_net):
+    server = Server()
+    repo = make_repository(threaded_net, 2)
+    conn = server.connect(repo)
+
+    server.send(conn, range(1000))
+    assert receive(repo, 10) == list(range(10))
+
+    # Give the rest a chance to arrive; all of it is thrown away.
+    time.sleep(0.2)
+    repo.disconnect()
+    assert not repo.is_connected()
+    assert not repo.check_datagram()
+    server.manager.close_connection(conn)
+
+    # A new connection starts over from the beginning.
+    conn = server.connect(repo)
+    server.send(conn, range(5000, 5100))
+    assert receive(repo, 100) == list(range(5000, 5100))
+    assert not repo.check_datagram()
+
+    repo.shutdown()
+    server.close()
+
+
+def test_dispatch_connection_reset():
+    server = Server()
+    repo = make_repository(True, 2)
+    conn = server.connect(repo)
+
+    server.send(conn, range(50))
+    assert receive(repo, 50) == list(range(50))
+
+    # The server goes away; the repository notices, and the dispatch threads
+    # go back to waiting for a connection.
+    server.manager.close_connection(conn)
+    end = time.time() + 5.0
+    while repo.is_connected():
+        assert time.time() < end
+        time.sleep(0.01)
+    assert not repo.check_datagram()
+
+    conn = server.connect(repo)
+    server.send(conn, range(50, 100))
+    assert receive(repo, 50) == list(range(50, 100))
+
+    repo.shutdown()
+    server.close()
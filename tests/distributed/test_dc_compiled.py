@@ -0,0 +1,225 @@
+from panda3d import core
+import pytest
+
+direct = pytest.importorskip("panda3d.direct")
+
+DC_FILE = """
+typedef uint8(0-25) Color;
+
+struct Item {
+  uint16 itemId;
+  uint8(0-99) count;
+  int32 flags;
+};
+
+struct Look {
+  char('a','x') kind;
+  switch (uint8 gender) {
+  case 0:
+    uint8(0-20) shirt;
+    Color shirtColor;
+    break;
+
+  case 1:
+    string title;
+    Item items[];
+    break;
+  };
+  Color eyes;
+};
+
+dclass Target {
+  setTargetId(uint32 targetId) broadcast;
+  setLabel(string label) broadcast;
+};
+
+dclass Avatar {
+  setPos(int16 / 10, int16 % 360 / 10, float64) broadcast ram;
+  setName(string name) required broadcast;
+  setLook(Look look) broadcast;
+  setItems(Item items[]) ownrecv;
+  setSlots(uint16 slots[4]) ram;
+  setPath(int32(-100-100) points[0-3], blob data);
+  setTarget(Target target, uint8 mode);
+  setLooks(Look looks[2], Item item);
+};
+"""
+
+# The arguments to pack for each field; the first ones are valid, the rest
+# are malformed in some way.
+SAMPLES = {
+    "setPos": [
+        (1.5, 90.0, -3.25),
+        (-3276.8, 359.9, 0.0),
+        (4000.0, 0.0, 0.0),
+        (1.0, 2.0),
+        (1.0, 2.0, 3.0, 4.0),
+        ("x", 2.0, 3.0),
+        1.0,
+    ],
+    "setName": [
+        ("Flippy",),
+        ("",),
+        (5,),
+        (),
+        "Flippy",
+    ],
+    "setLook": [
+        (("a", (0, 10, 3), 7),),
+        (("x", (1, "Captain", [(1, 2, 3), (4, 5, -6)]), 25),),
+        (("x", (1, "", []), 0),),
+        (("b", (0, 10, 3), 7),),
+        (("a", (0, 30, 3), 7),),
+        (("a", (2, 10, 3), 7),),
+        (("a", (1, "Captain", [(1, 2)]), 25),),
+        (("a", (0, 10), 7),),
+        (("a", (0, 10, 3), 7, 8),),
+        (("a", 0, 10, 3, 7),),
+        ((),),
+    ],
+    "setItems": [
+        ([(1, 2, 3), (65535, 99, -1)],),
+        ([],),
+        ([(1, 100, 3)],),
+        ([(70000, 2, 3)],),
+        ([(1, 2)],),
+        ([5],),
+        (5,),
+    ],
+    "setSlots": [
+        ([1, 2, 3, 4],),
+        ([0, 0, 65535, 0],),
+        ([1, 2, 3],),
+        ([1, 2, 3, 4, 5],),
+        ([1, 2, 3, -4],),
+    ],
+    "setPath": [
+        ([1, -100, 100], b"\x00\x01\x02"),
+        ([], b""),
+        ([1, 2, 3, 4], b""),
+        ([101], b""),
+        ([1], "text"),
+    ],
+    "setTarget": [
+        (((12345,), ("home",)), 1),
+        (((0,), ("",)), 255),
+        (((12345,),), 1),
+        (((12345,), ("home",)), 256),
+        ((12345, "home"), 1),
+        (12345, 1),
+    ],
+    "setLooks": [
+        ([("a", (0, 1, 2), 3), ("x", (1, "t", [(7, 8, 9)]), 4)], (1, 2, 3)),
+        ([("a", (0, 1, 2), 3)], (1, 2, 3)),
+        ([("a", (0, 1, 2), 3), ("a", (5, 1, 2), 3)], (1, 2, 3)),
+    ],
+}
+
+
+@pytest.fixture(scope="module")
+def dc_class(tmp_path_factory):
+    filename = tmp_path_factory.mktemp("dc") / "test.dc"
+    filename.write_text(DC_FILE)
+
+    dc_file = direct.DCFile()
+    assert dc_file.read(core.Filename.from_os_specific(str(filename)))
+    dclass = dc_file.get_class_by_name("Avatar")
+    assert dclass is not None
+    yield dclass
+
+
+@pytest.fixture
+def compiled():
+    # Returns a function that calls the given function twice, with compiled
+    # fields turned off and then on, and returns both results.
+    var = core.ConfigVariableBool("dc-compiled-fields")
+    old_value = var.value
+
+    def run(func, *args):
+        results = []
+        for value in (False, True):
+            var.value = value
+            results.append(func(*args))
+        return results
+
+    try:
+        yield run
+    finally:
+        var.value = old_value
+
+
+def pack(field, args):
+    packer = direct.DCPacker()
+    packer.begin_pack(field)
+    try:
+        packer.pack_object(args)
+        exception = None
+    except Exception as ex:
+        exception = type(ex)
+    result = (exception, packer.had_pack_error(), packer.had_range_error(),
+              packer.get_bytes())
+    return result + (packer.end_pack(),)
+
+
+def unpack(field, data, op):
+    packer = direct.DCPacker()
+    packer.set_unpack_data(data)
+    packer.begin_unpack(field)
+    if op == "object":
+        value = repr(packer.unpack_object())
+    elif op == "validate":
+        value = packer.unpack_validate()
+    else:
+        value = packer.unpack_skip()
+    result = (value, packer.had_pack_error(), packer.had_range_error(),
+              packer.get_num_unpacked_bytes())
+    return result + (packer.end_unpack(),)
+
+
+def malformed(data):
+    # Truncations, trailing garbage, and single corrupted bytes.  The bytes
+    # are kept below 0x80, since invalid UTF-8 in a string can't be unpacked
+    # into a Python object at all.
+    yield data[:-1]
+    yield data[:len(data) // 2]
+    yield data + b"\x00"
+    for i in range(len(data)):
+        for byte in (0x00, 0x05, 0x7f):
+            yield data[:i] + bytes((byte,)) + data[i + 1:]
+
+
+@pytest.mark.parametrize("field_name", sorted(SAMPLES))
+def test_dc_compiled_pack(dc_class, compiled, field_name):
+    field = dc_class.get_field_by_name(field_name)
+    assert field is not None
+
+    for args in SAMPLES[field_name]:
+        generic, fast = compiled(pack, field, args)
+        assert generic == fast, args
+
+    # The first sample is always valid.
+    exception, had_pack_error, had_range_error, data, ok = \
+        pack(field, SAMPLES[field_name][0])
+    assert ok and exception is None
+    assert not had_pack_error and not had_range_error
+
+
+@pytest.mark.parametrize("field_name", sorted(SAMPLES))
+def test_dc_compiled_unpack(dc_class, compiled, field_name):
+    field = dc_class.get_field_by_name(field_name)
+
+    for args in SAMPLES[field_name]:
+        exception, had_pack_error, had_range_error, data, ok = pack(field, args)
+        if not ok:
+            continue
+
+        for bad in [data] + list(malformed(bytes(data))):
+            for op in ("object", "validate", "skip"):
+                generic, fast = compiled(unpack, field, bad, op)
+                assert generic == fast, (args, bad, op)
+
+    # The packed form of the first sample unpacks to the same arguments.
+    data = pack(field, SAMPLES[field_name][0])[3]
+    value, had_pack_error, had_range_error, length, ok = \
+        unpack(field, data, "object")
+    assert ok and length == len(data)
@@ -0,0 +1,79 @@
+from panda3d import core
+import math
+
+
+def make_skinned_vdata(num_rows, joints):
+    array_format = core.GeomVertexArrayFormat()
+    array_format.add_column("vertex", 3, core.Geom.NT_float32, core.Geom.C_point)
+    array_format.add_column("normal", 3, core.Geom.NT_float32, core.Geom.C_normal)
+    format = core.GeomVertexFormat(array_format)
+
+    animation = core.GeomVertexAnimationSpec()
+    animation.set_panda()
+    format.set_animation(animation)
+
+    anim_array_format = core.GeomVertexArrayFormat()
+    anim_array_format.add_column("transform_blend", 1, core.Geom.NT_uint16, core.Geom.C_index, 0, 2)
+    format.add_array(anim_array_format)
+    format = core.GeomVertexFormat.register_format(format)
+
+    table = core.TransformBlendTable()
+    table.set_rows(core.SparseArray.lower_on(num_rows))
+
+    vdata = core.GeomVertexData("test", format, core.Geom.UH_stream)
+    vdata.unclean_set_num_rows(num_rows)
+    vertex = core.GeomVertexWriter(vdata, "vertex")
+    normal = core.GeomVertexWriter(vdata, "normal")
+    blend = core.GeomVertexWriter(vdata, "transform_blend")
+
+    for i in range(num_rows):
+        tb = core.TransformBlend()
+        for k in range(min(4, len(joints))):
+            tb.add_transform(joints[(i + k) % len(joints)], 1.0 / (k + 1))
+        tb.normalize_weights()
+
+        vertex.add_data3(math.cos(i), math.sin(i), i * 0.01)
+        normal.add_data3(math.cos(i), math.sin(i), 0)
+        blend.add_data1i(table.add_blend(tb))
+
+    vdata.set_transform_blend_table(table)
+    return vdata
+
+
+def read_column(vdata, name):
+    reader = core.GeomVertexReader(vdata, name)
+    values = []
+    while not reader.is_at_end():
+        values.append(core.LVecBase3(reader.get_data3()))
+    return values
+
+
+def test_animated_vertices_fast_path():
+    joints = [core.UserVertexTransform("joint%d" % i) for i in range(6)]
+    for i, joint in enumerate(joints):
+        # Include a non-uniform scale, so that the normals need normalizing.
+        joint.set_matrix(core.LMatrix4.rotate_mat(i * 20, (0, 0, 1)) *
+                         core.LMatrix4.scale_mat(1, 1 + i * 0.5, 1) *
+                         core.LMatrix4.translate_mat(i, 0, 0))
+
+    vdata = make_skinned_vdata(50, joints)
+    var = core.ConfigVariableBool("fast-animated-vertices")
+    orig_value = var.value
+
+    try:
+        results = {}
+        for fast in (False, True):
+            var.value = fast
+            vdata.clear_animated_vertices()
+            animated = vdata.animate_vertices(True, core.Thread.get_current_thread())
+            results[fast] = (read_column(animated, "vertex"),
+                             read_column(animated, "normal"))
+    finally:
+        var.value = orig_value
+
+    for column in range(2):
+        generic = results[False][column]
+        fast = results[True][column]
+        assert len(generic) == len(fast) == 50
+        for a, b in zip(generic, fast):
+            assert a.almost_equal(b, 1e-4)
@@ -0,0 +1,174 @@
+from panda3d.core import Texture, SparseTextureImage, PNMImage, Filename
+from array import array
+
+
+def make_texture(x_size, y_size):
+    tex = Texture("")
+    tex.setup_2d_texture(x_size, y_size, Texture.T_unsigned_byte, Texture.F_rgb)
+    data = array('B')
+    for y in range(y_size):
+        for x in range(x_size):
+            data.extend((x & 0xff, y & 0xff, (x * 7 + y * 3) & 0xff))
+    tex.set_ram_image(data)
+    return tex, data
+
+
+def test_sparse_texture_tiles():
+    tex, data = make_texture(40, 24)
+    image = SparseTextureImage(tex, 16)
+    tex.clear_ram_image()
+
+    assert image.num_levels == 1
+    assert image.get_num_x_tiles(0) == 3
+    assert image.get_num_y_tiles(0) == 2
+    assert image.get_tile_x_size(0, 2) == 8
+    assert image.get_tile_y_size(0, 1) == 8
+
+    tile = image.get_tile(0, 2, 1)
+    assert len(tile) == 8 * 8 * 3
+    for y in range(8):
+        for x in range(8):
+            i = ((16 + y) * 40 + 32 + x) * 3
+            assert tuple(tile[(y * 8 + x) * 3:(y * 8 + x) * 3 + 3]) == tuple(data[i:i + 3])
+
+
+def test_sparse_texture_region():
+    tex, data = make_texture(40, 24)
+    image = SparseTextureImage(tex, 16)
+
+    region = image.extract_region(0, 10, 5, 20, 15)
+    assert len(region) == 20 * 15 * 3
+    for y in range(15):
+        for x in range(20):
+            i = ((5 + y) * 40 + 10 + x) * 3
+            j = (y * 20 + x) * 3
+            assert tuple(region[j:j + 3]) == tuple(data[i:i + 3])
+
+
+def test_sparse_texture_touched():
+    tex, data = make_texture(64, 64)
+    image = SparseTextureImage(tex, 16)
+    assert image.get_num_touched_tiles() == 0
+
+    image.get_tile(0, 1, 2)
+    image.get_tile(0, 1, 2)
+    image.extract_region(0, 0, 0, 20, 10)
+    touched = [tuple(image.get_touched_tile(i)) for i in range(image.get_num_touched_tiles())]
+    assert touched == [(1, 2, 0), (0, 0, 0), (1, 0, 0)]
+
+    image.clear_touched_tiles()
+    assert image.get_num_touched_tiles() == 0
+    image.get_tile(0, 1, 2)
+    assert image.get_num_touched_tiles() == 1
+
+
+def test_sparse_texture_evict():
+    tex, data = make_texture(64, 64)
+    image = SparseTextureImage(tex, 32)
+    tile = bytes(image.get_tile(0, 1, 1))
+    if not image.is_tile_resident(0, 0, 0):
+        # The tiles were paged out to disk; make sure they come back.
+        image.evict_tiles()
+        assert not image.is_tile_resident(0, 1, 1)
+        assert image.get_resident_size() == 0
+        assert bytes(image.get_tile(0, 1, 1)) == tile
+        assert image.is_tile_resident(0, 1, 1)
+        assert image.get_resident_size() == 32 * 32 * 3
+
+
+def write_image(tmp_path, x_size, y_size):
+    # The pixels match those of make_texture(), turned upside down.
+    pnm = PNMImage(x_size, y_size, 3, 255)
+    for y in range(y_size):
+        for x in range(x_size):
+            ty = y_size - 1 - y
+            pnm.set_xel_val(x, y, (x * 7 + ty * 3) & 0xff, ty & 0xff, x & 0xff)
+    filename = Filename.from_os_specific(str(tmp_path / "image.pnm"))
+    assert pnm.write(filename)
+    return filename
+
+
+def test_sparse_texture_from_file(tmp_path):
+    filename = write_image(tmp_path, 40, 24)
+    tex, data = make_texture(40, 24)
+
+    image = SparseTextureImage(filename, 16, Filename(), False)
+    assert image.is_valid()
+    assert image.num_levels == 1
+    assert image.num_components == 3
+    assert image.format == Texture.F_rgb
+
+    # Reading the file a strip at a time gives the same tiles as copying the
+    # RAM image of the texture.
+    copy = SparseTextureImage(tex, 16)
+    for ty in range(image.get_num_y_tiles(0)):
+        for tx in range(image.get_num_x_tiles(0)):
+            assert bytes(image.get_tile(0, tx, ty)) == bytes(copy.get_tile(0, tx, ty))
+
+
+def test_sparse_texture_mipmaps(tmp_path):
+    filename = write_image(tmp_path, 40, 24)
+    tex, data = make_texture(40, 24)
+
+    image = SparseTextureImage(filename, 16)
+    assert image.num_levels == 6
+    assert image.get_x_size(5) == 1
+    assert image.get_y_size(5) == 1
+
+    # Each pixel of the first mipmap level averages a 2x2 block.
+    level = image.extract_region(1, 0, 0, 20, 12)
+    for y in range(12):
+        for x in range(20):
+            for c in range(3):
+                total = sum(data[((y * 2 + dy) * 40 + x * 2 + dx) * 3 + c]
+                            for dy in range(2) for dx in range(2))
+                assert level[(y * 20 + x) * 3 + c] == (total + 2) // 4
+
+
+def test_sparse_texture_odd_mipmaps(tmp_path):
+    # With odd sizes, the same rows and columns are left out as by the
+    # texture's own mipmap generation, so only the rounding may differ.
+    filename = write_image(tmp_path, 37, 21)
+    tex, data = make_texture(37, 21)
+    tex.generate_ram_mipmap_images()
+
+    image = SparseTextureImage(filename, 16)
+    assert image.num_levels == tex.get_expected_num_mipmap_levels()
+    for n in range(1, image.num_levels):
+        x_size = image.get_x_size(n)
+        y_size = image.get_y_size(n)
+        assert x_size == tex.get_expected_mipmap_x_size(n)
+        assert y_size == tex.get_expected_mipmap_y_size(n)
+        level = image.extract_region(n, 0, 0, x_size, y_size)
+        expected = tex.get_ram_mipmap_image(n)
+        assert len(level) == len(expected)
+        assert max(abs(a - b) for a, b in zip(level, expected)) <= 1
+
+
+def test_sparse_texture_page_file(tmp_path):
+    filename = write_image(tmp_path, 40, 24)
+    page_filename = Filename.from_os_specific(str(tmp_path / "image.pst"))
+
+    image = SparseTextureImage(filename, 16, page_filename)
+    assert image.page_filename == page_filename
+    tiles = [bytes(image.get_tile(n, 0, 0)) for n in range(image.num_levels)]
+    del image
+
+    # The page file is kept, and can be opened again without the image.
+    assert page_filename.exists()
+    image = SparseTextureImage.open_page_file(page_filename)
+    assert image is not None
+    assert image.num_levels == len(tiles)
+    assert image.tile_size == 16
+    assert image.get_x_size(0) == 40
+    assert image.get_y_size(0) == 24
+    for n in range(image.num_levels):
+        assert bytes(image.get_tile(n, 0, 0)) == tiles[n]
+
+
+def test_sparse_texture_bad_file(tmp_path):
+    filename = Filename.from_os_specific(str(tmp_path / "missing.pnm"))
+    image = SparseTextureImage(filename)
+    assert not image.is_valid()
+
+    assert SparseTextureImage.open_page_file(filename) is None
@@ -134,3 +134,65 @@ def test_texture_clear_half():
     assert col.y == -inf
     assert col.z == -inf
     assert math.isnan(col.w)
+
+
+def test_texture_mipmap_unsigned_byte():
+    # Odd sizes drop the last row and column.
+    tex = Texture("")
+    tex.setup_2d_texture(5, 3, Texture.T_unsigned_byte, Texture.F_rgba)
+    data = array('B', [(i * 7) & 0xff for i in range(5 * 3 * 4)])
+    tex.set_ram_image(data)
+    tex.generate_ram_mipmap_images()
+    assert tex.get_num_ram_mipmap_images() == 3
+
+    level = tex.get_ram_mipmap_image(1)
+    assert len(level) == 2 * 1 * 4
+    for x in range(2):
+        for c in range(4):
+            total = sum(data[(y * 5 + x * 2 + i) * 4 + c] for y in range(2) for i in range(2))
+            assert level[x * 4 + c] == total // 4
+
+
+def test_texture_mipmap_half():
+    data = array('H', (
+        0b0011110000000000, # 1.0
+        0b0100000000000000, # 2.0
+        0b1100010000000000, # -4.0
+        0b0011100000000000, # 0.5
+    ))
+    tex = Texture("")
+    tex.setup_2d_texture(2, 2, Texture.T_half_float, Texture.F_luminance)
+    tex.set_ram_image(data)
+    tex.generate_ram_mipmap_images()
+    assert tex.get_num_ram_mipmap_images() == 2
+
+    level = array('H', bytes(tex.get_ram_mipmap_image(1)))
+    assert list(level) == [0b1011000000000000] # -0.125
+
+
+def test_texture_mipmap_3d_float():
+    tex = Texture("")
+    tex.setup_3d_texture(2, 2, 2, Texture.T_float, Texture.F_luminance)
+    tex.set_ram_image(array('f', range(8)))
+    tex.generate_ram_mipmap_images()
+    assert tex.get_num_ram_mipmap_images() == 2
+    assert array('f', bytes(tex.get_ram_mipmap_image(1)))[0] == 3.5
+
+
+def test_texture_mipmap_cube_map_threads():
+    # A large enough image is divided among threads; each page must still be
+    # filtered independently.
+    tex = Texture("")
+    tex.setup_cube_map(256, Texture.T_unsigned_byte, Texture.F_rgba)
+    data = array('B')
+    for page in range(6):
+        data.extend([page * 40] * (256 * 256 * 4))
+    tex.set_ram_image(data)
+    tex.generate_ram_mipmap_images()
+    assert tex.get_num_ram_mipmap_images() == 9
+
+    for n in range(1, 9):
+        level = bytes(tex.get_ram_mipmap_image(n))
+        page_size = len(level) // 6
+        for page in range(6):
+            assert level[page * page_size:(page + 1) * page_size] == bytes([page * 40]) * page_size
@@ -0,0 +1,105 @@
+from panda3d.core import Texture, AsyncTaskManager
+from array import array
+import pytest
+
+
+def make_texture(x_size, y_size, format, num_components):
+    tex = Texture("")
+    tex.setup_2d_texture(x_size, y_size, Texture.T_unsigned_byte, format)
+    data = array('B')
+    for y in range(y_size):
+        for x in range(x_size):
+            pixel = ((x * 255) // max(x_size - 1, 1), (y * 255) // max(y_size - 1, 1), 128, (x * 37 + y * 11) & 0xff)
+            data.extend(pixel[:num_components])
+    tex.set_ram_image(data)
+    return tex, data
+
+
+def decode_565(color):
+    r = (color >> 11) & 0x1f
+    g = (color >> 5) & 0x3f
+    b = color & 0x1f
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+
+def decode_bc1_block(block):
+    color0 = block[0] | (block[1] << 8)
+    color1 = block[2] | (block[3] << 8)
+    p0 = decode_565(color0)
+    p1 = decode_565(color1)
+    if color0 > color1:
+        palette = [p0, p1,
+                   tuple((2 * a + b) // 3 for a, b in zip(p0, p1)),
+                   tuple((a + 2 * b) // 3 for a, b in zip(p0, p1))]
+    else:
+        palette = [p0, p1, tuple((a + b) // 2 for a, b in zip(p0, p1)), (0, 0, 0)]
+    bits = block[4] | (block[5] << 8) | (block[6] << 16) | (block[7] << 24)
+    return [palette[(bits >> (i * 2)) & 3] for i in range(16)]
+
+
+@pytest.mark.parametrize("quality", [Texture.QL_fastest, Texture.QL_normal, Texture.QL_best])
+def test_texture_compress_dxt1(quality):
+    tex, data = make_texture(16, 8, Texture.F_rgb, 3)
+    assert tex.compress_ram_image(Texture.CM_dxt1, quality)
+    assert tex.ram_image_compression == Texture.CM_dxt1
+
+    image = bytes(tex.get_ram_image())
+    assert len(image) == 4 * 2 * 8
+
+    for by in range(2):
+        for bx in range(4):
+            offset = (by * 4 + bx) * 8
+            colors = decode_bc1_block(image[offset:offset + 8])
+            for i, color in enumerate(colors):
+                x = bx * 4 + (i & 3)
+                y = by * 4 + (i >> 2)
+                # The RAM image is stored in BGR order.
+                b, g, r = data[(y * 16 + x) * 3:(y * 16 + x) * 3 + 3]
+                assert abs(color[0] - r) <= 24
+                assert abs(color[1] - g) <= 24
+                assert abs(color[2] - b) <= 24
+
+
+def test_texture_compress_odd_size():
+    # Partial blocks at the edges are still encoded as whole blocks.
+    tex, data = make_texture(5, 3, Texture.F_rgba, 4)
+    assert tex.compress_ram_image(Texture.CM_dxt5)
+    assert tex.ram_image_compression == Texture.CM_dxt5
+    assert len(tex.get_ram_image()) == 2 * 1 * 16
+
+
+def test_texture_compress_rgtc():
+    tex, data = make_texture(8, 8, Texture.F_rg, 2)
+    assert tex.compress_ram_image(Texture.CM_rgtc)
+    assert tex.ram_image_compression == Texture.CM_rgtc
+    assert len(tex.get_ram_image()) == 2 * 2 * 16
+
+    assert tex.uncompress_ram_image()
+    image = tex.get_ram_image()
+    for i in range(len(data)):
+        assert abs(image[i] - data[i]) <= 20
+
+
+@pytest.mark.parametrize("compression,format,num_components", [
+    (Texture.CM_dxt1, Texture.F_rgb, 3),
+    (Texture.CM_dxt5, Texture.F_rgba, 4),
+    (Texture.CM_rgtc, Texture.F_rg, 2),
+])
+def test_texture_compress_threads_deterministic(compression, format, num_components):
+    # A large enough image is divided among the threads of the "compress"
+    # chain; the result must be the same as when it is compressed on a single
+    # thread.
+    chain = AsyncTaskManager.get_global_ptr().make_task_chain("compress")
+    old_num_threads = chain.get_num_threads()
+
+    images = []
+    try:
+        for num_threads in (0, 4):
+            chain.set_num_threads(num_threads)
+            tex, data = make_texture(256, 256, format, num_components)
+            assert tex.compress_ram_image(compression, Texture.QL_normal)
+            images.append(bytes(tex.get_ram_image()))
+    finally:
+        chain.set_num_threads(old_num_threads)
+
+    assert images[0] == images[1]
@@ -200,3 +200,79 @@ def test_reload_texture_without_alpha(pool, image_rgb_path, image_gray_path):
 
     tex = pool.load_texture(image_rgb_path)
     assert tex.num_components == 3
+
+
+def wait_for_texture_loader():
+    chain = core.AsyncTaskManager.get_global_ptr().find_task_chain("texture_loader")
+    if chain is not None:
+        chain.wait_for_tasks()
+
+
+def test_load_texture_async(pool, image_rgba_path):
+    request = pool.load_texture_async(image_rgba_path)
+    tex = request.texture
+    assert tex is not None
+
+    wait_for_texture_loader()
+    assert request.is_ready()
+    assert request.result() == tex
+    assert tex.num_components == 4
+    assert tex.fullpath == image_rgba_path
+    assert tex.has_ram_image()
+    assert pool.has_texture(image_rgba_path)
+    assert pool.load_texture(image_rgba_path) == tex
+
+
+def test_load_texture_async_already_loaded(pool, image_rgb_path):
+    tex = pool.load_texture(image_rgb_path)
+    request = pool.load_texture_async(image_rgb_path)
+    assert request.done()
+    assert request.texture == tex
+    assert request.result() == tex
+
+
+@pytest.mark.skipif(not core.Thread.is_threading_supported(),
+                    reason="Threading support disabled")
+def test_load_texture_async_sync_waits(pool, image_rgb_path):
+    request = pool.load_texture_async(image_rgb_path, 3)
+    assert pool.load_texture_async(image_rgb_path, 3) == request
+
+    # A synchronous load of the same texture gets the same object.
+    tex = pool.load_texture(image_rgb_path, 3)
+    assert tex == request.texture
+    assert tex.num_components == 3
+    wait_for_texture_loader()
+
+
+def test_load_texture_async_no_threads(pool, image_rgb_path):
+    task_mgr = core.AsyncTaskManager.get_global_ptr()
+    existed = task_mgr.find_task_chain("texture_loader") is not None
+    chain = task_mgr.make_task_chain("texture_loader")
+    num_threads = chain.get_num_threads()
+    chain.set_num_threads(0)
+    try:
+        request = pool.load_texture_async(image_rgb_path)
+
+        # Nothing is polling the chain, so a synchronous load has to finish
+        # the pending request itself rather than wait for it.
+        tex = pool.load_texture(image_rgb_path)
+        assert tex == request.texture
+        assert tex.has_ram_image()
+        assert tex.fullpath == image_rgb_path
+
+        chain.poll()
+        assert request.done()
+        assert request.result() == tex
+    finally:
+        if existed:
+            chain.set_num_threads(num_threads)
+        else:
+            task_mgr.remove_task_chain("texture_loader")
+
+
+def test_load_texture_async_missing(pool):
+    request = pool.load_texture_async("/nonexistent/texture.png")
+    wait_for_texture_loader()
+    assert request.done()
+    assert request.result() is None
+    assert not pool.has_texture("/nonexistent/texture.png")
@@ -0,0 +1,192 @@
+from panda3d import core
+import socket
+import time
+
+
+def find_free_port(kind):
+    s = socket.socket(socket.AF_INET, kind)
+    s.bind(("127.0.0.1", 0))
+    port = s.getsockname()[1]
+    s.close()
+    return port
+
+
+def make_datagram(i, size=16):
+    dg = core.Datagram()
+    dg.add_uint32(i)
+    dg.append_data(bytes(bytearray((i + j) & 0xff for j in range(size))))
+    return dg
+
+
+def receive(reader, count, timeout=5.0):
+    """Polls the reader until count datagrams have arrived in batches."""
+    received = []
+    end = time.time() + timeout
+    while len(received) < count and time.time() < end:
+        if reader.data_available():
+            batch = core.NetDatagramBatch()
+            num = reader.get_data_batch(batch)
+            assert num == batch.get_num_datagrams()
+            received.extend(batch.get_datagram(i) for i in range(num))
+        else:
+            time.sleep(0.001)
+    return received
+
+
+def test_udp_batch_receive():
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 0)
+    writer = core.ConnectionWriter(manager, 0)
+
+    port = find_free_port(socket.SOCK_DGRAM)
+    server = manager.open_UDP_connection(port)
+    assert server is not None
+    reader.add_connection(server)
+    client = manager.open_UDP_connection()
+
+    address = core.NetAddress()
+    address.set_host("127.0.0.1", port)
+
+    count = 100
+    sent = []
+    for i in range(count):
+        dg = make_datagram(i, i % 50)
+        sent.append(dg.get_message())
+        assert writer.send(dg, client, address)
+
+    received = receive(reader, count)
+
+    # Loopback UDP doesn't reorder, and the datagrams of one batch keep the
+    # order in which they were read.
+    assert [dg.get_message() for dg in received] == sent
+
+    # There is nothing left, and an empty batch stays empty.
+    batch = core.NetDatagramBatch()
+    assert not reader.data_available()
+    assert reader.get_data_batch(batch) == 0
+    assert batch.is_empty()
+
+    # No data is not the same as a closed socket.
+    assert not manager.reset_connection_available()
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+
+
+def test_pooled_buffers_not_reused_while_held():
+    prc = core.load_prc_file_data("", "net-receive-buffer-pool-size 4")
+    try:
+        manager = core.QueuedConnectionManager()
+        reader = core.QueuedConnectionReader(manager, 0)
+        writer = core.ConnectionWriter(manager, 0)
+
+        port = find_free_port(socket.SOCK_DGRAM)
+        server = manager.open_UDP_connection(port)
+        reader.add_connection(server)
+        client = manager.open_UDP_connection()
+
+        address = core.NetAddress()
+        address.set_host("127.0.0.1", port)
+
+        # Receive many more datagrams than there are pooled buffers, while
+        # holding on to all of them.  None may be overwritten by a later one.
+        held = []
+        for round in range(8):
+            for i in range(4):
+                assert writer.send(make_datagram(round * 4 + i), client, address)
+            held.extend(receive(reader, 4))
+
+        assert len(held) == 32
+        for i, dg in enumerate(held):
+            assert dg.get_message() == make_datagram(i).get_message()
+
+        # A copy of a received datagram is not affected by releasing it.
+        copy = core.Datagram(held[0])
+        del held[:]
+        assert writer.send(make_datagram(99), client, address)
+        assert len(receive(reader, 1)) == 1
+        assert copy.get_message() == make_datagram(0).get_message()
+
+        reader.remove_connection(server)
+        manager.close_connection(server)
+        manager.close_connection(client)
+    finally:
+        core.unload_prc_file(prc)
+
+
+def open_tcp_pair(manager, reader):
+    listener = core.QueuedConnectionListener(manager, 0)
+    port = find_free_port(socket.SOCK_STREAM)
+    rendezvous = manager.open_TCP_server_rendezvous(port, 5)
+    assert rendezvous is not None
+    listener.add_connection(rendezvous)
+
+    client = manager.open_TCP_client_connection("127.0.0.1", port, 3000)
+    assert client is not None
+
+    end = time.time() + 5.0
+    while not listener.new_connection_available():
+        assert time.time() < end
+        time.sleep(0.001)
+
+    server = core.PointerToConnection()
+    assert listener.get_new_connection(server)
+    server = server.p()
+    reader.add_connection(server)
+
+    listener.remove_connection(rendezvous)
+    manager.close_connection(rendezvous)
+    return client, server
+
+
+def test_tcp_large_datagram():
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 0)
+    reader.set_tcp_header_size(4)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_tcp_header_size(4)
+    client, server = open_tcp_pair(manager, reader)
+
+    # Much larger than the initial buffer, so that it has to be grown while
+    # it is being read.
+    sizes = [0, 1, 1000, 300000, 5000]
+    for i, size in enumerate(sizes):
+        assert writer.send(make_datagram(i, size), client)
+
+    received = receive(reader, len(sizes))
+    assert len(received) == len(sizes)
+    for i, size in enumerate(sizes):
+        assert received[i].get_message() == make_datagram(i, size).get_message()
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+
+
+def test_tcp_oversized_datagram():
+    prc = core.load_prc_file_data("", "net-max-datagram-size 1000")
+    try:
+        manager = core.QueuedConnectionManager()
+        reader = core.QueuedConnectionReader(manager, 0)
+        reader.set_tcp_header_size(4)
+        writer = core.ConnectionWriter(manager, 0)
+        writer.set_raw_mode(True)
+        client, server = open_tcp_pair(manager, reader)
+
+        # A header that claims a size beyond net-max-datagram-size.
+        header = core.Datagram()
+        header.add_uint32(0x7fffffff)
+        header.add_uint32(0)
+        assert writer.send(header, client)
+
+        end = time.time() + 5.0
+        while not manager.reset_connection_available():
+            assert time.time() < end
+            reader.data_available()
+            time.sleep(0.001)
+
+        assert not reader.data_available()
+        manager.close_connection(client)
+    finally:
+        core.unload_prc_file(prc)
@@ -0,0 +1,208 @@
+from panda3d import core
+import socket
+import time
+
+
+def find_free_port(kind):
+    s = socket.socket(socket.AF_INET, kind)
+    s.bind(("127.0.0.1", 0))
+    port = s.getsockname()[1]
+    s.close()
+    return port
+
+
+def make_datagram(i, size=16):
+    dg = core.Datagram()
+    dg.add_uint32(i)
+    dg.append_data(bytes(bytearray((i * 7 + j) & 0xff for j in range(size))))
+    return dg
+
+
+def receive(reader, count, timeout=10.0):
+    received = []
+    end = time.time() + timeout
+    while len(received) < count and time.time() < end:
+        if reader.data_available():
+            dg = core.NetDatagram()
+            if reader.get_data(dg):
+                received.append(dg)
+        else:
+            time.sleep(0.001)
+    return received
+
+
+def open_tcp_pair(manager, reader):
+    listener = core.QueuedConnectionListener(manager, 0)
+    port = find_free_port(socket.SOCK_STREAM)
+    rendezvous = manager.open_TCP_server_rendezvous(port, 5)
+    assert rendezvous is not None
+    listener.add_connection(rendezvous)
+
+    client = manager.open_TCP_client_connection("127.0.0.1", port, 3000)
+    assert client is not None
+
+    end = time.time() + 5.0
+    while not listener.new_connection_available():
+        assert time.time() < end
+        time.sleep(0.001)
+
+    server = core.PointerToConnection()
+    assert listener.get_new_connection(server)
+    server = server.p()
+    reader.add_connection(server)
+
+    listener.remove_connection(rendezvous)
+    manager.close_connection(rendezvous)
+    return client, server
+
+
+def test_coalesce_holds_until_flush():
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 0)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_coalesce(True)
+    writer.set_flush_deadline(1000.0)
+    assert writer.get_coalesce()
+    client, server = open_tcp_pair(manager, reader)
+
+    for i in range(10):
+        assert writer.send(make_datagram(i), client)
+    assert writer.get_num_pending() == 10
+
+    # The deadline hasn't passed, so nothing goes out yet.
+    assert writer.consider_flush()
+    assert writer.get_num_pending() == 10
+    assert receive(reader, 1, timeout=0.2) == []
+
+    assert writer.flush()
+    assert writer.get_num_pending() == 0
+    received = receive(reader, 10)
+    assert [dg.get_message() for dg in received] == \
+        [make_datagram(i).get_message() for i in range(10)]
+
+    # Once the deadline has passed, consider_flush() sends them.
+    writer.set_flush_deadline(0.0)
+    assert writer.send(make_datagram(10), client)
+    assert writer.consider_flush()
+    assert writer.get_num_pending() == 0
+    received = receive(reader, 1)
+    assert received[0].get_message() == make_datagram(10).get_message()
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+
+
+def test_coalesce_tcp_large_batch():
+    # With a small send buffer and a threaded reader on the other end, the
+    # gathered sendmsg() calls return after writing only part of the batch,
+    # often in the middle of a datagram.  More datagrams are sent than fit in
+    # a single sendmsg(), too.
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 1)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_coalesce(True)
+    writer.set_flush_deadline(1000.0)
+    client, server = open_tcp_pair(manager, reader)
+    client.set_send_buffer_size(4096)
+
+    sizes = [(i * 37) % 3000 for i in range(1000)] + [0, 200000, 1, 60000]
+    for i, size in enumerate(sizes):
+        assert writer.send(make_datagram(i, size), client)
+    assert writer.get_num_pending() == len(sizes)
+    assert writer.flush()
+
+    received = receive(reader, len(sizes))
+    assert len(received) == len(sizes)
+    for i, size in enumerate(sizes):
+        assert received[i].get_message() == make_datagram(i, size).get_message()
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+    reader.shutdown()
+
+
+def test_coalesce_udp():
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 1)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_coalesce(True)
+    writer.set_flush_deadline(1000.0)
+
+    port = find_free_port(socket.SOCK_DGRAM)
+    server = manager.open_UDP_connection(port)
+    server.set_recv_buffer_size(1 << 20)
+    reader.add_connection(server)
+    client = manager.open_UDP_connection()
+
+    address = core.NetAddress()
+    address.set_host("127.0.0.1", port)
+
+    # More than fit in a single sendmmsg() call.
+    count = 260
+    for i in range(count):
+        assert writer.send(make_datagram(i, i % 100), client, address)
+    assert writer.get_num_pending() == count
+    assert writer.flush()
+
+    received = receive(reader, count)
+    assert sorted(dg.get_message() for dg in received) == \
+        sorted(make_datagram(i, i % 100).get_message() for i in range(count))
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+    reader.shutdown()
+
+
+def test_shutdown_flushes():
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 0)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_coalesce(True)
+    writer.set_flush_deadline(1000.0)
+    client, server = open_tcp_pair(manager, reader)
+
+    for i in range(5):
+        assert writer.send(make_datagram(i), client)
+    writer.shutdown()
+    assert writer.get_num_pending() == 0
+
+    received = receive(reader, 5)
+    assert [dg.get_message() for dg in received] == \
+        [make_datagram(i).get_message() for i in range(5)]
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
+
+
+def test_coalesce_flushed_by_manager():
+    # Nothing calls the writer's own consider_flush() here; polling a reader
+    # of the same manager sends the datagrams once the deadline has passed.
+    manager = core.QueuedConnectionManager()
+    reader = core.QueuedConnectionReader(manager, 0)
+    writer = core.ConnectionWriter(manager, 0)
+    writer.set_coalesce(True)
+    writer.set_flush_deadline(0.05)
+    client, server = open_tcp_pair(manager, reader)
+
+    for i in range(3):
+        assert writer.send(make_datagram(i), client)
+    received = receive(reader, 3)
+    assert writer.get_num_pending() == 0
+    assert [dg.get_message() for dg in received] == \
+        [make_datagram(i).get_message() for i in range(3)]
+
+    # wait_for_readers() sends everything before it waits, deadline or not.
+    writer.set_flush_deadline(1000.0)
+    assert writer.send(make_datagram(3), client)
+    manager.wait_for_readers(0.5)
+    assert writer.get_num_pending() == 0
+    received = receive(reader, 1)
+    assert received[0].get_message() == make_datagram(3).get_message()
+
+    reader.remove_connection(server)
+    manager.close_connection(server)
+    manager.close_connection(client)
@@ -0,0 +1,66 @@
+from panda3d import core
+import pytest
+
+
+def make_scene():
+    root = core.PandaNode("root")
+    for i in range(3):
+        # Each array is large enough to be split into several pieces.
+        num_rows = 30000 + i * 1000
+        vdata = core.GeomVertexData("vdata%d" % i, core.GeomVertexFormat.get_v3(),
+                                    core.GeomEnums.UH_static)
+        vdata.set_num_rows(num_rows)
+        writer = core.GeomVertexWriter(vdata, 'vertex')
+        for j in range(num_rows):
+            writer.set_data3(i, j, j * 0.5)
+
+        prim = core.GeomPoints(core.GeomEnums.UH_static)
+        prim.add_consecutive_vertices(0, num_rows)
+        geom = core.Geom(vdata)
+        geom.add_primitive(prim)
+        node = core.GeomNode("geom%d" % i)
+        node.add_geom(geom)
+        root.add_child(node)
+
+    tex = core.Texture("tex")
+    tex.setup_2d_texture(512, 512, core.Texture.T_unsigned_byte, core.Texture.F_rgba)
+    tex.set_ram_image(bytes(bytearray(i % 251 for i in range(512 * 512 * 4))))
+    state = core.RenderState.make(core.TextureAttrib.make(tex))
+    root.add_child(core.GeomNode("textured"))
+    root.get_child(3).set_state(state)
+    return root
+
+
+def get_contents(root):
+    result = []
+    for i in range(3):
+        geom = root.get_child(i).get_geom(0)
+        vdata = geom.get_vertex_data()
+        result.append(bytes(vdata.get_array(0).get_handle().get_data()))
+        result.append(bytes(geom.get_primitive(0).get_vertices().get_handle().get_data()))
+
+    attrib = root.get_child(3).get_state().get_attrib(core.TextureAttrib)
+    result.append(bytes(attrib.get_texture().get_ram_image()))
+    return result
+
+
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_bam_file_threads(tmp_path, num_threads):
+    scene = make_scene()
+    filename = core.Filename.from_os_specific(str(tmp_path / "scene.bam"))
+
+    bam = core.BamFile()
+    assert bam.open_write(filename)
+    bam.writer.set_file_texture_mode(core.BamWriter.BTM_rawdata)
+    assert bam.write_object(scene)
+    bam.close()
+
+    bam = core.BamFile()
+    bam.num_threads = num_threads
+    assert bam.open_read(filename)
+    assert bam.reader.defer_decode == (num_threads > 1)
+    node = bam.read_node()
+    bam.close()
+
+    assert node is not None
+    assert get_contents(node) == get_contents(scene)
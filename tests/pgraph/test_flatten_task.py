@@ -0,0 +1,101 @@
+from panda3d import core
+import pytest
+
+
+def make_triangle(name, color):
+    vdata = core.GeomVertexData(name, core.GeomVertexFormat.get_v3c4(),
+                                core.GeomEnums.UH_static)
+    vertex = core.GeomVertexWriter(vdata, 'vertex')
+    col = core.GeomVertexWriter(vdata, 'color')
+    for pos in ((0, 0, 0), (1, 0, 0), (0, 0, 1)):
+        vertex.add_data3(*pos)
+        col.add_data4(color)
+
+    prim = core.GeomTriangles(core.GeomEnums.UH_static)
+    prim.add_vertices(0, 1, 2)
+    geom = core.Geom(vdata)
+    geom.add_primitive(prim)
+
+    node = core.GeomNode(name)
+    node.add_geom(geom)
+    return node
+
+
+def make_scene():
+    root = core.NodePath("root")
+    for i in range(6):
+        group = root.attach_new_node("group%d" % i)
+        group.set_pos(i, 0, 0)
+        for j in range(4):
+            leaf = group.attach_new_node(make_triangle("tri%d_%d" % (i, j), (i / 6.0, j / 4.0, 0, 1)))
+            leaf.set_pos(0, j, 0)
+            leaf.set_hpr(j * 10, 0, 0)
+        if i % 2 == 0:
+            group.set_color(1, 0, 0, 1)
+
+    # An instanced subgraph must be duplicated by both flattens.
+    shared = core.NodePath(make_triangle("shared", (0, 0, 1, 1)))
+    shared.instance_to(root.attach_new_node("inst1"))
+    shared.instance_to(root.attach_new_node("inst2"))
+    return root
+
+
+def describe(np):
+    result = []
+    for path in [np] + list(np.find_all_matches('**')):
+        node = path.node()
+        entry = [node.get_type().name, node.name, path.get_transform().get_mat()]
+        if isinstance(node, core.GeomNode):
+            for geom in node.get_geoms():
+                reader = core.GeomVertexReader(geom.get_vertex_data(), 'vertex')
+                vertices = []
+                while not reader.is_at_end():
+                    vertices.append(tuple(reader.get_data3()))
+                entry.append((geom.get_primitive_type(), vertices))
+        result.append(entry)
+    return result
+
+
+@pytest.mark.parametrize("level", ["light", "medium", "strong"])
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_flatten_task_matches_flatten(level, num_threads):
+    expected = make_scene()
+    expected_removed = getattr(expected, "flatten_" + level)()
+
+    scene = make_scene()
+    task = core.FlattenTask(scene.node(), getattr(core.FlattenTask, "FL_" + level))
+    task.num_threads = num_threads
+    assert not task.is_flattened()
+
+    # Do the least amount of work per step, to make sure that stopping after
+    # every single node doesn't change the outcome.
+    num_steps = 0
+    while not task.step(0):
+        num_steps += 1
+    assert num_steps > 1
+    assert task.is_flattened()
+    assert task.step(0)
+
+    assert task.num_removed == expected_removed
+    assert describe(scene) == describe(expected)
+
+
+def test_flatten_task_manager():
+    expected = make_scene()
+    expected.flatten_strong()
+
+    scene = make_scene()
+    task = core.FlattenTask(scene.node())
+    task.time_slice = 0
+
+    mgr = core.AsyncTaskManager("test_flatten_task")
+    mgr.add(task)
+    for i in range(10000):
+        if task.done():
+            break
+        mgr.poll()
+
+    assert task.done()
+    assert task.result() == scene.node()
+    assert describe(scene) == describe(expected)
+    mgr.cleanup()
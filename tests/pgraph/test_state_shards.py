@@ -0,0 +1,37 @@
+from panda3d import core
+
+
+def test_transformstate_shards_uniquify():
+    num_shards = core.TransformState.get_num_state_shards()
+    assert num_shards >= 1
+
+    # Equivalent states must still collapse to the same pointer, regardless
+    # of which shard they end up in.
+    states = [core.TransformState.make_pos((i, 0, 0)) for i in range(100)]
+    for i, state in enumerate(states):
+        assert core.TransformState.make_pos((i, 0, 0)) == state
+        assert core.TransformState.make_pos((i, 0, 0)).this == state.this
+
+    core.TransformState.clear_state_shard_counters()
+    core.TransformState.make_pos((1, 0, 0))
+    hits = sum(core.TransformState.get_state_shard_hits(i) for i in range(num_shards))
+    assert hits >= 1
+
+    assert core.TransformState.validate_states()
+
+
+def test_renderstate_shards_uniquify():
+    num_shards = core.RenderState.get_num_state_shards()
+    assert num_shards >= 1
+
+    core.RenderState.clear_state_shard_counters()
+    state1 = core.RenderState.make(core.ColorAttrib.make_flat((0.25, 0.5, 0.75, 1)))
+    state2 = core.RenderState.make(core.ColorAttrib.make_flat((0.25, 0.5, 0.75, 1)))
+    assert state1.this == state2.this
+
+    hits = sum(core.RenderState.get_state_shard_hits(i) for i in range(num_shards))
+    misses = sum(core.RenderState.get_state_shard_misses(i) for i in range(num_shards))
+    assert hits >= 1
+    assert misses >= 1
+
+    assert core.RenderState.validate_states()
@@ -1,4 +1,7 @@
-from panda3d.core import PNMImage, PNMImageHeader
+from panda3d.core import PNMImage, PNMImageHeader, PfmFile, StringStream
+from panda3d.core import LMatrix4f, LVecBase3f
+import math
+import pytest
 
 
 def test_pixelspec_ctor():
@@ -19,3 +22,209 @@ def test_pixelspec_coerce():
     img = PNMImage(1, 1, 4)
     img.set_pixel(0, 0, (1, 2, 3, 4))
     assert img.get_pixel(0, 0) == (1, 2, 3, 4)
+
+
+@pytest.mark.parametrize("method", ["box", "gaussian", "lanczos", "mitchell"])
+def test_filter_from_solid(method):
+    # The weights of every filter add up to one, so a solid color stays put.
+    src = PNMImage(37, 23, 4)
+    src.fill(0.25, 0.5, 0.75)
+    src.alpha_fill(1.0)
+
+    for x_size, y_size in ((16, 9), (80, 50)):
+        dest = PNMImage(x_size, y_size, 4)
+        getattr(dest, method + "_filter_from")(2.0, src)
+        for y in range(y_size):
+            for x in range(x_size):
+                assert dest.get_xel_a(x, y).almost_equal((0.25, 0.5, 0.75, 1.0), 1.0 / 255)
+
+
+@pytest.mark.parametrize("method", ["lanczos", "mitchell"])
+def test_filter_from_gradient(method):
+    # Downscaling a horizontal ramp by two gives the same ramp.
+    src = PNMImage(64, 4, 1)
+    for y in range(4):
+        for x in range(64):
+            src.set_gray_val(x, y, x * 4)
+
+    dest = PNMImage(32, 2, 1)
+    getattr(dest, method + "_filter_from")(2.0, src)
+    for x in range(4, 28):
+        assert abs(dest.get_gray_val(x, 0) - (x * 8 + 2)) <= 1
+        assert dest.get_gray_val(x, 0) == dest.get_gray_val(x, 1)
+
+
+def test_quick_filter_from():
+    src = PNMImage(4, 2, 3)
+    for x in range(4):
+        src.set_xel_val(x, 0, x * 20, 0, 0)
+        src.set_xel_val(x, 1, x * 20 + 40, 0, 0)
+
+    dest = PNMImage(2, 1, 3)
+    dest.quick_filter_from(src)
+    assert dest.get_xel_val(0, 0) == (30, 0, 0)
+    assert dest.get_xel_val(1, 0) == (70, 0, 0)
+
+
+def test_pfm_read_png_strips():
+    # An integer image is converted to a PfmFile a strip of rows at a time.
+    image = PNMImage(7, 150, 1, 65535)
+    for y in range(150):
+        for x in range(7):
+            image.set_gray_val(x, y, y * 400 + x)
+
+    stream = StringStream()
+    assert image.write(stream, "test.png")
+
+    pfm = PfmFile()
+    assert pfm.read(stream, "test.png")
+    assert pfm.get_x_size() == 7
+    assert pfm.get_y_size() == 150
+    for y in (0, 63, 64, 149):
+        for x in range(7):
+            assert pfm.get_point1(x, y) == pytest.approx((y * 400 + x) / 65535.0)
+
+
+def test_pfm_write_png_strips():
+    # Writing a PfmFile to an integer image type streams the rows out.
+    pfm = PfmFile()
+    pfm.clear(5, 130, 3)
+    for y in range(130):
+        for x in range(5):
+            pfm.set_point(x, y, (x / 4.0, y / 129.0, 0.5))
+
+    stream = StringStream()
+    assert pfm.write(stream, "test.png")
+
+    image = PNMImage()
+    assert image.read(stream, "test.png")
+    assert image.get_x_size() == 5
+    assert image.get_y_size() == 130
+    for y in (0, 64, 129):
+        for x in range(5):
+            xel = image.get_xel(x, y)
+            assert xel[0] == pytest.approx(x / 4.0, abs=1e-4)
+            assert xel[1] == pytest.approx(y / 129.0, abs=1e-4)
+
+
+def test_png_read_size():
+    # A power-of-two reduction is applied while the rows are being read.
+    image = PNMImage(16, 16, 1)
+    for y in range(16):
+        for x in range(16):
+            image.set_gray_val(x, y, (x // 4) * 40 + (y // 4) * 10)
+
+    stream = StringStream()
+    assert image.write(stream, "test.png")
+
+    reduced = PNMImage()
+    reduced.set_read_size(4, 4)
+    assert reduced.read(stream, "test.png")
+    assert reduced.get_x_size() == 4
+    assert reduced.get_y_size() == 4
+    for y in range(4):
+        for x in range(4):
+            assert reduced.get_gray_val(x, y) == x * 40 + y * 10
+
+
+def test_pfm_xform():
+    # Large enough to be divided among threads.
+    pfm = PfmFile()
+    pfm.clear(300, 300, 3)
+    pfm.fill((1, 2, 3))
+    pfm.set_point(299, 299, (-1, 0, 0.5))
+
+    mat = LMatrix4f.scale_mat(2, 3, 4) * LMatrix4f.translate_mat(1, 1, 1)
+    pfm.xform(mat)
+    assert pfm.get_point(0, 0) == (3, 7, 13)
+    assert pfm.get_point(150, 200) == (3, 7, 13)
+    assert pfm.get_point(299, 299) == (-1, 1, 3)
+
+
+def test_pfm_xform_no_data():
+    pfm = PfmFile()
+    pfm.clear(2, 1, 4)
+    pfm.set_point4(0, 0, (1, 2, 3, 1))
+    pfm.set_point4(1, 0, (0, 0, 0, 0))
+    pfm.set_no_data_value((0, 0, 0, 0))
+
+    pfm.xform(LMatrix4f.translate_mat(1, 1, 1))
+    assert pfm.get_point4(0, 0) == (2, 3, 4, 1)
+    assert pfm.get_point4(1, 0) == (0, 0, 0, 0)
+
+
+def test_pfm_calc_min_max():
+    pfm = PfmFile()
+    pfm.clear(300, 300, 3)
+    pfm.fill((1, 2, 3))
+    pfm.set_point(10, 250, (-5, 2, 3))
+    pfm.set_point(299, 0, (1, 8, -7))
+
+    min_point = LVecBase3f()
+    max_point = LVecBase3f()
+    assert pfm.calc_min_max(min_point, max_point)
+    assert min_point == (-5, 2, -7)
+    assert max_point == (1, 8, 3)
+
+    # Points with the no-data value are left out.
+    pfm.set_no_data_value((1, 8, -7, 0))
+    assert pfm.calc_min_max(min_point, max_point)
+    assert min_point == (-5, 2, 3)
+    assert max_point == (1, 2, 3)
+
+
+def test_pfm_merge():
+    pfm = PfmFile()
+    pfm.clear(300, 300, 3)
+    pfm.fill((1, 1, 1))
+    pfm.set_point(5, 5, (-1, -1, -1))
+    pfm.set_point(299, 299, (-1, -1, -1))
+    pfm.set_no_data_value((-1, -1, -1, -1))
+
+    other = PfmFile()
+    other.clear(300, 300, 3)
+    other.fill((2, 3, 4))
+    pfm.merge(other)
+    assert pfm.get_point(0, 0) == (1, 1, 1)
+    assert pfm.get_point(5, 5) == (2, 3, 4)
+    assert pfm.get_point(299, 299) == (2, 3, 4)
+
+
+def test_pfm_apply_crop():
+    pfm = PfmFile()
+    pfm.clear(300, 300, 2)
+    for i in range(300):
+        pfm.set_point2(i, i, (i, -i))
+
+    pfm.apply_crop(100, 250, 50, 290)
+    assert pfm.get_x_size() == 150
+    assert pfm.get_y_size() == 240
+    assert pfm.get_point2(0, 50) == (100, -100)
+    assert pfm.get_point2(149, 199) == (249, -249)
+    assert pfm.get_point2(1, 50) == (0, 0)
+
+
+def test_pfm_half():
+    pfm = PfmFile()
+    pfm.clear(3, 2, 3)
+    pfm.set_point(0, 0, (0.5, -2, 1024))
+    pfm.set_point(1, 0, (0.1, 1e-8, 1e6))
+    pfm.set_point(2, 1, (float('inf'), -65504, 3.140625))
+
+    data = pfm.store_half()
+    assert len(data) == 3 * 2 * 3
+
+    result = PfmFile()
+    assert result.load_half(3, 2, 3, data)
+    assert result.get_x_size() == 3
+    assert result.get_y_size() == 2
+    assert result.get_num_channels() == 3
+    assert result.get_point(0, 0) == (0.5, -2, 1024)
+    assert result.get_point(1, 0)[0] == pytest.approx(0.1, rel=1e-3)
+    # Too small for a half-float becomes zero, too large becomes infinity.
+    assert result.get_point(1, 0)[1] == 0
+    assert math.isinf(result.get_point(1, 0)[2])
+    assert math.isinf(result.get_point(2, 1)[0])
+    assert result.get_point(2, 1)[1] == -65504
+    assert result.get_point(2, 1)[2] == 3.140625
+    assert result.get_point(0, 1) == (0, 0, 0)
@@ -0,0 +1,96 @@
+from panda3d.core import BamCache, Filename, PandaNode
+import hashlib
+import os
+import tempfile
+
+
+def write_source(path, contents):
+    with open(path, 'wb') as f:
+        f.write(contents)
+
+
+def test_bam_cache_concurrent():
+    with tempfile.TemporaryDirectory() as tmp:
+        cache_dir = os.path.join(tmp, 'cache')
+        source = os.path.join(tmp, 'model.egg')
+        write_source(source, b'<CoordinateSystem> { Z-up }\n')
+
+        cache = BamCache()
+        cache.concurrent = True
+        cache.root = Filename.from_os_specific(cache_dir)
+        source_fn = Filename.from_os_specific(source)
+
+        record = cache.lookup(source_fn, "bam")
+        assert record is not None
+        assert not record.has_data()
+        record.add_dependent_file(source_fn)
+        record.set_data(PandaNode("cached"))
+        assert cache.store(record)
+
+        # The record is stored by itself, in a subdirectory, without an index.
+        cache_filename = record.cache_filename
+        assert cache_filename.get_dirname() != ""
+        assert os.path.exists(os.path.join(cache_dir, cache_filename.to_os_specific()))
+        assert not os.path.exists(os.path.join(cache_dir, 'index_name.txt'))
+
+        record = cache.lookup(source_fn, "bam")
+        assert record.has_data()
+        assert record.data.name == "cached"
+
+        # A different cache instance, as from another process, finds it too.
+        other = BamCache()
+        other.concurrent = True
+        other.root = Filename.from_os_specific(cache_dir)
+        record = other.lookup(source_fn, "bam")
+        assert record.has_data()
+
+        # Changing the contents of the source file means a new cache file.
+        write_source(source, b'<CoordinateSystem> { Y-up }\n')
+        record = cache.lookup(source_fn, "bam")
+        assert not record.has_data()
+        assert record.cache_filename != cache_filename
+
+
+def test_bam_cache_concurrent_touched():
+    # In concurrent mode, the source file is validated by its contents, so
+    # merely updating its timestamp doesn't invalidate the cache.
+    with tempfile.TemporaryDirectory() as tmp:
+        source = os.path.join(tmp, 'model.egg')
+        write_source(source, b'<CoordinateSystem> { Z-up }\n')
+
+        cache = BamCache()
+        cache.concurrent = True
+        cache.root = Filename.from_os_specific(os.path.join(tmp, 'cache'))
+        source_fn = Filename.from_os_specific(source)
+
+        record = cache.lookup(source_fn, "bam")
+        record.add_dependent_file(source_fn)
+        record.set_data(PandaNode("cached"))
+        assert cache.store(record)
+
+        st = os.stat(source)
+        os.utime(source, (st.st_atime + 100, st.st_mtime + 100))
+
+        record = cache.lookup(source_fn, "bam")
+        assert record.has_data()
+
+
+def test_bam_cache_concurrent_hash():
+    # The cache file is named for the MD5 hash of the source pathname and of
+    # the source contents, whether or not Panda was built with OpenSSL.
+    with tempfile.TemporaryDirectory() as tmp:
+        contents = b'<CoordinateSystem> { Z-up }\n' * 100
+        source = os.path.join(tmp, 'model.egg')
+        write_source(source, contents)
+
+        cache = BamCache()
+        cache.concurrent = True
+        cache.root = Filename.from_os_specific(os.path.join(tmp, 'cache'))
+        source_fn = Filename.from_os_specific(source)
+        source_fn.make_absolute()
+
+        key = source_fn.get_fullpath() + "\n" + hashlib.md5(contents).hexdigest()
+        hash = hashlib.md5(key.encode()).hexdigest()
+
+        record = cache.lookup(source_fn, "bam")
+        assert record.cache_filename == Filename(hash[:2], hash + ".bam")
@@ -0,0 +1,71 @@
+from panda3d import core
+import pytest
+
+
+def make_vdata(num_rows):
+    vdata = core.GeomVertexData("test", core.GeomVertexFormat.get_v3(),
+                                core.GeomEnums.UH_static)
+    vdata.set_num_rows(num_rows)
+    writer = core.GeomVertexWriter(vdata, 'vertex')
+    for i in range(num_rows):
+        writer.set_data3(i, i * 2, i * 3)
+    return vdata
+
+
+def write_bam(path, obj, mappable):
+    bam = core.BamFile()
+    assert bam.open_write(core.Filename.from_os_specific(str(path)))
+    bam.writer.mappable_arrays = mappable
+    assert bam.write_object(obj)
+    bam.close()
+
+
+def read_bam(path, map_arrays):
+    bam = core.BamFile()
+    assert bam.open_read(core.Filename.from_os_specific(str(path)))
+    bam.reader.map_arrays = map_arrays
+    obj = bam.read_object()
+    assert bam.resolve()
+    bam.close()
+    return obj
+
+
+@pytest.mark.parametrize("mappable", [False, True])
+@pytest.mark.parametrize("map_arrays", [False, True])
+def test_bam_mapped_arrays(tmp_path, mappable, map_arrays):
+    vdata = make_vdata(1000)
+    path = tmp_path / "vdata.bam"
+    write_bam(path, vdata, mappable)
+
+    # The data is padded out to a page boundary only if it is mappable.
+    if mappable:
+        assert path.stat().st_size > 4096 + vdata.get_array(0).data_size_bytes
+    else:
+        assert path.stat().st_size < 4096 + vdata.get_array(0).data_size_bytes
+
+    vdata2 = read_bam(path, map_arrays)
+    array = vdata2.get_array(0)
+    assert array.is_mapped() == (mappable and map_arrays)
+    assert bytes(array.get_handle().get_data()) == bytes(vdata.get_array(0).get_handle().get_data())
+
+    # Modifying the array must not modify the file.
+    writer = core.GeomVertexWriter(vdata2, 'vertex')
+    writer.set_data3(0, -1, -1)
+    assert not vdata2.get_array(0).is_mapped()
+
+    vdata3 = read_bam(path, map_arrays)
+    reader = core.GeomVertexReader(vdata3, 'vertex')
+    assert reader.get_data3() == (0, 0, 0)
+
+
+def test_bam_mapped_arrays_small(tmp_path):
+    # Arrays smaller than a page are always written inline.
+    vdata = make_vdata(3)
+    path = tmp_path / "vdata.bam"
+    write_bam(path, vdata, True)
+
+    vdata2 = read_bam(path, True)
+    assert not vdata2.get_array(0).is_mapped()
+    reader = core.GeomVertexReader(vdata2, 'vertex')
+    reader.set_row(2)
+    assert reader.get_data3() == (2, 4, 6)